@@ -0,0 +1,232 @@
+// Compares two ways of turning a parse into an AST: creating an owl_tree and
+// walking it with the parsed_*_get functions, or building the AST directly
+// with owl_build.  See README.md for details.
+#ifndef BENCH_PARSER
+#define BENCH_PARSER "json.h"
+#endif
+#define BENCH_NO_MAIN
+#define OWL_BUILDER
+#define OWL_COMPACT
+#include "bench.c"
+
+struct ast {
+    enum parsed_type type;
+    double number;
+    const char *string;
+    size_t length;
+    struct ast *keys;
+    struct ast *values;
+    struct ast *next;
+};
+
+struct arena {
+    struct ast *nodes;
+    size_t used;
+    size_t capacity;
+};
+
+static struct ast *new_node(struct arena *arena)
+{
+    if (arena->used == arena->capacity)
+        abort();
+    struct ast *node = &arena->nodes[arena->used++];
+    memset(node, 0, sizeof(*node));
+    return node;
+}
+
+static struct ast *walk_strings(struct arena *arena, struct owl_ref ref)
+{
+    struct ast *first = 0;
+    struct ast **link = &first;
+    for (; !ref.empty; ref = owl_next(ref)) {
+        struct parsed_string string = parsed_string_get(ref);
+        struct ast *node = new_node(arena);
+        node->string = string.string;
+        node->length = string.length;
+        *link = node;
+        link = &node->next;
+    }
+    return first;
+}
+
+static struct ast *walk_values(struct arena *arena, struct owl_ref ref)
+{
+    struct ast *first = 0;
+    struct ast **link = &first;
+    for (; !ref.empty; ref = owl_next(ref)) {
+        struct parsed_value value = parsed_value_get(ref);
+        struct ast *node = new_node(arena);
+        node->type = value.type;
+        switch (value.type) {
+        case PARSED_OBJECT:
+            node->keys = walk_strings(arena, value.string);
+            node->values = walk_values(arena, value.value);
+            break;
+        case PARSED_ARRAY:
+            node->values = walk_values(arena, value.value);
+            break;
+        case PARSED_STRING: {
+            struct parsed_string string = parsed_string_get(value.string);
+            node->string = string.string;
+            node->length = string.length;
+            break;
+        }
+        case PARSED_POS_NUMBER:
+            node->number = parsed_number_get(value.number).number;
+            break;
+        case PARSED_NEG_NUMBER:
+            node->number = -parsed_number_get(value.number).number;
+            break;
+        default:
+            break;
+        }
+        *link = node;
+        link = &node->next;
+    }
+    return first;
+}
+
+static void *build(const struct owl_match *match, void *next_sibling,
+ void *info)
+{
+    struct ast *node = new_node(info);
+    node->next = next_sibling;
+    switch (match->rule) {
+    case OWL_RULE_STRING:
+        node->string = match->string;
+        node->length = match->length;
+        break;
+    case OWL_RULE_NUMBER:
+        node->number = match->number;
+        break;
+    case OWL_RULE_VALUE: {
+        // The fields of parsed_value are string, value, and number.
+        struct ast *string = match->slots[0];
+        struct ast *number = match->slots[2];
+        node->type = match->type;
+        switch (match->type) {
+        case PARSED_OBJECT:
+            node->keys = string;
+            node->values = match->slots[1];
+            break;
+        case PARSED_ARRAY:
+            node->values = match->slots[1];
+            break;
+        case PARSED_STRING:
+            node->string = string->string;
+            node->length = string->length;
+            break;
+        case PARSED_POS_NUMBER:
+            node->number = number->number;
+            break;
+        case PARSED_NEG_NUMBER:
+            node->number = -number->number;
+            break;
+        default:
+            break;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return node;
+}
+
+static bool asts_equal(struct ast *a, struct ast *b)
+{
+    for (; a && b; a = a->next, b = b->next) {
+        if (a->type != b->type || a->number != b->number ||
+         a->length != b->length ||
+         (a->length && memcmp(a->string, b->string, a->length)) ||
+         !asts_equal(a->keys, b->keys) || !asts_equal(a->values, b->values))
+            return false;
+    }
+    return !a && !b;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t megabytes = argc > 1 ? strtoul(argv[1], 0, 10) : 16;
+    int iterations = argc > 2 ? atoi(argv[2]) : 5;
+    char *input = generate_json(megabytes << 20);
+    size_t length = strlen(input);
+    struct arena walked = { .capacity = length };
+    struct arena built = { .capacity = length };
+    walked.nodes = malloc(walked.capacity * sizeof(struct ast));
+    built.nodes = malloc(built.capacity * sizeof(struct ast));
+    if (!walked.nodes || !built.nodes)
+        abort();
+    double best_walk = 0;
+    double best_traversal = 0;
+    double best_compaction = 0;
+    double best_compacted_traversal = 0;
+    double best_build = 0;
+    size_t tree_size = 0;
+    size_t compacted_size = 0;
+    struct ast *walked_root = 0;
+    struct ast *built_root = 0;
+    for (int i = 0; i < iterations; ++i) {
+        walked.used = 0;
+        double start = now();
+        struct owl_tree *tree = owl_tree_create_from_string(input);
+        if (owl_tree_get_error(tree, NULL) != ERROR_NONE) {
+            fprintf(stderr, "error: parse failed\n");
+            return 1;
+        }
+        double traversal_start = now();
+        walked_root = walk_values(&walked, owl_tree_root_ref(tree));
+        double traversal = now() - traversal_start;
+        tree_size = tree->next_offset;
+        double elapsed = now() - start;
+        if (best_walk == 0 || elapsed < best_walk)
+            best_walk = elapsed;
+        if (best_traversal == 0 || traversal < best_traversal)
+            best_traversal = traversal;
+
+        // Walk the same tree again after compacting it.  The AST from this
+        // walk is the one checked against owl_build's.
+        walked.used = 0;
+        double compaction_start = now();
+        owl_tree_compact(tree);
+        double compaction = now() - compaction_start;
+        traversal_start = now();
+        walked_root = walk_values(&walked, owl_tree_root_ref(tree));
+        traversal = now() - traversal_start;
+        compacted_size = tree->next_offset;
+        owl_tree_destroy(tree);
+        if (best_compaction == 0 || compaction < best_compaction)
+            best_compaction = compaction;
+        if (best_compacted_traversal == 0 ||
+         traversal < best_compacted_traversal)
+            best_compacted_traversal = traversal;
+
+        built.used = 0;
+        start = now();
+        void *root = 0;
+        struct owl_builder builder = { .build = build, .info = &built };
+        if (owl_build(input, length, builder, &root, NULL) != ERROR_NONE) {
+            fprintf(stderr, "error: parse failed\n");
+            return 1;
+        }
+        built_root = root;
+        elapsed = now() - start;
+        if (best_build == 0 || elapsed < best_build)
+            best_build = elapsed;
+    }
+    if (!asts_equal(walked_root, built_root)) {
+        fprintf(stderr, "error: the ASTs are different\n");
+        return 1;
+    }
+    printf("%s: %.1f MB, tree then walk in %.3f s (%.1f MB/s), owl_build in "
+     "%.3f s (%.1f MB/s)\n", argv[0], length / 1e6, best_walk,
+     length / 1e6 / best_walk, best_build, length / 1e6 / best_build);
+    printf("  walk alone in %.3f s, %.1f MB tree\n", best_traversal,
+     tree_size / 1e6);
+    printf("  owl_tree_compact in %.3f s, then walk in %.3f s, %.1f MB tree\n",
+     best_compaction, best_compacted_traversal, compacted_size / 1e6);
+    free(walked.nodes);
+    free(built.nodes);
+    free(input);
+    return 0;
+}
@@ -0,0 +1,515 @@
+// A throughput benchmark for generated parsers.  Each benchmark is built from
+// this file with BENCH_PARSER set to a generated header and BENCH_INPUT set to
+// one of the input generators below.  See README.md for details.
+#define _POSIX_C_SOURCE 199309L
+#ifdef __linux__
+// For syscall(), which opens the hardware counters.
+#define _DEFAULT_SOURCE
+#endif
+#define OWL_PARSER_IMPLEMENTATION
+#include BENCH_PARSER
+
+#include <time.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define PERF_COUNT_HW_INSTRUCTIONS 0
+#define PERF_COUNT_HW_BRANCH_MISSES 0
+#endif
+#ifdef OWL_THREADS
+#include <unistd.h>
+#endif
+
+struct buffer {
+    char *text;
+    size_t length;
+    size_t capacity;
+};
+
+static uint32_t random_state = 1;
+
+static uint32_t random_below(uint32_t n)
+{
+    random_state = random_state * 1103515245 + 12345;
+    return (random_state >> 16) % n;
+}
+
+static void append(struct buffer *b, const char *text, size_t length)
+{
+    if (b->length + length + 1 > b->capacity) {
+        b->capacity = (b->length + length + 1) * 2;
+        b->text = realloc(b->text, b->capacity);
+        if (!b->text)
+            abort();
+    }
+    memcpy(b->text + b->length, text, length);
+    b->length += length;
+    b->text[b->length] = '\0';
+}
+
+static void append_string(struct buffer *b, const char *text)
+{
+    append(b, text, strlen(text));
+}
+
+static void append_indentation(struct buffer *b, int depth)
+{
+    for (int i = 0; i < depth; ++i)
+        append_string(b, "    ");
+}
+
+static void append_word(struct buffer *b, uint32_t min, uint32_t max)
+{
+    uint32_t length = min + random_below(max - min + 1);
+    for (uint32_t i = 0; i < length; ++i) {
+        char c = 'a' + random_below(26);
+        if (i > 0 && random_below(8) == 0)
+            c = '_';
+        append(b, &c, 1);
+    }
+}
+
+// Identifiers start with 'v' so they never collide with keywords.
+static void append_identifier(struct buffer *b)
+{
+    append_string(b, "v");
+    append_word(b, 2, 13);
+}
+
+static void append_number(struct buffer *b)
+{
+    char number[32];
+    if (random_below(2))
+        snprintf(number, sizeof(number), "%u", random_below(1000000));
+    else {
+        snprintf(number, sizeof(number), "%u.%u", random_below(1000),
+         random_below(100000));
+    }
+    append_string(b, number);
+}
+
+static void append_json_value(struct buffer *b, int depth)
+{
+    uint32_t kind = depth > 6 ? 2 + random_below(4) : random_below(6);
+    switch (kind) {
+    case 0:
+    case 1: {
+        bool object = kind == 0;
+        uint32_t n = 1 + random_below(6);
+        append_string(b, object ? "{\n" : "[\n");
+        for (uint32_t i = 0; i < n; ++i) {
+            append_indentation(b, depth + 1);
+            if (object) {
+                append_string(b, "\"");
+                append_word(b, 3, 16);
+                append_string(b, "\": ");
+            }
+            append_json_value(b, depth + 1);
+            append_string(b, i + 1 < n ? ",\n" : "\n");
+        }
+        append_indentation(b, depth);
+        append_string(b, object ? "}" : "]");
+        break;
+    }
+    case 2:
+        append_string(b, "\"");
+        for (uint32_t words = random_below(8); words > 0; --words) {
+            append_word(b, 2, 10);
+            append_string(b, " ");
+        }
+        append_word(b, 2, 10);
+        append_string(b, "\"");
+        break;
+    case 3:
+        if (random_below(4) == 0)
+            append_string(b, "-");
+        append_number(b);
+        break;
+    case 4:
+        append_string(b, random_below(2) ? "true" : "false");
+        break;
+    default:
+        append_string(b, "null");
+        break;
+    }
+}
+
+char *generate_json(size_t size)
+{
+    struct buffer b = {0};
+    append_string(&b, "[\n");
+    while (b.length < size) {
+        append_indentation(&b, 1);
+        append_json_value(&b, 1);
+        append_string(&b, ",\n");
+    }
+    append_string(&b, "    null\n]\n");
+    return b.text;
+}
+
+static void append_expression(struct buffer *b, int depth)
+{
+    switch (depth > 2 ? random_below(3) : random_below(5)) {
+    case 0:
+        append_identifier(b);
+        break;
+    case 1: {
+        char integer[16];
+        snprintf(integer, sizeof(integer), "%u", random_below(100000));
+        append_string(b, integer);
+        break;
+    }
+    case 2:
+        append_string(b, "\"");
+        for (uint32_t words = random_below(6); words > 0; --words) {
+            append_word(b, 2, 10);
+            append_string(b, " ");
+        }
+        append_string(b, "\"");
+        break;
+    case 3: {
+        append_identifier(b);
+        append_string(b, "(");
+        uint32_t n = 1 + random_below(3);
+        for (uint32_t i = 0; i < n; ++i) {
+            append_expression(b, depth + 1);
+            if (i + 1 < n)
+                append_string(b, ", ");
+        }
+        append_string(b, ")");
+        break;
+    }
+    default:
+        append_expression(b, depth + 1);
+        append_string(b, random_below(2) ? " + " : " * ");
+        append_expression(b, depth + 1);
+        break;
+    }
+}
+
+static void append_block(struct buffer *b, int depth)
+{
+    append_string(b, "{\n");
+    for (uint32_t n = 1 + random_below(6); n > 0; --n) {
+        if (random_below(3) == 0) {
+            append_indentation(b, depth + 1);
+            append_string(b, "// ");
+            for (uint32_t words = 3 + random_below(8); words > 0; --words) {
+                append_word(b, 2, 9);
+                append_string(b, " ");
+            }
+            append_string(b, "\n");
+        }
+        append_indentation(b, depth + 1);
+        switch (depth > 3 ? random_below(3) : random_below(4)) {
+        case 0:
+            append_string(b, "let ");
+            append_identifier(b);
+            append_string(b, " = ");
+            append_expression(b, 0);
+            append_string(b, ";\n");
+            break;
+        case 1:
+            append_string(b, "return ");
+            append_expression(b, 0);
+            append_string(b, ";\n");
+            break;
+        case 2:
+            append_expression(b, 0);
+            append_string(b, ";\n");
+            break;
+        default:
+            append_string(b, "if ");
+            append_expression(b, 1);
+            append_string(b, " == ");
+            append_expression(b, 1);
+            append_string(b, " ");
+            append_block(b, depth + 1);
+            append_string(b, "\n");
+            break;
+        }
+    }
+    append_indentation(b, depth);
+    append_string(b, "}");
+}
+
+char *generate_source(size_t size)
+{
+    struct buffer b = {0};
+    while (b.length < size) {
+        append_string(&b, "// ");
+        append_word(&b, 10, 60);
+        append_string(&b, "\nfn ");
+        append_identifier(&b);
+        append_string(&b, "(");
+        append_identifier(&b);
+        append_string(&b, ", ");
+        append_identifier(&b);
+        append_string(&b, ") ");
+        append_block(&b, 0);
+        append_string(&b, "\n\n");
+    }
+    return b.text;
+}
+
+static const char *sql_keywords[] = {
+    "ABORT", "ABSOLUTE", "ACCESS", "ACTION", "ADD", "ADMIN", "AFTER",
+    "AGGREGATE", "ALL", "ALSO", "ALTER", "ALWAYS", "ANALYZE", "AND", "ANY",
+    "ARRAY", "AS", "ASC", "ASSERTION", "ASSIGNMENT", "ASYMMETRIC", "AT",
+    "ATTACH", "ATTRIBUTE", "AUTHORIZATION", "BACKWARD", "BEFORE", "BEGIN",
+    "BETWEEN", "BIGINT", "BINARY", "BIT", "BOOLEAN", "BOTH", "BY", "CACHE",
+    "CALL", "CALLED", "CASCADE", "CASCADED", "CASE", "CAST", "CATALOG", "CHAIN",
+    "CHAR", "CHARACTER", "CHARACTERISTICS", "CHECK", "CHECKPOINT", "CLASS",
+    "CLOSE", "CLUSTER", "COALESCE", "COLLATE", "COLLATION", "COLUMN", "COLUMNS",
+    "COMMENT", "COMMENTS", "COMMIT", "COMMITTED", "CONCURRENTLY",
+    "CONFIGURATION", "CONFLICT", "CONNECTION", "CONSTRAINT", "CONSTRAINTS",
+    "CONTENT", "CONTINUE", "CONVERSION", "COPY", "COST", "CREATE", "CROSS",
+    "CSV", "CUBE", "CURRENT", "CURSOR", "CYCLE", "DATA", "DATABASE", "DAY",
+    "DEALLOCATE", "DEC", "DECIMAL", "DECLARE", "DEFAULT", "DEFAULTS",
+    "DEFERRABLE", "DEFERRED", "DEFINER", "DELETE", "DELIMITER", "DELIMITERS",
+    "DEPENDS", "DESC", "DETACH", "DICTIONARY", "DISABLE", "DISCARD", "DISTINCT",
+    "DO", "DOCUMENT", "DOMAIN", "DOUBLE", "DROP", "EACH", "ELSE", "ENABLE",
+    "ENCODING", "ENCRYPTED", "END", "ENUM", "ESCAPE", "EVENT", "EXCEPT",
+    "EXCLUDE", "EXCLUDING", "EXCLUSIVE", "EXECUTE", "EXISTS", "EXPLAIN",
+    "EXTENSION", "EXTERNAL", "EXTRACT", "FALSE", "FAMILY", "FETCH", "FILTER",
+    "FIRST", "FLOAT", "FOLLOWING", "FOR", "FORCE", "FOREIGN", "FORWARD",
+    "FREEZE", "FROM", "FULL", "FUNCTION", "FUNCTIONS", "GENERATED", "GLOBAL",
+    "GRANT", "GRANTED", "GREATEST", "GROUP", "GROUPING", "GROUPS", "HANDLER",
+    "HAVING", "HEADER", "HOLD", "HOUR", "IDENTITY", "IF", "ILIKE", "IMMEDIATE",
+    "IMMUTABLE", "IMPLICIT", "IMPORT", "IN", "INCLUDE", "INCLUDING",
+    "INCREMENT", "INDEX", "INDEXES", "INHERIT", "INHERITS", "INITIALLY",
+    "INLINE", "INNER", "INOUT", "INPUT", "INSENSITIVE", "INSERT", "INSTEAD",
+    "INT", "INTEGER", "INTERSECT", "INTERVAL", "INTO", "INVOKER", "IS",
+    "ISNULL", "ISOLATION", "JOIN", "KEY", "LABEL", "LANGUAGE", "LARGE", "LAST",
+    "LATERAL", "LEADING", "LEAKPROOF", "LEAST", "LEFT", "LEVEL", "LIKE",
+    "LIMIT", "LISTEN", "LOAD", "LOCAL", "LOCATION", "LOCK", "LOCKED", "LOGGED",
+    "MAPPING", "MATCH", "MATERIALIZED", "MAXVALUE", "METHOD", "MINUTE",
+    "MINVALUE", "MODE", "MONTH", "MOVE", "NAME", "NAMES", "NATIONAL", "NATURAL",
+    "NCHAR", "NEW", "NEXT", "NO", "NONE", "NOT", "NOTHING", "NOTIFY", "NOTNULL",
+    "NOWAIT", "NULL", "NULLIF", "NULLS", "NUMERIC", "OBJECT", "OF", "OFF",
+    "OFFSET", "OIDS", "OLD", "ON", "ONLY", "OPERATOR", "OPTION", "OPTIONS",
+    "OR", "ORDER", "ORDINALITY", "OTHERS", "OUT", "OUTER", "OVER", "OVERLAPS",
+    "OVERLAY", "OVERRIDING", "OWNED", "OWNER", "PARALLEL", "PARSER", "PARTIAL",
+    "PARTITION", "PASSING", "PASSWORD", "PLACING", "PLANS", "POLICY",
+    "POSITION", "PRECEDING", "PRECISION", "PREPARE", "PREPARED", "PRESERVE",
+    "PRIMARY", "PRIOR", "PRIVILEGES", "PROCEDURAL", "PROCEDURE", "PROCEDURES",
+    "PROGRAM", "PUBLICATION", "QUOTE", "RANGE", "READ", "REAL", "REASSIGN",
+    "RECHECK", "RECURSIVE", "REF", "REFERENCES", "REFERENCING", "REFRESH",
+    "REINDEX", "RELATIVE", "RELEASE", "RENAME", "REPEATABLE", "REPLACE",
+    "REPLICA", "RESET", "RESTART", "RESTRICT", "RETURNING", "RETURNS", "REVOKE",
+    "RIGHT", "ROLE", "ROLLBACK", "ROLLUP", "ROUTINE", "ROUTINES", "ROW", "ROWS",
+    "RULE", "SAVEPOINT", "SCHEMA", "SCHEMAS", "SCROLL", "SEARCH", "SECOND",
+    "SECURITY", "SELECT", "SEQUENCE", "SEQUENCES", "SERIALIZABLE", "SERVER",
+    "SESSION", "SET", "SETOF", "SETS", "SHARE", "SHOW", "SIMILAR", "SIMPLE",
+    "SKIP", "SMALLINT", "SNAPSHOT", "SOME", "STABLE", "STANDALONE", "START",
+    "STATEMENT", "STATISTICS", "STDIN", "STDOUT", "STORAGE", "STORED", "STRICT",
+    "STRIP", "SUBSCRIPTION", "SUBSTRING", "SUPPORT", "SYMMETRIC", "SYSID",
+    "SYSTEM", "TABLE", "TABLES", "TABLESAMPLE", "TABLESPACE", "TEMP",
+    "TEMPLATE", "TEMPORARY", "TEXT", "THEN", "TIES", "TIME", "TIMESTAMP", "TO",
+    "TRAILING", "TRANSACTION", "TRANSFORM", "TREAT", "TRIGGER", "TRIM", "TRUE",
+    "TRUNCATE", "TRUSTED", "TYPE", "TYPES", "UNBOUNDED", "UNCOMMITTED",
+    "UNENCRYPTED", "UNION", "UNIQUE", "UNKNOWN", "UNLISTEN", "UNLOGGED",
+    "UNTIL", "UPDATE", "USER", "USING", "VACUUM", "VALID", "VALIDATE",
+    "VALIDATOR", "VALUE", "VALUES", "VARCHAR", "VARIADIC", "VARYING", "VERBOSE",
+    "VERSION", "VIEW", "VIEWS", "VOLATILE", "WHEN", "WHERE", "WHITESPACE",
+    "WINDOW", "WITH", "WITHIN", "WITHOUT", "WORK", "WRAPPER", "WRITE", "XML",
+    "YEAR", "YES", "ZONE",
+};
+
+static void append_sql_words(struct buffer *b, int depth)
+{
+    size_t number_of_keywords = sizeof(sql_keywords) / sizeof(sql_keywords[0]);
+    for (uint32_t n = 2 + random_below(12); n > 0; --n) {
+        uint32_t kind = random_below(20);
+        if (kind < 12)
+            append_string(b, sql_keywords[random_below(number_of_keywords)]);
+        else if (kind < 14) {
+            // Identifiers that start with a keyword.
+            append_string(b, sql_keywords[random_below(number_of_keywords)]);
+            append_string(b, "_");
+            append_word(b, 2, 6);
+        } else if (kind < 16)
+            append_identifier(b);
+        else if (kind == 16) {
+            char integer[16];
+            snprintf(integer, sizeof(integer), "%u", random_below(100000));
+            append_string(b, integer);
+        } else if (kind == 17) {
+            append_string(b, "'");
+            append_word(b, 2, 12);
+            append_string(b, "'");
+        } else if (kind == 18 && depth < 2) {
+            append_string(b, "(");
+            append_sql_words(b, depth + 1);
+            append_string(b, ")");
+        } else
+            append_string(b, random_below(2) ? "," : "=");
+        append_string(b, n > 1 ? " " : "");
+    }
+}
+
+char *generate_sql(size_t size)
+{
+    struct buffer b = {0};
+    while (b.length < size) {
+        append_sql_words(&b, 0);
+        append_string(&b, ";\n");
+    }
+    return b.text;
+}
+
+// Numbers in the forms that show up in telemetry and JSON exports: fixed-point
+// readings, round-tripped doubles, scientific notation, and integers.
+static void append_float(struct buffer *b)
+{
+    char number[40];
+    double reading = random_below(1000000) + random_below(1000000) / 1e6;
+    switch (random_below(4)) {
+    case 0:
+        snprintf(number, sizeof(number), "%.3f", reading / 1000);
+        break;
+    case 1:
+        snprintf(number, sizeof(number), "%.17g", reading / 7);
+        break;
+    case 2:
+        snprintf(number, sizeof(number), "%u.%05ue%d", 1 + random_below(9),
+         random_below(100000), (int)random_below(600) - 300);
+        break;
+    default:
+        snprintf(number, sizeof(number), "%u", random_below(1000000));
+        break;
+    }
+    if (random_below(4) == 0)
+        append_string(b, "-");
+    append_string(b, number);
+}
+
+char *generate_numbers(size_t size)
+{
+    struct buffer b = {0};
+    append_string(&b, "[\n");
+    while (b.length < size) {
+        for (int i = 0; i < 8; ++i) {
+            append_float(&b);
+            append_string(&b, ", ");
+        }
+        append_string(&b, "\n");
+    }
+    append_string(&b, "0\n]\n");
+    return b.text;
+}
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+#ifndef BENCH_NO_MAIN
+// Hardware counters (on Linux, where perf events are allowed) count what the
+// parser does in each iteration.  Returns -1 if the counter isn't available.
+static int open_counter(uint64_t config)
+{
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+    return -1;
+#endif
+}
+
+static void start_counter(int fd)
+{
+#ifdef __linux__
+    if (fd < 0)
+        return;
+    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+}
+
+static uint64_t stop_counter(int fd)
+{
+    uint64_t count = 0;
+#ifdef __linux__
+    if (fd < 0)
+        return 0;
+    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    if (read(fd, &count, sizeof(count)) != sizeof(count))
+        count = 0;
+#endif
+    return count;
+}
+
+int main(int argc, char *argv[])
+{
+    size_t megabytes = argc > 1 ? strtoul(argv[1], 0, 10) : 16;
+    int iterations = argc > 2 ? atoi(argv[2]) : 5;
+#ifdef OWL_THREADS
+#ifdef BENCH_PIPELINE
+    // The -pipeline variants tokenize on a second thread instead.
+    unsigned threads = 1;
+    bool pipeline = true;
+#else
+    // The -threads variants use every processor unless told otherwise.
+    unsigned threads = argc > 3 ? strtoul(argv[3], 0, 10) :
+     (unsigned)sysconf(_SC_NPROCESSORS_ONLN);
+    bool pipeline = false;
+#endif
+#endif
+    char *input = BENCH_INPUT(megabytes << 20);
+    size_t length = strlen(input);
+    double best = 0;
+    int instructions = open_counter(PERF_COUNT_HW_INSTRUCTIONS);
+    int branch_misses = open_counter(PERF_COUNT_HW_BRANCH_MISSES);
+    uint64_t best_instructions = 0;
+    uint64_t best_branch_misses = 0;
+    for (int i = 0; i < iterations; ++i) {
+        start_counter(instructions);
+        start_counter(branch_misses);
+        double start = now();
+#ifdef OWL_THREADS
+        struct owl_tree *tree = owl_tree_create_with_options(
+         (struct owl_tree_options){ .string = input, .threads = threads,
+         .pipeline = pipeline });
+#else
+        struct owl_tree *tree = owl_tree_create_from_string(input);
+#endif
+        double elapsed = now() - start;
+        uint64_t instructions_count = stop_counter(instructions);
+        uint64_t branch_misses_count = stop_counter(branch_misses);
+        struct source_range range;
+        if (owl_tree_get_error(tree, &range) != ERROR_NONE) {
+            fprintf(stderr, "error: parse failed at %zu-%zu\n", range.start,
+             range.end);
+            return 1;
+        }
+        owl_tree_destroy(tree);
+        if (best == 0 || elapsed < best) {
+            best = elapsed;
+            best_instructions = instructions_count;
+            best_branch_misses = branch_misses_count;
+        }
+    }
+    printf("%s: %.1f MB in %.3f s (%.1f MB/s)\n", argv[0], length / 1e6,
+     best, length / 1e6 / best);
+    if (instructions >= 0 && branch_misses >= 0) {
+        printf("  %.2f instructions/byte, %.2f branch misses/KB\n",
+         (double)best_instructions / length,
+         (double)best_branch_misses * 1024 / length);
+    }
+    free(input);
+    return 0;
+}
+#endif
@@ -0,0 +1,5647 @@
+// This file was generated by the Owl parsing tool.
+// Make sure to #define OWL_PARSER_IMPLEMENTATION somewhere so the parser
+// is compiled properly.  Just two lines are enough -- a typical parser.c might
+// look like:
+//
+//   #define OWL_PARSER_IMPLEMENTATION
+//   #include "parser.h"
+//
+// Some parts of the interface are only declared and compiled if you define
+// these before including this file (everywhere it's included):
+//
+//   OWL_PARSER_API  owl_parser_...() for streaming and reusing memory
+//   OWL_BATCH       owl_parse_batch()
+//   OWL_COMPACT     owl_tree_compact()
+//   OWL_INDEX       owl_tree_nodes_of_rule() and the other index queries
+//   OWL_BUILDER     owl_build(), for building your own nodes
+//
+// The grammar's 12 tokens fall into 12 token classes.
+
+#ifndef OWL_PARSER_H
+#define OWL_PARSER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// The owl_tree struct represents an entire parse tree.  Use the
+// owl_tree_create_...() functions to create a tree, then call owl_tree_root()
+// to get the root owl_ref.
+struct owl_tree;
+
+// Creates an owl_tree from a string.  The tree may directly reference pieces of
+// the string -- you're responsible for keeping it around until
+// owl_tree_destroy() is called.
+struct owl_tree *owl_tree_create_from_string(const char *string);
+
+// Creates an owl_tree by reading from a file.
+struct owl_tree *owl_tree_create_from_file(FILE *file);
+
+// Creates an owl_tree from the file at `path`.  Where possible, the tree
+// references a memory mapping of the file instead of a copy.
+struct owl_tree *owl_tree_create_from_path(const char *path);
+
+// Explicitly create a tree with particular options.
+struct owl_tree_options {
+    // Exactly one of string or file should be set.
+    const char *string;
+    FILE *file;
+    // The length of the string in bytes.  If this is set, the string doesn't
+    // need to be zero-terminated, and any zero bytes in it are invalid tokens.
+    size_t length;
+    // If set, `length` is used even if it's zero.  Otherwise, a `length` of zero
+    // means the string is zero-terminated.
+    bool has_length;
+    // If set, the tree keeps a list of the matches of each rule, which
+    // owl_tree_nodes_of_rule() returns.  This and index_locations only
+    // have an effect with OWL_INDEX defined.
+    bool index_rules;
+    // If set, the tree keeps an index of where each match is, which
+    // owl_tree_node_at() and owl_tree_nodes_in_range() search.
+    bool index_locations;
+    // If more than one, the input is checked against the grammar on up to this
+    // many threads.  This only has an effect if the implementation is compiled
+    // with OWL_THREADS defined.
+    unsigned threads;
+    // If set (and `threads` is at most one), the input is tokenized on a second
+    // thread while this one checks the tokens against the grammar.  This also
+    // only has an effect with OWL_THREADS defined.
+    bool pipeline;
+    // Functions for allocating and freeing memory.  Either all three or none of
+    // them should be set; if they aren't set, malloc, realloc, and free are used.
+    // The tree and everything allocated while building it come from these
+    // functions, and the tree keeps using them until it's destroyed.
+    void *(*allocate)(size_t size, void *info);
+    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);
+    void (*deallocate)(void *pointer, size_t size, void *info);
+    // This pointer will be passed into the allocation functions.
+    void *allocator_info;
+};
+struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options);
+
+// Creates a tree from the file at `path` like owl_tree_create_from_path(),
+// with the other options set.  The file and string options must be left unset.
+struct owl_tree *owl_tree_create_from_path_with_options(const char *path, struct owl_tree_options options);
+
+#ifdef OWL_BATCH
+// Parses `n` strings, setting out[i] to the tree for inputs[i].  If `lengths`
+// is set, lengths[i] is the length of inputs[i], even if it's zero; otherwise
+// every string must be zero-terminated.  If the implementation is
+// compiled with OWL_THREADS defined, up to `threads` strings are parsed at
+// once.  The trees are independent of each other: destroy each one with
+// owl_tree_destroy().
+void owl_parse_batch(const char **inputs, const size_t *lengths, size_t n, struct owl_tree **out, int threads);
+
+// Explicitly parse a batch with particular options, which apply to each string.
+// The string and file options must be left unset, and `threads` is how many
+// strings are parsed at once.
+void owl_parse_batch_with_options(struct owl_tree_options options, const char **inputs, const size_t *lengths, size_t n, struct owl_tree **out);
+#endif
+
+#ifdef OWL_PARSER_API
+// An owl_parser parses input which arrives in pieces.  Pass each piece to
+// owl_parser_feed() as it arrives, then call owl_parser_finish() to get
+// the tree.  Input is tokenized and checked as it's fed in; the tree itself is
+// built when parsing finishes.
+//
+// A parser can also parse many strings in a row with owl_parser_parse(),
+// reusing its memory instead of allocating it again for each one.
+struct owl_parser;
+
+// Creates an owl_parser.  The parser keeps its own copy of the input.
+struct owl_parser *owl_parser_create(void);
+
+// Explicitly create a parser with particular options.  The string and file
+// options must be left unset.
+struct owl_parser *owl_parser_create_with_options(struct owl_tree_options options);
+
+// Appends the next `length` bytes of input.  Returns false once the input is
+// known to contain an error; the tree returned by owl_parser_finish() will
+// report it.
+bool owl_parser_feed(struct owl_parser *parser, const char *chunk, size_t length);
+
+// Parses the rest of the input and returns the resulting tree.  The tree takes
+// ownership of the parser's copy of the input, and the parser is destroyed.
+struct owl_tree *owl_parser_finish(struct owl_parser *parser);
+
+// Parses a null-terminated string, reusing the memory from earlier parses.  The
+// tree belongs to the parser and references the string: keep both around until
+// the next call to owl_parser_parse(), owl_parser_reset(), or
+// owl_parser_destroy(), and don't pass the tree to owl_tree_destroy().
+struct owl_tree *owl_parser_parse(struct owl_parser *parser, const char *string);
+
+// Discards any input fed to the parser and any tree it returned, keeping its
+// memory for the next parse.
+void owl_parser_reset(struct owl_parser *parser);
+
+// Destroys an owl_parser without finishing it.
+void owl_parser_destroy(struct owl_parser *parser);
+#endif
+
+// Destroys an owl_tree, freeing its resources back to the system.
+void owl_tree_destroy(struct owl_tree *);
+
+// Prints a representation of the tree to standard output.
+void owl_tree_print(struct owl_tree *);
+
+#ifdef OWL_COMPACT
+// Rewrites a finished tree so each node is followed by its children, in source
+// order, and shrinks its memory to fit.  Walking the tree afterwards reads memory
+// front to back.  Any refs into the tree are invalidated.
+void owl_tree_compact(struct owl_tree *tree);
+#endif
+
+// An owl_ref references a list of children in the parse tree.  Use the
+// parsed_..._get() function corresponding to the element type to unpack the
+// child into its appropriate parsed_... struct.
+struct owl_ref {
+    struct owl_tree *_tree;
+    size_t _offset;
+    uint32_t _type;
+    bool empty;
+};
+
+// The owl_next function advances a ref to the next sibling element.
+struct owl_ref owl_next(struct owl_ref);
+
+// Tests two refs for equality.
+bool owl_refs_equal(struct owl_ref a, struct owl_ref b);
+
+// Returns the root owl_ref.
+struct owl_ref owl_tree_root_ref(struct owl_tree *tree);
+
+// As a shortcut, returns the parsed_value struct corresponding to the root ref.
+struct parsed_value owl_tree_get_parsed_value(struct owl_tree *tree);
+
+// The range of text corresponding to a tree element.
+struct source_range {
+    size_t start;
+    size_t end;
+};
+
+enum owl_error {
+    // No error -- everything's fine!
+    ERROR_NONE,
+
+    // The file passed to owl_tree_create_from_file was NULL.
+    ERROR_INVALID_FILE,
+
+    // The options passed to owl_tree_create_with_options weren't valid --
+    // both file and string were specified at the same time or neither were.
+    // Also reported if either was passed to owl_parser_create_with_options.
+    ERROR_INVALID_OPTIONS,
+
+    // A piece of text couldn't be matched as a token.
+    ERROR_INVALID_TOKEN,
+
+    // The parser encountered an out-of-place token that doesn't fit the grammar.
+    ERROR_UNEXPECTED_TOKEN,
+
+    // The input is valid so far, but incomplete; more tokens could be added to
+    // complete it.
+    ERROR_MORE_INPUT_NEEDED,
+};
+// Returns an error code, or ERROR_NONE if there wasn't an error.
+// The error_range parameter can be null.
+enum owl_error owl_tree_get_error(struct owl_tree *tree, struct source_range *error_range);
+
+// Checks whether a string matches the grammar without building a tree.  The
+// result (and error range) is the same as creating a tree would report, but
+// memory use depends only on how deeply the input is nested, not its length.
+// The string is `length` bytes long and doesn't need to be zero-terminated.
+enum owl_error owl_validate(const char *string, size_t length, struct source_range *error_range);
+
+// Explicitly validate input with particular options.
+enum owl_error owl_validate_with_options(struct owl_tree_options options, struct source_range *error_range);
+
+enum parsed_type {
+    PARSED_NULL = 1,
+    PARSED_TRUE,
+    PARSED_ARRAY,
+    PARSED_FALSE,
+    PARSED_OBJECT,
+    PARSED_STRING,
+    PARSED_NEG_NUMBER,
+    PARSED_POS_NUMBER,
+};
+
+struct parsed_value {
+    struct source_range range;
+    enum parsed_type type;
+    struct owl_ref string;
+    struct owl_ref value;
+    struct owl_ref number;
+};
+
+struct parsed_string {
+    struct source_range range;
+    const char *string;
+    size_t length;
+};
+
+struct parsed_number {
+    struct source_range range;
+    double number;
+};
+
+struct parsed_value parsed_value_get(struct owl_ref);
+struct parsed_string parsed_string_get(struct owl_ref);
+struct parsed_number parsed_number_get(struct owl_ref);
+
+// The rules of the grammar, as passed to owl_builder functions and
+// owl_tree_nodes_of_rule().
+enum owl_rule {
+    OWL_RULE_VALUE = 0,
+    OWL_RULE_STRING = 1,
+    OWL_RULE_NUMBER = 2,
+};
+
+#ifdef OWL_INDEX
+// Returns the matches of `rule` in source order, setting `count` to the number
+// of them.  The tree must have been created with the index_rules option;
+// otherwise there aren't any.  The array belongs to the tree, and
+// owl_tree_compact() updates it in place.
+const struct owl_ref *owl_tree_nodes_of_rule(struct owl_tree *tree, enum owl_rule rule, size_t *count);
+
+// Like owl_tree_nodes_of_rule(), but only returns matches of the named
+// option `type`.
+const struct owl_ref *owl_tree_nodes_of_option(struct owl_tree *tree, enum owl_rule rule, enum parsed_type type, size_t *count);
+
+// Returns the innermost match containing the byte at `location`, or an empty
+// ref if there isn't one.  The tree must have been created with the
+// index_locations option.
+struct owl_ref owl_tree_node_at(struct owl_tree *tree, size_t location);
+
+// Returns the matches which start in the range [start, end), setting `count` to
+// the number of them.  Matches are in source order, with each match before the
+// matches inside it.  The tree must have been created with the index_locations
+// option.  The array belongs to the tree.
+const struct owl_ref *owl_tree_nodes_in_range(struct owl_tree *tree, size_t start, size_t end, size_t *count);
+#endif
+
+// Returns the rule a ref matched.
+enum owl_rule owl_ref_rule(struct owl_ref ref);
+
+#ifdef OWL_BUILDER
+// A rule or token match, as passed to an owl_builder function.
+struct owl_match {
+    enum owl_rule rule;
+    struct source_range range;
+    // For rules with named options, the option which matched.
+    enum parsed_type type;
+    // The nodes built for each of the rule's fields, in the same order as the
+    // fields of its parsed_... struct.  Each one is the first node of a list
+    // linked by `next_sibling`, or null if the field is empty.
+    void **slots;
+    // Token data, as in the token's parsed_... struct.  The identifier and
+    // string pointers may only be valid until building finishes.
+    const char *identifier;
+    const char *string;
+    size_t length;
+    uint64_t integer;
+    double number;
+};
+struct owl_builder {
+    // Called once for each match, after the matches inside it.  `next_sibling` is
+    // the node built for the following match in the same field, if there is one.
+    // Returns the new node; returning null leaves the match out.
+    void *(*build)(const struct owl_match *match, void *next_sibling, void *info);
+    // This pointer will be passed into the build function.
+    void *info;
+};
+
+// Parses a string, building your own nodes with `builder` instead of creating
+// a tree.  Nodes are only built once the whole input has been checked, so
+// nothing is built if there's an error.  Otherwise, `root` is set to the node
+// built for the root match.  The string is `length` bytes long and doesn't
+// need to be zero-terminated.
+enum owl_error owl_build(const char *string, size_t length, struct owl_builder builder, void **root, struct source_range *error_range);
+
+// Explicitly build nodes with particular options.
+enum owl_error owl_build_with_options(struct owl_tree_options options, struct owl_builder builder, void **root, struct source_range *error_range);
+#endif
+
+#endif
+
+#ifdef OWL_PARSER_IMPLEMENTATION
+// Code implementing the parser.  This might get a bit messy!
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined(OWL_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define OWL_MMAP
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef OWL_THREADS
+#include <pthread.h>
+#endif
+#if defined(__clang__) || defined(__GNUC__)
+#define OWL_DONT_INLINE __attribute__((noinline))
+#else
+#define OWL_DONT_INLINE
+#endif
+
+// The allocation functions from owl_tree_options.
+struct owl_allocator {
+    void *(*allocate)(size_t size, void *info);
+    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);
+    void (*deallocate)(void *pointer, size_t size, void *info);
+    void *info;
+};
+static void *allocate_memory(size_t size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (a->allocate)
+        return a->allocate(size, a->info);
+    return malloc(size);
+}
+static void *reallocate_memory(void *pointer, size_t old_size, size_t new_size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (a->reallocate)
+        return a->reallocate(pointer, old_size, new_size, a->info);
+    return realloc(pointer, new_size);
+}
+static void free_memory(void *pointer, size_t size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (!pointer)
+        return;
+    if (a->deallocate)
+        a->deallocate(pointer, size, a->info);
+    else
+        free(pointer);
+}
+
+#ifdef OWL_INDEX
+struct match_to_sort {
+    size_t start;
+    size_t end;
+    struct owl_ref ref;
+};
+// A list of matches, kept in source order.
+struct match_list {
+    struct owl_ref *matches;
+    // The start location of each match, for keeping the list in order.
+    size_t *starts;
+    // The end location of each match, if keeps_ends is set.
+    size_t *ends;
+    bool keeps_ends;
+    size_t count;
+    size_t capacity;
+    // Matches which arrived too far out of order to insert, which are merged
+    // into the list once the tree is finished.
+    struct match_to_sort *late;
+    size_t late_count;
+    size_t late_capacity;
+};
+// Matches for owl_tree_nodes_of_rule().  There's a list for each rule,
+// followed by a list for each named option of each rule.
+struct rule_index {
+    struct match_list lists[11];
+};
+// Every match, for owl_tree_node_at() and owl_tree_nodes_in_range().
+struct location_index {
+    struct match_list nodes;
+    // A complete binary tree with the end locations of the nodes as its leaves.
+    // Each branch holds the furthest end location of any leaf below it.  Leaf k
+    // is number k + number_of_leaves, so only the branches are stored here,
+    // starting from one.
+    size_t *furthest_ends;
+    size_t furthest_ends_capacity;
+    size_t number_of_leaves;
+};
+#endif
+struct owl_tree {
+    const char *string;
+    // If nonzero, the tree owns the string, which is an allocation of this many
+    // bytes.
+    size_t owned_string_size;
+    // If nonzero, the string is a memory mapping of this many bytes.
+    size_t mapped_length;
+    struct owl_allocator allocator;
+    // If set, nodes are built with this instead of being written to parse_tree.
+    const struct owl_builder *builder;
+    uint8_t *parse_tree;
+    size_t parse_tree_size;
+    size_t next_offset;
+    enum owl_error error;
+    struct source_range error_range;
+    size_t root_offset;
+    // Set by owl_tree_compact(), after which links to siblings and children
+    // point forward instead of backward.
+    bool compacted;
+#ifdef OWL_INDEX
+    // Set if the tree was created with the index_rules option.
+    struct rule_index *rule_index;
+    // Set if the tree was created with the index_locations option.
+    struct location_index *location_index;
+#endif
+#ifdef OWL_THREADS
+    // Set on the copies of the tree which worker threads tokenize with.  Token
+    // data goes to the log instead of parse_tree, to be written in order later.
+    struct token_log *token_log;
+#endif
+    size_t next_string_token_offset;
+    size_t next_number_token_offset;
+};
+// Every field is a 32-bit word; 64-bit values take two.
+#define RESERVATION_AMOUNT 8
+static inline uint32_t tree_field(struct owl_tree *tree, size_t offset, size_t index) {
+    uint32_t field;
+    memcpy(&field, tree->parse_tree + offset + index * 4, 4);
+    return field;
+}
+static inline uint64_t tree_field_wide(struct owl_tree *tree, size_t offset, size_t index) {
+    return tree_field(tree, offset, index) | (uint64_t)tree_field(tree, offset, index + 1) << 32;
+}
+static inline uint64_t read_tree(size_t *offset, struct owl_tree *tree) {
+    uint32_t result = tree_field(tree, *offset, 0);
+    *offset += 4;
+    return result;
+}
+static inline uint64_t read_tree_wide(size_t *offset, struct owl_tree *tree) {
+    uint64_t result = tree_field_wide(tree, *offset, 0);
+    *offset += 8;
+    return result;
+}
+static bool grow_tree(struct owl_tree *tree, size_t size)
+{
+    size_t n = tree->parse_tree_size;
+    while (n < size || n < 4096)
+        n = (n + 1) * 3 / 2;
+    uint8_t *parse_tree = reallocate_memory(tree->parse_tree, tree->parse_tree_size, n, &tree->allocator);
+    if (!parse_tree)
+        return false;
+    tree->parse_tree_size = n;
+    tree->parse_tree = parse_tree;
+    return true;
+}
+static void write_tree(struct owl_tree *tree, uint64_t value)
+{
+    size_t reserved_size = tree->next_offset + RESERVATION_AMOUNT;
+    if (tree->parse_tree_size <= reserved_size && !grow_tree(tree, reserved_size))
+        abort();
+    // Offsets and locations must fit in a field.
+    if (value > UINT32_MAX)
+        abort();
+    uint32_t field = (uint32_t)value;
+    memcpy(tree->parse_tree + tree->next_offset, &field, 4);
+    tree->next_offset += 4;
+}
+static void write_tree_wide(struct owl_tree *tree, uint64_t value)
+{
+    write_tree(tree, value & UINT32_MAX);
+    write_tree(tree, value >> 32);
+}
+static inline size_t follow_link(struct owl_tree *tree, size_t offset, size_t delta)
+{
+    return tree->compacted ? offset + delta : offset - delta;
+}
+struct parsed_value parsed_value_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 0) {
+        return (struct parsed_value){
+            .string.empty = true,
+            .value.empty = true,
+            .number.empty = true,
+        };
+    }
+    size_t start_location = tree_field(ref._tree, ref._offset, 1);
+    size_t end_location = start_location + tree_field(ref._tree, ref._offset, 2);
+    struct parsed_value result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .type = (enum parsed_type)tree_field(ref._tree, ref._offset, 3),
+    };
+    result.string._tree = ref._tree;
+    result.string._offset = tree_field(ref._tree, ref._offset, 4);
+    result.string._type = 1;
+    result.string.empty = result.string._offset == 0;
+    result.value._tree = ref._tree;
+    result.value._offset = tree_field(ref._tree, ref._offset, 5);
+    result.value._type = 0;
+    result.value.empty = result.value._offset == 0;
+    result.number._tree = ref._tree;
+    result.number._offset = tree_field(ref._tree, ref._offset, 6);
+    result.number._type = 2;
+    result.number.empty = result.number._offset == 0;
+    return result;
+}
+struct parsed_string parsed_string_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 1) {
+        return (struct parsed_string){
+            {0}
+        };
+    }
+    size_t token_offset = tree_field(ref._tree, ref._offset, 1);
+    size_t start_location = tree_field(ref._tree, token_offset, 1);
+    size_t end_location = start_location + tree_field(ref._tree, token_offset, 2);
+    size_t string_offset = tree_field(ref._tree, token_offset, 3);
+    const char *string = string_offset ?
+     (const char *)ref._tree->parse_tree + string_offset : ref._tree->string + start_location + 1;
+    size_t string_length = string_offset ?
+     tree_field(ref._tree, token_offset, 4) : end_location - start_location - 2;
+    struct parsed_string result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .string = string,
+        .length = string_length,
+    };
+    return result;
+}
+struct parsed_number parsed_number_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 2) {
+        return (struct parsed_number){
+            {0}
+        };
+    }
+    size_t token_offset = tree_field(ref._tree, ref._offset, 1);
+    size_t start_location = tree_field(ref._tree, token_offset, 1);
+    size_t end_location = start_location + tree_field(ref._tree, token_offset, 2);
+    struct parsed_number result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .number = (union { double n; uint64_t v; }){ .v = tree_field_wide(ref._tree, token_offset, 3) }.n,
+    };
+    return result;
+}
+static size_t number_of_slots_lookup(uint32_t rule, void *context);
+#ifdef OWL_BUILDER
+static size_t build_node(uint32_t rule, uint32_t choice, size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, struct owl_tree *tree) {
+    void *children[4];
+    size_t number_of_slots = number_of_slots_lookup(rule, tree);
+    for (size_t i = 0; i < number_of_slots; ++i)
+        children[i] = (void *)(uintptr_t)slots[i];
+    struct owl_match match = {
+        .rule = (enum owl_rule)rule,
+        .range = { start_location, end_location },
+        .slots = children,
+    };
+    switch (rule) {
+    case 0:
+        switch (choice) {
+        case 0:
+            match.type = PARSED_OBJECT;
+            break;
+        case 1:
+            match.type = PARSED_ARRAY;
+            break;
+        case 2:
+            match.type = PARSED_STRING;
+            break;
+        case 3:
+            match.type = PARSED_POS_NUMBER;
+            break;
+        case 4:
+            match.type = PARSED_NEG_NUMBER;
+            break;
+        case 5:
+            match.type = PARSED_TRUE;
+            break;
+        case 6:
+            match.type = PARSED_FALSE;
+            break;
+        case 7:
+            match.type = PARSED_NULL;
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);
+}
+static size_t build_token(uint32_t rule, size_t next_sibling, struct owl_tree *tree) {
+    struct owl_match match = { .rule = (enum owl_rule)rule };
+    switch (rule) {
+    case 1: {
+        size_t offset = tree->next_string_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_string_token_offset -= read_tree(&offset, tree);
+        match.range.start = read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        size_t string_offset = read_tree(&offset, tree);
+        if (string_offset) {
+            match.string = (const char *)tree->parse_tree + string_offset;
+            match.length = read_tree(&offset, tree);
+        } else {
+            match.string = tree->string + match.range.start + 1;
+            match.length = match.range.end - match.range.start - 2;
+        }
+        break;
+    }
+    case 2: {
+        size_t offset = tree->next_number_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_number_token_offset -= read_tree(&offset, tree);
+        match.range.start = read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        match.number = (union { double n; uint64_t v; }){ .v = read_tree_wide(&offset, tree) }.n;
+        break;
+    }
+    default:
+        break;
+    }
+    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);
+}
+#endif
+#ifdef OWL_INDEX
+static void grow_match_list(struct owl_tree *tree, struct match_list *list, size_t capacity)
+{
+    size_t n = list->capacity;
+    struct owl_ref *matches = reallocate_memory(list->matches,
+     n * sizeof(struct owl_ref), capacity * sizeof(struct owl_ref), &tree->allocator);
+    if (!matches)
+        abort();
+    list->matches = matches;
+    size_t *starts = reallocate_memory(list->starts,
+     n * sizeof(size_t), capacity * sizeof(size_t), &tree->allocator);
+    if (!starts)
+        abort();
+    list->starts = starts;
+    if (list->keeps_ends) {
+        size_t *ends = reallocate_memory(list->ends,
+         n * sizeof(size_t), capacity * sizeof(size_t), &tree->allocator);
+        if (!ends)
+            abort();
+        list->ends = ends;
+    }
+    list->capacity = capacity;
+}
+// Matches are added in the order they're written to the tree: from the end of
+// the input to the start while it's built, and from the start to the end while
+// it's compacted.  Operators finish their operands a little out of order, so
+// each match is moved back past any later ones, up to this many places.
+// Matches which are further out of place are set aside until the tree is
+// finished.
+#define MATCH_LIST_SHIFT_LIMIT 16
+static void add_to_match_list(struct owl_tree *tree, struct match_list *list, struct owl_ref ref, size_t start_location, size_t end_location)
+{
+    size_t n = list->count;
+    if (n == list->capacity)
+        grow_match_list(tree, list, n * 2 + 16);
+    struct owl_ref *matches = list->matches;
+    size_t *starts = list->starts;
+    size_t i = n;
+    while (i > 0 &&
+     (tree->compacted ? starts[i - 1] > start_location : starts[i - 1] < start_location)) {
+        if (n - i == MATCH_LIST_SHIFT_LIMIT) {
+            if (list->late_count == list->late_capacity) {
+                size_t capacity = list->late_capacity * 2 + 16;
+                struct match_to_sort *late = reallocate_memory(list->late,
+                 list->late_capacity * sizeof(struct match_to_sort),
+                 capacity * sizeof(struct match_to_sort), &tree->allocator);
+                if (!late)
+                    abort();
+                list->late = late;
+                list->late_capacity = capacity;
+            }
+            list->late[list->late_count++] = (struct match_to_sort){
+                .start = start_location,
+                .end = end_location,
+                .ref = ref,
+            };
+            return;
+        }
+        i--;
+    }
+    memmove(matches + i + 1, matches + i, (n - i) * sizeof(struct owl_ref));
+    memmove(starts + i + 1, starts + i, (n - i) * sizeof(size_t));
+    matches[i] = ref;
+    starts[i] = start_location;
+    if (list->keeps_ends) {
+        memmove(list->ends + i + 1, list->ends + i, (n - i) * sizeof(size_t));
+        list->ends[i] = end_location;
+    }
+    list->count = n + 1;
+}
+// Returns the list of matches for a named option of a rule, or zero if the
+// rule doesn't have that option.
+static uint32_t option_list(uint32_t rule, uint32_t type)
+{
+    switch (rule) {
+    case 0:
+        switch (type) {
+        case PARSED_OBJECT:
+            return 3;
+        case PARSED_ARRAY:
+            return 4;
+        case PARSED_STRING:
+            return 5;
+        case PARSED_POS_NUMBER:
+            return 6;
+        case PARSED_NEG_NUMBER:
+            return 7;
+        case PARSED_TRUE:
+            return 8;
+        case PARSED_FALSE:
+            return 9;
+        case PARSED_NULL:
+            return 10;
+        }
+        break;
+    default:
+        break;
+    }
+    return 0;
+}
+static void index_match(struct owl_tree *tree, uint32_t rule, uint32_t type, size_t offset, size_t start_location, size_t end_location)
+{
+    struct owl_ref ref = {
+        ._tree = tree,
+        ._offset = offset,
+        ._type = rule,
+    };
+    if (tree->rule_index) {
+        add_to_match_list(tree, &tree->rule_index->lists[rule], ref, start_location, end_location);
+        uint32_t list = option_list(rule, type);
+        if (list)
+            add_to_match_list(tree, &tree->rule_index->lists[list], ref, start_location, end_location);
+    }
+    if (tree->location_index)
+        add_to_match_list(tree, &tree->location_index->nodes, ref, start_location, end_location);
+}
+// Matches that start at the same place are nested, so the outer one comes
+// first.  It's written after the inner one while the tree is built, and before
+// it while the tree is compacted.
+static inline bool match_precedes(const struct match_to_sort *a, const struct match_to_sort *b)
+{
+    if (a->start != b->start)
+        return a->start < b->start;
+    return (a->ref._offset < b->ref._offset) == a->ref._tree->compacted;
+}
+// Sorts matches by merging the runs which are already in order.  A long chain
+// of operators can finish its operands in the opposite order to everything
+// else, so runs in reverse order are turned around first.
+static void sort_matches(struct owl_tree *tree, struct match_to_sort *matches, size_t n)
+{
+    size_t size = n * sizeof(struct match_to_sort);
+    struct match_to_sort *sorting = matches;
+    struct match_to_sort *merged = allocate_memory(size, &tree->allocator);
+    size_t *run_ends = allocate_memory(n * sizeof(size_t), &tree->allocator);
+    if (!merged || !run_ends)
+        abort();
+    size_t number_of_runs = 0;
+    for (size_t i = 0; i < n; ) {
+        size_t j = i + 1;
+        if (j < n && match_precedes(&sorting[j], &sorting[i])) {
+            while (j < n && match_precedes(&sorting[j], &sorting[j - 1]))
+                j++;
+            for (size_t a = i, b = j - 1; a < b; ++a, --b) {
+                struct match_to_sort match = sorting[a];
+                sorting[a] = sorting[b];
+                sorting[b] = match;
+            }
+        } else {
+            while (j < n && match_precedes(&sorting[j - 1], &sorting[j]))
+                j++;
+        }
+        run_ends[number_of_runs++] = j;
+        i = j;
+    }
+    while (number_of_runs > 1) {
+        size_t runs = 0;
+        size_t start = 0;
+        for (size_t r = 0; r < number_of_runs; r += 2) {
+            size_t middle = run_ends[r];
+            size_t end = r + 1 < number_of_runs ? run_ends[r + 1] : middle;
+            size_t a = start;
+            size_t b = middle;
+            size_t k = start;
+            while (a < middle && b < end)
+                merged[k++] = match_precedes(&sorting[b], &sorting[a]) ? sorting[b++] : sorting[a++];
+            memcpy(merged + k, sorting + a, (middle - a) * sizeof(struct match_to_sort));
+            k += middle - a;
+            memcpy(merged + k, sorting + b, (end - b) * sizeof(struct match_to_sort));
+            run_ends[runs++] = end;
+            start = end;
+        }
+        struct match_to_sort *swap = sorting;
+        sorting = merged;
+        merged = swap;
+        number_of_runs = runs;
+    }
+    if (sorting != matches) {
+        memcpy(matches, sorting, size);
+        merged = sorting;
+    }
+    free_memory(merged, size, &tree->allocator);
+    free_memory(run_ends, n * sizeof(size_t), &tree->allocator);
+}
+// Puts a list of matches in source order once the tree is finished.
+static void finish_match_list(struct owl_tree *tree, struct match_list *list)
+{
+    size_t n = list->count;
+    if (!tree->compacted) {
+        for (size_t j = 0; j < n / 2; ++j) {
+            struct owl_ref match = list->matches[j];
+            list->matches[j] = list->matches[n - 1 - j];
+            list->matches[n - 1 - j] = match;
+            size_t start = list->starts[j];
+            list->starts[j] = list->starts[n - 1 - j];
+            list->starts[n - 1 - j] = start;
+            if (list->keeps_ends) {
+                size_t end = list->ends[j];
+                list->ends[j] = list->ends[n - 1 - j];
+                list->ends[n - 1 - j] = end;
+            }
+        }
+    }
+    size_t number_of_late = list->late_count;
+    if (number_of_late == 0)
+        return;
+    sort_matches(tree, list->late, number_of_late);
+    if (n + number_of_late > list->capacity)
+        grow_match_list(tree, list, n + number_of_late);
+    // Merge the late matches in from the back, so nothing is overwritten
+    // before it's moved.
+    size_t i = n;
+    size_t j = number_of_late;
+    while (j > 0) {
+        size_t k = i + j - 1;
+        struct match_to_sort match = list->late[j - 1];
+        if (i > 0) {
+            struct match_to_sort last = {
+                .start = list->starts[i - 1],
+                .end = list->keeps_ends ? list->ends[i - 1] : 0,
+                .ref = list->matches[i - 1],
+            };
+            if (match_precedes(&match, &last)) {
+                match = last;
+                i--;
+            } else
+                j--;
+        } else
+            j--;
+        list->matches[k] = match.ref;
+        list->starts[k] = match.start;
+        if (list->keeps_ends)
+            list->ends[k] = match.end;
+    }
+    list->count = n + number_of_late;
+    list->late_count = 0;
+}
+static size_t furthest_end(const struct location_index *index, size_t k)
+{
+    if (k < index->number_of_leaves)
+        return index->furthest_ends[k];
+    k -= index->number_of_leaves;
+    return k < index->nodes.count ? index->nodes.ends[k] : 0;
+}
+static void finish_indexes(struct owl_tree *tree)
+{
+    if (tree->rule_index) {
+        for (uint32_t i = 0; i < 11; ++i)
+            finish_match_list(tree, &tree->rule_index->lists[i]);
+    }
+    struct location_index *index = tree->location_index;
+    if (!index)
+        return;
+    finish_match_list(tree, &index->nodes);
+    size_t leaves = 1;
+    while (leaves < index->nodes.count)
+        leaves *= 2;
+    if (leaves > index->furthest_ends_capacity) {
+        size_t *furthest_ends = reallocate_memory(index->furthest_ends,
+         index->furthest_ends_capacity * sizeof(size_t), leaves * sizeof(size_t), &tree->allocator);
+        if (!furthest_ends)
+            abort();
+        index->furthest_ends = furthest_ends;
+        index->furthest_ends_capacity = leaves;
+    }
+    index->number_of_leaves = leaves;
+    for (size_t k = leaves - 1; k > 0; --k) {
+        size_t left = furthest_end(index, 2 * k);
+        size_t right = furthest_end(index, 2 * k + 1);
+        index->furthest_ends[k] = left > right ? left : right;
+    }
+}
+// Empties the indexes before a tree is rebuilt, keeping their memory.
+static void clear_indexes(struct owl_tree *tree)
+{
+    if (tree->rule_index) {
+        for (uint32_t i = 0; i < 11; ++i) {
+            tree->rule_index->lists[i].count = 0;
+            tree->rule_index->lists[i].late_count = 0;
+        }
+    }
+    if (tree->location_index) {
+        tree->location_index->nodes.count = 0;
+        tree->location_index->nodes.late_count = 0;
+    }
+}
+#endif
+static size_t finish_node(uint32_t rule, uint32_t choice, size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, void *info) {
+    struct owl_tree *tree = info;
+#ifdef OWL_BUILDER
+    if (tree->builder)
+        return build_node(rule, choice, next_sibling, slots, start_location, end_location, tree);
+#endif
+    size_t offset = tree->next_offset;
+    uint32_t type = 0;
+    write_tree(tree, next_sibling ? offset - next_sibling : 0);
+    write_tree(tree, start_location);
+    write_tree(tree, end_location - start_location);
+    switch (rule) {
+    case 0: {
+        switch (choice) {
+        case 0:
+            type = PARSED_OBJECT;
+            break;
+        case 1:
+            type = PARSED_ARRAY;
+            break;
+        case 2:
+            type = PARSED_STRING;
+            break;
+        case 3:
+            type = PARSED_POS_NUMBER;
+            break;
+        case 4:
+            type = PARSED_NEG_NUMBER;
+            break;
+        case 5:
+            type = PARSED_TRUE;
+            break;
+        case 6:
+            type = PARSED_FALSE;
+            break;
+        case 7:
+            type = PARSED_NULL;
+            break;
+        }
+        write_tree(tree, type);
+        write_tree(tree, slots[0]);
+        write_tree(tree, slots[1]);
+        write_tree(tree, slots[2]);
+        break;
+    }
+    default:
+        break;
+    }
+#ifdef OWL_INDEX
+    if (tree->rule_index || tree->location_index)
+        index_match(tree, rule, type, offset, start_location, end_location);
+#else
+    (void)type;
+#endif
+    return offset;
+}
+static size_t finish_token(uint32_t rule, size_t next_sibling, void *info) {
+    struct owl_tree *tree = info;
+#ifdef OWL_BUILDER
+    if (tree->builder)
+        return build_token(rule, next_sibling, tree);
+#endif
+    size_t offset = tree->next_offset;
+#ifdef OWL_INDEX
+    size_t start_location = 0;
+    size_t end_location = 0;
+#endif
+    write_tree(tree, next_sibling ? offset - next_sibling : 0);
+    switch (rule) {
+    case 1: {
+        size_t offset1 = tree->next_string_token_offset;
+        if (offset1 == 0)
+            abort();
+        write_tree(tree, offset1);
+        tree->next_string_token_offset = offset1;
+        tree->next_string_token_offset -= read_tree(&offset1, tree);
+#ifdef OWL_INDEX
+        if (tree->rule_index || tree->location_index) {
+            start_location = read_tree(&offset1, tree);
+            end_location = start_location + read_tree(&offset1, tree);
+        }
+#endif
+        break;
+    }
+    case 2: {
+        size_t offset2 = tree->next_number_token_offset;
+        if (offset2 == 0)
+            abort();
+        write_tree(tree, offset2);
+        tree->next_number_token_offset = offset2;
+        tree->next_number_token_offset -= read_tree(&offset2, tree);
+#ifdef OWL_INDEX
+        if (tree->rule_index || tree->location_index) {
+            start_location = read_tree(&offset2, tree);
+            end_location = start_location + read_tree(&offset2, tree);
+        }
+#endif
+        break;
+    }
+    default:
+        break;
+    }
+#ifdef OWL_INDEX
+    if (tree->rule_index || tree->location_index)
+        index_match(tree, rule, 0, offset, start_location, end_location);
+#endif
+    return offset;
+}
+static void check_for_error(struct owl_tree *tree) {
+    if (tree->error == ERROR_NONE)
+        return;
+    fprintf(stderr, "parse error: ");
+    switch (tree->error) {
+    case ERROR_INVALID_FILE:
+        fprintf(stderr, "invalid file\n");
+        break;
+    case ERROR_INVALID_OPTIONS:
+        fprintf(stderr, "invalid options\n");
+        break;
+    case ERROR_INVALID_TOKEN:
+        fprintf(stderr, "invalid token '%.*s'\n", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);
+        break;
+    case ERROR_UNEXPECTED_TOKEN:
+        fprintf(stderr, "unexpected token '%.*s'\n", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);
+        break;
+    case ERROR_MORE_INPUT_NEEDED:
+        fprintf(stderr, "more input needed\n");
+        break;
+    default:
+        break;
+    }
+    exit(-1);
+}
+static void parsed_value_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_string_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_number_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_value_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_value it = parsed_value_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("value");
+        if (strcmp("value", slot_name))
+            printf("@%s", slot_name);
+        switch (it.type) {
+        case PARSED_OBJECT:
+            printf(" : OBJECT");
+            break;
+        case PARSED_ARRAY:
+            printf(" : ARRAY");
+            break;
+        case PARSED_STRING:
+            printf(" : STRING");
+            break;
+        case PARSED_POS_NUMBER:
+            printf(" : POS_NUMBER");
+            break;
+        case PARSED_NEG_NUMBER:
+            printf(" : NEG_NUMBER");
+            break;
+        case PARSED_TRUE:
+            printf(" : TRUE");
+            break;
+        case PARSED_FALSE:
+            printf(" : FALSE");
+            break;
+        case PARSED_NULL:
+            printf(" : NULL");
+            break;
+        default:
+            break;
+        }
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        parsed_string_print(tree, it.string, "string", indent + 1);
+        parsed_value_print(tree, it.value, "value", indent + 1);
+        parsed_number_print(tree, it.number, "number", indent + 1);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_string_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_string it = parsed_string_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("string");
+        if (strcmp("string", slot_name))
+            printf("@%s", slot_name);
+        printf(" - %.*s", (int)it.length, it.string);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_number_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_number it = parsed_number_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("number");
+        if (strcmp("number", slot_name))
+            printf("@%s", slot_name);
+        printf(" - %f", it.number);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        ref = owl_next(ref);
+    }
+}
+void owl_tree_print(struct owl_tree *tree) {
+    check_for_error(tree);
+    parsed_value_print(tree, owl_tree_root_ref(tree), "value", 0);
+}
+struct owl_ref owl_next(struct owl_ref ref) {
+    if (ref.empty) return ref;
+    size_t offset = ref._offset;
+    size_t delta = tree_field(ref._tree, offset, 0);
+    return (struct owl_ref){
+        ._tree = ref._tree,
+        ._offset = follow_link(ref._tree, offset, delta),
+        ._type = ref._type,
+        .empty = delta == 0,
+    };
+}
+bool owl_refs_equal(struct owl_ref a, struct owl_ref b) {
+    return a._tree == b._tree && a._offset == b._offset;
+}
+struct owl_ref owl_tree_root_ref(struct owl_tree *tree) {
+    check_for_error(tree);
+    return (struct owl_ref){
+        ._tree = tree,
+        ._offset = tree->root_offset,
+        ._type = 0,
+        .empty = tree->root_offset == 0,
+    };
+}
+struct parsed_value owl_tree_get_parsed_value(struct owl_tree *tree) {
+    check_for_error(tree);
+    return parsed_value_get(owl_tree_root_ref(tree));
+}
+#ifdef OWL_INDEX
+const struct owl_ref *owl_tree_nodes_of_rule(struct owl_tree *tree, enum owl_rule rule, size_t *count) {
+    check_for_error(tree);
+    *count = 0;
+    if (!tree->rule_index || (uint32_t)rule >= 3)
+        return 0;
+    *count = tree->rule_index->lists[rule].count;
+    return tree->rule_index->lists[rule].matches;
+}
+const struct owl_ref *owl_tree_nodes_of_option(struct owl_tree *tree, enum owl_rule rule, enum parsed_type type, size_t *count) {
+    check_for_error(tree);
+    *count = 0;
+    uint32_t list = option_list(rule, type);
+    if (!tree->rule_index || list == 0)
+        return 0;
+    *count = tree->rule_index->lists[list].count;
+    return tree->rule_index->lists[list].matches;
+}
+// Returns the number of nodes which start at or before the location.
+static size_t count_nodes_starting_by(const struct location_index *index, size_t location) {
+    size_t low = 0;
+    size_t high = index->nodes.count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (index->nodes.starts[middle] <= location)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+struct owl_ref owl_tree_node_at(struct owl_tree *tree, size_t location) {
+    check_for_error(tree);
+    struct location_index *index = tree->location_index;
+    if (!index)
+        return (struct owl_ref){ .empty = true };
+    // Every node which starts by the location comes before this leaf, and
+    // nodes which contain the location are nested in order, so the innermost
+    // one is the last of them which ends after the location.
+    size_t k = index->number_of_leaves + count_nodes_starting_by(index, location) - 1;
+    if (k < index->number_of_leaves)
+        return (struct owl_ref){ .empty = true };
+    while (furthest_end(index, k) <= location) {
+        // Move up to the nearest subtree to the left.
+        while (k % 2 == 0)
+            k /= 2;
+        if (k == 1)
+            return (struct owl_ref){ .empty = true };
+        k--;
+    }
+    // Move down to the rightmost leaf which ends after the location.
+    while (k < index->number_of_leaves) {
+        k = 2 * k + 1;
+        if (furthest_end(index, k) <= location)
+            k--;
+    }
+    return index->nodes.matches[k - index->number_of_leaves];
+}
+const struct owl_ref *owl_tree_nodes_in_range(struct owl_tree *tree, size_t start, size_t end, size_t *count) {
+    check_for_error(tree);
+    *count = 0;
+    struct location_index *index = tree->location_index;
+    if (!index || end <= start)
+        return 0;
+    size_t first = start > 0 ? count_nodes_starting_by(index, start - 1) : 0;
+    size_t last = count_nodes_starting_by(index, end - 1);
+    if (first == last)
+        return 0;
+    *count = last - first;
+    return index->nodes.matches + first;
+}
+#endif
+enum owl_rule owl_ref_rule(struct owl_ref ref) {
+    return (enum owl_rule)ref._type;
+}
+#define ESCAPE_CHAR(c, info) ((c) == 'b' ? '\b' : (c) == 'f' ? '\f' : (c) == 'n' ? '\n' : (c) == 'r' ? '\r' : (c) == 't' ? '\t' : (c))
+#define IGNORE_TOKEN_WRITE(...)
+#define IGNORE_TOKEN_READ(...) (0)
+#define CUSTOM_TOKEN_DATA(...)
+#define IF_IDENTIFIER_TOKEN(...) if (0) { /* no identifier tokens */  }
+#define INTEGER_TOKEN_DATA(...)
+#define IF_INTEGER_TOKEN(...) if (0) { /* no integer tokens */  }
+#define NUMBER_TOKEN_DATA(name) double name = 0
+#define IF_NUMBER_TOKEN(cond, ...) if (cond) __VA_ARGS__
+#define IF_STRING_TOKEN(cond, ...) if (cond) __VA_ARGS__
+static double read_number(const char *text, size_t length, size_t *number_length, void *allocator);
+static size_t read_whitespace(const char *text, size_t length, void *info);
+static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, size_t length, void *info);
+#define IF_IDENTIFIER_KEYWORDS(...)
+#ifdef OWL_THREADS
+enum logged_token_kind {
+    LOGGED_IDENTIFIER_TOKEN,
+    LOGGED_INTEGER_TOKEN,
+    LOGGED_NUMBER_TOKEN,
+    LOGGED_STRING_TOKEN,
+    LOGGED_CUSTOM_TOKEN,
+};
+struct logged_token {
+    size_t offset;
+    size_t length;
+    // The token's value, or where its unescaped contents start in `strings`.
+    uint64_t data;
+    // The length of the unescaped contents, or the custom token's type.
+    size_t extra;
+    uint8_t kind;
+    bool has_escapes;
+};
+// The token data from a worker thread's tokenizer, in the order the tokens
+// appear in the text.
+struct token_log {
+    struct logged_token *tokens;
+    size_t number_of_tokens;
+    size_t tokens_capacity;
+    char *strings;
+    size_t strings_size;
+    size_t strings_capacity;
+    // When validating, nothing is kept.
+    bool discard;
+    struct owl_allocator *allocator;
+};
+static void log_token(struct token_log *log, struct logged_token token) {
+    if (log->discard)
+        return;
+    if (log->number_of_tokens >= log->tokens_capacity) {
+        size_t capacity = (log->tokens_capacity + 64) * 2;
+        struct logged_token *tokens = reallocate_memory(log->tokens, log->tokens_capacity * sizeof(struct logged_token), capacity * sizeof(struct logged_token), log->allocator);
+        if (!tokens)
+            abort();
+        log->tokens = tokens;
+        log->tokens_capacity = capacity;
+    }
+    log->tokens[log->number_of_tokens++] = token;
+}
+static void *log_string_contents(struct token_log *log, size_t size) {
+    // Discarded contents are overwritten by the next string.
+    if (log->discard)
+        log->strings_size = 0;
+    if (log->strings_size + size > log->strings_capacity) {
+        size_t capacity = (log->strings_size + size + 256) * 2;
+        char *strings = reallocate_memory(log->strings, log->strings_capacity, capacity, log->allocator);
+        if (!strings)
+            abort();
+        log->strings = strings;
+        log->strings_capacity = capacity;
+    }
+    void *p = log->strings + log->strings_size;
+    log->strings_size += size;
+    return p;
+}
+static void free_token_log(struct token_log *log) {
+    free_memory(log->tokens, log->tokens_capacity * sizeof(struct logged_token), log->allocator);
+    free_memory(log->strings, log->strings_capacity, log->allocator);
+}
+#endif
+static void write_string_token(size_t offset, size_t length, const char *string, size_t string_length, bool has_escapes, void *info) {
+    struct owl_tree *tree = info;
+#ifdef OWL_THREADS
+    if (tree->token_log) {
+        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_STRING_TOKEN, .offset = offset, .length = length, .data = has_escapes ? (uint64_t)(string - tree->token_log->strings) : 0, .extra = string_length, .has_escapes = has_escapes });
+        return;
+    }
+#endif
+    size_t string_offset = has_escapes ? (uint8_t *)string - tree->parse_tree : 0;
+    size_t token_offset = tree->next_offset;
+    write_tree(tree, token_offset - tree->next_string_token_offset);
+    write_tree(tree, offset);
+    write_tree(tree, length);
+    if (string_offset) {
+        write_tree(tree, string_offset);
+        write_tree(tree, string_length);
+    } else
+        write_tree(tree, 0);
+    tree->next_string_token_offset = token_offset;
+}
+static void write_number_token(size_t offset, size_t length, double number, void *info) {
+    struct owl_tree *tree = info;
+#ifdef OWL_THREADS
+    if (tree->token_log) {
+        union { double n; uint64_t v; } u = { .n = number };
+        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_NUMBER_TOKEN, .offset = offset, .length = length, .data = u.v });
+        return;
+    }
+#endif
+    size_t token_offset = tree->next_offset;
+    write_tree(tree, token_offset - tree->next_number_token_offset);
+    write_tree(tree, offset);
+    write_tree(tree, length);
+    union { double n; uint64_t v; } u = { .n = number };
+    write_tree_wide(tree, u.v);
+    tree->next_number_token_offset = token_offset;
+}
+static void *allocate_string_contents(size_t size, void *info) {
+    struct owl_tree *tree = info;
+#ifdef OWL_THREADS
+    if (tree->token_log)
+        return log_string_contents(tree->token_log, size);
+#endif
+    // Keep the fields after the string aligned, with the padding zeroed so
+    // the same text always makes the same tree.
+    size_t padding = -size & 3;
+    if (tree->next_offset + size + padding > tree->parse_tree_size)
+        grow_tree(tree, tree->next_offset + size + padding);
+    void *p = tree->parse_tree + tree->next_offset;
+    memset((uint8_t *)p + size, 0, padding);
+    tree->next_offset += size + padding;
+    return p;
+}
+// Vectorized scanners for the tokenizer.  These load whole aligned blocks,
+// which can include bytes past the end of the input.  Aligned loads never
+// cross a page boundary, so this is safe, but it upsets memory checkers like
+// AddressSanitizer.  Define OWL_NO_SIMD to use the scalar loops instead.
+#if !defined(OWL_NO_SIMD) && defined(__SANITIZE_ADDRESS__)
+#define OWL_NO_SIMD
+#endif
+#if !defined(OWL_NO_SIMD) && defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define OWL_NO_SIMD
+#endif
+#endif
+#if !defined(OWL_NO_SIMD) && defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define OWL_SIMD
+enum vector_scan_class {
+    VECTOR_SCAN_IDENTIFIER,
+    VECTOR_SCAN_IDENTIFIER_WITH_DASHES,
+    VECTOR_SCAN_DIGITS,
+    VECTOR_SCAN_HEX_DIGITS,
+    VECTOR_SCAN_WHITESPACE,
+    VECTOR_SCAN_STRING,
+    VECTOR_SCAN_LINE,
+};
+typedef unsigned char vector_bytes_sse2 __attribute__((vector_size(16), may_alias));
+typedef char vector_mask_sse2 __attribute__((vector_size(16)));
+static inline  vector_mask_sse2 vector_equal_sse2(vector_bytes_sse2 x, unsigned char c) {
+    return (vector_mask_sse2)(x == c);
+}
+static inline  vector_mask_sse2 vector_in_range_sse2(vector_bytes_sse2 x, unsigned char low, unsigned char high) {
+    return (vector_mask_sse2)(x - low <= (unsigned char)(high - low));
+}
+static inline  uint32_t vector_stop_mask_sse2(vector_bytes_sse2 x, enum vector_scan_class kind, char quote) {
+    vector_mask_sse2 keep = {0};
+    vector_bytes_sse2 lowercase = x | 0x20;
+    switch (kind) {
+    case VECTOR_SCAN_IDENTIFIER_WITH_DASHES:
+        keep = vector_equal_sse2(x, '-');
+        // Fall through.
+    case VECTOR_SCAN_IDENTIFIER:
+        keep |= vector_equal_sse2(x, '_') | vector_in_range_sse2(lowercase, 'a', 'z') | vector_in_range_sse2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_HEX_DIGITS:
+        keep = vector_in_range_sse2(lowercase, 'a', 'f');
+        // Fall through.
+    case VECTOR_SCAN_DIGITS:
+        keep |= vector_in_range_sse2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_WHITESPACE:
+        keep |= vector_equal_sse2(x, 32);
+        keep |= vector_equal_sse2(x, 9);
+        keep |= vector_equal_sse2(x, 10);
+        keep |= vector_equal_sse2(x, 13);
+        break;
+    case VECTOR_SCAN_STRING:
+        keep = vector_equal_sse2(x, (unsigned char)quote) | vector_equal_sse2(x, '\\') | vector_equal_sse2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb128(keep);
+    case VECTOR_SCAN_LINE:
+        keep = vector_equal_sse2(x, '\n') | vector_equal_sse2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb128(keep);
+    }
+    // Zero bytes never belong to a run.
+    return ~(uint32_t)__builtin_ia32_pmovmskb128(keep) & 0xffffu;
+}
+// Here, `offset` must be less than `end`.  Aligned blocks which contain at
+// least one byte of the text can't cross into an unmapped page.
+static inline  size_t vector_scan_sse2(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)(16 - 1));
+    uint32_t stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote) & (0xffffu << (start - block));
+    while (!stop) {
+        block += 16;
+        if (block >= text + end)
+            return end;
+        stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote);
+    }
+    size_t stop_offset = (size_t)(block - text) + (size_t)__builtin_ctz(stop);
+    return stop_offset < end ? stop_offset : end;
+}
+typedef unsigned char vector_bytes_avx2 __attribute__((vector_size(32), may_alias));
+typedef char vector_mask_avx2 __attribute__((vector_size(32)));
+static inline __attribute__((target("avx2")))  vector_mask_avx2 vector_equal_avx2(vector_bytes_avx2 x, unsigned char c) {
+    return (vector_mask_avx2)(x == c);
+}
+static inline __attribute__((target("avx2")))  vector_mask_avx2 vector_in_range_avx2(vector_bytes_avx2 x, unsigned char low, unsigned char high) {
+    return (vector_mask_avx2)(x - low <= (unsigned char)(high - low));
+}
+static inline __attribute__((target("avx2")))  uint32_t vector_stop_mask_avx2(vector_bytes_avx2 x, enum vector_scan_class kind, char quote) {
+    vector_mask_avx2 keep = {0};
+    vector_bytes_avx2 lowercase = x | 0x20;
+    switch (kind) {
+    case VECTOR_SCAN_IDENTIFIER_WITH_DASHES:
+        keep = vector_equal_avx2(x, '-');
+        // Fall through.
+    case VECTOR_SCAN_IDENTIFIER:
+        keep |= vector_equal_avx2(x, '_') | vector_in_range_avx2(lowercase, 'a', 'z') | vector_in_range_avx2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_HEX_DIGITS:
+        keep = vector_in_range_avx2(lowercase, 'a', 'f');
+        // Fall through.
+    case VECTOR_SCAN_DIGITS:
+        keep |= vector_in_range_avx2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_WHITESPACE:
+        keep |= vector_equal_avx2(x, 32);
+        keep |= vector_equal_avx2(x, 9);
+        keep |= vector_equal_avx2(x, 10);
+        keep |= vector_equal_avx2(x, 13);
+        break;
+    case VECTOR_SCAN_STRING:
+        keep = vector_equal_avx2(x, (unsigned char)quote) | vector_equal_avx2(x, '\\') | vector_equal_avx2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb256(keep);
+    case VECTOR_SCAN_LINE:
+        keep = vector_equal_avx2(x, '\n') | vector_equal_avx2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb256(keep);
+    }
+    // Zero bytes never belong to a run.
+    return ~(uint32_t)__builtin_ia32_pmovmskb256(keep) & 0xffffffffu;
+}
+// Here, `offset` must be less than `end`.  Aligned blocks which contain at
+// least one byte of the text can't cross into an unmapped page.
+static inline __attribute__((target("avx2")))  size_t vector_scan_avx2(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)(32 - 1));
+    uint32_t stop = vector_stop_mask_avx2(*(const vector_bytes_avx2 *)block, kind, quote) & (0xffffffffu << (start - block));
+    while (!stop) {
+        block += 32;
+        if (block >= text + end)
+            return end;
+        stop = vector_stop_mask_avx2(*(const vector_bytes_avx2 *)block, kind, quote);
+    }
+    size_t stop_offset = (size_t)(block - text) + (size_t)__builtin_ctz(stop);
+    return stop_offset < end ? stop_offset : end;
+}
+static inline size_t vector_scan(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    if (offset >= end)
+        return end;
+#ifdef __AVX2__
+    return vector_scan_avx2(text, offset, end, kind, quote);
+#else
+    // Most runs end within the first block, so only dispatch to AVX2 for the
+    // rest of a longer run.
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)15);
+    uint32_t stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote) & (0xffffu << (start - block));
+    offset = (size_t)(block - text) + (stop ? (size_t)__builtin_ctz(stop) : 16);
+    if (stop || offset >= end)
+        return offset < end ? offset : end;
+    if (__builtin_cpu_supports("avx2"))
+        return vector_scan_avx2(text, offset, end, kind, quote);
+    return vector_scan_sse2(text, offset, end, kind, quote);
+#endif
+}
+#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) vector_scan(text, offset, end, VECTOR_SCAN_IDENTIFIER, 0)
+#define SKIP_DIGITS(text, offset, end, hexadecimal) vector_scan(text, offset, end, (hexadecimal) ? VECTOR_SCAN_HEX_DIGITS : VECTOR_SCAN_DIGITS, 0)
+#define SKIP_STRING_CHARS(text, offset, end, quote) vector_scan(text, offset, end, VECTOR_SCAN_STRING, quote)
+#define SKIP_LINE(text, offset, end) vector_scan(text, offset, end, VECTOR_SCAN_LINE, 0)
+#else
+#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) (offset)
+#define SKIP_DIGITS(text, offset, end, hexadecimal) (offset)
+#define SKIP_STRING_CHARS(text, offset, end, quote) (offset)
+#define SKIP_LINE(text, offset, end) (offset)
+#endif
+struct owl_token_run {
+    struct owl_token_run *prev;
+    uint16_t number_of_tokens;
+    uint16_t lengths_size;
+    uint8_t lengths[4096 * 2];
+    uint32_t tokens[4096];
+    uint32_t states[4096];
+};
+struct owl_default_tokenizer {
+    const char *text;
+    size_t length;
+    size_t offset;
+    size_t whitespace;
+    uint32_t identifier_token;
+    uint32_t number_token;
+    uint32_t string_token;
+    void *info;
+    bool more_input;
+    bool deferred;
+    size_t lookahead;
+    size_t stop;
+    struct owl_token_run *free_runs;
+    void *allocator;
+};
+static bool char_is_whitespace(char c) {
+    switch (c) {
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+        return true;
+    default:
+        return false;
+    }
+}
+static bool char_is_numeric(char c) {
+    return c >= '0' && c <= '9';
+}
+static bool char_is_alphabetic(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+static bool char_is_hexadecimal_alpha(char c) {
+    return (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+static bool char_starts_identifier(char c) {
+    return char_is_alphabetic(c) || c == '_';
+}
+static bool char_continues_identifier(char c, void *info) {
+    if (false && c == '-') return true;
+    return char_is_numeric(c) || char_starts_identifier(c);
+}
+static bool char_ends_identifier(char c) {
+    return c != '-';
+}
+static inline uint64_t read_eight_bytes(const char *text) {
+    uint8_t b[8];
+    memcpy(b, text, 8);
+    return (uint64_t)b[0] | (uint64_t)b[1] << 8 | (uint64_t)b[2] << 16 | (uint64_t)b[3] << 24 | (uint64_t)b[4] << 32 | (uint64_t)b[5] << 40 | (uint64_t)b[6] << 48 | (uint64_t)b[7] << 56;
+}
+static inline bool eight_bytes_are_digits(uint64_t chunk) {
+    return !(((chunk + 0x4646464646464646) | (chunk - 0x3030303030303030)) & 0x8080808080808080);
+}
+static inline uint32_t eight_digits_value(uint64_t chunk) {
+    chunk -= 0x3030303030303030;
+    chunk = chunk * 10 + (chunk >> 8);
+    chunk = ((chunk & 0x000000ff000000ff) * 0x000f424000000064 + ((chunk >> 16) & 0x000000ff000000ff) * 0x0000271000000001) >> 32;
+    return (uint32_t)chunk;
+}
+static bool encode_length(struct owl_token_run *run, uint16_t *lengths_size, size_t length) {
+    uint8_t mark = 0;
+    while (*lengths_size < sizeof(run->lengths)) {
+        run->lengths[*lengths_size] = mark | (length & 0x7f);
+        mark = 0x80;
+        length >>= 7;
+        (*lengths_size)++;
+        if (length == 0) return true;
+    }
+    return false;
+}
+static bool encode_token_length(struct owl_token_run *run, uint16_t *lengths_size, size_t length, size_t whitespace) {
+    uint16_t size = *lengths_size;
+    if (encode_length(run, lengths_size, length) && encode_length(run, lengths_size, whitespace)) return true;
+    *lengths_size = size;
+    return false;
+}
+static size_t decode_length(struct owl_token_run *run, uint16_t *length_offset) {
+    size_t length = 0;
+    while (*length_offset < sizeof(run->lengths)) {
+        size_t l = run->lengths[(*length_offset)--];
+        length <<= 7;
+        length += l & 0x7f;
+        if (!(l & 0x80)) return length;
+    }
+    abort();
+}
+static size_t decode_token_length(struct owl_token_run *run, uint16_t *length_offset, size_t *string_offset) {
+    size_t whitespace = decode_length(run, length_offset);
+    size_t length = decode_length(run, length_offset);
+    *string_offset -= whitespace + length;
+    return length;
+}
+static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer, struct owl_token_run **previous_run) {
+    struct owl_token_run *run = tokenizer->free_runs;
+    if (run) tokenizer->free_runs = run->prev;
+    else {
+        run = allocate_memory(sizeof(struct owl_token_run), tokenizer->allocator);
+        if (!run) return false;
+    }
+    uint16_t number_of_tokens = 0;
+    uint16_t lengths_size = 0;
+    const char *text = tokenizer->text;
+    size_t whitespace = tokenizer->whitespace;
+    size_t length = tokenizer->length;
+    size_t offset = tokenizer->offset;
+    size_t limit = SIZE_MAX;
+    size_t token_limit = length;
+    if (tokenizer->more_input) {
+        limit = length;
+    token_limit = length > tokenizer->lookahead ? length - tokenizer->lookahead :
+        0;
+    }
+    size_t token_stop = token_limit;
+    if (tokenizer->stop && tokenizer->stop < token_stop) token_stop = tokenizer->stop;
+    bool deferred = false;
+    while (number_of_tokens < 4096) {
+        if (offset >= token_stop) {
+            deferred = tokenizer->more_input && offset >= token_limit;
+            break;
+        }
+        char c = text[offset];
+        size_t whitespace_length = read_whitespace(text + offset, length - offset, tokenizer->info);
+        if (whitespace_length > 0) {
+            whitespace += whitespace_length;
+            offset += whitespace_length;
+            continue;
+        }
+        uint32_t token = -1;
+        CUSTOM_TOKEN_DATA(custom_data);
+        uint64_t integer = 0;
+        NUMBER_TOKEN_DATA(number);
+        bool is_token = false;
+        bool end_token = false;
+        bool custom_token = false;
+        bool comment = false;
+        bool custom_whitespace = false;
+        bool has_escapes = false;
+        size_t token_length = read_keyword_token(&token, &end_token, text + offset, length - offset, tokenizer->info);
+        if (token_length > 0) {
+            is_token = true;
+            if (token == 4294967295U) comment = true;
+        }
+        if (IGNORE_TOKEN_READ(&token, &token_length, text + offset, length - offset, &custom_whitespace, &custom_data, tokenizer->info)) {
+            is_token = true;
+            custom_token = true;
+            end_token = false;
+            comment = false;
+        }
+        IF_INTEGER_TOKEN(char_is_numeric(c), {
+            size_t integer_offset = offset;
+            uint64_t base = 10;
+            if (c == '0' && offset + 2 < length && (text[offset + 1] == 'x' || text[offset + 1] == 'X') && (char_is_numeric(text[offset + 2]) || char_is_hexadecimal_alpha(text[integer_offset + 2]))) {
+                integer_offset = offset + 2;
+                base = 16;
+            }
+            integer = 0;
+            bool overflow = false;
+            while (base == 10 && integer_offset + 8 <= length && integer <= (UINT64_MAX - 99999999) / 100000000) {
+                uint64_t chunk = read_eight_bytes(text + integer_offset);
+                if (!eight_bytes_are_digits(chunk)) break;
+                integer = integer * 100000000 + eight_digits_value(chunk);
+                integer_offset += 8;
+            }
+            size_t digits_end = SKIP_DIGITS(text, integer_offset, length, base == 16);
+            while (integer_offset < digits_end || (integer_offset < length && (char_is_numeric(text[integer_offset]) || (base == 16 && char_is_hexadecimal_alpha(text[integer_offset]))))) {
+                uint64_t last = integer;
+                integer *= base;
+                uint64_t ch = text[integer_offset];
+                if (ch >= '0' && ch <= '9') integer += ch - '0';
+                else if (ch >= 'a' && ch <= 'f') integer += ch - 'a' + 0xa;
+                else if (ch >= 'A' && ch <= 'F') integer += ch - 'A' + 0xA;
+                if (integer < last) {
+                    overflow = true;
+                    break;
+                }
+                integer_offset++;
+            }
+            if (integer_offset >= limit) deferred = true;
+            if (!overflow && integer_offset - offset > token_length) {
+                token_length = integer_offset - offset;
+                is_token = true;
+                end_token = false;
+                comment = false;
+                custom_whitespace = false;
+                token = 4294967295U;
+            }
+        }
+        ) IF_NUMBER_TOKEN(char_is_numeric(c) || (c == '.' && offset + 1 < length && char_is_numeric(text[offset + 1])), {
+            size_t number_length = 0;
+            number = read_number(text + offset, length - offset, &number_length, tokenizer->allocator);
+            if (offset + number_length + 3 > limit) deferred = true;
+            if (number_length > token_length) {
+                token_length = number_length;
+                is_token = true;
+                end_token = false;
+                comment = false;
+                custom_whitespace = false;
+                token = 11;
+            }
+        }
+        ) else IF_STRING_TOKEN(c == '\'' || c == '"', {
+            size_t string_offset = SKIP_STRING_CHARS(text, offset + 1, length, c);
+            while (string_offset < length && text[string_offset] != '\0') {
+                if (text[string_offset] == c) {
+                    token_length = string_offset + 1 - offset;
+                    is_token = true;
+                    end_token = false;
+                    comment = false;
+                    custom_whitespace = false;
+                    token = 10;
+                    break;
+                }
+                if (text[string_offset] == '\\') {
+                    has_escapes = true;
+                    string_offset++;
+                    if (string_offset >= length || text[string_offset] == '\0') break;
+                }
+                string_offset = SKIP_STRING_CHARS(text, string_offset + 1, length, c);
+            }
+            if (string_offset >= limit) deferred = true;
+        }
+        ) else IF_IDENTIFIER_TOKEN(char_starts_identifier(c), {
+            size_t identifier_offset = SKIP_IDENTIFIER_CHARS(text, offset + 1, length, tokenizer->info);
+            while (identifier_offset < length && char_continues_identifier(text[identifier_offset], tokenizer->info)) identifier_offset++;
+            if (identifier_offset >= limit) deferred = true;
+            while (!char_ends_identifier(text[identifier_offset - 1])) identifier_offset--;
+            if (identifier_offset - offset > token_length) {
+                token_length = identifier_offset - offset;
+                is_token = true;
+                end_token = false;
+                comment = false;
+                custom_whitespace = false;
+                token = 4294967295U;
+                IF_IDENTIFIER_KEYWORDS(!custom_token, {
+                    read_identifier_keyword(&token, &end_token, text + offset, token_length);
+                }
+            ) }
+        }
+        ) if (custom_token && offset + token_length >= token_limit) deferred = true;
+        if (deferred) break;
+        if (custom_whitespace) {
+            whitespace += token_length;
+            offset += token_length;
+            continue;
+        }
+        else if (comment) {
+            size_t line_end = SKIP_LINE(text, offset, length);
+            while (line_end < length && text[line_end] != '\0' && text[line_end] != '\n') line_end++;
+            if (line_end >= limit) {
+                deferred = true;
+                break;
+            }
+            whitespace += line_end - offset;
+            offset = line_end;
+            continue;
+        }
+        else if (!is_token || token == 4294967295U) {
+            tokenizer->offset = offset;
+            tokenizer->whitespace = whitespace;
+            tokenizer->deferred = false;
+            run->prev = tokenizer->free_runs;
+            tokenizer->free_runs = run;
+            return false;
+        }
+        if (end_token && number_of_tokens + 1 >= 4096) break;
+        if (!encode_token_length(run, &lengths_size, token_length, whitespace)) break;
+        if (token == 4294967295U) {
+            IGNORE_TOKEN_WRITE(offset, token_length, tokenizer->info);
+        }
+        else if (token == 4294967295U) {
+            IGNORE_TOKEN_WRITE(offset, token_length, integer, tokenizer->info);
+        }
+        else if (token == 11) {
+            write_number_token(offset, token_length, number, tokenizer->info);
+        }
+        else if (token == 10) {
+            size_t content_offset = offset + 1;
+            size_t content_length = token_length - 2;
+            const char *string = text + content_offset;
+            size_t string_length = content_length;
+            if (has_escapes) {
+                size_t i;
+                for (i = 0;
+                i < content_length;
+                ++i) {
+                    if (text[content_offset + i] == '\\') {
+                        string_length--;
+                        i++;
+                    }
+                }
+                char *unescaped = allocate_string_contents(string_length, tokenizer->info);
+                size_t j = 0;
+                for (i = 0;
+                i < content_length;
+                ++i) {
+                    if (text[content_offset + i] == '\\') i++;
+                    unescaped[j++] = ESCAPE_CHAR(text[content_offset + i], tokenizer->info);
+                }
+                string = unescaped;
+            }
+            write_string_token(offset, token_length, string, string_length, has_escapes, tokenizer->info);
+        }
+        else if (custom_token) {
+            IGNORE_TOKEN_WRITE(offset, token_length, token, custom_data, tokenizer->info);
+        }
+        run->tokens[number_of_tokens] = token;
+        whitespace = 0;
+        number_of_tokens++;
+        offset += token_length;
+        if (end_token) {
+            assert(number_of_tokens < 4096);
+            run->tokens[number_of_tokens] = 4294967295U;
+            number_of_tokens++;
+        }
+    }
+    tokenizer->deferred = deferred;
+    if (number_of_tokens == 0) {
+        tokenizer->offset = offset;
+        tokenizer->whitespace = whitespace;
+        run->prev = tokenizer->free_runs;
+        tokenizer->free_runs = run;
+        return false;
+    }
+    tokenizer->offset = offset;
+    tokenizer->whitespace = whitespace;
+    run->prev = *previous_run;
+    run->number_of_tokens = number_of_tokens;
+    run->lengths_size = lengths_size;
+    *previous_run = run;
+    return true;
+}
+static void free_token_runs(struct owl_token_run **run, void *allocator) {
+    while (*run) {
+        struct owl_token_run *prev = (*run)->prev;
+        free_memory(*run, sizeof(struct owl_token_run), allocator);
+        *run = prev;
+    }
+}
+static void find_token_range(struct owl_default_tokenizer *tokenizer, struct owl_token_run *run, uint16_t index, size_t *start, size_t *end) {
+    size_t offset = tokenizer->offset - tokenizer->whitespace;
+    size_t last_offset = offset;
+    size_t len = 0;
+    uint16_t length_offset = run->lengths_size - 1;
+    uint16_t j;
+    for (j = index;
+    j < run->number_of_tokens;
+    ++j) {
+        if (run->tokens[j] == 4294967295U) continue;
+        last_offset = offset;
+        len = decode_token_length(run, &length_offset, &offset);
+    }
+    *start = last_offset - len;
+    *end = last_offset;
+}
+static void estimate_next_token_range(struct owl_default_tokenizer *tokenizer, size_t *start, size_t *end) {
+    *start = tokenizer->offset;
+    size_t i = tokenizer->offset + 1;
+    while (i < tokenizer->length && tokenizer->text[i] != '\0' && !char_is_whitespace(tokenizer->text[i]) && !char_continues_identifier(tokenizer->text[i], tokenizer->info)) i++;
+    *end = i;
+}
+static void find_end_range(struct owl_default_tokenizer *tokenizer, size_t *start, size_t *end) {
+    *start = tokenizer->offset - tokenizer->whitespace - 1;
+    *end = tokenizer->offset - tokenizer->whitespace;
+    if (*start > *end) {
+        *start = *end;
+        *end += 1;
+    }
+}
+#if defined(__SIZEOF_INT128__)
+#define OWL_MULTIPLY_HIGH(a, b) ((uint64_t)(__extension__ ((unsigned __int128)(a) * (b) >> 64)))
+#else
+#define OWL_MULTIPLY_HIGH multiply_high
+#endif
+#if defined(__clang__) || defined(__GNUC__)
+#define OWL_LEADING_ZEROS(x) __builtin_clzll(x)
+#else
+#define OWL_LEADING_ZEROS leading_zeros
+#endif
+static const uint64_t powers_of_five[] = {
+    0xeef453d6923bd65a, 0x113faa2906a13b3f,
+    0x9558b4661b6565f8, 0x4ac7ca59a424c507,
+    0xbaaee17fa23ebf76, 0x5d79bcf00d2df649,
+    0xe95a99df8ace6f53, 0xf4d82c2c107973dc,
+    0x91d8a02bb6c10594, 0x79071b9b8a4be869,
+    0xb64ec836a47146f9, 0x9748e2826cdee284,
+    0xe3e27a444d8d98b7, 0xfd1b1b2308169b25,
+    0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7,
+    0xb208ef855c969f4f, 0xbdbd2d335e51a935,
+    0xde8b2b66b3bc4723, 0xad2c788035e61382,
+    0x8b16fb203055ac76, 0x4c3bcb5021afcc31,
+    0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d,
+    0xd953e8624b85dd78, 0xd71d6dad34a2af0d,
+    0x87d4713d6f33aa6b, 0x8672648c40e5ad68,
+    0xa9c98d8ccb009506, 0x680efdaf511f18c2,
+    0xd43bf0effdc0ba48, 0x0212bd1b2566def2,
+    0x84a57695fe98746d, 0x014bb630f7604b57,
+    0xa5ced43b7e3e9188, 0x419ea3bd35385e2d,
+    0xcf42894a5dce35ea, 0x52064cac828675b9,
+    0x818995ce7aa0e1b2, 0x7343efebd1940993,
+    0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8,
+    0xca66fa129f9b60a6, 0xd41a26e077774ef6,
+    0xfd00b897478238d0, 0x8920b098955522b4,
+    0x9e20735e8cb16382, 0x55b46e5f5d5535b0,
+    0xc5a890362fddbc62, 0xeb2189f734aa831d,
+    0xf712b443bbd52b7b, 0xa5e9ec7501d523e4,
+    0x9a6bb0aa55653b2d, 0x47b233c92125366e,
+    0xc1069cd4eabe89f8, 0x999ec0bb696e840a,
+    0xf148440a256e2c76, 0xc00670ea43ca250d,
+    0x96cd2a865764dbca, 0x380406926a5e5728,
+    0xbc807527ed3e12bc, 0xc605083704f5ecf2,
+    0xeba09271e88d976b, 0xf7864a44c633682e,
+    0x93445b8731587ea3, 0x7ab3ee6afbe0211d,
+    0xb8157268fdae9e4c, 0x5960ea05bad82964,
+    0xe61acf033d1a45df, 0x6fb92487298e33bd,
+    0x8fd0c16206306bab, 0xa5d3b6d479f8e056,
+    0xb3c4f1ba87bc8696, 0x8f48a4899877186c,
+    0xe0b62e2929aba83c, 0x331acdabfe94de87,
+    0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14,
+    0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9,
+    0xdb71e91432b1a24a, 0xc9e82cd9f69d6150,
+    0x892731ac9faf056e, 0xbe311c083a225cd2,
+    0xab70fe17c79ac6ca, 0x6dbd630a48aaf406,
+    0xd64d3d9db981787d, 0x092cbbccdad5b108,
+    0x85f0468293f0eb4e, 0x25bbf56008c58ea5,
+    0xa76c582338ed2621, 0xaf2af2b80af6f24e,
+    0xd1476e2c07286faa, 0x1af5af660db4aee1,
+    0x82cca4db847945ca, 0x50d98d9fc890ed4d,
+    0xa37fce126597973c, 0xe50ff107bab528a0,
+    0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8,
+    0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a,
+    0x9faacf3df73609b1, 0x77b191618c54e9ac,
+    0xc795830d75038c1d, 0xd59df5b9ef6a2417,
+    0xf97ae3d0d2446f25, 0x4b0573286b44ad1d,
+    0x9becce62836ac577, 0x4ee367f9430aec32,
+    0xc2e801fb244576d5, 0x229c41f793cda73f,
+    0xf3a20279ed56d48a, 0x6b43527578c1110f,
+    0x9845418c345644d6, 0x830a13896b78aaa9,
+    0xbe5691ef416bd60c, 0x23cc986bc656d553,
+    0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8,
+    0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9,
+    0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53,
+    0xe858ad248f5c22c9, 0xd1b3400f8f9cff68,
+    0x91376c36d99995be, 0x23100809b9c21fa1,
+    0xb58547448ffffb2d, 0xabd40a0c2832a78a,
+    0xe2e69915b3fff9f9, 0x16c90c8f323f516c,
+    0x8dd01fad907ffc3b, 0xae3da7d97f6792e3,
+    0xb1442798f49ffb4a, 0x99cd11cfdf41779c,
+    0xdd95317f31c7fa1d, 0x40405643d711d583,
+    0x8a7d3eef7f1cfc52, 0x482835ea666b2572,
+    0xad1c8eab5ee43b66, 0xda3243650005eecf,
+    0xd863b256369d4a40, 0x90bed43e40076a82,
+    0x873e4f75e2224e68, 0x5a7744a6e804a291,
+    0xa90de3535aaae202, 0x711515d0a205cb36,
+    0xd3515c2831559a83, 0x0d5a5b44ca873e03,
+    0x8412d9991ed58091, 0xe858790afe9486c2,
+    0xa5178fff668ae0b6, 0x626e974dbe39a872,
+    0xce5d73ff402d98e3, 0xfb0a3d212dc8128f,
+    0x80fa687f881c7f8e, 0x7ce66634bc9d0b99,
+    0xa139029f6a239f72, 0x1c1fffc1ebc44e80,
+    0xc987434744ac874e, 0xa327ffb266b56220,
+    0xfbe9141915d7a922, 0x4bf1ff9f0062baa8,
+    0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9,
+    0xc4ce17b399107c22, 0xcb550fb4384d21d3,
+    0xf6019da07f549b2b, 0x7e2a53a146606a48,
+    0x99c102844f94e0fb, 0x2eda7444cbfc426d,
+    0xc0314325637a1939, 0xfa911155fefb5308,
+    0xf03d93eebc589f88, 0x793555ab7eba27ca,
+    0x96267c7535b763b5, 0x4bc1558b2f3458de,
+    0xbbb01b9283253ca2, 0x9eb1aaedfb016f16,
+    0xea9c227723ee8bcb, 0x465e15a979c1cadc,
+    0x92a1958a7675175f, 0x0bfacd89ec191ec9,
+    0xb749faed14125d36, 0xcef980ec671f667b,
+    0xe51c79a85916f484, 0x82b7e12780e7401a,
+    0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810,
+    0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15,
+    0xdfbdcece67006ac9, 0x67a791e093e1d49a,
+    0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0,
+    0xaecc49914078536d, 0x58fae9f773886e18,
+    0xda7f5bf590966848, 0xaf39a475506a899e,
+    0x888f99797a5e012d, 0x6d8406c952429603,
+    0xaab37fd7d8f58178, 0xc8e5087ba6d33b83,
+    0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64,
+    0x855c3be0a17fcd26, 0x5cf2eea09a55067f,
+    0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e,
+    0xd0601d8efc57b08b, 0xf13b94daf124da26,
+    0x823c12795db6ce57, 0x76c53d08d6b70858,
+    0xa2cb1717b52481ed, 0x54768c4b0c64ca6e,
+    0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09,
+    0xfe5d54150b090b02, 0xd3f93b35435d7c4c,
+    0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf,
+    0xc6b8e9b0709f109a, 0x359ab6419ca1091b,
+    0xf867241c8cc6d4c0, 0xc30163d203c94b62,
+    0x9b407691d7fc44f8, 0x79e0de63425dcf1d,
+    0xc21094364dfb5636, 0x985915fc12f542e4,
+    0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d,
+    0x979cf3ca6cec5b5a, 0xa705992ceecf9c42,
+    0xbd8430bd08277231, 0x50c6ff782a838353,
+    0xece53cec4a314ebd, 0xa4f8bf5635246428,
+    0x940f4613ae5ed136, 0x871b7795e136be99,
+    0xb913179899f68584, 0x28e2557b59846e3f,
+    0xe757dd7ec07426e5, 0x331aeada2fe589cf,
+    0x9096ea6f3848984f, 0x3ff0d2c85def7621,
+    0xb4bca50b065abe63, 0x0fed077a756b53a9,
+    0xe1ebce4dc7f16dfb, 0xd3e8495912c62894,
+    0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c,
+    0xb080392cc4349dec, 0xbd8d794d96aacfb3,
+    0xdca04777f541c567, 0xecf0d7a0fc5583a0,
+    0x89e42caaf9491b60, 0xf41686c49db57244,
+    0xac5d37d5b79b6239, 0x311c2875c522ced5,
+    0xd77485cb25823ac7, 0x7d633293366b828b,
+    0x86a8d39ef77164bc, 0xae5dff9c02033197,
+    0xa8530886b54dbdeb, 0xd9f57f830283fdfc,
+    0xd267caa862a12d66, 0xd072df63c324fd7b,
+    0x8380dea93da4bc60, 0x4247cb9e59f71e6d,
+    0xa46116538d0deb78, 0x52d9be85f074e608,
+    0xcd795be870516656, 0x67902e276c921f8b,
+    0x806bd9714632dff6, 0x00ba1cd8a3db53b6,
+    0xa086cfcd97bf97f3, 0x80e8a40eccd228a4,
+    0xc8a883c0fdaf7df0, 0x6122cd128006b2cd,
+    0xfad2a4b13d1b5d6c, 0x796b805720085f81,
+    0x9cc3a6eec6311a63, 0xcbe3303674053bb0,
+    0xc3f490aa77bd60fc, 0xbedbfc4411068a9c,
+    0xf4f1b4d515acb93b, 0xee92fb5515482d44,
+    0x991711052d8bf3c5, 0x751bdd152d4d1c4a,
+    0xbf5cd54678eef0b6, 0xd262d45a78a0635d,
+    0xef340a98172aace4, 0x86fb897116c87c34,
+    0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0,
+    0xbae0a846d2195712, 0x8974836059cca109,
+    0xe998d258869facd7, 0x2bd1a438703fc94b,
+    0x91ff83775423cc06, 0x7b6306a34627ddcf,
+    0xb67f6455292cbf08, 0x1a3bc84c17b1d542,
+    0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93,
+    0x8e938662882af53e, 0x547eb47b7282ee9c,
+    0xb23867fb2a35b28d, 0xe99e619a4f23aa43,
+    0xdec681f9f4c31f31, 0x6405fa00e2ec94d4,
+    0x8b3c113c38f9f37e, 0xde83bc408dd3dd04,
+    0xae0b158b4738705e, 0x9624ab50b148d445,
+    0xd98ddaee19068c76, 0x3badd624dd9b0957,
+    0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6,
+    0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c,
+    0xd47487cc8470652b, 0x7647c3200069671f,
+    0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073,
+    0xa5fb0a17c777cf09, 0xf468107100525890,
+    0xcf79cc9db955c2cc, 0x7182148d4066eeb4,
+    0x81ac1fe293d599bf, 0xc6f14cd848405530,
+    0xa21727db38cb002f, 0xb8ada00e5a506a7c,
+    0xca9cf1d206fdc03b, 0xa6d90811f0e4851c,
+    0xfd442e4688bd304a, 0x908f4a166d1da663,
+    0x9e4a9cec15763e2e, 0x9a598e4e043287fe,
+    0xc5dd44271ad3cdba, 0x40eff1e1853f29fd,
+    0xf7549530e188c128, 0xd12bee59e68ef47c,
+    0x9a94dd3e8cf578b9, 0x82bb74f8301958ce,
+    0xc13a148e3032d6e7, 0xe36a52363c1faf01,
+    0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1,
+    0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9,
+    0xbcb2b812db11a5de, 0x7415d448f6b6f0e7,
+    0xebdf661791d60f56, 0x111b495b3464ad21,
+    0x936b9fcebb25c995, 0xcab10dd900beec34,
+    0xb84687c269ef3bfb, 0x3d5d514f40eea742,
+    0xe65829b3046b0afa, 0x0cb4a5a3112a5112,
+    0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab,
+    0xb3f4e093db73a093, 0x59ed216765690f56,
+    0xe0f218b8d25088b8, 0x306869c13ec3532c,
+    0x8c974f7383725573, 0x1e414218c73a13fb,
+    0xafbd2350644eeacf, 0xe5d1929ef90898fa,
+    0xdbac6c247d62a583, 0xdf45f746b74abf39,
+    0x894bc396ce5da772, 0x6b8bba8c328eb783,
+    0xab9eb47c81f5114f, 0x066ea92f3f326564,
+    0xd686619ba27255a2, 0xc80a537b0efefebd,
+    0x8613fd0145877585, 0xbd06742ce95f5f36,
+    0xa798fc4196e952e7, 0x2c48113823b73704,
+    0xd17f3b51fca3a7a0, 0xf75a15862ca504c5,
+    0x82ef85133de648c4, 0x9a984d73dbe722fb,
+    0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba,
+    0xcc963fee10b7d1b3, 0x318df905079926a8,
+    0xffbbcfe994e5c61f, 0xfdf17746497f7052,
+    0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633,
+    0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0,
+    0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0,
+    0x9c1661a651213e2d, 0x06bea10ca65c084e,
+    0xc31bfa0fe5698db8, 0x486e494fcff30a62,
+    0xf3e2f893dec3f126, 0x5a89dba3c3efccfa,
+    0x986ddb5c6b3a76b7, 0xf89629465a75e01c,
+    0xbe89523386091465, 0xf6bbb397f1135823,
+    0xee2ba6c0678b597f, 0x746aa07ded582e2c,
+    0x94db483840b717ef, 0xa8c2a44eb4571cdc,
+    0xba121a4650e4ddeb, 0x92f34d62616ce413,
+    0xe896a0d7e51e1566, 0x77b020baf9c81d17,
+    0x915e2486ef32cd60, 0x0ace1474dc1d122e,
+    0xb5b5ada8aaff80b8, 0x0d819992132456ba,
+    0xe3231912d5bf60e6, 0x10e1fff697ed6c69,
+    0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1,
+    0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2,
+    0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde,
+    0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b,
+    0xad4ab7112eb3929d, 0x86c16c98d2c953c6,
+    0xd89d64d57a607744, 0xe871c7bf077ba8b7,
+    0x87625f056c7c4a8b, 0x11471cd764ad4972,
+    0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf,
+    0xd389b47879823479, 0x4aff1d108d4ec2c3,
+    0x843610cb4bf160cb, 0xcedf722a585139ba,
+    0xa54394fe1eedb8fe, 0xc2974eb4ee658828,
+    0xce947a3da6a9273e, 0x733d226229feea32,
+    0x811ccc668829b887, 0x0806357d5a3f525f,
+    0xa163ff802a3426a8, 0xca07c2dcb0cf26f7,
+    0xc9bcff6034c13052, 0xfc89b393dd02f0b5,
+    0xfc2c3f3841f17c67, 0xbbac2078d443ace2,
+    0x9d9ba7832936edc0, 0xd54b944b84aa4c0d,
+    0xc5029163f384a931, 0x0a9e795e65d4df11,
+    0xf64335bcf065d37d, 0x4d4617b5ff4a16d5,
+    0x99ea0196163fa42e, 0x504bced1bf8e4e45,
+    0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6,
+    0xf07da27a82c37088, 0x5d767327bb4e5a4c,
+    0x964e858c91ba2655, 0x3a6a07f8d510f86f,
+    0xbbe226efb628afea, 0x890489f70a55368b,
+    0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e,
+    0x92c8ae6b464fc96f, 0x3b0b8bc90012929d,
+    0xb77ada0617e3bbcb, 0x09ce6ebb40173744,
+    0xe55990879ddcaabd, 0xcc420a6a101d0515,
+    0x8f57fa54c2a9eab6, 0x9fa946824a12232d,
+    0xb32df8e9f3546564, 0x47939822dc96abf9,
+    0xdff9772470297ebd, 0x59787e2b93bc56f7,
+    0x8bfbea76c619ef36, 0x57eb4edb3c55b65a,
+    0xaefae51477a06b03, 0xede622920b6b23f1,
+    0xdab99e59958885c4, 0xe95fab368e45eced,
+    0x88b402f7fd75539b, 0x11dbcb0218ebb414,
+    0xaae103b5fcd2a881, 0xd652bdc29f26a119,
+    0xd59944a37c0752a2, 0x4be76d3346f0495f,
+    0x857fcae62d8493a5, 0x6f70a4400c562ddb,
+    0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952,
+    0xd097ad07a71f26b2, 0x7e2000a41346a7a7,
+    0x825ecc24c873782f, 0x8ed400668c0c28c8,
+    0xa2f67f2dfa90563b, 0x728900802f0f32fa,
+    0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9,
+    0xfea126b7d78186bc, 0xe2f610c84987bfa8,
+    0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9,
+    0xc6ede63fa05d3143, 0x91503d1c79720dbb,
+    0xf8a95fcf88747d94, 0x75a44c6397ce912a,
+    0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba,
+    0xc24452da229b021b, 0xfbe85badce996168,
+    0xf2d56790ab41c2a2, 0xfae27299423fb9c3,
+    0x97c560ba6b0919a5, 0xdccd879fc967d41a,
+    0xbdb6b8e905cb600f, 0x5400e987bbc1c920,
+    0xed246723473e3813, 0x290123e9aab23b68,
+    0x9436c0760c86e30b, 0xf9a0b6720aaf6521,
+    0xb94470938fa89bce, 0xf808e40e8d5b3e69,
+    0xe7958cb87392c2c2, 0xb60b1d1230b20e04,
+    0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2,
+    0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3,
+    0xe2280b6c20dd5232, 0x25c6da63c38de1b0,
+    0x8d590723948a535f, 0x579c487e5a38ad0e,
+    0xb0af48ec79ace837, 0x2d835a9df0c6d851,
+    0xdcdb1b2798182244, 0xf8e431456cf88e65,
+    0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff,
+    0xac8b2d36eed2dac5, 0xe272467e3d222f3f,
+    0xd7adf884aa879177, 0x5b0ed81dcc6abb0f,
+    0x86ccbb52ea94baea, 0x98e947129fc2b4e9,
+    0xa87fea27a539e9a5, 0x3f2398d747b36224,
+    0xd29fe4b18e88640e, 0x8eec7f0d19a03aad,
+    0x83a3eeeef9153e89, 0x1953cf68300424ac,
+    0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7,
+    0xcdb02555653131b6, 0x3792f412cb06794d,
+    0x808e17555f3ebf11, 0xe2bbd88bbee40bd0,
+    0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4,
+    0xc8de047564d20a8b, 0xf245825a5a445275,
+    0xfb158592be068d2e, 0xeed6e2f0f0d56712,
+    0x9ced737bb6c4183d, 0x55464dd69685606b,
+    0xc428d05aa4751e4c, 0xaa97e14c3c26b886,
+    0xf53304714d9265df, 0xd53dd99f4b3066a8,
+    0x993fe2c6d07b7fab, 0xe546a8038efe4029,
+    0xbf8fdb78849a5f96, 0xde98520472bdd033,
+    0xef73d256a5c0f77c, 0x963e66858f6d4440,
+    0x95a8637627989aad, 0xdde7001379a44aa8,
+    0xbb127c53b17ec159, 0x5560c018580d5d52,
+    0xe9d71b689dde71af, 0xaab8f01e6e10b4a6,
+    0x9226712162ab070d, 0xcab3961304ca70e8,
+    0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22,
+    0xe45c10c42a2b3b05, 0x8cb89a7db77c506a,
+    0x8eb98a7a9a5b04e3, 0x77f3608e92adb242,
+    0xb267ed1940f1c61c, 0x55f038b237591ed3,
+    0xdf01e85f912e37a3, 0x6b6c46dec52f6688,
+    0x8b61313bbabce2c6, 0x2323ac4b3b3da015,
+    0xae397d8aa96c1b77, 0xabec975e0a0d081a,
+    0xd9c7dced53c72255, 0x96e7bd358c904a21,
+    0x881cea14545c7575, 0x7e50d64177da2e54,
+    0xaa242499697392d2, 0xdde50bd1d5d0b9e9,
+    0xd4ad2dbfc3d07787, 0x955e4ec64b44e864,
+    0x84ec3c97da624ab4, 0xbd5af13bef0b113e,
+    0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e,
+    0xcfb11ead453994ba, 0x67de18eda5814af2,
+    0x81ceb32c4b43fcf4, 0x80eacf948770ced7,
+    0xa2425ff75e14fc31, 0xa1258379a94d028d,
+    0xcad2f7f5359a3b3e, 0x096ee45813a04330,
+    0xfd87b5f28300ca0d, 0x8bca9d6e188853fc,
+    0x9e74d1b791e07e48, 0x775ea264cf55347e,
+    0xc612062576589dda, 0x95364afe032a819e,
+    0xf79687aed3eec551, 0x3a83ddbd83f52205,
+    0x9abe14cd44753b52, 0xc4926a9672793543,
+    0xc16d9a0095928a27, 0x75b7053c0f178294,
+    0xf1c90080baf72cb1, 0x5324c68b12dd6339,
+    0x971da05074da7bee, 0xd3f6fc16ebca5e04,
+    0xbce5086492111aea, 0x88f4bb1ca6bcf585,
+    0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6,
+    0x9392ee8e921d5d07, 0x3aff322e62439fd0,
+    0xb877aa3236a4b449, 0x09befeb9fad487c3,
+    0xe69594bec44de15b, 0x4c2ebe687989a9b4,
+    0x901d7cf73ab0acd9, 0x0f9d37014bf60a11,
+    0xb424dc35095cd80f, 0x538484c19ef38c95,
+    0xe12e13424bb40e13, 0x2865a5f206b06fba,
+    0x8cbccc096f5088cb, 0xf93f87b7442e45d4,
+    0xafebff0bcb24aafe, 0xf78f69a51539d749,
+    0xdbe6fecebdedd5be, 0xb573440e5a884d1c,
+    0x89705f4136b4a597, 0x31680a88f8953031,
+    0xabcc77118461cefc, 0xfdc20d2b36ba7c3e,
+    0xd6bf94d5e57a42bc, 0x3d32907604691b4d,
+    0x8637bd05af6c69b5, 0xa63f9a49c2c1b110,
+    0xa7c5ac471b478423, 0x0fcf80dc33721d54,
+    0xd1b71758e219652b, 0xd3c36113404ea4a9,
+    0x83126e978d4fdf3b, 0x645a1cac083126ea,
+    0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4,
+    0xcccccccccccccccc, 0xcccccccccccccccd,
+    0x8000000000000000, 0x0000000000000000,
+    0xa000000000000000, 0x0000000000000000,
+    0xc800000000000000, 0x0000000000000000,
+    0xfa00000000000000, 0x0000000000000000,
+    0x9c40000000000000, 0x0000000000000000,
+    0xc350000000000000, 0x0000000000000000,
+    0xf424000000000000, 0x0000000000000000,
+    0x9896800000000000, 0x0000000000000000,
+    0xbebc200000000000, 0x0000000000000000,
+    0xee6b280000000000, 0x0000000000000000,
+    0x9502f90000000000, 0x0000000000000000,
+    0xba43b74000000000, 0x0000000000000000,
+    0xe8d4a51000000000, 0x0000000000000000,
+    0x9184e72a00000000, 0x0000000000000000,
+    0xb5e620f480000000, 0x0000000000000000,
+    0xe35fa931a0000000, 0x0000000000000000,
+    0x8e1bc9bf04000000, 0x0000000000000000,
+    0xb1a2bc2ec5000000, 0x0000000000000000,
+    0xde0b6b3a76400000, 0x0000000000000000,
+    0x8ac7230489e80000, 0x0000000000000000,
+    0xad78ebc5ac620000, 0x0000000000000000,
+    0xd8d726b7177a8000, 0x0000000000000000,
+    0x878678326eac9000, 0x0000000000000000,
+    0xa968163f0a57b400, 0x0000000000000000,
+    0xd3c21bcecceda100, 0x0000000000000000,
+    0x84595161401484a0, 0x0000000000000000,
+    0xa56fa5b99019a5c8, 0x0000000000000000,
+    0xcecb8f27f4200f3a, 0x0000000000000000,
+    0x813f3978f8940984, 0x4000000000000000,
+    0xa18f07d736b90be5, 0x5000000000000000,
+    0xc9f2c9cd04674ede, 0xa400000000000000,
+    0xfc6f7c4045812296, 0x4d00000000000000,
+    0x9dc5ada82b70b59d, 0xf020000000000000,
+    0xc5371912364ce305, 0x6c28000000000000,
+    0xf684df56c3e01bc6, 0xc732000000000000,
+    0x9a130b963a6c115c, 0x3c7f400000000000,
+    0xc097ce7bc90715b3, 0x4b9f100000000000,
+    0xf0bdc21abb48db20, 0x1e86d40000000000,
+    0x96769950b50d88f4, 0x1314448000000000,
+    0xbc143fa4e250eb31, 0x17d955a000000000,
+    0xeb194f8e1ae525fd, 0x5dcfab0800000000,
+    0x92efd1b8d0cf37be, 0x5aa1cae500000000,
+    0xb7abc627050305ad, 0xf14a3d9e40000000,
+    0xe596b7b0c643c719, 0x6d9ccd05d0000000,
+    0x8f7e32ce7bea5c6f, 0xe4820023a2000000,
+    0xb35dbf821ae4f38b, 0xdda2802c8a800000,
+    0xe0352f62a19e306e, 0xd50b2037ad200000,
+    0x8c213d9da502de45, 0x4526f422cc340000,
+    0xaf298d050e4395d6, 0x9670b12b7f410000,
+    0xdaf3f04651d47b4c, 0x3c0cdd765f114000,
+    0x88d8762bf324cd0f, 0xa5880a69fb6ac800,
+    0xab0e93b6efee0053, 0x8eea0d047a457a00,
+    0xd5d238a4abe98068, 0x72a4904598d6d880,
+    0x85a36366eb71f041, 0x47a6da2b7f864750,
+    0xa70c3c40a64e6c51, 0x999090b65f67d924,
+    0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d,
+    0x82818f1281ed449f, 0xbff8f10e7a8921a4,
+    0xa321f2d7226895c7, 0xaff72d52192b6a0d,
+    0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490,
+    0xfee50b7025c36a08, 0x02f236d04753d5b4,
+    0x9f4f2726179a2245, 0x01d762422c946590,
+    0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5,
+    0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2,
+    0x9b934c3b330c8577, 0x63cc55f49f88eb2f,
+    0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb,
+    0xf316271c7fc3908a, 0x8bef464e3945ef7a,
+    0x97edd871cfda3a56, 0x97758bf0e3cbb5ac,
+    0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317,
+    0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd,
+    0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a,
+    0xb975d6b6ee39e436, 0xb3e2fd538e122b44,
+    0xe7d34c64a9c85d44, 0x60dbbca87196b616,
+    0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd,
+    0xb51d13aea4a488dd, 0x6babab6398bdbe41,
+    0xe264589a4dcdab14, 0xc696963c7eed2dd1,
+    0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2,
+    0xb0de65388cc8ada8, 0x3b25a55f43294bcb,
+    0xdd15fe86affad912, 0x49ef0eb713f39ebe,
+    0x8a2dbf142dfcc7ab, 0x6e3569326c784337,
+    0xacb92ed9397bf996, 0x49c2c37f07965404,
+    0xd7e77a8f87daf7fb, 0xdc33745ec97be906,
+    0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3,
+    0xa8acd7c0222311bc, 0xc40832ea0d68ce0c,
+    0xd2d80db02aabd62b, 0xf50a3fa490c30190,
+    0x83c7088e1aab65db, 0x792667c6da79e0fa,
+    0xa4b8cab1a1563f52, 0x577001b891185938,
+    0xcde6fd5e09abcf26, 0xed4c0226b55e6f86,
+    0x80b05e5ac60b6178, 0x544f8158315b05b4,
+    0xa0dc75f1778e39d6, 0x696361ae3db1c721,
+    0xc913936dd571c84c, 0x03bc3a19cd1e38e9,
+    0xfb5878494ace3a5f, 0x04ab48a04065c723,
+    0x9d174b2dcec0e47b, 0x62eb0d64283f9c76,
+    0xc45d1df942711d9a, 0x3ba5d0bd324f8394,
+    0xf5746577930d6500, 0xca8f44ec7ee36479,
+    0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb,
+    0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e,
+    0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e,
+    0x95d04aee3b80ece5, 0xbba1f1d158724a12,
+    0xbb445da9ca61281f, 0x2a8a6e45ae8edc97,
+    0xea1575143cf97226, 0xf52d09d71a3293bd,
+    0x924d692ca61be758, 0x593c2626705f9c56,
+    0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c,
+    0xe498f455c38b997a, 0x0b6dfb9c0f956447,
+    0x8edf98b59a373fec, 0x4724bd4189bd5eac,
+    0xb2977ee300c50fe7, 0x58edec91ec2cb657,
+    0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed,
+    0x8b865b215899f46c, 0xbd79e0d20082ee74,
+    0xae67f1e9aec07187, 0xecd8590680a3aa11,
+    0xda01ee641a708de9, 0xe80e6f4820cc9495,
+    0x884134fe908658b2, 0x3109058d147fdcdd,
+    0xaa51823e34a7eede, 0xbd4b46f0599fd415,
+    0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a,
+    0x850fadc09923329e, 0x03e2cf6bc604ddb0,
+    0xa6539930bf6bff45, 0x84db8346b786151c,
+    0xcfe87f7cef46ff16, 0xe612641865679a63,
+    0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e,
+    0xa26da3999aef7749, 0xe3be5e330f38f09d,
+    0xcb090c8001ab551c, 0x5cadf5bfd3072cc5,
+    0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6,
+    0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa,
+    0xc646d63501a1511d, 0xb281e1fd541501b8,
+    0xf7d88bc24209a565, 0x1f225a7ca91a4226,
+    0x9ae757596946075f, 0x3375788de9b06958,
+    0xc1a12d2fc3978937, 0x0052d6b1641c83ae,
+    0xf209787bb47d6b84, 0xc0678c5dbd23a49a,
+    0x9745eb4d50ce6332, 0xf840b7ba963646e0,
+    0xbd176620a501fbff, 0xb650e5a93bc3d898,
+    0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe,
+    0x93ba47c980e98cdf, 0xc66f336c36b10137,
+    0xb8a8d9bbe123f017, 0xb80b0047445d4184,
+    0xe6d3102ad96cec1d, 0xa60dc059157491e5,
+    0x9043ea1ac7e41392, 0x87c89837ad68db2f,
+    0xb454e4a179dd1877, 0x29babe4598c311fb,
+    0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a,
+    0x8ce2529e2734bb1d, 0x1899e4a65f58660c,
+    0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f,
+    0xdc21a1171d42645d, 0x76707543f4fa1f73,
+    0x899504ae72497eba, 0x6a06494a791c53a8,
+    0xabfa45da0edbde69, 0x0487db9d17636892,
+    0xd6f8d7509292d603, 0x45a9d2845d3c42b6,
+    0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2,
+    0xa7f26836f282b732, 0x8e6cac7768d7141e,
+    0xd1ef0244af2364ff, 0x3207d795430cd926,
+    0x8335616aed761f1f, 0x7f44e6bd49e807b8,
+    0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6,
+    0xcd036837130890a1, 0x36dba887c37a8c0f,
+    0x802221226be55a64, 0xc2494954da2c9789,
+    0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c,
+    0xc83553c5c8965d3d, 0x6f92829494e5acc7,
+    0xfa42a8b73abbf48c, 0xcb772339ba1f17f9,
+    0x9c69a97284b578d7, 0xff2a760414536efb,
+    0xc38413cf25e2d70d, 0xfef5138519684aba,
+    0xf46518c2ef5b8cd1, 0x7eb258665fc25d69,
+    0x98bf2f79d5993802, 0xef2f773ffbd97a61,
+    0xbeeefb584aff8603, 0xaafb550ffacfd8fa,
+    0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38,
+    0x952ab45cfa97a0b2, 0xdd945a747bf26183,
+    0xba756174393d88df, 0x94f971119aeef9e4,
+    0xe912b9d1478ceb17, 0x7a37cd5601aab85d,
+    0x91abb422ccb812ee, 0xac62e055c10ab33a,
+    0xb616a12b7fe617aa, 0x577b986b314d6009,
+    0xe39c49765fdf9d94, 0xed5a7e85fda0b80b,
+    0x8e41ade9fbebc27d, 0x14588f13be847307,
+    0xb1d219647ae6b31c, 0x596eb2d8ae258fc8,
+    0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb,
+    0x8aec23d680043bee, 0x25de7bb9480d5854,
+    0xada72ccc20054ae9, 0xaf561aa79a10ae6a,
+    0xd910f7ff28069da4, 0x1b2ba1518094da04,
+    0x87aa9aff79042286, 0x90fb44d2f05d0842,
+    0xa99541bf57452b28, 0x353a1607ac744a53,
+    0xd3fa922f2d1675f2, 0x42889b8997915ce8,
+    0x847c9b5d7c2e09b7, 0x69956135febada11,
+    0xa59bc234db398c25, 0x43fab9837e699095,
+    0xcf02b2c21207ef2e, 0x94f967e45e03f4bb,
+    0x8161afb94b44f57d, 0x1d1be0eebac278f5,
+    0xa1ba1ba79e1632dc, 0x6462d92a69731732,
+    0xca28a291859bbf93, 0x7d7b8f7503cfdcfe,
+    0xfcb2cb35e702af78, 0x5cda735244c3d43e,
+    0x9defbf01b061adab, 0x3a0888136afa64a7,
+    0xc56baec21c7a1916, 0x088aaa1845b8fdd0,
+    0xf6c69a72a3989f5b, 0x8aad549e57273d45,
+    0x9a3c2087a63f6399, 0x36ac54e2f678864b,
+    0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd,
+    0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5,
+    0x969eb7c47859e743, 0x9f644ae5a4b1b325,
+    0xbc4665b596706114, 0x873d5d9f0dde1fee,
+    0xeb57ff22fc0c7959, 0xa90cb506d155a7ea,
+    0x9316ff75dd87cbd8, 0x09a7f12442d588f2,
+    0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f,
+    0xe5d3ef282a242e81, 0x8f1668c8a86da5fa,
+    0x8fa475791a569d10, 0xf96e017d694487bc,
+    0xb38d92d760ec4455, 0x37c981dcc395a9ac,
+    0xe070f78d3927556a, 0x85bbe253f47b1417,
+    0x8c469ab843b89562, 0x93956d7478ccec8e,
+    0xaf58416654a6babb, 0x387ac8d1970027b2,
+    0xdb2e51bfe9d0696a, 0x06997b05fcc0319e,
+    0x88fcf317f22241e2, 0x441fece3bdf81f03,
+    0xab3c2fddeeaad25a, 0xd527e81cad7626c3,
+    0xd60b3bd56a5586f1, 0x8a71e223d8d3b074,
+    0x85c7056562757456, 0xf6872d5667844e49,
+    0xa738c6bebb12d16c, 0xb428f8ac016561db,
+    0xd106f86e69d785c7, 0xe13336d701beba52,
+    0x82a45b450226b39c, 0xecc0024661173473,
+    0xa34d721642b06084, 0x27f002d7f95d0190,
+    0xcc20ce9bd35c78a5, 0x31ec038df7b441f4,
+    0xff290242c83396ce, 0x7e67047175a15271,
+    0x9f79a169bd203e41, 0x0f0062c6e984d386,
+    0xc75809c42c684dd1, 0x52c07b78a3e60868,
+    0xf92e0c3537826145, 0xa7709a56ccdf8a82,
+    0x9bbcc7a142b17ccb, 0x88a66076400bb691,
+    0xc2abf989935ddbfe, 0x6acff893d00ea435,
+    0xf356f7ebf83552fe, 0x0583f6b8c4124d43,
+    0x98165af37b2153de, 0xc3727a337a8b704a,
+    0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c,
+    0xeda2ee1c7064130c, 0x1162def06f79df73,
+    0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8,
+    0xb9a74a0637ce2ee1, 0x6d953e2bd7173692,
+    0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437,
+    0x910ab1d4db9914a0, 0x1d9c9892400a22a2,
+    0xb54d5e4a127f59c8, 0x2503beb6d00cab4b,
+    0xe2a0b5dc971f303a, 0x2e44ae64840fd61d,
+    0x8da471a9de737e24, 0x5ceaecfed289e5d2,
+    0xb10d8e1456105dad, 0x7425a83e872c5f47,
+    0xdd50f1996b947518, 0xd12f124e28f77719,
+    0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f,
+    0xace73cbfdc0bfb7b, 0x636cc64d1001550b,
+    0xd8210befd30efa5a, 0x3c47f7e05401aa4e,
+    0x8714a775e3e95c78, 0x65acfaec34810a71,
+    0xa8d9d1535ce3b396, 0x7f1839a741a14d0d,
+    0xd31045a8341ca07c, 0x1ede48111209a050,
+    0x83ea2b892091e44d, 0x934aed0aab460432,
+    0xa4e4b66b68b65d60, 0xf81da84d5617853f,
+    0xce1de40642e3f4b9, 0x36251260ab9d668e,
+    0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019,
+    0xa1075a24e4421730, 0xb24cf65b8612f81f,
+    0xc94930ae1d529cfc, 0xdee033f26797b627,
+    0xfb9b7cd9a4a7443c, 0x169840ef017da3b1,
+    0x9d412e0806e88aa5, 0x8e1f289560ee864e,
+    0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2,
+    0xf5b5d7ec8acb58a2, 0xae10af696774b1db,
+    0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29,
+    0xbff610b0cc6edd3f, 0x17fd090a58d32af3,
+    0xeff394dcff8a948e, 0xddfc4b4cef07f5b0,
+    0x95f83d0a1fb69cd9, 0x4abdaf101564f98e,
+    0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1,
+    0xea53df5fd18d5513, 0x84c86189216dc5ed,
+    0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4,
+    0xb7118682dbb66a77, 0x3fbc8c33221dc2a1,
+    0xe4d5e82392a40515, 0x0fabaf3feaa5334a,
+    0x8f05b1163ba6832d, 0x29cb4d87f2a7400e,
+    0xb2c71d5bca9023f8, 0x743e20e9ef511012,
+    0xdf78e4b2bd342cf6, 0x914da9246b255416,
+    0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e,
+    0xae9672aba3d0c320, 0xa184ac2473b529b1,
+    0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e,
+    0x8865899617fb1871, 0x7e2fa67c7a658892,
+    0xaa7eebfb9df9de8d, 0xddbb901b98feeab7,
+    0xd51ea6fa85785631, 0x552a74227f3ea565,
+    0x8533285c936b35de, 0xd53a88958f87275f,
+    0xa67ff273b8460356, 0x8a892abaf368f137,
+    0xd01fef10a657842c, 0x2d2b7569b0432d85,
+    0x8213f56a67f6b29b, 0x9c3b29620e29fc73,
+    0xa298f2c501f45f42, 0x8349f3ba91b47b8f,
+    0xcb3f2f7642717713, 0x241c70a936219a73,
+    0xfe0efb53d30dd4d7, 0xed238cd383aa0110,
+    0x9ec95d1463e8a506, 0xf4363804324a40aa,
+    0xc67bb4597ce2ce48, 0xb143c6053edcd0d5,
+    0xf81aa16fdc1b81da, 0xdd94b7868e94050a,
+    0x9b10a4e5e9913128, 0xca7cf2b4191c8326,
+    0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0,
+    0xf24a01a73cf2dccf, 0xbc633b39673c8cec,
+    0x976e41088617ca01, 0xd5be0503e085d813,
+    0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18,
+    0xec9c459d51852ba2, 0xddf8e7d60ed1219e,
+    0x93e1ab8252f33b45, 0xcabb90e5c942b503,
+    0xb8da1662e7b00a17, 0x3d6a751f3b936243,
+    0xe7109bfba19c0c9d, 0x0cc512670a783ad4,
+    0x906a617d450187e2, 0x27fb2b80668b24c5,
+    0xb484f9dc9641e9da, 0xb1f9f660802dedf6,
+    0xe1a63853bbd26451, 0x5e7873f8a0396973,
+    0x8d07e33455637eb2, 0xdb0b487b6423e1e8,
+    0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62,
+    0xdc5c5301c56b75f7, 0x7641a140cc7810fb,
+    0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d,
+    0xac2820d9623bf429, 0x546345fa9fbdcd44,
+    0xd732290fbacaf133, 0xa97c177947ad4095,
+    0x867f59a9d4bed6c0, 0x49ed8eabcccc485d,
+    0xa81f301449ee8c70, 0x5c68f256bfff5a74,
+    0xd226fc195c6a2f8c, 0x73832eec6fff3111,
+    0x83585d8fd9c25db7, 0xc831fd53c5ff7eab,
+    0xa42e74f3d032f525, 0xba3e7ca8b77f5e55,
+    0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb,
+    0x80444b5e7aa7cf85, 0x7980d163cf5b81b3,
+    0xa0555e361951c366, 0xd7e105bcc332621f,
+    0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7,
+    0xfa856334878fc150, 0xb14f98f6f0feb951,
+    0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3,
+    0xc3b8358109e84f07, 0x0a862f80ec4700c8,
+    0xf4a642e14c6262c8, 0xcd27bb612758c0fa,
+    0x98e7e9cccfbd7dbd, 0x8038d51cb897789c,
+    0xbf21e44003acdd2c, 0xe0470a63e6bd56c3,
+    0xeeea5d5004981478, 0x1858ccfce06cac74,
+    0x95527a5202df0ccb, 0x0f37801e0c43ebc8,
+    0xbaa718e68396cffd, 0xd30560258f54e6ba,
+    0xe950df20247c83fd, 0x47c6b82ef32a2069,
+    0x91d28b7416cdd27e, 0x4cdc331d57fa5441,
+    0xb6472e511c81471d, 0xe0133fe4adf8e952,
+    0xe3d8f9e563a198e5, 0x58180fddd97723a6,
+    0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648,
+};
+static inline uint64_t multiply_high(uint64_t a, uint64_t b) {
+    uint64_t a_low = (uint32_t)a;
+    uint64_t a_high = a >> 32;
+    uint64_t b_low = (uint32_t)b;
+    uint64_t b_high = b >> 32;
+    uint64_t low_high = a_low * b_high;
+    uint64_t middle = a_high * b_low + ((a_low * b_low) >> 32) + (uint32_t)low_high;
+    return a_high * b_high + (middle >> 32) + (low_high >> 32);
+}
+static inline int leading_zeros(uint64_t x) {
+    int n = 0;
+    while (!(x & 0x8000000000000000)) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+}
+static bool eisel_lemire(uint64_t mantissa, int32_t exponent, double *number) {
+    int shift = OWL_LEADING_ZEROS(mantissa);
+    mantissa <<= shift;
+    const uint64_t *power = powers_of_five + 2 * (exponent + 342);
+    uint64_t high = OWL_MULTIPLY_HIGH(mantissa, power[0]);
+    uint64_t low = mantissa * power[0];
+    if ((high & 0x1ff) == 0x1ff) {
+        uint64_t carry = OWL_MULTIPLY_HIGH(mantissa, power[1]);
+        low += carry;
+        if (carry > low) high++;
+    }
+    int upper_bit = (int)(high >> 63);
+    int bits_shift = upper_bit + 9;
+    uint64_t bits = high >> bits_shift;
+    int32_t binary_exponent = ((217706 * exponent) >> 16) + 63 + upper_bit - shift + 1023;
+    if (binary_exponent <= 0) return false;
+    if (low <= 1 && exponent >= -4 && exponent <= 23 && (bits & 3) == 1 && (bits << bits_shift) == high) bits &= ~(uint64_t)1;
+    bits += bits & 1;
+    bits >>= 1;
+    if (bits >= (uint64_t)2 << 52) {
+        bits = (uint64_t)1 << 52;
+        binary_exponent++;
+    }
+    if (binary_exponent >= 0x7ff) return false;
+    bits &= ~((uint64_t)1 << 52);
+    bits |= (uint64_t)binary_exponent << 52;
+    memcpy(number, &bits, sizeof(bits));
+    return true;
+}
+static size_t read_mantissa_digits(const char *text, size_t offset, size_t length, uint64_t *mantissa, size_t *digits) {
+    while (offset + 8 <= length && *digits + 8 <= 19) {
+        uint64_t chunk = read_eight_bytes(text + offset);
+        if (!eight_bytes_are_digits(chunk)) break;
+        *mantissa = *mantissa * 100000000 + eight_digits_value(chunk);
+        *digits += 8;
+        offset += 8;
+    }
+    while (offset < length && char_is_numeric(text[offset])) {
+        if (*digits < 19) *mantissa = *mantissa * 10 + (uint64_t)(text[offset] - '0');
+        (*digits)++;
+        offset++;
+    }
+    return offset;
+}
+static bool char_may_continue_hexadecimal_number(char c) {
+    switch (c) {
+    case '.':
+    case '+':
+    case '-':
+    case 'x':
+    case 'X':
+    case 'p':
+    case 'P':
+        return true;
+    default:
+        return char_is_numeric(c) || char_is_hexadecimal_alpha(c);
+    }
+}
+static double read_number_with_strtod(const char *text, size_t length, bool has_decimal_exponent, int64_t decimal_exponent, size_t *number_length, void *allocator) {
+    char buffer[64];
+    char *copy = buffer;
+    if (length + 24 > sizeof(buffer)) {
+        copy = allocate_memory(length + 24, allocator);
+        if (!copy) {
+            *number_length = 0;
+            return 0;
+        }
+    }
+    size_t copy_length = 0;
+    if (has_decimal_exponent) {
+        for (size_t i = 0;
+        i < length && text[i] != 'e' && text[i] != 'E';
+        ++i) {
+            if (char_is_numeric(text[i])) copy[copy_length++] = text[i];
+        }
+        snprintf(copy + copy_length, 24, "e%lld", (long long)decimal_exponent);
+    }
+    else {
+        memcpy(copy, text, length);
+        copy[length] = '\0';
+    }
+    char *rest = 0;
+    double number = strtod(copy, &rest);
+    if (!has_decimal_exponent) *number_length = rest - copy;
+    if (copy != buffer) free_memory(copy, length + 24, allocator);
+    return number;
+}
+static double read_number(const char *text, size_t length, size_t *number_length, void *allocator) {
+    if (length > 1 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X')) {
+        size_t n = 2;
+        while (n < length && char_may_continue_hexadecimal_number(text[n])) n++;
+        return read_number_with_strtod(text, n, false, 0, number_length, allocator);
+    }
+    size_t offset = 0;
+    while (offset < length && text[offset] == '0') offset++;
+    uint64_t mantissa = 0;
+    size_t digits = 0;
+    offset = read_mantissa_digits(text, offset, length, &mantissa, &digits);
+    int64_t exponent = 0;
+    if (offset < length && text[offset] == '.') {
+        size_t fraction_start = ++offset;
+        if (digits == 0) {
+            while (offset < length && text[offset] == '0') offset++;
+        }
+        offset = read_mantissa_digits(text, offset, length, &mantissa, &digits);
+        exponent = -(int64_t)(offset - fraction_start);
+    }
+    if (offset + 1 < length && (text[offset] == 'e' || text[offset] == 'E')) {
+        size_t exponent_offset = offset + 1;
+        bool negative = text[exponent_offset] == '-';
+        if (negative || text[exponent_offset] == '+') exponent_offset++;
+        if (exponent_offset < length && char_is_numeric(text[exponent_offset])) {
+            int64_t explicit_exponent = 0;
+            while (exponent_offset < length && char_is_numeric(text[exponent_offset])) {
+                if (explicit_exponent < 0x10000000) {
+                    explicit_exponent = explicit_exponent * 10 + (text[exponent_offset] - '0');
+                }
+                exponent_offset++;
+            }
+        exponent += negative ? -explicit_exponent :
+            explicit_exponent;
+            offset = exponent_offset;
+        }
+    }
+    *number_length = offset;
+    if (digits == 0) return 0;
+    double number;
+    if (digits <= 19 && exponent >= -342 && exponent <= 308 && eisel_lemire(mantissa, (int32_t)exponent, &number)) return number;
+    return read_number_with_strtod(text, offset, true, exponent, number_length, allocator);
+}
+static uint32_t rule_lookup(uint32_t parent, uint32_t slot, void *context);
+static void fixity_associativity_precedence_lookup(int *fixity_associativity, int *precedence, uint32_t rule, uint32_t choice, void *context);
+static size_t number_of_slots_lookup(uint32_t rule, void *context);
+static void left_right_operand_slots_lookup(uint32_t rule, uint32_t *left, uint32_t *right, uint32_t *operand, void *context);
+enum construct_fixity_associativity {
+CONSTRUCT_PREFIX, CONSTRUCT_POSTFIX, CONSTRUCT_INFIX_LEFT, CONSTRUCT_INFIX_RIGHT, CONSTRUCT_INFIX_FLAT, };
+struct construct_node {
+    struct construct_node *next;
+    size_t number_of_slots;
+    size_t *slots;
+    size_t slots_capacity;
+    uint32_t rule;
+    uint16_t slot_index;
+    uint16_t choice_index;
+    enum construct_fixity_associativity fixity_associativity;
+    int precedence;
+    size_t start_location;
+    size_t end_location;
+};
+struct construct_expression {
+    struct construct_expression *parent;
+    struct construct_node *first_operator;
+    struct construct_node *first_value;
+    uint32_t operand_slot_index;
+    uint32_t left_slot_index;
+    uint32_t right_slot_index;
+    uint32_t rule;
+    uint16_t slot_index;
+};
+enum construct_root_type {
+CONSTRUCT_NORMAL_ROOT, CONSTRUCT_EXPRESSION_ROOT, };
+struct construct_state {
+    enum construct_root_type root_type;
+    struct construct_node *under_construction;
+    struct construct_expression *current_expression;
+    struct construct_node *node_freelist;
+    struct construct_expression *expression_freelist;
+    void *info;
+    void *allocator;
+};
+static struct construct_node *construct_node_alloc(struct construct_state *s, uint32_t rule) {
+    struct construct_node *node;
+    size_t number_of_slots = number_of_slots_lookup(rule, s->info);
+    if (s->node_freelist) {
+        node = s->node_freelist;
+        s->node_freelist = node->next;
+        size_t *slots = node->slots;
+        size_t slots_capacity = node->slots_capacity;
+        if (number_of_slots > slots_capacity) {
+            slots = reallocate_memory(slots, slots_capacity * sizeof(size_t), number_of_slots * sizeof(size_t), s->allocator);
+            if (!slots) abort();
+            slots_capacity = number_of_slots;
+        }
+        memset(node, 0, sizeof(struct construct_node));
+        if (number_of_slots > 0) memset(slots, 0, number_of_slots * sizeof(size_t));
+        node->slots = slots;
+        node->slots_capacity = slots_capacity;
+    }
+    else {
+        node = allocate_memory(sizeof(struct construct_node), s->allocator);
+        if (!node) abort();
+        memset(node, 0, sizeof(struct construct_node));
+        if (number_of_slots > 0) {
+            node->slots = allocate_memory(number_of_slots * sizeof(size_t), s->allocator);
+            if (!node->slots) abort();
+            memset(node->slots, 0, number_of_slots * sizeof(size_t));
+        }
+        node->slots_capacity = number_of_slots;
+    }
+    node->rule = rule;
+    node->number_of_slots = number_of_slots;
+    return node;
+}
+static struct construct_expression *construct_expression_alloc(struct construct_state *s, uint32_t rule) {
+    struct construct_expression *expr;
+    if (s->expression_freelist) {
+        expr = s->expression_freelist;
+        s->expression_freelist = expr->parent;
+        memset(expr, 0, sizeof(struct construct_expression));
+    }
+    else {
+        expr = allocate_memory(sizeof(struct construct_expression), s->allocator);
+        if (!expr) abort();
+        memset(expr, 0, sizeof(struct construct_expression));
+    }
+    (left_right_operand_slots_lookup(rule, &(expr->left_slot_index), &(expr->right_slot_index), &(expr->operand_slot_index), s->info));
+    expr->rule = rule;
+    return expr;
+}
+static void construct_node_free(struct construct_state *state, struct construct_node *node) {
+    node->next = state->node_freelist;
+    state->node_freelist = node;
+}
+static void construct_expression_free(struct construct_state *state, struct construct_expression *expr) {
+    expr->parent = state->expression_freelist;
+    state->expression_freelist = expr;
+}
+static bool construct_expression_should_reduce(struct construct_state *s, struct construct_expression *expr, struct construct_node *node) {
+    if (node->fixity_associativity == CONSTRUCT_POSTFIX) return false;
+    struct construct_node *top = expr->first_operator;
+    if (!top) return false;
+    return node->precedence < top->precedence || (node->precedence == top->precedence && node->fixity_associativity == CONSTRUCT_INFIX_RIGHT);
+}
+static void construct_expression_reduce(struct construct_state *s, struct construct_expression *expr) {
+    struct construct_node *op = expr->first_operator;
+    if (op->fixity_associativity == CONSTRUCT_INFIX_FLAT) {
+        struct construct_node *first_value = expr->first_value;
+        struct construct_node *last_value = first_value;
+        struct construct_node *last_operator = op;
+        size_t operand = op->slots[expr->operand_slot_index];
+        struct construct_node *combined_op = construct_node_alloc(s, op->rule);
+        combined_op->choice_index = op->choice_index;
+        combined_op->slot_index = op->slot_index;
+        combined_op->fixity_associativity = op->fixity_associativity;
+        combined_op->precedence = op->precedence;
+        struct construct_node *reversed_values = 0;
+        while (last_operator && last_operator->choice_index == op->choice_index) {
+            struct construct_node *next_op = last_operator->next;
+            construct_node_free(s, last_operator);
+            last_operator = next_op;
+            assert(last_value);
+            struct construct_node *next_value = last_value->next;
+            last_value->next = reversed_values;
+            reversed_values = last_value;
+            last_value = next_value;
+        }
+        combined_op->start_location = first_value->start_location;
+        combined_op->end_location = last_value->end_location;
+        assert(last_value);
+        operand = (finish_node((last_value)->rule, (last_value)->choice_index, operand, (last_value)->slots, (last_value)->start_location, (last_value)->end_location, s->info));
+        combined_op->next = last_value->next;
+        construct_node_free(s, last_value);
+        while (reversed_values) {
+            operand = (finish_node((reversed_values)->rule, (reversed_values)->choice_index, operand, (reversed_values)->slots, (reversed_values)->start_location, (reversed_values)->end_location, s->info));
+            struct construct_node *next_value = reversed_values->next;
+            construct_node_free(s, reversed_values);
+            reversed_values = next_value;
+        }
+        expr->first_operator = last_operator;
+        expr->first_value = combined_op;
+        combined_op->slots[expr->operand_slot_index] = operand;
+    }
+    else if (op->fixity_associativity == CONSTRUCT_INFIX_LEFT || op->fixity_associativity == CONSTRUCT_INFIX_RIGHT) {
+        expr->first_operator = op->next;
+        struct construct_node *left = expr->first_value;
+        struct construct_node *right = left->next;
+        op->next = right->next;
+        expr->first_value = op;
+        op->start_location = left->start_location;
+        op->end_location = right->end_location;
+        op->slots[expr->left_slot_index] = (finish_node((left)->rule, (left)->choice_index, op->slots[expr->left_slot_index], (left)->slots, (left)->start_location, (left)->end_location, s->info));
+        op->slots[expr->right_slot_index] = (finish_node((right)->rule, (right)->choice_index, op->slots[expr->right_slot_index], (right)->slots, (right)->start_location, (right)->end_location, s->info));
+        construct_node_free(s, left);
+        construct_node_free(s, right);
+    }
+    else {
+        expr->first_operator = op->next;
+        struct construct_node *value = expr->first_value;
+        op->next = value->next;
+        expr->first_value = op;
+        if (value->start_location < op->start_location) op->start_location = value->start_location;
+        if (value->end_location > op->end_location) op->end_location = value->end_location;
+        op->slots[expr->operand_slot_index] = (finish_node((value)->rule, (value)->choice_index, op->slots[expr->operand_slot_index], (value)->slots, (value)->start_location, (value)->end_location, s->info));
+        construct_node_free(s, value);
+    }
+}
+static void construct_begin(struct construct_state *s, size_t offset, enum construct_root_type type) {
+    s->root_type = type;
+    uint32_t r = 0;
+    if (type == CONSTRUCT_EXPRESSION_ROOT) {
+        struct construct_expression *expr = construct_expression_alloc(s, r);
+        expr->parent = s->current_expression;
+        s->current_expression = expr;
+    }
+    else {
+        struct construct_node *node = construct_node_alloc(s, r);
+        node->next = s->under_construction;
+        node->end_location = offset;
+        s->under_construction = node;
+    }
+}
+static size_t construct_finish(struct construct_state *s, size_t offset) {
+    size_t finished = 0;
+    if (s->root_type == CONSTRUCT_EXPRESSION_ROOT) {
+        struct construct_expression *expr = s->current_expression;
+        s->current_expression = expr->parent;
+        while (expr->first_operator) construct_expression_reduce(s, expr);
+        struct construct_node *node = expr->first_value;
+        if (node) {
+            finished = (finish_node((node)->rule, (node)->choice_index, 0, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+            assert(node->next == 0);
+            construct_node_free(s, node);
+        }
+        construct_expression_free(s, expr);
+    }
+    else {
+        struct construct_node *node = s->under_construction;
+        s->under_construction = node->next;
+        node->start_location = offset;
+        finished = (finish_node((node)->rule, (node)->choice_index, 0, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+        construct_node_free(s, node);
+    }
+    return finished;
+}
+static void construct_free_pools(struct construct_state *s) {
+    while (s->node_freelist) {
+        struct construct_node *node = s->node_freelist;
+        s->node_freelist = node->next;
+        free_memory(node->slots, node->slots_capacity * sizeof(size_t), s->allocator);
+        free_memory(node, sizeof(struct construct_node), s->allocator);
+    }
+    while (s->expression_freelist) {
+        struct construct_expression *expr = s->expression_freelist;
+        s->expression_freelist = expr->parent;
+        free_memory(expr, sizeof(struct construct_expression), s->allocator);
+    }
+}
+static void construct_action_apply(struct construct_state *s, uint16_t action, size_t offset) {
+    switch ((((action) >> 12) & 0xf)) {
+    case 8:
+        {
+            struct construct_node *node = construct_node_alloc(s, rule_lookup(s->under_construction->rule, ((action) & 0xfff), s->info));
+            node->next = s->under_construction;
+            node->slot_index = ((action) & 0xfff);
+            node->end_location = offset;
+            s->under_construction = node;
+            break;
+        }
+    case 9:
+        {
+            struct construct_expression *expr = construct_expression_alloc(s, rule_lookup(s->under_construction->rule, ((action) & 0xfff), s->info));
+            expr->parent = s->current_expression;
+            s->current_expression = expr;
+            expr->slot_index = ((action) & 0xfff);
+            break;
+        }
+    case 1:
+        {
+            struct construct_node *node = s->under_construction;
+            node->start_location = offset;
+            s->under_construction = node->next;
+            size_t *finished;
+            finished = &s->under_construction->slots[node->slot_index];
+            *finished = (finish_node((node)->rule, (node)->choice_index, *finished, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+            construct_node_free(s, node);
+            break;
+        }
+    case 2:
+        {
+            struct construct_expression *expr = s->current_expression;
+            s->current_expression = expr->parent;
+            while (expr->first_operator) construct_expression_reduce(s, expr);
+            size_t *finished;
+            finished = &s->under_construction->slots[expr->slot_index];
+            struct construct_node *node = expr->first_value;
+            if (node) {
+                *finished = (finish_node((node)->rule, (node)->choice_index, *finished, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+                assert(node->next == 0);
+                construct_node_free(s, node);
+            }
+            construct_expression_free(s, expr);
+            break;
+        }
+    case 3:
+        s->under_construction->choice_index = ((action) & 0xfff);
+        break;
+    case 4:
+        {
+            uint16_t slot = ((action) & 0xfff);
+            size_t *finished = &s->under_construction->slots[slot];
+            *finished = finish_token(rule_lookup(s->under_construction->rule, slot, s->info), *finished, s->info);
+            break;
+        }
+    case 10:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = construct_node_alloc(s, expr->rule);
+            node->choice_index = ((action) & 0xfff);
+            node->end_location = offset;
+            node->rule = expr->rule;
+            node->next = s->under_construction;
+            s->under_construction = node;
+            break;
+        }
+    case 11:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = construct_node_alloc(s, expr->rule);
+            node->choice_index = ((action) & 0xfff);
+            node->end_location = offset;
+            node->rule = expr->rule;
+            enum construct_fixity_associativity fixity_associativity = 0;
+            int precedence = 0;
+            do {
+                int local = 0;
+                fixity_associativity_precedence_lookup(&local, &precedence, expr->rule, ((action) & 0xfff), s->info);
+                fixity_associativity = local;
+            }
+            while (0);
+            node->fixity_associativity = fixity_associativity;
+            node->precedence = precedence;
+            node->next = s->under_construction;
+            s->under_construction = node;
+            break;
+        }
+    case 5:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = s->under_construction;
+            node->start_location = offset;
+            s->under_construction = node->next;
+            node->next = expr->first_value;
+            expr->first_value = node;
+            break;
+        }
+    case 6:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = s->under_construction;
+            node->start_location = offset;
+            s->under_construction = node->next;
+            while (construct_expression_should_reduce(s, expr, node)) construct_expression_reduce(s, expr);
+            node->next = expr->first_operator;
+            expr->first_operator = node;
+            if (node->fixity_associativity == CONSTRUCT_PREFIX) construct_expression_reduce(s, expr);
+            break;
+        }
+    }
+}
+
+struct fill_run_continuation;
+struct fill_run_state {
+    uint32_t state;
+    uint32_t reachability_mask[1];
+    struct fill_run_continuation *cont;
+};
+struct fill_run_continuation {
+    struct fill_run_state *stack;
+    size_t top_index;
+    size_t capacity;
+    // -1 if a reachability check failed on the token before this one, 2 if a
+    // bracket ended with nothing below it on the stack, or 1 for any other
+    // error.
+    int error;
+    struct owl_allocator *allocator;
+};
+static struct fill_run_state *bracket_entry_state(struct fill_run_continuation *cont, uint32_t mask0) {
+    cont->top_index++;
+    if (cont->top_index >= cont->capacity) {
+        size_t new_capacity = (cont->capacity + 2) * 3 / 2;
+        if (new_capacity <= cont->capacity)
+            abort();
+        struct fill_run_state *new_states = reallocate_memory(cont->stack, cont->capacity * sizeof(struct fill_run_state), new_capacity * sizeof(struct fill_run_state), cont->allocator);
+        if (!new_states)
+            abort();
+        cont->stack = new_states;
+        cont->capacity = new_capacity;
+    }
+    struct fill_run_state *top = &cont->stack[cont->top_index];
+    top->cont = cont;
+    top->reachability_mask[0] = mask0;
+    return top;
+}
+static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index) {
+    uint16_t token_index = 0;
+    uint16_t number_of_tokens = run->number_of_tokens;
+    struct fill_run_state *top = &cont->stack[cont->top_index];
+    uint32_t state = top->state;
+    if (number_of_tokens == 0)
+        return true;
+dispatch:
+    switch (state) {
+    case 0: goto state_0;
+    case 1: goto state_1;
+    case 2: goto state_2;
+    case 3: goto state_2;
+    case 4: goto state_2;
+    case 5: goto state_2;
+    case 6: goto state_2;
+    case 7: goto state_2;
+    case 8: goto state_2;
+    case 9: goto state_2;
+    case 10: goto state_10;
+    case 11: goto state_11;
+    case 12: goto state_12;
+    case 13: goto state_13;
+    case 14: goto state_14;
+    case 15: goto state_15;
+    case 16: goto state_15;
+    case 17: goto state_15;
+    case 18: goto state_15;
+    case 19: goto state_15;
+    case 20: goto state_15;
+    case 21: goto state_15;
+    case 22: goto state_22;
+    case 23: goto state_23;
+    case 24: goto state_15;
+    case 25: goto state_15;
+    case 26: goto state_15;
+    case 27: goto state_15;
+    case 28: goto state_15;
+    case 29: goto state_15;
+    case 30: goto state_15;
+    case 31: goto state_15;
+    case 32: goto state_15;
+    case 33: goto state_33;
+    case 34: goto state_34;
+    case 35: goto state_35;
+    case 36: goto state_36;
+    case 37: goto state_37;
+    case 38: goto state_37;
+    case 39: goto state_37;
+    case 40: goto state_37;
+    case 41: goto state_37;
+    case 42: goto state_37;
+    case 43: goto state_37;
+    case 44: goto state_44;
+    case 45: goto state_45;
+    case 46: goto state_37;
+    default: abort();
+    }
+state_2:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_1:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 11: state = 9; if (++token_index < number_of_tokens) goto state_2; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_45:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 0: state = 35; if (++token_index < number_of_tokens) goto state_35; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_44:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 10: state = 45; if (++token_index < number_of_tokens) goto state_45; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_36:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 11: state = 46; if (++token_index < number_of_tokens) goto state_37; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_23:
+    run->states[token_index] = state;
+    if (!(2 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 11: state = 31; if (++token_index < number_of_tokens) goto state_15; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_14:
+    run->states[token_index] = state;
+    if (!(2 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 11: state = 32; if (++token_index < number_of_tokens) goto state_15; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_37:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 1: state = 44; if (++token_index < number_of_tokens) goto state_44; goto done;
+    case 3: state = 33; if (++token_index < number_of_tokens) goto state_33; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_11:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 3: state = 33; if (++token_index < number_of_tokens) goto state_33; goto done;
+    case 10: state = 34; if (++token_index < number_of_tokens) goto state_34; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_15:
+    run->states[token_index] = state;
+    if (!(2 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 1: state = 22; if (++token_index < number_of_tokens) goto state_22; goto done;
+    case 5: state = 13; if (++token_index < number_of_tokens) goto state_13; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_10:
+    run->states[token_index] = state;
+    if (!(3 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 2: state = 11; if (++token_index < number_of_tokens) goto state_11; goto done;
+    case 4: state = 12; if (++token_index < number_of_tokens) goto state_12; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_0:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 6: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 7: state = 2; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 8: state = 3; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 9: state = 4; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 10: state = 5; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 11: state = 6; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 13: state = 7; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 12: state = 8; if (++token_index < number_of_tokens) goto state_2; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 3);
+        state = 10;
+        goto state_10;
+    }
+state_22:
+    run->states[token_index] = state;
+    if (!(2 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 6: state = 23; if (++token_index < number_of_tokens) goto state_23; goto done;
+    case 7: state = 24; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 8: state = 25; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 9: state = 26; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 10: state = 27; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 11: state = 28; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 13: state = 29; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 12: state = 30; if (++token_index < number_of_tokens) goto state_15; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 3);
+        state = 10;
+        goto state_10;
+    }
+state_12:
+    run->states[token_index] = state;
+    if (!(2 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 5: state = 13; if (++token_index < number_of_tokens) goto state_13; goto done;
+    case 6: state = 14; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 7: state = 15; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 8: state = 16; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 9: state = 17; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 10: state = 18; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 11: state = 19; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 13: state = 20; if (++token_index < number_of_tokens) goto state_15; goto done;
+    case 12: state = 21; if (++token_index < number_of_tokens) goto state_15; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 3);
+        state = 10;
+        goto state_10;
+    }
+state_13:
+    run->states[token_index] = state;
+    if (cont->top_index == 0) {
+        cont->error = 2;
+        *failing_index = token_index;
+        return false;
+    }
+    cont->top_index--;
+    top--;
+    run->tokens[token_index] = 12;
+    state = top->state;
+    goto dispatch;
+state_33:
+    run->states[token_index] = state;
+    if (cont->top_index == 0) {
+        cont->error = 2;
+        *failing_index = token_index;
+        return false;
+    }
+    cont->top_index--;
+    top--;
+    run->tokens[token_index] = 13;
+    state = top->state;
+    goto dispatch;
+state_34:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 0: state = 35; if (++token_index < number_of_tokens) goto state_35; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
+    }
+state_35:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 6: state = 36; if (++token_index < number_of_tokens) goto state_36; goto done;
+    case 7: state = 37; if (++token_index < number_of_tokens) goto state_37; goto done;
+    case 8: state = 38; if (++token_index < number_of_tokens) goto state_37; goto done;
+    case 9: state = 39; if (++token_index < number_of_tokens) goto state_37; goto done;
+    case 10: state = 40; if (++token_index < number_of_tokens) goto state_37; goto done;
+    case 11: state = 41; if (++token_index < number_of_tokens) goto state_37; goto done;
+    case 13: state = 42; if (++token_index < number_of_tokens) goto state_37; goto done;
+    case 12: state = 43; if (++token_index < number_of_tokens) goto state_37; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 3);
+        state = 10;
+        goto state_10;
+    }
+done:
+    top->state = state;
+    return true;
+}
+static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index);
+struct owl_parser;
+static size_t build_parse_tree(struct owl_parser *parser);
+
+static struct owl_tree *owl_tree_create_empty(struct owl_allocator allocator) {
+    struct owl_tree *tree = allocate_memory(sizeof(struct owl_tree), &allocator);
+    if (!tree)
+        abort();
+    *tree = (struct owl_tree){ .allocator = allocator };
+    return tree;
+}
+#ifdef OWL_INDEX
+static struct rule_index *create_rule_index(struct owl_allocator *allocator) {
+    struct rule_index *index = allocate_memory(sizeof(struct rule_index), allocator);
+    if (!index)
+        abort();
+    *index = (struct rule_index){ 0 };
+    return index;
+}
+static struct location_index *create_location_index(struct owl_allocator *allocator) {
+    struct location_index *index = allocate_memory(sizeof(struct location_index), allocator);
+    if (!index)
+        abort();
+    *index = (struct location_index){ .nodes.keeps_ends = true };
+    return index;
+}
+static void free_match_list(struct match_list *list, struct owl_allocator *allocator) {
+    free_memory(list->matches, list->capacity * sizeof(struct owl_ref), allocator);
+    free_memory(list->starts, list->capacity * sizeof(size_t), allocator);
+    if (list->keeps_ends)
+        free_memory(list->ends, list->capacity * sizeof(size_t), allocator);
+    free_memory(list->late, list->late_capacity * sizeof(struct match_to_sort), allocator);
+}
+#endif
+
+// The streaming parser waits for about this many bytes of new input before
+// tokenizing again, so token runs don't end up mostly empty.
+#ifndef FEED_BATCH_SIZE
+#define FEED_BATCH_SIZE 16384
+#endif
+#ifdef OWL_THREADS
+// Where the tokenizer was after each token run, for reporting errors in runs
+// other than the last one.
+struct run_end {
+    size_t offset;
+    size_t whitespace;
+};
+#endif
+struct owl_parser {
+    struct owl_tree *tree;
+    struct owl_allocator allocator;
+    struct owl_default_tokenizer tokenizer;
+    struct owl_token_run *token_run;
+    struct fill_run_continuation cont;
+    // The state stack and construct pools are only used while building the
+    // tree, but they're kept (along with the token runs and the fill_run stack)
+    // so later parses don't have to allocate them again.
+    uint32_t *state_stack;
+    size_t state_stack_capacity;
+    struct construct_state construct_state;
+    // Set once owl_parser_parse has built a tree, until the next reset.
+    bool finished;
+    // When validating, token runs are recycled as soon as they've been checked and
+    // no tree is built.
+    bool validating;
+    char *buffer;
+    size_t length;
+    size_t capacity;
+    size_t resume_length;
+};
+static void start_parsing(struct owl_parser *parser, struct owl_tree *tree) {
+    tree->next_offset = 4;
+    parser->tree = tree;
+    parser->tokenizer = (struct owl_default_tokenizer){
+        .info = tree,
+        .lookahead = 5,
+        .free_runs = parser->tokenizer.free_runs,
+        .allocator = &parser->allocator,
+    };
+    parser->token_run = 0;
+    parser->cont.allocator = &parser->allocator;
+    parser->construct_state.allocator = &parser->allocator;
+    if (!parser->cont.stack) {
+        parser->cont.capacity = 8;
+        parser->cont.stack = allocate_memory(parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);
+        if (!parser->cont.stack)
+            abort();
+    }
+    parser->cont.top_index = 0;
+    parser->cont.error = 0;
+    parser->cont.stack[0] = (struct fill_run_state){
+        .state = 0,
+        .cont = &parser->cont,
+    };
+}
+// Moves the parser's token runs to the tokenizer's free list.
+static void recycle_token_runs(struct owl_parser *parser) {
+    while (parser->token_run) {
+        struct owl_token_run *run = parser->token_run;
+        parser->token_run = run->prev;
+        run->prev = parser->tokenizer.free_runs;
+        parser->tokenizer.free_runs = run;
+    }
+}
+// Throws away the token runs and the token data written to the tree, which
+// aren't kept when validating.  The token lists start over too.
+static void discard_tokens(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    recycle_token_runs(parser);
+    tree->next_offset = 4;
+    tree->next_string_token_offset = 0;
+    tree->next_number_token_offset = 0;
+}
+// Frees the memory kept between parses (but not the tree or input buffer).
+static void free_parser_memory(struct owl_parser *parser) {
+    free_token_runs(&parser->token_run, &parser->allocator);
+    free_token_runs(&parser->tokenizer.free_runs, &parser->allocator);
+    free_memory(parser->cont.stack, parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);
+    free_memory(parser->state_stack, parser->state_stack_capacity * sizeof(uint32_t), &parser->allocator);
+    construct_free_pools(&parser->construct_state);
+}
+// Tokenizes as much of the text as possible, running each token run through
+// the state machine.  Set `more_input` if more text will follow `length`.
+static bool parse_text(struct owl_parser *parser, const char *text, size_t length, bool more_input) {
+    struct owl_tree *tree = parser->tree;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    tokenizer->text = text;
+    tokenizer->length = length;
+    tokenizer->more_input = more_input;
+    uint16_t failing_index = 0;
+    while (owl_default_tokenizer_advance(tokenizer, &parser->token_run)) {
+        if (!fill_run_states(parser->token_run, &parser->cont, &failing_index)) {
+            tree->error = ERROR_UNEXPECTED_TOKEN;
+            find_token_range(tokenizer, parser->token_run, failing_index, &tree->error_range.start, &tree->error_range.end);
+            return false;
+        }
+        if (parser->validating) {
+            // Only the tokenizer's position is needed to report later errors, so
+            // the run and its token data can be reused.
+            discard_tokens(parser);
+        }
+    }
+    if (tokenizer->deferred)
+        return true;
+    if (tokenizer->offset < length) {
+        tree->error = ERROR_INVALID_TOKEN;
+        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);
+        return false;
+    }
+    return true;
+}
+#ifdef OWL_THREADS
+struct speculative_base {
+    uint32_t state;
+    uint32_t reachability_mask[1];
+};
+static const struct speculative_base speculative_bases[45] = {
+    { 0, { 0 } },
+    { 1, { 0 } },
+    { 2, { 0 } },
+    { 3, { 0 } },
+    { 4, { 0 } },
+    { 5, { 0 } },
+    { 6, { 0 } },
+    { 7, { 0 } },
+    { 8, { 0 } },
+    { 9, { 0 } },
+    { 10, {3} },
+    { 11, {3} },
+    { 12, {3} },
+    { 14, {3} },
+    { 15, {3} },
+    { 16, {3} },
+    { 17, {3} },
+    { 18, {3} },
+    { 19, {3} },
+    { 20, {3} },
+    { 21, {3} },
+    { 22, {3} },
+    { 23, {3} },
+    { 24, {3} },
+    { 25, {3} },
+    { 26, {3} },
+    { 27, {3} },
+    { 28, {3} },
+    { 29, {3} },
+    { 30, {3} },
+    { 31, {3} },
+    { 32, {3} },
+    { 34, {3} },
+    { 35, {3} },
+    { 36, {3} },
+    { 37, {3} },
+    { 38, {3} },
+    { 39, {3} },
+    { 40, {3} },
+    { 41, {3} },
+    { 42, {3} },
+    { 43, {3} },
+    { 44, {3} },
+    { 45, {3} },
+    { 46, {3} },
+};
+// Inputs with fewer than twice this many token runs are checked on one thread.
+#ifndef OWL_THREAD_MIN_RUNS
+#define OWL_THREAD_MIN_RUNS 16
+#endif
+// Workers give up guessing the stack if they need more guesses than this.
+#ifndef OWL_THREAD_MAX_GUESSES
+#define OWL_THREAD_MAX_GUESSES 1024
+#endif
+// Inputs with fewer than twice this many bytes are tokenized on one thread.
+#ifndef OWL_THREAD_MIN_BYTES
+#define OWL_THREAD_MIN_BYTES (1 << 20)
+#endif
+// A worker's guess at the stack while it doesn't know what's on the real one.
+struct stack_guess {
+    struct fill_run_continuation cont;
+    // Positions count tokens as if every run were full.
+    size_t position;
+    // Set if the guess needs another frame at the bottom of its stack, because
+    // a bracket ended with nothing below it (or, if `empty` is set, because it
+    // doesn't have a stack yet).
+    bool out_of_stack;
+    bool empty;
+};
+// Tokens a worker has filled in, starting with the stack in `before` and ending
+// with the stack in `after`.  The bottom frame of `before` stands for whatever
+// frame is at that depth on the real stack; the bottom frame of `after` is the
+// same frame, in the state the stretch left it in.
+struct filled_stretch {
+    size_t start;
+    size_t end;
+    struct fill_run_state *before;
+    size_t before_depth;
+    struct fill_run_state *after;
+    size_t after_depth;
+};
+// A piece of the input for a worker thread.  The worker starts without knowing
+// the stack, so it guesses until it's sure of the top of it, then fills in
+// tokens until a bracket ends with nothing below it, then guesses again, and so
+// on.  Once the earlier pieces are done, the stretches it filled in are checked
+// against the real stack, and only the gaps between them are filled in again.
+struct parallel_chunk {
+    struct owl_token_run **runs;
+    size_t number_of_runs;
+    struct owl_allocator *allocator;
+    struct filled_stretch *stretches;
+    size_t number_of_stretches;
+    size_t stretches_capacity;
+    bool started;
+    pthread_t thread;
+    // These are only used by the worker.
+    struct fill_run_continuation cont;
+    struct stack_guess *guesses;
+    size_t number_of_guesses;
+    size_t guesses_capacity;
+    struct owl_token_run *scratch;
+};
+static void reserve_fill_run_stack(struct fill_run_continuation *cont, size_t size) {
+    if (size <= cont->capacity)
+        return;
+    struct fill_run_state *stack = reallocate_memory(cont->stack, cont->capacity * sizeof(struct fill_run_state), size * sizeof(struct fill_run_state), cont->allocator);
+    if (!stack)
+        abort();
+    cont->stack = stack;
+    cont->capacity = size;
+}
+static void copy_fill_run_stack(struct fill_run_continuation *to, const struct fill_run_state *stack, size_t depth) {
+    reserve_fill_run_stack(to, depth);
+    memcpy(to->stack, stack, depth * sizeof(struct fill_run_state));
+    for (size_t i = 0; i < depth; ++i)
+        to->stack[i].cont = to;
+    to->top_index = depth - 1;
+}
+static struct fill_run_state *save_fill_run_stack(struct fill_run_continuation *cont, struct owl_allocator *allocator) {
+    struct fill_run_state *stack = allocate_memory((cont->top_index + 1) * sizeof(struct fill_run_state), allocator);
+    if (!stack)
+        abort();
+    memcpy(stack, cont->stack, (cont->top_index + 1) * sizeof(struct fill_run_state));
+    return stack;
+}
+// Fills in the states of the tokens from position `start` up to `end`.  Unless
+// `write` is set, the tokens are copied into `scratch` first, so the runs are
+// left alone.
+static bool fill_positions(struct owl_token_run **runs, size_t start, size_t end, struct fill_run_continuation *cont, struct owl_token_run *scratch, bool write, size_t *failing_run, uint16_t *failing_index) {
+    while (start < end) {
+        size_t run_index = start / 4096;
+        struct owl_token_run *run = runs[run_index];
+        uint16_t from = start % 4096;
+        uint16_t to = run->number_of_tokens;
+        if (end - run_index * 4096 < to)
+            to = end - run_index * 4096;
+        bool ok;
+        cont->error = 0;
+        if (write && from == 0 && to == run->number_of_tokens)
+            ok = fill_run_states(run, cont, failing_index);
+        else {
+            memcpy(scratch->tokens, run->tokens + from, (to - from) * sizeof(run->tokens[0]));
+            scratch->number_of_tokens = to - from;
+            ok = fill_run_states(scratch, cont, failing_index);
+            if (write) {
+                memcpy(run->tokens + from, scratch->tokens, (to - from) * sizeof(run->tokens[0]));
+                memcpy(run->states + from, scratch->states, (to - from) * sizeof(run->states[0]));
+            }
+            *failing_index += from;
+        }
+        if (!ok) {
+            *failing_run = run_index;
+            return false;
+        }
+        if (to == run->number_of_tokens)
+            start = (run_index + 1) * 4096;
+        else
+            start = run_index * 4096 + to;
+    }
+    return true;
+}
+// The position `count` tokens after `position`, or the end of the chunk.
+static size_t position_after(struct parallel_chunk *chunk, size_t position, size_t count) {
+    size_t run = position / 4096;
+    size_t index = position % 4096 + count;
+    while (run < chunk->number_of_runs && index >= chunk->runs[run]->number_of_tokens) {
+        index -= chunk->runs[run]->number_of_tokens;
+        run++;
+    }
+    if (run == chunk->number_of_runs)
+        return run * 4096;
+    return run * 4096 + index;
+}
+static struct stack_guess *add_guess(struct parallel_chunk *chunk) {
+    if (chunk->number_of_guesses >= chunk->guesses_capacity) {
+        size_t new_capacity = (chunk->guesses_capacity + 2) * 3 / 2;
+        struct stack_guess *guesses = reallocate_memory(chunk->guesses, chunk->guesses_capacity * sizeof(struct stack_guess), new_capacity * sizeof(struct stack_guess), chunk->allocator);
+        if (!guesses)
+            abort();
+        for (size_t i = chunk->guesses_capacity; i < new_capacity; ++i)
+            guesses[i] = (struct stack_guess){ .cont.allocator = chunk->allocator };
+        chunk->guesses = guesses;
+        chunk->guesses_capacity = new_capacity;
+    }
+    struct stack_guess *guess = &chunk->guesses[chunk->number_of_guesses++];
+    guess->out_of_stack = false;
+    guess->empty = false;
+    return guess;
+}
+static void start_guessing(struct parallel_chunk *chunk, size_t start, bool empty) {
+    chunk->number_of_guesses = 0;
+    struct stack_guess *guess = add_guess(chunk);
+    if (!empty)
+        copy_fill_run_stack(&guess->cont, chunk->cont.stack, chunk->cont.top_index + 1);
+    guess->position = start;
+    guess->out_of_stack = true;
+    guess->empty = empty;
+}
+static void put_base_below(struct stack_guess *guess, const struct speculative_base *base) {
+    size_t depth = guess->empty ? 0 : guess->cont.top_index + 1;
+    reserve_fill_run_stack(&guess->cont, depth + 1);
+    memmove(guess->cont.stack + 1, guess->cont.stack, depth * sizeof(struct fill_run_state));
+    guess->cont.stack[0].state = base->state;
+    memcpy(guess->cont.stack[0].reachability_mask, base->reachability_mask, sizeof(base->reachability_mask));
+    guess->cont.top_index = depth;
+    guess->out_of_stack = false;
+    guess->empty = false;
+}
+static void fork_guess(struct parallel_chunk *chunk, size_t from, const struct speculative_base *base) {
+    struct stack_guess *guess = add_guess(chunk);
+    struct stack_guess *parent = &chunk->guesses[from];
+    size_t depth = parent->empty ? 0 : parent->cont.top_index + 1;
+    reserve_fill_run_stack(&guess->cont, depth + 1);
+    // An empty guess may not have a stack to copy from.
+    if (depth > 0)
+        memcpy(guess->cont.stack, parent->cont.stack, depth * sizeof(struct fill_run_state));
+    guess->cont.top_index = parent->cont.top_index;
+    guess->position = parent->position;
+    guess->empty = parent->empty;
+    put_base_below(guess, base);
+}
+// Runs the guesses up to position `end`.  Guesses which fail are dropped, and
+// guesses which run out of stack fork into a guess for each speculative base
+// below them.  Returns false if there would be too many guesses.
+static bool advance_guesses(struct parallel_chunk *chunk, size_t end) {
+    size_t i = 0;
+    while (i < chunk->number_of_guesses) {
+        struct stack_guess *guess = &chunk->guesses[i];
+        if (guess->position >= end) {
+            i++;
+            continue;
+        }
+        if (guess->out_of_stack) {
+            if (chunk->number_of_guesses > 1 && chunk->number_of_guesses + 45 - 1 > OWL_THREAD_MAX_GUESSES)
+                return false;
+            for (size_t j = 1; j < 45; ++j)
+                fork_guess(chunk, i, &speculative_bases[j]);
+            put_base_below(&chunk->guesses[i], &speculative_bases[0]);
+            continue;
+        }
+        for (size_t j = 0; j <= guess->cont.top_index; ++j)
+            guess->cont.stack[j].cont = &guess->cont;
+        size_t failing_run;
+        uint16_t failing_index;
+        if (fill_positions(chunk->runs, guess->position, end, &guess->cont, chunk->scratch, false, &failing_run, &failing_index))
+            guess->position = end;
+        else if (guess->cont.error == 2) {
+            guess->position = failing_run * 4096 + failing_index;
+            guess->out_of_stack = true;
+        } else {
+            // Swap the failed guess with the last one, so its stack can be
+            // reused.
+            struct stack_guess failed = *guess;
+            *guess = chunk->guesses[--chunk->number_of_guesses];
+            chunk->guesses[chunk->number_of_guesses] = failed;
+        }
+    }
+    return true;
+}
+// Returns the guess all the guesses agree with, if they agree on everything
+// but the mask at the bottom of the stack.  That mask becomes the bits they
+// all share: reachability checks which pass with it pass with each of theirs.
+static struct stack_guess *agreed_guess(struct parallel_chunk *chunk) {
+    struct stack_guess *agreed = &chunk->guesses[0];
+    for (size_t i = 0; i < chunk->number_of_guesses; ++i) {
+        struct stack_guess *guess = &chunk->guesses[i];
+        if (guess->out_of_stack || guess->cont.top_index != agreed->cont.top_index)
+            return 0;
+        for (size_t j = 0; j <= agreed->cont.top_index; ++j) {
+            if (guess->cont.stack[j].state != agreed->cont.stack[j].state)
+                return 0;
+            if (j > 0 && memcmp(guess->cont.stack[j].reachability_mask, agreed->cont.stack[j].reachability_mask, sizeof(agreed->cont.stack[j].reachability_mask)))
+                return 0;
+        }
+    }
+    for (size_t i = 1; i < chunk->number_of_guesses; ++i) {
+        for (int j = 0; j < 1; ++j)
+            agreed->cont.stack[0].reachability_mask[j] &= chunk->guesses[i].cont.stack[0].reachability_mask[j];
+    }
+    return agreed;
+}
+// Guesses the stack from `start`, where the worker's stack has run out (or,
+// with `empty`, where the worker doesn't have a stack yet).  The guesses run
+// over longer and longer windows until they agree.  If they don't, or there
+// are too many of them, the worker starts guessing again further on.  Returns
+// the position where the guesses agreed, with the agreed stack in the worker's
+// cont, or the end of the chunk if they never did.
+static size_t guess_stack(struct parallel_chunk *chunk, size_t start, bool empty) {
+    size_t chunk_end = chunk->number_of_runs * 4096;
+    size_t window = 16;
+    start_guessing(chunk, start, empty);
+    while (true) {
+        size_t end = position_after(chunk, start, window);
+        bool ok = advance_guesses(chunk, end);
+        if (end == chunk_end || chunk->number_of_guesses == 0)
+            return chunk_end;
+        struct stack_guess *agreed = ok ? agreed_guess(chunk) : 0;
+        if (agreed) {
+            copy_fill_run_stack(&chunk->cont, agreed->cont.stack, agreed->cont.top_index + 1);
+            return end;
+        }
+        if (ok && window < 16384)
+            window *= 4;
+        else {
+            // Bracket symbol placeholders are only ever seen by the state
+            // which ends a bracket, so guessing can't start at one.
+            start = end;
+            if (chunk->runs[start / 4096]->tokens[start % 4096] == 4294967295U)
+                start = position_after(chunk, start, 1);
+            window = 16;
+            start_guessing(chunk, start, true);
+        }
+    }
+}
+static void *check_chunk(void *data) {
+    struct parallel_chunk *chunk = data;
+    size_t chunk_end = chunk->number_of_runs * 4096;
+    chunk->scratch = allocate_memory(sizeof(struct owl_token_run), chunk->allocator);
+    if (!chunk->scratch)
+        abort();
+    size_t position = guess_stack(chunk, 0, true);
+    while (position < chunk_end) {
+        struct filled_stretch stretch = {
+            .start = position,
+            .before = save_fill_run_stack(&chunk->cont, chunk->allocator),
+            .before_depth = chunk->cont.top_index + 1,
+        };
+        size_t failing_run;
+        uint16_t failing_index;
+        bool ok = fill_positions(chunk->runs, position, chunk_end, &chunk->cont, chunk->scratch, true, &failing_run, &failing_index);
+        if (!ok && chunk->cont.error != 2) {
+            // This is either a real error or a bad guess; either way, it's
+            // left for the sequential pass.
+            free_memory(stretch.before, stretch.before_depth * sizeof(struct fill_run_state), chunk->allocator);
+            break;
+        }
+        stretch.end = ok ? chunk_end : failing_run * 4096 + failing_index;
+        stretch.after = save_fill_run_stack(&chunk->cont, chunk->allocator);
+        stretch.after_depth = chunk->cont.top_index + 1;
+        if (chunk->number_of_stretches >= chunk->stretches_capacity) {
+            size_t new_capacity = (chunk->stretches_capacity + 2) * 3 / 2;
+            struct filled_stretch *stretches = reallocate_memory(chunk->stretches, chunk->stretches_capacity * sizeof(struct filled_stretch), new_capacity * sizeof(struct filled_stretch), chunk->allocator);
+            if (!stretches)
+                abort();
+            chunk->stretches = stretches;
+            chunk->stretches_capacity = new_capacity;
+        }
+        chunk->stretches[chunk->number_of_stretches++] = stretch;
+        if (ok)
+            break;
+        position = guess_stack(chunk, stretch.end, false);
+    }
+    for (size_t i = 0; i < chunk->guesses_capacity; ++i)
+        free_memory(chunk->guesses[i].cont.stack, chunk->guesses[i].cont.capacity * sizeof(struct fill_run_state), chunk->allocator);
+    free_memory(chunk->guesses, chunk->guesses_capacity * sizeof(struct stack_guess), chunk->allocator);
+    free_memory(chunk->cont.stack, chunk->cont.capacity * sizeof(struct fill_run_state), chunk->allocator);
+    free_memory(chunk->scratch, sizeof(struct owl_token_run), chunk->allocator);
+    return 0;
+}
+// Checks whether the top of the real stack matches the stack a stretch started
+// with, so filling it in from the real stack would do exactly what the worker
+// did.  The real frame at the bottom can have more mask bits than the guess.
+static bool stretch_matches(struct fill_run_continuation *cont, struct filled_stretch *stretch) {
+    if (cont->top_index + 1 < stretch->before_depth)
+        return false;
+    struct fill_run_state *top = cont->stack + cont->top_index + 1 - stretch->before_depth;
+    for (size_t i = 0; i < stretch->before_depth; ++i) {
+        if (top[i].state != stretch->before[i].state)
+            return false;
+        for (int j = 0; j < 1; ++j) {
+            uint32_t bits = stretch->before[i].reachability_mask[j];
+            uint32_t real_bits = top[i].reachability_mask[j];
+            if (i == 0 ? (real_bits & bits) != bits : real_bits != bits)
+                return false;
+        }
+    }
+    return true;
+}
+static void take_stretch_stack(struct fill_run_continuation *cont, struct filled_stretch *stretch) {
+    size_t base = cont->top_index + 1 - stretch->before_depth;
+    reserve_fill_run_stack(cont, base + stretch->after_depth);
+    cont->stack[base].state = stretch->after[0].state;
+    for (size_t i = 1; i < stretch->after_depth; ++i) {
+        cont->stack[base + i] = stretch->after[i];
+        cont->stack[base + i].cont = cont;
+    }
+    cont->top_index = base + stretch->after_depth - 1;
+}
+// Puts back the bracket placeholders a worker replaced with bracket symbols
+// while filling in a stretch.
+static void restore_bracket_placeholders(struct owl_token_run **runs, size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+        struct owl_token_run *run = runs[i / 4096];
+        if (i % 4096 >= run->number_of_tokens) {
+            i = (i / 4096 + 1) * 4096 - 1;
+            continue;
+        }
+        if (run->tokens[i % 4096] >= 12)
+            run->tokens[i % 4096] = 4294967295U;
+    }
+}
+static void add_run_end(struct run_end **ends, size_t *number_of_runs, size_t *capacity, struct run_end end, struct owl_allocator *allocator) {
+    if (*number_of_runs >= *capacity) {
+        size_t new_capacity = (*capacity + 2) * 3 / 2;
+        struct run_end *new_ends = reallocate_memory(*ends, *capacity * sizeof(struct run_end), new_capacity * sizeof(struct run_end), allocator);
+        if (!new_ends)
+            abort();
+        *ends = new_ends;
+        *capacity = new_capacity;
+    }
+    (*ends)[(*number_of_runs)++] = end;
+}
+// Tokenizes until the tokenizer reaches its `stop` (or the end of the text, or
+// an invalid token).
+static void tokenize_runs(struct owl_parser *parser, struct run_end **ends, size_t *number_of_runs, size_t *capacity) {
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    while (owl_default_tokenizer_advance(tokenizer, &parser->token_run))
+        add_run_end(ends, number_of_runs, capacity, (struct run_end){ tokenizer->offset, tokenizer->whitespace }, &parser->allocator);
+}
+// Writes the token data from a worker's log into the tree.
+static void replay_token_log(struct owl_tree *tree, struct token_log *log, const char *text, size_t start, size_t end) {
+    (void)text;
+    for (size_t i = start; i < end; ++i) {
+        struct logged_token token = log->tokens[i];
+        switch (token.kind) {
+        case LOGGED_NUMBER_TOKEN: {
+            union { double n; uint64_t v; } u = { .v = token.data };
+            write_number_token(token.offset, token.length, u.n, tree);
+            break;
+        }
+        case LOGGED_STRING_TOKEN:
+            if (token.has_escapes) {
+                char *string = allocate_string_contents(token.extra, tree);
+                memcpy(string, log->strings + token.data, token.extra);
+                write_string_token(token.offset, token.length, string, token.extra, true, tree);
+            } else
+                write_string_token(token.offset, token.length, text + token.offset + 1, token.extra, false, tree);
+            break;
+        default:
+            break;
+        }
+    }
+}
+// Workers start their tokenizers with this much whitespace, so the whitespace
+// before their first token takes as many bytes as any length can.  Once the
+// real amount is known, it's written over the top (see set_first_whitespace).
+#define UNKNOWN_WHITESPACE (SIZE_MAX / 2 + 1)
+static void set_first_whitespace(struct owl_token_run *run, size_t whitespace) {
+    // Skip over the first token's length.
+    uint16_t start = 1;
+    while (run->lengths[start] & 0x80)
+        start++;
+    uint16_t end = start + 1;
+    while (end < run->lengths_size && (run->lengths[end] & 0x80))
+        end++;
+    size_t value = 0;
+    for (uint16_t i = end; i > start; --i)
+        value = value << 7 | (run->lengths[i - 1] & 0x7f);
+    value = value - UNKNOWN_WHITESPACE + whitespace;
+    // Higher groups of zeros pad the new value out to the same size.
+    for (uint16_t i = start; i < end; ++i) {
+        run->lengths[i] = (i > start ? 0x80 : 0) | (value & 0x7f);
+        value >>= 7;
+    }
+}
+// A token run from a worker, with where the worker's tokenizer was before and
+// after it.
+struct tokenized_run {
+    struct owl_token_run *run;
+    struct run_end start;
+    struct run_end end;
+    // The run's token data starts at this index in the worker's log.
+    size_t first_logged_token;
+};
+// A range of the text for a worker thread to tokenize.  The worker doesn't know
+// where tokens start in the range, so it guesses.  Its runs are only used if
+// the main thread's tokenizer (which knows where it is) reaches the start of
+// one in the same state -- after that, both tokenizers see the same tokens.
+struct tokenized_range {
+    const char *text;
+    size_t start;
+    size_t end;
+    // The number of double quotes in the range which don't follow a backslash,
+    // and whether the range starts inside a double-quoted string.
+    size_t quotes;
+    bool in_string;
+    struct owl_default_tokenizer tokenizer;
+    // A copy of the tree which writes its token data to `log`.
+    struct owl_tree tree;
+    struct token_log log;
+    struct tokenized_run *runs;
+    size_t number_of_runs;
+    size_t runs_capacity;
+    bool started;
+    pthread_t thread;
+};
+// Counts the double quotes in [start, end) which don't follow a backslash.
+// Comments and single-quoted strings aren't taken into account, so this is only
+// an estimate of how many strings start or end in the range.
+static size_t count_quotes(const char *text, size_t start, size_t end) {
+    size_t count = 0;
+    size_t offset = start;
+#ifdef OWL_SIMD
+    // Like simdjson, make a mask of the quotes and a mask of the bytes after
+    // backslashes for each block.
+    uint32_t escaped = offset > 0 && text[offset - 1] == '\\';
+    while (offset + 16 <= end) {
+        vector_bytes_sse2 x;
+        memcpy(&x, text + offset, 16);
+        uint32_t quotes = (uint32_t)__builtin_ia32_pmovmskb128(vector_equal_sse2(x, '"'));
+        uint32_t backslashes = (uint32_t)__builtin_ia32_pmovmskb128(vector_equal_sse2(x, '\\'));
+        count += (size_t)__builtin_popcount(quotes & ~(backslashes << 1 | escaped));
+        escaped = backslashes >> 15;
+        offset += 16;
+    }
+#endif
+    for (; offset < end; ++offset) {
+        if (text[offset] == '"' && (offset == 0 || text[offset - 1] != '\\'))
+            count++;
+    }
+    return count;
+}
+static void *count_range_quotes(void *data) {
+    struct tokenized_range *range = data;
+    range->quotes = count_quotes(range->text, range->start, range->end);
+    return 0;
+}
+// Guesses where a token starts in [offset, end): at the start of a line (after
+// its indentation), or where a string starts or ends.  Returns `end` if there's
+// nowhere to guess.
+static size_t guess_token_start(const char *text, size_t offset, size_t end, bool in_string) {
+    for (; offset < end; ++offset) {
+        if (text[offset] == '"' && (offset == 0 || text[offset - 1] != '\\')) {
+            return in_string ? offset + 1 : offset;
+        }
+        if (!in_string && text[offset] == '\n') {
+            offset++;
+            size_t whitespace;
+            while (offset < end && (whitespace = read_whitespace(text + offset, end - offset, 0)) > 0)
+                offset += whitespace;
+            return offset < end ? offset : end;
+        }
+    }
+    return end;
+}
+static void *tokenize_range(void *data) {
+    struct tokenized_range *range = data;
+    struct owl_default_tokenizer *tokenizer = &range->tokenizer;
+    size_t limit = tokenizer->stop ? tokenizer->stop : tokenizer->length;
+    size_t offset = range->start;
+    while (offset < limit) {
+        tokenizer->offset = offset;
+        tokenizer->whitespace = UNKNOWN_WHITESPACE;
+        for (;;) {
+            struct tokenized_run t = {
+                .start = { tokenizer->offset, tokenizer->whitespace },
+                .first_logged_token = range->log.number_of_tokens,
+            };
+            if (!owl_default_tokenizer_advance(tokenizer, &t.run))
+                break;
+            t.end = (struct run_end){ tokenizer->offset, tokenizer->whitespace };
+            if (range->number_of_runs >= range->runs_capacity) {
+                size_t capacity = (range->runs_capacity + 8) * 2;
+                struct tokenized_run *runs = reallocate_memory(range->runs, range->runs_capacity * sizeof(struct tokenized_run), capacity * sizeof(struct tokenized_run), tokenizer->allocator);
+                if (!runs)
+                    abort();
+                range->runs = runs;
+                range->runs_capacity = capacity;
+            }
+            range->runs[range->number_of_runs++] = t;
+        }
+        if (tokenizer->offset >= limit)
+            break;
+        // Either the guess was wrong or the text has an invalid token here.  In
+        // case it was the guess, guess again further on.
+        offset = guess_token_start(range->text, tokenizer->offset + 1, limit, false);
+    }
+    return 0;
+}
+// Tokenizes the text into the parser's token runs, with the tokenizer ending up
+// where it would have if it had tokenized the text by itself.  The text is
+// split into ranges; worker threads tokenize all of them but the first, while
+// this thread tokenizes the first, then goes through the workers' runs in order.
+static void tokenize_in_parallel(struct owl_parser *parser, const char *text, size_t length, unsigned threads, struct run_end **ends, size_t *number_of_runs, size_t *capacity) {
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    size_t number_of_ranges = length / OWL_THREAD_MIN_BYTES;
+    if (number_of_ranges > threads)
+        number_of_ranges = threads;
+    if (number_of_ranges < 2) {
+        tokenize_runs(parser, ends, number_of_runs, capacity);
+        return;
+    }
+    struct owl_tree tree_before = *parser->tree;
+    struct tokenized_range *ranges = allocate_memory(number_of_ranges * sizeof(struct tokenized_range), &parser->allocator);
+    if (!ranges)
+        abort();
+    for (size_t i = 0; i < number_of_ranges; ++i) {
+        ranges[i] = (struct tokenized_range){
+            .text = text,
+            .start = length * i / number_of_ranges,
+            .end = length * (i + 1) / number_of_ranges,
+        };
+    }
+    // Which ranges start inside strings depends on the quotes in all the ranges
+    // before them (but not the last one).
+    for (size_t i = 1; i + 1 < number_of_ranges; ++i) {
+        ranges[i].started = pthread_create(&ranges[i].thread, 0, count_range_quotes, &ranges[i]) == 0;
+        if (!ranges[i].started)
+            count_range_quotes(&ranges[i]);
+    }
+    count_range_quotes(&ranges[0]);
+    for (size_t i = 1; i < number_of_ranges; ++i) {
+        struct tokenized_range *before = &ranges[i - 1];
+        if (before->started)
+            pthread_join(before->thread, 0);
+        before->started = false;
+        ranges[i].in_string = before->in_string != (before->quotes % 2 == 1);
+    }
+    for (size_t i = 1; i < number_of_ranges; ++i)
+        ranges[i].start = guess_token_start(text, ranges[i].start, ranges[i].end, ranges[i].in_string);
+    for (size_t i = 1; i < number_of_ranges; ++i) {
+        struct tokenized_range *range = &ranges[i];
+        range->log = (struct token_log){
+            .discard = parser->validating,
+            .allocator = &parser->allocator,
+        };
+        range->tree = *parser->tree;
+        range->tree.token_log = &range->log;
+        range->tokenizer = *tokenizer;
+        range->tokenizer.info = &range->tree;
+        range->tokenizer.free_runs = 0;
+        range->tokenizer.stop = i + 1 < number_of_ranges ? ranges[i + 1].start : 0;
+        range->started = pthread_create(&range->thread, 0, tokenize_range, range) == 0;
+    }
+    bool failed = false;
+    for (size_t i = 1; i < number_of_ranges; ++i) {
+        struct tokenized_range *range = &ranges[i];
+        if (!failed) {
+            tokenizer->stop = range->start;
+            tokenize_runs(parser, ends, number_of_runs, capacity);
+            failed = tokenizer->offset < tokenizer->stop;
+        }
+        if (range->started)
+            pthread_join(range->thread, 0);
+        for (size_t j = 0; j < range->number_of_runs; ++j) {
+            struct tokenized_run *t = &range->runs[j];
+            if (!failed && tokenizer->offset < t->start.offset) {
+                tokenizer->stop = t->start.offset;
+                tokenize_runs(parser, ends, number_of_runs, capacity);
+                failed = tokenizer->offset < tokenizer->stop;
+            }
+            bool unknown_whitespace = t->start.whitespace >= UNKNOWN_WHITESPACE;
+            if (failed || tokenizer->offset != t->start.offset || (!unknown_whitespace && tokenizer->whitespace != t->start.whitespace)) {
+                t->run->prev = tokenizer->free_runs;
+                tokenizer->free_runs = t->run;
+                continue;
+            }
+            if (unknown_whitespace)
+                set_first_whitespace(t->run, tokenizer->whitespace);
+            size_t end = j + 1 < range->number_of_runs ? t[1].first_logged_token : range->log.number_of_tokens;
+            replay_token_log(parser->tree, &range->log, text, t->first_logged_token, end);
+            t->run->prev = parser->token_run;
+            parser->token_run = t->run;
+            add_run_end(ends, number_of_runs, capacity, t->end, &parser->allocator);
+            tokenizer->offset = t->end.offset;
+            tokenizer->whitespace = t->end.whitespace;
+        }
+        free_memory(range->runs, range->runs_capacity * sizeof(struct tokenized_run), &parser->allocator);
+        free_token_runs(&range->tokenizer.free_runs, &parser->allocator);
+        free_token_log(&range->log);
+    }
+    tokenizer->stop = 0;
+    if (!failed)
+        tokenize_runs(parser, ends, number_of_runs, capacity);
+    free_memory(ranges, number_of_ranges * sizeof(struct tokenized_range), &parser->allocator);
+    if (tokenizer->offset < length) {
+        // The tokens in the run with an invalid token are never checked, so
+        // which error gets reported depends on where the runs end -- and they
+        // end in different places here than they do in parse_text.  To report
+        // the same error, start again on this thread.
+        recycle_token_runs(parser);
+        *number_of_runs = 0;
+        uint8_t *parse_tree = parser->tree->parse_tree;
+        size_t parse_tree_size = parser->tree->parse_tree_size;
+        *parser->tree = tree_before;
+        parser->tree->parse_tree = parse_tree;
+        parser->tree->parse_tree_size = parse_tree_size;
+        tokenizer->offset = 0;
+        tokenizer->whitespace = 0;
+        tokenize_runs(parser, ends, number_of_runs, capacity);
+    }
+}
+// Like parse_text, but tokenizes all the text first (see tokenize_in_parallel),
+// then splits the tokens into chunks for up to `threads` threads.
+static bool parse_text_in_parallel(struct owl_parser *parser, const char *text, size_t length, unsigned threads) {
+    struct owl_tree *tree = parser->tree;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    tokenizer->text = text;
+    tokenizer->length = length;
+    tokenizer->more_input = false;
+    struct run_end *ends = 0;
+    size_t number_of_runs = 0;
+    size_t ends_capacity = 0;
+    tokenize_in_parallel(parser, text, length, threads, &ends, &number_of_runs, &ends_capacity);
+    struct owl_token_run **runs = allocate_memory((number_of_runs + 1) * sizeof(struct owl_token_run *), &parser->allocator);
+    struct owl_token_run *scratch = allocate_memory(sizeof(struct owl_token_run), &parser->allocator);
+    if (!runs || !scratch)
+        abort();
+    struct owl_token_run *run = parser->token_run;
+    for (size_t i = number_of_runs; i > 0; --i) {
+        runs[i - 1] = run;
+        run = run->prev;
+    }
+    size_t number_of_chunks = number_of_runs / OWL_THREAD_MIN_RUNS;
+    if (number_of_chunks > threads)
+        number_of_chunks = threads;
+    if (number_of_chunks == 0)
+        number_of_chunks = 1;
+    struct parallel_chunk *chunks = allocate_memory(number_of_chunks * sizeof(struct parallel_chunk), &parser->allocator);
+    if (!chunks)
+        abort();
+    size_t first_run = 0;
+    for (size_t i = 0; i < number_of_chunks; ++i) {
+        size_t end_run = number_of_runs * (i + 1) / number_of_chunks;
+        chunks[i] = (struct parallel_chunk){
+            .runs = runs + first_run,
+            .number_of_runs = end_run - first_run,
+            .allocator = &parser->allocator,
+            .cont.allocator = &parser->allocator,
+        };
+        // The first chunk starts with the real stack, so it's filled in on
+        // this thread while the workers guess.
+        if (i > 0)
+            chunks[i].started = pthread_create(&chunks[i].thread, 0, check_chunk, &chunks[i]) == 0;
+        first_run = end_run;
+    }
+    size_t failing_run = number_of_runs;
+    uint16_t failing_index = 0;
+    for (size_t i = 0; i < number_of_chunks; ++i) {
+        struct parallel_chunk *chunk = &chunks[i];
+        if (chunk->started)
+            pthread_join(chunk->thread, 0);
+        size_t position = 0;
+        size_t chunk_failing_run = 0;
+        bool ok = failing_run == number_of_runs;
+        for (size_t j = 0; j < chunk->number_of_stretches; ++j) {
+            struct filled_stretch *stretch = &chunk->stretches[j];
+            if (ok)
+                ok = fill_positions(chunk->runs, position, stretch->start, &parser->cont, scratch, true, &chunk_failing_run, &failing_index);
+            if (ok && stretch_matches(&parser->cont, stretch)) {
+                take_stretch_stack(&parser->cont, stretch);
+                position = stretch->end;
+            } else if (ok) {
+                restore_bracket_placeholders(chunk->runs, stretch->start, stretch->end);
+                position = stretch->start;
+            }
+            free_memory(stretch->before, stretch->before_depth * sizeof(struct fill_run_state), &parser->allocator);
+            free_memory(stretch->after, stretch->after_depth * sizeof(struct fill_run_state), &parser->allocator);
+        }
+        if (ok)
+            ok = fill_positions(chunk->runs, position, chunk->number_of_runs * 4096, &parser->cont, scratch, true, &chunk_failing_run, &failing_index);
+        if (!ok && failing_run == number_of_runs)
+            failing_run = chunk->runs - runs + chunk_failing_run;
+        free_memory(chunk->stretches, chunk->stretches_capacity * sizeof(struct filled_stretch), &parser->allocator);
+    }
+    bool ok = true;
+    if (failing_run < number_of_runs) {
+        struct owl_default_tokenizer at_run = *tokenizer;
+        at_run.offset = ends[failing_run].offset;
+        at_run.whitespace = ends[failing_run].whitespace;
+        tree->error = ERROR_UNEXPECTED_TOKEN;
+        find_token_range(&at_run, runs[failing_run], failing_index, &tree->error_range.start, &tree->error_range.end);
+        ok = false;
+    } else if (tokenizer->offset < length) {
+        tree->error = ERROR_INVALID_TOKEN;
+        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);
+        ok = false;
+    }
+    free_memory(chunks, number_of_chunks * sizeof(struct parallel_chunk), &parser->allocator);
+    free_memory(scratch, sizeof(struct owl_token_run), &parser->allocator);
+    free_memory(runs, (number_of_runs + 1) * sizeof(struct owl_token_run *), &parser->allocator);
+    free_memory(ends, ends_capacity * sizeof(struct run_end), &parser->allocator);
+    if (parser->validating)
+        discard_tokens(parser);
+    return ok;
+}
+// How many token runs the tokenizer can get ahead of the state machine when
+// parsing is pipelined.
+#ifndef OWL_PIPELINE_RUNS
+#define OWL_PIPELINE_RUNS 4
+#endif
+// Token runs passed from the tokenizing thread to the thread filling in their
+// states.  `head` and `tail` count the runs taken and added so far.
+struct run_queue {
+    struct owl_parser *parser;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    struct owl_token_run *runs[OWL_PIPELINE_RUNS];
+    struct run_end ends[OWL_PIPELINE_RUNS];
+    size_t head;
+    size_t tail;
+    // Set by the tokenizing thread once the text is used up (or a token is
+    // invalid).
+    bool finished;
+    // Set by the other thread when a run has an unexpected token, so the rest
+    // of the text doesn't need to be tokenized.
+    bool stopped;
+};
+static void *tokenize_into_queue(void *arg) {
+    struct run_queue *queue = arg;
+    struct owl_parser *parser = queue->parser;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    bool more = true;
+    while (more) {
+        more = owl_default_tokenizer_advance(tokenizer, &parser->token_run);
+        pthread_mutex_lock(&queue->lock);
+        if (more) {
+            size_t slot = queue->tail % OWL_PIPELINE_RUNS;
+            queue->runs[slot] = parser->token_run;
+            queue->ends[slot] = (struct run_end){
+                .offset = tokenizer->offset,
+                .whitespace = tokenizer->whitespace,
+            };
+            queue->tail++;
+        } else
+            queue->finished = true;
+        pthread_cond_signal(&queue->not_empty);
+        while (more && queue->tail - queue->head == OWL_PIPELINE_RUNS && !queue->stopped)
+            pthread_cond_wait(&queue->not_full, &queue->lock);
+        if (queue->stopped)
+            more = false;
+        pthread_mutex_unlock(&queue->lock);
+    }
+    return 0;
+}
+// Like parse_text, but the text is tokenized on another thread while this one
+// fills in the states of the runs it has already tokenized.
+static bool parse_text_pipelined(struct owl_parser *parser, const char *text, size_t length) {
+    struct owl_tree *tree = parser->tree;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    tokenizer->text = text;
+    tokenizer->length = length;
+    tokenizer->more_input = false;
+    struct run_queue queue = { .parser = parser };
+    pthread_mutex_init(&queue.lock, 0);
+    pthread_cond_init(&queue.not_empty, 0);
+    pthread_cond_init(&queue.not_full, 0);
+    pthread_t thread;
+    if (pthread_create(&thread, 0, tokenize_into_queue, &queue) != 0) {
+        pthread_cond_destroy(&queue.not_full);
+        pthread_cond_destroy(&queue.not_empty);
+        pthread_mutex_destroy(&queue.lock);
+        return parse_text(parser, text, length, false);
+    }
+    struct owl_token_run *failing_run = 0;
+    struct run_end failing_end = { 0 };
+    uint16_t failing_index = 0;
+    while (true) {
+        pthread_mutex_lock(&queue.lock);
+        while (queue.head == queue.tail && !queue.finished)
+            pthread_cond_wait(&queue.not_empty, &queue.lock);
+        if (queue.head == queue.tail) {
+            pthread_mutex_unlock(&queue.lock);
+            break;
+        }
+        size_t slot = queue.head % OWL_PIPELINE_RUNS;
+        struct owl_token_run *run = queue.runs[slot];
+        struct run_end end = queue.ends[slot];
+        queue.head++;
+        pthread_cond_signal(&queue.not_full);
+        pthread_mutex_unlock(&queue.lock);
+        if (!fill_run_states(run, &parser->cont, &failing_index)) {
+            failing_run = run;
+            failing_end = end;
+            pthread_mutex_lock(&queue.lock);
+            queue.stopped = true;
+            pthread_cond_signal(&queue.not_full);
+            pthread_mutex_unlock(&queue.lock);
+            break;
+        }
+    }
+    pthread_join(thread, 0);
+    pthread_cond_destroy(&queue.not_full);
+    pthread_cond_destroy(&queue.not_empty);
+    pthread_mutex_destroy(&queue.lock);
+    bool ok = true;
+    if (failing_run) {
+        struct owl_default_tokenizer at_run = *tokenizer;
+        at_run.offset = failing_end.offset;
+        at_run.whitespace = failing_end.whitespace;
+        tree->error = ERROR_UNEXPECTED_TOKEN;
+        find_token_range(&at_run, failing_run, failing_index, &tree->error_range.start, &tree->error_range.end);
+        ok = false;
+    } else if (tokenizer->offset < length) {
+        tree->error = ERROR_INVALID_TOKEN;
+        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);
+        ok = false;
+    }
+    if (parser->validating)
+        discard_tokens(parser);
+    return ok;
+}
+#endif
+static void finish_parsing(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    struct fill_run_state top = parser->cont.stack[parser->cont.top_index];
+    if (tree->error != ERROR_NONE) {
+        recycle_token_runs(parser);
+        return;
+    }
+    switch (top.state) {
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+        break;
+    default:
+        tree->error = ERROR_MORE_INPUT_NEEDED;
+        find_end_range(&parser->tokenizer, &tree->error_range.start, &tree->error_range.end);
+        recycle_token_runs(parser);
+        return;
+    }
+    if (parser->validating)
+        return;
+    tree->root_offset = build_parse_tree(parser);
+#ifdef OWL_INDEX
+    if (tree->rule_index || tree->location_index)
+        finish_indexes(tree);
+#endif
+}
+// Parses a string into `tree`, reusing the parser's memory from earlier parses.
+// If `pipeline` is set, the text is tokenized on another thread (see
+// parse_text_pipelined).
+static void parse_string_reusing(struct owl_parser *parser, struct owl_tree *tree, const char *string, size_t length, bool validate, unsigned threads, bool pipeline) {
+    parser->validating = validate;
+    tree->string = string;
+    start_parsing(parser, tree);
+#ifdef OWL_THREADS
+    if (threads > 1)
+        parse_text_in_parallel(parser, string, length, threads);
+    else if (pipeline)
+        parse_text_pipelined(parser, string, length);
+    else
+        parse_text(parser, string, length, false);
+#else
+    (void)threads;
+    (void)pipeline;
+    parse_text(parser, string, length, false);
+#endif
+    finish_parsing(parser);
+}
+static void parse_string(struct owl_tree *tree, const char *string, size_t length, bool validate, unsigned threads, bool pipeline) {
+    struct owl_parser parser = { .allocator = tree->allocator };
+    parse_string_reusing(&parser, tree, string, length, validate, threads, pipeline);
+    free_parser_memory(&parser);
+}
+static struct owl_tree *owl_tree_create_with_error(enum owl_error e) {
+    struct owl_tree *tree = owl_tree_create_empty((struct owl_allocator){ 0 });
+    tree->error = e;
+    return tree;
+}
+struct owl_tree *owl_tree_create_from_string(const char *string) {
+    return owl_tree_create_with_options((struct owl_tree_options){ .string = string });
+}
+struct owl_tree *owl_tree_create_from_file(FILE *file) {
+    if (!file)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    return owl_tree_create_with_options((struct owl_tree_options){ .file = file });
+}
+#ifdef OWL_MMAP
+// Reads the rest of `fd` into a new buffer.  For regular files, `size` is the
+// size of the file and the buffer is allocated once, at exactly that size.
+static char *read_file_descriptor(int fd, size_t size, size_t *length, size_t *capacity_out, struct owl_allocator *allocator) {
+    size_t capacity = size ? size : 65536;
+    char *buffer = allocate_memory(capacity, allocator);
+    size_t offset = 0;
+    while (buffer) {
+        if (offset == capacity) {
+            if (size)
+                break;
+            char *b = reallocate_memory(buffer, capacity, capacity * 2, allocator);
+            if (!b)
+                free_memory(buffer, capacity, allocator);
+            buffer = b;
+            capacity *= 2;
+            continue;
+        }
+        ssize_t n = read(fd, buffer + offset, capacity - offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0) {
+            free_memory(buffer, capacity, allocator);
+            return 0;
+        }
+        if (n == 0)
+            break;
+        offset += (size_t)n;
+    }
+    *length = offset;
+    *capacity_out = capacity;
+    return buffer;
+}
+#endif
+static bool allocator_options_are_valid(struct owl_tree_options options) {
+    return !options.allocate == !options.reallocate && !options.allocate == !options.deallocate;
+}
+static struct owl_allocator allocator_from_options(struct owl_tree_options options) {
+    return (struct owl_allocator){
+        .allocate = options.allocate,
+        .reallocate = options.reallocate,
+        .deallocate = options.deallocate,
+        .info = options.allocator_info,
+    };
+}
+// Sets up `tree` for the options, then parses `length` bytes of `string` into
+// it.  The arguments are the same as for create_tree.
+static void parse_into_tree(struct owl_tree *tree, struct owl_tree_options options, const char *string, size_t length, bool validate, const struct owl_builder *builder, struct owl_parser *parser) {
+    tree->builder = builder;
+#ifdef OWL_INDEX
+    if (options.index_rules && !validate && !builder)
+        tree->rule_index = create_rule_index(&tree->allocator);
+    if (options.index_locations && !validate && !builder)
+        tree->location_index = create_location_index(&tree->allocator);
+#endif
+    if (parser)
+        parse_string_reusing(parser, tree, string, length, validate, options.threads, options.pipeline);
+    else
+        parse_string(tree, string, length, validate, options.threads, options.pipeline);
+}
+// Creates a tree from the options.  If `validate` is set, the tree isn't built;
+// if `builder` is set, it's used to build nodes instead.  If `parser` is set,
+// its memory is reused; it must use the same allocator as the options.
+static struct owl_tree *create_tree(struct owl_tree_options options, bool validate, const struct owl_builder *builder, struct owl_parser *parser) {
+    if (!options.file == !options.string || !allocator_options_are_valid(options))
+        return owl_tree_create_with_error(ERROR_INVALID_OPTIONS);
+    struct owl_allocator allocator = allocator_from_options(options);
+    size_t len = 32;
+    if (options.file) {
+        char *str = 0;
+        size_t off = 0;
+        while (true) {
+            size_t old_len = str ? len : 0;
+            len = len * 3 / 2;
+            char *s = reallocate_memory(str, old_len, len, &allocator);
+            if (!s) {
+                free_memory(str, old_len, &allocator);
+                return 0;
+            }
+            str = s;
+            off += fread(str + off, 1, len - off, options.file);
+            if (off < len) {
+                str[off] = '\0';
+                break;
+            }
+        }
+        options.string = str;
+        options.length = off;
+    } else if (!options.length && !options.has_length)
+        options.length = strlen(options.string);
+    struct owl_tree *tree = owl_tree_create_empty(allocator);
+    if (options.file)
+        tree->owned_string_size = len;
+    parse_into_tree(tree, options, options.string, options.length, validate, builder, parser);
+    return tree;
+}
+struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options) {
+    return create_tree(options, false, 0, 0);
+}
+struct owl_tree *owl_tree_create_from_path(const char *path) {
+    return owl_tree_create_from_path_with_options(path, (struct owl_tree_options){ 0 });
+}
+struct owl_tree *owl_tree_create_from_path_with_options(const char *path, struct owl_tree_options options) {
+    if (!path)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    if (options.file || options.string || !allocator_options_are_valid(options))
+        return owl_tree_create_with_error(ERROR_INVALID_OPTIONS);
+#ifdef OWL_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    }
+    struct owl_tree *tree = owl_tree_create_empty(allocator_from_options(options));
+    size_t length = 0;
+    if (S_ISREG(st.st_mode) && st.st_size > 0 && (uintmax_t)st.st_size <= SIZE_MAX) {
+        length = (size_t)st.st_size;
+        void *map = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+#if defined(MADV_SEQUENTIAL)
+            madvise(map, length, MADV_SEQUENTIAL);
+#elif defined(POSIX_MADV_SEQUENTIAL)
+            posix_madvise(map, length, POSIX_MADV_SEQUENTIAL);
+#endif
+            tree->mapped_length = length;
+            tree->string = map;
+        }
+    }
+    if (!tree->mapped_length) {
+        // Pipes and other special files can't be mapped.
+        size_t capacity = 0;
+        char *string = read_file_descriptor(fd, length, &length, &capacity, &tree->allocator);
+        if (!string) {
+            close(fd);
+            owl_tree_destroy(tree);
+            return owl_tree_create_with_error(ERROR_INVALID_FILE);
+        }
+        tree->string = string;
+        tree->owned_string_size = capacity;
+    }
+    close(fd);
+    parse_into_tree(tree, options, tree->string, length, false, 0, 0);
+    return tree;
+#else
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    options.file = file;
+    struct owl_tree *tree = owl_tree_create_with_options(options);
+    fclose(file);
+    return tree;
+#endif
+}
+enum owl_error owl_validate(const char *string, size_t length, struct source_range *error_range) {
+    return owl_validate_with_options((struct owl_tree_options){ .string = string, .length = length, .has_length = true }, error_range);
+}
+enum owl_error owl_validate_with_options(struct owl_tree_options options, struct source_range *error_range) {
+    struct owl_tree *tree = create_tree(options, true, 0, 0);
+    if (!tree)
+        return ERROR_INVALID_FILE;
+    enum owl_error error = owl_tree_get_error(tree, error_range);
+    owl_tree_destroy(tree);
+    return error;
+}
+#ifdef OWL_BUILDER
+enum owl_error owl_build(const char *string, size_t length, struct owl_builder builder, void **root, struct source_range *error_range) {
+    return owl_build_with_options((struct owl_tree_options){ .string = string, .length = length, .has_length = true }, builder, root, error_range);
+}
+enum owl_error owl_build_with_options(struct owl_tree_options options, struct owl_builder builder, void **root, struct source_range *error_range) {
+    if (root)
+        *root = 0;
+    if (!builder.build)
+        return ERROR_INVALID_OPTIONS;
+    struct owl_tree *tree = create_tree(options, false, &builder, 0);
+    if (!tree)
+        return ERROR_INVALID_FILE;
+    enum owl_error error = owl_tree_get_error(tree, error_range);
+    if (error == ERROR_NONE && root)
+        *root = (void *)(uintptr_t)tree->root_offset;
+    owl_tree_destroy(tree);
+    return error;
+}
+#endif
+#ifdef OWL_BATCH
+// Parses inputs[index] into out[index].
+static void parse_batch_input(struct owl_tree_options options, const char **inputs, const size_t *lengths, struct owl_tree **out, size_t index, struct owl_parser *parser) {
+    options.string = inputs[index];
+    options.length = lengths ? lengths[index] : 0;
+    options.has_length = lengths != 0;
+    options.threads = 1;
+    out[index] = create_tree(options, false, 0, parser);
+}
+#ifdef OWL_THREADS
+// Each worker parses the inputs from `next` up to `end`.  Once it runs out, it
+// steals the second half of another worker's remaining inputs.
+struct batch_worker {
+    struct batch *batch;
+    size_t index;
+    pthread_mutex_t lock;
+    size_t next;
+    size_t end;
+    pthread_t thread;
+    bool started;
+};
+struct batch {
+    struct owl_tree_options options;
+    const char **inputs;
+    const size_t *lengths;
+    struct owl_tree **out;
+    struct batch_worker *workers;
+    size_t number_of_workers;
+};
+// Finds the next input for a worker to parse, stealing if its own are gone.
+static bool take_batch_input(struct batch_worker *worker, size_t *index) {
+    pthread_mutex_lock(&worker->lock);
+    bool found = worker->next < worker->end;
+    if (found)
+        *index = worker->next++;
+    pthread_mutex_unlock(&worker->lock);
+    if (found)
+        return true;
+    struct batch *batch = worker->batch;
+    for (size_t i = 1; i < batch->number_of_workers; ++i) {
+        struct batch_worker *victim = &batch->workers[(worker->index + i) % batch->number_of_workers];
+        pthread_mutex_lock(&victim->lock);
+        size_t end = victim->end;
+        size_t start = end - (end - victim->next) / 2;
+        if (start == end && victim->next < end)
+            start--;
+        victim->end = start;
+        pthread_mutex_unlock(&victim->lock);
+        if (start == end)
+            continue;
+        pthread_mutex_lock(&worker->lock);
+        worker->next = start + 1;
+        worker->end = end;
+        pthread_mutex_unlock(&worker->lock);
+        *index = start;
+        return true;
+    }
+    return false;
+}
+static void *run_batch_worker(void *data) {
+    struct batch_worker *worker = data;
+    struct batch *batch = worker->batch;
+    // Each worker has a parser of its own, which keeps its memory from one input
+    // to the next.
+    struct owl_parser parser = { .allocator = allocator_from_options(batch->options) };
+    size_t index;
+    while (take_batch_input(worker, &index))
+        parse_batch_input(batch->options, batch->inputs, batch->lengths, batch->out, index, &parser);
+    free_parser_memory(&parser);
+    return 0;
+}
+#endif
+void owl_parse_batch(const char **inputs, const size_t *lengths, size_t n, struct owl_tree **out, int threads) {
+    owl_parse_batch_with_options((struct owl_tree_options){ .threads = threads > 0 ? (unsigned)threads : 1 }, inputs, lengths, n, out);
+}
+void owl_parse_batch_with_options(struct owl_tree_options options, const char **inputs, const size_t *lengths, size_t n, struct owl_tree **out) {
+    if (options.file || options.string || !allocator_options_are_valid(options)) {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = owl_tree_create_with_error(ERROR_INVALID_OPTIONS);
+        return;
+    }
+#ifdef OWL_THREADS
+    size_t number_of_workers = options.threads < n ? options.threads : n;
+    if (number_of_workers > 1) {
+        struct owl_allocator allocator = allocator_from_options(options);
+        struct batch_worker *workers = allocate_memory(number_of_workers * sizeof(struct batch_worker), &allocator);
+        if (!workers)
+            abort();
+        struct batch batch = {
+            .options = options,
+            .inputs = inputs,
+            .lengths = lengths,
+            .out = out,
+            .workers = workers,
+            .number_of_workers = number_of_workers,
+        };
+        for (size_t i = 0; i < number_of_workers; ++i) {
+            workers[i] = (struct batch_worker){
+                .batch = &batch,
+                .index = i,
+                .next = n * i / number_of_workers,
+                .end = n * (i + 1) / number_of_workers,
+            };
+            pthread_mutex_init(&workers[i].lock, 0);
+        }
+        // The calling thread is the first worker.
+        for (size_t i = 1; i < number_of_workers; ++i)
+            workers[i].started = pthread_create(&workers[i].thread, 0, run_batch_worker, &workers[i]) == 0;
+        run_batch_worker(&workers[0]);
+        for (size_t i = 1; i < number_of_workers; ++i) {
+            if (workers[i].started)
+                pthread_join(workers[i].thread, 0);
+        }
+        for (size_t i = 0; i < number_of_workers; ++i)
+            pthread_mutex_destroy(&workers[i].lock);
+        free_memory(workers, number_of_workers * sizeof(struct batch_worker), &allocator);
+        return;
+    }
+#endif
+    struct owl_parser parser = { .allocator = allocator_from_options(options) };
+    for (size_t i = 0; i < n; ++i)
+        parse_batch_input(options, inputs, lengths, out, i, &parser);
+    free_parser_memory(&parser);
+}
+#endif
+#ifdef OWL_PARSER_API
+struct owl_parser *owl_parser_create(void) {
+    return owl_parser_create_with_options((struct owl_tree_options){ 0 });
+}
+struct owl_parser *owl_parser_create_with_options(struct owl_tree_options options) {
+    bool valid = allocator_options_are_valid(options);
+    struct owl_allocator allocator = { 0 };
+    if (valid)
+        allocator = allocator_from_options(options);
+    struct owl_parser *parser = allocate_memory(sizeof(struct owl_parser), &allocator);
+    if (!parser)
+        return 0;
+    *parser = (struct owl_parser){ .allocator = allocator };
+    parser->capacity = FEED_BATCH_SIZE;
+    parser->buffer = allocate_memory(parser->capacity, &allocator);
+    if (!parser->buffer) {
+        free_memory(parser, sizeof(struct owl_parser), &allocator);
+        return 0;
+    }
+    parser->buffer[0] = '\0';
+    parser->resume_length = FEED_BATCH_SIZE;
+    struct owl_tree *tree = owl_tree_create_empty(allocator);
+    if (options.file || options.string || !valid)
+        tree->error = ERROR_INVALID_OPTIONS;
+#ifdef OWL_INDEX
+    if (options.index_rules)
+        tree->rule_index = create_rule_index(&tree->allocator);
+    if (options.index_locations)
+        tree->location_index = create_location_index(&tree->allocator);
+#endif
+    start_parsing(parser, tree);
+    return parser;
+}
+bool owl_parser_feed(struct owl_parser *parser, const char *chunk, size_t length) {
+    if (parser->finished || parser->tree->error != ERROR_NONE)
+        return false;
+    if (length >= parser->capacity - parser->length) {
+        size_t capacity = parser->capacity;
+        while (length >= capacity - parser->length) {
+            if (capacity > SIZE_MAX / 2)
+                abort();
+            capacity *= 2;
+        }
+        char *buffer = reallocate_memory(parser->buffer, parser->capacity, capacity, &parser->allocator);
+        if (!buffer)
+            abort();
+        parser->buffer = buffer;
+        parser->capacity = capacity;
+    }
+    memcpy(parser->buffer + parser->length, chunk, length);
+    parser->length += length;
+    parser->buffer[parser->length] = '\0';
+    if (parser->length < parser->resume_length)
+        return true;
+    if (!parse_text(parser, parser->buffer, parser->length, true))
+        return false;
+    // If a long token is still incomplete, wait for the pending input to double
+    // before scanning it again.
+    size_t pending = parser->length - parser->tokenizer.offset;
+    parser->resume_length = parser->length + (pending > FEED_BATCH_SIZE ? pending : FEED_BATCH_SIZE);
+    return true;
+}
+struct owl_tree *owl_parser_finish(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    if (parser->finished)
+        free_memory(parser->buffer, parser->capacity, &parser->allocator);
+    else {
+        tree->string = parser->buffer;
+        tree->owned_string_size = parser->capacity;
+        if (tree->error == ERROR_NONE)
+            parse_text(parser, parser->buffer, parser->length, false);
+        finish_parsing(parser);
+    }
+    free_parser_memory(parser);
+    free_memory(parser, sizeof(struct owl_parser), &parser->allocator);
+    return tree;
+}
+void owl_parser_reset(struct owl_parser *parser) {
+    recycle_token_runs(parser);
+    struct owl_tree *tree = parser->tree;
+    *tree = (struct owl_tree){
+        .allocator = tree->allocator,
+        .parse_tree = tree->parse_tree,
+        .parse_tree_size = tree->parse_tree_size,
+#ifdef OWL_INDEX
+        .rule_index = tree->rule_index,
+        .location_index = tree->location_index,
+#endif
+        // Invalid options stay invalid.
+        .error = tree->error == ERROR_INVALID_OPTIONS ? ERROR_INVALID_OPTIONS : ERROR_NONE,
+    };
+#ifdef OWL_INDEX
+    clear_indexes(tree);
+#endif
+    parser->finished = false;
+    parser->length = 0;
+    parser->buffer[0] = '\0';
+    parser->resume_length = FEED_BATCH_SIZE;
+    start_parsing(parser, tree);
+}
+struct owl_tree *owl_parser_parse(struct owl_parser *parser, const char *string) {
+    owl_parser_reset(parser);
+    struct owl_tree *tree = parser->tree;
+    parser->finished = true;
+    if (tree->error != ERROR_NONE)
+        return tree;
+    tree->string = string;
+    parse_text(parser, string, strlen(string), false);
+    finish_parsing(parser);
+    return tree;
+}
+void owl_parser_destroy(struct owl_parser *parser) {
+    if (!parser)
+        return;
+    free_parser_memory(parser);
+    owl_tree_destroy(parser->tree);
+    struct owl_allocator allocator = parser->allocator;
+    free_memory(parser->buffer, parser->capacity, &allocator);
+    free_memory(parser, sizeof(struct owl_parser), &allocator);
+}
+#endif
+enum owl_error owl_tree_get_error(struct owl_tree *tree, struct source_range *error_range) {
+    if (error_range)
+        *error_range = tree->error_range;
+    return tree->error;
+}
+void owl_tree_destroy(struct owl_tree *tree) {
+    if (!tree)
+        return;
+    if (tree->owned_string_size)
+        free_memory((void *)tree->string, tree->owned_string_size, &tree->allocator);
+#ifdef OWL_MMAP
+    if (tree->mapped_length)
+        munmap((void *)tree->string, tree->mapped_length);
+#endif
+    struct owl_allocator allocator = tree->allocator;
+#ifdef OWL_INDEX
+    if (tree->rule_index) {
+        for (size_t i = 0; i < 11; ++i)
+            free_match_list(&tree->rule_index->lists[i], &allocator);
+        free_memory(tree->rule_index, sizeof(struct rule_index), &allocator);
+    }
+    if (tree->location_index) {
+        struct location_index *index = tree->location_index;
+        free_match_list(&index->nodes, &allocator);
+        free_memory(index->furthest_ends, index->furthest_ends_capacity * sizeof(size_t), &allocator);
+        free_memory(index, sizeof(struct location_index), &allocator);
+    }
+#endif
+    free_memory(tree->parse_tree, tree->parse_tree_size, &allocator);
+    free_memory(tree, sizeof(struct owl_tree), &allocator);
+}
+#ifdef OWL_COMPACT
+// An element of the tree, as read by owl_tree_compact().
+struct compact_element {
+    size_t start;
+    size_t end;
+    // The choice, or zero if the rule doesn't have any.
+    uint32_t type;
+    size_t number_of_slots;
+    struct owl_ref slots[4];
+    bool is_token;
+    bool has_value;
+    uint64_t value;
+    bool is_string;
+    // The contents of a string with escapes, which are kept in the tree.
+    const char *string;
+    size_t string_length;
+};
+struct compaction {
+    struct owl_tree *tree;
+    // For each element in preorder: the offset to its next sibling, if there is
+    // one, then the offset to its token record or to each non-empty slot's list.
+    size_t *offsets;
+    size_t number_of_offsets;
+    size_t offsets_capacity;
+    size_t next_offset;
+    // Absolute offsets are padded to this many bytes.
+    size_t offset_width;
+};
+static size_t tree_field_size(uint64_t value)
+{
+    (void)value;
+    return 4;
+}
+static void write_tree_padded(struct owl_tree *tree, uint64_t value, size_t width)
+{
+    (void)width;
+    write_tree(tree, value);
+}
+static void describe_element(struct owl_ref ref, struct compact_element *e)
+{
+    *e = (struct compact_element){0};
+    switch (ref._type) {
+    case 0: {
+        struct parsed_value it = parsed_value_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->type = it.type;
+        e->slots[0] = it.string;
+        e->slots[1] = it.value;
+        e->slots[2] = it.number;
+        e->number_of_slots = 3;
+        break;
+    }
+    case 1: {
+        struct parsed_string it = parsed_string_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->is_token = true;
+        e->is_string = true;
+        uintptr_t contents = (uintptr_t)ref._tree->parse_tree;
+        if ((uintptr_t)it.string >= contents && (uintptr_t)it.string < contents + ref._tree->parse_tree_size) {
+            e->string = it.string;
+            e->string_length = it.length;
+        }
+        break;
+    }
+    case 2: {
+        struct parsed_number it = parsed_number_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->is_token = true;
+        e->has_value = true;
+        e->value = (union { double n; uint64_t v; }){ .n = it.number }.v;
+        break;
+    }
+    default:
+        break;
+    }
+}
+static size_t string_contents_size(size_t length)
+{
+    return (length + 3) & ~(size_t)3;
+}
+// Returns the size of a token's record, and any string contents after it.
+static size_t token_record_size(struct compaction *c, struct compact_element *e)
+{
+    size_t size = tree_field_size(0) + tree_field_size(e->start) + tree_field_size(e->end - e->start);
+    if (e->has_value)
+        size += 8;
+    if (e->is_string && e->string)
+        size += c->offset_width + tree_field_size(e->string_length) + string_contents_size(e->string_length);
+    else if (e->is_string)
+        size += tree_field_size(0);
+    return size;
+}
+static size_t measure_list(struct compaction *c, struct owl_ref ref);
+// Returns the number of offsets recorded for an element.
+static size_t count_offsets(struct compact_element *e, struct owl_ref next)
+{
+    size_t count = next.empty ? 0 : 1;
+    if (e->is_token)
+        return count + 1;
+    for (size_t i = 0; i < e->number_of_slots; ++i) {
+        if (!e->slots[i].empty)
+            count++;
+    }
+    return count;
+}
+static size_t measure_element(struct compaction *c, struct owl_ref ref, struct owl_ref next)
+{
+    struct compact_element e;
+    describe_element(ref, &e);
+    size_t index = c->number_of_offsets;
+    size_t count = count_offsets(&e, next);
+    if (index + count > c->offsets_capacity) {
+        size_t capacity = (index + count) * 2 + 64;
+        size_t *offsets = reallocate_memory(c->offsets, c->offsets_capacity * sizeof(size_t),
+         capacity * sizeof(size_t), &c->tree->allocator);
+        if (!offsets)
+            abort();
+        c->offsets = offsets;
+        c->offsets_capacity = capacity;
+    }
+    c->number_of_offsets += count;
+    // The size of everything after the header: the slots' lists or the record.
+    size_t lists[4];
+    size_t body = 0;
+    for (size_t i = 0; i < e.number_of_slots; ++i) {
+        lists[i] = measure_list(c, e.slots[i]);
+        body += lists[i];
+    }
+    // Every header field except the offsets to later elements.
+    size_t fields = 0;
+    if (e.is_token) {
+        fields += c->offset_width;
+        body = token_record_size(c, &e);
+    } else
+        fields += tree_field_size(e.start) + tree_field_size(e.end - e.start);
+    if (e.type)
+        fields += tree_field_size(e.type);
+    for (size_t i = 0; i < e.number_of_slots; ++i)
+        fields += e.slots[i].empty ? tree_field_size(0) : c->offset_width;
+    // The offsets depend on the size of the header, which depends on the size of
+    // the offsets.  Start small and grow the header until they fit.
+    size_t header = fields;
+    while (true) {
+        size_t size = fields + tree_field_size(next.empty ? 0 : header + body);
+        if (size == header)
+            break;
+        header = size;
+    }
+    if (!next.empty)
+        c->offsets[index++] = header + body;
+    if (e.is_token)
+        c->offsets[index++] = header;
+    size_t list_offset = header;
+    for (size_t i = 0; i < e.number_of_slots; ++i) {
+        if (!e.slots[i].empty)
+            c->offsets[index++] = list_offset;
+        list_offset += lists[i];
+    }
+    return header + body;
+}
+static size_t measure_list(struct compaction *c, struct owl_ref ref)
+{
+    size_t size = 0;
+    while (!ref.empty) {
+        struct owl_ref next = owl_next(ref);
+        size += measure_element(c, ref, next);
+        ref = next;
+    }
+    return size;
+}
+static void write_list(struct compaction *c, struct owl_ref ref);
+static void write_element(struct compaction *c, struct owl_ref ref, struct owl_ref next)
+{
+    struct owl_tree *tree = c->tree;
+    struct compact_element e;
+    describe_element(ref, &e);
+    size_t index = c->next_offset;
+    c->next_offset += count_offsets(&e, next);
+    size_t offset = tree->next_offset;
+#ifdef OWL_INDEX
+    if (tree->rule_index || tree->location_index)
+        index_match(tree, ref._type, e.type, offset, e.start, e.end);
+#endif
+    size_t size = next.empty ? 0 : c->offsets[index++];
+    write_tree(tree, size);
+    if (e.is_token) {
+        size_t header = c->offsets[index];
+        write_tree(tree, offset + header);
+        write_tree(tree, 0);
+        write_tree(tree, e.start);
+        write_tree(tree, e.end - e.start);
+        if (e.has_value)
+            write_tree_wide(tree, e.value);
+        if (e.is_string && e.string) {
+            // The contents go right after the record.
+            size_t record_size = tree->next_offset - offset - header;
+            record_size += c->offset_width + tree_field_size(e.string_length);
+            write_tree_padded(tree, offset + header + record_size, c->offset_width);
+            write_tree(tree, e.string_length);
+            memcpy(allocate_string_contents(e.string_length, tree), e.string, e.string_length);
+        } else if (e.is_string)
+            write_tree(tree, 0);
+        return;
+    }
+    write_tree(tree, e.start);
+    write_tree(tree, e.end - e.start);
+    if (e.type)
+        write_tree(tree, e.type);
+    for (size_t i = 0; i < e.number_of_slots; ++i) {
+        if (e.slots[i].empty) {
+            write_tree(tree, 0);
+            continue;
+        }
+        write_tree(tree, offset + c->offsets[index++]);
+    }
+    for (size_t i = 0; i < e.number_of_slots; ++i)
+        write_list(c, e.slots[i]);
+}
+static void write_list(struct compaction *c, struct owl_ref ref)
+{
+    while (!ref.empty) {
+        struct owl_ref next = owl_next(ref);
+        write_element(c, ref, next);
+        ref = next;
+    }
+}
+void owl_tree_compact(struct owl_tree *tree) {
+    if (tree->error != ERROR_NONE || tree->root_offset == 0)
+        return;
+    // The old tree is read through a copy while the new one is written.
+    struct owl_tree old = *tree;
+    struct owl_ref root = owl_tree_root_ref(&old);
+    struct compaction c = {
+        .tree = tree,
+        .offset_width = tree_field_size(old.next_offset),
+    };
+    size_t size = measure_list(&c, root);
+    while (tree_field_size(4 + size) > c.offset_width) {
+        c.offset_width++;
+        c.number_of_offsets = 0;
+        size = measure_list(&c, root);
+    }
+    // Leave room after the last element for read_tree's bounds check.
+    size_t parse_tree_size = 4 + size + RESERVATION_AMOUNT + 1;
+    uint8_t *parse_tree = allocate_memory(parse_tree_size, &tree->allocator);
+    if (parse_tree) {
+        tree->parse_tree = parse_tree;
+        tree->parse_tree_size = parse_tree_size;
+        tree->next_offset = 4;
+        tree->root_offset = 4;
+        tree->compacted = true;
+#ifdef OWL_INDEX
+        clear_indexes(tree);
+        write_list(&c, root);
+        if (tree->rule_index || tree->location_index)
+            finish_indexes(tree);
+#else
+        write_list(&c, root);
+#endif
+        free_memory(old.parse_tree, old.parse_tree_size, &tree->allocator);
+    }
+    free_memory(c.offsets, c.offsets_capacity * sizeof(size_t), &tree->allocator);
+}
+#endif
+static const uint16_t actions[] = {
+0,4096,0,12288,0,12289,0,12290,16384,0,12291,16386,0,12292,16386,0,12293,0,12294,0,12295,0,16384,0,32769,12288,0,32769,12289,0,
+32769,12290,16384,0,32769,12291,16386,0,32769,12292,16386,0,32769,12293,0,32769,12294,0,32769,12295,0,};
+static const uint8_t action_table_displacements[48] = {
+76,4,0,0,9,32,30,27,6,48,21,0,34,21,3,7,
+7,2,0,25,18,0,19,33,3,0,5,4,4,0,3,20,
+0,2,3,12,3,1,3,1,6,5,1,0,1,0,1,0,
+};
+static const uint8_t action_table_slot_for_column[705] = {
+0,0,0,0,0,0,94,86,57,7,1,83,47,92,0,0,
+0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,21,
+0,0,0,0,0,0,0,0,0,28,13,93,43,9,79,37,
+34,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,82,0,0,
+0,0,91,0,0,0,58,0,0,0,0,0,0,0,0,0,
+0,61,0,0,0,2,0,0,0,0,0,0,0,0,0,0,
+10,0,0,0,49,0,0,0,0,0,0,0,0,0,0,84,
+0,0,0,46,0,0,0,0,0,0,0,0,0,0,68,0,
+0,0,16,0,0,0,0,0,0,0,0,0,0,14,0,0,
+0,72,0,0,0,0,0,0,0,0,0,0,59,0,0,0,
+23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+24,45,56,60,66,51,19,33,0,0,0,0,0,0,0,0,
+0,0,0,0,32,0,0,0,0,65,0,0,0,27,0,0,
+0,0,0,0,0,0,0,0,8,0,0,0,67,0,0,0,
+0,0,0,0,0,0,0,90,0,0,0,52,0,0,0,0,
+0,0,0,0,0,0,25,0,0,0,95,0,0,0,0,0,
+0,0,0,0,0,20,0,0,0,77,0,0,0,0,0,0,
+0,0,0,0,75,0,0,0,41,0,0,0,0,0,0,0,
+0,0,0,80,0,0,0,71,0,0,0,0,0,0,0,0,
+0,0,50,0,0,0,17,0,0,0,0,0,0,0,0,0,
+0,48,0,0,0,40,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,22,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,78,69,55,30,44,11,15,74,0,0,0,0,0,
+0,0,0,0,0,0,0,54,0,0,0,0,38,0,87,0,
+0,0,0,0,0,0,0,0,0,0,0,36,0,31,0,0,
+0,0,0,0,0,0,0,0,0,0,63,0,53,0,0,0,
+0,0,0,0,0,0,0,0,0,76,0,6,0,0,0,0,
+0,0,0,0,0,0,0,0,88,0,26,0,0,0,0,0,
+0,0,0,0,0,0,0,81,0,73,0,0,0,0,0,0,
+0,0,0,0,0,0,18,0,39,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,
+0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,4,0,12,0,0,0,0,0,0,0,0,0,0,
+0,};
+static const uint8_t action_table[95][6] = {
+{14,64,1,128,3,0,},{18,168,0,29,0,0,},{16,69,0,15,0,0,},{64,55,0,63,0,0,},{177,101,0,16,0,0,},{49,116,0,63,0,0,},
+{14,32,1,0,10,0,},{159,44,0,157,0,0,},{29,38,1,19,24,0,},{159,40,0,157,0,0,},{191,113,1,53,17,0,},{49,119,0,63,0,0,},
+{20,198,0,19,0,0,},{31,42,0,157,0,0,},{191,145,1,146,173,6,},{146,169,0,29,0,0,},{146,175,0,29,0,0,},{192,53,0,63,0,0,},
+{29,139,1,146,237,3,},{31,46,0,157,0,0,},{179,69,1,16,11,0,},{53,17,0,179,0,0,},{146,170,0,29,0,0,},{32,203,0,31,0,0,},
+{159,45,0,157,0,0,},{177,116,0,63,0,0,},{18,172,0,29,0,0,},{18,166,0,17,0,0,},{51,86,1,64,11,0,},{191,49,1,53,24,0,},
+{49,115,0,63,0,0,},{157,107,1,32,19,0,},{29,171,1,49,236,3,},{29,134,1,146,109,2,},{142,96,1,129,6,0,},{64,51,0,63,0,0,},
+{29,102,1,19,17,0,},{192,50,0,63,0,0,},{177,117,0,63,0,0,},{18,176,0,29,0,0,},{146,174,0,29,0,0,},{19,133,0,143,0,0,},
+{29,6,1,147,22,0,},{191,81,1,53,15,0,},{29,235,0,31,21,0,},{18,169,0,29,0,0,},{14,128,1,146,2,0,},{31,48,0,157,0,0,},
+{146,168,0,29,0,0,},{159,47,0,157,0,0,},{29,107,1,31,17,0,},{18,173,0,29,0,0,},{177,115,0,63,0,0,},{63,114,1,54,19,0,},
+{191,17,1,181,22,0,},{29,11,1,159,22,0,},{14,0,1,0,9,0,},{146,167,0,29,0,0,},{159,42,0,157,0,0,},{29,43,1,31,24,0,},
+{31,40,0,157,0,0,},{181,22,0,179,0,0,},{192,51,0,63,0,0,},{17,133,0,15,0,0,},{31,44,0,157,0,0,},{29,75,1,31,15,0,},
+{146,172,0,29,0,0,},{159,41,0,157,0,0,},{191,241,0,53,21,0,},{143,215,1,15,0,0,},{18,175,0,29,0,0,},{18,170,0,29,0,0,},
+{49,117,0,63,0,0,},{191,177,1,49,172,6,},{159,46,0,157,0,0,},{64,52,0,63,0,0,},{18,174,0,29,0,0,},{182,209,0,53,0,0,},
+{29,70,1,19,15,0,},{31,47,0,157,0,0,},{64,53,0,63,0,0,},{29,103,1,20,19,0,},{14,96,1,0,5,0,},{31,41,0,157,0,0,},
+{128,215,1,0,0,0,},{14,224,0,0,8,0,},{177,114,0,63,0,0,},{192,52,0,63,0,0,},{29,166,1,49,108,2,},{31,45,0,157,0,0,},
+{159,39,0,157,0,0,},{14,160,1,177,1,0,},{29,230,0,19,21,0,},{1,192,0,0,0,0,},{146,173,0,29,0,0,},};
+
+struct action_table_key {
+    uint8_t bytes[3];
+};
+static inline struct action_table_key encode_key(uint32_t target_nfa_state, uint32_t dfa_state, uint32_t dfa_symbol) {
+    struct action_table_key key = {{0}};
+    key.bytes[0] |= (target_nfa_state >> 0) & 127;
+    key.bytes[0] |= (dfa_state << 7) & 255;
+    key.bytes[1] |= (dfa_state >> 1) & 31;
+    key.bytes[1] |= (dfa_symbol << 5) & 255;
+    key.bytes[2] |= (dfa_symbol >> 3) & 1;
+    return key;
+}
+struct action_table_entry {
+    uint32_t nfa_state;
+    uint32_t actions;
+    uint32_t push_nfa_state;
+};
+static struct action_table_entry decode_entry(const uint8_t *bytes) {
+    struct action_table_entry entry = {0};
+    entry.nfa_state |= ((uint32_t)bytes[3] & 127) << 0;
+    entry.actions |= ((uint32_t)bytes[3] & 255) >> 7;
+    entry.actions |= ((uint32_t)bytes[4] & 31) << 1;
+    entry.push_nfa_state |= ((uint32_t)bytes[4] & 255) >> 5;
+    entry.push_nfa_state |= ((uint32_t)bytes[5] & 15) << 3;
+    return entry;
+}
+static struct action_table_entry action_table_lookup(uint32_t nfa_state, uint32_t dfa_state, uint32_t token) {
+    uint64_t packed = (uint64_t)nfa_state << 32 | (uint32_t)(dfa_state * 15 + token);
+    uint32_t hash = (uint32_t)((packed * ((uint64_t)2654435769U << 32 | 2135587861)) >> 32);
+    uint32_t displacement = action_table_displacements[(uint64_t)hash * 48 >> 32];
+    uint32_t slot = (hash << 16 | hash >> 16) ^ displacement * 0x9e3779b9u;
+    const uint8_t *entry = action_table[(uint64_t)slot * 95 >> 32];
+    struct action_table_key key = encode_key(nfa_state, dfa_state, token);
+    if (memcmp(key.bytes, entry, sizeof(key.bytes)) != 0)
+        abort();
+    return decode_entry(entry);
+}
+static void apply_actions(struct construct_state *state, uint32_t index, size_t start, size_t end) {
+    size_t offset = end;
+    uint32_t i;
+    for (i = index; actions[i]; ++i) {
+        if (((((actions[i]) >> 12) & 0xf) & 8))
+            offset = start;
+        construct_action_apply(state, actions[i], offset);
+    }
+}
+// Where the backward pass is between calls to build_tokens.
+struct build_state {
+    struct construct_state *construct_state;
+    uint32_t *state_stack;
+    size_t stack_depth;
+    size_t stack_capacity;
+    uint32_t nfa_state;
+    size_t offset;
+    size_t whitespace;
+    struct owl_allocator *allocator;
+};
+// Runs the backward pass over the tokens from `start` up to `end` in a run.
+// Tokens after `end` are only skipped over.  If `after_split` is set, the tree
+// was split during the last token's actions, and only the ones before the
+// split (in input order) are applied.
+static inline void build_tokens(struct build_state *b, struct owl_token_run *run, uint16_t start, uint16_t end, bool after_split) {
+    (void)after_split;
+    struct construct_state *construct_state = b->construct_state;
+    uint32_t *state_stack = b->state_stack;
+    size_t stack_depth = b->stack_depth;
+    size_t stack_capacity = b->stack_capacity;
+    uint32_t nfa_state = b->nfa_state;
+    size_t offset = b->offset;
+    size_t whitespace = b->whitespace;
+    uint16_t length_offset = run->lengths_size - 1;
+    uint16_t i;
+    for (i = run->number_of_tokens; i > end;) {
+        i--;
+        size_t token_end = offset;
+        size_t len = 0;
+        if (run->tokens[i] < 12)
+            len = decode_token_length(run, &length_offset, &offset);
+        whitespace = token_end - offset - len;
+    }
+    while (i > start) {
+        i--;
+        size_t end = offset;
+        size_t len = 0;
+        uint32_t column = run->states[i] * 15 + run->tokens[i];
+        struct action_table_entry entry;
+        if (action_table_slot_for_column[column])
+            entry = decode_entry(action_table[action_table_slot_for_column[column] - 1]);
+        else
+            entry = action_table_lookup(nfa_state, run->states[i], run->tokens[i]);
+        if (run->tokens[i] < 12)
+            len = decode_token_length(run, &length_offset, &offset);
+        else {
+            if (stack_depth >= stack_capacity) {
+                size_t new_capacity = (stack_capacity + 2) * 3 / 2;
+                if (new_capacity <= stack_capacity)
+                    abort();
+                uint32_t *new_stack = reallocate_memory(state_stack, stack_capacity * sizeof(uint32_t), new_capacity * sizeof(uint32_t), b->allocator);
+                if (!new_stack)
+                    abort();
+                state_stack = new_stack;
+                stack_capacity = new_capacity;
+            }
+            state_stack[stack_depth++] = entry.push_nfa_state;
+        }
+        apply_actions(construct_state, entry.actions, end, end + whitespace);
+        if (run->states[i] == 10) {
+            if (stack_depth == 0)
+                abort();
+            nfa_state = state_stack[--stack_depth];
+        } else
+            nfa_state = entry.nfa_state;
+        whitespace = end - offset - len;
+    }
+    b->state_stack = state_stack;
+    b->stack_depth = stack_depth;
+    b->stack_capacity = stack_capacity;
+    b->nfa_state = nfa_state;
+    b->offset = offset;
+    b->whitespace = whitespace;
+}
+// Applies the actions before the first token.
+static void build_first_actions(struct build_state *b) {
+    struct action_table_entry entry = action_table_lookup(b->nfa_state, 47, 14);
+    apply_actions(b->construct_state, entry.actions, b->offset, b->offset + b->whitespace);
+}
+static size_t finish_building(struct owl_parser *parser, struct build_state *b) {
+    parser->state_stack = b->state_stack;
+    parser->state_stack_capacity = b->stack_capacity;
+    return construct_finish(b->construct_state, b->offset);
+}
+static size_t build_parse_tree(struct owl_parser *parser) {
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    struct build_state b = {
+        .construct_state = &parser->construct_state,
+        .state_stack = parser->state_stack,
+        .stack_capacity = parser->state_stack_capacity,
+        .nfa_state = 14,
+        .offset = tokenizer->offset - tokenizer->whitespace,
+        .whitespace = tokenizer->whitespace,
+        .allocator = &parser->allocator,
+    };
+    parser->construct_state.info = parser->tree;
+    construct_begin(&parser->construct_state, b.offset, CONSTRUCT_NORMAL_ROOT);
+    struct owl_token_run *run = parser->token_run;
+    while (run) {
+        build_tokens(&b, run, 0, run->number_of_tokens, false);
+        struct owl_token_run *old = run;
+        run = run->prev;
+        old->prev = tokenizer->free_runs;
+        tokenizer->free_runs = old;
+    }
+    parser->token_run = 0;
+    build_first_actions(&b);
+    return finish_building(parser, &b);
+}
+static size_t read_whitespace(const char *text, size_t length, void *info) {
+    switch (text[0]) {
+    case 32:
+    case 9:
+    case 10:
+    case 13:
+#ifdef OWL_SIMD
+        return vector_scan(text, 1, length, VECTOR_SCAN_WHITESPACE, 0);
+#else
+        return 1;
+#endif
+    default:
+        return 0;
+    }
+}
+static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, size_t length, void *info) {
+    switch (text[0]) {
+    case 44:
+        *end_token = false;
+        *token = 1;
+        return 1;
+    case 45:
+        *end_token = false;
+        *token = 6;
+        return 1;
+    case 58:
+        *end_token = false;
+        *token = 0;
+        return 1;
+    case 91:
+        *end_token = false;
+        *token = 4;
+        return 1;
+    case 93:
+        *end_token = true;
+        *token = 5;
+        return 1;
+    case 102:
+        if (length >= 5 && text[1] == 97 && text[2] == 108 && text[3] == 115 && text[4] == 101) {
+            *end_token = false;
+            *token = 8;
+            return 5;
+        } else {
+            return 0;
+        }
+    case 110:
+        if (length >= 4 && text[1] == 117 && text[2] == 108 && text[3] == 108) {
+            *end_token = false;
+            *token = 9;
+            return 4;
+        } else {
+            return 0;
+        }
+    case 116:
+        if (length >= 4 && text[1] == 114 && text[2] == 117 && text[3] == 101) {
+            *end_token = false;
+            *token = 7;
+            return 4;
+        } else {
+            return 0;
+        }
+    case 123:
+        *end_token = false;
+        *token = 2;
+        return 1;
+    case 125:
+        *end_token = true;
+        *token = 3;
+        return 1;
+    default:
+        return 0;
+    }
+}
+static uint32_t rule_lookup(uint32_t parent, uint32_t slot, void *context) {
+    switch (parent) {
+    case 0:
+        switch (slot) {
+        case 0: return 1;
+        case 1: return 0;
+        case 2: return 2;
+        default: break;
+        }
+        break;
+    default: break;
+    }
+    return UINT32_MAX;
+}
+static void fixity_associativity_precedence_lookup(int *fixity_associativity, int *precedence, uint32_t rule, uint32_t choice, void *context) {
+    switch (rule) {
+    default: return;
+    }
+}
+static size_t number_of_slots_lookup(uint32_t rule, void *context) {
+    switch (rule) {
+    case 0: return 3;
+    case 1: return 0;
+    case 2: return 0;
+    default: return 0;
+    }
+}
+static void left_right_operand_slots_lookup(uint32_t rule, uint32_t *left, uint32_t *right, uint32_t *operand, void *context) {
+    switch (rule) {
+    case 0:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 1:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 2:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    }
+}
+#endif
+
@@ -0,0 +1,3240 @@
+// This file was generated by the Owl parsing tool.
+// Make sure to #define OWL_PARSER_IMPLEMENTATION somewhere so the parser
+// is compiled properly.  Just two lines are enough -- a typical parser.c might
+// look like:
+//
+//   #define OWL_PARSER_IMPLEMENTATION
+//   #include "parser.h"
+//
+// The grammar's 17 tokens fall into 17 token classes.
+
+#ifndef OWL_PARSER_H
+#define OWL_PARSER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// The owl_tree struct represents an entire parse tree.  Use the
+// owl_tree_create_...() functions to create a tree, then call owl_tree_root()
+// to get the root owl_ref.
+struct owl_tree;
+
+// Creates an owl_tree from a string.  The tree may directly reference pieces of
+// the string -- you're responsible for keeping it around until
+// owl_tree_destroy() is called.
+struct owl_tree *owl_tree_create_from_string(const char *string);
+
+// Creates an owl_tree by reading from a file.
+struct owl_tree *owl_tree_create_from_file(FILE *file);
+
+// Creates an owl_tree from the file at `path`.  Where possible, the tree
+// references a memory mapping of the file instead of a copy.
+struct owl_tree *owl_tree_create_from_path(const char *path);
+
+// Explicitly create a tree with particular options.
+struct owl_tree_options {
+    // Exactly one of string or file should be set.
+    const char *string;
+    FILE *file;
+    // The length of the string in bytes.  If this is set, the string doesn't
+    // need to be zero-terminated, and any zero bytes in it are invalid tokens.
+    size_t length;
+    // Functions for allocating and freeing memory.  Either all three or none of
+    // them should be set; if they aren't set, malloc, realloc, and free are used.
+    // The tree and everything allocated while building it come from these
+    // functions, and the tree keeps using them until it's destroyed.
+    void *(*allocate)(size_t size, void *info);
+    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);
+    void (*deallocate)(void *pointer, size_t size, void *info);
+    // This pointer will be passed into the allocation functions.
+    void *allocator_info;
+};
+struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options);
+
+// An owl_parser parses input which arrives in pieces.  Pass each piece to
+// owl_parser_feed() as it arrives, then call owl_parser_finish() to get
+// the tree.  Input is tokenized and checked as it's fed in; the tree itself is
+// built when parsing finishes.
+//
+// A parser can also parse many strings in a row with owl_parser_parse(),
+// reusing its memory instead of allocating it again for each one.
+struct owl_parser;
+
+// Creates an owl_parser.  The parser keeps its own copy of the input.
+struct owl_parser *owl_parser_create(void);
+
+// Explicitly create a parser with particular options.  The string and file
+// options must be left unset.
+struct owl_parser *owl_parser_create_with_options(struct owl_tree_options options);
+
+// Appends the next `length` bytes of input.  Returns false once the input is
+// known to contain an error; the tree returned by owl_parser_finish() will
+// report it.
+bool owl_parser_feed(struct owl_parser *parser, const char *chunk, size_t length);
+
+// Parses the rest of the input and returns the resulting tree.  The tree takes
+// ownership of the parser's copy of the input, and the parser is destroyed.
+struct owl_tree *owl_parser_finish(struct owl_parser *parser);
+
+// Parses a null-terminated string, reusing the memory from earlier parses.  The
+// tree belongs to the parser and references the string: keep both around until
+// the next call to owl_parser_parse(), owl_parser_reset(), or
+// owl_parser_destroy(), and don't pass the tree to owl_tree_destroy().
+struct owl_tree *owl_parser_parse(struct owl_parser *parser, const char *string);
+
+// Discards any input fed to the parser and any tree it returned, keeping its
+// memory for the next parse.
+void owl_parser_reset(struct owl_parser *parser);
+
+// Destroys an owl_parser without finishing it.
+void owl_parser_destroy(struct owl_parser *parser);
+
+// Destroys an owl_tree, freeing its resources back to the system.
+void owl_tree_destroy(struct owl_tree *);
+
+// Prints a representation of the tree to standard output.
+void owl_tree_print(struct owl_tree *);
+
+// An owl_ref references a list of children in the parse tree.  Use the
+// parsed_..._get() function corresponding to the element type to unpack the
+// child into its appropriate parsed_... struct.
+struct owl_ref {
+    struct owl_tree *_tree;
+    size_t _offset;
+    uint32_t _type;
+    bool empty;
+};
+
+// The owl_next function advances a ref to the next sibling element.
+struct owl_ref owl_next(struct owl_ref);
+
+// Tests two refs for equality.
+bool owl_refs_equal(struct owl_ref a, struct owl_ref b);
+
+// Returns the root owl_ref.
+struct owl_ref owl_tree_root_ref(struct owl_tree *tree);
+
+// As a shortcut, returns the parsed_program struct corresponding to the root ref.
+struct parsed_program owl_tree_get_parsed_program(struct owl_tree *tree);
+
+// The range of text corresponding to a tree element.
+struct source_range {
+    size_t start;
+    size_t end;
+};
+
+enum owl_error {
+    // No error -- everything's fine!
+    ERROR_NONE,
+
+    // The file passed to owl_tree_create_from_file was NULL.
+    ERROR_INVALID_FILE,
+
+    // The options passed to owl_tree_create_with_options weren't valid --
+    // both file and string were specified at the same time or neither were.
+    // Also reported if either was passed to owl_parser_create_with_options.
+    ERROR_INVALID_OPTIONS,
+
+    // A piece of text couldn't be matched as a token.
+    ERROR_INVALID_TOKEN,
+
+    // The parser encountered an out-of-place token that doesn't fit the grammar.
+    ERROR_UNEXPECTED_TOKEN,
+
+    // The input is valid so far, but incomplete; more tokens could be added to
+    // complete it.
+    ERROR_MORE_INPUT_NEEDED,
+};
+// Returns an error code, or ERROR_NONE if there wasn't an error.
+// The error_range parameter can be null.
+enum owl_error owl_tree_get_error(struct owl_tree *tree, struct source_range *error_range);
+
+// Checks whether a string matches the grammar without building a tree.  The
+// result (and error range) is the same as creating a tree would report, but
+// memory use depends only on how deeply the input is nested, not its length.
+// If `length` is zero, the string must be zero-terminated.
+enum owl_error owl_validate(const char *string, size_t length, struct source_range *error_range);
+
+// Explicitly validate input with particular options.
+enum owl_error owl_validate_with_options(struct owl_tree_options options, struct source_range *error_range);
+
+enum parsed_type {
+    PARSED_IF = 1,
+    PARSED_LET,
+    PARSED_CALL,
+    PARSED_EXPR,
+    PARSED_PLUS,
+    PARSED_TIMES,
+    PARSED_EQUALS,
+    PARSED_RETURN,
+    PARSED_STRING,
+    PARSED_INTEGER,
+    PARSED_VARIABLE,
+};
+
+struct parsed_program {
+    struct source_range range;
+    struct owl_ref function;
+};
+
+struct parsed_function {
+    struct source_range range;
+    struct owl_ref identifier;
+    struct owl_ref statement;
+};
+
+struct parsed_statement {
+    struct source_range range;
+    enum parsed_type type;
+    struct owl_ref identifier;
+    struct owl_ref expr;
+    struct owl_ref statement;
+};
+
+struct parsed_expr {
+    struct source_range range;
+    enum parsed_type type;
+    struct owl_ref identifier;
+    struct owl_ref integer;
+    struct owl_ref string;
+    struct owl_ref expr;
+    struct owl_ref left;
+    struct owl_ref right;
+};
+
+struct parsed_identifier {
+    struct source_range range;
+    const char *identifier;
+    size_t length;
+};
+
+struct parsed_integer {
+    struct source_range range;
+    uint64_t integer;
+};
+
+struct parsed_string {
+    struct source_range range;
+    const char *string;
+    size_t length;
+};
+
+struct parsed_program parsed_program_get(struct owl_ref);
+struct parsed_function parsed_function_get(struct owl_ref);
+struct parsed_statement parsed_statement_get(struct owl_ref);
+struct parsed_expr parsed_expr_get(struct owl_ref);
+struct parsed_identifier parsed_identifier_get(struct owl_ref);
+struct parsed_integer parsed_integer_get(struct owl_ref);
+struct parsed_string parsed_string_get(struct owl_ref);
+
+// The rules of the grammar, as passed to owl_builder functions.
+enum owl_rule {
+    OWL_RULE_PROGRAM = 0,
+    OWL_RULE_FUNCTION = 1,
+    OWL_RULE_STATEMENT = 2,
+    OWL_RULE_EXPR = 3,
+    OWL_RULE_IDENTIFIER = 4,
+    OWL_RULE_INTEGER = 5,
+    OWL_RULE_STRING = 6,
+};
+
+// A rule or token match, as passed to an owl_builder function.
+struct owl_match {
+    enum owl_rule rule;
+    struct source_range range;
+    // For rules with named options, the option which matched.
+    enum parsed_type type;
+    // The nodes built for each of the rule's fields, in the same order as the
+    // fields of its parsed_... struct.  Each one is the first node of a list
+    // linked by `next_sibling`, or null if the field is empty.
+    void **slots;
+    // Token data, as in the token's parsed_... struct.  The identifier and
+    // string pointers may only be valid until building finishes.
+    const char *identifier;
+    const char *string;
+    size_t length;
+    uint64_t integer;
+    double number;
+};
+struct owl_builder {
+    // Called once for each match, after the matches inside it.  `next_sibling` is
+    // the node built for the following match in the same field, if there is one.
+    // Returns the new node; returning null leaves the match out.
+    void *(*build)(const struct owl_match *match, void *next_sibling, void *info);
+    // This pointer will be passed into the build function.
+    void *info;
+};
+
+// Parses a string, building your own nodes with `builder` instead of creating
+// a tree.  Nodes are only built once the whole input has been checked, so
+// nothing is built if there's an error.  Otherwise, `root` is set to the node
+// built for the root match.  If `length` is zero, the string must be
+// zero-terminated.
+enum owl_error owl_build(const char *string, size_t length, struct owl_builder builder, void **root, struct source_range *error_range);
+
+// Explicitly build nodes with particular options.
+enum owl_error owl_build_with_options(struct owl_tree_options options, struct owl_builder builder, void **root, struct source_range *error_range);
+
+#endif
+
+#ifdef OWL_PARSER_IMPLEMENTATION
+// Code implementing the parser.  This might get a bit messy!
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined(OWL_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define OWL_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__clang__) || defined(__GNUC__)
+#define OWL_DONT_INLINE __attribute__((noinline))
+#else
+#define OWL_DONT_INLINE
+#endif
+
+// The allocation functions from owl_tree_options.
+struct owl_allocator {
+    void *(*allocate)(size_t size, void *info);
+    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);
+    void (*deallocate)(void *pointer, size_t size, void *info);
+    void *info;
+};
+static void *allocate_memory(size_t size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (a->allocate)
+        return a->allocate(size, a->info);
+    return malloc(size);
+}
+static void *reallocate_memory(void *pointer, size_t old_size, size_t new_size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (a->reallocate)
+        return a->reallocate(pointer, old_size, new_size, a->info);
+    return realloc(pointer, new_size);
+}
+static void free_memory(void *pointer, size_t size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (!pointer)
+        return;
+    if (a->deallocate)
+        a->deallocate(pointer, size, a->info);
+    else
+        free(pointer);
+}
+
+struct owl_tree {
+    const char *string;
+    // If nonzero, the tree owns the string, which is an allocation of this many
+    // bytes.
+    size_t owned_string_size;
+    // If nonzero, the string is a memory mapping of this many bytes.
+    size_t mapped_length;
+    struct owl_allocator allocator;
+    // If set, nodes are built with this instead of being written to parse_tree.
+    const struct owl_builder *builder;
+    uint8_t *parse_tree;
+    size_t parse_tree_size;
+    size_t next_offset;
+    enum owl_error error;
+    struct source_range error_range;
+    size_t root_offset;
+    size_t next_identifier_token_offset;
+    size_t next_integer_token_offset;
+    size_t next_string_token_offset;
+};
+// Reserve 10 bytes for each entry (the maximum encoded size of a 64-bit value).
+#define RESERVATION_AMOUNT 10
+static inline uint64_t read_tree(size_t *offset, struct owl_tree *tree) {
+    uint8_t *parse_tree = tree->parse_tree;
+    size_t parse_tree_size = tree->parse_tree_size;
+    size_t i = *offset;
+    if (i + RESERVATION_AMOUNT >= parse_tree_size)
+        return 0;
+    uint64_t result = 0;
+    int shift_amount = 0;
+    while ((parse_tree[i] & 0x80) != 0 && shift_amount < 64) {
+        result |= ((uint64_t)parse_tree[i] & 0x7f) << shift_amount;
+        shift_amount += 7;
+        i++;
+    }
+    result |= ((uint64_t)parse_tree[i] & 0x7f) << shift_amount;
+    i++;
+    *offset = i;
+    return result;
+}
+static bool grow_tree(struct owl_tree *tree, size_t size)
+{
+    size_t n = tree->parse_tree_size;
+    while (n < size || n < 4096)
+        n = (n + 1) * 3 / 2;
+    uint8_t *parse_tree = reallocate_memory(tree->parse_tree, tree->parse_tree_size, n, &tree->allocator);
+    if (!parse_tree)
+        return false;
+    tree->parse_tree_size = n;
+    tree->parse_tree = parse_tree;
+    return true;
+}
+static void write_tree(struct owl_tree *tree, uint64_t value)
+{
+    size_t reserved_size = tree->next_offset + RESERVATION_AMOUNT;
+    if (tree->parse_tree_size <= reserved_size && !grow_tree(tree, reserved_size))
+        abort();
+    while (value >> 7 != 0) {
+        tree->parse_tree[tree->next_offset++] = 0x80 | (value & 0x7f);
+        value >>= 7;
+    }
+    tree->parse_tree[tree->next_offset++] = value & 0x7f;
+}
+struct parsed_program parsed_program_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 0) {
+        return (struct parsed_program){
+            .function.empty = true,
+        };
+    }
+    size_t offset = ref._offset;
+    read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
+    size_t start_location = read_tree(&offset, ref._tree);
+    size_t end_location = start_location + read_tree(&offset, ref._tree);
+    struct parsed_program result = {
+        .range.start = start_location,
+        .range.end = end_location,
+    };
+    result.function._tree = ref._tree;
+    result.function._offset = read_tree(&offset, ref._tree);
+    result.function._type = 1;
+    result.function.empty = result.function._offset == 0;
+    return result;
+}
+struct parsed_function parsed_function_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 1) {
+        return (struct parsed_function){
+            .identifier.empty = true,
+            .statement.empty = true,
+        };
+    }
+    size_t offset = ref._offset;
+    read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
+    size_t start_location = read_tree(&offset, ref._tree);
+    size_t end_location = start_location + read_tree(&offset, ref._tree);
+    struct parsed_function result = {
+        .range.start = start_location,
+        .range.end = end_location,
+    };
+    result.identifier._tree = ref._tree;
+    result.identifier._offset = read_tree(&offset, ref._tree);
+    result.identifier._type = 4;
+    result.identifier.empty = result.identifier._offset == 0;
+    result.statement._tree = ref._tree;
+    result.statement._offset = read_tree(&offset, ref._tree);
+    result.statement._type = 2;
+    result.statement.empty = result.statement._offset == 0;
+    return result;
+}
+struct parsed_statement parsed_statement_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 2) {
+        return (struct parsed_statement){
+            .identifier.empty = true,
+            .expr.empty = true,
+            .statement.empty = true,
+        };
+    }
+    size_t offset = ref._offset;
+    read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
+    size_t start_location = read_tree(&offset, ref._tree);
+    size_t end_location = start_location + read_tree(&offset, ref._tree);
+    struct parsed_statement result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .type = (enum parsed_type)read_tree(&offset, ref._tree),
+    };
+    result.identifier._tree = ref._tree;
+    result.identifier._offset = read_tree(&offset, ref._tree);
+    result.identifier._type = 4;
+    result.identifier.empty = result.identifier._offset == 0;
+    result.expr._tree = ref._tree;
+    result.expr._offset = read_tree(&offset, ref._tree);
+    result.expr._type = 3;
+    result.expr.empty = result.expr._offset == 0;
+    result.statement._tree = ref._tree;
+    result.statement._offset = read_tree(&offset, ref._tree);
+    result.statement._type = 2;
+    result.statement.empty = result.statement._offset == 0;
+    return result;
+}
+struct parsed_expr parsed_expr_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 3) {
+        return (struct parsed_expr){
+            .identifier.empty = true,
+            .integer.empty = true,
+            .string.empty = true,
+            .expr.empty = true,
+            .left.empty = true,
+            .right.empty = true,
+        };
+    }
+    size_t offset = ref._offset;
+    read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
+    size_t start_location = read_tree(&offset, ref._tree);
+    size_t end_location = start_location + read_tree(&offset, ref._tree);
+    struct parsed_expr result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .type = (enum parsed_type)read_tree(&offset, ref._tree),
+    };
+    result.identifier._tree = ref._tree;
+    result.identifier._offset = read_tree(&offset, ref._tree);
+    result.identifier._type = 4;
+    result.identifier.empty = result.identifier._offset == 0;
+    result.integer._tree = ref._tree;
+    result.integer._offset = read_tree(&offset, ref._tree);
+    result.integer._type = 5;
+    result.integer.empty = result.integer._offset == 0;
+    result.string._tree = ref._tree;
+    result.string._offset = read_tree(&offset, ref._tree);
+    result.string._type = 6;
+    result.string.empty = result.string._offset == 0;
+    result.expr._tree = ref._tree;
+    result.expr._offset = read_tree(&offset, ref._tree);
+    result.expr._type = 3;
+    result.expr.empty = result.expr._offset == 0;
+    result.left._tree = ref._tree;
+    result.left._offset = read_tree(&offset, ref._tree);
+    result.left._type = 3;
+    result.left.empty = result.left._offset == 0;
+    result.right._tree = ref._tree;
+    result.right._offset = read_tree(&offset, ref._tree);
+    result.right._type = 3;
+    result.right.empty = result.right._offset == 0;
+    return result;
+}
+struct parsed_identifier parsed_identifier_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 4) {
+        return (struct parsed_identifier){
+            {0}
+        };
+    }
+    size_t offset = ref._offset;
+    read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
+    size_t token_offset = read_tree(&offset, ref._tree);
+    read_tree(&token_offset, ref._tree);
+    size_t start_location = read_tree(&token_offset, ref._tree);
+    size_t end_location = start_location + read_tree(&token_offset, ref._tree);
+    struct parsed_identifier result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .identifier = ref._tree->string + start_location,
+        .length = end_location - start_location,
+    };
+    return result;
+}
+struct parsed_integer parsed_integer_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 5) {
+        return (struct parsed_integer){
+            {0}
+        };
+    }
+    size_t offset = ref._offset;
+    read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
+    size_t token_offset = read_tree(&offset, ref._tree);
+    read_tree(&token_offset, ref._tree);
+    size_t start_location = read_tree(&token_offset, ref._tree);
+    size_t end_location = start_location + read_tree(&token_offset, ref._tree);
+    struct parsed_integer result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .integer = read_tree(&token_offset, ref._tree),
+    };
+    return result;
+}
+struct parsed_string parsed_string_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 6) {
+        return (struct parsed_string){
+            {0}
+        };
+    }
+    size_t offset = ref._offset;
+    read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
+    size_t token_offset = read_tree(&offset, ref._tree);
+    read_tree(&token_offset, ref._tree);
+    size_t start_location = read_tree(&token_offset, ref._tree);
+    size_t end_location = start_location + read_tree(&token_offset, ref._tree);
+    size_t string_offset = read_tree(&token_offset, ref._tree);
+    const char *string = string_offset ?
+     (const char *)ref._tree->parse_tree + string_offset : ref._tree->string + start_location + 1;
+    size_t string_length = string_offset ?
+     read_tree(&token_offset, ref._tree) : end_location - start_location - 2;
+    struct parsed_string result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .string = string,
+        .length = string_length,
+    };
+    return result;
+}
+static size_t number_of_slots_lookup(uint32_t rule, void *context);
+static size_t build_node(uint32_t rule, uint32_t choice, size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, struct owl_tree *tree) {
+    void *children[7];
+    size_t number_of_slots = number_of_slots_lookup(rule, tree);
+    for (size_t i = 0; i < number_of_slots; ++i)
+        children[i] = (void *)(uintptr_t)slots[i];
+    struct owl_match match = {
+        .rule = (enum owl_rule)rule,
+        .range = { start_location, end_location },
+        .slots = children,
+    };
+    switch (rule) {
+    case 2:
+        switch (choice) {
+        case 0:
+            match.type = PARSED_LET;
+            break;
+        case 1:
+            match.type = PARSED_RETURN;
+            break;
+        case 2:
+            match.type = PARSED_IF;
+            break;
+        case 3:
+            match.type = PARSED_EXPR;
+            break;
+        }
+        break;
+    case 3:
+        switch (choice) {
+        case 0:
+            match.type = PARSED_VARIABLE;
+            break;
+        case 1:
+            match.type = PARSED_INTEGER;
+            break;
+        case 2:
+            match.type = PARSED_STRING;
+            break;
+        case 3:
+            match.type = PARSED_CALL;
+            break;
+        case 4:
+            match.type = PARSED_TIMES;
+            break;
+        case 5:
+            match.type = PARSED_PLUS;
+            break;
+        case 6:
+            match.type = PARSED_EQUALS;
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);
+}
+static size_t build_token(uint32_t rule, size_t next_sibling, struct owl_tree *tree) {
+    struct owl_match match = { .rule = (enum owl_rule)rule };
+    switch (rule) {
+    case 4: {
+        size_t offset = tree->next_identifier_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_identifier_token_offset -= read_tree(&offset, tree);
+        match.range.start = read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        match.identifier = tree->string + match.range.start;
+        match.length = match.range.end - match.range.start;
+        break;
+    }
+    case 5: {
+        size_t offset = tree->next_integer_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_integer_token_offset -= read_tree(&offset, tree);
+        match.range.start = read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        match.integer = read_tree(&offset, tree);
+        break;
+    }
+    case 6: {
+        size_t offset = tree->next_string_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_string_token_offset -= read_tree(&offset, tree);
+        match.range.start = read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        size_t string_offset = read_tree(&offset, tree);
+        if (string_offset) {
+            match.string = (const char *)tree->parse_tree + string_offset;
+            match.length = read_tree(&offset, tree);
+        } else {
+            match.string = tree->string + match.range.start + 1;
+            match.length = match.range.end - match.range.start - 2;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);
+}
+static size_t finish_node(uint32_t rule, uint32_t choice, size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, void *info) {
+    struct owl_tree *tree = info;
+    if (tree->builder)
+        return build_node(rule, choice, next_sibling, slots, start_location, end_location, tree);
+    size_t offset = tree->next_offset;
+    write_tree(tree, next_sibling ? offset - next_sibling : 0);
+    write_tree(tree, start_location);
+    write_tree(tree, end_location - start_location);
+    switch (rule) {
+    case 0: {
+        write_tree(tree, slots[0]);
+        break;
+    }
+    case 1: {
+        write_tree(tree, slots[0]);
+        write_tree(tree, slots[1]);
+        break;
+    }
+    case 2: {
+        switch (choice) {
+        case 0:
+            write_tree(tree, PARSED_LET);
+            break;
+        case 1:
+            write_tree(tree, PARSED_RETURN);
+            break;
+        case 2:
+            write_tree(tree, PARSED_IF);
+            break;
+        case 3:
+            write_tree(tree, PARSED_EXPR);
+            break;
+        }
+        write_tree(tree, slots[0]);
+        write_tree(tree, slots[1]);
+        write_tree(tree, slots[2]);
+        break;
+    }
+    case 3: {
+        switch (choice) {
+        case 0:
+            write_tree(tree, PARSED_VARIABLE);
+            break;
+        case 1:
+            write_tree(tree, PARSED_INTEGER);
+            break;
+        case 2:
+            write_tree(tree, PARSED_STRING);
+            break;
+        case 3:
+            write_tree(tree, PARSED_CALL);
+            break;
+        case 4:
+            write_tree(tree, PARSED_TIMES);
+            break;
+        case 5:
+            write_tree(tree, PARSED_PLUS);
+            break;
+        case 6:
+            write_tree(tree, PARSED_EQUALS);
+            break;
+        }
+        write_tree(tree, slots[0]);
+        write_tree(tree, slots[1]);
+        write_tree(tree, slots[2]);
+        write_tree(tree, slots[3]);
+        write_tree(tree, slots[4]);
+        write_tree(tree, slots[5]);
+        break;
+    }
+    default:
+        break;
+    }
+    return offset;
+}
+static size_t finish_token(uint32_t rule, size_t next_sibling, void *info) {
+    struct owl_tree *tree = info;
+    if (tree->builder)
+        return build_token(rule, next_sibling, tree);
+    size_t offset = tree->next_offset;
+    write_tree(tree, next_sibling ? offset - next_sibling : 0);
+    switch (rule) {
+    case 4: {
+        size_t offset4 = tree->next_identifier_token_offset;
+        if (offset4 == 0)
+            abort();
+        write_tree(tree, offset4);
+        tree->next_identifier_token_offset = offset4;
+        tree->next_identifier_token_offset -= read_tree(&offset4, tree);
+        break;
+    }
+    case 5: {
+        size_t offset5 = tree->next_integer_token_offset;
+        if (offset5 == 0)
+            abort();
+        write_tree(tree, offset5);
+        tree->next_integer_token_offset = offset5;
+        tree->next_integer_token_offset -= read_tree(&offset5, tree);
+        break;
+    }
+    case 6: {
+        size_t offset6 = tree->next_string_token_offset;
+        if (offset6 == 0)
+            abort();
+        write_tree(tree, offset6);
+        tree->next_string_token_offset = offset6;
+        tree->next_string_token_offset -= read_tree(&offset6, tree);
+        break;
+    }
+    default:
+        break;
+    }
+    return offset;
+}
+static void check_for_error(struct owl_tree *tree) {
+    if (tree->error == ERROR_NONE)
+        return;
+    fprintf(stderr, "parse error: ");
+    switch (tree->error) {
+    case ERROR_INVALID_FILE:
+        fprintf(stderr, "invalid file\n");
+        break;
+    case ERROR_INVALID_OPTIONS:
+        fprintf(stderr, "invalid options\n");
+        break;
+    case ERROR_INVALID_TOKEN:
+        fprintf(stderr, "invalid token '%.*s'\n", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);
+        break;
+    case ERROR_UNEXPECTED_TOKEN:
+        fprintf(stderr, "unexpected token '%.*s'\n", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);
+        break;
+    case ERROR_MORE_INPUT_NEEDED:
+        fprintf(stderr, "more input needed\n");
+        break;
+    default:
+        break;
+    }
+    exit(-1);
+}
+static void parsed_program_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_function_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_statement_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_expr_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_identifier_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_integer_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_string_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_program_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_program it = parsed_program_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("program");
+        if (strcmp("program", slot_name))
+            printf("@%s", slot_name);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        parsed_function_print(tree, it.function, "function", indent + 1);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_function_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_function it = parsed_function_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("function");
+        if (strcmp("function", slot_name))
+            printf("@%s", slot_name);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        parsed_identifier_print(tree, it.identifier, "identifier", indent + 1);
+        parsed_statement_print(tree, it.statement, "statement", indent + 1);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_statement_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_statement it = parsed_statement_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("statement");
+        if (strcmp("statement", slot_name))
+            printf("@%s", slot_name);
+        switch (it.type) {
+        case PARSED_LET:
+            printf(" : LET");
+            break;
+        case PARSED_RETURN:
+            printf(" : RETURN");
+            break;
+        case PARSED_IF:
+            printf(" : IF");
+            break;
+        case PARSED_EXPR:
+            printf(" : EXPR");
+            break;
+        default:
+            break;
+        }
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        parsed_identifier_print(tree, it.identifier, "identifier", indent + 1);
+        parsed_expr_print(tree, it.expr, "expr", indent + 1);
+        parsed_statement_print(tree, it.statement, "statement", indent + 1);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_expr_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_expr it = parsed_expr_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("expr");
+        if (strcmp("expr", slot_name))
+            printf("@%s", slot_name);
+        switch (it.type) {
+        case PARSED_VARIABLE:
+            printf(" : VARIABLE");
+            break;
+        case PARSED_INTEGER:
+            printf(" : INTEGER");
+            break;
+        case PARSED_STRING:
+            printf(" : STRING");
+            break;
+        case PARSED_CALL:
+            printf(" : CALL");
+            break;
+        case PARSED_TIMES:
+            printf(" : TIMES");
+            break;
+        case PARSED_PLUS:
+            printf(" : PLUS");
+            break;
+        case PARSED_EQUALS:
+            printf(" : EQUALS");
+            break;
+        default:
+            break;
+        }
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        parsed_identifier_print(tree, it.identifier, "identifier", indent + 1);
+        parsed_integer_print(tree, it.integer, "integer", indent + 1);
+        parsed_string_print(tree, it.string, "string", indent + 1);
+        parsed_expr_print(tree, it.expr, "expr", indent + 1);
+        parsed_expr_print(tree, it.left, "left", indent + 1);
+        parsed_expr_print(tree, it.right, "right", indent + 1);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_identifier_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_identifier it = parsed_identifier_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("identifier");
+        if (strcmp("identifier", slot_name))
+            printf("@%s", slot_name);
+        printf(" - %.*s", (int)it.length, it.identifier);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_integer_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_integer it = parsed_integer_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("integer");
+        if (strcmp("integer", slot_name))
+            printf("@%s", slot_name);
+        printf(" - %" PRIu64, it.integer);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_string_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_string it = parsed_string_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("string");
+        if (strcmp("string", slot_name))
+            printf("@%s", slot_name);
+        printf(" - %.*s", (int)it.length, it.string);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        ref = owl_next(ref);
+    }
+}
+void owl_tree_print(struct owl_tree *tree) {
+    check_for_error(tree);
+    parsed_program_print(tree, owl_tree_root_ref(tree), "program", 0);
+}
+struct owl_ref owl_next(struct owl_ref ref) {
+    if (ref.empty) return ref;
+    size_t offset = ref._offset;
+    size_t delta = read_tree(&ref._offset, ref._tree);
+    return (struct owl_ref){
+        ._tree = ref._tree,
+        ._offset = offset - delta,
+        ._type = ref._type,
+        .empty = delta == 0,
+    };
+}
+bool owl_refs_equal(struct owl_ref a, struct owl_ref b) {
+    return a._tree == b._tree && a._offset == b._offset;
+}
+struct owl_ref owl_tree_root_ref(struct owl_tree *tree) {
+    check_for_error(tree);
+    return (struct owl_ref){
+        ._tree = tree,
+        ._offset = tree->root_offset,
+        ._type = 0,
+        .empty = tree->root_offset == 0,
+    };
+}
+struct parsed_program owl_tree_get_parsed_program(struct owl_tree *tree) {
+    check_for_error(tree);
+    return parsed_program_get(owl_tree_root_ref(tree));
+}
+#define ESCAPE_CHAR(c, info) ((c) == 'b' ? '\b' : (c) == 'f' ? '\f' : (c) == 'n' ? '\n' : (c) == 'r' ? '\r' : (c) == 't' ? '\t' : (c))
+#define IGNORE_TOKEN_WRITE(...)
+#define IGNORE_TOKEN_READ(...) (0)
+#define CUSTOM_TOKEN_DATA(...)
+#define IF_IDENTIFIER_TOKEN(cond, ...) if (cond) __VA_ARGS__
+#define INTEGER_TOKEN_DATA(name) uint64_t name
+#define IF_INTEGER_TOKEN(cond, ...) if (cond) __VA_ARGS__
+#define NUMBER_TOKEN_DATA(...)
+#define IF_NUMBER_TOKEN(...) if (0) { /* no number tokens */  }
+#define IF_STRING_TOKEN(cond, ...) if (cond) __VA_ARGS__
+static size_t read_whitespace(const char *text, size_t length, void *info);
+static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, size_t length, void *info);
+#define IF_IDENTIFIER_KEYWORDS(...)
+static void write_identifier_token(size_t offset, size_t length, void *info) {
+    struct owl_tree *tree = info;
+    size_t token_offset = tree->next_offset;
+    write_tree(tree, token_offset - tree->next_identifier_token_offset);
+    write_tree(tree, offset);
+    write_tree(tree, length);
+    tree->next_identifier_token_offset = token_offset;
+}
+static void write_integer_token(size_t offset, size_t length, uint64_t integer, void *info) {
+    struct owl_tree *tree = info;
+    size_t token_offset = tree->next_offset;
+    write_tree(tree, token_offset - tree->next_integer_token_offset);
+    write_tree(tree, offset);
+    write_tree(tree, length);
+    write_tree(tree, integer);
+    tree->next_integer_token_offset = token_offset;
+}
+static void write_string_token(size_t offset, size_t length, const char *string, size_t string_length, bool has_escapes, void *info) {
+    struct owl_tree *tree = info;
+    size_t string_offset = has_escapes ? (uint8_t *)string - tree->parse_tree : 0;
+    size_t token_offset = tree->next_offset;
+    write_tree(tree, token_offset - tree->next_string_token_offset);
+    write_tree(tree, offset);
+    write_tree(tree, length);
+    if (string_offset) {
+        write_tree(tree, string_offset);
+        write_tree(tree, string_length);
+    } else
+        write_tree(tree, 0);
+    tree->next_string_token_offset = token_offset;
+}
+static void *allocate_string_contents(size_t size, void *info) {
+    struct owl_tree *tree = info;
+    if (tree->next_offset + size > tree->parse_tree_size)
+        grow_tree(tree, tree->next_offset + size);
+    void *p = tree->parse_tree + tree->next_offset;
+    tree->next_offset += size;
+    return p;
+}
+// Vectorized scanners for the tokenizer.  These load whole aligned blocks,
+// which can include bytes past the end of the input.  Aligned loads never
+// cross a page boundary, so this is safe, but it upsets memory checkers like
+// AddressSanitizer.  Define OWL_NO_SIMD to use the scalar loops instead.
+#if !defined(OWL_NO_SIMD) && defined(__SANITIZE_ADDRESS__)
+#define OWL_NO_SIMD
+#endif
+#if !defined(OWL_NO_SIMD) && defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define OWL_NO_SIMD
+#endif
+#endif
+#if !defined(OWL_NO_SIMD) && defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define OWL_SIMD
+enum vector_scan_class {
+    VECTOR_SCAN_IDENTIFIER,
+    VECTOR_SCAN_IDENTIFIER_WITH_DASHES,
+    VECTOR_SCAN_DIGITS,
+    VECTOR_SCAN_HEX_DIGITS,
+    VECTOR_SCAN_WHITESPACE,
+    VECTOR_SCAN_STRING,
+    VECTOR_SCAN_LINE,
+};
+typedef unsigned char vector_bytes_sse2 __attribute__((vector_size(16), may_alias));
+typedef char vector_mask_sse2 __attribute__((vector_size(16)));
+static inline  vector_mask_sse2 vector_equal_sse2(vector_bytes_sse2 x, unsigned char c) {
+    return (vector_mask_sse2)(x == c);
+}
+static inline  vector_mask_sse2 vector_in_range_sse2(vector_bytes_sse2 x, unsigned char low, unsigned char high) {
+    return (vector_mask_sse2)(x - low <= (unsigned char)(high - low));
+}
+static inline  uint32_t vector_stop_mask_sse2(vector_bytes_sse2 x, enum vector_scan_class kind, char quote) {
+    vector_mask_sse2 keep = {0};
+    vector_bytes_sse2 lowercase = x | 0x20;
+    switch (kind) {
+    case VECTOR_SCAN_IDENTIFIER_WITH_DASHES:
+        keep = vector_equal_sse2(x, '-');
+        // Fall through.
+    case VECTOR_SCAN_IDENTIFIER:
+        keep |= vector_equal_sse2(x, '_') | vector_in_range_sse2(lowercase, 'a', 'z') | vector_in_range_sse2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_HEX_DIGITS:
+        keep = vector_in_range_sse2(lowercase, 'a', 'f');
+        // Fall through.
+    case VECTOR_SCAN_DIGITS:
+        keep |= vector_in_range_sse2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_WHITESPACE:
+        keep |= vector_equal_sse2(x, 32);
+        keep |= vector_equal_sse2(x, 9);
+        keep |= vector_equal_sse2(x, 10);
+        keep |= vector_equal_sse2(x, 13);
+        break;
+    case VECTOR_SCAN_STRING:
+        keep = vector_equal_sse2(x, (unsigned char)quote) | vector_equal_sse2(x, '\\') | vector_equal_sse2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb128(keep);
+    case VECTOR_SCAN_LINE:
+        keep = vector_equal_sse2(x, '\n') | vector_equal_sse2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb128(keep);
+    }
+    // Zero bytes never belong to a run.
+    return ~(uint32_t)__builtin_ia32_pmovmskb128(keep) & 0xffffu;
+}
+// Here, `offset` must be less than `end`.  Aligned blocks which contain at
+// least one byte of the text can't cross into an unmapped page.
+static inline  size_t vector_scan_sse2(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)(16 - 1));
+    uint32_t stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote) & (0xffffu << (start - block));
+    while (!stop) {
+        block += 16;
+        if (block >= text + end)
+            return end;
+        stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote);
+    }
+    size_t stop_offset = (size_t)(block - text) + (size_t)__builtin_ctz(stop);
+    return stop_offset < end ? stop_offset : end;
+}
+typedef unsigned char vector_bytes_avx2 __attribute__((vector_size(32), may_alias));
+typedef char vector_mask_avx2 __attribute__((vector_size(32)));
+static inline __attribute__((target("avx2")))  vector_mask_avx2 vector_equal_avx2(vector_bytes_avx2 x, unsigned char c) {
+    return (vector_mask_avx2)(x == c);
+}
+static inline __attribute__((target("avx2")))  vector_mask_avx2 vector_in_range_avx2(vector_bytes_avx2 x, unsigned char low, unsigned char high) {
+    return (vector_mask_avx2)(x - low <= (unsigned char)(high - low));
+}
+static inline __attribute__((target("avx2")))  uint32_t vector_stop_mask_avx2(vector_bytes_avx2 x, enum vector_scan_class kind, char quote) {
+    vector_mask_avx2 keep = {0};
+    vector_bytes_avx2 lowercase = x | 0x20;
+    switch (kind) {
+    case VECTOR_SCAN_IDENTIFIER_WITH_DASHES:
+        keep = vector_equal_avx2(x, '-');
+        // Fall through.
+    case VECTOR_SCAN_IDENTIFIER:
+        keep |= vector_equal_avx2(x, '_') | vector_in_range_avx2(lowercase, 'a', 'z') | vector_in_range_avx2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_HEX_DIGITS:
+        keep = vector_in_range_avx2(lowercase, 'a', 'f');
+        // Fall through.
+    case VECTOR_SCAN_DIGITS:
+        keep |= vector_in_range_avx2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_WHITESPACE:
+        keep |= vector_equal_avx2(x, 32);
+        keep |= vector_equal_avx2(x, 9);
+        keep |= vector_equal_avx2(x, 10);
+        keep |= vector_equal_avx2(x, 13);
+        break;
+    case VECTOR_SCAN_STRING:
+        keep = vector_equal_avx2(x, (unsigned char)quote) | vector_equal_avx2(x, '\\') | vector_equal_avx2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb256(keep);
+    case VECTOR_SCAN_LINE:
+        keep = vector_equal_avx2(x, '\n') | vector_equal_avx2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb256(keep);
+    }
+    // Zero bytes never belong to a run.
+    return ~(uint32_t)__builtin_ia32_pmovmskb256(keep) & 0xffffffffu;
+}
+// Here, `offset` must be less than `end`.  Aligned blocks which contain at
+// least one byte of the text can't cross into an unmapped page.
+static inline __attribute__((target("avx2")))  size_t vector_scan_avx2(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)(32 - 1));
+    uint32_t stop = vector_stop_mask_avx2(*(const vector_bytes_avx2 *)block, kind, quote) & (0xffffffffu << (start - block));
+    while (!stop) {
+        block += 32;
+        if (block >= text + end)
+            return end;
+        stop = vector_stop_mask_avx2(*(const vector_bytes_avx2 *)block, kind, quote);
+    }
+    size_t stop_offset = (size_t)(block - text) + (size_t)__builtin_ctz(stop);
+    return stop_offset < end ? stop_offset : end;
+}
+static inline size_t vector_scan(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    if (offset >= end)
+        return end;
+#ifdef __AVX2__
+    return vector_scan_avx2(text, offset, end, kind, quote);
+#else
+    // Most runs end within the first block, so only dispatch to AVX2 for the
+    // rest of a longer run.
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)15);
+    uint32_t stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote) & (0xffffu << (start - block));
+    offset = (size_t)(block - text) + (stop ? (size_t)__builtin_ctz(stop) : 16);
+    if (stop || offset >= end)
+        return offset < end ? offset : end;
+    if (__builtin_cpu_supports("avx2"))
+        return vector_scan_avx2(text, offset, end, kind, quote);
+    return vector_scan_sse2(text, offset, end, kind, quote);
+#endif
+}
+#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) vector_scan(text, offset, end, VECTOR_SCAN_IDENTIFIER_WITH_DASHES, 0)
+#define SKIP_DIGITS(text, offset, end, hexadecimal) vector_scan(text, offset, end, (hexadecimal) ? VECTOR_SCAN_HEX_DIGITS : VECTOR_SCAN_DIGITS, 0)
+#define SKIP_STRING_CHARS(text, offset, end, quote) vector_scan(text, offset, end, VECTOR_SCAN_STRING, quote)
+#define SKIP_LINE(text, offset, end) vector_scan(text, offset, end, VECTOR_SCAN_LINE, 0)
+#else
+#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) (offset)
+#define SKIP_DIGITS(text, offset, end, hexadecimal) (offset)
+#define SKIP_STRING_CHARS(text, offset, end, quote) (offset)
+#define SKIP_LINE(text, offset, end) (offset)
+#endif
+struct owl_token_run {
+    struct owl_token_run *prev;
+    uint16_t number_of_tokens;
+    uint16_t lengths_size;
+    uint8_t lengths[4096 * 2];
+    uint32_t tokens[4096];
+    uint32_t states[4096];
+};
+struct owl_default_tokenizer {
+    const char *text;
+    size_t length;
+    size_t offset;
+    size_t whitespace;
+    uint32_t identifier_token;
+    uint32_t number_token;
+    uint32_t string_token;
+    void *info;
+    bool more_input;
+    bool deferred;
+    size_t lookahead;
+    struct owl_token_run *free_runs;
+    void *allocator;
+};
+static bool char_is_whitespace(char c) {
+    switch (c) {
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+        return true;
+    default:
+        return false;
+    }
+}
+static bool char_is_numeric(char c) {
+    return c >= '0' && c <= '9';
+}
+static bool char_is_alphabetic(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+static bool char_is_hexadecimal_alpha(char c) {
+    return (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+static bool char_starts_identifier(char c) {
+    return char_is_alphabetic(c) || c == '_';
+}
+static bool char_continues_identifier(char c, void *info) {
+    if (true && c == '-') return true;
+    return char_is_numeric(c) || char_starts_identifier(c);
+}
+static bool char_ends_identifier(char c) {
+    return c != '-';
+}
+static inline uint64_t read_eight_bytes(const char *text) {
+    uint8_t b[8];
+    memcpy(b, text, 8);
+    return (uint64_t)b[0] | (uint64_t)b[1] << 8 | (uint64_t)b[2] << 16 | (uint64_t)b[3] << 24 | (uint64_t)b[4] << 32 | (uint64_t)b[5] << 40 | (uint64_t)b[6] << 48 | (uint64_t)b[7] << 56;
+}
+static inline bool eight_bytes_are_digits(uint64_t chunk) {
+    return !(((chunk + 0x4646464646464646) | (chunk - 0x3030303030303030)) & 0x8080808080808080);
+}
+static inline uint32_t eight_digits_value(uint64_t chunk) {
+    chunk -= 0x3030303030303030;
+    chunk = chunk * 10 + (chunk >> 8);
+    chunk = ((chunk & 0x000000ff000000ff) * 0x000f424000000064 + ((chunk >> 16) & 0x000000ff000000ff) * 0x0000271000000001) >> 32;
+    return (uint32_t)chunk;
+}
+static bool encode_length(struct owl_token_run *run, uint16_t *lengths_size, size_t length) {
+    uint8_t mark = 0;
+    while (*lengths_size < sizeof(run->lengths)) {
+        run->lengths[*lengths_size] = mark | (length & 0x7f);
+        mark = 0x80;
+        length >>= 7;
+        (*lengths_size)++;
+        if (length == 0) return true;
+    }
+    return false;
+}
+static bool encode_token_length(struct owl_token_run *run, uint16_t *lengths_size, size_t length, size_t whitespace) {
+    uint16_t size = *lengths_size;
+    if (encode_length(run, lengths_size, length) && encode_length(run, lengths_size, whitespace)) return true;
+    *lengths_size = size;
+    return false;
+}
+static size_t decode_length(struct owl_token_run *run, uint16_t *length_offset) {
+    size_t length = 0;
+    while (*length_offset < sizeof(run->lengths)) {
+        size_t l = run->lengths[(*length_offset)--];
+        length <<= 7;
+        length += l & 0x7f;
+        if (!(l & 0x80)) return length;
+    }
+    abort();
+}
+static size_t decode_token_length(struct owl_token_run *run, uint16_t *length_offset, size_t *string_offset) {
+    size_t whitespace = decode_length(run, length_offset);
+    size_t length = decode_length(run, length_offset);
+    *string_offset -= whitespace + length;
+    return length;
+}
+static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer, struct owl_token_run **previous_run) {
+    struct owl_token_run *run = tokenizer->free_runs;
+    if (run) tokenizer->free_runs = run->prev;
+    else {
+        run = allocate_memory(sizeof(struct owl_token_run), tokenizer->allocator);
+        if (!run) return false;
+    }
+    uint16_t number_of_tokens = 0;
+    uint16_t lengths_size = 0;
+    const char *text = tokenizer->text;
+    size_t whitespace = tokenizer->whitespace;
+    size_t length = tokenizer->length;
+    size_t offset = tokenizer->offset;
+    size_t limit = SIZE_MAX;
+    size_t token_limit = length;
+    if (tokenizer->more_input) {
+        limit = length;
+    token_limit = length > tokenizer->lookahead ? length - tokenizer->lookahead :
+        0;
+    }
+    bool deferred = false;
+    while (number_of_tokens < 4096) {
+        if (offset >= token_limit) {
+            deferred = tokenizer->more_input;
+            break;
+        }
+        char c = text[offset];
+        size_t whitespace_length = read_whitespace(text + offset, length - offset, tokenizer->info);
+        if (whitespace_length > 0) {
+            whitespace += whitespace_length;
+            offset += whitespace_length;
+            continue;
+        }
+        uint32_t token = -1;
+        CUSTOM_TOKEN_DATA(custom_data);
+        uint64_t integer = 0;
+        NUMBER_TOKEN_DATA(number);
+        bool is_token = false;
+        bool end_token = false;
+        bool custom_token = false;
+        bool comment = false;
+        bool custom_whitespace = false;
+        bool has_escapes = false;
+        size_t token_length = read_keyword_token(&token, &end_token, text + offset, length - offset, tokenizer->info);
+        if (token_length > 0) {
+            is_token = true;
+            if (token == 4294967295U) comment = true;
+        }
+        if (IGNORE_TOKEN_READ(&token, &token_length, text + offset, length - offset, &custom_whitespace, &custom_data, tokenizer->info)) {
+            is_token = true;
+            custom_token = true;
+            end_token = false;
+            comment = false;
+        }
+        IF_INTEGER_TOKEN(char_is_numeric(c), {
+            size_t integer_offset = offset;
+            uint64_t base = 10;
+            if (c == '0' && offset + 2 < length && (text[offset + 1] == 'x' || text[offset + 1] == 'X') && (char_is_numeric(text[offset + 2]) || char_is_hexadecimal_alpha(text[integer_offset + 2]))) {
+                integer_offset = offset + 2;
+                base = 16;
+            }
+            integer = 0;
+            bool overflow = false;
+            while (base == 10 && integer_offset + 8 <= length && integer <= (UINT64_MAX - 99999999) / 100000000) {
+                uint64_t chunk = read_eight_bytes(text + integer_offset);
+                if (!eight_bytes_are_digits(chunk)) break;
+                integer = integer * 100000000 + eight_digits_value(chunk);
+                integer_offset += 8;
+            }
+            size_t digits_end = SKIP_DIGITS(text, integer_offset, length, base == 16);
+            while (integer_offset < digits_end || (integer_offset < length && (char_is_numeric(text[integer_offset]) || (base == 16 && char_is_hexadecimal_alpha(text[integer_offset]))))) {
+                uint64_t last = integer;
+                integer *= base;
+                uint64_t ch = text[integer_offset];
+                if (ch >= '0' && ch <= '9') integer += ch - '0';
+                else if (ch >= 'a' && ch <= 'f') integer += ch - 'a' + 0xa;
+                else if (ch >= 'A' && ch <= 'F') integer += ch - 'A' + 0xA;
+                if (integer < last) {
+                    overflow = true;
+                    break;
+                }
+                integer_offset++;
+            }
+            if (integer_offset >= limit) deferred = true;
+            if (!overflow && integer_offset - offset > token_length) {
+                token_length = integer_offset - offset;
+                is_token = true;
+                end_token = false;
+                comment = false;
+                custom_whitespace = false;
+                token = 15;
+            }
+        }
+        ) IF_NUMBER_TOKEN(char_is_numeric(c) || (c == '.' && offset + 1 < length && char_is_numeric(text[offset + 1])), {
+            size_t number_length = 0;
+            number = read_number(text + offset, length - offset, &number_length, tokenizer->allocator);
+            if (offset + number_length + 3 > limit) deferred = true;
+            if (number_length > token_length) {
+                token_length = number_length;
+                is_token = true;
+                end_token = false;
+                comment = false;
+                custom_whitespace = false;
+                token = 4294967295U;
+            }
+        }
+        ) else IF_STRING_TOKEN(c == '\'' || c == '"', {
+            size_t string_offset = SKIP_STRING_CHARS(text, offset + 1, length, c);
+            while (string_offset < length && text[string_offset] != '\0') {
+                if (text[string_offset] == c) {
+                    token_length = string_offset + 1 - offset;
+                    is_token = true;
+                    end_token = false;
+                    comment = false;
+                    custom_whitespace = false;
+                    token = 16;
+                    break;
+                }
+                if (text[string_offset] == '\\') {
+                    has_escapes = true;
+                    string_offset++;
+                    if (string_offset >= length || text[string_offset] == '\0') break;
+                }
+                string_offset = SKIP_STRING_CHARS(text, string_offset + 1, length, c);
+            }
+            if (string_offset >= limit) deferred = true;
+        }
+        ) else IF_IDENTIFIER_TOKEN(char_starts_identifier(c), {
+            size_t identifier_offset = SKIP_IDENTIFIER_CHARS(text, offset + 1, length, tokenizer->info);
+            while (identifier_offset < length && char_continues_identifier(text[identifier_offset], tokenizer->info)) identifier_offset++;
+            if (identifier_offset >= limit) deferred = true;
+            while (!char_ends_identifier(text[identifier_offset - 1])) identifier_offset--;
+            if (identifier_offset - offset > token_length) {
+                token_length = identifier_offset - offset;
+                is_token = true;
+                end_token = false;
+                comment = false;
+                custom_whitespace = false;
+                token = 14;
+                IF_IDENTIFIER_KEYWORDS(!custom_token, {
+                    read_identifier_keyword(&token, &end_token, text + offset, token_length);
+                }
+            ) }
+        }
+        ) if (custom_token && offset + token_length >= token_limit) deferred = true;
+        if (deferred) break;
+        if (custom_whitespace) {
+            whitespace += token_length;
+            offset += token_length;
+            continue;
+        }
+        else if (comment) {
+            size_t line_end = SKIP_LINE(text, offset, length);
+            while (line_end < length && text[line_end] != '\0' && text[line_end] != '\n') line_end++;
+            if (line_end >= limit) {
+                deferred = true;
+                break;
+            }
+            whitespace += line_end - offset;
+            offset = line_end;
+            continue;
+        }
+        else if (!is_token || token == 4294967295U) {
+            tokenizer->offset = offset;
+            tokenizer->whitespace = whitespace;
+            tokenizer->deferred = false;
+            run->prev = tokenizer->free_runs;
+            tokenizer->free_runs = run;
+            return false;
+        }
+        if (end_token && number_of_tokens + 1 >= 4096) break;
+        if (!encode_token_length(run, &lengths_size, token_length, whitespace)) break;
+        if (token == 14) {
+            write_identifier_token(offset, token_length, tokenizer->info);
+        }
+        else if (token == 15) {
+            write_integer_token(offset, token_length, integer, tokenizer->info);
+        }
+        else if (token == 4294967295U) {
+            IGNORE_TOKEN_WRITE(offset, token_length, number, tokenizer->info);
+        }
+        else if (token == 16) {
+            size_t content_offset = offset + 1;
+            size_t content_length = token_length - 2;
+            const char *string = text + content_offset;
+            size_t string_length = content_length;
+            if (has_escapes) {
+                size_t i;
+                for (i = 0;
+                i < content_length;
+                ++i) {
+                    if (text[content_offset + i] == '\\') {
+                        string_length--;
+                        i++;
+                    }
+                }
+                char *unescaped = allocate_string_contents(string_length, tokenizer->info);
+                size_t j = 0;
+                for (i = 0;
+                i < content_length;
+                ++i) {
+                    if (text[content_offset + i] == '\\') i++;
+                    unescaped[j++] = ESCAPE_CHAR(text[content_offset + i], tokenizer->info);
+                }
+                string = unescaped;
+            }
+            write_string_token(offset, token_length, string, string_length, has_escapes, tokenizer->info);
+        }
+        else if (custom_token) {
+            IGNORE_TOKEN_WRITE(offset, token_length, token, custom_data, tokenizer->info);
+        }
+        run->tokens[number_of_tokens] = token;
+        whitespace = 0;
+        number_of_tokens++;
+        offset += token_length;
+        if (end_token) {
+            assert(number_of_tokens < 4096);
+            run->tokens[number_of_tokens] = 4294967295U;
+            number_of_tokens++;
+        }
+    }
+    tokenizer->deferred = deferred;
+    if (number_of_tokens == 0) {
+        tokenizer->offset = offset;
+        tokenizer->whitespace = whitespace;
+        run->prev = tokenizer->free_runs;
+        tokenizer->free_runs = run;
+        return false;
+    }
+    tokenizer->offset = offset;
+    tokenizer->whitespace = whitespace;
+    run->prev = *previous_run;
+    run->number_of_tokens = number_of_tokens;
+    run->lengths_size = lengths_size;
+    *previous_run = run;
+    return true;
+}
+static void free_token_runs(struct owl_token_run **run, void *allocator) {
+    while (*run) {
+        struct owl_token_run *prev = (*run)->prev;
+        free_memory(*run, sizeof(struct owl_token_run), allocator);
+        *run = prev;
+    }
+}
+static void find_token_range(struct owl_default_tokenizer *tokenizer, struct owl_token_run *run, uint16_t index, size_t *start, size_t *end) {
+    size_t offset = tokenizer->offset - tokenizer->whitespace;
+    size_t last_offset = offset;
+    size_t len = 0;
+    uint16_t length_offset = run->lengths_size - 1;
+    uint16_t j;
+    for (j = index;
+    j < run->number_of_tokens;
+    ++j) {
+        if (run->tokens[j] == 4294967295U) continue;
+        last_offset = offset;
+        len = decode_token_length(run, &length_offset, &offset);
+    }
+    *start = last_offset - len;
+    *end = last_offset;
+}
+static void estimate_next_token_range(struct owl_default_tokenizer *tokenizer, size_t *start, size_t *end) {
+    *start = tokenizer->offset;
+    size_t i = tokenizer->offset + 1;
+    while (i < tokenizer->length && tokenizer->text[i] != '\0' && !char_is_whitespace(tokenizer->text[i]) && !char_continues_identifier(tokenizer->text[i], tokenizer->info)) i++;
+    *end = i;
+}
+static void find_end_range(struct owl_default_tokenizer *tokenizer, size_t *start, size_t *end) {
+    *start = tokenizer->offset - tokenizer->whitespace - 1;
+    *end = tokenizer->offset - tokenizer->whitespace;
+    if (*start > *end) {
+        *start = *end;
+        *end += 1;
+    }
+}
+static uint32_t rule_lookup(uint32_t parent, uint32_t slot, void *context);
+static void fixity_associativity_precedence_lookup(int *fixity_associativity, int *precedence, uint32_t rule, uint32_t choice, void *context);
+static size_t number_of_slots_lookup(uint32_t rule, void *context);
+static void left_right_operand_slots_lookup(uint32_t rule, uint32_t *left, uint32_t *right, uint32_t *operand, void *context);
+enum construct_fixity_associativity {
+CONSTRUCT_PREFIX, CONSTRUCT_POSTFIX, CONSTRUCT_INFIX_LEFT, CONSTRUCT_INFIX_RIGHT, CONSTRUCT_INFIX_FLAT, };
+struct construct_node {
+    struct construct_node *next;
+    size_t number_of_slots;
+    size_t *slots;
+    size_t slots_capacity;
+    uint32_t rule;
+    uint16_t slot_index;
+    uint16_t choice_index;
+    enum construct_fixity_associativity fixity_associativity;
+    int precedence;
+    size_t start_location;
+    size_t end_location;
+};
+struct construct_expression {
+    struct construct_expression *parent;
+    struct construct_node *first_operator;
+    struct construct_node *first_value;
+    uint32_t operand_slot_index;
+    uint32_t left_slot_index;
+    uint32_t right_slot_index;
+    uint32_t rule;
+    uint16_t slot_index;
+};
+enum construct_root_type {
+CONSTRUCT_NORMAL_ROOT, CONSTRUCT_EXPRESSION_ROOT, };
+struct construct_state {
+    enum construct_root_type root_type;
+    struct construct_node *under_construction;
+    struct construct_expression *current_expression;
+    struct construct_node *node_freelist;
+    struct construct_expression *expression_freelist;
+    void *info;
+    void *allocator;
+};
+static struct construct_node *construct_node_alloc(struct construct_state *s, uint32_t rule) {
+    struct construct_node *node;
+    size_t number_of_slots = number_of_slots_lookup(rule, s->info);
+    if (s->node_freelist) {
+        node = s->node_freelist;
+        s->node_freelist = node->next;
+        size_t *slots = node->slots;
+        size_t slots_capacity = node->slots_capacity;
+        if (number_of_slots > slots_capacity) {
+            slots = reallocate_memory(slots, slots_capacity * sizeof(size_t), number_of_slots * sizeof(size_t), s->allocator);
+            if (!slots) abort();
+            slots_capacity = number_of_slots;
+        }
+        memset(node, 0, sizeof(struct construct_node));
+        memset(slots, 0, number_of_slots * sizeof(size_t));
+        node->slots = slots;
+        node->slots_capacity = slots_capacity;
+    }
+    else {
+        node = allocate_memory(sizeof(struct construct_node), s->allocator);
+        if (!node) abort();
+        memset(node, 0, sizeof(struct construct_node));
+        if (number_of_slots > 0) {
+            node->slots = allocate_memory(number_of_slots * sizeof(size_t), s->allocator);
+            if (!node->slots) abort();
+            memset(node->slots, 0, number_of_slots * sizeof(size_t));
+        }
+        node->slots_capacity = number_of_slots;
+    }
+    node->rule = rule;
+    node->number_of_slots = number_of_slots;
+    return node;
+}
+static struct construct_expression *construct_expression_alloc(struct construct_state *s, uint32_t rule) {
+    struct construct_expression *expr;
+    if (s->expression_freelist) {
+        expr = s->expression_freelist;
+        s->expression_freelist = expr->parent;
+        memset(expr, 0, sizeof(struct construct_expression));
+    }
+    else {
+        expr = allocate_memory(sizeof(struct construct_expression), s->allocator);
+        if (!expr) abort();
+        memset(expr, 0, sizeof(struct construct_expression));
+    }
+    (left_right_operand_slots_lookup(rule, &(expr->left_slot_index), &(expr->right_slot_index), &(expr->operand_slot_index), s->info));
+    expr->rule = rule;
+    return expr;
+}
+static void construct_node_free(struct construct_state *state, struct construct_node *node) {
+    node->next = state->node_freelist;
+    state->node_freelist = node;
+}
+static void construct_expression_free(struct construct_state *state, struct construct_expression *expr) {
+    expr->parent = state->expression_freelist;
+    state->expression_freelist = expr;
+}
+static bool construct_expression_should_reduce(struct construct_state *s, struct construct_expression *expr, struct construct_node *node) {
+    if (node->fixity_associativity == CONSTRUCT_POSTFIX) return false;
+    struct construct_node *top = expr->first_operator;
+    if (!top) return false;
+    return node->precedence < top->precedence || (node->precedence == top->precedence && node->fixity_associativity == CONSTRUCT_INFIX_RIGHT);
+}
+static void construct_expression_reduce(struct construct_state *s, struct construct_expression *expr) {
+    struct construct_node *op = expr->first_operator;
+    if (op->fixity_associativity == CONSTRUCT_INFIX_FLAT) {
+        struct construct_node *first_value = expr->first_value;
+        struct construct_node *last_value = first_value;
+        struct construct_node *last_operator = op;
+        size_t operand = op->slots[expr->operand_slot_index];
+        struct construct_node *combined_op = construct_node_alloc(s, op->rule);
+        combined_op->choice_index = op->choice_index;
+        combined_op->slot_index = op->slot_index;
+        combined_op->fixity_associativity = op->fixity_associativity;
+        combined_op->precedence = op->precedence;
+        struct construct_node *reversed_values = 0;
+        while (last_operator && last_operator->choice_index == op->choice_index) {
+            struct construct_node *next_op = last_operator->next;
+            construct_node_free(s, last_operator);
+            last_operator = next_op;
+            assert(last_value);
+            struct construct_node *next_value = last_value->next;
+            last_value->next = reversed_values;
+            reversed_values = last_value;
+            last_value = next_value;
+        }
+        combined_op->start_location = first_value->start_location;
+        combined_op->end_location = last_value->end_location;
+        assert(last_value);
+        operand = (finish_node((last_value)->rule, (last_value)->choice_index, operand, (last_value)->slots, (last_value)->start_location, (last_value)->end_location, s->info));
+        combined_op->next = last_value->next;
+        construct_node_free(s, last_value);
+        while (reversed_values) {
+            operand = (finish_node((reversed_values)->rule, (reversed_values)->choice_index, operand, (reversed_values)->slots, (reversed_values)->start_location, (reversed_values)->end_location, s->info));
+            struct construct_node *next_value = reversed_values->next;
+            construct_node_free(s, reversed_values);
+            reversed_values = next_value;
+        }
+        expr->first_operator = last_operator;
+        expr->first_value = combined_op;
+        combined_op->slots[expr->operand_slot_index] = operand;
+    }
+    else if (op->fixity_associativity == CONSTRUCT_INFIX_LEFT || op->fixity_associativity == CONSTRUCT_INFIX_RIGHT) {
+        expr->first_operator = op->next;
+        struct construct_node *left = expr->first_value;
+        struct construct_node *right = left->next;
+        op->next = right->next;
+        expr->first_value = op;
+        op->start_location = left->start_location;
+        op->end_location = right->end_location;
+        op->slots[expr->left_slot_index] = (finish_node((left)->rule, (left)->choice_index, op->slots[expr->left_slot_index], (left)->slots, (left)->start_location, (left)->end_location, s->info));
+        op->slots[expr->right_slot_index] = (finish_node((right)->rule, (right)->choice_index, op->slots[expr->right_slot_index], (right)->slots, (right)->start_location, (right)->end_location, s->info));
+        construct_node_free(s, left);
+        construct_node_free(s, right);
+    }
+    else {
+        expr->first_operator = op->next;
+        struct construct_node *value = expr->first_value;
+        op->next = value->next;
+        expr->first_value = op;
+        if (value->start_location < op->start_location) op->start_location = value->start_location;
+        if (value->end_location > op->end_location) op->end_location = value->end_location;
+        op->slots[expr->operand_slot_index] = (finish_node((value)->rule, (value)->choice_index, op->slots[expr->operand_slot_index], (value)->slots, (value)->start_location, (value)->end_location, s->info));
+        construct_node_free(s, value);
+    }
+}
+static void construct_begin(struct construct_state *s, size_t offset, enum construct_root_type type) {
+    s->root_type = type;
+    uint32_t r = 0;
+    if (type == CONSTRUCT_EXPRESSION_ROOT) {
+        struct construct_expression *expr = construct_expression_alloc(s, r);
+        expr->parent = s->current_expression;
+        s->current_expression = expr;
+    }
+    else {
+        struct construct_node *node = construct_node_alloc(s, r);
+        node->next = s->under_construction;
+        node->end_location = offset;
+        s->under_construction = node;
+    }
+}
+static size_t construct_finish(struct construct_state *s, size_t offset) {
+    size_t finished = 0;
+    if (s->root_type == CONSTRUCT_EXPRESSION_ROOT) {
+        struct construct_expression *expr = s->current_expression;
+        s->current_expression = expr->parent;
+        while (expr->first_operator) construct_expression_reduce(s, expr);
+        struct construct_node *node = expr->first_value;
+        if (node) {
+            finished = (finish_node((node)->rule, (node)->choice_index, 0, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+            assert(node->next == 0);
+            construct_node_free(s, node);
+        }
+        construct_expression_free(s, expr);
+    }
+    else {
+        struct construct_node *node = s->under_construction;
+        s->under_construction = node->next;
+        node->start_location = offset;
+        finished = (finish_node((node)->rule, (node)->choice_index, 0, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+        construct_node_free(s, node);
+    }
+    return finished;
+}
+static void construct_free_pools(struct construct_state *s) {
+    while (s->node_freelist) {
+        struct construct_node *node = s->node_freelist;
+        s->node_freelist = node->next;
+        free_memory(node->slots, node->slots_capacity * sizeof(size_t), s->allocator);
+        free_memory(node, sizeof(struct construct_node), s->allocator);
+    }
+    while (s->expression_freelist) {
+        struct construct_expression *expr = s->expression_freelist;
+        s->expression_freelist = expr->parent;
+        free_memory(expr, sizeof(struct construct_expression), s->allocator);
+    }
+}
+static void construct_action_apply(struct construct_state *s, uint16_t action, size_t offset) {
+    switch ((((action) >> 12) & 0xf)) {
+    case 8:
+        {
+            struct construct_node *node = construct_node_alloc(s, rule_lookup(s->under_construction->rule, ((action) & 0xfff), s->info));
+            node->next = s->under_construction;
+            node->slot_index = ((action) & 0xfff);
+            node->end_location = offset;
+            s->under_construction = node;
+            break;
+        }
+    case 9:
+        {
+            struct construct_expression *expr = construct_expression_alloc(s, rule_lookup(s->under_construction->rule, ((action) & 0xfff), s->info));
+            expr->parent = s->current_expression;
+            s->current_expression = expr;
+            expr->slot_index = ((action) & 0xfff);
+            break;
+        }
+    case 1:
+        {
+            struct construct_node *node = s->under_construction;
+            node->start_location = offset;
+            s->under_construction = node->next;
+            size_t *finished;
+            finished = &s->under_construction->slots[node->slot_index];
+            *finished = (finish_node((node)->rule, (node)->choice_index, *finished, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+            construct_node_free(s, node);
+            break;
+        }
+    case 2:
+        {
+            struct construct_expression *expr = s->current_expression;
+            s->current_expression = expr->parent;
+            while (expr->first_operator) construct_expression_reduce(s, expr);
+            size_t *finished;
+            finished = &s->under_construction->slots[expr->slot_index];
+            struct construct_node *node = expr->first_value;
+            if (node) {
+                *finished = (finish_node((node)->rule, (node)->choice_index, *finished, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+                assert(node->next == 0);
+                construct_node_free(s, node);
+            }
+            construct_expression_free(s, expr);
+            break;
+        }
+    case 3:
+        s->under_construction->choice_index = ((action) & 0xfff);
+        break;
+    case 4:
+        {
+            uint16_t slot = ((action) & 0xfff);
+            size_t *finished = &s->under_construction->slots[slot];
+            *finished = finish_token(rule_lookup(s->under_construction->rule, slot, s->info), *finished, s->info);
+            break;
+        }
+    case 10:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = construct_node_alloc(s, expr->rule);
+            node->choice_index = ((action) & 0xfff);
+            node->end_location = offset;
+            node->rule = expr->rule;
+            node->next = s->under_construction;
+            s->under_construction = node;
+            break;
+        }
+    case 11:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = construct_node_alloc(s, expr->rule);
+            node->choice_index = ((action) & 0xfff);
+            node->end_location = offset;
+            node->rule = expr->rule;
+            enum construct_fixity_associativity fixity_associativity = 0;
+            int precedence = 0;
+            do {
+                int local = 0;
+                fixity_associativity_precedence_lookup(&local, &precedence, expr->rule, ((action) & 0xfff), s->info);
+                fixity_associativity = local;
+            }
+            while (0);
+            node->fixity_associativity = fixity_associativity;
+            node->precedence = precedence;
+            node->next = s->under_construction;
+            s->under_construction = node;
+            break;
+        }
+    case 5:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = s->under_construction;
+            node->start_location = offset;
+            s->under_construction = node->next;
+            node->next = expr->first_value;
+            expr->first_value = node;
+            break;
+        }
+    case 6:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = s->under_construction;
+            node->start_location = offset;
+            s->under_construction = node->next;
+            while (construct_expression_should_reduce(s, expr, node)) construct_expression_reduce(s, expr);
+            node->next = expr->first_operator;
+            expr->first_operator = node;
+            if (node->fixity_associativity == CONSTRUCT_PREFIX) construct_expression_reduce(s, expr);
+            break;
+        }
+    }
+}
+
+struct fill_run_continuation;
+struct fill_run_state {
+    uint32_t state;
+    uint32_t reachability_mask[1];
+    struct fill_run_continuation *cont;
+};
+struct fill_run_continuation {
+    struct fill_run_state *stack;
+    size_t top_index;
+    size_t capacity;
+    int error;
+    struct owl_allocator *allocator;
+};
+static const uint8_t state_transitions[105][22 + 1] = {
+    {1, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 2, 105, 105, 105, 105, 105, 105, 105, 105},
+    {106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 106, 3, 3, 106, 106},
+    {107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 4, 4, 107, 107, 107, 107},
+    {1, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 6, 105, 7, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 84, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 85, 86, 87, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 8, 9, 105, 105, 10, 11, 105, 105, 105, 12, 13, 14, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 74, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 66, 67, 68, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 58, 59, 60, 105, 105, 105, 105, 105, 105},
+    {108, 108, 108, 108, 108, 108, 108, 108, 15, 108, 108, 16, 17, 18, 108, 108, 108, 108, 108, 57, 57, 57, 108},
+    {105, 105, 105, 105, 105, 105, 105, 105, 15, 105, 105, 16, 17, 18, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 15, 105, 105, 16, 17, 18, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 19, 20, 105, 105, 21, 22, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 12, 13, 14, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 12, 13, 14, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 12, 13, 14, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 47, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 39, 40, 41, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 31, 32, 33, 105, 105, 105, 105, 105, 105},
+    {108, 108, 108, 108, 108, 108, 108, 108, 26, 108, 108, 27, 28, 29, 108, 108, 108, 108, 108, 30, 30, 30, 108},
+    {105, 105, 105, 105, 105, 105, 105, 105, 26, 105, 105, 27, 28, 29, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 26, 105, 105, 27, 28, 29, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 19, 20, 105, 105, 21, 22, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 26, 105, 105, 27, 28, 29, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 34, 35, 36, 109, 109, 109, 37, 37, 38, 38, 38, 109},
+    {107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 34, 35, 36, 107, 107, 107, 37, 37, 107, 107, 107, 107},
+    {107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 34, 35, 36, 107, 107, 107, 37, 37, 107, 107, 107, 107},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 31, 32, 33, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 31, 32, 33, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 31, 32, 33, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 19, 20, 105, 105, 21, 22, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 34, 35, 36, 107, 107, 107, 37, 37, 107, 107, 107, 107},
+    {108, 108, 108, 108, 108, 108, 108, 108, 42, 108, 108, 43, 44, 45, 108, 108, 108, 108, 108, 46, 46, 46, 108},
+    {105, 105, 105, 105, 105, 105, 105, 105, 42, 105, 105, 43, 44, 45, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 42, 105, 105, 43, 44, 45, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 19, 20, 105, 105, 21, 22, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 39, 40, 41, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 39, 40, 41, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 39, 40, 41, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 42, 105, 105, 43, 44, 45, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 48, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 49, 50, 51, 105, 105, 105, 105, 105, 105},
+    {108, 108, 108, 108, 108, 108, 108, 108, 52, 108, 108, 53, 54, 55, 108, 108, 108, 108, 108, 56, 56, 56, 108},
+    {105, 105, 105, 105, 105, 105, 105, 105, 52, 105, 105, 53, 54, 55, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 52, 105, 105, 53, 54, 55, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 19, 20, 105, 105, 21, 22, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 49, 50, 51, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 49, 50, 51, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 49, 50, 51, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 52, 105, 105, 53, 54, 55, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 15, 105, 105, 16, 17, 18, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 61, 62, 63, 109, 109, 109, 64, 64, 65, 65, 65, 109},
+    {107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 61, 62, 63, 107, 107, 107, 64, 64, 107, 107, 107, 107},
+    {107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 61, 62, 63, 107, 107, 107, 64, 64, 107, 107, 107, 107},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 58, 59, 60, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 58, 59, 60, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 58, 59, 60, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 19, 20, 105, 105, 21, 22, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 61, 62, 63, 107, 107, 107, 64, 64, 107, 107, 107, 107},
+    {108, 108, 108, 108, 108, 108, 108, 108, 69, 108, 108, 70, 71, 72, 108, 108, 108, 108, 108, 73, 73, 73, 108},
+    {105, 105, 105, 105, 105, 105, 105, 105, 69, 105, 105, 70, 71, 72, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 69, 105, 105, 70, 71, 72, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 19, 20, 105, 105, 21, 22, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 66, 67, 68, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 66, 67, 68, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 66, 67, 68, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 69, 105, 105, 70, 71, 72, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 75, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 76, 77, 78, 105, 105, 105, 105, 105, 105},
+    {108, 108, 108, 108, 108, 108, 108, 108, 79, 108, 108, 80, 81, 82, 108, 108, 108, 108, 108, 83, 83, 83, 108},
+    {105, 105, 105, 105, 105, 105, 105, 105, 79, 105, 105, 80, 81, 82, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 79, 105, 105, 80, 81, 82, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 19, 20, 105, 105, 21, 22, 105, 105, 105, 23, 24, 25, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 76, 77, 78, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 76, 77, 78, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 76, 77, 78, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 79, 105, 105, 80, 81, 82, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {108, 102, 108, 103, 108, 108, 108, 108, 108, 108, 108, 90, 91, 92, 108, 108, 108, 108, 108, 94, 94, 94, 108},
+    {105, 88, 105, 89, 105, 105, 105, 105, 105, 105, 105, 90, 91, 92, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 88, 105, 89, 105, 105, 105, 105, 105, 105, 105, 90, 91, 92, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 95, 96, 97, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 93, 86, 87, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 93, 86, 87, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 93, 86, 87, 105, 105, 105, 105, 105, 105},
+    {108, 88, 108, 89, 108, 108, 108, 108, 108, 108, 108, 90, 91, 92, 108, 108, 108, 108, 108, 94, 94, 94, 108},
+    {105, 88, 105, 89, 105, 105, 105, 105, 105, 105, 105, 90, 91, 92, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {108, 88, 108, 89, 108, 108, 108, 108, 108, 108, 108, 98, 99, 100, 108, 108, 108, 108, 108, 101, 101, 101, 108},
+    {105, 88, 105, 89, 105, 105, 105, 105, 105, 105, 105, 98, 99, 100, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 88, 105, 89, 105, 105, 105, 105, 105, 105, 105, 98, 99, 100, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 95, 96, 97, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 95, 96, 97, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 95, 96, 97, 105, 105, 105, 105, 105, 105},
+    {105, 88, 105, 89, 105, 105, 105, 105, 105, 105, 105, 98, 99, 100, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 104, 96, 97, 105, 105, 105, 105, 105, 105},
+    {105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105},
+    {108, 102, 108, 103, 108, 108, 108, 108, 108, 108, 108, 98, 99, 100, 108, 108, 108, 108, 108, 101, 101, 101, 108},
+};
+static const uint32_t bracket_state_masks[100][1] = {
+    {31},
+    {19},
+    {12},
+    {8},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {4},
+    {1},
+    {18},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {2},
+    {18},
+    {16},
+    {18},
+};
+static const uint32_t bracket_entry_masks[4][1] = {
+    {17},
+    {12},
+    {19},
+    {31},
+};
+static const uint32_t bracket_exit_symbols[100] = {
+    4294967295U, 4294967295U, 4294967295U, 17, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 18, 4294967295U,
+    4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U,
+    4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U,
+    4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U,
+    4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 19,
+    4294967295U, 4294967295U, 4294967295U, 4294967295U, 21, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U, 4294967295U,
+    4294967295U, 4294967295U, 20, 4294967295U,
+};
+static inline bool bracket_state_is_reachable(struct fill_run_state *top, uint32_t state) {
+    const uint32_t *mask = bracket_state_masks[state - 5];
+    return ((mask[0] & top->reachability_mask[0])) != 0;
+}
+static void table_state_step(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index);
+static void bracket_entry_state(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index, const uint32_t *mask) {
+    struct fill_run_continuation *cont = top->cont;
+    cont->top_index++;
+    if (cont->top_index >= cont->capacity) {
+        size_t new_capacity = (cont->capacity + 2) * 3 / 2;
+        if (new_capacity <= cont->capacity)
+            abort();
+        struct fill_run_state *new_states = reallocate_memory(cont->stack, cont->capacity * sizeof(struct fill_run_state), new_capacity * sizeof(struct fill_run_state), cont->allocator);
+        if (!new_states)
+            abort();
+        cont->stack = new_states;
+        cont->capacity = new_capacity;
+        top = &cont->stack[cont->top_index];
+    } else
+        top++;
+    top->cont = cont;
+    memcpy(top->reachability_mask, mask, sizeof(top->reachability_mask));
+    top->state = 5;
+    run->states[token_index] = 5;
+    table_state_step(run, top, token_index);
+    if (top->cont->error == -1)
+        top->cont->error = 1;
+}
+static OWL_DONT_INLINE void table_slow_transition(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index, uint8_t transition) {
+    if (transition > 105) {
+        bracket_entry_state(run, top, token_index, bracket_entry_masks[transition - 105 - 1]);
+        return;
+    }
+    uint32_t state = top->state;
+    if (state >= 5 && bracket_exit_symbols[state - 5] != UINT32_MAX) {
+        if (top->cont->top_index == 0) {
+            top->cont->error = 1;
+            return;
+        }
+        top->cont->top_index--;
+        top--;
+        run->tokens[token_index] = bracket_exit_symbols[state - 5];
+        run->states[token_index] = top->state;
+        table_state_step(run, top, token_index);
+        return;
+    }
+    top->cont->error = 1;
+}
+static void table_state_step(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+    uint32_t state = top->state;
+    if (state >= 5 && !bracket_state_is_reachable(top, state)) {
+        top->cont->error = -1;
+        return;
+    }
+    uint32_t token = run->tokens[token_index];
+    uint8_t transition = state_transitions[state][token < 22 ? token : 22];
+    if (transition < 105)
+        top->state = transition;
+    else
+        table_slow_transition(run, top, token_index, transition);
+}
+static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index) {
+    uint16_t token_index = 0;
+    uint16_t number_of_tokens = run->number_of_tokens;
+    struct fill_run_state *top = &cont->stack[cont->top_index];
+    uint32_t state = top->state;
+    while (token_index < number_of_tokens) {
+        run->states[token_index] = state;
+        if (state >= 5 && !bracket_state_is_reachable(top, state)) {
+            cont->error = -1;
+            *failing_index = token_index - 1;
+            return false;
+        }
+        uint32_t token = run->tokens[token_index];
+        uint8_t transition = state_transitions[state][token < 22 ? token : 22];
+        if (transition < 105)
+            state = transition;
+        else {
+            top->state = state;
+            table_slow_transition(run, top, token_index, transition);
+            if (cont->error) {
+                *failing_index = token_index - (cont->error > 0 ? 0 : 1);
+                return false;
+            }
+            top = &cont->stack[cont->top_index];
+            state = top->state;
+        }
+        token_index++;
+    }
+    top->state = state;
+    return true;
+}
+static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index);
+static size_t build_parse_tree(struct owl_parser *parser);
+
+static struct owl_tree *owl_tree_create_empty(struct owl_allocator allocator) {
+    struct owl_tree *tree = allocate_memory(sizeof(struct owl_tree), &allocator);
+    if (!tree)
+        abort();
+    *tree = (struct owl_tree){ .allocator = allocator };
+    return tree;
+}
+
+// The streaming parser waits for about this many bytes of new input before
+// tokenizing again, so token runs don't end up mostly empty.
+#ifndef FEED_BATCH_SIZE
+#define FEED_BATCH_SIZE 16384
+#endif
+struct owl_parser {
+    struct owl_tree *tree;
+    struct owl_allocator allocator;
+    struct owl_default_tokenizer tokenizer;
+    struct owl_token_run *token_run;
+    struct fill_run_continuation cont;
+    // The state stack and construct pools are only used while building the
+    // tree, but they're kept (along with the token runs and the fill_run stack)
+    // so later parses don't have to allocate them again.
+    uint32_t *state_stack;
+    size_t state_stack_capacity;
+    struct construct_state construct_state;
+    // Set once owl_parser_parse has built a tree, until the next reset.
+    bool finished;
+    // When validating, token runs are recycled as soon as they've been checked and
+    // no tree is built.
+    bool validating;
+    char *buffer;
+    size_t length;
+    size_t capacity;
+    size_t resume_length;
+};
+static void start_parsing(struct owl_parser *parser, struct owl_tree *tree) {
+    tree->next_offset = 1;
+    parser->tree = tree;
+    parser->tokenizer = (struct owl_default_tokenizer){
+        .info = tree,
+        .lookahead = 6,
+        .free_runs = parser->tokenizer.free_runs,
+        .allocator = &parser->allocator,
+    };
+    parser->token_run = 0;
+    parser->cont.allocator = &parser->allocator;
+    parser->construct_state.allocator = &parser->allocator;
+    if (!parser->cont.stack) {
+        parser->cont.capacity = 8;
+        parser->cont.stack = allocate_memory(parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);
+        if (!parser->cont.stack)
+            abort();
+    }
+    parser->cont.top_index = 0;
+    parser->cont.error = 0;
+    parser->cont.stack[0] = (struct fill_run_state){
+        .state = 0,
+        .cont = &parser->cont,
+    };
+}
+// Moves the parser's token runs to the tokenizer's free list.
+static void recycle_token_runs(struct owl_parser *parser) {
+    while (parser->token_run) {
+        struct owl_token_run *run = parser->token_run;
+        parser->token_run = run->prev;
+        run->prev = parser->tokenizer.free_runs;
+        parser->tokenizer.free_runs = run;
+    }
+}
+// Frees the memory kept between parses (but not the tree or input buffer).
+static void free_parser_memory(struct owl_parser *parser) {
+    free_token_runs(&parser->token_run, &parser->allocator);
+    free_token_runs(&parser->tokenizer.free_runs, &parser->allocator);
+    free_memory(parser->cont.stack, parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);
+    free_memory(parser->state_stack, parser->state_stack_capacity * sizeof(uint32_t), &parser->allocator);
+    construct_free_pools(&parser->construct_state);
+}
+// Tokenizes as much of the text as possible, running each token run through
+// the state machine.  Set `more_input` if more text will follow `length`.
+static bool parse_text(struct owl_parser *parser, const char *text, size_t length, bool more_input) {
+    struct owl_tree *tree = parser->tree;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    tokenizer->text = text;
+    tokenizer->length = length;
+    tokenizer->more_input = more_input;
+    uint16_t failing_index = 0;
+    while (owl_default_tokenizer_advance(tokenizer, &parser->token_run)) {
+        if (!fill_run_states(parser->token_run, &parser->cont, &failing_index)) {
+            tree->error = ERROR_UNEXPECTED_TOKEN;
+            find_token_range(tokenizer, parser->token_run, failing_index, &tree->error_range.start, &tree->error_range.end);
+            return false;
+        }
+        if (parser->validating) {
+            // Only the tokenizer's position is needed to report later errors, so
+            // the run and its token data can be reused.
+            recycle_token_runs(parser);
+            tree->next_offset = 1;
+        }
+    }
+    if (tokenizer->deferred)
+        return true;
+    if (tokenizer->offset < length) {
+        tree->error = ERROR_INVALID_TOKEN;
+        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);
+        return false;
+    }
+    return true;
+}
+static void finish_parsing(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    struct fill_run_state top = parser->cont.stack[parser->cont.top_index];
+    if (tree->error != ERROR_NONE) {
+        recycle_token_runs(parser);
+        return;
+    }
+    switch (top.state) {
+    case 0:
+    case 4:
+        break;
+    default:
+        tree->error = ERROR_MORE_INPUT_NEEDED;
+        find_end_range(&parser->tokenizer, &tree->error_range.start, &tree->error_range.end);
+        recycle_token_runs(parser);
+        return;
+    }
+    if (parser->validating)
+        return;
+    tree->root_offset = build_parse_tree(parser);
+}
+static void parse_string(struct owl_tree *tree, const char *string, size_t length, bool validate) {
+    struct owl_parser parser = { .allocator = tree->allocator, .validating = validate };
+    tree->string = string;
+    start_parsing(&parser, tree);
+    parse_text(&parser, string, length, false);
+    finish_parsing(&parser);
+    free_parser_memory(&parser);
+}
+static struct owl_tree *owl_tree_create_with_error(enum owl_error e) {
+    struct owl_tree *tree = owl_tree_create_empty((struct owl_allocator){ 0 });
+    tree->error = e;
+    return tree;
+}
+struct owl_tree *owl_tree_create_from_string(const char *string) {
+    return owl_tree_create_with_options((struct owl_tree_options){ .string = string });
+}
+struct owl_tree *owl_tree_create_from_file(FILE *file) {
+    if (!file)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    return owl_tree_create_with_options((struct owl_tree_options){ .file = file });
+}
+#ifdef OWL_MMAP
+// Reads the rest of `fd` into a new buffer.  For regular files, `size` is the
+// size of the file and the buffer is allocated once, at exactly that size.
+static char *read_file_descriptor(int fd, size_t size, size_t *length, size_t *capacity_out, struct owl_allocator *allocator) {
+    size_t capacity = size ? size : 65536;
+    char *buffer = allocate_memory(capacity, allocator);
+    size_t offset = 0;
+    while (buffer) {
+        if (offset == capacity) {
+            if (size)
+                break;
+            char *b = reallocate_memory(buffer, capacity, capacity * 2, allocator);
+            if (!b)
+                free_memory(buffer, capacity, allocator);
+            buffer = b;
+            capacity *= 2;
+            continue;
+        }
+        ssize_t n = read(fd, buffer + offset, capacity - offset);
+        if (n < 0) {
+            free_memory(buffer, capacity, allocator);
+            return 0;
+        }
+        if (n == 0)
+            break;
+        offset += (size_t)n;
+    }
+    *length = offset;
+    *capacity_out = capacity;
+    return buffer;
+}
+#endif
+struct owl_tree *owl_tree_create_from_path(const char *path) {
+    if (!path)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+#ifdef OWL_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    }
+    struct owl_tree *tree = owl_tree_create_empty((struct owl_allocator){ 0 });
+    size_t length = 0;
+    if (S_ISREG(st.st_mode) && st.st_size > 0 && (uintmax_t)st.st_size <= SIZE_MAX) {
+        length = (size_t)st.st_size;
+        void *map = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+#if defined(MADV_SEQUENTIAL)
+            madvise(map, length, MADV_SEQUENTIAL);
+#elif defined(POSIX_MADV_SEQUENTIAL)
+            posix_madvise(map, length, POSIX_MADV_SEQUENTIAL);
+#endif
+            tree->mapped_length = length;
+            tree->string = map;
+        }
+    }
+    if (!tree->mapped_length) {
+        // Pipes and other special files can't be mapped.
+        size_t capacity = 0;
+        char *string = read_file_descriptor(fd, length, &length, &capacity, &tree->allocator);
+        if (!string) {
+            close(fd);
+            owl_tree_destroy(tree);
+            return owl_tree_create_with_error(ERROR_INVALID_FILE);
+        }
+        tree->string = string;
+        tree->owned_string_size = capacity;
+    }
+    close(fd);
+    parse_string(tree, tree->string, length, false);
+    return tree;
+#else
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    struct owl_tree *tree = owl_tree_create_from_file(file);
+    fclose(file);
+    return tree;
+#endif
+}
+static bool allocator_options_are_valid(struct owl_tree_options options) {
+    return !options.allocate == !options.reallocate && !options.allocate == !options.deallocate;
+}
+static struct owl_allocator allocator_from_options(struct owl_tree_options options) {
+    return (struct owl_allocator){
+        .allocate = options.allocate,
+        .reallocate = options.reallocate,
+        .deallocate = options.deallocate,
+        .info = options.allocator_info,
+    };
+}
+// Creates a tree from the options.  If `validate` is set, the tree isn't built;
+// if `builder` is set, it's used to build nodes instead.
+static struct owl_tree *create_tree(struct owl_tree_options options, bool validate, const struct owl_builder *builder) {
+    if (!options.file == !options.string || !allocator_options_are_valid(options))
+        return owl_tree_create_with_error(ERROR_INVALID_OPTIONS);
+    struct owl_allocator allocator = allocator_from_options(options);
+    size_t len = 32;
+    if (options.file) {
+        char *str = 0;
+        size_t off = 0;
+        while (true) {
+            size_t old_len = str ? len : 0;
+            len = len * 3 / 2;
+            char *s = reallocate_memory(str, old_len, len, &allocator);
+            if (!s) {
+                free_memory(str, old_len, &allocator);
+                return 0;
+            }
+            str = s;
+            off += fread(str + off, 1, len - off, options.file);
+            if (off < len) {
+                str[off] = '\0';
+                break;
+            }
+        }
+        options.string = str;
+        options.length = off;
+    } else if (!options.length)
+        options.length = strlen(options.string);
+    struct owl_tree *tree = owl_tree_create_empty(allocator);
+    if (options.file)
+        tree->owned_string_size = len;
+    tree->builder = builder;
+    parse_string(tree, options.string, options.length, validate);
+    return tree;
+}
+struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options) {
+    return create_tree(options, false, 0);
+}
+enum owl_error owl_validate(const char *string, size_t length, struct source_range *error_range) {
+    return owl_validate_with_options((struct owl_tree_options){ .string = string, .length = length }, error_range);
+}
+enum owl_error owl_validate_with_options(struct owl_tree_options options, struct source_range *error_range) {
+    struct owl_tree *tree = create_tree(options, true, 0);
+    if (!tree)
+        return ERROR_INVALID_FILE;
+    enum owl_error error = owl_tree_get_error(tree, error_range);
+    owl_tree_destroy(tree);
+    return error;
+}
+enum owl_error owl_build(const char *string, size_t length, struct owl_builder builder, void **root, struct source_range *error_range) {
+    return owl_build_with_options((struct owl_tree_options){ .string = string, .length = length }, builder, root, error_range);
+}
+enum owl_error owl_build_with_options(struct owl_tree_options options, struct owl_builder builder, void **root, struct source_range *error_range) {
+    if (root)
+        *root = 0;
+    if (!builder.build)
+        return ERROR_INVALID_OPTIONS;
+    struct owl_tree *tree = create_tree(options, false, &builder);
+    if (!tree)
+        return ERROR_INVALID_FILE;
+    enum owl_error error = owl_tree_get_error(tree, error_range);
+    if (error == ERROR_NONE && root)
+        *root = (void *)(uintptr_t)tree->root_offset;
+    owl_tree_destroy(tree);
+    return error;
+}
+struct owl_parser *owl_parser_create(void) {
+    return owl_parser_create_with_options((struct owl_tree_options){ 0 });
+}
+struct owl_parser *owl_parser_create_with_options(struct owl_tree_options options) {
+    bool valid = allocator_options_are_valid(options);
+    struct owl_allocator allocator = { 0 };
+    if (valid)
+        allocator = allocator_from_options(options);
+    struct owl_parser *parser = allocate_memory(sizeof(struct owl_parser), &allocator);
+    if (!parser)
+        return 0;
+    *parser = (struct owl_parser){ .allocator = allocator };
+    parser->capacity = FEED_BATCH_SIZE;
+    parser->buffer = allocate_memory(parser->capacity, &allocator);
+    if (!parser->buffer) {
+        free_memory(parser, sizeof(struct owl_parser), &allocator);
+        return 0;
+    }
+    parser->buffer[0] = '\0';
+    parser->resume_length = FEED_BATCH_SIZE;
+    struct owl_tree *tree = owl_tree_create_empty(allocator);
+    if (options.file || options.string || !valid)
+        tree->error = ERROR_INVALID_OPTIONS;
+    start_parsing(parser, tree);
+    return parser;
+}
+bool owl_parser_feed(struct owl_parser *parser, const char *chunk, size_t length) {
+    if (parser->finished || parser->tree->error != ERROR_NONE)
+        return false;
+    if (length >= parser->capacity - parser->length) {
+        size_t capacity = parser->capacity;
+        while (length >= capacity - parser->length) {
+            if (capacity > SIZE_MAX / 2)
+                abort();
+            capacity *= 2;
+        }
+        char *buffer = reallocate_memory(parser->buffer, parser->capacity, capacity, &parser->allocator);
+        if (!buffer)
+            abort();
+        parser->buffer = buffer;
+        parser->capacity = capacity;
+    }
+    memcpy(parser->buffer + parser->length, chunk, length);
+    parser->length += length;
+    parser->buffer[parser->length] = '\0';
+    if (parser->length < parser->resume_length)
+        return true;
+    if (!parse_text(parser, parser->buffer, parser->length, true))
+        return false;
+    // If a long token is still incomplete, wait for the pending input to double
+    // before scanning it again.
+    size_t pending = parser->length - parser->tokenizer.offset;
+    parser->resume_length = parser->length + (pending > FEED_BATCH_SIZE ? pending : FEED_BATCH_SIZE);
+    return true;
+}
+struct owl_tree *owl_parser_finish(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    if (parser->finished)
+        free_memory(parser->buffer, parser->capacity, &parser->allocator);
+    else {
+        tree->string = parser->buffer;
+        tree->owned_string_size = parser->capacity;
+        if (tree->error == ERROR_NONE)
+            parse_text(parser, parser->buffer, parser->length, false);
+        finish_parsing(parser);
+    }
+    free_parser_memory(parser);
+    free_memory(parser, sizeof(struct owl_parser), &parser->allocator);
+    return tree;
+}
+void owl_parser_reset(struct owl_parser *parser) {
+    recycle_token_runs(parser);
+    struct owl_tree *tree = parser->tree;
+    *tree = (struct owl_tree){
+        .allocator = tree->allocator,
+        .parse_tree = tree->parse_tree,
+        .parse_tree_size = tree->parse_tree_size,
+        // Invalid options stay invalid.
+        .error = tree->error == ERROR_INVALID_OPTIONS ? ERROR_INVALID_OPTIONS : ERROR_NONE,
+    };
+    parser->finished = false;
+    parser->length = 0;
+    parser->buffer[0] = '\0';
+    parser->resume_length = FEED_BATCH_SIZE;
+    start_parsing(parser, tree);
+}
+struct owl_tree *owl_parser_parse(struct owl_parser *parser, const char *string) {
+    owl_parser_reset(parser);
+    struct owl_tree *tree = parser->tree;
+    parser->finished = true;
+    if (tree->error != ERROR_NONE)
+        return tree;
+    tree->string = string;
+    parse_text(parser, string, strlen(string), false);
+    finish_parsing(parser);
+    return tree;
+}
+void owl_parser_destroy(struct owl_parser *parser) {
+    if (!parser)
+        return;
+    free_parser_memory(parser);
+    owl_tree_destroy(parser->tree);
+    struct owl_allocator allocator = parser->allocator;
+    free_memory(parser->buffer, parser->capacity, &allocator);
+    free_memory(parser, sizeof(struct owl_parser), &allocator);
+}
+enum owl_error owl_tree_get_error(struct owl_tree *tree, struct source_range *error_range) {
+    if (error_range)
+        *error_range = tree->error_range;
+    return tree->error;
+}
+void owl_tree_destroy(struct owl_tree *tree) {
+    if (!tree)
+        return;
+    if (tree->owned_string_size)
+        free_memory((void *)tree->string, tree->owned_string_size, &tree->allocator);
+#ifdef OWL_MMAP
+    if (tree->mapped_length)
+        munmap((void *)tree->string, tree->mapped_length);
+#endif
+    struct owl_allocator allocator = tree->allocator;
+    free_memory(tree->parse_tree, tree->parse_tree_size, &allocator);
+    free_memory(tree, sizeof(struct owl_tree), &allocator);
+}
+static const uint16_t actions[] = {
+0,0,4096,0,4096,32768,0,4096,32769,12288,0,4096,32769,12289,0,4096,32769,12290,0,4096,32769,12291,0,4096,32770,12288,0,4096,32770,12289,
+0,4096,32770,12290,0,4096,32770,12291,0,16384,0,20480,8192,0,20480,8192,4096,0,20480,8192,4096,32769,12288,0,20480,8192,4096,32769,12289,0,
+20480,8192,4096,32769,12290,0,20480,8192,4096,32769,12291,0,20480,8192,4096,32770,12288,0,20480,8192,4096,32770,12289,0,20480,8192,4096,32770,12290,0,
+20480,8192,4096,32770,12291,0,20480,45060,0,20480,45061,0,20480,45062,0,24576,40960,16384,0,24576,40961,16385,0,24576,40962,16386,0,24576,40963,0,
+32768,0,32769,12288,0,32769,12289,0,32769,12290,0,32769,12291,0,32770,12288,0,32770,12289,0,32770,12290,0,32770,12291,0,36865,40960,16384,0,
+36865,40961,16385,0,36865,40962,16386,0,36865,40963,0,36867,40960,16384,0,36867,40961,16385,0,36867,40962,16386,0,36867,40963,0,};
+static const uint16_t action_table_displacements[564] = {
+19,305,51,59,1264,7,9,4,58,6,77,0,5,15,1,3,
+119,22,58,1,5,9,151,0,0,0,0,1,18,54,5,134,
+37,45,16,46,49,17,7,7,187,4,30,57,0,0,93,25,
+0,4,0,50,13,103,172,0,28,7,39,0,5,0,0,0,
+11,0,1,2,0,10,0,0,1,35,20,1,191,1,3,89,
+21,2,66,143,3,109,0,87,0,15,51,30,0,5,0,5,
+0,28,15,8,99,0,0,4,6,4,89,0,0,33,44,9,
+33,6,4,63,0,3,3,15,92,20,16,9,3,1,17,0,
+0,36,11,0,221,17,10,31,11,13,2,44,18,4,5,48,
+0,33,18,0,6,36,28,17,2,0,75,6,1,22,0,17,
+31,3,10,6,3,5,8,4,27,11,29,0,7,9,16,30,
+0,0,0,15,0,45,6,0,0,1,20,2,0,8,0,0,
+9,0,0,8,0,31,0,4,5,4,131,1,1,24,15,13,
+8,39,6,0,10,0,4,22,6,23,9,0,0,11,4,1,
+34,0,35,2,29,0,25,7,0,9,33,27,4,20,6,16,
+43,0,0,6,0,1,4,12,3,9,22,6,0,0,17,18,
+0,19,0,1,18,8,16,16,1,11,14,11,4,2,3,0,
+1,27,0,0,5,57,26,1,16,8,8,0,4,4,69,2,
+1,5,2,3,4,4,6,21,25,0,7,0,1,0,0,46,
+16,5,0,1,8,0,7,2,0,0,0,1,1,2,6,1,
+40,6,2,2,6,0,0,0,9,2,5,1,13,0,7,1,
+20,0,0,2,4,2,11,5,10,2,2,30,8,8,1,3,
+0,24,4,4,0,16,0,14,1,5,2,0,4,1,0,1,
+6,0,2,0,6,1,11,4,1,0,1,1,0,3,8,3,
+0,1,2,18,15,2,3,2,2,9,0,0,0,12,0,2,
+11,5,3,0,0,0,1,1,0,0,0,0,4,4,7,4,
+11,11,11,0,0,1,0,0,1,2,8,19,2,2,2,6,
+3,3,5,0,5,1,10,12,8,2,5,11,0,2,37,4,
+0,1,21,3,10,3,1,10,6,6,4,0,6,0,1,4,
+0,0,18,0,0,10,2,18,7,0,5,4,4,22,5,9,
+0,0,9,6,2,14,0,0,1,2,2,0,6,1,2,2,
+0,2,2,0,0,6,29,0,3,0,1,0,7,18,5,0,
+4,0,4,6,0,5,0,3,3,4,4,4,0,6,1,5,
+0,0,0,1,1,1,0,4,3,2,0,0,7,0,0,1,
+0,2,12,0,1,16,16,1,1,20,4,0,12,1,7,0,
+1,21,1,8,};
+static const uint8_t action_table[1128][7] = {
+{103,78,8,148,22,0,0,},{235,174,11,241,192,0,0,},{147,78,19,232,234,52,1,},{122,52,14,108,78,0,0,},{27,76,17,11,0,9,1,},{23,14,14,17,210,0,0,},
+{115,52,16,108,52,1,0,},{17,26,11,23,192,0,0,},{114,54,16,108,226,0,0,},{224,150,15,217,44,1,0,},{42,104,14,35,36,1,0,},{115,84,15,108,44,1,0,},
+{195,126,14,182,78,0,0,},{115,52,14,108,36,1,0,},{28,48,8,42,30,1,0,},{235,188,11,241,192,0,0,},{131,62,20,244,234,20,1,},{58,68,16,52,226,0,0,},
+{103,100,8,167,14,0,0,},{122,54,14,108,78,0,0,},{188,22,16,182,226,0,0,},{93,96,14,87,210,0,0,},{122,158,14,108,78,0,0,},{204,142,14,198,210,0,0,},
+{35,146,8,205,156,0,0,},{108,132,8,205,108,0,0,},{108,120,17,11,120,122,1,},{35,78,8,75,156,0,0,},{108,50,13,114,204,0,0,},{27,166,8,224,244,0,0,},
+{75,42,16,68,52,1,0,},{148,88,14,141,36,1,0,},{104,84,6,103,0,0,0,},{166,106,14,160,210,0,0,},{188,116,19,232,234,134,1,},{125,76,12,131,198,0,0,},
+{131,72,15,125,218,0,0,},{35,60,8,42,180,0,0,},{94,96,15,87,44,1,0,},{211,144,14,198,78,0,0,},{141,80,11,147,192,0,0,},{27,62,18,29,0,9,1,},
+{189,126,16,182,52,1,0,},{28,50,8,42,30,1,0,},{35,48,11,41,192,0,0,},{68,82,13,74,204,0,0,},{114,30,15,108,218,0,0,},{94,96,14,87,36,1,0,},
+{58,44,16,52,226,0,0,},{24,14,15,17,44,1,0,},{41,158,15,35,218,0,0,},{244,186,3,242,0,0,0,},{244,194,3,242,0,0,0,},{103,114,8,24,38,0,0,},
+{31,128,6,30,0,0,0,},{103,82,8,148,22,0,0,},{125,62,11,131,192,0,0,},{81,86,14,68,78,0,0,},{189,126,14,182,36,1,0,},{74,78,21,244,234,162,0,},
+{59,72,14,52,36,1,0,},{27,48,8,115,6,1,0,},{68,92,12,74,198,0,0,},{241,170,20,244,234,14,2,},{108,152,8,224,96,0,0,},{182,130,13,188,204,0,0,},
+{75,86,15,68,44,1,0,},{30,116,17,11,62,122,1,},{204,132,19,232,234,166,1,},{141,78,13,147,204,0,0,},{217,148,7,214,82,0,0,},{132,62,21,244,60,21,1,},
+{204,20,16,198,226,0,0,},{122,58,14,108,78,0,0,},{103,134,8,205,22,0,0,},{141,92,11,147,192,0,0,},{35,154,8,224,144,0,0,},{75,88,15,68,44,1,0,},
+{242,184,14,235,66,1,0,},{84,40,14,31,78,0,0,},{103,116,18,29,30,122,1,},{242,184,15,235,74,1,0,},{252,200,16,246,226,0,0,},{41,58,14,35,210,0,0,},
+{205,20,14,198,36,1,0,},{125,52,10,103,82,0,0,},{241,170,21,244,234,14,2,},{41,84,15,35,218,0,0,},{4,2,14,2,78,0,0,},{115,84,14,108,36,1,0,},
+{167,106,14,160,36,1,0,},{217,156,11,223,192,0,0,},{242,180,14,235,66,1,0,},{108,66,17,11,120,8,1,},{114,158,15,108,218,0,0,},{68,74,9,30,82,0,0,},
+{42,56,14,35,36,1,0,},{246,202,1,242,82,0,0,},{30,100,8,94,46,0,0,},{42,46,19,232,60,99,0,},{122,74,14,108,78,0,0,},{87,112,12,93,198,0,0,},
+{132,70,16,125,52,1,0,},{52,30,10,30,82,0,0,},{160,102,12,166,198,0,0,},{52,138,10,30,82,0,0,},{246,188,1,242,82,0,0,},{141,80,13,147,204,0,0,},
+{7,185,14,235,78,0,0,},{242,198,14,246,66,1,0,},{75,78,19,232,60,163,0,},{103,66,17,11,30,8,1,},{242,196,15,246,74,1,0,},{160,102,13,166,204,0,0,},
+{68,104,9,30,82,0,0,},{35,132,8,205,156,0,0,},{74,78,19,232,234,162,0,},{41,74,16,35,226,0,0,},{241,12,15,235,218,0,0,},{147,86,16,141,226,0,0,},
+{108,50,12,114,198,0,0,},{42,84,16,35,52,1,0,},{160,100,11,166,192,0,0,},{141,80,12,147,198,0,0,},{141,82,11,147,192,0,0,},{235,170,11,241,192,0,0,},
+{138,68,14,125,78,0,0,},{188,122,14,182,210,0,0,},{103,98,8,167,14,0,0,},{35,136,8,205,156,0,0,},{108,156,8,224,96,0,0,},{246,202,13,252,204,0,0,},
+{246,170,1,242,82,0,0,},{114,74,14,108,210,0,0,},{74,42,14,68,210,0,0,},{211,140,14,198,78,0,0,},{114,104,15,108,218,0,0,},{189,122,14,182,36,1,0,},
+{58,68,15,52,218,0,0,},{246,208,12,252,198,0,0,},{114,56,14,108,210,0,0,},{148,42,15,141,44,1,0,},{93,106,14,87,210,0,0,},{189,124,15,182,44,1,0,},
+{148,42,16,141,52,1,0,},{35,118,18,29,168,122,1,},{41,128,16,35,226,0,0,},{52,62,12,58,198,0,0,},{131,44,16,125,226,0,0,},{28,80,8,75,18,1,0,},
+{42,138,16,35,52,1,0,},{246,190,1,242,82,0,0,},{41,30,14,35,210,0,0,},{252,176,14,246,210,0,0,},{241,186,19,232,234,14,2,},{115,138,16,108,52,1,0,},
+{41,128,15,35,218,0,0,},{167,98,19,232,60,91,1,},{29,30,5,28,0,0,0,},{205,142,16,198,52,1,0,},{125,74,10,103,82,0,0,},{27,132,8,205,250,0,0,},
+{189,22,16,182,52,1,0,},{188,22,15,182,218,0,0,},{41,158,16,35,226,0,0,},{141,84,9,103,82,0,0,},{108,154,8,224,96,0,0,},{42,54,16,35,52,1,0,},
+{230,160,14,217,78,0,0,},{246,190,12,252,198,0,0,},{49,84,14,35,78,0,0,},{87,94,7,84,82,0,0,},{0,6,17,11,240,10,0,},{114,128,15,108,218,0,0,},
+{27,130,17,11,0,123,1,},{35,116,17,11,168,122,1,},{189,122,16,182,52,1,0,},{31,30,6,30,0,0,0,},{52,64,11,58,192,0,0,},{24,32,14,17,36,1,0,},
+{141,82,13,147,204,0,0,},{141,158,9,103,82,0,0,},{131,68,14,125,210,0,0,},{166,106,15,160,218,0,0,},{49,128,14,35,78,0,0,},{27,78,8,148,250,0,0,},
+{167,96,16,160,52,1,0,},{122,104,14,108,78,0,0,},{252,190,19,232,234,2,2,},{114,138,15,108,218,0,0,},{147,90,15,141,218,0,0,},{103,118,17,11,30,122,1,},
+{28,76,18,29,24,119,0,},{242,12,16,235,82,1,0,},{108,130,17,11,120,122,1,},{94,108,14,87,36,1,0,},{52,62,11,58,192,0,0,},{0,254,31,0,0,0,0,},
+{242,186,21,244,90,15,2,},{103,118,18,29,30,122,1,},{246,208,1,242,82,0,0,},{114,46,20,244,234,244,0,},{108,76,17,11,120,8,1,},{138,70,14,125,78,0,0,},
+{28,62,17,11,24,119,0,},{108,114,8,24,132,0,0,},{189,116,19,232,60,135,1,},{41,56,15,35,218,0,0,},{132,70,15,125,44,1,0,},{103,102,8,167,14,0,0,},
+{30,50,8,42,70,0,0,},{246,186,1,242,82,0,0,},{42,84,15,35,44,1,0,},{114,46,21,244,234,244,0,},{30,136,8,205,54,0,0,},{35,76,18,29,168,118,0,},
+{75,86,16,68,52,1,0,},{11,171,3,9,1,0,0,},{17,24,13,23,204,0,0,},{30,66,18,29,62,118,0,},{147,88,15,141,218,0,0,},{242,170,20,244,90,15,2,},
+{7,181,14,235,78,0,0,},{103,166,8,224,14,0,0,},{52,64,12,58,198,0,0,},{28,60,8,42,30,1,0,},{114,58,14,108,210,0,0,},{235,174,13,241,204,0,0,},
+{242,170,21,244,90,15,2,},{108,100,8,167,96,0,0,},{11,209,3,9,1,0,0,},{1,6,17,11,8,10,0,},{102,52,5,27,0,0,0,},{94,96,16,87,52,1,0,},
+{115,58,14,108,36,1,0,},{115,46,19,232,60,245,0,},{23,34,14,17,210,0,0,},{17,24,12,23,198,0,0,},{102,138,5,27,0,0,0,},{41,46,19,232,234,98,0,},
+{125,84,10,103,82,0,0,},{198,136,13,204,204,0,0,},{217,152,11,223,192,0,0,},{30,152,8,224,46,0,0,},{114,84,16,108,226,0,0,},{114,158,16,108,226,0,0,},
+{41,52,14,35,210,0,0,},{167,108,15,160,44,1,0,},{30,62,18,29,62,118,0,},{125,158,10,103,82,0,0,},{103,120,18,29,30,122,1,},{30,24,8,24,70,0,0,},
+{188,116,21,244,234,134,1,},{35,80,8,75,156,0,0,},{114,56,16,108,226,0,0,},{28,46,8,42,30,1,0,},{94,98,20,244,60,201,0,},{242,196,14,246,66,1,0,},
+{141,138,9,103,82,0,0,},{41,30,15,35,218,0,0,},{24,24,20,244,60,103,1,},{30,116,18,29,62,122,1,},{242,176,16,246,82,1,0,},{103,76,17,11,30,8,1,},
+{154,88,14,141,78,0,0,},{42,56,15,35,44,1,0,},{1,205,14,246,78,0,0,},{198,146,11,204,192,0,0,},{114,104,16,108,226,0,0,},{224,160,15,217,44,1,0,},
+{28,130,17,11,24,123,1,},{252,208,21,244,234,2,2,},{74,86,15,68,218,0,0,},{224,160,16,217,52,1,0,},{94,110,15,87,44,1,0,},{242,180,16,235,82,1,0,},
+{103,120,17,11,30,122,1,},{30,120,17,11,62,122,1,},{141,92,12,147,198,0,0,},{160,112,12,166,198,0,0,},{27,102,8,167,244,0,0,},{27,120,17,11,0,123,1,},
+{104,104,6,103,0,0,0,},{125,66,12,131,198,0,0,},{17,114,13,23,204,0,0,},{100,110,14,87,78,0,0,},{41,74,14,35,210,0,0,},{125,62,12,131,198,0,0,},
+{35,62,17,11,168,118,0,},{217,166,13,223,204,0,0,},{108,60,12,114,198,0,0,},{30,76,17,11,62,118,0,},{42,74,15,35,44,1,0,},{108,60,11,114,192,0,0,},
+{217,152,12,223,198,0,0,},{166,110,16,160,226,0,0,},{246,190,11,252,192,0,0,},{27,50,8,115,6,1,0,},{23,24,19,232,234,102,1,},{167,110,14,160,36,1,0,},
+{205,20,15,198,44,1,0,},{49,56,14,35,78,0,0,},{242,198,15,246,74,1,0,},{11,14,5,10,0,0,0,},{94,98,19,232,60,201,0,},{115,54,15,108,44,1,0,},
+{108,120,18,29,120,122,1,},{132,72,14,125,36,1,0,},{30,146,8,205,54,0,0,},{148,90,16,141,52,1,0,},{35,48,12,41,198,0,0,},{108,118,18,29,120,122,1,},
+{27,76,18,29,0,9,1,},{23,32,14,17,210,0,0,},{244,174,3,242,0,0,0,},{35,48,8,42,180,0,0,},{115,138,14,108,36,1,0,},{167,98,21,244,60,91,1,},
+{59,62,19,232,60,131,0,},{114,138,16,108,226,0,0,},{115,74,14,108,36,1,0,},{182,118,13,188,204,0,0,},{28,92,8,75,18,1,0,},{42,30,15,35,44,1,0,},
+{131,68,16,125,226,0,0,},{114,30,16,108,226,0,0,},{173,110,14,160,78,0,0,},{94,106,14,87,36,1,0,},{141,104,9,103,82,0,0,},{141,78,12,147,198,0,0,},
+{125,104,10,103,82,0,0,},{148,88,15,141,44,1,0,},{23,14,15,17,218,0,0,},{94,98,21,244,60,201,0,},{122,138,14,108,78,0,0,},{35,66,17,11,168,118,0,},
+{108,60,13,114,204,0,0,},{24,34,15,17,44,1,0,},{87,98,11,93,192,0,0,},{35,76,17,11,168,118,0,},{204,140,16,198,226,0,0,},{103,146,8,205,22,0,0,},
+{217,152,13,223,204,0,0,},{58,70,15,52,218,0,0,},{115,58,15,108,44,1,0,},{23,32,16,17,226,0,0,},{41,54,16,35,226,0,0,},{75,42,15,68,44,1,0,},
+{42,138,15,35,44,1,0,},{42,46,21,244,60,99,0,},{224,160,14,217,36,1,0,},{204,142,16,198,226,0,0,},{198,136,11,204,192,0,0,},{28,66,18,29,24,119,0,},
+{242,200,14,246,66,1,0,},{217,156,13,223,204,0,0,},{58,62,19,232,234,130,0,},{252,190,21,244,234,2,2,},{242,176,15,246,74,1,0,},{27,152,8,224,244,0,0,},
+{205,142,15,198,44,1,0,},{49,52,14,35,78,0,0,},{217,154,11,223,192,0,0,},{102,158,5,27,0,0,0,},{68,84,9,30,82,0,0,},{30,64,18,29,62,118,0,},
+{115,30,14,108,36,1,0,},{115,30,16,108,52,1,0,},{87,98,12,93,198,0,0,},{108,48,8,115,132,0,0,},{108,28,8,24,132,0,0,},{28,154,8,224,12,1,0,},
+{35,92,8,75,156,0,0,},{35,46,11,41,192,0,0,},{108,66,18,29,120,8,1,},{115,104,15,108,44,1,0,},{198,134,12,204,198,0,0,},{242,208,19,232,90,3,2,},
+{246,208,13,252,204,0,0,},{204,20,14,198,210,0,0,},{35,114,8,24,180,0,0,},{241,184,14,235,210,0,0,},{24,36,14,17,36,1,0,},{182,14,10,12,82,0,0,},
+{217,154,12,223,198,0,0,},{24,32,15,17,44,1,0,},{93,106,16,87,226,0,0,},{30,28,8,24,70,0,0,},{198,136,12,204,198,0,0,},{115,128,14,108,36,1,0,},
+{35,50,13,41,204,0,0,},{160,98,11,166,192,0,0,},{108,146,8,205,108,0,0,},{42,104,15,35,44,1,0,},{35,116,18,29,168,122,1,},{224,150,16,217,52,1,0,},
+{108,24,8,24,132,0,0,},{93,98,20,244,234,200,0,},{30,154,8,224,46,0,0,},{29,104,5,28,0,0,0,},{68,82,12,74,198,0,0,},{115,158,16,108,52,1,0,},
+{108,48,11,114,192,0,0,},{23,36,15,17,218,0,0,},{27,112,8,167,244,0,0,},{102,30,5,27,0,0,0,},{211,20,14,198,78,0,0,},{103,46,8,115,38,0,0,},
+{42,58,15,35,44,1,0,},{59,68,15,52,44,1,0,},{108,62,18,29,120,8,1,},{205,140,16,198,52,1,0,},{114,84,14,108,210,0,0,},{27,156,8,224,244,0,0,},
+{35,98,8,94,144,0,0,},{224,152,21,244,60,205,1,},{41,138,14,35,210,0,0,},{224,150,14,217,36,1,0,},{179,32,14,17,78,0,0,},{103,64,17,11,30,8,1,},
+{81,42,14,68,78,0,0,},{30,80,8,75,54,0,0,},{103,66,18,29,30,8,1,},{103,64,18,29,30,8,1,},{9,13,14,9,78,0,0,},{217,156,12,223,198,0,0,},
+{74,86,16,68,226,0,0,},{160,100,13,166,204,0,0,},{59,62,20,244,60,131,0,},{182,120,13,188,204,0,0,},{198,14,9,12,82,0,0,},{42,56,16,35,52,1,0,},
+{68,80,13,74,204,0,0,},{114,46,19,232,234,244,0,},{125,138,10,103,82,0,0,},{74,90,14,68,210,0,0,},{1,197,14,246,78,0,0,},{224,164,14,217,36,1,0,},
+{17,26,13,23,204,0,0,},{189,116,20,244,60,135,1,},{93,96,15,87,218,0,0,},{108,46,11,114,192,0,0,},{49,74,14,35,78,0,0,},{35,60,12,41,198,0,0,},
+{214,18,14,13,78,0,0,},{35,100,8,94,144,0,0,},{148,90,14,141,36,1,0,},{204,20,15,198,218,0,0,},{58,70,14,52,210,0,0,},{189,22,14,182,36,1,0,},
+{189,116,21,244,60,135,1,},{125,76,11,131,192,0,0,},{252,198,15,246,218,0,0,},{30,78,8,75,54,0,0,},{166,98,21,244,234,90,1,},{125,66,11,131,192,0,0,},
+{132,68,16,125,52,1,0,},{29,128,5,28,0,0,0,},{103,132,8,205,22,0,0,},{224,162,15,217,44,1,0,},{160,112,13,166,204,0,0,},{94,110,14,87,36,1,0,},
+{35,112,8,94,144,0,0,},{204,140,14,198,210,0,0,},{160,102,11,166,192,0,0,},{108,116,17,11,120,122,1,},{235,170,13,241,204,0,0,},{30,62,17,11,62,118,0,},
+{42,84,14,35,36,1,0,},{59,44,14,52,36,1,0,},{114,30,14,108,210,0,0,},{114,104,14,108,210,0,0,},{179,14,14,17,78,0,0,},{252,198,14,246,210,0,0,},
+{35,152,8,224,144,0,0,},{28,132,8,205,18,1,0,},{179,36,14,17,78,0,0,},{10,171,1,9,1,0,0,},{108,78,8,148,108,0,0,},{41,58,15,35,218,0,0,},
+{65,72,14,52,78,0,0,},{217,166,11,223,192,0,0,},{41,104,15,35,218,0,0,},{195,124,14,182,78,0,0,},{131,44,14,125,210,0,0,},{27,136,8,205,250,0,0,},
+{24,14,14,17,36,1,0,},{42,52,16,35,52,1,0,},{41,104,16,35,226,0,0,},{114,74,15,108,218,0,0,},{28,166,8,224,12,1,0,},{103,130,18,29,30,122,1,},
+{42,46,20,244,60,99,0,},{94,110,16,87,52,1,0,},{35,64,18,29,168,118,0,},{30,132,8,205,54,0,0,},{242,184,16,235,82,1,0,},{241,12,16,235,226,0,0,},
+{230,164,14,217,78,0,0,},{75,42,14,68,36,1,0,},{242,190,21,244,90,3,2,},{108,46,12,114,198,0,0,},{28,98,8,94,12,1,0,},{108,136,8,205,108,0,0,},
+{35,166,8,224,144,0,0,},{132,68,15,125,44,1,0,},{74,88,14,68,210,0,0,},{182,116,13,188,204,0,0,},{7,6,17,11,240,10,0,},{188,124,14,182,210,0,0,},
+{42,58,16,35,52,1,0,},{189,22,15,182,44,1,0,},{235,186,12,241,198,0,0,},{132,72,16,125,52,1,0,},{102,128,5,27,0,0,0,},{41,138,16,35,226,0,0,},
+{108,112,8,167,96,0,0,},{205,20,16,198,52,1,0,},{75,78,20,244,60,163,0,},{35,28,8,24,180,0,0,},{205,142,14,198,36,1,0,},{108,82,8,148,108,0,0,},
+{166,98,19,232,234,90,1,},{35,134,8,205,156,0,0,},{114,52,15,108,218,0,0,},{241,184,16,235,226,0,0,},{65,44,14,52,78,0,0,},{148,86,16,141,52,1,0,},
+{103,62,17,11,30,8,1,},{223,162,16,217,226,0,0,},{224,164,16,217,52,1,0,},{52,66,12,58,198,0,0,},{28,120,18,29,24,123,1,},{241,180,16,235,226,0,0,},
+{103,156,8,224,14,0,0,},{49,58,14,35,78,0,0,},{224,152,19,232,60,205,1,},{87,98,13,93,204,0,0,},{59,62,21,244,60,131,0,},{41,56,16,35,226,0,0,},
+{114,58,16,108,226,0,0,},{68,52,9,30,82,0,0,},{246,192,11,252,192,0,0,},{52,76,13,58,204,0,0,},{246,194,12,252,198,0,0,},{35,60,11,41,192,0,0,},
+{242,208,21,244,90,3,2,},{242,182,14,235,66,1,0,},{223,152,19,232,234,204,1,},{224,162,16,217,52,1,0,},{9,205,14,10,79,0,0,},{42,104,16,35,52,1,0,},
+{115,54,16,108,52,1,0,},{24,36,16,17,52,1,0,},{31,138,6,30,0,0,0,},{141,92,13,147,204,0,0,},{41,74,15,35,218,0,0,},{104,128,6,103,0,0,0,},
+{104,138,6,103,0,0,0,},{59,70,16,52,52,1,0,},{173,96,14,160,78,0,0,},{52,128,10,30,82,0,0,},{148,88,16,141,52,1,0,},{28,152,8,224,12,1,0,},
+{23,34,15,17,218,0,0,},{173,106,14,160,78,0,0,},{160,94,7,157,82,0,0,},{35,156,8,224,144,0,0,},{87,100,11,93,192,0,0,},{5,4,19,232,0,8,0,},
+{94,108,15,87,44,1,0,},{103,26,8,24,38,0,0,},{35,118,17,11,168,122,1,},{65,70,14,52,78,0,0,},{198,132,13,204,204,0,0,},{28,78,8,75,18,1,0,},
+{23,34,16,17,226,0,0,},{166,108,16,160,226,0,0,},{49,138,14,35,78,0,0,},{30,64,17,11,62,118,0,},{141,128,9,103,82,0,0,},{59,72,15,52,44,1,0,},
+{223,160,15,217,218,0,0,},{223,152,21,244,234,204,1,},{166,106,16,160,226,0,0,},{103,76,18,29,30,8,1,},{28,112,8,94,12,1,0,},{41,138,15,35,218,0,0,},
+{2,8,0,1,0,0,0,},{132,68,14,125,36,1,0,},{223,150,14,217,210,0,0,},{252,196,14,246,210,0,0,},{114,138,14,108,210,0,0,},{52,66,11,58,192,0,0,},
+{103,48,8,115,38,0,0,},{35,62,18,29,168,118,0,},{188,122,16,182,226,0,0,},{198,146,12,204,198,0,0,},{28,116,18,29,24,123,1,},{132,44,14,125,36,1,0,},
+{27,118,18,29,0,123,1,},{246,174,1,242,82,0,0,},{204,144,14,198,210,0,0,},{131,70,14,125,210,0,0,},{252,204,16,246,226,0,0,},{68,80,11,74,192,0,0,},
+{24,34,14,17,36,1,0,},{30,156,8,224,46,0,0,},{74,90,15,68,218,0,0,},{42,54,15,35,44,1,0,},{167,106,15,160,44,1,0,},{114,128,14,108,210,0,0,},
+{246,194,1,242,82,0,0,},{27,116,17,11,0,123,1,},{108,48,12,114,198,0,0,},{242,196,16,246,82,1,0,},{35,50,12,41,198,0,0,},{24,24,19,232,60,103,1,},
+{241,180,15,235,218,0,0,},{147,90,14,141,210,0,0,},{24,36,15,17,44,1,0,},{35,46,8,42,180,0,0,},{74,86,14,68,210,0,0,},{252,208,20,244,234,2,2,},
+{115,138,15,108,44,1,0,},{114,54,15,108,218,0,0,},{223,160,16,217,226,0,0,},{148,86,14,141,36,1,0,},{125,62,13,131,204,0,0,},{35,64,17,11,168,118,0,},
+{241,182,14,235,210,0,0,},{147,88,16,141,226,0,0,},{252,176,15,246,218,0,0,},{81,90,14,68,78,0,0,},{28,118,17,11,24,123,1,},{188,126,14,182,210,0,0,},
+{205,144,16,198,52,1,0,},{108,26,8,24,132,0,0,},{125,128,10,103,82,0,0,},{148,90,15,141,44,1,0,},{41,46,20,244,234,98,0,},{93,106,15,87,218,0,0,},
+{93,108,16,87,226,0,0,},{241,186,20,244,234,14,2,},{182,130,11,188,192,0,0,},{198,134,11,204,192,0,0,},{94,106,16,87,52,1,0,},{28,26,8,24,30,1,0,},
+{87,100,12,93,198,0,0,},{223,160,14,217,210,0,0,},{27,116,18,29,0,123,1,},{74,42,16,68,226,0,0,},{52,74,10,30,82,0,0,},{115,128,16,108,52,1,0,},
+{35,82,8,75,156,0,0,},{235,186,11,241,192,0,0,},{166,98,20,244,234,90,1,},{27,26,8,24,6,1,0,},{17,28,13,23,204,0,0,},{148,78,21,244,60,53,1,},
+{1,199,14,246,78,0,0,},{166,108,14,160,210,0,0,},{23,24,21,244,234,102,1,},{166,96,14,160,210,0,0,},{87,112,11,93,192,0,0,},{7,6,18,102,240,10,0,},
+{132,72,15,125,44,1,0,},{52,62,13,58,204,0,0,},{242,204,14,246,66,1,0,},{35,60,13,41,204,0,0,},{58,68,14,52,210,0,0,},{35,46,13,41,204,0,0,},
+{28,66,17,11,24,119,0,},{205,132,21,244,60,167,1,},{74,88,16,68,226,0,0,},{59,68,14,52,36,1,0,},{30,118,17,11,62,122,1,},{114,54,14,108,210,0,0,},
+{204,132,20,244,234,166,1,},{93,98,21,244,234,200,0,},{24,24,21,244,60,103,1,},{35,102,8,94,144,0,0,},{29,84,5,28,0,0,0,},{235,172,13,241,204,0,0,},
+{138,72,14,125,78,0,0,},{235,172,11,241,192,0,0,},{102,84,5,27,0,0,0,},{242,176,14,246,66,1,0,},{59,70,14,52,36,1,0,},{28,100,8,94,12,1,0,},
+{28,118,18,29,24,123,1,},{223,152,20,244,234,204,1,},{198,146,13,204,204,0,0,},{115,74,15,108,44,1,0,},{115,158,14,108,36,1,0,},{52,158,10,30,82,0,0,},
+{41,104,14,35,210,0,0,},{103,62,18,29,30,8,1,},{42,128,14,35,36,1,0,},{1,177,14,246,78,0,0,},{28,120,17,11,24,123,1,},{17,10,4,8,88,0,0,},
+{30,112,8,94,46,0,0,},{242,12,15,235,74,1,0,},{58,72,16,52,226,0,0,},{35,48,13,41,204,0,0,},{166,110,15,160,218,0,0,},{94,106,15,87,44,1,0,},
+{230,150,14,217,78,0,0,},{252,204,14,246,210,0,0,},{49,158,14,35,78,0,0,},{154,86,14,141,78,0,0,},{58,70,16,52,226,0,0,},{52,84,10,30,82,0,0,},
+{30,76,18,29,62,118,0,},{27,120,18,29,0,123,1,},{115,52,15,108,44,1,0,},{204,142,15,198,218,0,0,},{41,56,14,35,210,0,0,},{204,144,15,198,218,0,0,},
+{23,24,20,244,234,102,1,},{182,116,12,188,198,0,0,},{252,196,15,246,218,0,0,},{108,48,13,114,204,0,0,},{41,84,14,35,210,0,0,},{35,120,17,11,168,122,1,},
+{24,32,16,17,52,1,0,},{188,126,15,182,218,0,0,},{246,192,1,242,82,0,0,},{125,76,13,131,204,0,0,},{59,44,15,52,44,1,0,},{30,102,8,94,46,0,0,},
+{147,86,14,141,210,0,0,},{138,44,14,125,78,0,0,},{108,64,17,11,120,8,1,},{167,98,20,244,60,91,1,},{205,140,14,198,36,1,0,},{114,128,16,108,226,0,0,},
+{252,208,19,232,234,2,2,},{87,100,13,93,204,0,0,},{252,196,16,246,226,0,0,},{28,156,8,224,12,1,0,},{211,142,14,198,78,0,0,},{103,28,8,24,38,0,0,},
+{42,58,14,35,36,1,0,},{27,66,18,29,0,9,1,},{27,98,8,167,244,0,0,},{157,40,14,104,78,0,0,},{242,186,20,244,90,15,2,},{8,8,31,8,0,0,0,},
+{235,174,12,241,198,0,0,},{242,204,15,246,74,1,0,},{182,120,12,188,198,0,0,},{242,182,15,235,74,1,0,},{114,74,16,108,226,0,0,},{74,42,15,68,218,0,0,},
+{27,154,8,224,244,0,0,},{160,112,11,166,192,0,0,},{132,44,16,125,52,1,0,},{115,46,20,244,60,245,0,},{29,138,5,28,0,0,0,},{28,102,8,94,12,1,0,},
+{205,144,14,198,36,1,0,},{198,134,13,204,204,0,0,},{188,124,15,182,218,0,0,},{5,4,20,11,1,8,0,},{198,132,11,204,192,0,0,},{108,134,8,205,108,0,0,},
+{7,183,14,235,78,0,0,},{205,144,15,198,44,1,0,},{242,200,15,246,74,1,0,},{68,78,11,74,192,0,0,},{241,12,14,235,210,0,0,},{13,14,6,12,0,0,0,},
+{28,24,8,24,30,1,0,},{125,30,10,103,82,0,0,},{148,78,20,244,60,53,1,},{12,10,4,8,4,0,0,},{103,152,8,224,14,0,0,},{102,74,5,27,0,0,0,},
+{1,254,31,0,4,0,0,},{30,66,17,11,62,118,0,},{87,102,12,93,198,0,0,},{41,58,16,35,226,0,0,},{68,82,11,74,192,0,0,},{198,132,12,204,198,0,0,},
+{87,102,11,93,192,0,0,},{59,72,16,52,52,1,0,},{122,30,14,108,78,0,0,},{223,150,15,217,218,0,0,},{131,68,15,125,218,0,0,},{7,13,14,235,78,0,0,},
+{41,52,15,35,218,0,0,},{244,172,3,242,0,0,0,},{122,128,14,108,78,0,0,},{167,108,16,160,52,1,0,},{246,194,11,252,192,0,0,},{147,42,16,141,226,0,0,},
+{131,72,14,125,210,0,0,},{59,44,16,52,52,1,0,},{41,52,16,35,226,0,0,},{52,104,10,30,82,0,0,},{244,208,3,242,0,0,0,},{147,88,14,141,210,0,0,},
+{125,64,12,131,198,0,0,},{30,60,8,42,70,0,0,},{241,184,15,235,218,0,0,},{108,60,8,115,132,0,0,},{30,130,17,11,62,122,1,},{115,158,15,108,44,1,0,},
+{28,130,18,29,24,123,1,},{224,152,20,244,60,205,1,},{75,78,21,244,60,163,0,},{59,70,15,52,44,1,0,},{246,208,11,252,192,0,0,},{52,76,11,58,192,0,0,},
+{28,64,17,11,24,119,0,},{131,70,15,125,218,0,0,},{114,58,15,108,218,0,0,},{242,186,19,232,90,15,2,},{28,134,8,205,18,1,0,},{2,0,0,1,0,0,0,},
+{115,104,16,108,52,1,0,},{42,30,14,35,36,1,0,},{189,124,14,182,36,1,0,},{74,78,20,244,234,162,0,},{182,130,12,188,198,0,0,},{160,98,13,166,204,0,0,},
+{27,146,8,205,250,0,0,},{188,22,14,182,210,0,0,},{35,130,17,11,168,122,1,},{108,64,18,29,120,8,1,},{189,122,15,182,44,1,0,},{30,130,18,29,62,122,1,},
+{75,90,16,68,52,1,0,},{28,146,8,205,18,1,0,},{42,158,15,35,44,1,0,},{103,60,8,115,38,0,0,},{217,154,13,223,204,0,0,},{108,98,8,167,96,0,0,},
+{104,52,6,103,0,0,0,},{24,14,16,17,52,1,0,},{205,140,15,198,44,1,0,},{232,12,3,9,0,0,0,},{224,162,14,217,36,1,0,},{241,170,19,232,234,14,2,},
+{148,78,19,232,60,53,1,},{252,200,14,246,210,0,0,},{30,120,18,29,62,122,1,},{10,10,4,8,0,0,0,},{103,116,17,11,30,122,1,},{42,158,16,35,52,1,0,},
+{182,118,11,188,192,0,0,},{167,110,15,160,44,1,0,},{17,24,11,23,192,0,0,},{167,96,15,160,44,1,0,},{27,64,17,11,0,9,1,},{132,44,15,125,44,1,0,},
+{103,50,8,115,38,0,0,},{35,130,18,29,168,122,1,},{68,138,9,30,82,0,0,},{52,52,10,30,82,0,0,},{68,92,11,74,192,0,0,},{108,46,8,115,132,0,0,},
+{188,126,16,182,226,0,0,},{252,200,15,246,218,0,0,},{147,42,14,141,210,0,0,},{42,52,15,35,44,1,0,},{28,114,8,24,30,1,0,},{246,202,11,252,192,0,0,},
+{65,68,14,52,78,0,0,},{131,44,15,125,218,0,0,},{49,30,14,35,78,0,0,},{68,78,13,74,204,0,0,},{115,56,15,108,44,1,0,},{28,28,8,24,30,1,0,},
+{114,52,14,108,210,0,0,},{27,64,18,29,0,9,1,},{68,128,9,30,82,0,0,},{246,202,12,252,198,0,0,},{30,92,8,75,54,0,0,},{68,30,9,30,82,0,0,},
+{17,114,11,23,192,0,0,},{235,188,12,241,198,0,0,},{74,88,15,68,218,0,0,},{188,116,20,244,234,134,1,},{115,46,21,244,60,245,0,},{217,166,12,223,198,0,0,},
+{141,30,9,103,82,0,0,},{141,82,12,147,198,0,0,},{27,92,8,148,250,0,0,},{114,52,16,108,226,0,0,},{244,170,3,242,0,0,0,},{205,132,19,232,60,167,1,},
+{132,70,14,125,36,1,0,},{108,92,8,148,108,0,0,},{223,150,16,217,226,0,0,},{230,162,14,217,78,0,0,},{154,90,14,141,78,0,0,},{223,164,15,217,218,0,0,},
+{31,52,6,30,0,0,0,},{75,90,14,68,36,1,0,},{173,108,14,160,78,0,0,},{160,100,12,166,198,0,0,},{246,190,13,252,204,0,0,},{58,44,14,52,210,0,0,},
+{1,6,18,102,8,10,0,},{28,76,17,11,24,119,0,},{100,108,14,87,78,0,0,},{108,50,11,114,192,0,0,},{166,96,15,160,218,0,0,},{41,46,21,244,234,98,0,},
+{30,118,18,29,62,122,1,},{182,120,11,188,192,0,0,},{27,28,8,24,6,1,0,},{93,98,19,232,234,200,0,},{188,124,16,182,226,0,0,},{87,112,13,93,204,0,0,},
+{17,114,12,23,198,0,0,},{58,72,15,52,218,0,0,},{252,198,16,246,226,0,0,},{131,62,21,244,234,20,1,},{114,158,14,108,210,0,0,},{103,92,8,148,22,0,0,},
+{75,88,16,68,52,1,0,},{52,64,13,58,204,0,0,},{42,128,15,35,44,1,0,},{9,10,2,8,0,0,0,},{242,180,15,235,74,1,0,},{235,186,13,241,204,0,0,},
+{31,104,6,30,0,0,0,},{252,204,15,246,218,0,0,},{31,158,6,30,0,0,0,},{27,60,8,115,6,1,0,},{68,158,9,30,82,0,0,},{29,158,5,28,0,0,0,},
+{148,42,14,141,36,1,0,},{58,44,15,52,218,0,0,},{115,54,14,108,36,1,0,},{108,62,17,11,120,8,1,},{125,64,11,131,192,0,0,},{189,124,16,182,52,1,0,},
+{182,116,11,188,192,0,0,},{58,62,20,244,234,130,0,},{205,132,20,244,60,167,1,},{49,54,14,35,78,0,0,},{108,80,8,148,108,0,0,},{31,84,6,30,0,0,0,},
+{52,66,13,58,204,0,0,},{41,54,15,35,218,0,0,},{141,74,9,103,82,0,0,},{42,30,16,35,52,1,0,},{30,166,8,224,46,0,0,},{27,66,17,11,0,9,1,},
+{35,26,8,24,180,0,0,},{103,136,8,205,22,0,0,},{93,110,16,87,226,0,0,},{68,80,12,74,198,0,0,},{204,132,21,244,234,166,1,},{167,106,16,160,52,1,0,},
+{242,200,16,246,82,1,0,},{74,90,16,68,226,0,0,},{147,86,15,141,218,0,0,},{28,136,8,205,18,1,0,},{115,104,14,108,36,1,0,},{30,46,8,42,70,0,0,},
+{195,22,14,182,78,0,0,},{188,122,15,182,218,0,0,},{28,62,18,29,24,119,0,},{195,122,14,182,78,0,0,},{29,74,5,28,0,0,0,},{27,130,18,29,0,123,1,},
+{31,74,6,30,0,0,0,},{1,201,14,246,78,0,0,},{81,88,14,68,78,0,0,},{115,74,16,108,52,1,0,},{235,172,12,241,198,0,0,},{223,162,15,217,218,0,0,},
+{115,56,14,108,36,1,0,},{104,30,6,103,0,0,0,},{30,134,8,205,54,0,0,},{147,42,15,141,218,0,0,},{30,98,8,94,46,0,0,},{68,78,12,74,198,0,0,},
+{93,108,15,87,218,0,0,},{167,108,14,160,36,1,0,},{17,26,12,23,198,0,0,},{141,78,11,147,192,0,0,},{108,166,8,224,96,0,0,},{204,144,16,198,226,0,0,},
+{154,42,14,141,78,0,0,},{24,34,16,17,52,1,0,},{58,72,14,52,210,0,0,},{28,82,8,75,18,1,0,},{93,108,14,87,210,0,0,},{131,72,16,125,226,0,0,},
+{241,182,15,235,218,0,0,},{35,46,12,41,198,0,0,},{103,130,17,11,30,122,1,},{204,140,15,198,218,0,0,},{35,24,8,24,180,0,0,},{108,46,13,114,204,0,0,},
+{42,74,14,35,36,1,0,},{30,48,8,42,70,0,0,},{93,110,15,87,218,0,0,},{108,102,8,167,96,0,0,},{41,84,16,35,226,0,0,},{131,62,19,232,234,20,1,},
+{23,14,16,17,226,0,0,},{246,192,12,252,198,0,0,},{52,76,12,58,198,0,0,},{115,128,15,108,44,1,0,},{122,84,14,108,78,0,0,},{35,120,18,29,168,122,1,},
+{189,126,15,182,44,1,0,},{27,62,17,11,0,9,1,},{148,86,15,141,44,1,0,},{166,108,15,160,218,0,0,},{104,158,6,103,0,0,0,},{27,24,8,24,6,1,0,},
+{75,86,14,68,36,1,0,},{182,118,12,188,198,0,0,},{35,50,11,41,192,0,0,},{27,114,8,24,6,1,0,},{27,80,8,148,250,0,0,},{103,24,8,24,38,0,0,},
+{125,66,13,131,204,0,0,},{242,190,20,244,90,3,2,},{23,36,16,17,226,0,0,},{242,190,19,232,90,3,2,},{87,102,13,93,204,0,0,},{132,62,19,232,60,21,1,},
+{100,106,14,87,78,0,0,},{166,110,14,160,210,0,0,},{246,192,13,252,204,0,0,},{10,209,1,9,1,0,0,},{35,66,18,29,168,118,0,},{23,32,15,17,218,0,0,},
+{242,198,16,246,82,1,0,},{108,116,18,29,120,122,1,},{115,30,15,108,44,1,0,},{244,192,3,242,0,0,0,},{252,190,20,244,234,2,2,},{103,112,8,167,14,0,0,},
+{131,70,16,125,226,0,0,},{179,34,14,17,78,0,0,},{167,96,14,160,36,1,0,},{41,158,14,35,210,0,0,},{42,52,14,35,36,1,0,},{114,56,15,108,218,0,0,},
+{27,118,17,11,0,123,1,},{246,194,13,252,204,0,0,},{108,130,18,29,120,122,1,},{29,52,5,28,0,0,0,},{108,76,18,29,120,8,1,},{122,56,14,108,78,0,0,},
+{252,176,16,246,226,0,0,},{115,84,16,108,52,1,0,},{141,52,9,103,82,0,0,},{58,62,21,244,234,130,0,},{42,138,14,35,36,1,0,},{224,164,15,217,44,1,0,},
+{30,82,8,75,54,0,0,},{115,58,16,108,52,1,0,},{242,12,14,235,66,1,0,},{125,64,13,131,204,0,0,},{167,110,16,160,52,1,0,},{42,54,14,35,36,1,0,},
+{42,158,14,35,36,1,0,},{223,162,14,217,210,0,0,},{93,96,16,87,226,0,0,},{41,54,14,35,210,0,0,},{30,26,8,24,70,0,0,},{241,186,21,244,234,14,2,},
+{42,74,16,35,52,1,0,},{244,190,3,242,0,0,0,},{49,104,14,35,78,0,0,},{147,78,20,244,234,52,1,},{102,104,5,27,0,0,0,},{75,88,14,68,36,1,0,},
+{68,92,13,74,204,0,0,},{242,170,19,232,90,15,2,},{93,110,14,87,210,0,0,},{103,80,8,148,22,0,0,},{242,182,16,235,82,1,0,},{30,114,8,24,70,0,0,},
+{235,170,12,241,198,0,0,},{35,50,8,42,180,0,0,},{223,164,16,217,226,0,0,},{235,10,2,8,82,0,0,},{108,50,8,115,132,0,0,},{7,254,31,0,2,0,0,},
+{242,204,16,246,82,1,0,},{241,180,14,235,210,0,0,},{115,56,16,108,52,1,0,},{0,6,18,102,240,10,0,},{147,78,21,244,234,52,1,},{17,28,12,23,198,0,0,},
+{75,90,15,68,44,1,0,},{17,28,11,23,192,0,0,},{246,172,1,242,82,0,0,},{94,108,16,87,52,1,0,},{108,118,17,11,120,122,1,},{100,96,14,87,78,0,0,},
+{242,208,20,244,90,3,2,},{160,98,12,166,198,0,0,},{28,64,18,29,24,119,0,},{28,116,17,11,24,123,1,},{27,82,8,148,250,0,0,},{147,90,16,141,226,0,0,},
+{27,100,8,167,244,0,0,},{241,182,16,235,226,0,0,},{223,164,14,217,210,0,0,},{235,188,13,241,204,0,0,},{23,36,14,17,210,0,0,},{114,84,15,108,218,0,0,},
+{59,68,16,52,52,1,0,},{27,134,8,205,250,0,0,},{103,154,8,224,14,0,0,},{104,74,6,103,0,0,0,},{27,46,8,115,6,1,0,},{42,128,16,35,52,1,0,},
+{244,202,3,242,0,0,0,},{244,188,3,242,0,0,0,},{41,128,14,35,210,0,0,},{166,96,16,160,226,0,0,},{41,30,16,35,226,0,0,},{132,62,20,244,60,21,1,},
+};
+
+struct action_table_key {
+    uint8_t bytes[3];
+};
+static inline struct action_table_key encode_key(uint32_t target_nfa_state, uint32_t dfa_state, uint32_t dfa_symbol) {
+    struct action_table_key key = {{0}};
+    key.bytes[0] |= (target_nfa_state >> 0) & 255;
+    key.bytes[1] |= (target_nfa_state >> 8) & 1;
+    key.bytes[1] |= (dfa_state << 1) & 255;
+    key.bytes[2] |= (dfa_symbol >> 0) & 31;
+    return key;
+}
+struct action_table_entry {
+    uint32_t nfa_state;
+    uint32_t actions;
+    uint32_t push_nfa_state;
+};
+static struct action_table_entry decode_entry(const uint8_t *bytes) {
+    struct action_table_entry entry = {0};
+    entry.nfa_state |= ((uint32_t)bytes[3] & 255) << 0;
+    entry.nfa_state |= ((uint32_t)bytes[4] & 1) << 8;
+    entry.actions |= ((uint32_t)bytes[4] & 255) >> 1;
+    entry.actions |= ((uint32_t)bytes[5] & 1) << 7;
+    entry.push_nfa_state |= ((uint32_t)bytes[5] & 255) >> 1;
+    entry.push_nfa_state |= ((uint32_t)bytes[6] & 3) << 7;
+    return entry;
+}
+static struct action_table_entry action_table_lookup(uint32_t nfa_state, uint32_t dfa_state, uint32_t token) {
+    uint32_t hash = 3853145573U;
+    hash = (((((((hash) ^ (nfa_state)) * 0xe5aa55e5) ^ (dfa_state)) * 0xe5aa55e5) ^ (token)) * 0xe5aa55e5);
+    uint32_t slot = hash + action_table_displacements[hash % 564];
+    slot ^= slot >> 16;
+    slot *= 0x85ebca6bu;
+    slot ^= slot >> 13;
+    const uint8_t *entry = action_table[slot % 1128];
+    struct action_table_key key = encode_key(nfa_state, dfa_state, token);
+    if (memcmp(key.bytes, entry, sizeof(key.bytes)) != 0)
+        abort();
+    return decode_entry(entry);
+}
+static void apply_actions(struct construct_state *state, uint32_t index, size_t start, size_t end) {
+    size_t offset = end;
+    uint32_t i;
+    for (i = index; actions[i]; ++i) {
+        if (((((actions[i]) >> 12) & 0xf) & 8))
+            offset = start;
+        construct_action_apply(state, actions[i], offset);
+    }
+}
+static size_t build_parse_tree(struct owl_parser *parser) {
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    struct owl_token_run *run = parser->token_run;
+    struct construct_state *construct_state = &parser->construct_state;
+    construct_state->info = parser->tree;
+    uint32_t *state_stack = parser->state_stack;
+    uint32_t stack_depth = 0;
+    size_t stack_capacity = parser->state_stack_capacity;
+    size_t whitespace = tokenizer->whitespace;
+    size_t offset = tokenizer->offset - whitespace;
+    construct_begin(construct_state, offset, CONSTRUCT_NORMAL_ROOT);
+    uint32_t nfa_state = 7;
+    while (run) {
+        uint16_t length_offset = run->lengths_size - 1;
+        uint16_t n = run->number_of_tokens;
+        uint16_t i;
+        for (i = n - 1; i < n; i--) {
+            size_t end = offset;
+            size_t len = 0;
+            struct action_table_entry entry = action_table_lookup(nfa_state, run->states[i], run->tokens[i]);
+            if (run->tokens[i] < 17)
+                len = decode_token_length(run, &length_offset, &offset);
+            else {
+                if (stack_depth >= stack_capacity) {
+                    size_t new_capacity = (stack_capacity + 2) * 3 / 2;
+                    if (new_capacity <= stack_capacity)
+                        abort();
+                    uint32_t *new_stack = reallocate_memory(state_stack, stack_capacity * sizeof(uint32_t), new_capacity * sizeof(uint32_t), &parser->allocator);
+                    if (!new_stack)
+                        abort();
+                    state_stack = new_stack;
+                    stack_capacity = new_capacity;
+                }
+                state_stack[stack_depth++] = entry.push_nfa_state;
+            }
+            apply_actions(construct_state, entry.actions, end, end + whitespace);
+            if (run->states[i] == 5) {
+                if (stack_depth == 0)
+                    abort();
+                nfa_state = state_stack[--stack_depth];
+            } else
+                nfa_state = entry.nfa_state;
+            whitespace = end - offset - len;
+        }
+        struct owl_token_run *old = run;
+        run = run->prev;
+        old->prev = tokenizer->free_runs;
+        tokenizer->free_runs = old;
+    }
+    parser->token_run = 0;
+    parser->state_stack = state_stack;
+    parser->state_stack_capacity = stack_capacity;
+    struct action_table_entry entry = action_table_lookup(nfa_state, UINT32_MAX, UINT32_MAX);
+    apply_actions(construct_state, entry.actions, offset, offset + whitespace);
+    return construct_finish(construct_state, offset);
+}
+static size_t read_whitespace(const char *text, size_t length, void *info) {
+    switch (text[0]) {
+    case 32:
+    case 9:
+    case 10:
+    case 13:
+#ifdef OWL_SIMD
+        return vector_scan(text, 1, length, VECTOR_SCAN_WHITESPACE, 0);
+#else
+        return 1;
+#endif
+    default:
+        return 0;
+    }
+}
+static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, size_t length, void *info) {
+    switch (text[0]) {
+    case 40:
+        *end_token = false;
+        *token = 2;
+        return 1;
+    case 41:
+        *end_token = true;
+        *token = 3;
+        return 1;
+    case 42:
+        *end_token = false;
+        *token = 11;
+        return 1;
+    case 43:
+        *end_token = false;
+        *token = 12;
+        return 1;
+    case 44:
+        *end_token = false;
+        *token = 1;
+        return 1;
+    case 47:
+        if (length >= 2 && text[1] == 47) {
+            *end_token = false;
+            *token = 4294967295U;
+            return 2;
+        } else {
+            return 0;
+        }
+    case 59:
+        *end_token = false;
+        *token = 8;
+        return 1;
+    case 61:
+        switch (length > 1 ? text[1] : 0) {
+        case 61:
+            *end_token = false;
+            *token = 13;
+            return 2;
+        default:
+            *end_token = false;
+            *token = 7;
+            return 1;
+        }
+    case 102:
+        if (length >= 2 && text[1] == 110) {
+            *end_token = false;
+            *token = 0;
+            return 2;
+        } else {
+            return 0;
+        }
+    case 105:
+        if (length >= 2 && text[1] == 102) {
+            *end_token = false;
+            *token = 10;
+            return 2;
+        } else {
+            return 0;
+        }
+    case 108:
+        if (length >= 3 && text[1] == 101 && text[2] == 116) {
+            *end_token = false;
+            *token = 6;
+            return 3;
+        } else {
+            return 0;
+        }
+    case 114:
+        if (length >= 6 && text[1] == 101 && text[2] == 116 && text[3] == 117 && text[4] == 114 && text[5] == 110) {
+            *end_token = false;
+            *token = 9;
+            return 6;
+        } else {
+            return 0;
+        }
+    case 123:
+        *end_token = false;
+        *token = 4;
+        return 1;
+    case 125:
+        *end_token = true;
+        *token = 5;
+        return 1;
+    default:
+        return 0;
+    }
+}
+static uint32_t rule_lookup(uint32_t parent, uint32_t slot, void *context) {
+    switch (parent) {
+    case 0:
+        switch (slot) {
+        case 0: return 1;
+        default: break;
+        }
+        break;
+    case 1:
+        switch (slot) {
+        case 0: return 4;
+        case 1: return 2;
+        default: break;
+        }
+        break;
+    case 2:
+        switch (slot) {
+        case 0: return 4;
+        case 1: return 3;
+        case 2: return 2;
+        default: break;
+        }
+        break;
+    case 3:
+        switch (slot) {
+        case 0: return 4;
+        case 1: return 5;
+        case 2: return 6;
+        case 3: return 3;
+        case 4: return 3;
+        case 5: return 3;
+        default: break;
+        }
+        break;
+    default: break;
+    }
+    return UINT32_MAX;
+}
+static void fixity_associativity_precedence_lookup(int *fixity_associativity, int *precedence, uint32_t rule, uint32_t choice, void *context) {
+    switch (rule) {
+    case 3:
+        switch (choice) {
+        case 4:
+            *precedence = -1;
+            *fixity_associativity = CONSTRUCT_INFIX_LEFT;
+            return;
+        case 5:
+            *precedence = -2;
+            *fixity_associativity = CONSTRUCT_INFIX_LEFT;
+            return;
+        case 6:
+            *precedence = -3;
+            *fixity_associativity = CONSTRUCT_INFIX_LEFT;
+            return;
+        default: return;
+        }
+    default: return;
+    }
+}
+static size_t number_of_slots_lookup(uint32_t rule, void *context) {
+    switch (rule) {
+    case 0: return 1;
+    case 1: return 2;
+    case 2: return 3;
+    case 3: return 6;
+    case 4: return 0;
+    case 5: return 0;
+    case 6: return 0;
+    default: return 0;
+    }
+}
+static void left_right_operand_slots_lookup(uint32_t rule, uint32_t *left, uint32_t *right, uint32_t *operand, void *context) {
+    switch (rule) {
+    case 0:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 1:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 2:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 3:
+        *left = 4;
+        *right = 5;
+        *operand = 4294967295U;
+        break;
+    case 4:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 5:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 6:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    }
+}
+#endif
+
@@ -0,0 +1,7716 @@
+// This file was generated by the Owl parsing tool.
+// Make sure to #define OWL_PARSER_IMPLEMENTATION somewhere so the parser
+// is compiled properly.  Just two lines are enough -- a typical parser.c might
+// look like:
+//
+//   #define OWL_PARSER_IMPLEMENTATION
+//   #include "parser.h"
+//
+// The grammar's 429 tokens fall into 11 token classes.
+
+#ifndef OWL_PARSER_H
+#define OWL_PARSER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// The owl_tree struct represents an entire parse tree.  Use the
+// owl_tree_create_...() functions to create a tree, then call owl_tree_root()
+// to get the root owl_ref.
+struct owl_tree;
+
+// Creates an owl_tree from a string.  The tree may directly reference pieces of
+// the string -- you're responsible for keeping it around until
+// owl_tree_destroy() is called.
+struct owl_tree *owl_tree_create_from_string(const char *string);
+
+// Creates an owl_tree by reading from a file.
+struct owl_tree *owl_tree_create_from_file(FILE *file);
+
+// Creates an owl_tree from the file at `path`.  Where possible, the tree
+// references a memory mapping of the file instead of a copy.
+struct owl_tree *owl_tree_create_from_path(const char *path);
+
+// Explicitly create a tree with particular options.
+struct owl_tree_options {
+    // Exactly one of string or file should be set.
+    const char *string;
+    FILE *file;
+    // The length of the string in bytes.  If this is set, the string doesn't
+    // need to be zero-terminated, and any zero bytes in it are invalid tokens.
+    size_t length;
+    // Functions for allocating and freeing memory.  Either all three or none of
+    // them should be set; if they aren't set, malloc, realloc, and free are used.
+    // The tree and everything allocated while building it come from these
+    // functions, and the tree keeps using them until it's destroyed.
+    void *(*allocate)(size_t size, void *info);
+    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);
+    void (*deallocate)(void *pointer, size_t size, void *info);
+    // This pointer will be passed into the allocation functions.
+    void *allocator_info;
+};
+struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options);
+
+// An owl_parser parses input which arrives in pieces.  Pass each piece to
+// owl_parser_feed() as it arrives, then call owl_parser_finish() to get
+// the tree.  Input is tokenized and checked as it's fed in; the tree itself is
+// built when parsing finishes.
+//
+// A parser can also parse many strings in a row with owl_parser_parse(),
+// reusing its memory instead of allocating it again for each one.
+struct owl_parser;
+
+// Creates an owl_parser.  The parser keeps its own copy of the input.
+struct owl_parser *owl_parser_create(void);
+
+// Explicitly create a parser with particular options.  The string and file
+// options must be left unset.
+struct owl_parser *owl_parser_create_with_options(struct owl_tree_options options);
+
+// Appends the next `length` bytes of input.  Returns false once the input is
+// known to contain an error; the tree returned by owl_parser_finish() will
+// report it.
+bool owl_parser_feed(struct owl_parser *parser, const char *chunk, size_t length);
+
+// Parses the rest of the input and returns the resulting tree.  The tree takes
+// ownership of the parser's copy of the input, and the parser is destroyed.
+struct owl_tree *owl_parser_finish(struct owl_parser *parser);
+
+// Parses a null-terminated string, reusing the memory from earlier parses.  The
+// tree belongs to the parser and references the string: keep both around until
+// the next call to owl_parser_parse(), owl_parser_reset(), or
+// owl_parser_destroy(), and don't pass the tree to owl_tree_destroy().
+struct owl_tree *owl_parser_parse(struct owl_parser *parser, const char *string);
+
+// Discards any input fed to the parser and any tree it returned, keeping its
+// memory for the next parse.
+void owl_parser_reset(struct owl_parser *parser);
+
+// Destroys an owl_parser without finishing it.
+void owl_parser_destroy(struct owl_parser *parser);
+
+// Destroys an owl_tree, freeing its resources back to the system.
+void owl_tree_destroy(struct owl_tree *);
+
+// Prints a representation of the tree to standard output.
+void owl_tree_print(struct owl_tree *);
+
+// An owl_ref references a list of children in the parse tree.  Use the
+// parsed_..._get() function corresponding to the element type to unpack the
+// child into its appropriate parsed_... struct.
+struct owl_ref {
+    struct owl_tree *_tree;
+    size_t _offset;
+    size_t _start;
+    uint32_t _type;
+    bool empty;
+};
+
+// The owl_next function advances a ref to the next sibling element.
+struct owl_ref owl_next(struct owl_ref);
+
+// Tests two refs for equality.
+bool owl_refs_equal(struct owl_ref a, struct owl_ref b);
+
+// Returns the root owl_ref.
+struct owl_ref owl_tree_root_ref(struct owl_tree *tree);
+
+// As a shortcut, returns the parsed_script struct corresponding to the root ref.
+struct parsed_script owl_tree_get_parsed_script(struct owl_tree *tree);
+
+// The range of text corresponding to a tree element.
+struct source_range {
+    size_t start;
+    size_t end;
+};
+
+enum owl_error {
+    // No error -- everything's fine!
+    ERROR_NONE,
+
+    // The file passed to owl_tree_create_from_file was NULL.
+    ERROR_INVALID_FILE,
+
+    // The options passed to owl_tree_create_with_options weren't valid --
+    // both file and string were specified at the same time or neither were.
+    // Also reported if either was passed to owl_parser_create_with_options.
+    ERROR_INVALID_OPTIONS,
+
+    // A piece of text couldn't be matched as a token.
+    ERROR_INVALID_TOKEN,
+
+    // The parser encountered an out-of-place token that doesn't fit the grammar.
+    ERROR_UNEXPECTED_TOKEN,
+
+    // The input is valid so far, but incomplete; more tokens could be added to
+    // complete it.
+    ERROR_MORE_INPUT_NEEDED,
+};
+// Returns an error code, or ERROR_NONE if there wasn't an error.
+// The error_range parameter can be null.
+enum owl_error owl_tree_get_error(struct owl_tree *tree, struct source_range *error_range);
+
+// Checks whether a string matches the grammar without building a tree.  The
+// result (and error range) is the same as creating a tree would report, but
+// memory use depends only on how deeply the input is nested, not its length.
+// If `length` is zero, the string must be zero-terminated.
+enum owl_error owl_validate(const char *string, size_t length, struct source_range *error_range);
+
+// Explicitly validate input with particular options.
+enum owl_error owl_validate_with_options(struct owl_tree_options options, struct source_range *error_range);
+
+enum parsed_type {
+    PARSED_DOT = 1,
+    PARSED_STAR,
+    PARSED_COMMA,
+    PARSED_EQUALS,
+    PARSED_PARENS,
+    PARSED_STRING,
+    PARSED_INTEGER,
+    PARSED_KEYWORD,
+    PARSED_IDENTIFIER,
+};
+
+struct parsed_script {
+    struct source_range range;
+    struct owl_ref statement;
+};
+
+struct parsed_statement {
+    struct source_range range;
+    struct owl_ref word;
+};
+
+struct parsed_word {
+    struct source_range range;
+    enum parsed_type type;
+    struct owl_ref keyword;
+    struct owl_ref identifier;
+    struct owl_ref integer;
+    struct owl_ref string;
+    struct owl_ref word;
+};
+
+struct parsed_keyword {
+    struct source_range range;
+};
+
+struct parsed_identifier {
+    struct source_range range;
+    const char *identifier;
+    size_t length;
+};
+
+struct parsed_integer {
+    struct source_range range;
+    uint64_t integer;
+};
+
+struct parsed_string {
+    struct source_range range;
+    const char *string;
+    size_t length;
+};
+
+struct parsed_script parsed_script_get(struct owl_ref);
+struct parsed_statement parsed_statement_get(struct owl_ref);
+struct parsed_word parsed_word_get(struct owl_ref);
+struct parsed_keyword parsed_keyword_get(struct owl_ref);
+struct parsed_identifier parsed_identifier_get(struct owl_ref);
+struct parsed_integer parsed_integer_get(struct owl_ref);
+struct parsed_string parsed_string_get(struct owl_ref);
+
+// The rules of the grammar, as passed to owl_builder functions.
+enum owl_rule {
+    OWL_RULE_SCRIPT = 0,
+    OWL_RULE_STATEMENT = 1,
+    OWL_RULE_WORD = 2,
+    OWL_RULE_KEYWORD = 3,
+    OWL_RULE_IDENTIFIER = 4,
+    OWL_RULE_INTEGER = 5,
+    OWL_RULE_STRING = 6,
+};
+
+// A rule or token match, as passed to an owl_builder function.
+struct owl_match {
+    enum owl_rule rule;
+    struct source_range range;
+    // For rules with named options, the option which matched.
+    enum parsed_type type;
+    // The nodes built for each of the rule's fields, in the same order as the
+    // fields of its parsed_... struct.  Each one is the first node of a list
+    // linked by `next_sibling`, or null if the field is empty.
+    void **slots;
+    // Token data, as in the token's parsed_... struct.  The identifier and
+    // string pointers may only be valid until building finishes.
+    const char *identifier;
+    const char *string;
+    size_t length;
+    uint64_t integer;
+    double number;
+};
+struct owl_builder {
+    // Called once for each match, after the matches inside it.  `next_sibling` is
+    // the node built for the following match in the same field, if there is one.
+    // Returns the new node; returning null leaves the match out.
+    void *(*build)(const struct owl_match *match, void *next_sibling, void *info);
+    // This pointer will be passed into the build function.
+    void *info;
+};
+
+// Parses a string, building your own nodes with `builder` instead of creating
+// a tree.  Nodes are only built once the whole input has been checked, so
+// nothing is built if there's an error.  Otherwise, `root` is set to the node
+// built for the root match.  If `length` is zero, the string must be
+// zero-terminated.
+enum owl_error owl_build(const char *string, size_t length, struct owl_builder builder, void **root, struct source_range *error_range);
+
+// Explicitly build nodes with particular options.
+enum owl_error owl_build_with_options(struct owl_tree_options options, struct owl_builder builder, void **root, struct source_range *error_range);
+
+#endif
+
+#ifdef OWL_PARSER_IMPLEMENTATION
+// Code implementing the parser.  This might get a bit messy!
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined(OWL_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define OWL_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(__clang__) || defined(__GNUC__)
+#define OWL_DONT_INLINE __attribute__((noinline))
+#else
+#define OWL_DONT_INLINE
+#endif
+
+// The allocation functions from owl_tree_options.
+struct owl_allocator {
+    void *(*allocate)(size_t size, void *info);
+    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);
+    void (*deallocate)(void *pointer, size_t size, void *info);
+    void *info;
+};
+static void *allocate_memory(size_t size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (a->allocate)
+        return a->allocate(size, a->info);
+    return malloc(size);
+}
+static void *reallocate_memory(void *pointer, size_t old_size, size_t new_size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (a->reallocate)
+        return a->reallocate(pointer, old_size, new_size, a->info);
+    return realloc(pointer, new_size);
+}
+static void free_memory(void *pointer, size_t size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (!pointer)
+        return;
+    if (a->deallocate)
+        a->deallocate(pointer, size, a->info);
+    else
+        free(pointer);
+}
+
+struct pending_start {
+    size_t offset;
+    size_t start;
+};
+struct owl_tree {
+    const char *string;
+    // If nonzero, the tree owns the string, which is an allocation of this many
+    // bytes.
+    size_t owned_string_size;
+    // If nonzero, the string is a memory mapping of this many bytes.
+    size_t mapped_length;
+    struct owl_allocator allocator;
+    // If set, nodes are built with this instead of being written to parse_tree.
+    const struct owl_builder *builder;
+    uint8_t *parse_tree;
+    size_t parse_tree_size;
+    size_t next_offset;
+    enum owl_error error;
+    struct source_range error_range;
+    size_t root_offset;
+    size_t root_start;
+    // While the tree is being built, the start locations of nodes which
+    // haven't been written into a parent or sibling yet.
+    struct pending_start *pending_starts;
+    size_t number_of_pending_starts;
+    size_t pending_starts_capacity;
+    size_t next_identifier_token_offset;
+    size_t next_identifier_token_location;
+    size_t next_integer_token_offset;
+    size_t next_integer_token_location;
+    size_t next_string_token_offset;
+    size_t next_string_token_location;
+};
+// Reserve 10 bytes for each entry (the maximum encoded size of a 64-bit value).
+#define RESERVATION_AMOUNT 10
+static inline uint64_t read_tree(size_t *offset, struct owl_tree *tree) {
+    uint8_t *parse_tree = tree->parse_tree;
+    size_t parse_tree_size = tree->parse_tree_size;
+    size_t i = *offset;
+    if (i + RESERVATION_AMOUNT >= parse_tree_size)
+        return 0;
+    uint64_t result = 0;
+    int shift_amount = 0;
+    while ((parse_tree[i] & 0x80) != 0 && shift_amount < 64) {
+        result |= ((uint64_t)parse_tree[i] & 0x7f) << shift_amount;
+        shift_amount += 7;
+        i++;
+    }
+    result |= ((uint64_t)parse_tree[i] & 0x7f) << shift_amount;
+    i++;
+    *offset = i;
+    return result;
+}
+static bool grow_tree(struct owl_tree *tree, size_t size)
+{
+    size_t n = tree->parse_tree_size;
+    while (n < size || n < 4096)
+        n = (n + 1) * 3 / 2;
+    uint8_t *parse_tree = reallocate_memory(tree->parse_tree, tree->parse_tree_size, n, &tree->allocator);
+    if (!parse_tree)
+        return false;
+    tree->parse_tree_size = n;
+    tree->parse_tree = parse_tree;
+    return true;
+}
+static void write_tree(struct owl_tree *tree, uint64_t value)
+{
+    size_t reserved_size = tree->next_offset + RESERVATION_AMOUNT;
+    if (tree->parse_tree_size <= reserved_size && !grow_tree(tree, reserved_size))
+        abort();
+    while (value >> 7 != 0) {
+        tree->parse_tree[tree->next_offset++] = 0x80 | (value & 0x7f);
+        value >>= 7;
+    }
+    tree->parse_tree[tree->next_offset++] = value & 0x7f;
+}
+static void push_start(struct owl_tree *tree, size_t offset, size_t start)
+{
+    size_t n = tree->number_of_pending_starts;
+    if (n == tree->pending_starts_capacity) {
+        size_t capacity = n * 2 + 16;
+        struct pending_start *pending_starts = reallocate_memory(tree->pending_starts,
+         n * sizeof(struct pending_start), capacity * sizeof(struct pending_start), &tree->allocator);
+        if (!pending_starts)
+            abort();
+        tree->pending_starts = pending_starts;
+        tree->pending_starts_capacity = capacity;
+    }
+    tree->pending_starts[n] = (struct pending_start){ .offset = offset, .start = start };
+    tree->number_of_pending_starts = n + 1;
+}
+// Nodes are almost always referenced right after they're finished, so the
+// search starts with the most recent.
+static size_t take_start(struct owl_tree *tree, size_t offset)
+{
+    size_t n = tree->number_of_pending_starts;
+    size_t i = n;
+    while (i > 0 && tree->pending_starts[i - 1].offset != offset)
+        i--;
+    if (i == 0)
+        abort();
+    size_t start = tree->pending_starts[i - 1].start;
+    memmove(tree->pending_starts + i - 1, tree->pending_starts + i, (n - i) * sizeof(struct pending_start));
+    tree->number_of_pending_starts = n - 1;
+    return start;
+}
+static void write_slot(struct owl_tree *tree, size_t offset, size_t start_location, size_t slot)
+{
+    if (slot == 0) {
+        write_tree(tree, 0);
+        return;
+    }
+    write_tree(tree, offset - slot);
+    write_tree(tree, take_start(tree, slot) - start_location);
+}
+static inline struct owl_ref read_slot(size_t *offset, struct owl_ref ref, size_t start_location, uint32_t type)
+{
+    size_t delta = read_tree(offset, ref._tree);
+    if (delta == 0)
+        return (struct owl_ref){ ._tree = ref._tree, ._type = type, .empty = true };
+    return (struct owl_ref){
+        ._tree = ref._tree,
+        ._offset = ref._offset - delta,
+        ._start = start_location + read_tree(offset, ref._tree),
+        ._type = type,
+    };
+}
+struct parsed_script parsed_script_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 0) {
+        return (struct parsed_script){
+            .statement.empty = true,
+        };
+    }
+    size_t offset = ref._offset;
+    if (read_tree(&offset, ref._tree) != 0)
+        read_tree(&offset, ref._tree); // Read and ignore the 'next gap' field.
+    size_t start_location = ref._start;
+    size_t end_location = start_location + read_tree(&offset, ref._tree);
+    struct parsed_script result = {
+        .range.start = start_location,
+        .range.end = end_location,
+    };
+    result.statement = read_slot(&offset, ref, start_location, 1);
+    return result;
+}
+struct parsed_statement parsed_statement_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 1) {
+        return (struct parsed_statement){
+            .word.empty = true,
+        };
+    }
+    size_t offset = ref._offset;
+    if (read_tree(&offset, ref._tree) != 0)
+        read_tree(&offset, ref._tree); // Read and ignore the 'next gap' field.
+    size_t start_location = ref._start;
+    size_t end_location = start_location + read_tree(&offset, ref._tree);
+    struct parsed_statement result = {
+        .range.start = start_location,
+        .range.end = end_location,
+    };
+    result.word = read_slot(&offset, ref, start_location, 2);
+    return result;
+}
+struct parsed_word parsed_word_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 2) {
+        return (struct parsed_word){
+            .keyword.empty = true,
+            .identifier.empty = true,
+            .integer.empty = true,
+            .string.empty = true,
+            .word.empty = true,
+        };
+    }
+    size_t offset = ref._offset;
+    if (read_tree(&offset, ref._tree) != 0)
+        read_tree(&offset, ref._tree); // Read and ignore the 'next gap' field.
+    size_t start_location = ref._start;
+    size_t end_location = start_location + read_tree(&offset, ref._tree);
+    struct parsed_word result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .type = (enum parsed_type)read_tree(&offset, ref._tree),
+    };
+    result.keyword = read_slot(&offset, ref, start_location, 3);
+    result.identifier = read_slot(&offset, ref, start_location, 4);
+    result.integer = read_slot(&offset, ref, start_location, 5);
+    result.string = read_slot(&offset, ref, start_location, 6);
+    result.word = read_slot(&offset, ref, start_location, 2);
+    return result;
+}
+struct parsed_keyword parsed_keyword_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 3) {
+        return (struct parsed_keyword){
+            {0}
+        };
+    }
+    size_t offset = ref._offset;
+    if (read_tree(&offset, ref._tree) != 0)
+        read_tree(&offset, ref._tree); // Read and ignore the 'next gap' field.
+    size_t start_location = ref._start;
+    size_t end_location = start_location + read_tree(&offset, ref._tree);
+    struct parsed_keyword result = {
+        .range.start = start_location,
+        .range.end = end_location,
+    };
+    return result;
+}
+struct parsed_identifier parsed_identifier_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 4) {
+        return (struct parsed_identifier){
+            {0}
+        };
+    }
+    size_t offset = ref._offset;
+    if (read_tree(&offset, ref._tree) != 0)
+        read_tree(&offset, ref._tree); // Read and ignore the 'next gap' field.
+    size_t start_location = ref._start;
+    size_t token_offset = ref._offset - read_tree(&offset, ref._tree);
+    read_tree(&token_offset, ref._tree);
+    read_tree(&token_offset, ref._tree);
+    size_t end_location = start_location + read_tree(&token_offset, ref._tree);
+    struct parsed_identifier result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .identifier = ref._tree->string + start_location,
+        .length = end_location - start_location,
+    };
+    return result;
+}
+struct parsed_integer parsed_integer_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 5) {
+        return (struct parsed_integer){
+            {0}
+        };
+    }
+    size_t offset = ref._offset;
+    if (read_tree(&offset, ref._tree) != 0)
+        read_tree(&offset, ref._tree); // Read and ignore the 'next gap' field.
+    size_t start_location = ref._start;
+    size_t token_offset = ref._offset - read_tree(&offset, ref._tree);
+    read_tree(&token_offset, ref._tree);
+    read_tree(&token_offset, ref._tree);
+    size_t end_location = start_location + read_tree(&token_offset, ref._tree);
+    struct parsed_integer result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .integer = read_tree(&token_offset, ref._tree),
+    };
+    return result;
+}
+struct parsed_string parsed_string_get(struct owl_ref ref) {
+    if (ref.empty || ref._type != 6) {
+        return (struct parsed_string){
+            {0}
+        };
+    }
+    size_t offset = ref._offset;
+    if (read_tree(&offset, ref._tree) != 0)
+        read_tree(&offset, ref._tree); // Read and ignore the 'next gap' field.
+    size_t start_location = ref._start;
+    size_t token_offset = ref._offset - read_tree(&offset, ref._tree);
+    read_tree(&token_offset, ref._tree);
+    read_tree(&token_offset, ref._tree);
+    size_t end_location = start_location + read_tree(&token_offset, ref._tree);
+    size_t string_offset = read_tree(&token_offset, ref._tree);
+    const char *string = string_offset ?
+     (const char *)ref._tree->parse_tree + string_offset : ref._tree->string + start_location + 1;
+    size_t string_length = string_offset ?
+     read_tree(&token_offset, ref._tree) : end_location - start_location - 2;
+    struct parsed_string result = {
+        .range.start = start_location,
+        .range.end = end_location,
+        .string = string,
+        .length = string_length,
+    };
+    return result;
+}
+static size_t number_of_slots_lookup(uint32_t rule, void *context);
+static size_t build_node(uint32_t rule, uint32_t choice, size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, struct owl_tree *tree) {
+    void *children[6];
+    size_t number_of_slots = number_of_slots_lookup(rule, tree);
+    for (size_t i = 0; i < number_of_slots; ++i)
+        children[i] = (void *)(uintptr_t)slots[i];
+    struct owl_match match = {
+        .rule = (enum owl_rule)rule,
+        .range = { start_location, end_location },
+        .slots = children,
+    };
+    switch (rule) {
+    case 2:
+        switch (choice) {
+        case 0:
+            match.type = PARSED_KEYWORD;
+            break;
+        case 1:
+            match.type = PARSED_IDENTIFIER;
+            break;
+        case 2:
+            match.type = PARSED_INTEGER;
+            break;
+        case 3:
+            match.type = PARSED_STRING;
+            break;
+        case 4:
+            match.type = PARSED_PARENS;
+            break;
+        case 5:
+            match.type = PARSED_COMMA;
+            break;
+        case 6:
+            match.type = PARSED_DOT;
+            break;
+        case 7:
+            match.type = PARSED_EQUALS;
+            break;
+        case 8:
+            match.type = PARSED_STAR;
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);
+}
+static size_t build_token(uint32_t rule, size_t next_sibling, struct owl_tree *tree) {
+    struct owl_match match = { .rule = (enum owl_rule)rule };
+    switch (rule) {
+    case 4: {
+        size_t offset = tree->next_identifier_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_identifier_token_offset -= read_tree(&offset, tree);
+        match.range.start = tree->next_identifier_token_location;
+        tree->next_identifier_token_location -= read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        match.identifier = tree->string + match.range.start;
+        match.length = match.range.end - match.range.start;
+        break;
+    }
+    case 5: {
+        size_t offset = tree->next_integer_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_integer_token_offset -= read_tree(&offset, tree);
+        match.range.start = tree->next_integer_token_location;
+        tree->next_integer_token_location -= read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        match.integer = read_tree(&offset, tree);
+        break;
+    }
+    case 6: {
+        size_t offset = tree->next_string_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_string_token_offset -= read_tree(&offset, tree);
+        match.range.start = tree->next_string_token_location;
+        tree->next_string_token_location -= read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        size_t string_offset = read_tree(&offset, tree);
+        if (string_offset) {
+            match.string = (const char *)tree->parse_tree + string_offset;
+            match.length = read_tree(&offset, tree);
+        } else {
+            match.string = tree->string + match.range.start + 1;
+            match.length = match.range.end - match.range.start - 2;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);
+}
+static size_t finish_node(uint32_t rule, uint32_t choice, size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, void *info) {
+    struct owl_tree *tree = info;
+    if (tree->builder)
+        return build_node(rule, choice, next_sibling, slots, start_location, end_location, tree);
+    size_t offset = tree->next_offset;
+    write_tree(tree, next_sibling ? offset - next_sibling : 0);
+    if (next_sibling)
+        write_tree(tree, take_start(tree, next_sibling) - end_location);
+    write_tree(tree, end_location - start_location);
+    switch (rule) {
+    case 0: {
+        write_slot(tree, offset, start_location, slots[0]);
+        break;
+    }
+    case 1: {
+        write_slot(tree, offset, start_location, slots[0]);
+        break;
+    }
+    case 2: {
+        switch (choice) {
+        case 0:
+            write_tree(tree, PARSED_KEYWORD);
+            break;
+        case 1:
+            write_tree(tree, PARSED_IDENTIFIER);
+            break;
+        case 2:
+            write_tree(tree, PARSED_INTEGER);
+            break;
+        case 3:
+            write_tree(tree, PARSED_STRING);
+            break;
+        case 4:
+            write_tree(tree, PARSED_PARENS);
+            break;
+        case 5:
+            write_tree(tree, PARSED_COMMA);
+            break;
+        case 6:
+            write_tree(tree, PARSED_DOT);
+            break;
+        case 7:
+            write_tree(tree, PARSED_EQUALS);
+            break;
+        case 8:
+            write_tree(tree, PARSED_STAR);
+            break;
+        }
+        write_slot(tree, offset, start_location, slots[0]);
+        write_slot(tree, offset, start_location, slots[1]);
+        write_slot(tree, offset, start_location, slots[2]);
+        write_slot(tree, offset, start_location, slots[3]);
+        write_slot(tree, offset, start_location, slots[4]);
+        break;
+    }
+    case 3: {
+        break;
+    }
+    default:
+        break;
+    }
+    push_start(tree, offset, start_location);
+    return offset;
+}
+static size_t finish_token(uint32_t rule, size_t next_sibling, void *info) {
+    struct owl_tree *tree = info;
+    if (tree->builder)
+        return build_token(rule, next_sibling, tree);
+    size_t offset = tree->next_offset;
+    size_t token_offset = 0;
+    size_t start_location = 0;
+    size_t end_location = 0;
+    switch (rule) {
+    case 4: {
+        size_t offset4 = tree->next_identifier_token_offset;
+        if (offset4 == 0)
+            abort();
+        token_offset = offset4;
+        tree->next_identifier_token_offset = offset4;
+        tree->next_identifier_token_offset -= read_tree(&offset4, tree);
+        start_location = tree->next_identifier_token_location;
+        tree->next_identifier_token_location -= read_tree(&offset4, tree);
+        end_location = start_location + read_tree(&offset4, tree);
+        break;
+    }
+    case 5: {
+        size_t offset5 = tree->next_integer_token_offset;
+        if (offset5 == 0)
+            abort();
+        token_offset = offset5;
+        tree->next_integer_token_offset = offset5;
+        tree->next_integer_token_offset -= read_tree(&offset5, tree);
+        start_location = tree->next_integer_token_location;
+        tree->next_integer_token_location -= read_tree(&offset5, tree);
+        end_location = start_location + read_tree(&offset5, tree);
+        break;
+    }
+    case 6: {
+        size_t offset6 = tree->next_string_token_offset;
+        if (offset6 == 0)
+            abort();
+        token_offset = offset6;
+        tree->next_string_token_offset = offset6;
+        tree->next_string_token_offset -= read_tree(&offset6, tree);
+        start_location = tree->next_string_token_location;
+        tree->next_string_token_location -= read_tree(&offset6, tree);
+        end_location = start_location + read_tree(&offset6, tree);
+        break;
+    }
+    default:
+        break;
+    }
+    write_tree(tree, next_sibling ? offset - next_sibling : 0);
+    if (next_sibling)
+        write_tree(tree, take_start(tree, next_sibling) - end_location);
+    write_tree(tree, offset - token_offset);
+    push_start(tree, offset, start_location);
+    return offset;
+}
+static void check_for_error(struct owl_tree *tree) {
+    if (tree->error == ERROR_NONE)
+        return;
+    fprintf(stderr, "parse error: ");
+    switch (tree->error) {
+    case ERROR_INVALID_FILE:
+        fprintf(stderr, "invalid file\n");
+        break;
+    case ERROR_INVALID_OPTIONS:
+        fprintf(stderr, "invalid options\n");
+        break;
+    case ERROR_INVALID_TOKEN:
+        fprintf(stderr, "invalid token '%.*s'\n", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);
+        break;
+    case ERROR_UNEXPECTED_TOKEN:
+        fprintf(stderr, "unexpected token '%.*s'\n", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);
+        break;
+    case ERROR_MORE_INPUT_NEEDED:
+        fprintf(stderr, "more input needed\n");
+        break;
+    default:
+        break;
+    }
+    exit(-1);
+}
+static void parsed_script_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_statement_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_word_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_keyword_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_identifier_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_integer_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_string_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent);
+static void parsed_script_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_script it = parsed_script_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("script");
+        if (strcmp("script", slot_name))
+            printf("@%s", slot_name);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        parsed_statement_print(tree, it.statement, "statement", indent + 1);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_statement_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_statement it = parsed_statement_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("statement");
+        if (strcmp("statement", slot_name))
+            printf("@%s", slot_name);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        parsed_word_print(tree, it.word, "word", indent + 1);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_word_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_word it = parsed_word_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("word");
+        if (strcmp("word", slot_name))
+            printf("@%s", slot_name);
+        switch (it.type) {
+        case PARSED_KEYWORD:
+            printf(" : KEYWORD");
+            break;
+        case PARSED_IDENTIFIER:
+            printf(" : IDENTIFIER");
+            break;
+        case PARSED_INTEGER:
+            printf(" : INTEGER");
+            break;
+        case PARSED_STRING:
+            printf(" : STRING");
+            break;
+        case PARSED_PARENS:
+            printf(" : PARENS");
+            break;
+        case PARSED_COMMA:
+            printf(" : COMMA");
+            break;
+        case PARSED_DOT:
+            printf(" : DOT");
+            break;
+        case PARSED_EQUALS:
+            printf(" : EQUALS");
+            break;
+        case PARSED_STAR:
+            printf(" : STAR");
+            break;
+        default:
+            break;
+        }
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        parsed_keyword_print(tree, it.keyword, "keyword", indent + 1);
+        parsed_identifier_print(tree, it.identifier, "identifier", indent + 1);
+        parsed_integer_print(tree, it.integer, "integer", indent + 1);
+        parsed_string_print(tree, it.string, "string", indent + 1);
+        parsed_word_print(tree, it.word, "word", indent + 1);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_keyword_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_keyword it = parsed_keyword_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("keyword");
+        if (strcmp("keyword", slot_name))
+            printf("@%s", slot_name);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_identifier_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_identifier it = parsed_identifier_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("identifier");
+        if (strcmp("identifier", slot_name))
+            printf("@%s", slot_name);
+        printf(" - %.*s", (int)it.length, it.identifier);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_integer_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_integer it = parsed_integer_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("integer");
+        if (strcmp("integer", slot_name))
+            printf("@%s", slot_name);
+        printf(" - %" PRIu64, it.integer);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        ref = owl_next(ref);
+    }
+}
+static void parsed_string_print(struct owl_tree *tree, struct owl_ref ref, const char *slot_name, int indent) {
+    int i;
+    while (!ref.empty) {
+        struct parsed_string it = parsed_string_get(ref);
+        for (i = 0; i < indent; ++i) printf("  ");
+        printf("string");
+        if (strcmp("string", slot_name))
+            printf("@%s", slot_name);
+        printf(" - %.*s", (int)it.length, it.string);
+        printf(" (%zu - %zu)\n", it.range.start, it.range.end);
+        ref = owl_next(ref);
+    }
+}
+void owl_tree_print(struct owl_tree *tree) {
+    check_for_error(tree);
+    parsed_script_print(tree, owl_tree_root_ref(tree), "script", 0);
+}
+struct owl_ref owl_next(struct owl_ref ref) {
+    if (ref.empty) return ref;
+    size_t offset = ref._offset;
+    size_t delta = read_tree(&ref._offset, ref._tree);
+    size_t start = 0;
+    if (delta != 0) {
+        size_t gap = read_tree(&ref._offset, ref._tree);
+        size_t length_offset = ref._offset;
+        switch (ref._type) {
+        case 4:
+        case 5:
+        case 6:
+            length_offset = offset - read_tree(&ref._offset, ref._tree);
+            read_tree(&length_offset, ref._tree);
+            read_tree(&length_offset, ref._tree);
+            break;
+        default:
+            break;
+        }
+        start = ref._start + read_tree(&length_offset, ref._tree) + gap;
+    }
+    return (struct owl_ref){
+        ._tree = ref._tree,
+        ._offset = offset - delta,
+        ._start = start,
+        ._type = ref._type,
+        .empty = delta == 0,
+    };
+}
+bool owl_refs_equal(struct owl_ref a, struct owl_ref b) {
+    return a._tree == b._tree && a._offset == b._offset;
+}
+struct owl_ref owl_tree_root_ref(struct owl_tree *tree) {
+    check_for_error(tree);
+    return (struct owl_ref){
+        ._tree = tree,
+        ._offset = tree->root_offset,
+        ._start = tree->root_start,
+        ._type = 0,
+        .empty = tree->root_offset == 0,
+    };
+}
+struct parsed_script owl_tree_get_parsed_script(struct owl_tree *tree) {
+    check_for_error(tree);
+    return parsed_script_get(owl_tree_root_ref(tree));
+}
+#define ESCAPE_CHAR(c, info) ((c) == 'b' ? '\b' : (c) == 'f' ? '\f' : (c) == 'n' ? '\n' : (c) == 'r' ? '\r' : (c) == 't' ? '\t' : (c))
+#define IGNORE_TOKEN_WRITE(...)
+#define IGNORE_TOKEN_READ(...) (0)
+#define CUSTOM_TOKEN_DATA(...)
+#define IF_IDENTIFIER_TOKEN(cond, ...) if (cond) __VA_ARGS__
+#define INTEGER_TOKEN_DATA(name) uint64_t name
+#define IF_INTEGER_TOKEN(cond, ...) if (cond) __VA_ARGS__
+#define NUMBER_TOKEN_DATA(...)
+#define IF_NUMBER_TOKEN(...) if (0) { /* no number tokens */  }
+#define IF_STRING_TOKEN(cond, ...) if (cond) __VA_ARGS__
+static size_t read_whitespace(const char *text, size_t length, void *info);
+static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, size_t length, void *info);
+#define IF_IDENTIFIER_KEYWORDS(...)
+static void write_identifier_token(size_t offset, size_t length, void *info) {
+    struct owl_tree *tree = info;
+    size_t token_offset = tree->next_offset;
+    write_tree(tree, token_offset - tree->next_identifier_token_offset);
+    write_tree(tree, offset - tree->next_identifier_token_location);
+    tree->next_identifier_token_location = offset;
+    write_tree(tree, length);
+    tree->next_identifier_token_offset = token_offset;
+}
+static void write_integer_token(size_t offset, size_t length, uint64_t integer, void *info) {
+    struct owl_tree *tree = info;
+    size_t token_offset = tree->next_offset;
+    write_tree(tree, token_offset - tree->next_integer_token_offset);
+    write_tree(tree, offset - tree->next_integer_token_location);
+    tree->next_integer_token_location = offset;
+    write_tree(tree, length);
+    write_tree(tree, integer);
+    tree->next_integer_token_offset = token_offset;
+}
+static void write_string_token(size_t offset, size_t length, const char *string, size_t string_length, bool has_escapes, void *info) {
+    struct owl_tree *tree = info;
+    size_t string_offset = has_escapes ? (uint8_t *)string - tree->parse_tree : 0;
+    size_t token_offset = tree->next_offset;
+    write_tree(tree, token_offset - tree->next_string_token_offset);
+    write_tree(tree, offset - tree->next_string_token_location);
+    tree->next_string_token_location = offset;
+    write_tree(tree, length);
+    if (string_offset) {
+        write_tree(tree, string_offset);
+        write_tree(tree, string_length);
+    } else
+        write_tree(tree, 0);
+    tree->next_string_token_offset = token_offset;
+}
+static void *allocate_string_contents(size_t size, void *info) {
+    struct owl_tree *tree = info;
+    if (tree->next_offset + size > tree->parse_tree_size)
+        grow_tree(tree, tree->next_offset + size);
+    void *p = tree->parse_tree + tree->next_offset;
+    tree->next_offset += size;
+    return p;
+}
+// Vectorized scanners for the tokenizer.  These load whole aligned blocks,
+// which can include bytes past the end of the input.  Aligned loads never
+// cross a page boundary, so this is safe, but it upsets memory checkers like
+// AddressSanitizer.  Define OWL_NO_SIMD to use the scalar loops instead.
+#if !defined(OWL_NO_SIMD) && defined(__SANITIZE_ADDRESS__)
+#define OWL_NO_SIMD
+#endif
+#if !defined(OWL_NO_SIMD) && defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define OWL_NO_SIMD
+#endif
+#endif
+#if !defined(OWL_NO_SIMD) && defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define OWL_SIMD
+enum vector_scan_class {
+    VECTOR_SCAN_IDENTIFIER,
+    VECTOR_SCAN_IDENTIFIER_WITH_DASHES,
+    VECTOR_SCAN_DIGITS,
+    VECTOR_SCAN_HEX_DIGITS,
+    VECTOR_SCAN_WHITESPACE,
+    VECTOR_SCAN_STRING,
+    VECTOR_SCAN_LINE,
+};
+typedef unsigned char vector_bytes_sse2 __attribute__((vector_size(16), may_alias));
+typedef char vector_mask_sse2 __attribute__((vector_size(16)));
+static inline  vector_mask_sse2 vector_equal_sse2(vector_bytes_sse2 x, unsigned char c) {
+    return (vector_mask_sse2)(x == c);
+}
+static inline  vector_mask_sse2 vector_in_range_sse2(vector_bytes_sse2 x, unsigned char low, unsigned char high) {
+    return (vector_mask_sse2)(x - low <= (unsigned char)(high - low));
+}
+static inline  uint32_t vector_stop_mask_sse2(vector_bytes_sse2 x, enum vector_scan_class kind, char quote) {
+    vector_mask_sse2 keep = {0};
+    vector_bytes_sse2 lowercase = x | 0x20;
+    switch (kind) {
+    case VECTOR_SCAN_IDENTIFIER_WITH_DASHES:
+        keep = vector_equal_sse2(x, '-');
+        // Fall through.
+    case VECTOR_SCAN_IDENTIFIER:
+        keep |= vector_equal_sse2(x, '_') | vector_in_range_sse2(lowercase, 'a', 'z') | vector_in_range_sse2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_HEX_DIGITS:
+        keep = vector_in_range_sse2(lowercase, 'a', 'f');
+        // Fall through.
+    case VECTOR_SCAN_DIGITS:
+        keep |= vector_in_range_sse2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_WHITESPACE:
+        keep |= vector_equal_sse2(x, 32);
+        keep |= vector_equal_sse2(x, 9);
+        keep |= vector_equal_sse2(x, 10);
+        keep |= vector_equal_sse2(x, 13);
+        break;
+    case VECTOR_SCAN_STRING:
+        keep = vector_equal_sse2(x, (unsigned char)quote) | vector_equal_sse2(x, '\\') | vector_equal_sse2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb128(keep);
+    case VECTOR_SCAN_LINE:
+        keep = vector_equal_sse2(x, '\n') | vector_equal_sse2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb128(keep);
+    }
+    // Zero bytes never belong to a run.
+    return ~(uint32_t)__builtin_ia32_pmovmskb128(keep) & 0xffffu;
+}
+// Here, `offset` must be less than `end`.  Aligned blocks which contain at
+// least one byte of the text can't cross into an unmapped page.
+static inline  size_t vector_scan_sse2(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)(16 - 1));
+    uint32_t stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote) & (0xffffu << (start - block));
+    while (!stop) {
+        block += 16;
+        if (block >= text + end)
+            return end;
+        stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote);
+    }
+    size_t stop_offset = (size_t)(block - text) + (size_t)__builtin_ctz(stop);
+    return stop_offset < end ? stop_offset : end;
+}
+typedef unsigned char vector_bytes_avx2 __attribute__((vector_size(32), may_alias));
+typedef char vector_mask_avx2 __attribute__((vector_size(32)));
+static inline __attribute__((target("avx2")))  vector_mask_avx2 vector_equal_avx2(vector_bytes_avx2 x, unsigned char c) {
+    return (vector_mask_avx2)(x == c);
+}
+static inline __attribute__((target("avx2")))  vector_mask_avx2 vector_in_range_avx2(vector_bytes_avx2 x, unsigned char low, unsigned char high) {
+    return (vector_mask_avx2)(x - low <= (unsigned char)(high - low));
+}
+static inline __attribute__((target("avx2")))  uint32_t vector_stop_mask_avx2(vector_bytes_avx2 x, enum vector_scan_class kind, char quote) {
+    vector_mask_avx2 keep = {0};
+    vector_bytes_avx2 lowercase = x | 0x20;
+    switch (kind) {
+    case VECTOR_SCAN_IDENTIFIER_WITH_DASHES:
+        keep = vector_equal_avx2(x, '-');
+        // Fall through.
+    case VECTOR_SCAN_IDENTIFIER:
+        keep |= vector_equal_avx2(x, '_') | vector_in_range_avx2(lowercase, 'a', 'z') | vector_in_range_avx2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_HEX_DIGITS:
+        keep = vector_in_range_avx2(lowercase, 'a', 'f');
+        // Fall through.
+    case VECTOR_SCAN_DIGITS:
+        keep |= vector_in_range_avx2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_WHITESPACE:
+        keep |= vector_equal_avx2(x, 32);
+        keep |= vector_equal_avx2(x, 9);
+        keep |= vector_equal_avx2(x, 10);
+        keep |= vector_equal_avx2(x, 13);
+        break;
+    case VECTOR_SCAN_STRING:
+        keep = vector_equal_avx2(x, (unsigned char)quote) | vector_equal_avx2(x, '\\') | vector_equal_avx2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb256(keep);
+    case VECTOR_SCAN_LINE:
+        keep = vector_equal_avx2(x, '\n') | vector_equal_avx2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb256(keep);
+    }
+    // Zero bytes never belong to a run.
+    return ~(uint32_t)__builtin_ia32_pmovmskb256(keep) & 0xffffffffu;
+}
+// Here, `offset` must be less than `end`.  Aligned blocks which contain at
+// least one byte of the text can't cross into an unmapped page.
+static inline __attribute__((target("avx2")))  size_t vector_scan_avx2(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)(32 - 1));
+    uint32_t stop = vector_stop_mask_avx2(*(const vector_bytes_avx2 *)block, kind, quote) & (0xffffffffu << (start - block));
+    while (!stop) {
+        block += 32;
+        if (block >= text + end)
+            return end;
+        stop = vector_stop_mask_avx2(*(const vector_bytes_avx2 *)block, kind, quote);
+    }
+    size_t stop_offset = (size_t)(block - text) + (size_t)__builtin_ctz(stop);
+    return stop_offset < end ? stop_offset : end;
+}
+static inline size_t vector_scan(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    if (offset >= end)
+        return end;
+#ifdef __AVX2__
+    return vector_scan_avx2(text, offset, end, kind, quote);
+#else
+    // Most runs end within the first block, so only dispatch to AVX2 for the
+    // rest of a longer run.
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)15);
+    uint32_t stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote) & (0xffffu << (start - block));
+    offset = (size_t)(block - text) + (stop ? (size_t)__builtin_ctz(stop) : 16);
+    if (stop || offset >= end)
+        return offset < end ? offset : end;
+    if (__builtin_cpu_supports("avx2"))
+        return vector_scan_avx2(text, offset, end, kind, quote);
+    return vector_scan_sse2(text, offset, end, kind, quote);
+#endif
+}
+#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) vector_scan(text, offset, end, VECTOR_SCAN_IDENTIFIER_WITH_DASHES, 0)
+#define SKIP_DIGITS(text, offset, end, hexadecimal) vector_scan(text, offset, end, (hexadecimal) ? VECTOR_SCAN_HEX_DIGITS : VECTOR_SCAN_DIGITS, 0)
+#define SKIP_STRING_CHARS(text, offset, end, quote) vector_scan(text, offset, end, VECTOR_SCAN_STRING, quote)
+#define SKIP_LINE(text, offset, end) vector_scan(text, offset, end, VECTOR_SCAN_LINE, 0)
+#else
+#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) (offset)
+#define SKIP_DIGITS(text, offset, end, hexadecimal) (offset)
+#define SKIP_STRING_CHARS(text, offset, end, quote) (offset)
+#define SKIP_LINE(text, offset, end) (offset)
+#endif
+struct owl_token_run {
+    struct owl_token_run *prev;
+    uint16_t number_of_tokens;
+    uint16_t lengths_size;
+    uint8_t lengths[4096 * 2];
+    uint32_t tokens[4096];
+    uint32_t states[4096];
+};
+struct owl_default_tokenizer {
+    const char *text;
+    size_t length;
+    size_t offset;
+    size_t whitespace;
+    uint32_t identifier_token;
+    uint32_t number_token;
+    uint32_t string_token;
+    void *info;
+    bool more_input;
+    bool deferred;
+    size_t lookahead;
+    struct owl_token_run *free_runs;
+    void *allocator;
+};
+static bool char_is_whitespace(char c) {
+    switch (c) {
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+        return true;
+    default:
+        return false;
+    }
+}
+static bool char_is_numeric(char c) {
+    return c >= '0' && c <= '9';
+}
+static bool char_is_alphabetic(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+static bool char_is_hexadecimal_alpha(char c) {
+    return (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+static bool char_starts_identifier(char c) {
+    return char_is_alphabetic(c) || c == '_';
+}
+static bool char_continues_identifier(char c, void *info) {
+    if (true && c == '-') return true;
+    return char_is_numeric(c) || char_starts_identifier(c);
+}
+static bool char_ends_identifier(char c) {
+    return c != '-';
+}
+static inline uint64_t read_eight_bytes(const char *text) {
+    uint8_t b[8];
+    memcpy(b, text, 8);
+    return (uint64_t)b[0] | (uint64_t)b[1] << 8 | (uint64_t)b[2] << 16 | (uint64_t)b[3] << 24 | (uint64_t)b[4] << 32 | (uint64_t)b[5] << 40 | (uint64_t)b[6] << 48 | (uint64_t)b[7] << 56;
+}
+static inline bool eight_bytes_are_digits(uint64_t chunk) {
+    return !(((chunk + 0x4646464646464646) | (chunk - 0x3030303030303030)) & 0x8080808080808080);
+}
+static inline uint32_t eight_digits_value(uint64_t chunk) {
+    chunk -= 0x3030303030303030;
+    chunk = chunk * 10 + (chunk >> 8);
+    chunk = ((chunk & 0x000000ff000000ff) * 0x000f424000000064 + ((chunk >> 16) & 0x000000ff000000ff) * 0x0000271000000001) >> 32;
+    return (uint32_t)chunk;
+}
+static bool encode_length(struct owl_token_run *run, uint16_t *lengths_size, size_t length) {
+    uint8_t mark = 0;
+    while (*lengths_size < sizeof(run->lengths)) {
+        run->lengths[*lengths_size] = mark | (length & 0x7f);
+        mark = 0x80;
+        length >>= 7;
+        (*lengths_size)++;
+        if (length == 0) return true;
+    }
+    return false;
+}
+static bool encode_token_length(struct owl_token_run *run, uint16_t *lengths_size, size_t length, size_t whitespace) {
+    uint16_t size = *lengths_size;
+    if (encode_length(run, lengths_size, length) && encode_length(run, lengths_size, whitespace)) return true;
+    *lengths_size = size;
+    return false;
+}
+static size_t decode_length(struct owl_token_run *run, uint16_t *length_offset) {
+    size_t length = 0;
+    while (*length_offset < sizeof(run->lengths)) {
+        size_t l = run->lengths[(*length_offset)--];
+        length <<= 7;
+        length += l & 0x7f;
+        if (!(l & 0x80)) return length;
+    }
+    abort();
+}
+static size_t decode_token_length(struct owl_token_run *run, uint16_t *length_offset, size_t *string_offset) {
+    size_t whitespace = decode_length(run, length_offset);
+    size_t length = decode_length(run, length_offset);
+    *string_offset -= whitespace + length;
+    return length;
+}
+static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer, struct owl_token_run **previous_run) {
+    struct owl_token_run *run = tokenizer->free_runs;
+    if (run) tokenizer->free_runs = run->prev;
+    else {
+        run = allocate_memory(sizeof(struct owl_token_run), tokenizer->allocator);
+        if (!run) return false;
+    }
+    uint16_t number_of_tokens = 0;
+    uint16_t lengths_size = 0;
+    const char *text = tokenizer->text;
+    size_t whitespace = tokenizer->whitespace;
+    size_t length = tokenizer->length;
+    size_t offset = tokenizer->offset;
+    size_t limit = SIZE_MAX;
+    size_t token_limit = length;
+    if (tokenizer->more_input) {
+        limit = length;
+    token_limit = length > tokenizer->lookahead ? length - tokenizer->lookahead :
+        0;
+    }
+    bool deferred = false;
+    while (number_of_tokens < 4096) {
+        if (offset >= token_limit) {
+            deferred = tokenizer->more_input;
+            break;
+        }
+        char c = text[offset];
+        size_t whitespace_length = read_whitespace(text + offset, length - offset, tokenizer->info);
+        if (whitespace_length > 0) {
+            whitespace += whitespace_length;
+            offset += whitespace_length;
+            continue;
+        }
+        uint32_t token = -1;
+        CUSTOM_TOKEN_DATA(custom_data);
+        uint64_t integer = 0;
+        NUMBER_TOKEN_DATA(number);
+        bool is_token = false;
+        bool end_token = false;
+        bool custom_token = false;
+        bool comment = false;
+        bool custom_whitespace = false;
+        bool has_escapes = false;
+        size_t token_length = read_keyword_token(&token, &end_token, text + offset, length - offset, tokenizer->info);
+        if (token_length > 0) {
+            is_token = true;
+            if (token == 4294967295U) comment = true;
+        }
+        if (IGNORE_TOKEN_READ(&token, &token_length, text + offset, length - offset, &custom_whitespace, &custom_data, tokenizer->info)) {
+            is_token = true;
+            custom_token = true;
+            end_token = false;
+            comment = false;
+        }
+        IF_INTEGER_TOKEN(char_is_numeric(c), {
+            size_t integer_offset = offset;
+            uint64_t base = 10;
+            if (c == '0' && offset + 2 < length && (text[offset + 1] == 'x' || text[offset + 1] == 'X') && (char_is_numeric(text[offset + 2]) || char_is_hexadecimal_alpha(text[integer_offset + 2]))) {
+                integer_offset = offset + 2;
+                base = 16;
+            }
+            integer = 0;
+            bool overflow = false;
+            while (base == 10 && integer_offset + 8 <= length && integer <= (UINT64_MAX - 99999999) / 100000000) {
+                uint64_t chunk = read_eight_bytes(text + integer_offset);
+                if (!eight_bytes_are_digits(chunk)) break;
+                integer = integer * 100000000 + eight_digits_value(chunk);
+                integer_offset += 8;
+            }
+            size_t digits_end = SKIP_DIGITS(text, integer_offset, length, base == 16);
+            while (integer_offset < digits_end || (integer_offset < length && (char_is_numeric(text[integer_offset]) || (base == 16 && char_is_hexadecimal_alpha(text[integer_offset]))))) {
+                uint64_t last = integer;
+                integer *= base;
+                uint64_t ch = text[integer_offset];
+                if (ch >= '0' && ch <= '9') integer += ch - '0';
+                else if (ch >= 'a' && ch <= 'f') integer += ch - 'a' + 0xa;
+                else if (ch >= 'A' && ch <= 'F') integer += ch - 'A' + 0xA;
+                if (integer < last) {
+                    overflow = true;
+                    break;
+                }
+                integer_offset++;
+            }
+            if (integer_offset >= limit) deferred = true;
+            if (!overflow && integer_offset - offset > token_length) {
+                token_length = integer_offset - offset;
+                is_token = true;
+                end_token = false;
+                comment = false;
+                custom_whitespace = false;
+                token = 9;
+            }
+        }
+        ) IF_NUMBER_TOKEN(char_is_numeric(c) || (c == '.' && offset + 1 < length && char_is_numeric(text[offset + 1])), {
+            size_t number_length = 0;
+            number = read_number(text + offset, length - offset, &number_length, tokenizer->allocator);
+            if (offset + number_length + 3 > limit) deferred = true;
+            if (number_length > token_length) {
+                token_length = number_length;
+                is_token = true;
+                end_token = false;
+                comment = false;
+                custom_whitespace = false;
+                token = 4294967295U;
+            }
+        }
+        ) else IF_STRING_TOKEN(c == '\'' || c == '"', {
+            size_t string_offset = SKIP_STRING_CHARS(text, offset + 1, length, c);
+            while (string_offset < length && text[string_offset] != '\0') {
+                if (text[string_offset] == c) {
+                    token_length = string_offset + 1 - offset;
+                    is_token = true;
+                    end_token = false;
+                    comment = false;
+                    custom_whitespace = false;
+                    token = 10;
+                    break;
+                }
+                if (text[string_offset] == '\\') {
+                    has_escapes = true;
+                    string_offset++;
+                    if (string_offset >= length || text[string_offset] == '\0') break;
+                }
+                string_offset = SKIP_STRING_CHARS(text, string_offset + 1, length, c);
+            }
+            if (string_offset >= limit) deferred = true;
+        }
+        ) else IF_IDENTIFIER_TOKEN(char_starts_identifier(c), {
+            size_t identifier_offset = SKIP_IDENTIFIER_CHARS(text, offset + 1, length, tokenizer->info);
+            while (identifier_offset < length && char_continues_identifier(text[identifier_offset], tokenizer->info)) identifier_offset++;
+            if (identifier_offset >= limit) deferred = true;
+            while (!char_ends_identifier(text[identifier_offset - 1])) identifier_offset--;
+            if (identifier_offset - offset > token_length) {
+                token_length = identifier_offset - offset;
+                is_token = true;
+                end_token = false;
+                comment = false;
+                custom_whitespace = false;
+                token = 8;
+                IF_IDENTIFIER_KEYWORDS(!custom_token, {
+                    read_identifier_keyword(&token, &end_token, text + offset, token_length);
+                }
+            ) }
+        }
+        ) if (custom_token && offset + token_length >= token_limit) deferred = true;
+        if (deferred) break;
+        if (custom_whitespace) {
+            whitespace += token_length;
+            offset += token_length;
+            continue;
+        }
+        else if (comment) {
+            size_t line_end = SKIP_LINE(text, offset, length);
+            while (line_end < length && text[line_end] != '\0' && text[line_end] != '\n') line_end++;
+            if (line_end >= limit) {
+                deferred = true;
+                break;
+            }
+            whitespace += line_end - offset;
+            offset = line_end;
+            continue;
+        }
+        else if (!is_token || token == 4294967295U) {
+            tokenizer->offset = offset;
+            tokenizer->whitespace = whitespace;
+            tokenizer->deferred = false;
+            run->prev = tokenizer->free_runs;
+            tokenizer->free_runs = run;
+            return false;
+        }
+        if (end_token && number_of_tokens + 1 >= 4096) break;
+        if (!encode_token_length(run, &lengths_size, token_length, whitespace)) break;
+        if (token == 8) {
+            write_identifier_token(offset, token_length, tokenizer->info);
+        }
+        else if (token == 9) {
+            write_integer_token(offset, token_length, integer, tokenizer->info);
+        }
+        else if (token == 4294967295U) {
+            IGNORE_TOKEN_WRITE(offset, token_length, number, tokenizer->info);
+        }
+        else if (token == 10) {
+            size_t content_offset = offset + 1;
+            size_t content_length = token_length - 2;
+            const char *string = text + content_offset;
+            size_t string_length = content_length;
+            if (has_escapes) {
+                size_t i;
+                for (i = 0;
+                i < content_length;
+                ++i) {
+                    if (text[content_offset + i] == '\\') {
+                        string_length--;
+                        i++;
+                    }
+                }
+                char *unescaped = allocate_string_contents(string_length, tokenizer->info);
+                size_t j = 0;
+                for (i = 0;
+                i < content_length;
+                ++i) {
+                    if (text[content_offset + i] == '\\') i++;
+                    unescaped[j++] = ESCAPE_CHAR(text[content_offset + i], tokenizer->info);
+                }
+                string = unescaped;
+            }
+            write_string_token(offset, token_length, string, string_length, has_escapes, tokenizer->info);
+        }
+        else if (custom_token) {
+            IGNORE_TOKEN_WRITE(offset, token_length, token, custom_data, tokenizer->info);
+        }
+        run->tokens[number_of_tokens] = token;
+        whitespace = 0;
+        number_of_tokens++;
+        offset += token_length;
+        if (end_token) {
+            assert(number_of_tokens < 4096);
+            run->tokens[number_of_tokens] = 4294967295U;
+            number_of_tokens++;
+        }
+    }
+    tokenizer->deferred = deferred;
+    if (number_of_tokens == 0) {
+        tokenizer->offset = offset;
+        tokenizer->whitespace = whitespace;
+        run->prev = tokenizer->free_runs;
+        tokenizer->free_runs = run;
+        return false;
+    }
+    tokenizer->offset = offset;
+    tokenizer->whitespace = whitespace;
+    run->prev = *previous_run;
+    run->number_of_tokens = number_of_tokens;
+    run->lengths_size = lengths_size;
+    *previous_run = run;
+    return true;
+}
+static void free_token_runs(struct owl_token_run **run, void *allocator) {
+    while (*run) {
+        struct owl_token_run *prev = (*run)->prev;
+        free_memory(*run, sizeof(struct owl_token_run), allocator);
+        *run = prev;
+    }
+}
+static void find_token_range(struct owl_default_tokenizer *tokenizer, struct owl_token_run *run, uint16_t index, size_t *start, size_t *end) {
+    size_t offset = tokenizer->offset - tokenizer->whitespace;
+    size_t last_offset = offset;
+    size_t len = 0;
+    uint16_t length_offset = run->lengths_size - 1;
+    uint16_t j;
+    for (j = index;
+    j < run->number_of_tokens;
+    ++j) {
+        if (run->tokens[j] == 4294967295U) continue;
+        last_offset = offset;
+        len = decode_token_length(run, &length_offset, &offset);
+    }
+    *start = last_offset - len;
+    *end = last_offset;
+}
+static void estimate_next_token_range(struct owl_default_tokenizer *tokenizer, size_t *start, size_t *end) {
+    *start = tokenizer->offset;
+    size_t i = tokenizer->offset + 1;
+    while (i < tokenizer->length && tokenizer->text[i] != '\0' && !char_is_whitespace(tokenizer->text[i]) && !char_continues_identifier(tokenizer->text[i], tokenizer->info)) i++;
+    *end = i;
+}
+static void find_end_range(struct owl_default_tokenizer *tokenizer, size_t *start, size_t *end) {
+    *start = tokenizer->offset - tokenizer->whitespace - 1;
+    *end = tokenizer->offset - tokenizer->whitespace;
+    if (*start > *end) {
+        *start = *end;
+        *end += 1;
+    }
+}
+static uint32_t rule_lookup(uint32_t parent, uint32_t slot, void *context);
+static void fixity_associativity_precedence_lookup(int *fixity_associativity, int *precedence, uint32_t rule, uint32_t choice, void *context);
+static size_t number_of_slots_lookup(uint32_t rule, void *context);
+static void left_right_operand_slots_lookup(uint32_t rule, uint32_t *left, uint32_t *right, uint32_t *operand, void *context);
+enum construct_fixity_associativity {
+CONSTRUCT_PREFIX, CONSTRUCT_POSTFIX, CONSTRUCT_INFIX_LEFT, CONSTRUCT_INFIX_RIGHT, CONSTRUCT_INFIX_FLAT, };
+struct construct_node {
+    struct construct_node *next;
+    size_t number_of_slots;
+    size_t *slots;
+    size_t slots_capacity;
+    uint32_t rule;
+    uint16_t slot_index;
+    uint16_t choice_index;
+    enum construct_fixity_associativity fixity_associativity;
+    int precedence;
+    size_t start_location;
+    size_t end_location;
+};
+struct construct_expression {
+    struct construct_expression *parent;
+    struct construct_node *first_operator;
+    struct construct_node *first_value;
+    uint32_t operand_slot_index;
+    uint32_t left_slot_index;
+    uint32_t right_slot_index;
+    uint32_t rule;
+    uint16_t slot_index;
+};
+enum construct_root_type {
+CONSTRUCT_NORMAL_ROOT, CONSTRUCT_EXPRESSION_ROOT, };
+struct construct_state {
+    enum construct_root_type root_type;
+    struct construct_node *under_construction;
+    struct construct_expression *current_expression;
+    struct construct_node *node_freelist;
+    struct construct_expression *expression_freelist;
+    void *info;
+    void *allocator;
+};
+static struct construct_node *construct_node_alloc(struct construct_state *s, uint32_t rule) {
+    struct construct_node *node;
+    size_t number_of_slots = number_of_slots_lookup(rule, s->info);
+    if (s->node_freelist) {
+        node = s->node_freelist;
+        s->node_freelist = node->next;
+        size_t *slots = node->slots;
+        size_t slots_capacity = node->slots_capacity;
+        if (number_of_slots > slots_capacity) {
+            slots = reallocate_memory(slots, slots_capacity * sizeof(size_t), number_of_slots * sizeof(size_t), s->allocator);
+            if (!slots) abort();
+            slots_capacity = number_of_slots;
+        }
+        memset(node, 0, sizeof(struct construct_node));
+        memset(slots, 0, number_of_slots * sizeof(size_t));
+        node->slots = slots;
+        node->slots_capacity = slots_capacity;
+    }
+    else {
+        node = allocate_memory(sizeof(struct construct_node), s->allocator);
+        if (!node) abort();
+        memset(node, 0, sizeof(struct construct_node));
+        if (number_of_slots > 0) {
+            node->slots = allocate_memory(number_of_slots * sizeof(size_t), s->allocator);
+            if (!node->slots) abort();
+            memset(node->slots, 0, number_of_slots * sizeof(size_t));
+        }
+        node->slots_capacity = number_of_slots;
+    }
+    node->rule = rule;
+    node->number_of_slots = number_of_slots;
+    return node;
+}
+static struct construct_expression *construct_expression_alloc(struct construct_state *s, uint32_t rule) {
+    struct construct_expression *expr;
+    if (s->expression_freelist) {
+        expr = s->expression_freelist;
+        s->expression_freelist = expr->parent;
+        memset(expr, 0, sizeof(struct construct_expression));
+    }
+    else {
+        expr = allocate_memory(sizeof(struct construct_expression), s->allocator);
+        if (!expr) abort();
+        memset(expr, 0, sizeof(struct construct_expression));
+    }
+    (left_right_operand_slots_lookup(rule, &(expr->left_slot_index), &(expr->right_slot_index), &(expr->operand_slot_index), s->info));
+    expr->rule = rule;
+    return expr;
+}
+static void construct_node_free(struct construct_state *state, struct construct_node *node) {
+    node->next = state->node_freelist;
+    state->node_freelist = node;
+}
+static void construct_expression_free(struct construct_state *state, struct construct_expression *expr) {
+    expr->parent = state->expression_freelist;
+    state->expression_freelist = expr;
+}
+static bool construct_expression_should_reduce(struct construct_state *s, struct construct_expression *expr, struct construct_node *node) {
+    if (node->fixity_associativity == CONSTRUCT_POSTFIX) return false;
+    struct construct_node *top = expr->first_operator;
+    if (!top) return false;
+    return node->precedence < top->precedence || (node->precedence == top->precedence && node->fixity_associativity == CONSTRUCT_INFIX_RIGHT);
+}
+static void construct_expression_reduce(struct construct_state *s, struct construct_expression *expr) {
+    struct construct_node *op = expr->first_operator;
+    if (op->fixity_associativity == CONSTRUCT_INFIX_FLAT) {
+        struct construct_node *first_value = expr->first_value;
+        struct construct_node *last_value = first_value;
+        struct construct_node *last_operator = op;
+        size_t operand = op->slots[expr->operand_slot_index];
+        struct construct_node *combined_op = construct_node_alloc(s, op->rule);
+        combined_op->choice_index = op->choice_index;
+        combined_op->slot_index = op->slot_index;
+        combined_op->fixity_associativity = op->fixity_associativity;
+        combined_op->precedence = op->precedence;
+        struct construct_node *reversed_values = 0;
+        while (last_operator && last_operator->choice_index == op->choice_index) {
+            struct construct_node *next_op = last_operator->next;
+            construct_node_free(s, last_operator);
+            last_operator = next_op;
+            assert(last_value);
+            struct construct_node *next_value = last_value->next;
+            last_value->next = reversed_values;
+            reversed_values = last_value;
+            last_value = next_value;
+        }
+        combined_op->start_location = first_value->start_location;
+        combined_op->end_location = last_value->end_location;
+        assert(last_value);
+        operand = (finish_node((last_value)->rule, (last_value)->choice_index, operand, (last_value)->slots, (last_value)->start_location, (last_value)->end_location, s->info));
+        combined_op->next = last_value->next;
+        construct_node_free(s, last_value);
+        while (reversed_values) {
+            operand = (finish_node((reversed_values)->rule, (reversed_values)->choice_index, operand, (reversed_values)->slots, (reversed_values)->start_location, (reversed_values)->end_location, s->info));
+            struct construct_node *next_value = reversed_values->next;
+            construct_node_free(s, reversed_values);
+            reversed_values = next_value;
+        }
+        expr->first_operator = last_operator;
+        expr->first_value = combined_op;
+        combined_op->slots[expr->operand_slot_index] = operand;
+    }
+    else if (op->fixity_associativity == CONSTRUCT_INFIX_LEFT || op->fixity_associativity == CONSTRUCT_INFIX_RIGHT) {
+        expr->first_operator = op->next;
+        struct construct_node *left = expr->first_value;
+        struct construct_node *right = left->next;
+        op->next = right->next;
+        expr->first_value = op;
+        op->start_location = left->start_location;
+        op->end_location = right->end_location;
+        op->slots[expr->left_slot_index] = (finish_node((left)->rule, (left)->choice_index, op->slots[expr->left_slot_index], (left)->slots, (left)->start_location, (left)->end_location, s->info));
+        op->slots[expr->right_slot_index] = (finish_node((right)->rule, (right)->choice_index, op->slots[expr->right_slot_index], (right)->slots, (right)->start_location, (right)->end_location, s->info));
+        construct_node_free(s, left);
+        construct_node_free(s, right);
+    }
+    else {
+        expr->first_operator = op->next;
+        struct construct_node *value = expr->first_value;
+        op->next = value->next;
+        expr->first_value = op;
+        if (value->start_location < op->start_location) op->start_location = value->start_location;
+        if (value->end_location > op->end_location) op->end_location = value->end_location;
+        op->slots[expr->operand_slot_index] = (finish_node((value)->rule, (value)->choice_index, op->slots[expr->operand_slot_index], (value)->slots, (value)->start_location, (value)->end_location, s->info));
+        construct_node_free(s, value);
+    }
+}
+static void construct_begin(struct construct_state *s, size_t offset, enum construct_root_type type) {
+    s->root_type = type;
+    uint32_t r = 0;
+    if (type == CONSTRUCT_EXPRESSION_ROOT) {
+        struct construct_expression *expr = construct_expression_alloc(s, r);
+        expr->parent = s->current_expression;
+        s->current_expression = expr;
+    }
+    else {
+        struct construct_node *node = construct_node_alloc(s, r);
+        node->next = s->under_construction;
+        node->end_location = offset;
+        s->under_construction = node;
+    }
+}
+static size_t construct_finish(struct construct_state *s, size_t offset) {
+    size_t finished = 0;
+    if (s->root_type == CONSTRUCT_EXPRESSION_ROOT) {
+        struct construct_expression *expr = s->current_expression;
+        s->current_expression = expr->parent;
+        while (expr->first_operator) construct_expression_reduce(s, expr);
+        struct construct_node *node = expr->first_value;
+        if (node) {
+            finished = (finish_node((node)->rule, (node)->choice_index, 0, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+            assert(node->next == 0);
+            construct_node_free(s, node);
+        }
+        construct_expression_free(s, expr);
+    }
+    else {
+        struct construct_node *node = s->under_construction;
+        s->under_construction = node->next;
+        node->start_location = offset;
+        finished = (finish_node((node)->rule, (node)->choice_index, 0, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+        construct_node_free(s, node);
+    }
+    return finished;
+}
+static void construct_free_pools(struct construct_state *s) {
+    while (s->node_freelist) {
+        struct construct_node *node = s->node_freelist;
+        s->node_freelist = node->next;
+        free_memory(node->slots, node->slots_capacity * sizeof(size_t), s->allocator);
+        free_memory(node, sizeof(struct construct_node), s->allocator);
+    }
+    while (s->expression_freelist) {
+        struct construct_expression *expr = s->expression_freelist;
+        s->expression_freelist = expr->parent;
+        free_memory(expr, sizeof(struct construct_expression), s->allocator);
+    }
+}
+static void construct_action_apply(struct construct_state *s, uint16_t action, size_t offset) {
+    switch ((((action) >> 12) & 0xf)) {
+    case 8:
+        {
+            struct construct_node *node = construct_node_alloc(s, rule_lookup(s->under_construction->rule, ((action) & 0xfff), s->info));
+            node->next = s->under_construction;
+            node->slot_index = ((action) & 0xfff);
+            node->end_location = offset;
+            s->under_construction = node;
+            break;
+        }
+    case 9:
+        {
+            struct construct_expression *expr = construct_expression_alloc(s, rule_lookup(s->under_construction->rule, ((action) & 0xfff), s->info));
+            expr->parent = s->current_expression;
+            s->current_expression = expr;
+            expr->slot_index = ((action) & 0xfff);
+            break;
+        }
+    case 1:
+        {
+            struct construct_node *node = s->under_construction;
+            node->start_location = offset;
+            s->under_construction = node->next;
+            size_t *finished;
+            finished = &s->under_construction->slots[node->slot_index];
+            *finished = (finish_node((node)->rule, (node)->choice_index, *finished, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+            construct_node_free(s, node);
+            break;
+        }
+    case 2:
+        {
+            struct construct_expression *expr = s->current_expression;
+            s->current_expression = expr->parent;
+            while (expr->first_operator) construct_expression_reduce(s, expr);
+            size_t *finished;
+            finished = &s->under_construction->slots[expr->slot_index];
+            struct construct_node *node = expr->first_value;
+            if (node) {
+                *finished = (finish_node((node)->rule, (node)->choice_index, *finished, (node)->slots, (node)->start_location, (node)->end_location, s->info));
+                assert(node->next == 0);
+                construct_node_free(s, node);
+            }
+            construct_expression_free(s, expr);
+            break;
+        }
+    case 3:
+        s->under_construction->choice_index = ((action) & 0xfff);
+        break;
+    case 4:
+        {
+            uint16_t slot = ((action) & 0xfff);
+            size_t *finished = &s->under_construction->slots[slot];
+            *finished = finish_token(rule_lookup(s->under_construction->rule, slot, s->info), *finished, s->info);
+            break;
+        }
+    case 10:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = construct_node_alloc(s, expr->rule);
+            node->choice_index = ((action) & 0xfff);
+            node->end_location = offset;
+            node->rule = expr->rule;
+            node->next = s->under_construction;
+            s->under_construction = node;
+            break;
+        }
+    case 11:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = construct_node_alloc(s, expr->rule);
+            node->choice_index = ((action) & 0xfff);
+            node->end_location = offset;
+            node->rule = expr->rule;
+            enum construct_fixity_associativity fixity_associativity = 0;
+            int precedence = 0;
+            do {
+                int local = 0;
+                fixity_associativity_precedence_lookup(&local, &precedence, expr->rule, ((action) & 0xfff), s->info);
+                fixity_associativity = local;
+            }
+            while (0);
+            node->fixity_associativity = fixity_associativity;
+            node->precedence = precedence;
+            node->next = s->under_construction;
+            s->under_construction = node;
+            break;
+        }
+    case 5:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = s->under_construction;
+            node->start_location = offset;
+            s->under_construction = node->next;
+            node->next = expr->first_value;
+            expr->first_value = node;
+            break;
+        }
+    case 6:
+        {
+            struct construct_expression *expr = s->current_expression;
+            struct construct_node *node = s->under_construction;
+            node->start_location = offset;
+            s->under_construction = node->next;
+            while (construct_expression_should_reduce(s, expr, node)) construct_expression_reduce(s, expr);
+            node->next = expr->first_operator;
+            expr->first_operator = node;
+            if (node->fixity_associativity == CONSTRUCT_PREFIX) construct_expression_reduce(s, expr);
+            break;
+        }
+    }
+}
+
+struct fill_run_continuation;
+struct fill_run_state {
+    uint32_t state;
+    uint32_t reachability_mask[1];
+    struct fill_run_continuation *cont;
+};
+struct fill_run_continuation {
+    struct fill_run_state *stack;
+    size_t top_index;
+    size_t capacity;
+    int error;
+    struct owl_allocator *allocator;
+};
+static void bracket_entry_state(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index, uint32_t mask0);
+static void (*state_funcs[23])(struct owl_token_run *, struct fill_run_state *, uint16_t);
+static void state_func_11(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+    if (!(1 & top->reachability_mask[0])) {
+        top->cont->error = -1;
+        return;
+    }
+    uint32_t token = run->tokens[token_index];
+    switch (token) {
+    case 1: top->state = 12; return;
+    default: top->cont->error = 1; return;
+    }
+}
+static void state_func_0(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+    uint32_t token = run->tokens[token_index];
+    switch (token) {
+    case 3: top->state = 1; return;
+    case 4: top->state = 2; return;
+    case 5: top->state = 3; return;
+    case 6: top->state = 4; return;
+    case 7: top->state = 5; return;
+    case 8: top->state = 6; return;
+    case 9: top->state = 7; return;
+    case 10: top->state = 8; return;
+    case 11: top->state = 9; return;
+    default:
+        bracket_entry_state(run, top, token_index, 1);
+        return;
+    }
+}
+static void state_func_1(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+    uint32_t token = run->tokens[token_index];
+    switch (token) {
+    case 0: top->state = 10; return;
+    case 3: top->state = 1; return;
+    case 4: top->state = 2; return;
+    case 5: top->state = 3; return;
+    case 6: top->state = 4; return;
+    case 7: top->state = 5; return;
+    case 8: top->state = 6; return;
+    case 9: top->state = 7; return;
+    case 10: top->state = 8; return;
+    case 11: top->state = 9; return;
+    default:
+        bracket_entry_state(run, top, token_index, 1);
+        return;
+    }
+}
+static void state_func_12(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+    if (!(1 & top->reachability_mask[0])) {
+        top->cont->error = -1;
+        return;
+    }
+    uint32_t token = run->tokens[token_index];
+    switch (token) {
+    case 2: top->state = 13; return;
+    case 3: top->state = 14; return;
+    case 4: top->state = 15; return;
+    case 5: top->state = 16; return;
+    case 6: top->state = 17; return;
+    case 7: top->state = 18; return;
+    case 8: top->state = 19; return;
+    case 9: top->state = 20; return;
+    case 10: top->state = 21; return;
+    case 11: top->state = 22; return;
+    default:
+        bracket_entry_state(run, top, token_index, 1);
+        return;
+    }
+}
+static void state_func_13(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+    if (!(1 & top->reachability_mask[0])) {
+        top->cont->error = -1;
+        return;
+    }
+    if (top->cont->top_index == 0) {
+        top->cont->error = 1;
+        return;
+    }
+    top->cont->top_index--;
+    top--;
+    run->tokens[token_index] = 11;
+    run->states[token_index] = top->state;
+    state_funcs[top->state](run, top, token_index);
+    return;
+}
+static void state_func_14(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+    if (!(1 & top->reachability_mask[0])) {
+        top->cont->error = -1;
+        return;
+    }
+    uint32_t token = run->tokens[token_index];
+    switch (token) {
+    case 2: top->state = 13; return;
+    case 3: top->state = 14; return;
+    case 4: top->state = 15; return;
+    case 5: top->state = 16; return;
+    case 6: top->state = 17; return;
+    case 7: top->state = 18; return;
+    case 8: top->state = 19; return;
+    case 9: top->state = 20; return;
+    case 10: top->state = 21; return;
+    case 11: top->state = 22; return;
+    default:
+        bracket_entry_state(run, top, token_index, 1);
+        return;
+    }
+}
+static void (*state_funcs[23])(struct owl_token_run *, struct fill_run_state *, uint16_t) = {
+    state_func_0, state_func_1, state_func_1, state_func_1,
+    state_func_1, state_func_1, state_func_1, state_func_1,
+    state_func_1, state_func_1, state_func_0, state_func_11,
+    state_func_12, state_func_13, state_func_14, state_func_14,
+    state_func_14, state_func_14, state_func_14, state_func_14,
+    state_func_14, state_func_14, state_func_14,};
+static void bracket_entry_state(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index, uint32_t mask0) {
+    struct fill_run_continuation *cont = top->cont;
+    cont->top_index++;
+    if (cont->top_index >= cont->capacity) {
+        size_t new_capacity = (cont->capacity + 2) * 3 / 2;
+        if (new_capacity <= cont->capacity)
+            abort();
+        struct fill_run_state *new_states = reallocate_memory(cont->stack, cont->capacity * sizeof(struct fill_run_state), new_capacity * sizeof(struct fill_run_state), cont->allocator);
+        if (!new_states)
+            abort();
+        cont->stack = new_states;
+        cont->capacity = new_capacity;
+        top = &cont->stack[cont->top_index];
+    } else
+        top++;
+    top->cont = cont;
+    top->reachability_mask[0] = mask0;
+    run->states[token_index] = 11;
+    state_func_11(run, top, token_index);
+    if (top->cont->error == -1)
+        top->cont->error = 1;
+}
+#ifndef OWL_NO_THREADED_STATES
+static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index) {
+    uint16_t token_index = 0;
+    uint16_t number_of_tokens = run->number_of_tokens;
+    struct fill_run_state *top = &cont->stack[cont->top_index];
+    uint32_t state = top->state;
+    if (number_of_tokens == 0)
+        return true;
+dispatch:
+    switch (state) {
+    case 0: goto state_0;
+    case 1: goto state_1;
+    case 2: goto state_1;
+    case 3: goto state_1;
+    case 4: goto state_1;
+    case 5: goto state_1;
+    case 6: goto state_1;
+    case 7: goto state_1;
+    case 8: goto state_1;
+    case 9: goto state_1;
+    case 10: goto state_0;
+    case 11: goto state_11;
+    case 12: goto state_12;
+    case 13: goto state_13;
+    case 14: goto state_14;
+    case 15: goto state_14;
+    case 16: goto state_14;
+    case 17: goto state_14;
+    case 18: goto state_14;
+    case 19: goto state_14;
+    case 20: goto state_14;
+    case 21: goto state_14;
+    case 22: goto state_14;
+    default: abort();
+    }
+state_11:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 1: state = 12; if (++token_index < number_of_tokens) goto state_12; goto done;
+    default: goto slow;
+    }
+state_0:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 3: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 4: state = 2; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 5: state = 3; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 6: state = 4; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 7: state = 5; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 8: state = 6; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 9: state = 7; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 10: state = 8; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 11: state = 9; if (++token_index < number_of_tokens) goto state_1; goto done;
+    default: goto slow;
+    }
+state_1:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 0: state = 10; if (++token_index < number_of_tokens) goto state_0; goto done;
+    case 3: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 4: state = 2; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 5: state = 3; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 6: state = 4; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 7: state = 5; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 8: state = 6; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 9: state = 7; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 10: state = 8; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 11: state = 9; if (++token_index < number_of_tokens) goto state_1; goto done;
+    default: goto slow;
+    }
+state_12:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 2: state = 13; if (++token_index < number_of_tokens) goto state_13; goto done;
+    case 3: state = 14; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 4: state = 15; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 5: state = 16; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 6: state = 17; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 7: state = 18; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 8: state = 19; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 9: state = 20; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 10: state = 21; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 11: state = 22; if (++token_index < number_of_tokens) goto state_14; goto done;
+    default: goto slow;
+    }
+state_13:
+    run->states[token_index] = state;
+    goto slow;
+state_14:
+    run->states[token_index] = state;
+    if (!(1 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
+    }
+    switch (run->tokens[token_index]) {
+    case 2: state = 13; if (++token_index < number_of_tokens) goto state_13; goto done;
+    case 3: state = 14; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 4: state = 15; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 5: state = 16; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 6: state = 17; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 7: state = 18; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 8: state = 19; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 9: state = 20; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 10: state = 21; if (++token_index < number_of_tokens) goto state_14; goto done;
+    case 11: state = 22; if (++token_index < number_of_tokens) goto state_14; goto done;
+    default: goto slow;
+    }
+slow:
+    top->state = state;
+    state_funcs[state](run, top, token_index);
+    if (cont->error) {
+        *failing_index = token_index - (cont->error > 0 ? 0 : 1);
+        return false;
+    }
+    top = &cont->stack[cont->top_index];
+    state = top->state;
+    if (++token_index < number_of_tokens)
+        goto dispatch;
+done:
+    top->state = state;
+    return true;
+}
+#else
+static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index) {
+    uint16_t token_index = 0;
+    uint16_t number_of_tokens = run->number_of_tokens;
+    while (token_index < number_of_tokens) {
+        struct fill_run_state *top = &cont->stack[cont->top_index];
+        run->states[token_index] = top->state;
+        state_funcs[top->state](run, top, token_index);
+        if (cont->error) {
+            *failing_index = token_index - (cont->error > 0 ? 0 : 1);
+            return false;
+        }
+        token_index++;
+    }
+    return true;
+}
+#endif
+static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index);
+static size_t build_parse_tree(struct owl_parser *parser);
+
+static struct owl_tree *owl_tree_create_empty(struct owl_allocator allocator) {
+    struct owl_tree *tree = allocate_memory(sizeof(struct owl_tree), &allocator);
+    if (!tree)
+        abort();
+    *tree = (struct owl_tree){ .allocator = allocator };
+    return tree;
+}
+
+// The streaming parser waits for about this many bytes of new input before
+// tokenizing again, so token runs don't end up mostly empty.
+#ifndef FEED_BATCH_SIZE
+#define FEED_BATCH_SIZE 16384
+#endif
+struct owl_parser {
+    struct owl_tree *tree;
+    struct owl_allocator allocator;
+    struct owl_default_tokenizer tokenizer;
+    struct owl_token_run *token_run;
+    struct fill_run_continuation cont;
+    // The state stack and construct pools are only used while building the
+    // tree, but they're kept (along with the token runs and the fill_run stack)
+    // so later parses don't have to allocate them again.
+    uint32_t *state_stack;
+    size_t state_stack_capacity;
+    struct construct_state construct_state;
+    // Set once owl_parser_parse has built a tree, until the next reset.
+    bool finished;
+    // When validating, token runs are recycled as soon as they've been checked and
+    // no tree is built.
+    bool validating;
+    char *buffer;
+    size_t length;
+    size_t capacity;
+    size_t resume_length;
+};
+static void start_parsing(struct owl_parser *parser, struct owl_tree *tree) {
+    tree->next_offset = 1;
+    parser->tree = tree;
+    parser->tokenizer = (struct owl_default_tokenizer){
+        .info = tree,
+        .lookahead = 15,
+        .free_runs = parser->tokenizer.free_runs,
+        .allocator = &parser->allocator,
+    };
+    parser->token_run = 0;
+    parser->cont.allocator = &parser->allocator;
+    parser->construct_state.allocator = &parser->allocator;
+    if (!parser->cont.stack) {
+        parser->cont.capacity = 8;
+        parser->cont.stack = allocate_memory(parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);
+        if (!parser->cont.stack)
+            abort();
+    }
+    parser->cont.top_index = 0;
+    parser->cont.error = 0;
+    parser->cont.stack[0] = (struct fill_run_state){
+        .state = 0,
+        .cont = &parser->cont,
+    };
+}
+// Moves the parser's token runs to the tokenizer's free list.
+static void recycle_token_runs(struct owl_parser *parser) {
+    while (parser->token_run) {
+        struct owl_token_run *run = parser->token_run;
+        parser->token_run = run->prev;
+        run->prev = parser->tokenizer.free_runs;
+        parser->tokenizer.free_runs = run;
+    }
+}
+// Frees the memory kept between parses (but not the tree or input buffer).
+static void free_parser_memory(struct owl_parser *parser) {
+    free_token_runs(&parser->token_run, &parser->allocator);
+    free_token_runs(&parser->tokenizer.free_runs, &parser->allocator);
+    free_memory(parser->cont.stack, parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);
+    free_memory(parser->state_stack, parser->state_stack_capacity * sizeof(uint32_t), &parser->allocator);
+    construct_free_pools(&parser->construct_state);
+}
+// Tokenizes as much of the text as possible, running each token run through
+// the state machine.  Set `more_input` if more text will follow `length`.
+static bool parse_text(struct owl_parser *parser, const char *text, size_t length, bool more_input) {
+    struct owl_tree *tree = parser->tree;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    tokenizer->text = text;
+    tokenizer->length = length;
+    tokenizer->more_input = more_input;
+    uint16_t failing_index = 0;
+    while (owl_default_tokenizer_advance(tokenizer, &parser->token_run)) {
+        if (!fill_run_states(parser->token_run, &parser->cont, &failing_index)) {
+            tree->error = ERROR_UNEXPECTED_TOKEN;
+            find_token_range(tokenizer, parser->token_run, failing_index, &tree->error_range.start, &tree->error_range.end);
+            return false;
+        }
+        if (parser->validating) {
+            // Only the tokenizer's position is needed to report later errors, so
+            // the run and its token data can be reused.
+            recycle_token_runs(parser);
+            tree->next_offset = 1;
+        }
+    }
+    if (tokenizer->deferred)
+        return true;
+    if (tokenizer->offset < length) {
+        tree->error = ERROR_INVALID_TOKEN;
+        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);
+        return false;
+    }
+    return true;
+}
+static void finish_parsing(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    struct fill_run_state top = parser->cont.stack[parser->cont.top_index];
+    if (tree->error != ERROR_NONE) {
+        recycle_token_runs(parser);
+        return;
+    }
+    switch (top.state) {
+    case 0:
+    case 10:
+        break;
+    default:
+        tree->error = ERROR_MORE_INPUT_NEEDED;
+        find_end_range(&parser->tokenizer, &tree->error_range.start, &tree->error_range.end);
+        recycle_token_runs(parser);
+        return;
+    }
+    if (parser->validating)
+        return;
+    tree->root_offset = build_parse_tree(parser);
+    if (tree->root_offset && !tree->builder)
+        tree->root_start = take_start(tree, tree->root_offset);
+    if (tree->pending_starts) {
+        free_memory(tree->pending_starts, tree->pending_starts_capacity * sizeof(struct pending_start), &tree->allocator);
+        tree->pending_starts = 0;
+        tree->number_of_pending_starts = 0;
+        tree->pending_starts_capacity = 0;
+    }
+}
+static void parse_string(struct owl_tree *tree, const char *string, size_t length, bool validate) {
+    struct owl_parser parser = { .allocator = tree->allocator, .validating = validate };
+    tree->string = string;
+    start_parsing(&parser, tree);
+    parse_text(&parser, string, length, false);
+    finish_parsing(&parser);
+    free_parser_memory(&parser);
+}
+static struct owl_tree *owl_tree_create_with_error(enum owl_error e) {
+    struct owl_tree *tree = owl_tree_create_empty((struct owl_allocator){ 0 });
+    tree->error = e;
+    return tree;
+}
+struct owl_tree *owl_tree_create_from_string(const char *string) {
+    return owl_tree_create_with_options((struct owl_tree_options){ .string = string });
+}
+struct owl_tree *owl_tree_create_from_file(FILE *file) {
+    if (!file)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    return owl_tree_create_with_options((struct owl_tree_options){ .file = file });
+}
+#ifdef OWL_MMAP
+// Reads the rest of `fd` into a new buffer.  For regular files, `size` is the
+// size of the file and the buffer is allocated once, at exactly that size.
+static char *read_file_descriptor(int fd, size_t size, size_t *length, size_t *capacity_out, struct owl_allocator *allocator) {
+    size_t capacity = size ? size : 65536;
+    char *buffer = allocate_memory(capacity, allocator);
+    size_t offset = 0;
+    while (buffer) {
+        if (offset == capacity) {
+            if (size)
+                break;
+            char *b = reallocate_memory(buffer, capacity, capacity * 2, allocator);
+            if (!b)
+                free_memory(buffer, capacity, allocator);
+            buffer = b;
+            capacity *= 2;
+            continue;
+        }
+        ssize_t n = read(fd, buffer + offset, capacity - offset);
+        if (n < 0) {
+            free_memory(buffer, capacity, allocator);
+            return 0;
+        }
+        if (n == 0)
+            break;
+        offset += (size_t)n;
+    }
+    *length = offset;
+    *capacity_out = capacity;
+    return buffer;
+}
+#endif
+struct owl_tree *owl_tree_create_from_path(const char *path) {
+    if (!path)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+#ifdef OWL_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    }
+    struct owl_tree *tree = owl_tree_create_empty((struct owl_allocator){ 0 });
+    size_t length = 0;
+    if (S_ISREG(st.st_mode) && st.st_size > 0 && (uintmax_t)st.st_size <= SIZE_MAX) {
+        length = (size_t)st.st_size;
+        void *map = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+#if defined(MADV_SEQUENTIAL)
+            madvise(map, length, MADV_SEQUENTIAL);
+#elif defined(POSIX_MADV_SEQUENTIAL)
+            posix_madvise(map, length, POSIX_MADV_SEQUENTIAL);
+#endif
+            tree->mapped_length = length;
+            tree->string = map;
+        }
+    }
+    if (!tree->mapped_length) {
+        // Pipes and other special files can't be mapped.
+        size_t capacity = 0;
+        char *string = read_file_descriptor(fd, length, &length, &capacity, &tree->allocator);
+        if (!string) {
+            close(fd);
+            owl_tree_destroy(tree);
+            return owl_tree_create_with_error(ERROR_INVALID_FILE);
+        }
+        tree->string = string;
+        tree->owned_string_size = capacity;
+    }
+    close(fd);
+    parse_string(tree, tree->string, length, false);
+    return tree;
+#else
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    struct owl_tree *tree = owl_tree_create_from_file(file);
+    fclose(file);
+    return tree;
+#endif
+}
+static bool allocator_options_are_valid(struct owl_tree_options options) {
+    return !options.allocate == !options.reallocate && !options.allocate == !options.deallocate;
+}
+static struct owl_allocator allocator_from_options(struct owl_tree_options options) {
+    return (struct owl_allocator){
+        .allocate = options.allocate,
+        .reallocate = options.reallocate,
+        .deallocate = options.deallocate,
+        .info = options.allocator_info,
+    };
+}
+// Creates a tree from the options.  If `validate` is set, the tree isn't built;
+// if `builder` is set, it's used to build nodes instead.
+static struct owl_tree *create_tree(struct owl_tree_options options, bool validate, const struct owl_builder *builder) {
+    if (!options.file == !options.string || !allocator_options_are_valid(options))
+        return owl_tree_create_with_error(ERROR_INVALID_OPTIONS);
+    struct owl_allocator allocator = allocator_from_options(options);
+    size_t len = 32;
+    if (options.file) {
+        char *str = 0;
+        size_t off = 0;
+        while (true) {
+            size_t old_len = str ? len : 0;
+            len = len * 3 / 2;
+            char *s = reallocate_memory(str, old_len, len, &allocator);
+            if (!s) {
+                free_memory(str, old_len, &allocator);
+                return 0;
+            }
+            str = s;
+            off += fread(str + off, 1, len - off, options.file);
+            if (off < len) {
+                str[off] = '\0';
+                break;
+            }
+        }
+        options.string = str;
+        options.length = off;
+    } else if (!options.length)
+        options.length = strlen(options.string);
+    struct owl_tree *tree = owl_tree_create_empty(allocator);
+    if (options.file)
+        tree->owned_string_size = len;
+    tree->builder = builder;
+    parse_string(tree, options.string, options.length, validate);
+    return tree;
+}
+struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options) {
+    return create_tree(options, false, 0);
+}
+enum owl_error owl_validate(const char *string, size_t length, struct source_range *error_range) {
+    return owl_validate_with_options((struct owl_tree_options){ .string = string, .length = length }, error_range);
+}
+enum owl_error owl_validate_with_options(struct owl_tree_options options, struct source_range *error_range) {
+    struct owl_tree *tree = create_tree(options, true, 0);
+    if (!tree)
+        return ERROR_INVALID_FILE;
+    enum owl_error error = owl_tree_get_error(tree, error_range);
+    owl_tree_destroy(tree);
+    return error;
+}
+enum owl_error owl_build(const char *string, size_t length, struct owl_builder builder, void **root, struct source_range *error_range) {
+    return owl_build_with_options((struct owl_tree_options){ .string = string, .length = length }, builder, root, error_range);
+}
+enum owl_error owl_build_with_options(struct owl_tree_options options, struct owl_builder builder, void **root, struct source_range *error_range) {
+    if (root)
+        *root = 0;
+    if (!builder.build)
+        return ERROR_INVALID_OPTIONS;
+    struct owl_tree *tree = create_tree(options, false, &builder);
+    if (!tree)
+        return ERROR_INVALID_FILE;
+    enum owl_error error = owl_tree_get_error(tree, error_range);
+    if (error == ERROR_NONE && root)
+        *root = (void *)(uintptr_t)tree->root_offset;
+    owl_tree_destroy(tree);
+    return error;
+}
+struct owl_parser *owl_parser_create(void) {
+    return owl_parser_create_with_options((struct owl_tree_options){ 0 });
+}
+struct owl_parser *owl_parser_create_with_options(struct owl_tree_options options) {
+    bool valid = allocator_options_are_valid(options);
+    struct owl_allocator allocator = { 0 };
+    if (valid)
+        allocator = allocator_from_options(options);
+    struct owl_parser *parser = allocate_memory(sizeof(struct owl_parser), &allocator);
+    if (!parser)
+        return 0;
+    *parser = (struct owl_parser){ .allocator = allocator };
+    parser->capacity = FEED_BATCH_SIZE;
+    parser->buffer = allocate_memory(parser->capacity, &allocator);
+    if (!parser->buffer) {
+        free_memory(parser, sizeof(struct owl_parser), &allocator);
+        return 0;
+    }
+    parser->buffer[0] = '\0';
+    parser->resume_length = FEED_BATCH_SIZE;
+    struct owl_tree *tree = owl_tree_create_empty(allocator);
+    if (options.file || options.string || !valid)
+        tree->error = ERROR_INVALID_OPTIONS;
+    start_parsing(parser, tree);
+    return parser;
+}
+bool owl_parser_feed(struct owl_parser *parser, const char *chunk, size_t length) {
+    if (parser->finished || parser->tree->error != ERROR_NONE)
+        return false;
+    if (length >= parser->capacity - parser->length) {
+        size_t capacity = parser->capacity;
+        while (length >= capacity - parser->length) {
+            if (capacity > SIZE_MAX / 2)
+                abort();
+            capacity *= 2;
+        }
+        char *buffer = reallocate_memory(parser->buffer, parser->capacity, capacity, &parser->allocator);
+        if (!buffer)
+            abort();
+        parser->buffer = buffer;
+        parser->capacity = capacity;
+    }
+    memcpy(parser->buffer + parser->length, chunk, length);
+    parser->length += length;
+    parser->buffer[parser->length] = '\0';
+    if (parser->length < parser->resume_length)
+        return true;
+    if (!parse_text(parser, parser->buffer, parser->length, true))
+        return false;
+    // If a long token is still incomplete, wait for the pending input to double
+    // before scanning it again.
+    size_t pending = parser->length - parser->tokenizer.offset;
+    parser->resume_length = parser->length + (pending > FEED_BATCH_SIZE ? pending : FEED_BATCH_SIZE);
+    return true;
+}
+struct owl_tree *owl_parser_finish(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    if (parser->finished)
+        free_memory(parser->buffer, parser->capacity, &parser->allocator);
+    else {
+        tree->string = parser->buffer;
+        tree->owned_string_size = parser->capacity;
+        if (tree->error == ERROR_NONE)
+            parse_text(parser, parser->buffer, parser->length, false);
+        finish_parsing(parser);
+    }
+    free_parser_memory(parser);
+    free_memory(parser, sizeof(struct owl_parser), &parser->allocator);
+    return tree;
+}
+void owl_parser_reset(struct owl_parser *parser) {
+    recycle_token_runs(parser);
+    struct owl_tree *tree = parser->tree;
+    *tree = (struct owl_tree){
+        .allocator = tree->allocator,
+        .parse_tree = tree->parse_tree,
+        .parse_tree_size = tree->parse_tree_size,
+        // Invalid options stay invalid.
+        .error = tree->error == ERROR_INVALID_OPTIONS ? ERROR_INVALID_OPTIONS : ERROR_NONE,
+    };
+    parser->finished = false;
+    parser->length = 0;
+    parser->buffer[0] = '\0';
+    parser->resume_length = FEED_BATCH_SIZE;
+    start_parsing(parser, tree);
+}
+struct owl_tree *owl_parser_parse(struct owl_parser *parser, const char *string) {
+    owl_parser_reset(parser);
+    struct owl_tree *tree = parser->tree;
+    parser->finished = true;
+    if (tree->error != ERROR_NONE)
+        return tree;
+    tree->string = string;
+    parse_text(parser, string, strlen(string), false);
+    finish_parsing(parser);
+    return tree;
+}
+void owl_parser_destroy(struct owl_parser *parser) {
+    if (!parser)
+        return;
+    free_parser_memory(parser);
+    owl_tree_destroy(parser->tree);
+    struct owl_allocator allocator = parser->allocator;
+    free_memory(parser->buffer, parser->capacity, &allocator);
+    free_memory(parser, sizeof(struct owl_parser), &allocator);
+}
+enum owl_error owl_tree_get_error(struct owl_tree *tree, struct source_range *error_range) {
+    if (error_range)
+        *error_range = tree->error_range;
+    return tree->error;
+}
+void owl_tree_destroy(struct owl_tree *tree) {
+    if (!tree)
+        return;
+    if (tree->owned_string_size)
+        free_memory((void *)tree->string, tree->owned_string_size, &tree->allocator);
+#ifdef OWL_MMAP
+    if (tree->mapped_length)
+        munmap((void *)tree->string, tree->mapped_length);
+#endif
+    struct owl_allocator allocator = tree->allocator;
+    free_memory(tree->parse_tree, tree->parse_tree_size, &allocator);
+    free_memory(tree, sizeof(struct owl_tree), &allocator);
+}
+static const uint16_t actions[] = {
+0,0,4096,0,4096,4096,0,4096,4096,4096,0,4096,4096,4096,32768,0,4096,4096,32768,0,4096,4096,32768,12288,32768,0,4096,4096,32768,12289,
+16385,0,4096,4096,32768,12290,16386,0,4096,4096,32768,12291,16387,0,4096,4096,32768,12292,0,4096,4096,32768,12293,0,4096,4096,32768,12294,0,4096,
+4096,32768,12295,0,4096,4096,32768,12296,0,4096,4096,32772,12288,32768,0,4096,4096,32772,12289,16385,0,4096,4096,32772,12290,16386,0,4096,4096,32772,
+12291,16387,0,4096,4096,32772,12292,0,4096,4096,32772,12293,0,4096,4096,32772,12294,0,4096,4096,32772,12295,0,4096,4096,32772,12296,0,4096,32768,
+12288,32768,0,4096,32768,12289,16385,0,4096,32768,12290,16386,0,4096,32768,12291,16387,0,4096,32768,12292,0,4096,32768,12293,0,4096,32768,12294,0,
+4096,32768,12295,0,4096,32768,12296,0,4096,32772,12288,32768,0,4096,32772,12289,16385,0,4096,32772,12290,16386,0,4096,32772,12291,16387,0,4096,32772,
+12292,0,4096,32772,12293,0,4096,32772,12294,0,4096,32772,12295,0,4096,32772,12296,0,32768,0,32768,12288,32768,0,32768,12289,16385,0,32768,12290,
+16386,0,32768,12291,16387,0,32768,12292,0,32768,12293,0,32768,12294,0,32768,12295,0,32768,12296,0,32772,12288,32768,0,32772,12289,16385,0,32772,
+12290,16386,0,32772,12291,16387,0,32772,12292,0,32772,12293,0,32772,12294,0,32772,12295,0,32772,12296,0,};
+static const uint16_t action_table_displacements[311] = {
+1,0,0,32,34,218,1,7,21,4,1,1057,81,0,2,211,
+55,8,7,8,13,5,23,27,115,8,2,0,0,6,77,0,
+2,0,8,108,2,40,2,0,0,4,2,4,0,68,3,1,
+43,1,45,36,78,0,17,4,50,1,0,45,6,49,0,5,
+0,10,4,21,1,0,65,0,89,0,0,48,18,14,0,0,
+54,5,0,1,39,7,8,19,0,6,1,55,4,15,0,34,
+4,3,14,28,2,0,36,0,3,15,46,0,18,7,20,1,
+0,0,0,29,25,45,3,13,18,2,0,4,1,7,0,0,
+5,9,9,2,0,1,8,2,15,0,0,3,0,7,17,1,
+17,0,1,32,1,25,0,10,37,0,3,23,3,12,4,8,
+6,49,2,26,0,3,6,1,2,4,28,13,2,5,0,30,
+1,1,1,2,18,35,2,7,25,0,1,3,3,2,16,3,
+0,19,2,6,2,0,1,1,4,3,2,36,2,3,1,2,
+37,4,0,1,2,5,10,21,21,23,9,7,1,1,0,4,
+4,2,10,3,0,0,2,1,0,0,4,2,0,15,0,14,
+40,2,0,3,1,7,0,25,64,8,0,17,0,1,0,4,
+0,3,1,10,3,3,1,4,14,13,15,0,33,14,1,0,
+10,19,5,10,5,0,7,9,5,5,6,5,0,0,0,16,
+1,0,1,0,3,11,0,2,2,8,9,2,0,4,3,11,
+0,0,0,4,3,10,1,};
+static const uint16_t action_table_slot_for_column[299] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,297,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,118,0,0,0,0,0,0,0,
+0,0,0,0,0,509,0,0,0,0,0,0,0,0,0,0,
+0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,277,
+0,0,0,0,0,0,0,0,0,0,0,0,473,0,0,0,
+0,0,0,0,0,0,0,0,0,338,0,0,0,0,0,0,
+0,0,0,0,0,0,451,0,0,0,0,0,0,0,0,0,
+0,0,0,352,0,0,0,0,0,0,0,0,0,0,0,0,
+332,0,0,0,0,0,0,0,0,0,0,};
+static const uint8_t action_table[621][5] = {
+{23,20,22,0,0,},{212,0,143,49,0,},{66,48,130,38,0,},{150,67,216,58,0,},{139,58,11,5,0,},{2,56,139,29,0,},
+{143,40,66,56,0,},{24,67,216,40,0,},{161,84,216,21,0,},{2,73,2,32,0,},{152,93,151,44,12,},{203,48,2,16,0,},
+{88,68,216,40,0,},{152,35,152,46,0,},{33,51,88,28,0,},{86,76,216,59,0,},{11,42,194,14,0,},{152,27,152,45,0,},
+{15,56,11,50,0,},{203,1,207,2,0,},{97,93,87,23,12,},{75,49,2,16,0,},{194,73,2,32,0,},{66,73,2,32,0,},
+{139,80,130,9,0,},{214,36,88,63,0,},{225,59,97,17,0,},{207,88,23,54,1,},{203,41,194,14,0,},{139,34,130,13,0,},
+{11,74,2,8,0,},{148,0,143,49,0,},{207,40,66,56,0,},{75,90,23,11,1,},{150,51,216,64,0,},{130,1,15,4,0,},
+{88,76,24,42,0,},{24,91,151,44,12,},{212,101,64,0,0,},{194,72,2,32,0,},{33,76,88,20,0,},{79,74,2,52,0,},
+{152,76,24,42,0,},{11,88,23,11,1,},{2,41,130,37,0,},{214,75,216,59,0,},{15,72,2,52,0,},{130,73,2,32,0,},
+{24,43,152,47,0,},{79,33,130,55,0,},{225,43,24,27,0,},{130,81,66,33,0,},{194,0,15,4,0,},{143,65,2,51,0,},
+{128,1,143,49,0,},{143,32,130,55,0,},{143,89,23,54,1,},{24,77,24,42,0,},{33,37,216,25,0,},{203,64,130,6,0,},
+{130,74,2,32,0,},{15,42,66,56,0,},{15,26,194,54,0,},{216,10,149,0,0,},{150,35,88,63,0,},{225,67,216,18,0,},
+{66,89,151,34,1,},{203,72,2,8,0,},{33,92,87,23,12,},{161,52,88,28,0,},{150,29,152,62,0,},{2,24,130,35,0,},
+{152,91,151,44,12,},{22,75,216,59,0,},{139,24,66,12,0,},{2,25,130,35,0,},{207,89,23,54,1,},{161,36,216,25,0,},
+{15,48,2,57,0,},{0,2,143,49,0,},{139,57,11,5,0,},{33,44,24,27,0,},{214,10,21,0,0,},{22,52,216,64,0,},
+{130,64,194,30,0,},{214,83,216,60,0,},{24,53,152,48,0,},{225,27,152,24,0,},{207,72,2,52,0,},{207,57,11,50,0,},
+{152,45,152,47,0,},{22,76,216,59,0,},{161,59,97,17,0,},{88,77,24,42,0,},{66,56,139,29,0,},{86,37,88,63,0,},
+{216,83,88,43,0,},{216,67,216,40,0,},{2,72,2,32,0,},{15,90,23,54,1,},{207,32,130,55,0,},{97,60,97,17,0,},
+{11,80,130,9,0,},{11,58,11,5,0,},{79,66,2,51,0,},{130,40,130,37,0,},{88,44,152,47,0,},{15,32,130,55,0,},
+{2,82,66,33,0,},{2,74,2,32,0,},{86,93,215,61,12,},{97,45,24,27,0,},{150,83,216,60,0,},{66,64,194,30,0,},
+{207,65,2,51,0,},{139,0,207,2,0,},{33,29,152,24,0,},{151,19,22,0,0,},{79,88,23,54,1,},{22,37,88,63,0,},
+{24,29,152,45,0,},{216,91,151,44,12,},{213,101,21,0,0,},{75,89,23,11,1,},{2,88,151,34,1,},{207,56,11,50,0,},
+{66,57,139,29,0,},{97,69,216,18,0,},{207,48,2,57,0,},{203,101,192,1,0,},{11,64,130,6,0,},{139,88,23,11,1,},
+{75,65,130,6,0,},{161,93,87,23,12,},{22,43,24,64,0,},{161,69,216,18,0,},{75,82,130,9,0,},{2,80,66,33,0,},
+{139,65,130,6,0,},{33,60,97,17,0,},{15,89,23,54,1,},{152,51,152,48,0,},{97,29,152,24,0,},{216,68,216,40,0,},
+{66,32,130,36,0,},{24,27,152,45,0,},{33,77,88,20,0,},{24,45,152,47,0,},{194,1,15,4,0,},{66,72,2,32,0,},
+{33,36,216,25,0,},{225,68,216,18,0,},{152,44,152,47,0,},{130,90,151,34,1,},{66,40,130,37,0,},{214,44,24,64,0,},
+{15,64,2,51,0,},{66,41,130,37,0,},{216,35,152,46,0,},{2,66,194,30,0,},{2,33,130,36,0,},{22,83,216,60,0,},
+{79,49,2,57,0,},{152,59,161,39,0,},{22,27,152,62,0,},{225,83,216,21,0,},{88,36,152,46,0,},{192,1,143,49,0,},
+{143,49,2,57,0,},{2,50,130,38,0,},{150,85,216,60,0,},{66,74,2,32,0,},{75,41,194,14,0,},{79,42,66,56,0,},
+{97,44,24,27,0,},{152,61,161,39,0,},{15,41,66,56,0,},{75,56,11,5,0,},{11,89,23,11,1,},{152,37,152,46,0,},
+{79,72,2,52,0,},{22,36,88,63,0,},{88,53,152,48,0,},{128,0,143,49,0,},{79,80,2,53,0,},{97,76,88,20,0,},
+{139,49,2,16,0,},{203,24,66,12,0,},{150,28,152,62,0,},{79,48,2,57,0,},{88,84,88,43,0,},{97,92,87,23,12,},
+{225,44,24,27,0,},{11,49,2,16,0,},{161,61,97,17,0,},{86,29,152,62,0,},{216,92,151,44,12,},{194,64,194,30,0,},
+{11,81,130,9,0,},{214,28,152,62,0,},{152,28,152,45,0,},{15,57,11,50,0,},{84,2,143,49,0,},{75,74,2,8,0,},
+{97,85,216,21,0,},{97,84,216,21,0,},{88,92,151,44,12,},{11,34,130,13,0,},{148,1,143,49,0,},{11,2,207,2,0,},
+{2,49,130,38,0,},{88,28,152,45,0,},{88,37,152,46,0,},{11,48,2,16,0,},{203,65,130,6,0,},{24,51,152,48,0,},
+{66,33,130,36,0,},{150,52,216,64,0,},{75,0,207,2,0,},{79,32,130,55,0,},{203,81,130,9,0,},{66,82,66,33,0,},
+{24,59,161,39,0,},{130,49,130,38,0,},{161,45,24,27,0,},{143,74,2,52,0,},{2,48,130,38,0,},{194,48,130,38,0,},
+{139,32,130,13,0,},{22,77,216,59,0,},{15,58,11,50,0,},{79,50,2,57,0,},{66,65,194,30,0,},{152,85,88,43,0,},
+{139,89,23,11,1,},{139,56,11,5,0,},{150,68,216,58,0,},{97,52,88,28,0,},{22,68,216,58,0,},{130,57,139,29,0,},
+{11,73,2,8,0,},{33,69,216,18,0,},{75,26,66,12,0,},{207,49,2,57,0,},{2,40,130,37,0,},{79,65,2,51,0,},
+{214,84,216,60,0,},{150,43,24,64,0,},{203,33,130,13,0,},{33,91,87,23,12,},{216,75,24,42,0,},{152,67,216,40,0,},
+{216,60,161,39,0,},{212,1,143,49,0,},{15,24,194,54,0,},{143,58,11,50,0,},{139,81,130,9,0,},{152,68,216,40,0,},
+{214,92,215,61,12,},{11,82,130,9,0,},{139,1,207,2,0,},{161,27,152,24,0,},{15,25,194,54,0,},{214,59,225,57,0,},
+{152,69,216,40,0,},{161,77,88,20,0,},{2,34,130,36,0,},{75,24,66,12,0,},{97,37,216,25,0,},{150,60,225,57,0,},
+{161,35,216,25,0,},{214,60,225,57,0,},{75,25,66,12,0,},{79,57,11,50,0,},{207,33,130,55,0,},{194,81,66,33,0,},
+{87,20,22,0,0,},{194,65,194,30,0,},{33,83,216,21,0,},{152,75,24,42,0,},{75,48,2,16,0,},{152,92,151,44,12,},
+{216,44,152,47,0,},{152,29,152,45,0,},{143,57,11,50,0,},{79,40,66,56,0,},{143,42,66,56,0,},{75,58,11,5,0,},
+{225,10,21,1,0,},{24,44,152,47,0,},{214,68,216,58,0,},{161,67,216,18,0,},{15,74,2,52,0,},{75,80,130,9,0,},
+{33,53,88,28,0,},{15,82,2,53,0,},{23,19,22,0,0,},{22,60,225,57,0,},{150,75,216,59,0,},{33,75,88,20,0,},
+{11,90,23,11,1,},{143,48,2,57,0,},{161,37,216,25,0,},{79,64,2,51,0,},{97,53,88,28,0,},{203,0,207,2,0,},
+{22,92,215,61,12,},{143,33,130,55,0,},{161,83,216,21,0,},{139,64,130,6,0,},{15,88,23,54,1,},{143,25,194,54,0,},
+{130,26,130,35,0,},{216,28,152,45,0,},{216,76,24,42,0,},{24,83,88,43,0,},{130,58,139,29,0,},{143,81,2,53,0,},
+{139,90,23,11,1,},{33,52,88,28,0,},{2,57,139,29,0,},{225,76,88,20,0,},{66,24,130,35,0,},{22,93,215,61,12,},
+{0,1,143,49,0,},{15,66,2,51,0,},{216,43,152,47,0,},{75,81,130,9,0,},{152,60,161,39,0,},{150,59,225,57,0,},
+{130,48,130,38,0,},{151,21,22,0,0,},{139,33,130,13,0,},{33,93,87,23,12,},{22,69,216,58,0,},{130,25,130,35,0,},
+{22,85,216,60,0,},{215,20,22,0,0,},{75,64,130,6,0,},{86,36,88,63,0,},{150,76,216,59,0,},{86,68,216,58,0,},
+{130,33,130,36,0,},{203,25,66,12,0,},{24,69,216,40,0,},{79,58,11,50,0,},{130,32,130,36,0,},{143,73,2,52,0,},
+{22,84,216,60,0,},{130,88,151,34,1,},{75,40,194,14,0,},{87,21,22,0,0,},{194,57,139,29,0,},{33,85,216,21,0,},
+{216,59,161,39,0,},{139,42,194,14,0,},{15,50,2,57,0,},{75,73,2,8,0,},{139,48,2,16,0,},{79,82,2,53,0,},
+{66,49,130,38,0,},{88,60,161,39,0,},{130,56,139,29,0,},{11,41,194,14,0,},{130,66,194,30,0,},{216,52,152,48,0,},
+{143,50,2,57,0,},{150,44,24,64,0,},{86,52,216,64,0,},{15,80,2,53,0,},{33,27,152,24,0,},{66,26,130,35,0,},
+{150,45,24,64,0,},{66,2,15,4,0,},{79,25,194,54,0,},{20,1,143,49,0,},{33,43,24,27,0,},{225,84,216,21,0,},
+{24,37,152,46,0,},{75,33,130,13,0,},{86,69,216,58,0,},{214,91,215,61,12,},{194,41,130,37,0,},{24,36,152,46,0,},
+{161,44,24,27,0,},{130,50,130,38,0,},{15,34,130,55,0,},{152,36,152,46,0,},{97,61,97,17,0,},{88,69,216,40,0,},
+{130,72,2,32,0,},{66,81,66,33,0,},{86,45,24,64,0,},{22,61,225,57,0,},{11,50,2,16,0,},{75,1,207,2,0,},
+{139,74,2,8,0,},{24,75,24,42,0,},{33,68,216,18,0,},{130,0,15,4,0,},{88,29,152,45,0,},{33,59,97,17,0,},
+{84,1,143,49,0,},{75,32,130,13,0,},{152,84,88,43,0,},{139,40,194,14,0,},{161,92,87,23,12,},{86,85,216,60,0,},
+{150,61,225,57,0,},{152,52,152,48,0,},{216,36,152,46,0,},{2,81,66,33,0,},{24,61,161,39,0,},{194,25,130,35,0,},
+{216,51,152,48,0,},{11,26,66,12,0,},{225,92,87,23,12,},{203,89,23,11,1,},{150,36,88,63,0,},{24,52,152,48,0,},
+{225,51,88,28,0,},{207,80,2,53,0,},{139,26,66,12,0,},{150,84,216,60,0,},{203,57,11,5,0,},{130,34,130,36,0,},
+{143,34,130,55,0,},{64,0,143,49,0,},{24,28,152,45,0,},{150,77,216,59,0,},{2,90,151,34,1,},{214,67,216,58,0,},
+{207,24,194,54,0,},{66,50,130,38,0,},{139,73,2,8,0,},{214,52,216,64,0,},{86,60,225,57,0,},{86,61,225,57,0,},
+{22,59,225,57,0,},{194,80,66,33,0,},{11,40,194,14,0,},{24,35,152,46,0,},{150,92,215,61,12,},{130,42,130,37,0,},
+{192,0,143,49,0,},{214,27,152,62,0,},{11,66,130,6,0,},{161,28,152,24,0,},{150,37,88,63,0,},{207,41,66,56,0,},
+{23,21,22,0,0,},{194,33,130,36,0,},{214,43,24,64,0,},{20,2,143,49,0,},{66,88,151,34,1,},{203,56,11,5,0,},
+{130,80,66,33,0,},{66,34,130,36,0,},{161,85,216,21,0,},{88,52,152,48,0,},{22,35,88,63,0,},{75,88,23,11,1,},
+{86,53,216,64,0,},{143,26,194,54,0,},{2,58,139,29,0,},{79,90,23,54,1,},{86,77,216,59,0,},{66,66,194,30,0,},
+{130,82,66,33,0,},{79,73,2,52,0,},{75,72,2,8,0,},{130,24,130,35,0,},{151,20,22,0,0,},{139,50,2,16,0,},
+{24,92,151,44,12,},{22,29,152,62,0,},{143,41,66,56,0,},{88,61,161,39,0,},{86,44,24,64,0,},{86,92,215,61,12,},
+{2,64,194,30,0,},{207,73,2,52,0,},{203,32,130,13,0,},{216,27,152,45,0,},{79,56,11,50,0,},{24,68,216,40,0,},
+{139,82,130,9,0,},{2,1,15,4,0,},{75,42,194,14,0,},{66,80,66,33,0,},{161,60,97,17,0,},{161,68,216,18,0,},
+{207,25,194,54,0,},{22,91,215,61,12,},{139,41,194,14,0,},{2,42,130,37,0,},{33,28,152,24,0,},{194,24,130,35,0,},
+{225,91,87,23,12,},{79,34,130,55,0,},{143,90,23,54,1,},{139,66,130,6,0,},{33,61,97,17,0,},{194,101,0,1,0,},
+{161,75,88,20,0,},{2,65,194,30,0,},{225,75,88,20,0,},{88,45,152,47,0,},{215,19,22,0,0,},{22,45,24,64,0,},
+{66,58,139,29,0,},{150,53,216,64,0,},{66,25,130,35,0,},{86,84,216,60,0,},{11,1,207,2,0,},{11,65,130,6,0,},
+{66,90,151,34,1,},{216,84,88,43,0,},{143,24,194,54,0,},{161,53,88,28,0,},{143,82,2,53,0,},{214,35,88,63,0,},
+{130,89,151,34,1,},{24,84,88,43,0,},{15,73,2,52,0,},{139,25,66,12,0,},{64,2,143,49,0,},{15,49,2,57,0,},
+{203,80,130,9,0,},{161,76,88,20,0,},{130,65,194,30,0,},{194,49,130,38,0,},{11,56,11,5,0,},{66,0,15,4,0,},
+{22,67,216,58,0,},{24,60,161,39,0,},{143,88,23,54,1,},{75,34,130,13,0,},{225,28,152,24,0,},{33,84,216,21,0,},
+{203,40,194,14,0,},{2,32,130,36,0,},{66,1,15,4,0,},{84,0,143,49,0,},{192,101,0,0,0,},{79,24,194,54,0,},
+{11,32,130,13,0,},{97,68,216,18,0,},{150,93,215,61,12,},{22,51,216,64,0,},{225,36,216,25,0,},{143,66,2,51,0,},
+{86,28,152,62,0,},{194,40,130,37,0,},{11,72,2,8,0,},{2,26,130,35,0,},{225,35,216,25,0,},{11,25,66,12,0,},
+{194,89,151,34,1,},{152,77,24,42,0,},{152,43,152,47,0,},{11,33,130,13,0,},{152,53,152,48,0,},{64,1,143,49,0,},
+{88,85,88,43,0,},{161,43,24,27,0,},{143,72,2,52,0,},{75,57,11,5,0,},{79,26,194,54,0,},{150,69,216,58,0,},
+{194,56,139,29,0,},{15,40,66,56,0,},{225,52,88,28,0,},{24,76,24,42,0,},{2,89,151,34,1,},{152,83,88,43,0,},
+{161,91,87,23,12,},{194,88,151,34,1,},{79,81,2,53,0,},{22,44,24,64,0,},{33,35,216,25,0,},{97,77,88,20,0,},
+{214,76,216,59,0,},{150,91,215,61,12,},{15,65,2,51,0,},{130,41,130,37,0,},{143,64,2,51,0,},{24,85,88,43,0,},
+{24,93,151,44,12,},{15,33,130,55,0,},{150,27,152,62,0,},{214,51,216,64,0,},{194,32,130,36,0,},{207,64,2,51,0,},
+{79,41,66,56,0,},{207,81,2,53,0,},{2,2,15,4,0,},{79,89,23,54,1,},{75,2,207,2,0,},{161,29,152,24,0,},
+{203,88,23,11,1,},{75,66,130,6,0,},{88,93,151,44,12,},{225,60,97,17,0,},{139,72,2,8,0,},{33,67,216,18,0,},
+{97,28,152,24,0,},{66,42,130,37,0,},{97,36,216,25,0,},{203,73,2,8,0,},{203,49,2,16,0,},{15,81,2,53,0,},
+{11,57,11,5,0,},{161,51,88,28,0,},{143,80,2,53,0,},{22,28,152,62,0,},{22,53,216,64,0,},{11,24,66,12,0,},
+{143,56,11,50,0,},{75,50,2,16,0,},{33,45,24,27,0,},};
+
+struct action_table_key {
+    uint8_t bytes[2];
+};
+static inline struct action_table_key encode_key(uint32_t target_nfa_state, uint32_t dfa_state, uint32_t dfa_symbol) {
+    struct action_table_key key = {{0}};
+    key.bytes[0] |= (target_nfa_state >> 0) & 63;
+    key.bytes[0] |= (dfa_state << 6) & 255;
+    key.bytes[1] |= (dfa_state >> 2) & 7;
+    key.bytes[1] |= (dfa_symbol << 3) & 127;
+    return key;
+}
+struct action_table_entry {
+    uint32_t nfa_state;
+    uint32_t actions;
+    uint32_t push_nfa_state;
+};
+static struct action_table_entry decode_entry(const uint8_t *bytes) {
+    struct action_table_entry entry = {0};
+    entry.nfa_state |= ((uint32_t)bytes[2] & 63) << 0;
+    entry.actions |= ((uint32_t)bytes[2] & 255) >> 6;
+    entry.actions |= ((uint32_t)bytes[3] & 127) << 2;
+    entry.push_nfa_state |= ((uint32_t)bytes[3] & 255) >> 7;
+    entry.push_nfa_state |= ((uint32_t)bytes[4] & 31) << 1;
+    return entry;
+}
+static struct action_table_entry action_table_lookup(uint32_t nfa_state, uint32_t dfa_state, uint32_t token) {
+    uint64_t packed = (uint64_t)nfa_state << 32 | (uint32_t)(dfa_state * 13 + token);
+    uint32_t hash = (uint32_t)((packed * ((uint64_t)2654435769U << 32 | 2135587861)) >> 32);
+    uint32_t displacement = action_table_displacements[(uint64_t)hash * 311 >> 32];
+    uint32_t slot = (hash << 16 | hash >> 16) ^ displacement * 0x9e3779b9u;
+    const uint8_t *entry = action_table[(uint64_t)slot * 621 >> 32];
+    struct action_table_key key = encode_key(nfa_state, dfa_state, token);
+    if (memcmp(key.bytes, entry, sizeof(key.bytes)) != 0)
+        abort();
+    return decode_entry(entry);
+}
+static void apply_actions(struct construct_state *state, uint32_t index, size_t start, size_t end) {
+    size_t offset = end;
+    uint32_t i;
+    for (i = index; actions[i]; ++i) {
+        if (((((actions[i]) >> 12) & 0xf) & 8))
+            offset = start;
+        construct_action_apply(state, actions[i], offset);
+    }
+}
+static size_t build_parse_tree(struct owl_parser *parser) {
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    struct owl_token_run *run = parser->token_run;
+    struct construct_state *construct_state = &parser->construct_state;
+    construct_state->info = parser->tree;
+    uint32_t *state_stack = parser->state_stack;
+    uint32_t stack_depth = 0;
+    size_t stack_capacity = parser->state_stack_capacity;
+    size_t whitespace = tokenizer->whitespace;
+    size_t offset = tokenizer->offset - whitespace;
+    construct_begin(construct_state, offset, CONSTRUCT_NORMAL_ROOT);
+    uint32_t nfa_state = 20;
+    while (run) {
+        uint16_t length_offset = run->lengths_size - 1;
+        uint16_t n = run->number_of_tokens;
+        uint16_t i;
+        for (i = n - 1; i < n; i--) {
+            size_t end = offset;
+            size_t len = 0;
+            uint32_t column = run->states[i] * 13 + run->tokens[i];
+            struct action_table_entry entry;
+            if (action_table_slot_for_column[column])
+                entry = decode_entry(action_table[action_table_slot_for_column[column] - 1]);
+            else
+                entry = action_table_lookup(nfa_state, run->states[i], run->tokens[i]);
+            if (run->tokens[i] < 11)
+                len = decode_token_length(run, &length_offset, &offset);
+            else {
+                if (stack_depth >= stack_capacity) {
+                    size_t new_capacity = (stack_capacity + 2) * 3 / 2;
+                    if (new_capacity <= stack_capacity)
+                        abort();
+                    uint32_t *new_stack = reallocate_memory(state_stack, stack_capacity * sizeof(uint32_t), new_capacity * sizeof(uint32_t), &parser->allocator);
+                    if (!new_stack)
+                        abort();
+                    state_stack = new_stack;
+                    stack_capacity = new_capacity;
+                }
+                state_stack[stack_depth++] = entry.push_nfa_state;
+            }
+            apply_actions(construct_state, entry.actions, end, end + whitespace);
+            if (run->states[i] == 11) {
+                if (stack_depth == 0)
+                    abort();
+                nfa_state = state_stack[--stack_depth];
+            } else
+                nfa_state = entry.nfa_state;
+            whitespace = end - offset - len;
+        }
+        struct owl_token_run *old = run;
+        run = run->prev;
+        old->prev = tokenizer->free_runs;
+        tokenizer->free_runs = old;
+    }
+    parser->token_run = 0;
+    parser->state_stack = state_stack;
+    parser->state_stack_capacity = stack_capacity;
+    struct action_table_entry entry = action_table_lookup(nfa_state, 23, 12);
+    apply_actions(construct_state, entry.actions, offset, offset + whitespace);
+    return construct_finish(construct_state, offset);
+}
+static size_t read_whitespace(const char *text, size_t length, void *info) {
+    switch (text[0]) {
+    case 32:
+    case 9:
+    case 10:
+    case 13:
+#ifdef OWL_SIMD
+        return vector_scan(text, 1, length, VECTOR_SCAN_WHITESPACE, 0);
+#else
+        return 1;
+#endif
+    default:
+        return 0;
+    }
+}
+static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, size_t length, void *info) {
+    switch (text[0]) {
+    case 40:
+        *end_token = false;
+        *token = 1;
+        return 1;
+    case 41:
+        *end_token = true;
+        *token = 2;
+        return 1;
+    case 42:
+        *end_token = false;
+        *token = 6;
+        return 1;
+    case 44:
+        *end_token = false;
+        *token = 3;
+        return 1;
+    case 46:
+        *end_token = false;
+        *token = 4;
+        return 1;
+    case 59:
+        *end_token = false;
+        *token = 0;
+        return 1;
+    case 61:
+        *end_token = false;
+        *token = 5;
+        return 1;
+    case 65:
+        switch (length > 1 ? text[1] : 0) {
+        case 66:
+            switch (length > 2 ? text[2] : 0) {
+            case 79:
+                if (length >= 5 && text[3] == 82 && text[4] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 83:
+                if (length >= 8 && text[3] == 79 && text[4] == 76 && text[5] == 85 && text[6] == 84 && text[7] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 8;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 67:
+            switch (length > 2 ? text[2] : 0) {
+            case 67:
+                if (length >= 6 && text[3] == 69 && text[4] == 83 && text[5] == 83) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 84:
+                if (length >= 6 && text[3] == 73 && text[4] == 79 && text[5] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 68:
+            switch (length > 2 ? text[2] : 0) {
+            case 68:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            case 77:
+                if (length >= 5 && text[3] == 73 && text[4] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 70:
+            if (length >= 5 && text[2] == 84 && text[3] == 69 && text[4] == 82) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        case 71:
+            if (length >= 9 && text[2] == 71 && text[3] == 82 && text[4] == 69 && text[5] == 71 && text[6] == 65 && text[7] == 84 && text[8] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 9;
+            } else {
+                return 0;
+            }
+        case 76:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            case 83:
+                if (length >= 4 && text[3] == 79) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 84:
+                if (length >= 5 && text[3] == 69 && text[4] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 87:
+                if (length >= 6 && text[3] == 65 && text[4] == 89 && text[5] == 83) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 78:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 7 && text[3] == 76 && text[4] == 89 && text[5] == 90 && text[6] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 68:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            case 89:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            default:
+                return 0;
+            }
+        case 82:
+            if (length >= 5 && text[2] == 82 && text[3] == 65 && text[4] == 89) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        case 83:
+            switch (length > 2 ? text[2] : 0) {
+            case 67:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            case 83:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    if (length >= 9 && text[4] == 82 && text[5] == 84 && text[6] == 73 && text[7] == 79 && text[8] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 9;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                case 73:
+                    if (length >= 10 && text[4] == 71 && text[5] == 78 && text[6] == 77 && text[7] == 69 && text[8] == 78 && text[9] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 10;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 89:
+                if (length >= 10 && text[3] == 77 && text[4] == 77 && text[5] == 69 && text[6] == 84 && text[7] == 82 && text[8] == 73 && text[9] == 67) {
+                    *end_token = false;
+                    *token = 7;
+                    return 10;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            default:
+                *end_token = false;
+                *token = 7;
+                return 2;
+            }
+        case 84:
+            switch (length > 2 ? text[2] : 0) {
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 65:
+                    if (length >= 6 && text[4] == 67 && text[5] == 72) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                case 82:
+                    if (length >= 9 && text[4] == 73 && text[5] == 66 && text[6] == 85 && text[7] == 84 && text[8] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 9;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            default:
+                *end_token = false;
+                *token = 7;
+                return 2;
+            }
+        case 85:
+            if (length >= 13 && text[2] == 84 && text[3] == 72 && text[4] == 79 && text[5] == 82 && text[6] == 73 && text[7] == 90 && text[8] == 65 && text[9] == 84 && text[10] == 73 && text[11] == 79 && text[12] == 78) {
+                *end_token = false;
+                *token = 7;
+                return 13;
+            } else {
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 66:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            if (length >= 8 && text[2] == 67 && text[3] == 75 && text[4] == 87 && text[5] == 65 && text[6] == 82 && text[7] == 68) {
+                *end_token = false;
+                *token = 7;
+                return 8;
+            } else {
+                return 0;
+            }
+        case 69:
+            switch (length > 2 ? text[2] : 0) {
+            case 70:
+                if (length >= 6 && text[3] == 79 && text[4] == 82 && text[5] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 71:
+                if (length >= 5 && text[3] == 73 && text[4] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 84:
+                if (length >= 7 && text[3] == 87 && text[4] == 69 && text[5] == 69 && text[6] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 73:
+            switch (length > 2 ? text[2] : 0) {
+            case 71:
+                if (length >= 6 && text[3] == 73 && text[4] == 78 && text[5] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 78:
+                if (length >= 6 && text[3] == 65 && text[4] == 82 && text[5] == 89) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 84:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            default:
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 79:
+                if (length >= 7 && text[3] == 76 && text[4] == 69 && text[5] == 65 && text[6] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 84:
+                if (length >= 4 && text[3] == 72) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 89:
+            *end_token = false;
+            *token = 7;
+            return 2;
+        default:
+            return 0;
+        }
+    case 67:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 67:
+                if (length >= 5 && text[3] == 72 && text[4] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 76:
+                switch (length > 3 ? text[3] : 0) {
+                case 76:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        if (length >= 6 && text[5] == 68) {
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            case 83:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 65:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 68:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 69:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 68:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 8;
+                                default:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 7;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 69:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                case 84:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                default:
+                    return 0;
+                }
+            case 84:
+                if (length >= 7 && text[3] == 65 && text[4] == 76 && text[5] == 79 && text[6] == 71) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 72:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    if (length >= 5 && text[4] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                case 82:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 65:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 67:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 84:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 69:
+                                    switch (length > 8 ? text[8] : 0) {
+                                    case 82:
+                                        switch (length > 9 ? text[9] : 0) {
+                                        case 73:
+                                            if (length >= 15 && text[10] == 83 && text[11] == 84 && text[12] == 73 && text[13] == 67 && text[14] == 83) {
+                                                *end_token = false;
+                                                *token = 7;
+                                                return 15;
+                                            } else {
+                                                *end_token = false;
+                                                *token = 7;
+                                                return 9;
+                                            }
+                                        default:
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 9;
+                                        }
+                                    default:
+                                        *end_token = false;
+                                        *token = 7;
+                                        return 4;
+                                    }
+                                default:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 4;
+                                }
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 4;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            case 69:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 75:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 80:
+                            if (length >= 10 && text[6] == 79 && text[7] == 73 && text[8] == 78 && text[9] == 84) {
+                                *end_token = false;
+                                *token = 7;
+                                return 10;
+                            } else {
+                                *end_token = false;
+                                *token = 7;
+                                return 5;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 5;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 76:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 5 && text[3] == 83 && text[4] == 83) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 79:
+                if (length >= 5 && text[3] == 83 && text[4] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 85:
+                if (length >= 7 && text[3] == 83 && text[4] == 84 && text[5] == 69 && text[6] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 8 && text[3] == 76 && text[4] == 69 && text[5] == 83 && text[6] == 67 && text[7] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 8;
+                } else {
+                    return 0;
+                }
+            case 76:
+                switch (length > 3 ? text[3] : 0) {
+                case 76:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 65:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 84:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 69:
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            case 73:
+                                if (length >= 9 && text[7] == 79 && text[8] == 78) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 9;
+                                } else {
+                                    return 0;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 85:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 77:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 78:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 83:
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 6;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 77:
+                switch (length > 3 ? text[3] : 0) {
+                case 77:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 78:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 84:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 83:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 8;
+                                default:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 7;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    case 73:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 84:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 84:
+                                if (length >= 9 && text[7] == 69 && text[8] == 68) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 9;
+                                } else {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 6;
+                                }
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 6;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 78:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    if (length >= 12 && text[4] == 85 && text[5] == 82 && text[6] == 82 && text[7] == 69 && text[8] == 78 && text[9] == 84 && text[10] == 76 && text[11] == 89) {
+                        *end_token = false;
+                        *token = 7;
+                        return 12;
+                    } else {
+                        return 0;
+                    }
+                case 70:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 73:
+                        if (length >= 13 && text[5] == 71 && text[6] == 85 && text[7] == 82 && text[8] == 65 && text[9] == 84 && text[10] == 73 && text[11] == 79 && text[12] == 78) {
+                            *end_token = false;
+                            *token = 7;
+                            return 13;
+                        } else {
+                            return 0;
+                        }
+                    case 76:
+                        if (length >= 8 && text[5] == 73 && text[6] == 67 && text[7] == 84) {
+                            *end_token = false;
+                            *token = 7;
+                            return 8;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 78:
+                    if (length >= 10 && text[4] == 69 && text[5] == 67 && text[6] == 84 && text[7] == 73 && text[8] == 79 && text[9] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 10;
+                    } else {
+                        return 0;
+                    }
+                case 83:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 84:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 82:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 65:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 73:
+                                    switch (length > 8 ? text[8] : 0) {
+                                    case 78:
+                                        switch (length > 9 ? text[9] : 0) {
+                                        case 84:
+                                            switch (length > 10 ? text[10] : 0) {
+                                            case 83:
+                                                *end_token = false;
+                                                *token = 7;
+                                                return 11;
+                                            default:
+                                                *end_token = false;
+                                                *token = 7;
+                                                return 10;
+                                            }
+                                        default:
+                                            return 0;
+                                        }
+                                    default:
+                                        return 0;
+                                    }
+                                default:
+                                    return 0;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 84:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        if (length >= 7 && text[5] == 78 && text[6] == 84) {
+                            *end_token = false;
+                            *token = 7;
+                            return 7;
+                        } else {
+                            return 0;
+                        }
+                    case 73:
+                        if (length >= 8 && text[5] == 78 && text[6] == 85 && text[7] == 69) {
+                            *end_token = false;
+                            *token = 7;
+                            return 8;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 86:
+                    if (length >= 10 && text[4] == 69 && text[5] == 82 && text[6] == 83 && text[7] == 73 && text[8] == 79 && text[9] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 10;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 80:
+                if (length >= 4 && text[3] == 89) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 83:
+                if (length >= 4 && text[3] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 82:
+            switch (length > 2 ? text[2] : 0) {
+            case 69:
+                if (length >= 6 && text[3] == 65 && text[4] == 84 && text[5] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 79:
+                if (length >= 5 && text[3] == 83 && text[4] == 83) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 83:
+            if (length >= 3 && text[2] == 86) {
+                *end_token = false;
+                *token = 7;
+                return 3;
+            } else {
+                return 0;
+            }
+        case 85:
+            switch (length > 2 ? text[2] : 0) {
+            case 66:
+                if (length >= 4 && text[3] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 82:
+                switch (length > 3 ? text[3] : 0) {
+                case 82:
+                    if (length >= 7 && text[4] == 69 && text[5] == 78 && text[6] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 83:
+                    if (length >= 6 && text[4] == 79 && text[5] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 89:
+            if (length >= 5 && text[2] == 67 && text[3] == 76 && text[4] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 68:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 65:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 66:
+                        if (length >= 8 && text[5] == 65 && text[6] == 83 && text[7] == 69) {
+                            *end_token = false;
+                            *token = 7;
+                            return 8;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            case 89:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            default:
+                return 0;
+            }
+        case 69:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 10 && text[3] == 76 && text[4] == 76 && text[5] == 79 && text[6] == 67 && text[7] == 65 && text[8] == 84 && text[9] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 10;
+                } else {
+                    return 0;
+                }
+            case 67:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    if (length >= 7 && text[4] == 77 && text[5] == 65 && text[6] == 76) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                case 76:
+                    if (length >= 7 && text[4] == 65 && text[5] == 82 && text[6] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 3;
+                }
+            case 70:
+                switch (length > 3 ? text[3] : 0) {
+                case 65:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 85:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 76:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 84:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 83:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 8;
+                                default:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 7;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 82:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 82:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 65:
+                                if (length >= 10 && text[7] == 66 && text[8] == 76 && text[9] == 69) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 10;
+                                } else {
+                                    return 0;
+                                }
+                            case 69:
+                                if (length >= 8 && text[7] == 68) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 8;
+                                } else {
+                                    return 0;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 73:
+                    if (length >= 7 && text[4] == 78 && text[5] == 69 && text[6] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 76:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    if (length >= 6 && text[4] == 84 && text[5] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                case 73:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 77:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 73:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 84:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 69:
+                                    switch (length > 8 ? text[8] : 0) {
+                                    case 82:
+                                        switch (length > 9 ? text[9] : 0) {
+                                        case 83:
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 10;
+                                        default:
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 9;
+                                        }
+                                    default:
+                                        return 0;
+                                    }
+                                default:
+                                    return 0;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 80:
+                if (length >= 7 && text[3] == 69 && text[4] == 78 && text[5] == 68 && text[6] == 83) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 83:
+                if (length >= 4 && text[3] == 67) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 84:
+                if (length >= 6 && text[3] == 65 && text[4] == 67 && text[5] == 72) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 73:
+            switch (length > 2 ? text[2] : 0) {
+            case 67:
+                if (length >= 10 && text[3] == 84 && text[4] == 73 && text[5] == 79 && text[6] == 78 && text[7] == 65 && text[8] == 82 && text[9] == 89) {
+                    *end_token = false;
+                    *token = 7;
+                    return 10;
+                } else {
+                    return 0;
+                }
+            case 83:
+                switch (length > 3 ? text[3] : 0) {
+                case 65:
+                    if (length >= 7 && text[4] == 66 && text[5] == 76 && text[6] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 67:
+                    if (length >= 7 && text[4] == 65 && text[5] == 82 && text[6] == 68) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 84:
+                    if (length >= 8 && text[4] == 73 && text[5] == 78 && text[6] == 67 && text[7] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 67:
+                if (length >= 8 && text[3] == 85 && text[4] == 77 && text[5] == 69 && text[6] == 78 && text[7] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 8;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 77:
+                if (length >= 6 && text[3] == 65 && text[4] == 73 && text[5] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 85:
+                if (length >= 6 && text[3] == 66 && text[4] == 76 && text[5] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            default:
+                *end_token = false;
+                *token = 7;
+                return 2;
+            }
+        case 82:
+            if (length >= 4 && text[2] == 79 && text[3] == 80) {
+                *end_token = false;
+                *token = 7;
+                return 4;
+            } else {
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 69:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            if (length >= 4 && text[2] == 67 && text[3] == 72) {
+                *end_token = false;
+                *token = 7;
+                return 4;
+            } else {
+                return 0;
+            }
+        case 76:
+            if (length >= 4 && text[2] == 83 && text[3] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 4;
+            } else {
+                return 0;
+            }
+        case 78:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 6 && text[3] == 66 && text[4] == 76 && text[5] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 67:
+                switch (length > 3 ? text[3] : 0) {
+                case 79:
+                    if (length >= 8 && text[4] == 68 && text[5] == 73 && text[6] == 78 && text[7] == 71) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                case 82:
+                    if (length >= 9 && text[4] == 89 && text[5] == 80 && text[6] == 84 && text[7] == 69 && text[8] == 68) {
+                        *end_token = false;
+                        *token = 7;
+                        return 9;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 68:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            case 85:
+                if (length >= 4 && text[3] == 77) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 83:
+            if (length >= 6 && text[2] == 67 && text[3] == 65 && text[4] == 80 && text[5] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 6;
+            } else {
+                return 0;
+            }
+        case 86:
+            if (length >= 5 && text[2] == 69 && text[3] == 78 && text[4] == 84) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        case 88:
+            switch (length > 2 ? text[2] : 0) {
+            case 67:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    if (length >= 6 && text[4] == 80 && text[5] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                case 76:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 85:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 68:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 69:
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            case 73:
+                                if (length >= 9 && text[7] == 78 && text[8] == 71) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 9;
+                                } else {
+                                    return 0;
+                                }
+                            default:
+                                return 0;
+                            }
+                        case 83:
+                            if (length >= 9 && text[6] == 73 && text[7] == 86 && text[8] == 69) {
+                                *end_token = false;
+                                *token = 7;
+                                return 9;
+                            } else {
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 69:
+                if (length >= 7 && text[3] == 67 && text[4] == 85 && text[5] == 84 && text[6] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 73:
+                if (length >= 6 && text[3] == 83 && text[4] == 84 && text[5] == 83) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 80:
+                if (length >= 7 && text[3] == 76 && text[4] == 65 && text[5] == 73 && text[6] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 78:
+                        if (length >= 9 && text[5] == 83 && text[6] == 73 && text[7] == 79 && text[8] == 78) {
+                            *end_token = false;
+                            *token = 7;
+                            return 9;
+                        } else {
+                            return 0;
+                        }
+                    case 82:
+                        if (length >= 8 && text[5] == 78 && text[6] == 65 && text[7] == 76) {
+                            *end_token = false;
+                            *token = 7;
+                            return 8;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 82:
+                    if (length >= 7 && text[4] == 65 && text[5] == 67 && text[6] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 70:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                if (length >= 5 && text[3] == 83 && text[4] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 77:
+                if (length >= 6 && text[3] == 73 && text[4] == 76 && text[5] == 89) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 69:
+            if (length >= 5 && text[2] == 84 && text[3] == 67 && text[4] == 72) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        case 73:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                if (length >= 6 && text[3] == 84 && text[4] == 69 && text[5] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 82:
+                if (length >= 5 && text[3] == 83 && text[4] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 76:
+            if (length >= 5 && text[2] == 79 && text[3] == 65 && text[4] == 84) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                if (length >= 9 && text[3] == 76 && text[4] == 79 && text[5] == 87 && text[6] == 73 && text[7] == 78 && text[8] == 71) {
+                    *end_token = false;
+                    *token = 7;
+                    return 9;
+                } else {
+                    return 0;
+                }
+            case 82:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    if (length >= 5 && text[4] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                case 69:
+                    if (length >= 7 && text[4] == 73 && text[5] == 71 && text[6] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                case 87:
+                    if (length >= 7 && text[4] == 65 && text[5] == 82 && text[6] == 68) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 3;
+                }
+            default:
+                return 0;
+            }
+        case 82:
+            switch (length > 2 ? text[2] : 0) {
+            case 69:
+                if (length >= 6 && text[3] == 69 && text[4] == 90 && text[5] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 79:
+                if (length >= 4 && text[3] == 77) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 85:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                if (length >= 4 && text[3] == 76) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 78:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 84:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 73:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 79:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 78:
+                                    switch (length > 8 ? text[8] : 0) {
+                                    case 83:
+                                        *end_token = false;
+                                        *token = 7;
+                                        return 9;
+                                    default:
+                                        *end_token = false;
+                                        *token = 7;
+                                        return 8;
+                                    }
+                                default:
+                                    return 0;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 71:
+        switch (length > 1 ? text[1] : 0) {
+        case 69:
+            if (length >= 9 && text[2] == 78 && text[3] == 69 && text[4] == 82 && text[5] == 65 && text[6] == 84 && text[7] == 69 && text[8] == 68) {
+                *end_token = false;
+                *token = 7;
+                return 9;
+            } else {
+                return 0;
+            }
+        case 76:
+            if (length >= 6 && text[2] == 79 && text[3] == 66 && text[4] == 65 && text[5] == 76) {
+                *end_token = false;
+                *token = 7;
+                return 6;
+            } else {
+                return 0;
+            }
+        case 82:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                switch (length > 3 ? text[3] : 0) {
+                case 78:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 84:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 69:
+                            if (length >= 7 && text[6] == 68) {
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            } else {
+                                *end_token = false;
+                                *token = 7;
+                                return 5;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 5;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 69:
+                if (length >= 8 && text[3] == 65 && text[4] == 84 && text[5] == 69 && text[6] == 83 && text[7] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 8;
+                } else {
+                    return 0;
+                }
+            case 79:
+                switch (length > 3 ? text[3] : 0) {
+                case 85:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 80:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 73:
+                            if (length >= 8 && text[6] == 78 && text[7] == 71) {
+                                *end_token = false;
+                                *token = 7;
+                                return 8;
+                            } else {
+                                *end_token = false;
+                                *token = 7;
+                                return 5;
+                            }
+                        case 83:
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 5;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 72:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 78:
+                if (length >= 7 && text[3] == 68 && text[4] == 76 && text[5] == 69 && text[6] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 86:
+                if (length >= 6 && text[3] == 73 && text[4] == 78 && text[5] == 71) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 69:
+            if (length >= 6 && text[2] == 65 && text[3] == 68 && text[4] == 69 && text[5] == 82) {
+                *end_token = false;
+                *token = 7;
+                return 6;
+            } else {
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                if (length >= 4 && text[3] == 68) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 85:
+                if (length >= 4 && text[3] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 73:
+        switch (length > 1 ? text[1] : 0) {
+        case 68:
+            if (length >= 8 && text[2] == 69 && text[3] == 78 && text[4] == 84 && text[5] == 73 && text[6] == 84 && text[7] == 89) {
+                *end_token = false;
+                *token = 7;
+                return 8;
+            } else {
+                return 0;
+            }
+        case 70:
+            *end_token = false;
+            *token = 7;
+            return 2;
+        case 76:
+            if (length >= 5 && text[2] == 73 && text[3] == 75 && text[4] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        case 77:
+            switch (length > 2 ? text[2] : 0) {
+            case 77:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    if (length >= 9 && text[4] == 68 && text[5] == 73 && text[6] == 65 && text[7] == 84 && text[8] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 9;
+                    } else {
+                        return 0;
+                    }
+                case 85:
+                    if (length >= 9 && text[4] == 84 && text[5] == 65 && text[6] == 66 && text[7] == 76 && text[8] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 9;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 80:
+                switch (length > 3 ? text[3] : 0) {
+                case 76:
+                    if (length >= 8 && text[4] == 73 && text[5] == 67 && text[6] == 73 && text[7] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                case 79:
+                    if (length >= 6 && text[4] == 82 && text[5] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 78:
+            switch (length > 2 ? text[2] : 0) {
+            case 67:
+                switch (length > 3 ? text[3] : 0) {
+                case 76:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 85:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 68:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 69:
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            case 73:
+                                if (length >= 9 && text[7] == 78 && text[8] == 71) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 9;
+                                } else {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 2;
+                                }
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 2;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 2;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                case 82:
+                    if (length >= 9 && text[4] == 69 && text[5] == 77 && text[6] == 69 && text[7] == 78 && text[8] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 9;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 68:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 88:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 69:
+                            if (length >= 7 && text[6] == 83) {
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            } else {
+                                *end_token = false;
+                                *token = 7;
+                                return 5;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 5;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 72:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 82:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 73:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 84:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 83:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 8;
+                                default:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 7;
+                                }
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 2;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 2;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 73:
+                if (length >= 9 && text[3] == 84 && text[4] == 73 && text[5] == 65 && text[6] == 76 && text[7] == 76 && text[8] == 89) {
+                    *end_token = false;
+                    *token = 7;
+                    return 9;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 76:
+                if (length >= 6 && text[3] == 73 && text[4] == 78 && text[5] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 78:
+                if (length >= 5 && text[3] == 69 && text[4] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 79:
+                if (length >= 5 && text[3] == 85 && text[4] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 80:
+                if (length >= 5 && text[3] == 85 && text[4] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 83:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 78:
+                        if (length >= 11 && text[5] == 83 && text[6] == 73 && text[7] == 84 && text[8] == 73 && text[9] == 86 && text[10] == 69) {
+                            *end_token = false;
+                            *token = 7;
+                            return 11;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 2;
+                        }
+                    case 82:
+                        if (length >= 6 && text[5] == 84) {
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 2;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                case 84:
+                    if (length >= 7 && text[4] == 69 && text[5] == 65 && text[6] == 68) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 71:
+                        if (length >= 7 && text[5] == 69 && text[6] == 82) {
+                            *end_token = false;
+                            *token = 7;
+                            return 7;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 3;
+                        }
+                    case 82:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 83:
+                            if (length >= 9 && text[6] == 69 && text[7] == 67 && text[8] == 84) {
+                                *end_token = false;
+                                *token = 7;
+                                return 9;
+                            } else {
+                                *end_token = false;
+                                *token = 7;
+                                return 3;
+                            }
+                        case 86:
+                            if (length >= 8 && text[6] == 65 && text[7] == 76) {
+                                *end_token = false;
+                                *token = 7;
+                                return 8;
+                            } else {
+                                *end_token = false;
+                                *token = 7;
+                                return 3;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 3;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                case 79:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 3;
+                }
+            case 86:
+                if (length >= 7 && text[3] == 79 && text[4] == 75 && text[5] == 69 && text[6] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            default:
+                *end_token = false;
+                *token = 7;
+                return 2;
+            }
+        case 83:
+            switch (length > 2 ? text[2] : 0) {
+            case 78:
+                if (length >= 6 && text[3] == 85 && text[4] == 76 && text[5] == 76) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 79:
+                if (length >= 9 && text[3] == 76 && text[4] == 65 && text[5] == 84 && text[6] == 73 && text[7] == 79 && text[8] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 9;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            default:
+                *end_token = false;
+                *token = 7;
+                return 2;
+            }
+        default:
+            return 0;
+        }
+    case 74:
+        if (length >= 4 && text[1] == 79 && text[2] == 73 && text[3] == 78) {
+            *end_token = false;
+            *token = 7;
+            return 4;
+        } else {
+            return 0;
+        }
+    case 75:
+        if (length >= 3 && text[1] == 69 && text[2] == 89) {
+            *end_token = false;
+            *token = 7;
+            return 3;
+        } else {
+            return 0;
+        }
+    case 76:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 66:
+                if (length >= 5 && text[3] == 69 && text[4] == 76) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 78:
+                if (length >= 8 && text[3] == 71 && text[4] == 85 && text[5] == 65 && text[6] == 71 && text[7] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 8;
+                } else {
+                    return 0;
+                }
+            case 82:
+                if (length >= 5 && text[3] == 71 && text[4] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 83:
+                if (length >= 4 && text[3] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 84:
+                if (length >= 7 && text[3] == 69 && text[4] == 82 && text[5] == 65 && text[6] == 76) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 69:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                switch (length > 3 ? text[3] : 0) {
+                case 68:
+                    if (length >= 7 && text[4] == 73 && text[5] == 78 && text[6] == 71) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 75:
+                    if (length >= 9 && text[4] == 80 && text[5] == 82 && text[6] == 79 && text[7] == 79 && text[8] == 70) {
+                        *end_token = false;
+                        *token = 7;
+                        return 9;
+                    } else {
+                        return 0;
+                    }
+                case 83:
+                    if (length >= 5 && text[4] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 70:
+                if (length >= 4 && text[3] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 86:
+                if (length >= 5 && text[3] == 69 && text[4] == 76) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 73:
+            switch (length > 2 ? text[2] : 0) {
+            case 75:
+                if (length >= 4 && text[3] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 77:
+                if (length >= 5 && text[3] == 73 && text[4] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 83:
+                if (length >= 6 && text[3] == 84 && text[4] == 69 && text[5] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 4 && text[3] == 68) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 67:
+                switch (length > 3 ? text[3] : 0) {
+                case 65:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 76:
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    case 84:
+                        if (length >= 8 && text[5] == 73 && text[6] == 79 && text[7] == 78) {
+                            *end_token = false;
+                            *token = 7;
+                            return 8;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 75:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        if (length >= 6 && text[5] == 68) {
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            case 71:
+                if (length >= 6 && text[3] == 71 && text[4] == 69 && text[5] == 68) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 77:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 80:
+                if (length >= 7 && text[3] == 80 && text[4] == 73 && text[5] == 78 && text[6] == 71) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    if (length >= 5 && text[4] == 72) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                case 69:
+                    if (length >= 12 && text[4] == 82 && text[5] == 73 && text[6] == 65 && text[7] == 76 && text[8] == 73 && text[9] == 90 && text[10] == 69 && text[11] == 68) {
+                        *end_token = false;
+                        *token = 7;
+                        return 12;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 88:
+                if (length >= 8 && text[3] == 86 && text[4] == 65 && text[5] == 76 && text[6] == 85 && text[7] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 8;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 69:
+            if (length >= 6 && text[2] == 84 && text[3] == 72 && text[4] == 79 && text[5] == 68) {
+                *end_token = false;
+                *token = 7;
+                return 6;
+            } else {
+                return 0;
+            }
+        case 73:
+            switch (length > 2 ? text[2] : 0) {
+            case 78:
+                switch (length > 3 ? text[3] : 0) {
+                case 85:
+                    if (length >= 6 && text[4] == 84 && text[5] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                case 86:
+                    if (length >= 8 && text[4] == 65 && text[5] == 76 && text[6] == 85 && text[7] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 68:
+                if (length >= 4 && text[3] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 78:
+                if (length >= 5 && text[3] == 84 && text[4] == 72) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 86:
+                if (length >= 4 && text[3] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 78:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 77:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 83:
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    if (length >= 8 && text[4] == 79 && text[5] == 78 && text[6] == 65 && text[7] == 76) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                case 85:
+                    if (length >= 7 && text[4] == 82 && text[5] == 65 && text[6] == 76) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 67:
+            if (length >= 5 && text[2] == 72 && text[3] == 65 && text[4] == 82) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        case 69:
+            switch (length > 2 ? text[2] : 0) {
+            case 87:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            case 88:
+                if (length >= 4 && text[3] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 78:
+                if (length >= 4 && text[3] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 72:
+                    if (length >= 7 && text[4] == 73 && text[5] == 78 && text[6] == 71) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                case 73:
+                    if (length >= 6 && text[4] == 70 && text[5] == 89) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                case 78:
+                    if (length >= 7 && text[4] == 85 && text[5] == 76 && text[6] == 76) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 3;
+                }
+            case 87:
+                if (length >= 6 && text[3] == 65 && text[4] == 73 && text[5] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            default:
+                *end_token = false;
+                *token = 7;
+                return 2;
+            }
+        case 85:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                switch (length > 3 ? text[3] : 0) {
+                case 76:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 73:
+                        if (length >= 6 && text[5] == 70) {
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    case 83:
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            case 77:
+                if (length >= 7 && text[3] == 69 && text[4] == 82 && text[5] == 73 && text[6] == 67) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 79:
+        switch (length > 1 ? text[1] : 0) {
+        case 66:
+            if (length >= 6 && text[2] == 74 && text[3] == 69 && text[4] == 67 && text[5] == 84) {
+                *end_token = false;
+                *token = 7;
+                return 6;
+            } else {
+                return 0;
+            }
+        case 70:
+            switch (length > 2 ? text[2] : 0) {
+            case 70:
+                switch (length > 3 ? text[3] : 0) {
+                case 83:
+                    if (length >= 6 && text[4] == 69 && text[5] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 3;
+                }
+            default:
+                *end_token = false;
+                *token = 7;
+                return 2;
+            }
+        case 73:
+            if (length >= 4 && text[2] == 68 && text[3] == 83) {
+                *end_token = false;
+                *token = 7;
+                return 4;
+            } else {
+                return 0;
+            }
+        case 76:
+            if (length >= 3 && text[2] == 68) {
+                *end_token = false;
+                *token = 7;
+                return 3;
+            } else {
+                return 0;
+            }
+        case 78:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                if (length >= 4 && text[3] == 89) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            default:
+                *end_token = false;
+                *token = 7;
+                return 2;
+            }
+        case 80:
+            switch (length > 2 ? text[2] : 0) {
+            case 69:
+                if (length >= 8 && text[3] == 82 && text[4] == 65 && text[5] == 84 && text[6] == 79 && text[7] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 8;
+                } else {
+                    return 0;
+                }
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 79:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 78:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 83:
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 6;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 82:
+            switch (length > 2 ? text[2] : 0) {
+            case 68:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    if (length >= 5 && text[4] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                case 73:
+                    if (length >= 10 && text[4] == 78 && text[5] == 65 && text[6] == 76 && text[7] == 73 && text[8] == 84 && text[9] == 89) {
+                        *end_token = false;
+                        *token = 7;
+                        return 10;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 2;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 2;
+                }
+            default:
+                *end_token = false;
+                *token = 7;
+                return 2;
+            }
+        case 84:
+            if (length >= 6 && text[2] == 72 && text[3] == 69 && text[4] == 82 && text[5] == 83) {
+                *end_token = false;
+                *token = 7;
+                return 6;
+            } else {
+                return 0;
+            }
+        case 85:
+            switch (length > 2 ? text[2] : 0) {
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    if (length >= 5 && text[4] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 3;
+                }
+            default:
+                return 0;
+            }
+        case 86:
+            switch (length > 2 ? text[2] : 0) {
+            case 69:
+                switch (length > 3 ? text[3] : 0) {
+                case 82:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 76:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 65:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 80:
+                                if (length >= 8 && text[7] == 83) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 8;
+                                } else {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 4;
+                                }
+                            case 89:
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 4;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    case 82:
+                        if (length >= 10 && text[5] == 73 && text[6] == 68 && text[7] == 73 && text[8] == 78 && text[9] == 71) {
+                            *end_token = false;
+                            *token = 7;
+                            return 10;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 87:
+            switch (length > 2 ? text[2] : 0) {
+            case 78:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 68:
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    case 82:
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 80:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 82:
+                switch (length > 3 ? text[3] : 0) {
+                case 65:
+                    if (length >= 8 && text[4] == 76 && text[5] == 76 && text[6] == 69 && text[7] == 76) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                case 83:
+                    if (length >= 6 && text[4] == 69 && text[5] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                case 84:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 73:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 65:
+                            if (length >= 7 && text[6] == 76) {
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            } else {
+                                return 0;
+                            }
+                        case 84:
+                            if (length >= 9 && text[6] == 73 && text[7] == 79 && text[8] == 78) {
+                                *end_token = false;
+                                *token = 7;
+                                return 9;
+                            } else {
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 83:
+                switch (length > 3 ? text[3] : 0) {
+                case 83:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 73:
+                        if (length >= 7 && text[5] == 78 && text[6] == 71) {
+                            *end_token = false;
+                            *token = 7;
+                            return 7;
+                        } else {
+                            return 0;
+                        }
+                    case 87:
+                        if (length >= 8 && text[5] == 79 && text[6] == 82 && text[7] == 68) {
+                            *end_token = false;
+                            *token = 7;
+                            return 8;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 76:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    if (length >= 7 && text[4] == 73 && text[5] == 78 && text[6] == 71) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 78:
+                    if (length >= 5 && text[4] == 83) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                if (length >= 6 && text[3] == 73 && text[4] == 67 && text[5] == 89) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 83:
+                if (length >= 8 && text[3] == 73 && text[4] == 84 && text[5] == 73 && text[6] == 79 && text[7] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 8;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 82:
+            switch (length > 2 ? text[2] : 0) {
+            case 69:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        if (length >= 9 && text[5] == 68 && text[6] == 73 && text[7] == 78 && text[8] == 71) {
+                            *end_token = false;
+                            *token = 7;
+                            return 9;
+                        } else {
+                            return 0;
+                        }
+                    case 73:
+                        if (length >= 9 && text[5] == 83 && text[6] == 73 && text[7] == 79 && text[8] == 78) {
+                            *end_token = false;
+                            *token = 7;
+                            return 9;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 80:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 65:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 82:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 69:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 68:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 8;
+                                default:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 7;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 83:
+                    if (length >= 8 && text[4] == 69 && text[5] == 82 && text[6] == 86 && text[7] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 73:
+                switch (length > 3 ? text[3] : 0) {
+                case 77:
+                    if (length >= 7 && text[4] == 65 && text[5] == 82 && text[6] == 89) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 79:
+                    if (length >= 5 && text[4] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                case 86:
+                    if (length >= 10 && text[4] == 73 && text[5] == 76 && text[6] == 69 && text[7] == 71 && text[8] == 69 && text[9] == 83) {
+                        *end_token = false;
+                        *token = 7;
+                        return 10;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 79:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 68:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 85:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 82:
+                                    switch (length > 8 ? text[8] : 0) {
+                                    case 65:
+                                        if (length >= 10 && text[9] == 76) {
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 10;
+                                        } else {
+                                            return 0;
+                                        }
+                                    case 69:
+                                        switch (length > 9 ? text[9] : 0) {
+                                        case 83:
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 10;
+                                        default:
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 9;
+                                        }
+                                    default:
+                                        return 0;
+                                    }
+                                default:
+                                    return 0;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 71:
+                    if (length >= 7 && text[4] == 82 && text[5] == 65 && text[6] == 77) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 85:
+            if (length >= 11 && text[2] == 66 && text[3] == 76 && text[4] == 73 && text[5] == 67 && text[6] == 65 && text[7] == 84 && text[8] == 73 && text[9] == 79 && text[10] == 78) {
+                *end_token = false;
+                *token = 7;
+                return 11;
+            } else {
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 81:
+        if (length >= 5 && text[1] == 85 && text[2] == 79 && text[3] == 84 && text[4] == 69) {
+            *end_token = false;
+            *token = 7;
+            return 5;
+        } else {
+            return 0;
+        }
+    case 82:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            if (length >= 5 && text[2] == 78 && text[3] == 71 && text[4] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        case 69:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                switch (length > 3 ? text[3] : 0) {
+                case 68:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                case 76:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                case 83:
+                    if (length >= 8 && text[4] == 83 && text[5] == 73 && text[6] == 71 && text[7] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 67:
+                switch (length > 3 ? text[3] : 0) {
+                case 72:
+                    if (length >= 7 && text[4] == 69 && text[5] == 67 && text[6] == 75) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 85:
+                    if (length >= 9 && text[4] == 82 && text[5] == 83 && text[6] == 73 && text[7] == 86 && text[8] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 9;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 70:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 82:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 69:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 78:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 67:
+                                    switch (length > 8 ? text[8] : 0) {
+                                    case 69:
+                                        if (length >= 10 && text[9] == 83) {
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 10;
+                                        } else {
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 3;
+                                        }
+                                    case 73:
+                                        if (length >= 11 && text[9] == 78 && text[10] == 71) {
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 11;
+                                        } else {
+                                            *end_token = false;
+                                            *token = 7;
+                                            return 3;
+                                        }
+                                    default:
+                                        *end_token = false;
+                                        *token = 7;
+                                        return 3;
+                                    }
+                                default:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 3;
+                                }
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 3;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 3;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                case 82:
+                    if (length >= 7 && text[4] == 69 && text[5] == 83 && text[6] == 72) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 3;
+                }
+            case 73:
+                if (length >= 7 && text[3] == 78 && text[4] == 68 && text[5] == 69 && text[6] == 88) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 76:
+                switch (length > 3 ? text[3] : 0) {
+                case 65:
+                    if (length >= 8 && text[4] == 84 && text[5] == 73 && text[6] == 86 && text[7] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                case 69:
+                    if (length >= 7 && text[4] == 65 && text[5] == 83 && text[6] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 78:
+                if (length >= 6 && text[3] == 65 && text[4] == 77 && text[5] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 80:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    if (length >= 10 && text[4] == 65 && text[5] == 84 && text[6] == 65 && text[7] == 66 && text[8] == 76 && text[9] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 10;
+                    } else {
+                        return 0;
+                    }
+                case 76:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 65:
+                        if (length >= 7 && text[5] == 67 && text[6] == 69) {
+                            *end_token = false;
+                            *token = 7;
+                            return 7;
+                        } else {
+                            return 0;
+                        }
+                    case 73:
+                        if (length >= 7 && text[5] == 67 && text[6] == 65) {
+                            *end_token = false;
+                            *token = 7;
+                            return 7;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 83:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    if (length >= 5 && text[4] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                case 84:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 65:
+                        if (length >= 7 && text[5] == 82 && text[6] == 84) {
+                            *end_token = false;
+                            *token = 7;
+                            return 7;
+                        } else {
+                            return 0;
+                        }
+                    case 82:
+                        if (length >= 8 && text[5] == 73 && text[6] == 67 && text[7] == 84) {
+                            *end_token = false;
+                            *token = 7;
+                            return 8;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 85:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 82:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 78:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 73:
+                                if (length >= 9 && text[7] == 78 && text[8] == 71) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 9;
+                                } else {
+                                    return 0;
+                                }
+                            case 83:
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 86:
+                if (length >= 6 && text[3] == 79 && text[4] == 75 && text[5] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 73:
+            if (length >= 5 && text[2] == 71 && text[3] == 72 && text[4] == 84) {
+                *end_token = false;
+                *token = 7;
+                return 5;
+            } else {
+                return 0;
+            }
+        case 79:
+            switch (length > 2 ? text[2] : 0) {
+            case 76:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                case 76:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 66:
+                        if (length >= 8 && text[5] == 65 && text[6] == 67 && text[7] == 75) {
+                            *end_token = false;
+                            *token = 7;
+                            return 8;
+                        } else {
+                            return 0;
+                        }
+                    case 85:
+                        if (length >= 6 && text[5] == 80) {
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 85:
+                switch (length > 3 ? text[3] : 0) {
+                case 84:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 73:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 78:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 69:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 83:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 8;
+                                default:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 7;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 87:
+                switch (length > 3 ? text[3] : 0) {
+                case 83:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 3;
+                }
+            default:
+                return 0;
+            }
+        case 85:
+            if (length >= 4 && text[2] == 76 && text[3] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 4;
+            } else {
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 83:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            if (length >= 9 && text[2] == 86 && text[3] == 69 && text[4] == 80 && text[5] == 79 && text[6] == 73 && text[7] == 78 && text[8] == 84) {
+                *end_token = false;
+                *token = 7;
+                return 9;
+            } else {
+                return 0;
+            }
+        case 67:
+            switch (length > 2 ? text[2] : 0) {
+            case 72:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 77:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 65:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 83:
+                                *end_token = false;
+                                *token = 7;
+                                return 7;
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 6;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 82:
+                if (length >= 6 && text[3] == 79 && text[4] == 76 && text[5] == 76) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 69:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 6 && text[3] == 82 && text[4] == 67 && text[5] == 72) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 67:
+                switch (length > 3 ? text[3] : 0) {
+                case 79:
+                    if (length >= 6 && text[4] == 78 && text[5] == 68) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                case 85:
+                    if (length >= 8 && text[4] == 82 && text[5] == 73 && text[6] == 84 && text[7] == 89) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 76:
+                if (length >= 6 && text[3] == 69 && text[4] == 67 && text[5] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 81:
+                switch (length > 3 ? text[3] : 0) {
+                case 85:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 78:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 67:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 69:
+                                    switch (length > 8 ? text[8] : 0) {
+                                    case 83:
+                                        *end_token = false;
+                                        *token = 7;
+                                        return 9;
+                                    default:
+                                        *end_token = false;
+                                        *token = 7;
+                                        return 8;
+                                    }
+                                default:
+                                    return 0;
+                                }
+                            default:
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 82:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    if (length >= 12 && text[4] == 65 && text[5] == 76 && text[6] == 73 && text[7] == 90 && text[8] == 65 && text[9] == 66 && text[10] == 76 && text[11] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 12;
+                    } else {
+                        return 0;
+                    }
+                case 86:
+                    if (length >= 6 && text[4] == 69 && text[5] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 83:
+                if (length >= 7 && text[3] == 83 && text[4] == 73 && text[5] == 79 && text[6] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 79:
+                    if (length >= 5 && text[4] == 70) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        *end_token = false;
+                        *token = 7;
+                        return 3;
+                    }
+                case 83:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                default:
+                    *end_token = false;
+                    *token = 7;
+                    return 3;
+                }
+            default:
+                return 0;
+            }
+        case 72:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 5 && text[3] == 82 && text[4] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 79:
+                if (length >= 4 && text[3] == 87) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 73:
+            switch (length > 2 ? text[2] : 0) {
+            case 77:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    if (length >= 7 && text[4] == 76 && text[5] == 65 && text[6] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 80:
+                    if (length >= 6 && text[4] == 76 && text[5] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 75:
+            if (length >= 4 && text[2] == 73 && text[3] == 80) {
+                *end_token = false;
+                *token = 7;
+                return 4;
+            } else {
+                return 0;
+            }
+        case 77:
+            if (length >= 8 && text[2] == 65 && text[3] == 76 && text[4] == 76 && text[5] == 73 && text[6] == 78 && text[7] == 84) {
+                *end_token = false;
+                *token = 7;
+                return 8;
+            } else {
+                return 0;
+            }
+        case 78:
+            if (length >= 8 && text[2] == 65 && text[3] == 80 && text[4] == 83 && text[5] == 72 && text[6] == 79 && text[7] == 84) {
+                *end_token = false;
+                *token = 7;
+                return 8;
+            } else {
+                return 0;
+            }
+        case 79:
+            if (length >= 4 && text[2] == 77 && text[3] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 4;
+            } else {
+                return 0;
+            }
+        case 84:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                switch (length > 3 ? text[3] : 0) {
+                case 66:
+                    if (length >= 6 && text[4] == 76 && text[5] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                case 78:
+                    if (length >= 10 && text[4] == 68 && text[5] == 65 && text[6] == 76 && text[7] == 79 && text[8] == 78 && text[9] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 10;
+                    } else {
+                        return 0;
+                    }
+                case 82:
+                    if (length >= 5 && text[4] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                case 84:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        if (length >= 9 && text[5] == 77 && text[6] == 69 && text[7] == 78 && text[8] == 84) {
+                            *end_token = false;
+                            *token = 7;
+                            return 9;
+                        } else {
+                            return 0;
+                        }
+                    case 73:
+                        if (length >= 10 && text[5] == 83 && text[6] == 84 && text[7] == 73 && text[8] == 67 && text[9] == 83) {
+                            *end_token = false;
+                            *token = 7;
+                            return 10;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 68:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    if (length >= 5 && text[4] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                case 79:
+                    if (length >= 6 && text[4] == 85 && text[5] == 84) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 79:
+                switch (length > 3 ? text[3] : 0) {
+                case 82:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 65:
+                        if (length >= 7 && text[5] == 71 && text[6] == 69) {
+                            *end_token = false;
+                            *token = 7;
+                            return 7;
+                        } else {
+                            return 0;
+                        }
+                    case 69:
+                        if (length >= 6 && text[5] == 68) {
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 82:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 67:
+                        if (length >= 6 && text[5] == 84) {
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        } else {
+                            return 0;
+                        }
+                    case 80:
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 85:
+            switch (length > 2 ? text[2] : 0) {
+            case 66:
+                switch (length > 3 ? text[3] : 0) {
+                case 83:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 67:
+                        if (length >= 12 && text[5] == 82 && text[6] == 73 && text[7] == 80 && text[8] == 84 && text[9] == 73 && text[10] == 79 && text[11] == 78) {
+                            *end_token = false;
+                            *token = 7;
+                            return 12;
+                        } else {
+                            return 0;
+                        }
+                    case 84:
+                        if (length >= 9 && text[5] == 82 && text[6] == 73 && text[7] == 78 && text[8] == 71) {
+                            *end_token = false;
+                            *token = 7;
+                            return 9;
+                        } else {
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 80:
+                if (length >= 7 && text[3] == 80 && text[4] == 79 && text[5] == 82 && text[6] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 89:
+            switch (length > 2 ? text[2] : 0) {
+            case 77:
+                if (length >= 9 && text[3] == 77 && text[4] == 69 && text[5] == 84 && text[6] == 82 && text[7] == 73 && text[8] == 67) {
+                    *end_token = false;
+                    *token = 7;
+                    return 9;
+                } else {
+                    return 0;
+                }
+            case 83:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    if (length >= 5 && text[4] == 68) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                case 84:
+                    if (length >= 6 && text[4] == 69 && text[5] == 77) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 84:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 66:
+                switch (length > 3 ? text[3] : 0) {
+                case 76:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 83:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 65:
+                                if (length >= 11 && text[7] == 77 && text[8] == 80 && text[9] == 76 && text[10] == 69) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 11;
+                                } else {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 6;
+                                }
+                            case 80:
+                                if (length >= 10 && text[7] == 65 && text[8] == 67 && text[9] == 69) {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 10;
+                                } else {
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 6;
+                                }
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 6;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 5;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 69:
+            switch (length > 2 ? text[2] : 0) {
+            case 77:
+                switch (length > 3 ? text[3] : 0) {
+                case 80:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 76:
+                        if (length >= 8 && text[5] == 65 && text[6] == 84 && text[7] == 69) {
+                            *end_token = false;
+                            *token = 7;
+                            return 8;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    case 79:
+                        if (length >= 9 && text[5] == 82 && text[6] == 65 && text[7] == 82 && text[8] == 89) {
+                            *end_token = false;
+                            *token = 7;
+                            return 9;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            case 88:
+                if (length >= 4 && text[3] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 72:
+            if (length >= 4 && text[2] == 69 && text[3] == 78) {
+                *end_token = false;
+                *token = 7;
+                return 4;
+            } else {
+                return 0;
+            }
+        case 73:
+            switch (length > 2 ? text[2] : 0) {
+            case 69:
+                if (length >= 4 && text[3] == 83) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 77:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 83:
+                        if (length >= 9 && text[5] == 84 && text[6] == 65 && text[7] == 77 && text[8] == 80) {
+                            *end_token = false;
+                            *token = 7;
+                            return 9;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 79:
+            *end_token = false;
+            *token = 7;
+            return 2;
+        case 82:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    if (length >= 8 && text[4] == 76 && text[5] == 73 && text[6] == 78 && text[7] == 71) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                case 78:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 83:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 65:
+                            if (length >= 11 && text[6] == 67 && text[7] == 84 && text[8] == 73 && text[9] == 79 && text[10] == 78) {
+                                *end_token = false;
+                                *token = 7;
+                                return 11;
+                            } else {
+                                return 0;
+                            }
+                        case 70:
+                            if (length >= 9 && text[6] == 79 && text[7] == 82 && text[8] == 77) {
+                                *end_token = false;
+                                *token = 7;
+                                return 9;
+                            } else {
+                                return 0;
+                            }
+                        default:
+                            return 0;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 69:
+                if (length >= 5 && text[3] == 65 && text[4] == 84) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            case 73:
+                switch (length > 3 ? text[3] : 0) {
+                case 71:
+                    if (length >= 7 && text[4] == 71 && text[5] == 69 && text[6] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 77:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                default:
+                    return 0;
+                }
+            case 85:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                case 78:
+                    if (length >= 8 && text[4] == 67 && text[5] == 65 && text[6] == 84 && text[7] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                case 83:
+                    if (length >= 7 && text[4] == 84 && text[5] == 69 && text[6] == 68) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 89:
+            switch (length > 2 ? text[2] : 0) {
+            case 80:
+                switch (length > 3 ? text[3] : 0) {
+                case 69:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 83:
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 85:
+        switch (length > 1 ? text[1] : 0) {
+        case 78:
+            switch (length > 2 ? text[2] : 0) {
+            case 66:
+                if (length >= 9 && text[3] == 79 && text[4] == 85 && text[5] == 78 && text[6] == 68 && text[7] == 69 && text[8] == 68) {
+                    *end_token = false;
+                    *token = 7;
+                    return 9;
+                } else {
+                    return 0;
+                }
+            case 67:
+                if (length >= 11 && text[3] == 79 && text[4] == 77 && text[5] == 77 && text[6] == 73 && text[7] == 84 && text[8] == 84 && text[9] == 69 && text[10] == 68) {
+                    *end_token = false;
+                    *token = 7;
+                    return 11;
+                } else {
+                    return 0;
+                }
+            case 69:
+                if (length >= 11 && text[3] == 78 && text[4] == 67 && text[5] == 82 && text[6] == 89 && text[7] == 80 && text[8] == 84 && text[9] == 69 && text[10] == 68) {
+                    *end_token = false;
+                    *token = 7;
+                    return 11;
+                } else {
+                    return 0;
+                }
+            case 73:
+                switch (length > 3 ? text[3] : 0) {
+                case 79:
+                    if (length >= 5 && text[4] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                case 81:
+                    if (length >= 6 && text[4] == 85 && text[5] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 6;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 75:
+                if (length >= 7 && text[3] == 78 && text[4] == 79 && text[5] == 87 && text[6] == 78) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 76:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    if (length >= 8 && text[4] == 83 && text[5] == 84 && text[6] == 69 && text[7] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                case 79:
+                    if (length >= 8 && text[4] == 71 && text[5] == 71 && text[6] == 69 && text[7] == 68) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 84:
+                if (length >= 5 && text[3] == 73 && text[4] == 76) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 80:
+            if (length >= 6 && text[2] == 68 && text[3] == 65 && text[4] == 84 && text[5] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 6;
+            } else {
+                return 0;
+            }
+        case 83:
+            switch (length > 2 ? text[2] : 0) {
+            case 69:
+                if (length >= 4 && text[3] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 73:
+                if (length >= 5 && text[3] == 78 && text[4] == 71) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 86:
+        switch (length > 1 ? text[1] : 0) {
+        case 65:
+            switch (length > 2 ? text[2] : 0) {
+            case 67:
+                if (length >= 6 && text[3] == 85 && text[4] == 85 && text[5] == 77) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 76:
+                switch (length > 3 ? text[3] : 0) {
+                case 73:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 68:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 65:
+                            switch (length > 6 ? text[6] : 0) {
+                            case 84:
+                                switch (length > 7 ? text[7] : 0) {
+                                case 69:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 8;
+                                case 79:
+                                    if (length >= 9 && text[8] == 82) {
+                                        *end_token = false;
+                                        *token = 7;
+                                        return 9;
+                                    } else {
+                                        *end_token = false;
+                                        *token = 7;
+                                        return 5;
+                                    }
+                                default:
+                                    *end_token = false;
+                                    *token = 7;
+                                    return 5;
+                                }
+                            default:
+                                *end_token = false;
+                                *token = 7;
+                                return 5;
+                            }
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 5;
+                        }
+                    default:
+                        return 0;
+                    }
+                case 85:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 69:
+                        switch (length > 5 ? text[5] : 0) {
+                        case 83:
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        default:
+                            *end_token = false;
+                            *token = 7;
+                            return 5;
+                        }
+                    default:
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 82:
+                switch (length > 3 ? text[3] : 0) {
+                case 67:
+                    if (length >= 7 && text[4] == 72 && text[5] == 65 && text[6] == 82) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 73:
+                    if (length >= 8 && text[4] == 65 && text[5] == 68 && text[6] == 73 && text[7] == 67) {
+                        *end_token = false;
+                        *token = 7;
+                        return 8;
+                    } else {
+                        return 0;
+                    }
+                case 89:
+                    if (length >= 7 && text[4] == 73 && text[5] == 78 && text[6] == 71) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 69:
+            switch (length > 2 ? text[2] : 0) {
+            case 82:
+                switch (length > 3 ? text[3] : 0) {
+                case 66:
+                    if (length >= 7 && text[4] == 79 && text[5] == 83 && text[6] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                case 83:
+                    if (length >= 7 && text[4] == 73 && text[5] == 79 && text[6] == 78) {
+                        *end_token = false;
+                        *token = 7;
+                        return 7;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 73:
+            switch (length > 2 ? text[2] : 0) {
+            case 69:
+                switch (length > 3 ? text[3] : 0) {
+                case 87:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 83:
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 79:
+            if (length >= 8 && text[2] == 76 && text[3] == 65 && text[4] == 84 && text[5] == 73 && text[6] == 76 && text[7] == 69) {
+                *end_token = false;
+                *token = 7;
+                return 8;
+            } else {
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 87:
+        switch (length > 1 ? text[1] : 0) {
+        case 72:
+            switch (length > 2 ? text[2] : 0) {
+            case 69:
+                switch (length > 3 ? text[3] : 0) {
+                case 78:
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                case 82:
+                    if (length >= 5 && text[4] == 69) {
+                        *end_token = false;
+                        *token = 7;
+                        return 5;
+                    } else {
+                        return 0;
+                    }
+                default:
+                    return 0;
+                }
+            case 73:
+                if (length >= 10 && text[3] == 84 && text[4] == 69 && text[5] == 83 && text[6] == 80 && text[7] == 65 && text[8] == 67 && text[9] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 10;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 73:
+            switch (length > 2 ? text[2] : 0) {
+            case 78:
+                if (length >= 6 && text[3] == 68 && text[4] == 79 && text[5] == 87) {
+                    *end_token = false;
+                    *token = 7;
+                    return 6;
+                } else {
+                    return 0;
+                }
+            case 84:
+                switch (length > 3 ? text[3] : 0) {
+                case 72:
+                    switch (length > 4 ? text[4] : 0) {
+                    case 73:
+                        if (length >= 6 && text[5] == 78) {
+                            *end_token = false;
+                            *token = 7;
+                            return 6;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    case 79:
+                        if (length >= 7 && text[5] == 85 && text[6] == 84) {
+                            *end_token = false;
+                            *token = 7;
+                            return 7;
+                        } else {
+                            *end_token = false;
+                            *token = 7;
+                            return 4;
+                        }
+                    default:
+                        *end_token = false;
+                        *token = 7;
+                        return 4;
+                    }
+                default:
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        case 79:
+            if (length >= 4 && text[2] == 82 && text[3] == 75) {
+                *end_token = false;
+                *token = 7;
+                return 4;
+            } else {
+                return 0;
+            }
+        case 82:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 7 && text[3] == 80 && text[4] == 80 && text[5] == 69 && text[6] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 7;
+                } else {
+                    return 0;
+                }
+            case 73:
+                if (length >= 5 && text[3] == 84 && text[4] == 69) {
+                    *end_token = false;
+                    *token = 7;
+                    return 5;
+                } else {
+                    return 0;
+                }
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 88:
+        if (length >= 3 && text[1] == 77 && text[2] == 76) {
+            *end_token = false;
+            *token = 7;
+            return 3;
+        } else {
+            return 0;
+        }
+    case 89:
+        switch (length > 1 ? text[1] : 0) {
+        case 69:
+            switch (length > 2 ? text[2] : 0) {
+            case 65:
+                if (length >= 4 && text[3] == 82) {
+                    *end_token = false;
+                    *token = 7;
+                    return 4;
+                } else {
+                    return 0;
+                }
+            case 83:
+                *end_token = false;
+                *token = 7;
+                return 3;
+            default:
+                return 0;
+            }
+        default:
+            return 0;
+        }
+    case 90:
+        if (length >= 4 && text[1] == 79 && text[2] == 78 && text[3] == 69) {
+            *end_token = false;
+            *token = 7;
+            return 4;
+        } else {
+            return 0;
+        }
+    default:
+        return 0;
+    }
+}
+static uint32_t rule_lookup(uint32_t parent, uint32_t slot, void *context) {
+    switch (parent) {
+    case 0:
+        switch (slot) {
+        case 0: return 1;
+        default: break;
+        }
+        break;
+    case 1:
+        switch (slot) {
+        case 0: return 2;
+        default: break;
+        }
+        break;
+    case 2:
+        switch (slot) {
+        case 0: return 3;
+        case 1: return 4;
+        case 2: return 5;
+        case 3: return 6;
+        case 4: return 2;
+        default: break;
+        }
+        break;
+    default: break;
+    }
+    return UINT32_MAX;
+}
+static void fixity_associativity_precedence_lookup(int *fixity_associativity, int *precedence, uint32_t rule, uint32_t choice, void *context) {
+    switch (rule) {
+    default: return;
+    }
+}
+static size_t number_of_slots_lookup(uint32_t rule, void *context) {
+    switch (rule) {
+    case 0: return 1;
+    case 1: return 1;
+    case 2: return 5;
+    case 3: return 0;
+    case 4: return 0;
+    case 5: return 0;
+    case 6: return 0;
+    default: return 0;
+    }
+}
+static void left_right_operand_slots_lookup(uint32_t rule, uint32_t *left, uint32_t *right, uint32_t *operand, void *context) {
+    switch (rule) {
+    case 0:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 1:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 2:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 3:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 4:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 5:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    case 6:
+        *left = 4294967295U;
+        *right = 4294967295U;
+        *operand = 4294967295U;
+        break;
+    }
+}
+#endif
+
@@ -0,0 +1,123 @@
+#define OWL_PARSER_IMPLEMENTATION
+#include "parser.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_SIZE (64 * 1024 * 1024)
+#define ALIGNMENT 16
+
+struct arena {
+    char *memory;
+    size_t size;
+    size_t used;
+    // The most recent allocation, which can grow or shrink in place.
+    char *last;
+    size_t total_allocated;
+    size_t in_use;
+};
+
+static size_t align(size_t size)
+{
+    return (size + ALIGNMENT - 1) & ~(size_t)(ALIGNMENT - 1);
+}
+
+static void *arena_allocate(size_t size, void *info)
+{
+    struct arena *arena = info;
+    if (align(size) > arena->size - arena->used)
+        return NULL;
+    char *p = arena->memory + arena->used;
+    arena->used += align(size);
+    arena->last = p;
+    arena->total_allocated += size;
+    arena->in_use += size;
+    return p;
+}
+
+static void arena_deallocate(void *pointer, size_t size, void *info)
+{
+    struct arena *arena = info;
+    arena->in_use -= size;
+    // Only the most recent allocation can be given back.  Everything else
+    // stays put until the whole arena is freed.
+    if (pointer == arena->last) {
+        arena->used = (size_t)(arena->last - arena->memory);
+        arena->last = NULL;
+    }
+}
+
+static void *arena_reallocate(void *pointer, size_t old_size, size_t new_size,
+ void *info)
+{
+    struct arena *arena = info;
+    if (!pointer)
+        return arena_allocate(new_size, info);
+    if (pointer == arena->last) {
+        size_t start = (size_t)(arena->last - arena->memory);
+        if (align(new_size) > arena->size - start)
+            return NULL;
+        arena->used = start + align(new_size);
+        arena->total_allocated += new_size - old_size;
+        arena->in_use += new_size - old_size;
+        return pointer;
+    }
+    void *p = arena_allocate(new_size, info);
+    if (!p)
+        return NULL;
+    memcpy(p, pointer, old_size < new_size ? old_size : new_size);
+    arena->in_use -= old_size;
+    return p;
+}
+
+static size_t count_values(struct owl_ref ref)
+{
+    size_t count = 0;
+    for (struct owl_ref r = ref; !r.empty; r = owl_next(r)) {
+        struct parsed_value value = parsed_value_get(r);
+        count++;
+        switch (value.type) {
+        case PARSED_OBJECT:
+        case PARSED_ARRAY:
+            count += count_values(value.value);
+            break;
+        default:
+            break;
+        }
+    }
+    return count;
+}
+
+int main(void)
+{
+    struct arena arena = { .size = ARENA_SIZE };
+    arena.memory = malloc(arena.size);
+    if (!arena.memory)
+        return 1;
+    struct owl_tree *tree = owl_tree_create_with_options((struct owl_tree_options){
+        .file = stdin,
+        .allocate = arena_allocate,
+        .reallocate = arena_reallocate,
+        .deallocate = arena_deallocate,
+        .allocator_info = &arena,
+    });
+    struct source_range range;
+    if (!tree) {
+        fprintf(stderr, "couldn't read input\n");
+        free(arena.memory);
+        return 1;
+    }
+    if (owl_tree_get_error(tree, &range) != ERROR_NONE) {
+        fprintf(stderr, "parse error at %zu-%zu\n", range.start, range.end);
+        free(arena.memory);
+        return 1;
+    }
+    printf("%zu values\n", count_values(owl_tree_root_ref(tree)));
+    printf("%zu bytes allocated (%zu still in use when the parse finished)\n",
+     arena.total_allocated, arena.in_use);
+    // No need for owl_tree_destroy -- the tree lives entirely in the arena.
+    free(arena.memory);
+    return 0;
+}
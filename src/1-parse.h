@@ -5,6 +5,17 @@
 //
 //   #define OWL_PARSER_IMPLEMENTATION
 //   #include "parser.h"
+//
+// Some parts of the interface are only declared and compiled if you define
+// these before including this file (everywhere it's included):
+//
+//   OWL_PARSER_API  owl_parser_...() for streaming and reusing memory
+//   OWL_BATCH       owl_parse_batch()
+//   OWL_COMPACT     owl_tree_compact()
+//   OWL_INDEX       owl_tree_nodes_of_rule() and the other index queries
+//   OWL_BUILDER     owl_build(), for building your own nodes
+//
+// The grammar's 30 tokens fall into 30 token classes.
 
 #ifndef OWL_PARSER_H
 #define OWL_PARSER_H
@@ -27,20 +38,120 @@ struct owl_tree *owl_tree_create_from_string(const char *string);
 // Creates an owl_tree by reading from a file.
 struct owl_tree *owl_tree_create_from_file(FILE *file);
 
+// Creates an owl_tree from the file at `path`.  Where possible, the tree
+// references a memory mapping of the file instead of a copy.
+struct owl_tree *owl_tree_create_from_path(const char *path);
+
 // Explicitly create a tree with particular options.
 struct owl_tree_options {
     // Exactly one of string or file should be set.
     const char *string;
     FILE *file;
+    // The length of the string in bytes.  If this is set, the string doesn't
+    // need to be zero-terminated, and any zero bytes in it are invalid tokens.
+    size_t length;
+    // If set, `length` is used even if it's zero.  Otherwise, a `length` of zero
+    // means the string is zero-terminated.
+    bool has_length;
+    // If set, the tree keeps a list of the matches of each rule, which
+    // owl_tree_nodes_of_rule() returns.  This and index_locations only
+    // have an effect with OWL_INDEX defined.
+    bool index_rules;
+    // If set, the tree keeps an index of where each match is, which
+    // owl_tree_node_at() and owl_tree_nodes_in_range() search.
+    bool index_locations;
+    // If more than one, the input is checked against the grammar on up to this
+    // many threads.  This only has an effect if the implementation is compiled
+    // with OWL_THREADS defined.
+    unsigned threads;
+    // If set (and `threads` is at most one), the input is tokenized on a second
+    // thread while this one checks the tokens against the grammar.  This also
+    // only has an effect with OWL_THREADS defined.
+    bool pipeline;
+    // Functions for allocating and freeing memory.  Either all three or none of
+    // them should be set; if they aren't set, malloc, realloc, and free are used.
+    // The tree and everything allocated while building it come from these
+    // functions, and the tree keeps using them until it's destroyed.
+    void *(*allocate)(size_t size, void *info);
+    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);
+    void (*deallocate)(void *pointer, size_t size, void *info);
+    // This pointer will be passed into the allocation functions.
+    void *allocator_info;
 };
 struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options);
 
+// Creates a tree from the file at `path` like owl_tree_create_from_path(),
+// with the other options set.  The file and string options must be left unset.
+struct owl_tree *owl_tree_create_from_path_with_options(const char *path, struct owl_tree_options options);
+
+#ifdef OWL_BATCH
+// Parses `n` strings, setting out[i] to the tree for inputs[i].  If `lengths`
+// is set, lengths[i] is the length of inputs[i], even if it's zero; otherwise
+// every string must be zero-terminated.  If the implementation is
+// compiled with OWL_THREADS defined, up to `threads` strings are parsed at
+// once.  The trees are independent of each other: destroy each one with
+// owl_tree_destroy().
+void owl_parse_batch(const char **inputs, const size_t *lengths, size_t n, struct owl_tree **out, int threads);
+
+// Explicitly parse a batch with particular options, which apply to each string.
+// The string and file options must be left unset, and `threads` is how many
+// strings are parsed at once.
+void owl_parse_batch_with_options(struct owl_tree_options options, const char **inputs, const size_t *lengths, size_t n, struct owl_tree **out);
+#endif
+
+#ifdef OWL_PARSER_API
+// An owl_parser parses input which arrives in pieces.  Pass each piece to
+// owl_parser_feed() as it arrives, then call owl_parser_finish() to get
+// the tree.  Input is tokenized and checked as it's fed in; the tree itself is
+// built when parsing finishes.
+//
+// A parser can also parse many strings in a row with owl_parser_parse(),
+// reusing its memory instead of allocating it again for each one.
+struct owl_parser;
+
+// Creates an owl_parser.  The parser keeps its own copy of the input.
+struct owl_parser *owl_parser_create(void);
+
+// Explicitly create a parser with particular options.  The string and file
+// options must be left unset.
+struct owl_parser *owl_parser_create_with_options(struct owl_tree_options options);
+
+// Appends the next `length` bytes of input.  Returns false once the input is
+// known to contain an error; the tree returned by owl_parser_finish() will
+// report it.
+bool owl_parser_feed(struct owl_parser *parser, const char *chunk, size_t length);
+
+// Parses the rest of the input and returns the resulting tree.  The tree takes
+// ownership of the parser's copy of the input, and the parser is destroyed.
+struct owl_tree *owl_parser_finish(struct owl_parser *parser);
+
+// Parses a null-terminated string, reusing the memory from earlier parses.  The
+// tree belongs to the parser and references the string: keep both around until
+// the next call to owl_parser_parse(), owl_parser_reset(), or
+// owl_parser_destroy(), and don't pass the tree to owl_tree_destroy().
+struct owl_tree *owl_parser_parse(struct owl_parser *parser, const char *string);
+
+// Discards any input fed to the parser and any tree it returned, keeping its
+// memory for the next parse.
+void owl_parser_reset(struct owl_parser *parser);
+
+// Destroys an owl_parser without finishing it.
+void owl_parser_destroy(struct owl_parser *parser);
+#endif
+
 // Destroys an owl_tree, freeing its resources back to the system.
 void owl_tree_destroy(struct owl_tree *);
 
 // Prints a representation of the tree to standard output.
 void owl_tree_print(struct owl_tree *);
 
+#ifdef OWL_COMPACT
+// Rewrites a finished tree so each node is followed by its children, in source
+// order, and shrinks its memory to fit.  Walking the tree afterwards reads memory
+// front to back.  Any refs into the tree are invalidated.
+void owl_tree_compact(struct owl_tree *tree);
+#endif
+
 // An owl_ref references a list of children in the parse tree.  Use the
 // parsed_..._get() function corresponding to the element type to unpack the
 // child into its appropriate parsed_... struct.
@@ -78,6 +189,7 @@ enum owl_error {
 
     // The options passed to owl_tree_create_with_options weren't valid --
     // both file and string were specified at the same time or neither were.
+    // Also reported if either was passed to owl_parser_create_with_options.
     ERROR_INVALID_OPTIONS,
 
     // A piece of text couldn't be matched as a token.
@@ -94,6 +206,15 @@ enum owl_error {
 // The error_range parameter can be null.
 enum owl_error owl_tree_get_error(struct owl_tree *tree, struct source_range *error_range);
 
+// Checks whether a string matches the grammar without building a tree.  The
+// result (and error range) is the same as creating a tree would report, but
+// memory use depends only on how deeply the input is nested, not its length.
+// The string is `length` bytes long and doesn't need to be zero-terminated.
+enum owl_error owl_validate(const char *string, size_t length, struct source_range *error_range);
+
+// Explicitly validate input with particular options.
+enum owl_error owl_validate_with_options(struct owl_tree_options options, struct source_range *error_range);
+
 enum parsed_type {
     PARSED_EXACT = 1,
     PARSED_IDENT,
@@ -238,6 +359,92 @@ struct parsed_identifier parsed_identifier_get(struct owl_ref);
 struct parsed_string parsed_string_get(struct owl_ref);
 struct parsed_integer parsed_integer_get(struct owl_ref);
 
+// The rules of the grammar, as passed to owl_builder functions and
+// owl_tree_nodes_of_rule().
+enum owl_rule {
+    OWL_RULE_GRAMMAR = 0,
+    OWL_RULE_RULE = 1,
+    OWL_RULE_BODY = 2,
+    OWL_RULE_OPERATORS = 3,
+    OWL_RULE_FIXITY = 4,
+    OWL_RULE_ASSOC = 5,
+    OWL_RULE_OPERATOR = 6,
+    OWL_RULE_EXPR = 7,
+    OWL_RULE_REPETITION = 8,
+    OWL_RULE_COMMENT_TOKEN = 9,
+    OWL_RULE_COMMENT_TOKEN_V1 = 10,
+    OWL_RULE_CUSTOM_TOKEN = 11,
+    OWL_RULE_WHITESPACE = 12,
+    OWL_RULE_IDENTIFIER = 13,
+    OWL_RULE_STRING = 14,
+    OWL_RULE_INTEGER = 15,
+};
+
+#ifdef OWL_INDEX
+// Returns the matches of `rule` in source order, setting `count` to the number
+// of them.  The tree must have been created with the index_rules option;
+// otherwise there aren't any.  The array belongs to the tree, and
+// owl_tree_compact() updates it in place.
+const struct owl_ref *owl_tree_nodes_of_rule(struct owl_tree *tree, enum owl_rule rule, size_t *count);
+
+// Like owl_tree_nodes_of_rule(), but only returns matches of the named
+// option `type`.
+const struct owl_ref *owl_tree_nodes_of_option(struct owl_tree *tree, enum owl_rule rule, enum parsed_type type, size_t *count);
+
+// Returns the innermost match containing the byte at `location`, or an empty
+// ref if there isn't one.  The tree must have been created with the
+// index_locations option.
+struct owl_ref owl_tree_node_at(struct owl_tree *tree, size_t location);
+
+// Returns the matches which start in the range [start, end), setting `count` to
+// the number of them.  Matches are in source order, with each match before the
+// matches inside it.  The tree must have been created with the index_locations
+// option.  The array belongs to the tree.
+const struct owl_ref *owl_tree_nodes_in_range(struct owl_tree *tree, size_t start, size_t end, size_t *count);
+#endif
+
+// Returns the rule a ref matched.
+enum owl_rule owl_ref_rule(struct owl_ref ref);
+
+#ifdef OWL_BUILDER
+// A rule or token match, as passed to an owl_builder function.
+struct owl_match {
+    enum owl_rule rule;
+    struct source_range range;
+    // For rules with named options, the option which matched.
+    enum parsed_type type;
+    // The nodes built for each of the rule's fields, in the same order as the
+    // fields of its parsed_... struct.  Each one is the first node of a list
+    // linked by `next_sibling`, or null if the field is empty.
+    void **slots;
+    // Token data, as in the token's parsed_... struct.  The identifier and
+    // string pointers may only be valid until building finishes.
+    const char *identifier;
+    const char *string;
+    size_t length;
+    uint64_t integer;
+    double number;
+};
+struct owl_builder {
+    // Called once for each match, after the matches inside it.  `next_sibling` is
+    // the node built for the following match in the same field, if there is one.
+    // Returns the new node; returning null leaves the match out.
+    void *(*build)(const struct owl_match *match, void *next_sibling, void *info);
+    // This pointer will be passed into the build function.
+    void *info;
+};
+
+// Parses a string, building your own nodes with `builder` instead of creating
+// a tree.  Nodes are only built once the whole input has been checked, so
+// nothing is built if there's an error.  Otherwise, `root` is set to the node
+// built for the root match.  The string is `length` bytes long and doesn't
+// need to be zero-terminated.
+enum owl_error owl_build(const char *string, size_t length, struct owl_builder builder, void **root, struct source_range *error_range);
+
+// Explicitly build nodes with particular options.
+enum owl_error owl_build_with_options(struct owl_tree_options options, struct owl_builder builder, void **root, struct source_range *error_range);
+#endif
+
 #endif
 
 #ifdef OWL_PARSER_IMPLEMENTATION
@@ -247,21 +454,121 @@ struct parsed_integer parsed_integer_get(struct owl_ref);
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#if !defined(OWL_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define OWL_MMAP
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#ifdef OWL_THREADS
+#include <pthread.h>
+#endif
 #if defined(__clang__) || defined(__GNUC__)
 #define OWL_DONT_INLINE __attribute__((noinline))
 #else
 #define OWL_DONT_INLINE
 #endif
 
+// The allocation functions from owl_tree_options.
+struct owl_allocator {
+    void *(*allocate)(size_t size, void *info);
+    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);
+    void (*deallocate)(void *pointer, size_t size, void *info);
+    void *info;
+};
+static void *allocate_memory(size_t size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (a->allocate)
+        return a->allocate(size, a->info);
+    return malloc(size);
+}
+static void *reallocate_memory(void *pointer, size_t old_size, size_t new_size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (a->reallocate)
+        return a->reallocate(pointer, old_size, new_size, a->info);
+    return realloc(pointer, new_size);
+}
+static void free_memory(void *pointer, size_t size, void *allocator) {
+    struct owl_allocator *a = allocator;
+    if (!pointer)
+        return;
+    if (a->deallocate)
+        a->deallocate(pointer, size, a->info);
+    else
+        free(pointer);
+}
+
+#ifdef OWL_INDEX
+struct match_to_sort {
+    size_t start;
+    size_t end;
+    struct owl_ref ref;
+};
+// A list of matches, kept in source order.
+struct match_list {
+    struct owl_ref *matches;
+    // The start location of each match, for keeping the list in order.
+    size_t *starts;
+    // The end location of each match, if keeps_ends is set.
+    size_t *ends;
+    bool keeps_ends;
+    size_t count;
+    size_t capacity;
+    // Matches which arrived too far out of order to insert, which are merged
+    // into the list once the tree is finished.
+    struct match_to_sort *late;
+    size_t late_count;
+    size_t late_capacity;
+};
+// Matches for owl_tree_nodes_of_rule().  There's a list for each rule,
+// followed by a list for each named option of each rule.
+struct rule_index {
+    struct match_list lists[36];
+};
+// Every match, for owl_tree_node_at() and owl_tree_nodes_in_range().
+struct location_index {
+    struct match_list nodes;
+    // A complete binary tree with the end locations of the nodes as its leaves.
+    // Each branch holds the furthest end location of any leaf below it.  Leaf k
+    // is number k + number_of_leaves, so only the branches are stored here,
+    // starting from one.
+    size_t *furthest_ends;
+    size_t furthest_ends_capacity;
+    size_t number_of_leaves;
+};
+#endif
 struct owl_tree {
     const char *string;
-    bool owns_string;
+    // If nonzero, the tree owns the string, which is an allocation of this many
+    // bytes.
+    size_t owned_string_size;
+    // If nonzero, the string is a memory mapping of this many bytes.
+    size_t mapped_length;
+    struct owl_allocator allocator;
+    // If set, nodes are built with this instead of being written to parse_tree.
+    const struct owl_builder *builder;
     uint8_t *parse_tree;
     size_t parse_tree_size;
     size_t next_offset;
     enum owl_error error;
     struct source_range error_range;
     size_t root_offset;
+    // Set by owl_tree_compact(), after which links to siblings and children
+    // point forward instead of backward.
+    bool compacted;
+#ifdef OWL_INDEX
+    // Set if the tree was created with the index_rules option.
+    struct rule_index *rule_index;
+    // Set if the tree was created with the index_locations option.
+    struct location_index *location_index;
+#endif
+#ifdef OWL_THREADS
+    // Set on the copies of the tree which worker threads tokenize with.  Token
+    // data goes to the log instead of parse_tree, to be written in order later.
+    struct token_log *token_log;
+#endif
     size_t next_identifier_token_offset;
     size_t next_string_token_offset;
     size_t next_integer_token_offset;
@@ -291,7 +598,7 @@ static bool grow_tree(struct owl_tree *tree, size_t size)
     size_t n = tree->parse_tree_size;
     while (n < size || n < 4096)
         n = (n + 1) * 3 / 2;
-    uint8_t *parse_tree = realloc(tree->parse_tree, n);
+    uint8_t *parse_tree = reallocate_memory(tree->parse_tree, tree->parse_tree_size, n, &tree->allocator);
     if (!parse_tree)
         return false;
     tree->parse_tree_size = n;
@@ -309,6 +616,17 @@ static void write_tree(struct owl_tree *tree, uint64_t value)
     }
     tree->parse_tree[tree->next_offset++] = value & 0x7f;
 }
+static inline size_t follow_link(struct owl_tree *tree, size_t offset, size_t delta)
+{
+    return tree->compacted ? offset + delta : offset - delta;
+}
+// Offsets to children and token records are absolute while the tree is built,
+// and relative to the node once it's been compacted.
+static inline size_t read_child_offset(size_t *offset, struct owl_ref ref)
+{
+    size_t child = read_tree(offset, ref._tree);
+    return child && ref._tree->compacted ? ref._offset + child : child;
+}
 struct parsed_grammar parsed_grammar_get(struct owl_ref ref) {
     if (ref.empty || ref._type != 0) {
         return (struct parsed_grammar){
@@ -327,19 +645,19 @@ struct parsed_grammar parsed_grammar_get(struct owl_ref ref) {
         .range.end = end_location,
     };
     result.rule._tree = ref._tree;
-    result.rule._offset = read_tree(&offset, ref._tree);
+    result.rule._offset = read_child_offset(&offset, ref);
     result.rule._type = 1;
     result.rule.empty = result.rule._offset == 0;
     result.comment_token._tree = ref._tree;
-    result.comment_token._offset = read_tree(&offset, ref._tree);
+    result.comment_token._offset = read_child_offset(&offset, ref);
     result.comment_token._type = 9;
     result.comment_token.empty = result.comment_token._offset == 0;
     result.custom_token._tree = ref._tree;
-    result.custom_token._offset = read_tree(&offset, ref._tree);
+    result.custom_token._offset = read_child_offset(&offset, ref);
     result.custom_token._type = 11;
     result.custom_token.empty = result.custom_token._offset == 0;
     result.whitespace._tree = ref._tree;
-    result.whitespace._offset = read_tree(&offset, ref._tree);
+    result.whitespace._offset = read_child_offset(&offset, ref);
     result.whitespace._type = 12;
     result.whitespace.empty = result.whitespace._offset == 0;
     return result;
@@ -360,11 +678,11 @@ struct parsed_rule parsed_rule_get(struct owl_ref ref) {
         .range.end = end_location,
     };
     result.identifier._tree = ref._tree;
-    result.identifier._offset = read_tree(&offset, ref._tree);
+    result.identifier._offset = read_child_offset(&offset, ref);
     result.identifier._type = 13;
     result.identifier.empty = result.identifier._offset == 0;
     result.body._tree = ref._tree;
-    result.body._offset = read_tree(&offset, ref._tree);
+    result.body._offset = read_child_offset(&offset, ref);
     result.body._type = 2;
     result.body.empty = result.body._offset == 0;
     return result;
@@ -386,15 +704,15 @@ struct parsed_body parsed_body_get(struct owl_ref ref) {
         .range.end = end_location,
     };
     result.expr._tree = ref._tree;
-    result.expr._offset = read_tree(&offset, ref._tree);
+    result.expr._offset = read_child_offset(&offset, ref);
     result.expr._type = 7;
     result.expr.empty = result.expr._offset == 0;
     result.identifier._tree = ref._tree;
-    result.identifier._offset = read_tree(&offset, ref._tree);
+    result.identifier._offset = read_child_offset(&offset, ref);
     result.identifier._type = 13;
     result.identifier.empty = result.identifier._offset == 0;
     result.operators._tree = ref._tree;
-    result.operators._offset = read_tree(&offset, ref._tree);
+    result.operators._offset = read_child_offset(&offset, ref);
     result.operators._type = 3;
     result.operators.empty = result.operators._offset == 0;
     return result;
@@ -415,11 +733,11 @@ struct parsed_operators parsed_operators_get(struct owl_ref ref) {
         .range.end = end_location,
     };
     result.fixity._tree = ref._tree;
-    result.fixity._offset = read_tree(&offset, ref._tree);
+    result.fixity._offset = read_child_offset(&offset, ref);
     result.fixity._type = 4;
     result.fixity.empty = result.fixity._offset == 0;
     result.operator._tree = ref._tree;
-    result.operator._offset = read_tree(&offset, ref._tree);
+    result.operator._offset = read_child_offset(&offset, ref);
     result.operator._type = 6;
     result.operator.empty = result.operator._offset == 0;
     return result;
@@ -440,7 +758,7 @@ struct parsed_fixity parsed_fixity_get(struct owl_ref ref) {
         .type = (enum parsed_type)read_tree(&offset, ref._tree),
     };
     result.assoc._tree = ref._tree;
-    result.assoc._offset = read_tree(&offset, ref._tree);
+    result.assoc._offset = read_child_offset(&offset, ref);
     result.assoc._type = 5;
     result.assoc.empty = result.assoc._offset == 0;
     return result;
@@ -478,11 +796,11 @@ struct parsed_operator parsed_operator_get(struct owl_ref ref) {
         .range.end = end_location,
     };
     result.expr._tree = ref._tree;
-    result.expr._offset = read_tree(&offset, ref._tree);
+    result.expr._offset = read_child_offset(&offset, ref);
     result.expr._type = 7;
     result.expr.empty = result.expr._offset == 0;
     result.identifier._tree = ref._tree;
-    result.identifier._offset = read_tree(&offset, ref._tree);
+    result.identifier._offset = read_child_offset(&offset, ref);
     result.identifier._type = 13;
     result.identifier.empty = result.identifier._offset == 0;
     return result;
@@ -511,39 +829,39 @@ struct parsed_expr parsed_expr_get(struct owl_ref ref) {
         .type = (enum parsed_type)read_tree(&offset, ref._tree),
     };
     result.identifier._tree = ref._tree;
-    result.identifier._offset = read_tree(&offset, ref._tree);
+    result.identifier._offset = read_child_offset(&offset, ref);
     result.identifier._type = 13;
     result.identifier.empty = result.identifier._offset == 0;
     result.exception._tree = ref._tree;
-    result.exception._offset = read_tree(&offset, ref._tree);
+    result.exception._offset = read_child_offset(&offset, ref);
     result.exception._type = 13;
     result.exception.empty = result.exception._offset == 0;
     result.rename._tree = ref._tree;
-    result.rename._offset = read_tree(&offset, ref._tree);
+    result.rename._offset = read_child_offset(&offset, ref);
     result.rename._type = 13;
     result.rename.empty = result.rename._offset == 0;
     result.string._tree = ref._tree;
-    result.string._offset = read_tree(&offset, ref._tree);
+    result.string._offset = read_child_offset(&offset, ref);
     result.string._type = 14;
     result.string.empty = result.string._offset == 0;
     result.expr._tree = ref._tree;
-    result.expr._offset = read_tree(&offset, ref._tree);
+    result.expr._offset = read_child_offset(&offset, ref);
     result.expr._type = 7;
     result.expr.empty = result.expr._offset == 0;
     result.begin_token._tree = ref._tree;
-    result.begin_token._offset = read_tree(&offset, ref._tree);
+    result.begin_token._offset = read_child_offset(&offset, ref);
     result.begin_token._type = 14;
     result.begin_token.empty = result.begin_token._offset == 0;
     result.end_token._tree = ref._tree;
-    result.end_token._offset = read_tree(&offset, ref._tree);
+    result.end_token._offset = read_child_offset(&offset, ref);
     result.end_token._type = 14;
     result.end_token.empty = result.end_token._offset == 0;
     result.repetition._tree = ref._tree;
-    result.repetition._offset = read_tree(&offset, ref._tree);
+    result.repetition._offset = read_child_offset(&offset, ref);
     result.repetition._type = 8;
     result.repetition.empty = result.repetition._offset == 0;
     result.operand._tree = ref._tree;
-    result.operand._offset = read_tree(&offset, ref._tree);
+    result.operand._offset = read_child_offset(&offset, ref);
     result.operand._type = 7;
     result.operand.empty = result.operand._offset == 0;
     return result;
@@ -565,11 +883,11 @@ struct parsed_repetition parsed_repetition_get(struct owl_ref ref) {
         .type = (enum parsed_type)read_tree(&offset, ref._tree),
     };
     result.begin._tree = ref._tree;
-    result.begin._offset = read_tree(&offset, ref._tree);
+    result.begin._offset = read_child_offset(&offset, ref);
     result.begin._type = 15;
     result.begin.empty = result.begin._offset == 0;
     result.end._tree = ref._tree;
-    result.end._offset = read_tree(&offset, ref._tree);
+    result.end._offset = read_child_offset(&offset, ref);
     result.end._type = 15;
     result.end.empty = result.end._offset == 0;
     return result;
@@ -590,11 +908,11 @@ struct parsed_comment_token parsed_comment_token_get(struct owl_ref ref) {
         .range.end = end_location,
     };
     result.string._tree = ref._tree;
-    result.string._offset = read_tree(&offset, ref._tree);
+    result.string._offset = read_child_offset(&offset, ref);
     result.string._type = 14;
     result.string.empty = result.string._offset == 0;
     result.comment_token_v1._tree = ref._tree;
-    result.comment_token_v1._offset = read_tree(&offset, ref._tree);
+    result.comment_token_v1._offset = read_child_offset(&offset, ref);
     result.comment_token_v1._type = 10;
     result.comment_token_v1.empty = result.comment_token_v1._offset == 0;
     return result;
@@ -614,7 +932,7 @@ struct parsed_comment_token_v1 parsed_comment_token_v1_get(struct owl_ref ref) {
         .range.end = end_location,
     };
     result.string._tree = ref._tree;
-    result.string._offset = read_tree(&offset, ref._tree);
+    result.string._offset = read_child_offset(&offset, ref);
     result.string._type = 14;
     result.string.empty = result.string._offset == 0;
     return result;
@@ -635,11 +953,11 @@ struct parsed_custom_token parsed_custom_token_get(struct owl_ref ref) {
         .range.end = end_location,
     };
     result.identifier._tree = ref._tree;
-    result.identifier._offset = read_tree(&offset, ref._tree);
+    result.identifier._offset = read_child_offset(&offset, ref);
     result.identifier._type = 13;
     result.identifier.empty = result.identifier._offset == 0;
     result.string._tree = ref._tree;
-    result.string._offset = read_tree(&offset, ref._tree);
+    result.string._offset = read_child_offset(&offset, ref);
     result.string._type = 14;
     result.string.empty = result.string._offset == 0;
     return result;
@@ -659,7 +977,7 @@ struct parsed_whitespace parsed_whitespace_get(struct owl_ref ref) {
         .range.end = end_location,
     };
     result.string._tree = ref._tree;
-    result.string._offset = read_tree(&offset, ref._tree);
+    result.string._offset = read_child_offset(&offset, ref);
     result.string._type = 14;
     result.string.empty = result.string._offset == 0;
     return result;
@@ -672,7 +990,7 @@ struct parsed_identifier parsed_identifier_get(struct owl_ref ref) {
     }
     size_t offset = ref._offset;
     read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
-    size_t token_offset = read_tree(&offset, ref._tree);
+    size_t token_offset = read_child_offset(&offset, ref);
     read_tree(&token_offset, ref._tree);
     size_t start_location = read_tree(&token_offset, ref._tree);
     size_t end_location = start_location + read_tree(&token_offset, ref._tree);
@@ -692,7 +1010,7 @@ struct parsed_string parsed_string_get(struct owl_ref ref) {
     }
     size_t offset = ref._offset;
     read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
-    size_t token_offset = read_tree(&offset, ref._tree);
+    size_t token_offset = read_child_offset(&offset, ref);
     read_tree(&token_offset, ref._tree);
     size_t start_location = read_tree(&token_offset, ref._tree);
     size_t end_location = start_location + read_tree(&token_offset, ref._tree);
@@ -717,7 +1035,7 @@ struct parsed_integer parsed_integer_get(struct owl_ref ref) {
     }
     size_t offset = ref._offset;
     read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.
-    size_t token_offset = read_tree(&offset, ref._tree);
+    size_t token_offset = read_child_offset(&offset, ref);
     read_tree(&token_offset, ref._tree);
     size_t start_location = read_tree(&token_offset, ref._tree);
     size_t end_location = start_location + read_tree(&token_offset, ref._tree);
@@ -728,9 +1046,477 @@ struct parsed_integer parsed_integer_get(struct owl_ref ref) {
     };
     return result;
 }
+static size_t number_of_slots_lookup(uint32_t rule, void *context);
+#ifdef OWL_BUILDER
+static size_t build_node(uint32_t rule, uint32_t choice, size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, struct owl_tree *tree) {
+    void *children[10];
+    size_t number_of_slots = number_of_slots_lookup(rule, tree);
+    for (size_t i = 0; i < number_of_slots; ++i)
+        children[i] = (void *)(uintptr_t)slots[i];
+    struct owl_match match = {
+        .rule = (enum owl_rule)rule,
+        .range = { start_location, end_location },
+        .slots = children,
+    };
+    switch (rule) {
+    case 4:
+        switch (choice) {
+        case 0:
+            match.type = PARSED_POSTFIX_OP;
+            break;
+        case 1:
+            match.type = PARSED_PREFIX_OP;
+            break;
+        case 2:
+            match.type = PARSED_INFIX_OP;
+            break;
+        }
+        break;
+    case 5:
+        switch (choice) {
+        case 0:
+            match.type = PARSED_FLAT_OP;
+            break;
+        case 1:
+            match.type = PARSED_LEFT_OP;
+            break;
+        case 2:
+            match.type = PARSED_RIGHT_OP;
+            break;
+        case 3:
+            match.type = PARSED_NONASSOC_OP;
+            break;
+        }
+        break;
+    case 7:
+        switch (choice) {
+        case 0:
+            match.type = PARSED_IDENT;
+            break;
+        case 1:
+            match.type = PARSED_LITERAL;
+            break;
+        case 2:
+            match.type = PARSED_PARENS;
+            break;
+        case 3:
+            match.type = PARSED_BRACKETED;
+            break;
+        case 4:
+            match.type = PARSED_ZERO_OR_MORE;
+            break;
+        case 5:
+            match.type = PARSED_ONE_OR_MORE;
+            break;
+        case 6:
+            match.type = PARSED_OPTIONAL;
+            break;
+        case 7:
+            match.type = PARSED_REPETITION;
+            break;
+        case 8:
+            match.type = PARSED_CONCATENATION;
+            break;
+        case 9:
+            match.type = PARSED_CHOICE;
+            break;
+        }
+        break;
+    case 8:
+        switch (choice) {
+        case 0:
+            match.type = PARSED_EXACT;
+            break;
+        case 1:
+            match.type = PARSED_AT_LEAST;
+            break;
+        case 2:
+            match.type = PARSED_RANGE;
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);
+}
+static size_t build_token(uint32_t rule, size_t next_sibling, struct owl_tree *tree) {
+    struct owl_match match = { .rule = (enum owl_rule)rule };
+    switch (rule) {
+    case 13: {
+        size_t offset = tree->next_identifier_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_identifier_token_offset -= read_tree(&offset, tree);
+        match.range.start = read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        match.identifier = tree->string + match.range.start;
+        match.length = match.range.end - match.range.start;
+        break;
+    }
+    case 14: {
+        size_t offset = tree->next_string_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_string_token_offset -= read_tree(&offset, tree);
+        match.range.start = read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        size_t string_offset = read_tree(&offset, tree);
+        if (string_offset) {
+            match.string = (const char *)tree->parse_tree + string_offset;
+            match.length = read_tree(&offset, tree);
+        } else {
+            match.string = tree->string + match.range.start + 1;
+            match.length = match.range.end - match.range.start - 2;
+        }
+        break;
+    }
+    case 15: {
+        size_t offset = tree->next_integer_token_offset;
+        if (offset == 0)
+            abort();
+        tree->next_integer_token_offset -= read_tree(&offset, tree);
+        match.range.start = read_tree(&offset, tree);
+        match.range.end = match.range.start + read_tree(&offset, tree);
+        match.integer = read_tree(&offset, tree);
+        break;
+    }
+    default:
+        break;
+    }
+    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);
+}
+#endif
+#ifdef OWL_INDEX
+static void grow_match_list(struct owl_tree *tree, struct match_list *list, size_t capacity)
+{
+    size_t n = list->capacity;
+    struct owl_ref *matches = reallocate_memory(list->matches,
+     n * sizeof(struct owl_ref), capacity * sizeof(struct owl_ref), &tree->allocator);
+    if (!matches)
+        abort();
+    list->matches = matches;
+    size_t *starts = reallocate_memory(list->starts,
+     n * sizeof(size_t), capacity * sizeof(size_t), &tree->allocator);
+    if (!starts)
+        abort();
+    list->starts = starts;
+    if (list->keeps_ends) {
+        size_t *ends = reallocate_memory(list->ends,
+         n * sizeof(size_t), capacity * sizeof(size_t), &tree->allocator);
+        if (!ends)
+            abort();
+        list->ends = ends;
+    }
+    list->capacity = capacity;
+}
+// Matches are added in the order they're written to the tree: from the end of
+// the input to the start while it's built, and from the start to the end while
+// it's compacted.  Operators finish their operands a little out of order, so
+// each match is moved back past any later ones, up to this many places.
+// Matches which are further out of place are set aside until the tree is
+// finished.
+#define MATCH_LIST_SHIFT_LIMIT 16
+static void add_to_match_list(struct owl_tree *tree, struct match_list *list, struct owl_ref ref, size_t start_location, size_t end_location)
+{
+    size_t n = list->count;
+    if (n == list->capacity)
+        grow_match_list(tree, list, n * 2 + 16);
+    struct owl_ref *matches = list->matches;
+    size_t *starts = list->starts;
+    size_t i = n;
+    while (i > 0 &&
+     (tree->compacted ? starts[i - 1] > start_location : starts[i - 1] < start_location)) {
+        if (n - i == MATCH_LIST_SHIFT_LIMIT) {
+            if (list->late_count == list->late_capacity) {
+                size_t capacity = list->late_capacity * 2 + 16;
+                struct match_to_sort *late = reallocate_memory(list->late,
+                 list->late_capacity * sizeof(struct match_to_sort),
+                 capacity * sizeof(struct match_to_sort), &tree->allocator);
+                if (!late)
+                    abort();
+                list->late = late;
+                list->late_capacity = capacity;
+            }
+            list->late[list->late_count++] = (struct match_to_sort){
+                .start = start_location,
+                .end = end_location,
+                .ref = ref,
+            };
+            return;
+        }
+        i--;
+    }
+    memmove(matches + i + 1, matches + i, (n - i) * sizeof(struct owl_ref));
+    memmove(starts + i + 1, starts + i, (n - i) * sizeof(size_t));
+    matches[i] = ref;
+    starts[i] = start_location;
+    if (list->keeps_ends) {
+        memmove(list->ends + i + 1, list->ends + i, (n - i) * sizeof(size_t));
+        list->ends[i] = end_location;
+    }
+    list->count = n + 1;
+}
+// Returns the list of matches for a named option of a rule, or zero if the
+// rule doesn't have that option.
+static uint32_t option_list(uint32_t rule, uint32_t type)
+{
+    switch (rule) {
+    case 4:
+        switch (type) {
+        case PARSED_POSTFIX_OP:
+            return 16;
+        case PARSED_PREFIX_OP:
+            return 17;
+        case PARSED_INFIX_OP:
+            return 18;
+        }
+        break;
+    case 5:
+        switch (type) {
+        case PARSED_FLAT_OP:
+            return 19;
+        case PARSED_LEFT_OP:
+            return 20;
+        case PARSED_RIGHT_OP:
+            return 21;
+        case PARSED_NONASSOC_OP:
+            return 22;
+        }
+        break;
+    case 7:
+        switch (type) {
+        case PARSED_IDENT:
+            return 23;
+        case PARSED_LITERAL:
+            return 24;
+        case PARSED_PARENS:
+            return 25;
+        case PARSED_BRACKETED:
+            return 26;
+        case PARSED_ZERO_OR_MORE:
+            return 27;
+        case PARSED_ONE_OR_MORE:
+            return 28;
+        case PARSED_OPTIONAL:
+            return 29;
+        case PARSED_REPETITION:
+            return 30;
+        case PARSED_CONCATENATION:
+            return 31;
+        case PARSED_CHOICE:
+            return 32;
+        }
+        break;
+    case 8:
+        switch (type) {
+        case PARSED_EXACT:
+            return 33;
+        case PARSED_AT_LEAST:
+            return 34;
+        case PARSED_RANGE:
+            return 35;
+        }
+        break;
+    default:
+        break;
+    }
+    return 0;
+}
+static void index_match(struct owl_tree *tree, uint32_t rule, uint32_t type, size_t offset, size_t start_location, size_t end_location)
+{
+    struct owl_ref ref = {
+        ._tree = tree,
+        ._offset = offset,
+        ._type = rule,
+    };
+    if (tree->rule_index) {
+        add_to_match_list(tree, &tree->rule_index->lists[rule], ref, start_location, end_location);
+        uint32_t list = option_list(rule, type);
+        if (list)
+            add_to_match_list(tree, &tree->rule_index->lists[list], ref, start_location, end_location);
+    }
+    if (tree->location_index)
+        add_to_match_list(tree, &tree->location_index->nodes, ref, start_location, end_location);
+}
+// Matches that start at the same place are nested, so the outer one comes
+// first.  It's written after the inner one while the tree is built, and before
+// it while the tree is compacted.
+static inline bool match_precedes(const struct match_to_sort *a, const struct match_to_sort *b)
+{
+    if (a->start != b->start)
+        return a->start < b->start;
+    return (a->ref._offset < b->ref._offset) == a->ref._tree->compacted;
+}
+// Sorts matches by merging the runs which are already in order.  A long chain
+// of operators can finish its operands in the opposite order to everything
+// else, so runs in reverse order are turned around first.
+static void sort_matches(struct owl_tree *tree, struct match_to_sort *matches, size_t n)
+{
+    size_t size = n * sizeof(struct match_to_sort);
+    struct match_to_sort *sorting = matches;
+    struct match_to_sort *merged = allocate_memory(size, &tree->allocator);
+    size_t *run_ends = allocate_memory(n * sizeof(size_t), &tree->allocator);
+    if (!merged || !run_ends)
+        abort();
+    size_t number_of_runs = 0;
+    for (size_t i = 0; i < n; ) {
+        size_t j = i + 1;
+        if (j < n && match_precedes(&sorting[j], &sorting[i])) {
+            while (j < n && match_precedes(&sorting[j], &sorting[j - 1]))
+                j++;
+            for (size_t a = i, b = j - 1; a < b; ++a, --b) {
+                struct match_to_sort match = sorting[a];
+                sorting[a] = sorting[b];
+                sorting[b] = match;
+            }
+        } else {
+            while (j < n && match_precedes(&sorting[j - 1], &sorting[j]))
+                j++;
+        }
+        run_ends[number_of_runs++] = j;
+        i = j;
+    }
+    while (number_of_runs > 1) {
+        size_t runs = 0;
+        size_t start = 0;
+        for (size_t r = 0; r < number_of_runs; r += 2) {
+            size_t middle = run_ends[r];
+            size_t end = r + 1 < number_of_runs ? run_ends[r + 1] : middle;
+            size_t a = start;
+            size_t b = middle;
+            size_t k = start;
+            while (a < middle && b < end)
+                merged[k++] = match_precedes(&sorting[b], &sorting[a]) ? sorting[b++] : sorting[a++];
+            memcpy(merged + k, sorting + a, (middle - a) * sizeof(struct match_to_sort));
+            k += middle - a;
+            memcpy(merged + k, sorting + b, (end - b) * sizeof(struct match_to_sort));
+            run_ends[runs++] = end;
+            start = end;
+        }
+        struct match_to_sort *swap = sorting;
+        sorting = merged;
+        merged = swap;
+        number_of_runs = runs;
+    }
+    if (sorting != matches) {
+        memcpy(matches, sorting, size);
+        merged = sorting;
+    }
+    free_memory(merged, size, &tree->allocator);
+    free_memory(run_ends, n * sizeof(size_t), &tree->allocator);
+}
+// Puts a list of matches in source order once the tree is finished.
+static void finish_match_list(struct owl_tree *tree, struct match_list *list)
+{
+    size_t n = list->count;
+    if (!tree->compacted) {
+        for (size_t j = 0; j < n / 2; ++j) {
+            struct owl_ref match = list->matches[j];
+            list->matches[j] = list->matches[n - 1 - j];
+            list->matches[n - 1 - j] = match;
+            size_t start = list->starts[j];
+            list->starts[j] = list->starts[n - 1 - j];
+            list->starts[n - 1 - j] = start;
+            if (list->keeps_ends) {
+                size_t end = list->ends[j];
+                list->ends[j] = list->ends[n - 1 - j];
+                list->ends[n - 1 - j] = end;
+            }
+        }
+    }
+    size_t number_of_late = list->late_count;
+    if (number_of_late == 0)
+        return;
+    sort_matches(tree, list->late, number_of_late);
+    if (n + number_of_late > list->capacity)
+        grow_match_list(tree, list, n + number_of_late);
+    // Merge the late matches in from the back, so nothing is overwritten
+    // before it's moved.
+    size_t i = n;
+    size_t j = number_of_late;
+    while (j > 0) {
+        size_t k = i + j - 1;
+        struct match_to_sort match = list->late[j - 1];
+        if (i > 0) {
+            struct match_to_sort last = {
+                .start = list->starts[i - 1],
+                .end = list->keeps_ends ? list->ends[i - 1] : 0,
+                .ref = list->matches[i - 1],
+            };
+            if (match_precedes(&match, &last)) {
+                match = last;
+                i--;
+            } else
+                j--;
+        } else
+            j--;
+        list->matches[k] = match.ref;
+        list->starts[k] = match.start;
+        if (list->keeps_ends)
+            list->ends[k] = match.end;
+    }
+    list->count = n + number_of_late;
+    list->late_count = 0;
+}
+static size_t furthest_end(const struct location_index *index, size_t k)
+{
+    if (k < index->number_of_leaves)
+        return index->furthest_ends[k];
+    k -= index->number_of_leaves;
+    return k < index->nodes.count ? index->nodes.ends[k] : 0;
+}
+static void finish_indexes(struct owl_tree *tree)
+{
+    if (tree->rule_index) {
+        for (uint32_t i = 0; i < 36; ++i)
+            finish_match_list(tree, &tree->rule_index->lists[i]);
+    }
+    struct location_index *index = tree->location_index;
+    if (!index)
+        return;
+    finish_match_list(tree, &index->nodes);
+    size_t leaves = 1;
+    while (leaves < index->nodes.count)
+        leaves *= 2;
+    if (leaves > index->furthest_ends_capacity) {
+        size_t *furthest_ends = reallocate_memory(index->furthest_ends,
+         index->furthest_ends_capacity * sizeof(size_t), leaves * sizeof(size_t), &tree->allocator);
+        if (!furthest_ends)
+            abort();
+        index->furthest_ends = furthest_ends;
+        index->furthest_ends_capacity = leaves;
+    }
+    index->number_of_leaves = leaves;
+    for (size_t k = leaves - 1; k > 0; --k) {
+        size_t left = furthest_end(index, 2 * k);
+        size_t right = furthest_end(index, 2 * k + 1);
+        index->furthest_ends[k] = left > right ? left : right;
+    }
+}
+// Empties the indexes before a tree is rebuilt, keeping their memory.
+static void clear_indexes(struct owl_tree *tree)
+{
+    if (tree->rule_index) {
+        for (uint32_t i = 0; i < 36; ++i) {
+            tree->rule_index->lists[i].count = 0;
+            tree->rule_index->lists[i].late_count = 0;
+        }
+    }
+    if (tree->location_index) {
+        tree->location_index->nodes.count = 0;
+        tree->location_index->nodes.late_count = 0;
+    }
+}
+#endif
 static size_t finish_node(uint32_t rule, uint32_t choice, size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, void *info) {
     struct owl_tree *tree = info;
+#ifdef OWL_BUILDER
+    if (tree->builder)
+        return build_node(rule, choice, next_sibling, slots, start_location, end_location, tree);
+#endif
     size_t offset = tree->next_offset;
+    uint32_t type = 0;
     write_tree(tree, next_sibling ? offset - next_sibling : 0);
     write_tree(tree, start_location);
     write_tree(tree, end_location - start_location);
@@ -761,33 +1547,35 @@ static size_t finish_node(uint32_t rule, uint32_t choice, size_t next_sibling, s
     case 4: {
         switch (choice) {
         case 0:
-            write_tree(tree, PARSED_POSTFIX_OP);
+            type = PARSED_POSTFIX_OP;
             break;
         case 1:
-            write_tree(tree, PARSED_PREFIX_OP);
+            type = PARSED_PREFIX_OP;
             break;
         case 2:
-            write_tree(tree, PARSED_INFIX_OP);
+            type = PARSED_INFIX_OP;
             break;
         }
+        write_tree(tree, type);
         write_tree(tree, slots[0]);
         break;
     }
     case 5: {
         switch (choice) {
         case 0:
-            write_tree(tree, PARSED_FLAT_OP);
+            type = PARSED_FLAT_OP;
             break;
         case 1:
-            write_tree(tree, PARSED_LEFT_OP);
+            type = PARSED_LEFT_OP;
             break;
         case 2:
-            write_tree(tree, PARSED_RIGHT_OP);
+            type = PARSED_RIGHT_OP;
             break;
         case 3:
-            write_tree(tree, PARSED_NONASSOC_OP);
+            type = PARSED_NONASSOC_OP;
             break;
         }
+        write_tree(tree, type);
         break;
     }
     case 6: {
@@ -798,36 +1586,37 @@ static size_t finish_node(uint32_t rule, uint32_t choice, size_t next_sibling, s
     case 7: {
         switch (choice) {
         case 0:
-            write_tree(tree, PARSED_IDENT);
+            type = PARSED_IDENT;
             break;
         case 1:
-            write_tree(tree, PARSED_LITERAL);
+            type = PARSED_LITERAL;
             break;
         case 2:
-            write_tree(tree, PARSED_PARENS);
+            type = PARSED_PARENS;
             break;
         case 3:
-            write_tree(tree, PARSED_BRACKETED);
+            type = PARSED_BRACKETED;
             break;
         case 4:
-            write_tree(tree, PARSED_ZERO_OR_MORE);
+            type = PARSED_ZERO_OR_MORE;
             break;
         case 5:
-            write_tree(tree, PARSED_ONE_OR_MORE);
+            type = PARSED_ONE_OR_MORE;
             break;
         case 6:
-            write_tree(tree, PARSED_OPTIONAL);
+            type = PARSED_OPTIONAL;
             break;
         case 7:
-            write_tree(tree, PARSED_REPETITION);
+            type = PARSED_REPETITION;
             break;
         case 8:
-            write_tree(tree, PARSED_CONCATENATION);
+            type = PARSED_CONCATENATION;
             break;
         case 9:
-            write_tree(tree, PARSED_CHOICE);
+            type = PARSED_CHOICE;
             break;
         }
+        write_tree(tree, type);
         write_tree(tree, slots[0]);
         write_tree(tree, slots[1]);
         write_tree(tree, slots[2]);
@@ -842,15 +1631,16 @@ static size_t finish_node(uint32_t rule, uint32_t choice, size_t next_sibling, s
     case 8: {
         switch (choice) {
         case 0:
-            write_tree(tree, PARSED_EXACT);
+            type = PARSED_EXACT;
             break;
         case 1:
-            write_tree(tree, PARSED_AT_LEAST);
+            type = PARSED_AT_LEAST;
             break;
         case 2:
-            write_tree(tree, PARSED_RANGE);
+            type = PARSED_RANGE;
             break;
         }
+        write_tree(tree, type);
         write_tree(tree, slots[0]);
         write_tree(tree, slots[1]);
         break;
@@ -876,11 +1666,25 @@ static size_t finish_node(uint32_t rule, uint32_t choice, size_t next_sibling, s
     default:
         break;
     }
+#ifdef OWL_INDEX
+    if (tree->rule_index || tree->location_index)
+        index_match(tree, rule, type, offset, start_location, end_location);
+#else
+    (void)type;
+#endif
     return offset;
 }
 static size_t finish_token(uint32_t rule, size_t next_sibling, void *info) {
     struct owl_tree *tree = info;
+#ifdef OWL_BUILDER
+    if (tree->builder)
+        return build_token(rule, next_sibling, tree);
+#endif
     size_t offset = tree->next_offset;
+#ifdef OWL_INDEX
+    size_t start_location = 0;
+    size_t end_location = 0;
+#endif
     write_tree(tree, next_sibling ? offset - next_sibling : 0);
     switch (rule) {
     case 13: {
@@ -890,6 +1694,12 @@ static size_t finish_token(uint32_t rule, size_t next_sibling, void *info) {
         write_tree(tree, offset13);
         tree->next_identifier_token_offset = offset13;
         tree->next_identifier_token_offset -= read_tree(&offset13, tree);
+#ifdef OWL_INDEX
+        if (tree->rule_index || tree->location_index) {
+            start_location = read_tree(&offset13, tree);
+            end_location = start_location + read_tree(&offset13, tree);
+        }
+#endif
         break;
     }
     case 14: {
@@ -899,6 +1709,12 @@ static size_t finish_token(uint32_t rule, size_t next_sibling, void *info) {
         write_tree(tree, offset14);
         tree->next_string_token_offset = offset14;
         tree->next_string_token_offset -= read_tree(&offset14, tree);
+#ifdef OWL_INDEX
+        if (tree->rule_index || tree->location_index) {
+            start_location = read_tree(&offset14, tree);
+            end_location = start_location + read_tree(&offset14, tree);
+        }
+#endif
         break;
     }
     case 15: {
@@ -908,11 +1724,21 @@ static size_t finish_token(uint32_t rule, size_t next_sibling, void *info) {
         write_tree(tree, offset15);
         tree->next_integer_token_offset = offset15;
         tree->next_integer_token_offset -= read_tree(&offset15, tree);
+#ifdef OWL_INDEX
+        if (tree->rule_index || tree->location_index) {
+            start_location = read_tree(&offset15, tree);
+            end_location = start_location + read_tree(&offset15, tree);
+        }
+#endif
         break;
     }
     default:
         break;
     }
+#ifdef OWL_INDEX
+    if (tree->rule_index || tree->location_index)
+        index_match(tree, rule, 0, offset, start_location, end_location);
+#endif
     return offset;
 }
 static void check_for_error(struct owl_tree *tree) {
@@ -1268,7 +2094,7 @@ struct owl_ref owl_next(struct owl_ref ref) {
     size_t delta = read_tree(&ref._offset, ref._tree);
     return (struct owl_ref){
         ._tree = ref._tree,
-        ._offset = offset - delta,
+        ._offset = follow_link(ref._tree, offset, delta),
         ._type = ref._type,
         .empty = delta == 0,
     };
@@ -1289,6 +2115,81 @@ struct parsed_grammar owl_tree_get_parsed_grammar(struct owl_tree *tree) {
     check_for_error(tree);
     return parsed_grammar_get(owl_tree_root_ref(tree));
 }
+#ifdef OWL_INDEX
+const struct owl_ref *owl_tree_nodes_of_rule(struct owl_tree *tree, enum owl_rule rule, size_t *count) {
+    check_for_error(tree);
+    *count = 0;
+    if (!tree->rule_index || (uint32_t)rule >= 16)
+        return 0;
+    *count = tree->rule_index->lists[rule].count;
+    return tree->rule_index->lists[rule].matches;
+}
+const struct owl_ref *owl_tree_nodes_of_option(struct owl_tree *tree, enum owl_rule rule, enum parsed_type type, size_t *count) {
+    check_for_error(tree);
+    *count = 0;
+    uint32_t list = option_list(rule, type);
+    if (!tree->rule_index || list == 0)
+        return 0;
+    *count = tree->rule_index->lists[list].count;
+    return tree->rule_index->lists[list].matches;
+}
+// Returns the number of nodes which start at or before the location.
+static size_t count_nodes_starting_by(const struct location_index *index, size_t location) {
+    size_t low = 0;
+    size_t high = index->nodes.count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (index->nodes.starts[middle] <= location)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+struct owl_ref owl_tree_node_at(struct owl_tree *tree, size_t location) {
+    check_for_error(tree);
+    struct location_index *index = tree->location_index;
+    if (!index)
+        return (struct owl_ref){ .empty = true };
+    // Every node which starts by the location comes before this leaf, and
+    // nodes which contain the location are nested in order, so the innermost
+    // one is the last of them which ends after the location.
+    size_t k = index->number_of_leaves + count_nodes_starting_by(index, location) - 1;
+    if (k < index->number_of_leaves)
+        return (struct owl_ref){ .empty = true };
+    while (furthest_end(index, k) <= location) {
+        // Move up to the nearest subtree to the left.
+        while (k % 2 == 0)
+            k /= 2;
+        if (k == 1)
+            return (struct owl_ref){ .empty = true };
+        k--;
+    }
+    // Move down to the rightmost leaf which ends after the location.
+    while (k < index->number_of_leaves) {
+        k = 2 * k + 1;
+        if (furthest_end(index, k) <= location)
+            k--;
+    }
+    return index->nodes.matches[k - index->number_of_leaves];
+}
+const struct owl_ref *owl_tree_nodes_in_range(struct owl_tree *tree, size_t start, size_t end, size_t *count) {
+    check_for_error(tree);
+    *count = 0;
+    struct location_index *index = tree->location_index;
+    if (!index || end <= start)
+        return 0;
+    size_t first = start > 0 ? count_nodes_starting_by(index, start - 1) : 0;
+    size_t last = count_nodes_starting_by(index, end - 1);
+    if (first == last)
+        return 0;
+    *count = last - first;
+    return index->nodes.matches + first;
+}
+#endif
+enum owl_rule owl_ref_rule(struct owl_ref ref) {
+    return (enum owl_rule)ref._type;
+}
 #define ESCAPE_CHAR(c, info) ((c) == 'b' ? '\b' : (c) == 'f' ? '\f' : (c) == 'n' ? '\n' : (c) == 'r' ? '\r' : (c) == 't' ? '\t' : (c))
 #define IGNORE_TOKEN_WRITE(...)
 #define IGNORE_TOKEN_READ(...) (0)
@@ -1299,10 +2200,82 @@ struct parsed_grammar owl_tree_get_parsed_grammar(struct owl_tree *tree) {
 #define NUMBER_TOKEN_DATA(...)
 #define IF_NUMBER_TOKEN(...) if (0) { /* no number tokens */  }
 #define IF_STRING_TOKEN(cond, ...) if (cond) __VA_ARGS__
-static size_t read_whitespace(const char *text, void *info);
-static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, void *info);
+static size_t read_whitespace(const char *text, size_t length, void *info);
+static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, size_t length, void *info);
+#define IF_IDENTIFIER_KEYWORDS(...)
+#ifdef OWL_THREADS
+enum logged_token_kind {
+    LOGGED_IDENTIFIER_TOKEN,
+    LOGGED_INTEGER_TOKEN,
+    LOGGED_NUMBER_TOKEN,
+    LOGGED_STRING_TOKEN,
+    LOGGED_CUSTOM_TOKEN,
+};
+struct logged_token {
+    size_t offset;
+    size_t length;
+    // The token's value, or where its unescaped contents start in `strings`.
+    uint64_t data;
+    // The length of the unescaped contents, or the custom token's type.
+    size_t extra;
+    uint8_t kind;
+    bool has_escapes;
+};
+// The token data from a worker thread's tokenizer, in the order the tokens
+// appear in the text.
+struct token_log {
+    struct logged_token *tokens;
+    size_t number_of_tokens;
+    size_t tokens_capacity;
+    char *strings;
+    size_t strings_size;
+    size_t strings_capacity;
+    // When validating, nothing is kept.
+    bool discard;
+    struct owl_allocator *allocator;
+};
+static void log_token(struct token_log *log, struct logged_token token) {
+    if (log->discard)
+        return;
+    if (log->number_of_tokens >= log->tokens_capacity) {
+        size_t capacity = (log->tokens_capacity + 64) * 2;
+        struct logged_token *tokens = reallocate_memory(log->tokens, log->tokens_capacity * sizeof(struct logged_token), capacity * sizeof(struct logged_token), log->allocator);
+        if (!tokens)
+            abort();
+        log->tokens = tokens;
+        log->tokens_capacity = capacity;
+    }
+    log->tokens[log->number_of_tokens++] = token;
+}
+static void *log_string_contents(struct token_log *log, size_t size) {
+    // Discarded contents are overwritten by the next string.
+    if (log->discard)
+        log->strings_size = 0;
+    if (log->strings_size + size > log->strings_capacity) {
+        size_t capacity = (log->strings_size + size + 256) * 2;
+        char *strings = reallocate_memory(log->strings, log->strings_capacity, capacity, log->allocator);
+        if (!strings)
+            abort();
+        log->strings = strings;
+        log->strings_capacity = capacity;
+    }
+    void *p = log->strings + log->strings_size;
+    log->strings_size += size;
+    return p;
+}
+static void free_token_log(struct token_log *log) {
+    free_memory(log->tokens, log->tokens_capacity * sizeof(struct logged_token), log->allocator);
+    free_memory(log->strings, log->strings_capacity, log->allocator);
+}
+#endif
 static void write_identifier_token(size_t offset, size_t length, void *info) {
     struct owl_tree *tree = info;
+#ifdef OWL_THREADS
+    if (tree->token_log) {
+        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_IDENTIFIER_TOKEN, .offset = offset, .length = length });
+        return;
+    }
+#endif
     size_t token_offset = tree->next_offset;
     write_tree(tree, token_offset - tree->next_identifier_token_offset);
     write_tree(tree, offset);
@@ -1311,6 +2284,12 @@ static void write_identifier_token(size_t offset, size_t length, void *info) {
 }
 static void write_string_token(size_t offset, size_t length, const char *string, size_t string_length, bool has_escapes, void *info) {
     struct owl_tree *tree = info;
+#ifdef OWL_THREADS
+    if (tree->token_log) {
+        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_STRING_TOKEN, .offset = offset, .length = length, .data = has_escapes ? (uint64_t)(string - tree->token_log->strings) : 0, .extra = string_length, .has_escapes = has_escapes });
+        return;
+    }
+#endif
     size_t string_offset = has_escapes ? (uint8_t *)string - tree->parse_tree : 0;
     size_t token_offset = tree->next_offset;
     write_tree(tree, token_offset - tree->next_string_token_offset);
@@ -1325,6 +2304,12 @@ static void write_string_token(size_t offset, size_t length, const char *string,
 }
 static void write_integer_token(size_t offset, size_t length, uint64_t integer, void *info) {
     struct owl_tree *tree = info;
+#ifdef OWL_THREADS
+    if (tree->token_log) {
+        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_INTEGER_TOKEN, .offset = offset, .length = length, .data = integer });
+        return;
+    }
+#endif
     size_t token_offset = tree->next_offset;
     write_tree(tree, token_offset - tree->next_integer_token_offset);
     write_tree(tree, offset);
@@ -1334,12 +2319,178 @@ static void write_integer_token(size_t offset, size_t length, uint64_t integer,
 }
 static void *allocate_string_contents(size_t size, void *info) {
     struct owl_tree *tree = info;
+#ifdef OWL_THREADS
+    if (tree->token_log)
+        return log_string_contents(tree->token_log, size);
+#endif
     if (tree->next_offset + size > tree->parse_tree_size)
         grow_tree(tree, tree->next_offset + size);
     void *p = tree->parse_tree + tree->next_offset;
     tree->next_offset += size;
     return p;
 }
+// Vectorized scanners for the tokenizer.  These load whole aligned blocks,
+// which can include bytes past the end of the input.  Aligned loads never
+// cross a page boundary, so this is safe, but it upsets memory checkers like
+// AddressSanitizer.  Define OWL_NO_SIMD to use the scalar loops instead.
+#if !defined(OWL_NO_SIMD) && defined(__SANITIZE_ADDRESS__)
+#define OWL_NO_SIMD
+#endif
+#if !defined(OWL_NO_SIMD) && defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define OWL_NO_SIMD
+#endif
+#endif
+#if !defined(OWL_NO_SIMD) && defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define OWL_SIMD
+enum vector_scan_class {
+    VECTOR_SCAN_IDENTIFIER,
+    VECTOR_SCAN_IDENTIFIER_WITH_DASHES,
+    VECTOR_SCAN_DIGITS,
+    VECTOR_SCAN_HEX_DIGITS,
+    VECTOR_SCAN_WHITESPACE,
+    VECTOR_SCAN_STRING,
+    VECTOR_SCAN_LINE,
+};
+typedef unsigned char vector_bytes_sse2 __attribute__((vector_size(16), may_alias));
+typedef char vector_mask_sse2 __attribute__((vector_size(16)));
+static inline  vector_mask_sse2 vector_equal_sse2(vector_bytes_sse2 x, unsigned char c) {
+    return (vector_mask_sse2)(x == c);
+}
+static inline  vector_mask_sse2 vector_in_range_sse2(vector_bytes_sse2 x, unsigned char low, unsigned char high) {
+    return (vector_mask_sse2)(x - low <= (unsigned char)(high - low));
+}
+static inline  uint32_t vector_stop_mask_sse2(vector_bytes_sse2 x, enum vector_scan_class kind, char quote) {
+    vector_mask_sse2 keep = {0};
+    vector_bytes_sse2 lowercase = x | 0x20;
+    switch (kind) {
+    case VECTOR_SCAN_IDENTIFIER_WITH_DASHES:
+        keep = vector_equal_sse2(x, '-');
+        // Fall through.
+    case VECTOR_SCAN_IDENTIFIER:
+        keep |= vector_equal_sse2(x, '_') | vector_in_range_sse2(lowercase, 'a', 'z') | vector_in_range_sse2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_HEX_DIGITS:
+        keep = vector_in_range_sse2(lowercase, 'a', 'f');
+        // Fall through.
+    case VECTOR_SCAN_DIGITS:
+        keep |= vector_in_range_sse2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_WHITESPACE:
+        keep |= vector_equal_sse2(x, 32);
+        keep |= vector_equal_sse2(x, 9);
+        keep |= vector_equal_sse2(x, 10);
+        keep |= vector_equal_sse2(x, 13);
+        break;
+    case VECTOR_SCAN_STRING:
+        keep = vector_equal_sse2(x, (unsigned char)quote) | vector_equal_sse2(x, '\\') | vector_equal_sse2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb128(keep);
+    case VECTOR_SCAN_LINE:
+        keep = vector_equal_sse2(x, '\n') | vector_equal_sse2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb128(keep);
+    }
+    // Zero bytes never belong to a run.
+    return ~(uint32_t)__builtin_ia32_pmovmskb128(keep) & 0xffffu;
+}
+// Here, `offset` must be less than `end`.  Aligned blocks which contain at
+// least one byte of the text can't cross into an unmapped page.
+static inline  size_t vector_scan_sse2(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)(16 - 1));
+    uint32_t stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote) & (0xffffu << (start - block));
+    while (!stop) {
+        block += 16;
+        if (block >= text + end)
+            return end;
+        stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote);
+    }
+    size_t stop_offset = (size_t)(block - text) + (size_t)__builtin_ctz(stop);
+    return stop_offset < end ? stop_offset : end;
+}
+typedef unsigned char vector_bytes_avx2 __attribute__((vector_size(32), may_alias));
+typedef char vector_mask_avx2 __attribute__((vector_size(32)));
+static inline __attribute__((target("avx2")))  vector_mask_avx2 vector_equal_avx2(vector_bytes_avx2 x, unsigned char c) {
+    return (vector_mask_avx2)(x == c);
+}
+static inline __attribute__((target("avx2")))  vector_mask_avx2 vector_in_range_avx2(vector_bytes_avx2 x, unsigned char low, unsigned char high) {
+    return (vector_mask_avx2)(x - low <= (unsigned char)(high - low));
+}
+static inline __attribute__((target("avx2")))  uint32_t vector_stop_mask_avx2(vector_bytes_avx2 x, enum vector_scan_class kind, char quote) {
+    vector_mask_avx2 keep = {0};
+    vector_bytes_avx2 lowercase = x | 0x20;
+    switch (kind) {
+    case VECTOR_SCAN_IDENTIFIER_WITH_DASHES:
+        keep = vector_equal_avx2(x, '-');
+        // Fall through.
+    case VECTOR_SCAN_IDENTIFIER:
+        keep |= vector_equal_avx2(x, '_') | vector_in_range_avx2(lowercase, 'a', 'z') | vector_in_range_avx2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_HEX_DIGITS:
+        keep = vector_in_range_avx2(lowercase, 'a', 'f');
+        // Fall through.
+    case VECTOR_SCAN_DIGITS:
+        keep |= vector_in_range_avx2(x, '0', '9');
+        break;
+    case VECTOR_SCAN_WHITESPACE:
+        keep |= vector_equal_avx2(x, 32);
+        keep |= vector_equal_avx2(x, 9);
+        keep |= vector_equal_avx2(x, 10);
+        keep |= vector_equal_avx2(x, 13);
+        break;
+    case VECTOR_SCAN_STRING:
+        keep = vector_equal_avx2(x, (unsigned char)quote) | vector_equal_avx2(x, '\\') | vector_equal_avx2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb256(keep);
+    case VECTOR_SCAN_LINE:
+        keep = vector_equal_avx2(x, '\n') | vector_equal_avx2(x, 0);
+        return (uint32_t)__builtin_ia32_pmovmskb256(keep);
+    }
+    // Zero bytes never belong to a run.
+    return ~(uint32_t)__builtin_ia32_pmovmskb256(keep) & 0xffffffffu;
+}
+// Here, `offset` must be less than `end`.  Aligned blocks which contain at
+// least one byte of the text can't cross into an unmapped page.
+static inline __attribute__((target("avx2")))  size_t vector_scan_avx2(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)(32 - 1));
+    uint32_t stop = vector_stop_mask_avx2(*(const vector_bytes_avx2 *)block, kind, quote) & (0xffffffffu << (start - block));
+    while (!stop) {
+        block += 32;
+        if (block >= text + end)
+            return end;
+        stop = vector_stop_mask_avx2(*(const vector_bytes_avx2 *)block, kind, quote);
+    }
+    size_t stop_offset = (size_t)(block - text) + (size_t)__builtin_ctz(stop);
+    return stop_offset < end ? stop_offset : end;
+}
+static inline size_t vector_scan(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {
+    if (offset >= end)
+        return end;
+#ifdef __AVX2__
+    return vector_scan_avx2(text, offset, end, kind, quote);
+#else
+    // Most runs end within the first block, so only dispatch to AVX2 for the
+    // rest of a longer run.
+    const char *start = text + offset;
+    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)15);
+    uint32_t stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote) & (0xffffu << (start - block));
+    offset = (size_t)(block - text) + (stop ? (size_t)__builtin_ctz(stop) : 16);
+    if (stop || offset >= end)
+        return offset < end ? offset : end;
+    if (__builtin_cpu_supports("avx2"))
+        return vector_scan_avx2(text, offset, end, kind, quote);
+    return vector_scan_sse2(text, offset, end, kind, quote);
+#endif
+}
+#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) vector_scan(text, offset, end, VECTOR_SCAN_IDENTIFIER_WITH_DASHES, 0)
+#define SKIP_DIGITS(text, offset, end, hexadecimal) vector_scan(text, offset, end, (hexadecimal) ? VECTOR_SCAN_HEX_DIGITS : VECTOR_SCAN_DIGITS, 0)
+#define SKIP_STRING_CHARS(text, offset, end, quote) vector_scan(text, offset, end, VECTOR_SCAN_STRING, quote)
+#define SKIP_LINE(text, offset, end) vector_scan(text, offset, end, VECTOR_SCAN_LINE, 0)
+#else
+#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) (offset)
+#define SKIP_DIGITS(text, offset, end, hexadecimal) (offset)
+#define SKIP_STRING_CHARS(text, offset, end, quote) (offset)
+#define SKIP_LINE(text, offset, end) (offset)
+#endif
 struct owl_token_run {
     struct owl_token_run *prev;
     uint16_t number_of_tokens;
@@ -1350,12 +2501,19 @@ struct owl_token_run {
 };
 struct owl_default_tokenizer {
     const char *text;
+    size_t length;
     size_t offset;
     size_t whitespace;
     uint32_t identifier_token;
     uint32_t number_token;
     uint32_t string_token;
     void *info;
+    bool more_input;
+    bool deferred;
+    size_t lookahead;
+    size_t stop;
+    struct owl_token_run *free_runs;
+    void *allocator;
 };
 static bool char_is_whitespace(char c) {
     switch (c) {
@@ -1387,6 +2545,20 @@ static bool char_continues_identifier(char c, void *info) {
 static bool char_ends_identifier(char c) {
     return c != '-';
 }
+static inline uint64_t read_eight_bytes(const char *text) {
+    uint8_t b[8];
+    memcpy(b, text, 8);
+    return (uint64_t)b[0] | (uint64_t)b[1] << 8 | (uint64_t)b[2] << 16 | (uint64_t)b[3] << 24 | (uint64_t)b[4] << 32 | (uint64_t)b[5] << 40 | (uint64_t)b[6] << 48 | (uint64_t)b[7] << 56;
+}
+static inline bool eight_bytes_are_digits(uint64_t chunk) {
+    return !(((chunk + 0x4646464646464646) | (chunk - 0x3030303030303030)) & 0x8080808080808080);
+}
+static inline uint32_t eight_digits_value(uint64_t chunk) {
+    chunk -= 0x3030303030303030;
+    chunk = chunk * 10 + (chunk >> 8);
+    chunk = ((chunk & 0x000000ff000000ff) * 0x000f424000000064 + ((chunk >> 16) & 0x000000ff000000ff) * 0x0000271000000001) >> 32;
+    return (uint32_t)chunk;
+}
 static bool encode_length(struct owl_token_run *run, uint16_t *lengths_size, size_t length) {
     uint8_t mark = 0;
     while (*lengths_size < sizeof(run->lengths)) {
@@ -1421,17 +2593,35 @@ static size_t decode_token_length(struct owl_token_run *run, uint16_t *length_of
     return length;
 }
 static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer, struct owl_token_run **previous_run) {
-    struct owl_token_run *run = malloc(sizeof(struct owl_token_run));
-    if (!run) return false;
+    struct owl_token_run *run = tokenizer->free_runs;
+    if (run) tokenizer->free_runs = run->prev;
+    else {
+        run = allocate_memory(sizeof(struct owl_token_run), tokenizer->allocator);
+        if (!run) return false;
+    }
     uint16_t number_of_tokens = 0;
     uint16_t lengths_size = 0;
     const char *text = tokenizer->text;
     size_t whitespace = tokenizer->whitespace;
+    size_t length = tokenizer->length;
     size_t offset = tokenizer->offset;
+    size_t limit = SIZE_MAX;
+    size_t token_limit = length;
+    if (tokenizer->more_input) {
+        limit = length;
+    token_limit = length > tokenizer->lookahead ? length - tokenizer->lookahead :
+        0;
+    }
+    size_t token_stop = token_limit;
+    if (tokenizer->stop && tokenizer->stop < token_stop) token_stop = tokenizer->stop;
+    bool deferred = false;
     while (number_of_tokens < 4096) {
+        if (offset >= token_stop) {
+            deferred = tokenizer->more_input && offset >= token_limit;
+            break;
+        }
         char c = text[offset];
-        if (c == '\0') break;
-        size_t whitespace_length = read_whitespace(text + offset, tokenizer->info);
+        size_t whitespace_length = read_whitespace(text + offset, length - offset, tokenizer->info);
         if (whitespace_length > 0) {
             whitespace += whitespace_length;
             offset += whitespace_length;
@@ -1447,12 +2637,12 @@ static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tok
         bool comment = false;
         bool custom_whitespace = false;
         bool has_escapes = false;
-        size_t token_length = read_keyword_token(&token, &end_token, text + offset, tokenizer->info);
+        size_t token_length = read_keyword_token(&token, &end_token, text + offset, length - offset, tokenizer->info);
         if (token_length > 0) {
             is_token = true;
             if (token == 4294967295U) comment = true;
         }
-        if (IGNORE_TOKEN_READ(&token, &token_length, text + offset, &custom_whitespace, &custom_data, tokenizer->info)) {
+        if (IGNORE_TOKEN_READ(&token, &token_length, text + offset, length - offset, &custom_whitespace, &custom_data, tokenizer->info)) {
             is_token = true;
             custom_token = true;
             end_token = false;
@@ -1461,13 +2651,20 @@ static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tok
         IF_INTEGER_TOKEN(char_is_numeric(c), {
             size_t integer_offset = offset;
             uint64_t base = 10;
-            if (c == '0' && (text[offset + 1] == 'x' || text[offset + 1] == 'X') && (char_is_numeric(text[offset + 2]) || char_is_hexadecimal_alpha(text[integer_offset + 2]))) {
+            if (c == '0' && offset + 2 < length && (text[offset + 1] == 'x' || text[offset + 1] == 'X') && (char_is_numeric(text[offset + 2]) || char_is_hexadecimal_alpha(text[integer_offset + 2]))) {
                 integer_offset = offset + 2;
                 base = 16;
             }
             integer = 0;
             bool overflow = false;
-            while (char_is_numeric(text[integer_offset]) || (base == 16 && char_is_hexadecimal_alpha(text[integer_offset]))) {
+            while (base == 10 && integer_offset + 8 <= length && integer <= (UINT64_MAX - 99999999) / 100000000) {
+                uint64_t chunk = read_eight_bytes(text + integer_offset);
+                if (!eight_bytes_are_digits(chunk)) break;
+                integer = integer * 100000000 + eight_digits_value(chunk);
+                integer_offset += 8;
+            }
+            size_t digits_end = SKIP_DIGITS(text, integer_offset, length, base == 16);
+            while (integer_offset < digits_end || (integer_offset < length && (char_is_numeric(text[integer_offset]) || (base == 16 && char_is_hexadecimal_alpha(text[integer_offset]))))) {
                 uint64_t last = integer;
                 integer *= base;
                 uint64_t ch = text[integer_offset];
@@ -1480,6 +2677,7 @@ static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tok
                 }
                 integer_offset++;
             }
+            if (integer_offset >= limit) deferred = true;
             if (!overflow && integer_offset - offset > token_length) {
                 token_length = integer_offset - offset;
                 is_token = true;
@@ -1489,12 +2687,12 @@ static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tok
                 token = 29;
             }
         }
-        ) IF_NUMBER_TOKEN(char_is_numeric(c) || (c == '.' && char_is_numeric(text[offset + 1])), {
-            const char *start = (const char *)text + offset;
-            char *rest = 0;
-            number = strtod(start, &rest);
-            if (rest > start && rest - start > token_length) {
-                token_length = rest - start;
+        ) IF_NUMBER_TOKEN(char_is_numeric(c) || (c == '.' && offset + 1 < length && char_is_numeric(text[offset + 1])), {
+            size_t number_length = 0;
+            number = read_number(text + offset, length - offset, &number_length, tokenizer->allocator);
+            if (offset + number_length + 3 > limit) deferred = true;
+            if (number_length > token_length) {
+                token_length = number_length;
                 is_token = true;
                 end_token = false;
                 comment = false;
@@ -1503,8 +2701,8 @@ static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tok
             }
         }
         ) else IF_STRING_TOKEN(c == '\'' || c == '"', {
-            size_t string_offset = offset + 1;
-            while (text[string_offset] != '\0') {
+            size_t string_offset = SKIP_STRING_CHARS(text, offset + 1, length, c);
+            while (string_offset < length && text[string_offset] != '\0') {
                 if (text[string_offset] == c) {
                     token_length = string_offset + 1 - offset;
                     is_token = true;
@@ -1517,14 +2715,16 @@ static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tok
                 if (text[string_offset] == '\\') {
                     has_escapes = true;
                     string_offset++;
-                    if (text[string_offset] == '\0') break;
+                    if (string_offset >= length || text[string_offset] == '\0') break;
                 }
-                string_offset++;
+                string_offset = SKIP_STRING_CHARS(text, string_offset + 1, length, c);
             }
+            if (string_offset >= limit) deferred = true;
         }
         ) else IF_IDENTIFIER_TOKEN(char_starts_identifier(c), {
-            size_t identifier_offset = offset + 1;
-            while (char_continues_identifier(text[identifier_offset], tokenizer->info)) identifier_offset++;
+            size_t identifier_offset = SKIP_IDENTIFIER_CHARS(text, offset + 1, length, tokenizer->info);
+            while (identifier_offset < length && char_continues_identifier(text[identifier_offset], tokenizer->info)) identifier_offset++;
+            if (identifier_offset >= limit) deferred = true;
             while (!char_ends_identifier(text[identifier_offset - 1])) identifier_offset--;
             if (identifier_offset - offset > token_length) {
                 token_length = identifier_offset - offset;
@@ -1533,24 +2733,35 @@ static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tok
                 comment = false;
                 custom_whitespace = false;
                 token = 27;
-            }
+                IF_IDENTIFIER_KEYWORDS(!custom_token, {
+                    read_identifier_keyword(&token, &end_token, text + offset, token_length);
+                }
+            ) }
         }
-        ) if (custom_whitespace) {
+        ) if (custom_token && offset + token_length >= token_limit) deferred = true;
+        if (deferred) break;
+        if (custom_whitespace) {
             whitespace += token_length;
             offset += token_length;
             continue;
         }
         else if (comment) {
-            while (text[offset] != '\0' && text[offset] != '\n') {
-                whitespace++;
-                offset++;
+            size_t line_end = SKIP_LINE(text, offset, length);
+            while (line_end < length && text[line_end] != '\0' && text[line_end] != '\n') line_end++;
+            if (line_end >= limit) {
+                deferred = true;
+                break;
             }
+            whitespace += line_end - offset;
+            offset = line_end;
             continue;
         }
         else if (!is_token || token == 4294967295U) {
             tokenizer->offset = offset;
             tokenizer->whitespace = whitespace;
-            free(run);
+            tokenizer->deferred = false;
+            run->prev = tokenizer->free_runs;
+            tokenizer->free_runs = run;
             return false;
         }
         if (end_token && number_of_tokens + 1 >= 4096) break;
@@ -1604,10 +2815,12 @@ static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tok
             number_of_tokens++;
         }
     }
+    tokenizer->deferred = deferred;
     if (number_of_tokens == 0) {
         tokenizer->offset = offset;
         tokenizer->whitespace = whitespace;
-        free(run);
+        run->prev = tokenizer->free_runs;
+        tokenizer->free_runs = run;
         return false;
     }
     tokenizer->offset = offset;
@@ -1618,6 +2831,13 @@ static bool OWL_DONT_INLINE owl_default_tokenizer_advance(struct owl_default_tok
     *previous_run = run;
     return true;
 }
+static void free_token_runs(struct owl_token_run **run, void *allocator) {
+    while (*run) {
+        struct owl_token_run *prev = (*run)->prev;
+        free_memory(*run, sizeof(struct owl_token_run), allocator);
+        *run = prev;
+    }
+}
 static void find_token_range(struct owl_default_tokenizer *tokenizer, struct owl_token_run *run, uint16_t index, size_t *start, size_t *end) {
     size_t offset = tokenizer->offset - tokenizer->whitespace;
     size_t last_offset = offset;
@@ -1637,7 +2857,7 @@ static void find_token_range(struct owl_default_tokenizer *tokenizer, struct owl
 static void estimate_next_token_range(struct owl_default_tokenizer *tokenizer, size_t *start, size_t *end) {
     *start = tokenizer->offset;
     size_t i = tokenizer->offset + 1;
-    while (tokenizer->text[i] != '\0' && !char_is_whitespace(tokenizer->text[i]) && !char_continues_identifier(tokenizer->text[i], tokenizer->info)) i++;
+    while (i < tokenizer->length && tokenizer->text[i] != '\0' && !char_is_whitespace(tokenizer->text[i]) && !char_continues_identifier(tokenizer->text[i], tokenizer->info)) i++;
     *end = i;
 }
 static void find_end_range(struct owl_default_tokenizer *tokenizer, size_t *start, size_t *end) {
@@ -1658,6 +2878,7 @@ struct construct_node {
     struct construct_node *next;
     size_t number_of_slots;
     size_t *slots;
+    size_t slots_capacity;
     uint32_t rule;
     uint16_t slot_index;
     uint16_t choice_index;
@@ -1685,6 +2906,7 @@ struct construct_state {
     struct construct_node *node_freelist;
     struct construct_expression *expression_freelist;
     void *info;
+    void *allocator;
 };
 static struct construct_node *construct_node_alloc(struct construct_state *s, uint32_t rule) {
     struct construct_node *node;
@@ -1693,19 +2915,27 @@ static struct construct_node *construct_node_alloc(struct construct_state *s, ui
         node = s->node_freelist;
         s->node_freelist = node->next;
         size_t *slots = node->slots;
-        if (number_of_slots > node->number_of_slots) {
-            slots = realloc(slots, number_of_slots * sizeof(size_t));
+        size_t slots_capacity = node->slots_capacity;
+        if (number_of_slots > slots_capacity) {
+            slots = reallocate_memory(slots, slots_capacity * sizeof(size_t), number_of_slots * sizeof(size_t), s->allocator);
             if (!slots) abort();
+            slots_capacity = number_of_slots;
         }
         memset(node, 0, sizeof(struct construct_node));
-        memset(slots, 0, number_of_slots * sizeof(size_t));
+        if (number_of_slots > 0) memset(slots, 0, number_of_slots * sizeof(size_t));
         node->slots = slots;
+        node->slots_capacity = slots_capacity;
     }
     else {
-        node = calloc(1, sizeof(struct construct_node));
+        node = allocate_memory(sizeof(struct construct_node), s->allocator);
         if (!node) abort();
-        node->slots = calloc(number_of_slots, sizeof(size_t));
-        if (number_of_slots > 0 && !node->slots) abort();
+        memset(node, 0, sizeof(struct construct_node));
+        if (number_of_slots > 0) {
+            node->slots = allocate_memory(number_of_slots * sizeof(size_t), s->allocator);
+            if (!node->slots) abort();
+            memset(node->slots, 0, number_of_slots * sizeof(size_t));
+        }
+        node->slots_capacity = number_of_slots;
     }
     node->rule = rule;
     node->number_of_slots = number_of_slots;
@@ -1719,8 +2949,9 @@ static struct construct_expression *construct_expression_alloc(struct construct_
         memset(expr, 0, sizeof(struct construct_expression));
     }
     else {
-        expr = calloc(1, sizeof(struct construct_expression));
+        expr = allocate_memory(sizeof(struct construct_expression), s->allocator);
         if (!expr) abort();
+        memset(expr, 0, sizeof(struct construct_expression));
     }
     (left_right_operand_slots_lookup(rule, &(expr->left_slot_index), &(expr->right_slot_index), &(expr->operand_slot_index), s->info));
     expr->rule = rule;
@@ -1839,18 +3070,20 @@ static size_t construct_finish(struct construct_state *s, size_t offset) {
         finished = (finish_node((node)->rule, (node)->choice_index, 0, (node)->slots, (node)->start_location, (node)->end_location, s->info));
         construct_node_free(s, node);
     }
+    return finished;
+}
+static void construct_free_pools(struct construct_state *s) {
     while (s->node_freelist) {
         struct construct_node *node = s->node_freelist;
         s->node_freelist = node->next;
-        free(node->slots);
-        free(node);
+        free_memory(node->slots, node->slots_capacity * sizeof(size_t), s->allocator);
+        free_memory(node, sizeof(struct construct_node), s->allocator);
     }
     while (s->expression_freelist) {
         struct construct_expression *expr = s->expression_freelist;
         s->expression_freelist = expr->parent;
-        free(expr);
+        free_memory(expr, sizeof(struct construct_expression), s->allocator);
     }
-    return finished;
 }
 static void construct_action_apply(struct construct_state *s, uint16_t action, size_t offset) {
     switch ((((action) >> 12) & 0xf)) {
@@ -1975,1073 +3208,2506 @@ struct fill_run_continuation {
     struct fill_run_state *stack;
     size_t top_index;
     size_t capacity;
+    // -1 if a reachability check failed on the token before this one, 2 if a
+    // bracket ended with nothing below it on the stack, or 1 for any other
+    // error.
     int error;
+    struct owl_allocator *allocator;
 };
-static void bracket_entry_state(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index, uint32_t mask0);
-static void (*state_funcs[129])(struct owl_token_run *, struct fill_run_state *, uint16_t);
-static void state_func_105(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+static struct fill_run_state *bracket_entry_state(struct fill_run_continuation *cont, uint32_t mask0) {
+    cont->top_index++;
+    if (cont->top_index >= cont->capacity) {
+        size_t new_capacity = (cont->capacity + 2) * 3 / 2;
+        if (new_capacity <= cont->capacity)
+            abort();
+        struct fill_run_state *new_states = reallocate_memory(cont->stack, cont->capacity * sizeof(struct fill_run_state), new_capacity * sizeof(struct fill_run_state), cont->allocator);
+        if (!new_states)
+            abort();
+        cont->stack = new_states;
+        cont->capacity = new_capacity;
+    }
+    struct fill_run_state *top = &cont->stack[cont->top_index];
+    top->cont = cont;
+    top->reachability_mask[0] = mask0;
+    return top;
+}
+static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index) {
+    uint16_t token_index = 0;
+    uint16_t number_of_tokens = run->number_of_tokens;
+    struct fill_run_state *top = &cont->stack[cont->top_index];
+    uint32_t state = top->state;
+    if (number_of_tokens == 0)
+        return true;
+dispatch:
+    switch (state) {
+    case 0: goto state_0;
+    case 1: goto state_1;
+    case 2: goto state_2;
+    case 3: goto state_3;
+    case 4: goto state_4;
+    case 5: goto state_5;
+    case 6: goto state_6;
+    case 7: goto state_7;
+    case 8: goto state_8;
+    case 9: goto state_8;
+    case 10: goto state_8;
+    case 11: goto state_11;
+    case 12: goto state_8;
+    case 13: goto state_8;
+    case 14: goto state_8;
+    case 15: goto state_6;
+    case 16: goto state_16;
+    case 17: goto state_8;
+    case 18: goto state_18;
+    case 19: goto state_19;
+    case 20: goto state_8;
+    case 21: goto state_21;
+    case 22: goto state_7;
+    case 23: goto state_23;
+    case 24: goto state_24;
+    case 25: goto state_25;
+    case 26: goto state_26;
+    case 27: goto state_26;
+    case 28: goto state_26;
+    case 29: goto state_26;
+    case 30: goto state_26;
+    case 31: goto state_26;
+    case 32: goto state_32;
+    case 33: goto state_33;
+    case 34: goto state_26;
+    case 35: goto state_35;
+    case 36: goto state_36;
+    case 37: goto state_26;
+    case 38: goto state_38;
+    case 39: goto state_33;
+    case 40: goto state_40;
+    case 41: goto state_40;
+    case 42: goto state_42;
+    case 43: goto state_40;
+    case 44: goto state_40;
+    case 45: goto state_40;
+    case 46: goto state_40;
+    case 47: goto state_47;
+    case 48: goto state_48;
+    case 49: goto state_48;
+    case 50: goto state_48;
+    case 51: goto state_51;
+    case 52: goto state_48;
+    case 53: goto state_48;
+    case 54: goto state_48;
+    case 55: goto state_40;
+    case 56: goto state_48;
+    case 57: goto state_57;
+    case 58: goto state_58;
+    case 59: goto state_59;
+    case 60: goto state_60;
+    case 61: goto state_48;
+    case 62: goto state_62;
+    case 63: goto state_47;
+    case 64: goto state_4;
+    case 65: goto state_65;
+    case 66: goto state_65;
+    case 67: goto state_0;
+    case 68: goto state_0;
+    case 69: goto state_69;
+    case 70: goto state_70;
+    case 71: goto state_71;
+    case 72: goto state_72;
+    case 73: goto state_73;
+    case 74: goto state_74;
+    case 75: goto state_75;
+    case 76: goto state_76;
+    case 77: goto state_75;
+    case 78: goto state_75;
+    case 79: goto state_75;
+    case 80: goto state_75;
+    case 81: goto state_75;
+    case 82: goto state_82;
+    case 83: goto state_83;
+    case 84: goto state_75;
+    case 85: goto state_85;
+    case 86: goto state_86;
+    case 87: goto state_87;
+    case 88: goto state_86;
+    case 89: goto state_86;
+    case 90: goto state_90;
+    case 91: goto state_86;
+    case 92: goto state_92;
+    case 93: goto state_93;
+    case 94: goto state_75;
+    case 95: goto state_95;
+    case 96: goto state_74;
+    case 97: goto state_97;
+    case 98: goto state_98;
+    case 99: goto state_99;
+    case 100: goto state_100;
+    case 101: goto state_100;
+    case 102: goto state_100;
+    case 103: goto state_100;
+    case 104: goto state_100;
+    case 105: goto state_105;
+    case 106: goto state_99;
+    case 107: goto state_100;
+    case 108: goto state_108;
+    case 109: goto state_109;
+    case 110: goto state_110;
+    case 111: goto state_111;
+    case 112: goto state_112;
+    case 113: goto state_98;
+    case 114: goto state_114;
+    case 115: goto state_115;
+    case 116: goto state_115;
+    case 117: goto state_115;
+    case 118: goto state_118;
+    case 119: goto state_119;
+    case 120: goto state_115;
+    case 121: goto state_115;
+    case 122: goto state_70;
+    case 123: goto state_115;
+    case 124: goto state_124;
+    case 125: goto state_125;
+    case 126: goto state_115;
+    case 127: goto state_127;
+    case 128: goto state_128;
+    default: abort();
+    }
+state_105:
+    run->states[token_index] = state;
     if (!(0 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_5(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 0: top->state = 6; return;
-    default: top->cont->error = 1; return;
+state_5:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 0: state = 6; if (++token_index < number_of_tokens) goto state_6; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_18(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 21; return;
-    default: top->cont->error = 1; return;
+state_18:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 1: state = 21; if (++token_index < number_of_tokens) goto state_21; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_35(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 38; return;
-    default: top->cont->error = 1; return;
+state_35:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 1: state = 38; if (++token_index < number_of_tokens) goto state_38; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_59(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 62; return;
-    default: top->cont->error = 1; return;
+state_59:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 1: state = 62; if (++token_index < number_of_tokens) goto state_62; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_19(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 20; return;
-    default: top->cont->error = 1; return;
+state_19:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 20; if (++token_index < number_of_tokens) goto state_8; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_21(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 22; return;
-    default: top->cont->error = 1; return;
+state_21:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 22; if (++token_index < number_of_tokens) goto state_7; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_11(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 23; return;
-    default: top->cont->error = 1; return;
+state_11:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 23; if (++token_index < number_of_tokens) goto state_23; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_36(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 37; return;
-    default: top->cont->error = 1; return;
+state_36:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 37; if (++token_index < number_of_tokens) goto state_26; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_38(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 39; return;
-    default: top->cont->error = 1; return;
+state_38:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 39; if (++token_index < number_of_tokens) goto state_33; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_51(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 57; return;
-    default: top->cont->error = 1; return;
+state_51:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 57; if (++token_index < number_of_tokens) goto state_57; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_60(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 61; return;
-    default: top->cont->error = 1; return;
+state_60:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 61; if (++token_index < number_of_tokens) goto state_48; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_62(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 63; return;
-    default: top->cont->error = 1; return;
+state_62:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 63; if (++token_index < number_of_tokens) goto state_47; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_3(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 65; return;
-    default: top->cont->error = 1; return;
+state_3:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 65; if (++token_index < number_of_tokens) goto state_65; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_2(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 28: top->state = 67; return;
-    default: top->cont->error = 1; return;
+state_2:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 28: state = 67; if (++token_index < number_of_tokens) goto state_0; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_1(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 28: top->state = 68; return;
-    default: top->cont->error = 1; return;
+state_1:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 28: state = 68; if (++token_index < number_of_tokens) goto state_0; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_124(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_124:
+    run->states[token_index] = state;
     if (!(1 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 127; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 1: state = 127; if (++token_index < number_of_tokens) goto state_127; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_125(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_125:
+    run->states[token_index] = state;
     if (!(1 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 126; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 27: state = 126; if (++token_index < number_of_tokens) goto state_115; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_127(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_127:
+    run->states[token_index] = state;
     if (!(1 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 128; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 27: state = 128; if (++token_index < number_of_tokens) goto state_128; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_92(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_92:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 95; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 1: state = 95; if (++token_index < number_of_tokens) goto state_95; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_86(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_86:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 21: top->state = 73; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 21: state = 73; if (++token_index < number_of_tokens) goto state_73; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_93(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_93:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 94; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 27: state = 94; if (++token_index < number_of_tokens) goto state_75; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_95(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_95:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 96; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 27: state = 96; if (++token_index < number_of_tokens) goto state_74; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_82(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_82:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 29: top->state = 85; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 29: state = 85; if (++token_index < number_of_tokens) goto state_85; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_87(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_87:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 29: top->state = 88; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 29: state = 88; if (++token_index < number_of_tokens) goto state_86; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_90(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_90:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 29: top->state = 91; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 29: state = 91; if (++token_index < number_of_tokens) goto state_86; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_112(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_112:
+    run->states[token_index] = state;
     if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 113; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 27: state = 113; if (++token_index < number_of_tokens) goto state_98; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_71(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_71:
+    run->states[token_index] = state;
     if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 28: top->state = 97; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 28: state = 97; if (++token_index < number_of_tokens) goto state_97; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_24(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 3: top->state = 40; return;
-    case 4: top->state = 41; return;
-    case 5: top->state = 42; return;
-    default: top->cont->error = 1; return;
+state_24:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 3: state = 40; if (++token_index < number_of_tokens) goto state_40; goto done;
+    case 4: state = 41; if (++token_index < number_of_tokens) goto state_40; goto done;
+    case 5: state = 42; if (++token_index < number_of_tokens) goto state_42; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_85(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_85:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 17: top->state = 86; return;
-    case 19: top->state = 87; return;
-    case 21: top->state = 73; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 17: state = 86; if (++token_index < number_of_tokens) goto state_86; goto done;
+    case 19: state = 87; if (++token_index < number_of_tokens) goto state_87; goto done;
+    case 21: state = 73; if (++token_index < number_of_tokens) goto state_73; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_76(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_76:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 17: top->state = 89; return;
-    case 19: top->state = 90; return;
-    case 21: top->state = 73; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 17: state = 89; if (++token_index < number_of_tokens) goto state_86; goto done;
+    case 19: state = 90; if (++token_index < number_of_tokens) goto state_90; goto done;
+    case 21: state = 73; if (++token_index < number_of_tokens) goto state_73; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_69(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_69:
+    run->states[token_index] = state;
     if (!(7 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 12: top->state = 70; return;
-    case 14: top->state = 71; return;
-    case 20: top->state = 72; return;
-    default: top->cont->error = 1; return;
-    }
-}
-static void state_func_42(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 6: top->state = 43; return;
-    case 7: top->state = 44; return;
-    case 8: top->state = 45; return;
-    case 9: top->state = 46; return;
-    default: top->cont->error = 1; return;
-    }
-}
-static void state_func_6(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 7; return;
-    case 28: top->state = 8; return;
-    case 30: top->state = 9; return;
-    case 32: top->state = 10; return;
+    switch (run->tokens[token_index]) {
+    case 12: state = 70; if (++token_index < number_of_tokens) goto state_70; goto done;
+    case 14: state = 71; if (++token_index < number_of_tokens) goto state_71; goto done;
+    case 20: state = 72; if (++token_index < number_of_tokens) goto state_72; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 5);
-        return;
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_32(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 33; return;
-    case 28: top->state = 26; return;
-    case 30: top->state = 27; return;
-    case 32: top->state = 28; return;
+state_42:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 6: state = 43; if (++token_index < number_of_tokens) goto state_40; goto done;
+    case 7: state = 44; if (++token_index < number_of_tokens) goto state_40; goto done;
+    case 8: state = 45; if (++token_index < number_of_tokens) goto state_40; goto done;
+    case 9: state = 46; if (++token_index < number_of_tokens) goto state_40; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 5);
-        return;
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_40(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 47; return;
-    case 28: top->state = 48; return;
-    case 30: top->state = 49; return;
-    case 32: top->state = 50; return;
+state_6:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 7; if (++token_index < number_of_tokens) goto state_7; goto done;
+    case 28: state = 8; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 30: state = 9; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 32: state = 10; if (++token_index < number_of_tokens) goto state_8; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 5);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 5);
+        state = 69;
+        goto state_69;
+    }
+state_32:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 33; if (++token_index < number_of_tokens) goto state_33; goto done;
+    case 28: state = 26; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 30: state = 27; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 32: state = 28; if (++token_index < number_of_tokens) goto state_26; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 5);
+        state = 69;
+        goto state_69;
+    }
+state_40:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 27: state = 47; if (++token_index < number_of_tokens) goto state_47; goto done;
+    case 28: state = 48; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 30: state = 49; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 32: state = 50; if (++token_index < number_of_tokens) goto state_48; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 5);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_70(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_70:
+    run->states[token_index] = state;
     if (!(1 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 114; return;
-    case 28: top->state = 115; return;
-    case 30: top->state = 116; return;
-    case 32: top->state = 117; return;
+    switch (run->tokens[token_index]) {
+    case 27: state = 114; if (++token_index < number_of_tokens) goto state_114; goto done;
+    case 28: state = 115; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 30: state = 116; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 32: state = 117; if (++token_index < number_of_tokens) goto state_115; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 5);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 5);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_83(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_83:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 74; return;
-    case 28: top->state = 75; return;
-    case 30: top->state = 77; return;
-    case 32: top->state = 78; return;
+    switch (run->tokens[token_index]) {
+    case 27: state = 74; if (++token_index < number_of_tokens) goto state_74; goto done;
+    case 28: state = 75; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 30: state = 77; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 32: state = 78; if (++token_index < number_of_tokens) goto state_75; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 5);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 5);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_97(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_97:
+    run->states[token_index] = state;
     if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 98; return;
-    case 28: top->state = 99; return;
-    case 30: top->state = 100; return;
-    case 32: top->state = 101; return;
+    switch (run->tokens[token_index]) {
+    case 27: state = 98; if (++token_index < number_of_tokens) goto state_98; goto done;
+    case 28: state = 99; if (++token_index < number_of_tokens) goto state_99; goto done;
+    case 30: state = 100; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 32: state = 101; if (++token_index < number_of_tokens) goto state_100; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 5);
-        return;
-    }
-}
-static void state_func_0(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 23: top->state = 1; return;
-    case 24: top->state = 2; return;
-    case 25: top->state = 3; return;
-    case 26: top->state = 4; return;
-    case 27: top->state = 5; return;
-    default: top->cont->error = 1; return;
-    }
-}
-static void state_func_4(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 23: top->state = 1; return;
-    case 24: top->state = 2; return;
-    case 25: top->state = 3; return;
-    case 26: top->state = 4; return;
-    case 27: top->state = 5; return;
-    case 28: top->state = 64; return;
-    default: top->cont->error = 1; return;
-    }
-}
-static void state_func_65(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 23: top->state = 1; return;
-    case 24: top->state = 2; return;
-    case 25: top->state = 3; return;
-    case 26: top->state = 4; return;
-    case 27: top->state = 5; return;
-    case 28: top->state = 66; return;
-    default: top->cont->error = 1; return;
-    }
-}
-static void state_func_72(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
-    }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 21: top->state = 73; return;
-    case 27: top->state = 74; return;
-    case 28: top->state = 75; return;
-    case 29: top->state = 76; return;
-    case 30: top->state = 77; return;
-    case 32: top->state = 78; return;
+        top->state = state;
+        top = bracket_entry_state(cont, 5);
+        state = 69;
+        goto state_69;
+    }
+state_0:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 23: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 24: state = 2; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 25: state = 3; if (++token_index < number_of_tokens) goto state_3; goto done;
+    case 26: state = 4; if (++token_index < number_of_tokens) goto state_4; goto done;
+    case 27: state = 5; if (++token_index < number_of_tokens) goto state_5; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 5);
-        return;
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_23(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 2: top->state = 24; return;
-    case 23: top->state = 1; return;
-    case 24: top->state = 2; return;
-    case 25: top->state = 3; return;
-    case 26: top->state = 4; return;
-    case 27: top->state = 25; return;
-    case 28: top->state = 26; return;
-    case 30: top->state = 27; return;
-    case 32: top->state = 28; return;
+state_4:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 23: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 24: state = 2; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 25: state = 3; if (++token_index < number_of_tokens) goto state_3; goto done;
+    case 26: state = 4; if (++token_index < number_of_tokens) goto state_4; goto done;
+    case 27: state = 5; if (++token_index < number_of_tokens) goto state_5; goto done;
+    case 28: state = 64; if (++token_index < number_of_tokens) goto state_4; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 5);
-        return;
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_57(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 2: top->state = 24; return;
-    case 23: top->state = 1; return;
-    case 24: top->state = 2; return;
-    case 25: top->state = 3; return;
-    case 26: top->state = 4; return;
-    case 27: top->state = 58; return;
-    case 28: top->state = 48; return;
-    case 30: top->state = 49; return;
-    case 32: top->state = 50; return;
+state_65:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 23: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 24: state = 2; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 25: state = 3; if (++token_index < number_of_tokens) goto state_3; goto done;
+    case 26: state = 4; if (++token_index < number_of_tokens) goto state_4; goto done;
+    case 27: state = 5; if (++token_index < number_of_tokens) goto state_5; goto done;
+    case 28: state = 66; if (++token_index < number_of_tokens) goto state_65; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 5);
-        return;
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_26(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 11; return;
-    case 16: top->state = 29; return;
-    case 17: top->state = 30; return;
-    case 18: top->state = 31; return;
-    case 22: top->state = 32; return;
-    case 27: top->state = 33; return;
-    case 28: top->state = 26; return;
-    case 30: top->state = 27; return;
-    case 31: top->state = 34; return;
-    case 32: top->state = 28; return;
-    default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+state_72:
+    run->states[token_index] = state;
+    if (!(2 & top->reachability_mask[0])) {
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-}
-static void state_func_48(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 51; return;
-    case 16: top->state = 52; return;
-    case 17: top->state = 53; return;
-    case 18: top->state = 54; return;
-    case 22: top->state = 55; return;
-    case 27: top->state = 47; return;
-    case 28: top->state = 48; return;
-    case 30: top->state = 49; return;
-    case 31: top->state = 56; return;
-    case 32: top->state = 50; return;
+    switch (run->tokens[token_index]) {
+    case 21: state = 73; if (++token_index < number_of_tokens) goto state_73; goto done;
+    case 27: state = 74; if (++token_index < number_of_tokens) goto state_74; goto done;
+    case 28: state = 75; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 29: state = 76; if (++token_index < number_of_tokens) goto state_76; goto done;
+    case 30: state = 77; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 32: state = 78; if (++token_index < number_of_tokens) goto state_75; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
-    }
-}
-static void state_func_33(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 11; return;
-    case 10: top->state = 35; return;
-    case 11: top->state = 36; return;
-    case 16: top->state = 29; return;
-    case 17: top->state = 30; return;
-    case 18: top->state = 31; return;
-    case 22: top->state = 32; return;
-    case 27: top->state = 33; return;
-    case 28: top->state = 26; return;
-    case 30: top->state = 27; return;
-    case 31: top->state = 34; return;
-    case 32: top->state = 28; return;
+        top->state = state;
+        top = bracket_entry_state(cont, 5);
+        state = 69;
+        goto state_69;
+    }
+state_23:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 2: state = 24; if (++token_index < number_of_tokens) goto state_24; goto done;
+    case 23: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 24: state = 2; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 25: state = 3; if (++token_index < number_of_tokens) goto state_3; goto done;
+    case 26: state = 4; if (++token_index < number_of_tokens) goto state_4; goto done;
+    case 27: state = 25; if (++token_index < number_of_tokens) goto state_25; goto done;
+    case 28: state = 26; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 30: state = 27; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 32: state = 28; if (++token_index < number_of_tokens) goto state_26; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
-    }
-}
-static void state_func_47(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 51; return;
-    case 10: top->state = 59; return;
-    case 11: top->state = 60; return;
-    case 16: top->state = 52; return;
-    case 17: top->state = 53; return;
-    case 18: top->state = 54; return;
-    case 22: top->state = 55; return;
-    case 27: top->state = 47; return;
-    case 28: top->state = 48; return;
-    case 30: top->state = 49; return;
-    case 31: top->state = 56; return;
-    case 32: top->state = 50; return;
+        top->state = state;
+        top = bracket_entry_state(cont, 5);
+        state = 69;
+        goto state_69;
+    }
+state_57:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 2: state = 24; if (++token_index < number_of_tokens) goto state_24; goto done;
+    case 23: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 24: state = 2; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 25: state = 3; if (++token_index < number_of_tokens) goto state_3; goto done;
+    case 26: state = 4; if (++token_index < number_of_tokens) goto state_4; goto done;
+    case 27: state = 58; if (++token_index < number_of_tokens) goto state_58; goto done;
+    case 28: state = 48; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 30: state = 49; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 32: state = 50; if (++token_index < number_of_tokens) goto state_48; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
-    }
-}
-static void state_func_25(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 0: top->state = 6; return;
-    case 1: top->state = 11; return;
-    case 10: top->state = 35; return;
-    case 11: top->state = 36; return;
-    case 16: top->state = 29; return;
-    case 17: top->state = 30; return;
-    case 18: top->state = 31; return;
-    case 22: top->state = 32; return;
-    case 27: top->state = 33; return;
-    case 28: top->state = 26; return;
-    case 30: top->state = 27; return;
-    case 31: top->state = 34; return;
-    case 32: top->state = 28; return;
+        top->state = state;
+        top = bracket_entry_state(cont, 5);
+        state = 69;
+        goto state_69;
+    }
+state_26:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 1: state = 11; if (++token_index < number_of_tokens) goto state_11; goto done;
+    case 16: state = 29; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 17: state = 30; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 18: state = 31; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 22: state = 32; if (++token_index < number_of_tokens) goto state_32; goto done;
+    case 27: state = 33; if (++token_index < number_of_tokens) goto state_33; goto done;
+    case 28: state = 26; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 30: state = 27; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 31: state = 34; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 32: state = 28; if (++token_index < number_of_tokens) goto state_26; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
-    }
-}
-static void state_func_58(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 0: top->state = 6; return;
-    case 1: top->state = 51; return;
-    case 10: top->state = 59; return;
-    case 11: top->state = 60; return;
-    case 16: top->state = 52; return;
-    case 17: top->state = 53; return;
-    case 18: top->state = 54; return;
-    case 22: top->state = 55; return;
-    case 27: top->state = 47; return;
-    case 28: top->state = 48; return;
-    case 30: top->state = 49; return;
-    case 31: top->state = 56; return;
-    case 32: top->state = 50; return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_48:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 1: state = 51; if (++token_index < number_of_tokens) goto state_51; goto done;
+    case 16: state = 52; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 17: state = 53; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 18: state = 54; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 22: state = 55; if (++token_index < number_of_tokens) goto state_40; goto done;
+    case 27: state = 47; if (++token_index < number_of_tokens) goto state_47; goto done;
+    case 28: state = 48; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 30: state = 49; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 31: state = 56; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 32: state = 50; if (++token_index < number_of_tokens) goto state_48; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
-    }
-}
-static void state_func_8(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 11; return;
-    case 16: top->state = 12; return;
-    case 17: top->state = 13; return;
-    case 18: top->state = 14; return;
-    case 22: top->state = 15; return;
-    case 23: top->state = 1; return;
-    case 24: top->state = 2; return;
-    case 25: top->state = 3; return;
-    case 26: top->state = 4; return;
-    case 27: top->state = 16; return;
-    case 28: top->state = 8; return;
-    case 30: top->state = 9; return;
-    case 31: top->state = 17; return;
-    case 32: top->state = 10; return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_33:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 1: state = 11; if (++token_index < number_of_tokens) goto state_11; goto done;
+    case 10: state = 35; if (++token_index < number_of_tokens) goto state_35; goto done;
+    case 11: state = 36; if (++token_index < number_of_tokens) goto state_36; goto done;
+    case 16: state = 29; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 17: state = 30; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 18: state = 31; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 22: state = 32; if (++token_index < number_of_tokens) goto state_32; goto done;
+    case 27: state = 33; if (++token_index < number_of_tokens) goto state_33; goto done;
+    case 28: state = 26; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 30: state = 27; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 31: state = 34; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 32: state = 28; if (++token_index < number_of_tokens) goto state_26; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
-    }
-}
-static void state_func_7(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 11; return;
-    case 10: top->state = 18; return;
-    case 11: top->state = 19; return;
-    case 16: top->state = 12; return;
-    case 17: top->state = 13; return;
-    case 18: top->state = 14; return;
-    case 22: top->state = 15; return;
-    case 23: top->state = 1; return;
-    case 24: top->state = 2; return;
-    case 25: top->state = 3; return;
-    case 26: top->state = 4; return;
-    case 27: top->state = 16; return;
-    case 28: top->state = 8; return;
-    case 30: top->state = 9; return;
-    case 31: top->state = 17; return;
-    case 32: top->state = 10; return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_47:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 1: state = 51; if (++token_index < number_of_tokens) goto state_51; goto done;
+    case 10: state = 59; if (++token_index < number_of_tokens) goto state_59; goto done;
+    case 11: state = 60; if (++token_index < number_of_tokens) goto state_60; goto done;
+    case 16: state = 52; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 17: state = 53; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 18: state = 54; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 22: state = 55; if (++token_index < number_of_tokens) goto state_40; goto done;
+    case 27: state = 47; if (++token_index < number_of_tokens) goto state_47; goto done;
+    case 28: state = 48; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 30: state = 49; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 31: state = 56; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 32: state = 50; if (++token_index < number_of_tokens) goto state_48; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
-    }
-}
-static void state_func_16(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 0: top->state = 6; return;
-    case 1: top->state = 11; return;
-    case 10: top->state = 18; return;
-    case 11: top->state = 19; return;
-    case 16: top->state = 12; return;
-    case 17: top->state = 13; return;
-    case 18: top->state = 14; return;
-    case 22: top->state = 15; return;
-    case 23: top->state = 1; return;
-    case 24: top->state = 2; return;
-    case 25: top->state = 3; return;
-    case 26: top->state = 4; return;
-    case 27: top->state = 16; return;
-    case 28: top->state = 8; return;
-    case 30: top->state = 9; return;
-    case 31: top->state = 17; return;
-    case 32: top->state = 10; return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_25:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 0: state = 6; if (++token_index < number_of_tokens) goto state_6; goto done;
+    case 1: state = 11; if (++token_index < number_of_tokens) goto state_11; goto done;
+    case 10: state = 35; if (++token_index < number_of_tokens) goto state_35; goto done;
+    case 11: state = 36; if (++token_index < number_of_tokens) goto state_36; goto done;
+    case 16: state = 29; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 17: state = 30; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 18: state = 31; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 22: state = 32; if (++token_index < number_of_tokens) goto state_32; goto done;
+    case 27: state = 33; if (++token_index < number_of_tokens) goto state_33; goto done;
+    case 28: state = 26; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 30: state = 27; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 31: state = 34; if (++token_index < number_of_tokens) goto state_26; goto done;
+    case 32: state = 28; if (++token_index < number_of_tokens) goto state_26; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
-    }
-}
-static void state_func_73(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
-    }
-    if (top->cont->top_index == 0) {
-        top->cont->error = 1;
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_58:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 0: state = 6; if (++token_index < number_of_tokens) goto state_6; goto done;
+    case 1: state = 51; if (++token_index < number_of_tokens) goto state_51; goto done;
+    case 10: state = 59; if (++token_index < number_of_tokens) goto state_59; goto done;
+    case 11: state = 60; if (++token_index < number_of_tokens) goto state_60; goto done;
+    case 16: state = 52; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 17: state = 53; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 18: state = 54; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 22: state = 55; if (++token_index < number_of_tokens) goto state_40; goto done;
+    case 27: state = 47; if (++token_index < number_of_tokens) goto state_47; goto done;
+    case 28: state = 48; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 30: state = 49; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 31: state = 56; if (++token_index < number_of_tokens) goto state_48; goto done;
+    case 32: state = 50; if (++token_index < number_of_tokens) goto state_48; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_8:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 1: state = 11; if (++token_index < number_of_tokens) goto state_11; goto done;
+    case 16: state = 12; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 17: state = 13; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 18: state = 14; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 22: state = 15; if (++token_index < number_of_tokens) goto state_6; goto done;
+    case 23: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 24: state = 2; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 25: state = 3; if (++token_index < number_of_tokens) goto state_3; goto done;
+    case 26: state = 4; if (++token_index < number_of_tokens) goto state_4; goto done;
+    case 27: state = 16; if (++token_index < number_of_tokens) goto state_16; goto done;
+    case 28: state = 8; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 30: state = 9; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 31: state = 17; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 32: state = 10; if (++token_index < number_of_tokens) goto state_8; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_7:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 1: state = 11; if (++token_index < number_of_tokens) goto state_11; goto done;
+    case 10: state = 18; if (++token_index < number_of_tokens) goto state_18; goto done;
+    case 11: state = 19; if (++token_index < number_of_tokens) goto state_19; goto done;
+    case 16: state = 12; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 17: state = 13; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 18: state = 14; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 22: state = 15; if (++token_index < number_of_tokens) goto state_6; goto done;
+    case 23: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 24: state = 2; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 25: state = 3; if (++token_index < number_of_tokens) goto state_3; goto done;
+    case 26: state = 4; if (++token_index < number_of_tokens) goto state_4; goto done;
+    case 27: state = 16; if (++token_index < number_of_tokens) goto state_16; goto done;
+    case 28: state = 8; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 30: state = 9; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 31: state = 17; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 32: state = 10; if (++token_index < number_of_tokens) goto state_8; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_16:
+    run->states[token_index] = state;
+    switch (run->tokens[token_index]) {
+    case 0: state = 6; if (++token_index < number_of_tokens) goto state_6; goto done;
+    case 1: state = 11; if (++token_index < number_of_tokens) goto state_11; goto done;
+    case 10: state = 18; if (++token_index < number_of_tokens) goto state_18; goto done;
+    case 11: state = 19; if (++token_index < number_of_tokens) goto state_19; goto done;
+    case 16: state = 12; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 17: state = 13; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 18: state = 14; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 22: state = 15; if (++token_index < number_of_tokens) goto state_6; goto done;
+    case 23: state = 1; if (++token_index < number_of_tokens) goto state_1; goto done;
+    case 24: state = 2; if (++token_index < number_of_tokens) goto state_2; goto done;
+    case 25: state = 3; if (++token_index < number_of_tokens) goto state_3; goto done;
+    case 26: state = 4; if (++token_index < number_of_tokens) goto state_4; goto done;
+    case 27: state = 16; if (++token_index < number_of_tokens) goto state_16; goto done;
+    case 28: state = 8; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 30: state = 9; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 31: state = 17; if (++token_index < number_of_tokens) goto state_8; goto done;
+    case 32: state = 10; if (++token_index < number_of_tokens) goto state_8; goto done;
+    default:
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_73:
+    run->states[token_index] = state;
+    if (cont->top_index == 0) {
+        top->state = state;
+        cont->error = 2;
+        *failing_index = token_index;
+        return false;
     }
-    top->cont->top_index--;
+    cont->top_index--;
     top--;
     run->tokens[token_index] = 31;
-    run->states[token_index] = top->state;
-    state_funcs[top->state](run, top, token_index);
-    return;
-}
-static void state_func_100(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+    state = top->state;
+    goto dispatch;
+state_100:
+    run->states[token_index] = state;
     if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 16: top->state = 102; return;
-    case 17: top->state = 103; return;
-    case 18: top->state = 104; return;
-    case 22: top->state = 105; return;
-    case 27: top->state = 98; return;
-    case 28: top->state = 106; return;
-    case 30: top->state = 100; return;
-    case 31: top->state = 107; return;
-    case 32: top->state = 101; return;
+    switch (run->tokens[token_index]) {
+    case 16: state = 102; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 17: state = 103; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 18: state = 104; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 22: state = 105; if (++token_index < number_of_tokens) goto state_105; goto done;
+    case 27: state = 98; if (++token_index < number_of_tokens) goto state_98; goto done;
+    case 28: state = 106; if (++token_index < number_of_tokens) goto state_99; goto done;
+    case 30: state = 100; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 31: state = 107; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 32: state = 101; if (++token_index < number_of_tokens) goto state_100; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_115(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_115:
+    run->states[token_index] = state;
     if (!(1 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 13: top->state = 118; return;
-    case 16: top->state = 119; return;
-    case 17: top->state = 120; return;
-    case 18: top->state = 121; return;
-    case 22: top->state = 122; return;
-    case 27: top->state = 114; return;
-    case 28: top->state = 115; return;
-    case 30: top->state = 116; return;
-    case 31: top->state = 123; return;
-    case 32: top->state = 117; return;
+    switch (run->tokens[token_index]) {
+    case 13: state = 118; if (++token_index < number_of_tokens) goto state_118; goto done;
+    case 16: state = 119; if (++token_index < number_of_tokens) goto state_119; goto done;
+    case 17: state = 120; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 18: state = 121; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 22: state = 122; if (++token_index < number_of_tokens) goto state_70; goto done;
+    case 27: state = 114; if (++token_index < number_of_tokens) goto state_114; goto done;
+    case 28: state = 115; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 30: state = 116; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 31: state = 123; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 32: state = 117; if (++token_index < number_of_tokens) goto state_115; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_99(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_99:
+    run->states[token_index] = state;
     if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 15: top->state = 108; return;
-    case 16: top->state = 102; return;
-    case 17: top->state = 103; return;
-    case 18: top->state = 104; return;
-    case 22: top->state = 105; return;
-    case 27: top->state = 98; return;
-    case 28: top->state = 106; return;
-    case 30: top->state = 100; return;
-    case 31: top->state = 107; return;
-    case 32: top->state = 101; return;
+    switch (run->tokens[token_index]) {
+    case 15: state = 108; if (++token_index < number_of_tokens) goto state_108; goto done;
+    case 16: state = 102; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 17: state = 103; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 18: state = 104; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 22: state = 105; if (++token_index < number_of_tokens) goto state_105; goto done;
+    case 27: state = 98; if (++token_index < number_of_tokens) goto state_98; goto done;
+    case 28: state = 106; if (++token_index < number_of_tokens) goto state_99; goto done;
+    case 30: state = 100; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 31: state = 107; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 32: state = 101; if (++token_index < number_of_tokens) goto state_100; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_75(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_75:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 16: top->state = 79; return;
-    case 17: top->state = 80; return;
-    case 18: top->state = 81; return;
-    case 19: top->state = 82; return;
-    case 21: top->state = 73; return;
-    case 22: top->state = 83; return;
-    case 27: top->state = 74; return;
-    case 28: top->state = 75; return;
-    case 30: top->state = 77; return;
-    case 31: top->state = 84; return;
-    case 32: top->state = 78; return;
+    switch (run->tokens[token_index]) {
+    case 16: state = 79; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 17: state = 80; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 18: state = 81; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 19: state = 82; if (++token_index < number_of_tokens) goto state_82; goto done;
+    case 21: state = 73; if (++token_index < number_of_tokens) goto state_73; goto done;
+    case 22: state = 83; if (++token_index < number_of_tokens) goto state_83; goto done;
+    case 27: state = 74; if (++token_index < number_of_tokens) goto state_74; goto done;
+    case 28: state = 75; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 30: state = 77; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 31: state = 84; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 32: state = 78; if (++token_index < number_of_tokens) goto state_75; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_98(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_98:
+    run->states[token_index] = state;
     if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 10: top->state = 109; return;
-    case 11: top->state = 110; return;
-    case 16: top->state = 102; return;
-    case 17: top->state = 103; return;
-    case 18: top->state = 104; return;
-    case 22: top->state = 105; return;
-    case 27: top->state = 98; return;
-    case 28: top->state = 106; return;
-    case 30: top->state = 100; return;
-    case 31: top->state = 107; return;
-    case 32: top->state = 101; return;
+    switch (run->tokens[token_index]) {
+    case 10: state = 109; if (++token_index < number_of_tokens) goto state_109; goto done;
+    case 11: state = 110; if (++token_index < number_of_tokens) goto state_110; goto done;
+    case 16: state = 102; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 17: state = 103; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 18: state = 104; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 22: state = 105; if (++token_index < number_of_tokens) goto state_105; goto done;
+    case 27: state = 98; if (++token_index < number_of_tokens) goto state_98; goto done;
+    case 28: state = 106; if (++token_index < number_of_tokens) goto state_99; goto done;
+    case 30: state = 100; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 31: state = 107; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 32: state = 101; if (++token_index < number_of_tokens) goto state_100; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_114(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_114:
+    run->states[token_index] = state;
     if (!(1 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 10: top->state = 124; return;
-    case 11: top->state = 125; return;
-    case 13: top->state = 118; return;
-    case 16: top->state = 119; return;
-    case 17: top->state = 120; return;
-    case 18: top->state = 121; return;
-    case 22: top->state = 122; return;
-    case 27: top->state = 114; return;
-    case 28: top->state = 115; return;
-    case 30: top->state = 116; return;
-    case 31: top->state = 123; return;
-    case 32: top->state = 117; return;
+    switch (run->tokens[token_index]) {
+    case 10: state = 124; if (++token_index < number_of_tokens) goto state_124; goto done;
+    case 11: state = 125; if (++token_index < number_of_tokens) goto state_125; goto done;
+    case 13: state = 118; if (++token_index < number_of_tokens) goto state_118; goto done;
+    case 16: state = 119; if (++token_index < number_of_tokens) goto state_119; goto done;
+    case 17: state = 120; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 18: state = 121; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 22: state = 122; if (++token_index < number_of_tokens) goto state_70; goto done;
+    case 27: state = 114; if (++token_index < number_of_tokens) goto state_114; goto done;
+    case 28: state = 115; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 30: state = 116; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 31: state = 123; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 32: state = 117; if (++token_index < number_of_tokens) goto state_115; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_74(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_74:
+    run->states[token_index] = state;
     if (!(2 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 10: top->state = 92; return;
-    case 11: top->state = 93; return;
-    case 16: top->state = 79; return;
-    case 17: top->state = 80; return;
-    case 18: top->state = 81; return;
-    case 19: top->state = 82; return;
-    case 21: top->state = 73; return;
-    case 22: top->state = 83; return;
-    case 27: top->state = 74; return;
-    case 28: top->state = 75; return;
-    case 30: top->state = 77; return;
-    case 31: top->state = 84; return;
-    case 32: top->state = 78; return;
+    switch (run->tokens[token_index]) {
+    case 10: state = 92; if (++token_index < number_of_tokens) goto state_92; goto done;
+    case 11: state = 93; if (++token_index < number_of_tokens) goto state_93; goto done;
+    case 16: state = 79; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 17: state = 80; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 18: state = 81; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 19: state = 82; if (++token_index < number_of_tokens) goto state_82; goto done;
+    case 21: state = 73; if (++token_index < number_of_tokens) goto state_73; goto done;
+    case 22: state = 83; if (++token_index < number_of_tokens) goto state_83; goto done;
+    case 27: state = 74; if (++token_index < number_of_tokens) goto state_74; goto done;
+    case 28: state = 75; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 30: state = 77; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 31: state = 84; if (++token_index < number_of_tokens) goto state_75; goto done;
+    case 32: state = 78; if (++token_index < number_of_tokens) goto state_75; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
-    }
-}
-static void state_func_118(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    if (!(1 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
-    }
-    if (top->cont->top_index == 0) {
-        top->cont->error = 1;
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
+    }
+state_118:
+    run->states[token_index] = state;
+    if (cont->top_index == 0) {
+        top->state = state;
+        cont->error = 2;
+        *failing_index = token_index;
+        return false;
     }
-    top->cont->top_index--;
+    cont->top_index--;
     top--;
     run->tokens[token_index] = 30;
-    run->states[token_index] = top->state;
-    state_funcs[top->state](run, top, token_index);
-    return;
-}
-static void state_func_108(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
-    if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
-    }
-    if (top->cont->top_index == 0) {
-        top->cont->error = 1;
-        return;
+    state = top->state;
+    goto dispatch;
+state_108:
+    run->states[token_index] = state;
+    if (cont->top_index == 0) {
+        top->state = state;
+        cont->error = 2;
+        *failing_index = token_index;
+        return false;
     }
-    top->cont->top_index--;
+    cont->top_index--;
     top--;
     run->tokens[token_index] = 32;
-    run->states[token_index] = top->state;
-    state_funcs[top->state](run, top, token_index);
-    return;
-}
-static void state_func_109(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+    state = top->state;
+    goto dispatch;
+state_109:
+    run->states[token_index] = state;
     if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 1: top->state = 112; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 1: state = 112; if (++token_index < number_of_tokens) goto state_112; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_110(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_110:
+    run->states[token_index] = state;
     if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 27: top->state = 111; return;
-    default: top->cont->error = 1; return;
+    switch (run->tokens[token_index]) {
+    case 27: state = 111; if (++token_index < number_of_tokens) goto state_111; goto done;
+    default:
+        top->state = state;
+        cont->error = 1;
+        *failing_index = token_index;
+        return false;
     }
-}
-static void state_func_111(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_111:
+    run->states[token_index] = state;
     if (!(4 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 16: top->state = 102; return;
-    case 17: top->state = 103; return;
-    case 18: top->state = 104; return;
-    case 22: top->state = 105; return;
-    case 27: top->state = 98; return;
-    case 28: top->state = 106; return;
-    case 30: top->state = 100; return;
-    case 31: top->state = 107; return;
-    case 32: top->state = 101; return;
+    switch (run->tokens[token_index]) {
+    case 16: state = 102; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 17: state = 103; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 18: state = 104; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 22: state = 105; if (++token_index < number_of_tokens) goto state_105; goto done;
+    case 27: state = 98; if (++token_index < number_of_tokens) goto state_98; goto done;
+    case 28: state = 106; if (++token_index < number_of_tokens) goto state_99; goto done;
+    case 30: state = 100; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 31: state = 107; if (++token_index < number_of_tokens) goto state_100; goto done;
+    case 32: state = 101; if (++token_index < number_of_tokens) goto state_100; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_119(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_119:
+    run->states[token_index] = state;
     if (!(1 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 13: top->state = 118; return;
-    case 16: top->state = 119; return;
-    case 17: top->state = 120; return;
-    case 18: top->state = 121; return;
-    case 22: top->state = 122; return;
-    case 27: top->state = 114; return;
-    case 28: top->state = 115; return;
-    case 30: top->state = 116; return;
-    case 31: top->state = 123; return;
-    case 32: top->state = 117; return;
+    switch (run->tokens[token_index]) {
+    case 13: state = 118; if (++token_index < number_of_tokens) goto state_118; goto done;
+    case 16: state = 119; if (++token_index < number_of_tokens) goto state_119; goto done;
+    case 17: state = 120; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 18: state = 121; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 22: state = 122; if (++token_index < number_of_tokens) goto state_70; goto done;
+    case 27: state = 114; if (++token_index < number_of_tokens) goto state_114; goto done;
+    case 28: state = 115; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 30: state = 116; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 31: state = 123; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 32: state = 117; if (++token_index < number_of_tokens) goto state_115; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
     }
-}
-static void state_func_128(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {
+state_128:
+    run->states[token_index] = state;
     if (!(1 & top->reachability_mask[0])) {
-        top->cont->error = -1;
-        return;
+        cont->error = -1;
+        *failing_index = token_index - 1;
+        return false;
     }
-    uint32_t token = run->tokens[token_index];
-    switch (token) {
-    case 10: top->state = 124; return;
-    case 11: top->state = 125; return;
-    case 13: top->state = 118; return;
-    case 16: top->state = 119; return;
-    case 17: top->state = 120; return;
-    case 18: top->state = 121; return;
-    case 22: top->state = 122; return;
-    case 27: top->state = 114; return;
-    case 28: top->state = 115; return;
-    case 30: top->state = 116; return;
-    case 31: top->state = 123; return;
-    case 32: top->state = 117; return;
+    switch (run->tokens[token_index]) {
+    case 10: state = 124; if (++token_index < number_of_tokens) goto state_124; goto done;
+    case 11: state = 125; if (++token_index < number_of_tokens) goto state_125; goto done;
+    case 13: state = 118; if (++token_index < number_of_tokens) goto state_118; goto done;
+    case 16: state = 119; if (++token_index < number_of_tokens) goto state_119; goto done;
+    case 17: state = 120; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 18: state = 121; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 22: state = 122; if (++token_index < number_of_tokens) goto state_70; goto done;
+    case 27: state = 114; if (++token_index < number_of_tokens) goto state_114; goto done;
+    case 28: state = 115; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 30: state = 116; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 31: state = 123; if (++token_index < number_of_tokens) goto state_115; goto done;
+    case 32: state = 117; if (++token_index < number_of_tokens) goto state_115; goto done;
     default:
-        bracket_entry_state(run, top, token_index, 7);
-        return;
+        top->state = state;
+        top = bracket_entry_state(cont, 7);
+        state = 69;
+        goto state_69;
     }
-}
-static void (*state_funcs[129])(struct owl_token_run *, struct fill_run_state *, uint16_t) = {
-    state_func_0, state_func_1, state_func_2, state_func_3,
-    state_func_4, state_func_5, state_func_6, state_func_7,
-    state_func_8, state_func_8, state_func_8, state_func_11,
-    state_func_8, state_func_8, state_func_8, state_func_6,
-    state_func_16, state_func_8, state_func_18, state_func_19,
-    state_func_8, state_func_21, state_func_7, state_func_23,
-    state_func_24, state_func_25, state_func_26, state_func_26,
-    state_func_26, state_func_26, state_func_26, state_func_26,
-    state_func_32, state_func_33, state_func_26, state_func_35,
-    state_func_36, state_func_26, state_func_38, state_func_33,
-    state_func_40, state_func_40, state_func_42, state_func_40,
-    state_func_40, state_func_40, state_func_40, state_func_47,
-    state_func_48, state_func_48, state_func_48, state_func_51,
-    state_func_48, state_func_48, state_func_48, state_func_40,
-    state_func_48, state_func_57, state_func_58, state_func_59,
-    state_func_60, state_func_48, state_func_62, state_func_47,
-    state_func_4, state_func_65, state_func_65, state_func_0,
-    state_func_0, state_func_69, state_func_70, state_func_71,
-    state_func_72, state_func_73, state_func_74, state_func_75,
-    state_func_76, state_func_75, state_func_75, state_func_75,
-    state_func_75, state_func_75, state_func_82, state_func_83,
-    state_func_75, state_func_85, state_func_86, state_func_87,
-    state_func_86, state_func_86, state_func_90, state_func_86,
-    state_func_92, state_func_93, state_func_75, state_func_95,
-    state_func_74, state_func_97, state_func_98, state_func_99,
-    state_func_100, state_func_100, state_func_100, state_func_100,
-    state_func_100, state_func_105, state_func_99, state_func_100,
-    state_func_108, state_func_109, state_func_110, state_func_111,
-    state_func_112, state_func_98, state_func_114, state_func_115,
-    state_func_115, state_func_115, state_func_118, state_func_119,
-    state_func_115, state_func_115, state_func_70, state_func_115,
-    state_func_124, state_func_125, state_func_115, state_func_127,
-    state_func_128,};
-static void bracket_entry_state(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index, uint32_t mask0) {
-    struct fill_run_continuation *cont = top->cont;
-    cont->top_index++;
-    if (cont->top_index >= cont->capacity) {
-        size_t new_capacity = (cont->capacity + 2) * 3 / 2;
-        if (new_capacity <= cont->capacity)
-            abort();
-        struct fill_run_state *new_states = realloc(cont->stack, new_capacity * sizeof(struct fill_run_state));
-        if (!new_states)
-            abort();
-        cont->stack = new_states;
-        cont->capacity = new_capacity;
-        top = &cont->stack[cont->top_index];
-    } else
-        top++;
-    top->cont = cont;
-    top->reachability_mask[0] = mask0;
-    run->states[token_index] = 69;
-    state_func_69(run, top, token_index);
-    if (top->cont->error == -1)
-        top->cont->error = 1;
+done:
+    top->state = state;
+    return true;
 }
 static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index);
-static size_t build_parse_tree(struct owl_default_tokenizer *, struct owl_token_run *, struct owl_tree *);
+struct owl_parser;
+static size_t build_parse_tree(struct owl_parser *parser);
 
-static struct owl_tree *owl_tree_create_empty(void) {
-    return calloc(1, sizeof(struct owl_tree));
+static struct owl_tree *owl_tree_create_empty(struct owl_allocator allocator) {
+    struct owl_tree *tree = allocate_memory(sizeof(struct owl_tree), &allocator);
+    if (!tree)
+        abort();
+    *tree = (struct owl_tree){ .allocator = allocator };
+    return tree;
 }
-
-static void free_token_runs(struct owl_token_run **run) {
-    while (*run) {
-        struct owl_token_run *prev = (*run)->prev;
-        free(*run);
-        *run = prev;
-    }
+#ifdef OWL_INDEX
+static struct rule_index *create_rule_index(struct owl_allocator *allocator) {
+    struct rule_index *index = allocate_memory(sizeof(struct rule_index), allocator);
+    if (!index)
+        abort();
+    *index = (struct rule_index){ 0 };
+    return index;
 }
-static void parse_string(struct owl_tree *tree, const char *string) {
-    tree->string = string;
+static struct location_index *create_location_index(struct owl_allocator *allocator) {
+    struct location_index *index = allocate_memory(sizeof(struct location_index), allocator);
+    if (!index)
+        abort();
+    *index = (struct location_index){ .nodes.keeps_ends = true };
+    return index;
+}
+static void free_match_list(struct match_list *list, struct owl_allocator *allocator) {
+    free_memory(list->matches, list->capacity * sizeof(struct owl_ref), allocator);
+    free_memory(list->starts, list->capacity * sizeof(size_t), allocator);
+    if (list->keeps_ends)
+        free_memory(list->ends, list->capacity * sizeof(size_t), allocator);
+    free_memory(list->late, list->late_capacity * sizeof(struct match_to_sort), allocator);
+}
+#endif
+
+// The streaming parser waits for about this many bytes of new input before
+// tokenizing again, so token runs don't end up mostly empty.
+#ifndef FEED_BATCH_SIZE
+#define FEED_BATCH_SIZE 16384
+#endif
+#ifdef OWL_THREADS
+// Where the tokenizer was after each token run, for reporting errors in runs
+// other than the last one.
+struct run_end {
+    size_t offset;
+    size_t whitespace;
+};
+#endif
+struct owl_parser {
+    struct owl_tree *tree;
+    struct owl_allocator allocator;
+    struct owl_default_tokenizer tokenizer;
+    struct owl_token_run *token_run;
+    struct fill_run_continuation cont;
+    // The state stack and construct pools are only used while building the
+    // tree, but they're kept (along with the token runs and the fill_run stack)
+    // so later parses don't have to allocate them again.
+    uint32_t *state_stack;
+    size_t state_stack_capacity;
+    struct construct_state construct_state;
+    // Set once owl_parser_parse has built a tree, until the next reset.
+    bool finished;
+    // When validating, token runs are recycled as soon as they've been checked and
+    // no tree is built.
+    bool validating;
+    char *buffer;
+    size_t length;
+    size_t capacity;
+    size_t resume_length;
+};
+static void start_parsing(struct owl_parser *parser, struct owl_tree *tree) {
     tree->next_offset = 1;
-    struct owl_default_tokenizer tokenizer = {
-        .text = string,
+    parser->tree = tree;
+    parser->tokenizer = (struct owl_default_tokenizer){
         .info = tree,
+        .lookahead = 19,
+        .free_runs = parser->tokenizer.free_runs,
+        .allocator = &parser->allocator,
     };
-    struct owl_token_run *token_run = 0;
-    struct fill_run_continuation c = {
-        .capacity = 8,
-        .top_index = 0,
+    parser->token_run = 0;
+    parser->cont.allocator = &parser->allocator;
+    parser->construct_state.allocator = &parser->allocator;
+    if (!parser->cont.stack) {
+        parser->cont.capacity = 8;
+        parser->cont.stack = allocate_memory(parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);
+        if (!parser->cont.stack)
+            abort();
+    }
+    parser->cont.top_index = 0;
+    parser->cont.error = 0;
+    parser->cont.stack[0] = (struct fill_run_state){
+        .state = 0,
+        .cont = &parser->cont,
     };
-    c.stack = calloc(c.capacity, sizeof(struct fill_run_state));
-    c.stack[0].state = 0;
-    c.stack[0].cont = &c;
+}
+// Moves the parser's token runs to the tokenizer's free list.
+static void recycle_token_runs(struct owl_parser *parser) {
+    while (parser->token_run) {
+        struct owl_token_run *run = parser->token_run;
+        parser->token_run = run->prev;
+        run->prev = parser->tokenizer.free_runs;
+        parser->tokenizer.free_runs = run;
+    }
+}
+// Throws away the token runs and the token data written to the tree, which
+// aren't kept when validating.  The token lists start over too.
+static void discard_tokens(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    recycle_token_runs(parser);
+    tree->next_offset = 1;
+    tree->next_identifier_token_offset = 0;
+    tree->next_string_token_offset = 0;
+    tree->next_integer_token_offset = 0;
+}
+// Frees the memory kept between parses (but not the tree or input buffer).
+static void free_parser_memory(struct owl_parser *parser) {
+    free_token_runs(&parser->token_run, &parser->allocator);
+    free_token_runs(&parser->tokenizer.free_runs, &parser->allocator);
+    free_memory(parser->cont.stack, parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);
+    free_memory(parser->state_stack, parser->state_stack_capacity * sizeof(uint32_t), &parser->allocator);
+    construct_free_pools(&parser->construct_state);
+}
+// Tokenizes as much of the text as possible, running each token run through
+// the state machine.  Set `more_input` if more text will follow `length`.
+static bool parse_text(struct owl_parser *parser, const char *text, size_t length, bool more_input) {
+    struct owl_tree *tree = parser->tree;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    tokenizer->text = text;
+    tokenizer->length = length;
+    tokenizer->more_input = more_input;
     uint16_t failing_index = 0;
-    while (owl_default_tokenizer_advance(&tokenizer, &token_run)) {
-        if (!fill_run_states(token_run, &c, &failing_index)) {
-            free(c.stack);
+    while (owl_default_tokenizer_advance(tokenizer, &parser->token_run)) {
+        if (!fill_run_states(parser->token_run, &parser->cont, &failing_index)) {
             tree->error = ERROR_UNEXPECTED_TOKEN;
-            find_token_range(&tokenizer, token_run, failing_index, &tree->error_range.start, &tree->error_range.end);
-            free_token_runs(&token_run);
-            return;
+            find_token_range(tokenizer, parser->token_run, failing_index, &tree->error_range.start, &tree->error_range.end);
+            return false;
+        }
+        if (parser->validating) {
+            // Only the tokenizer's position is needed to report later errors, so
+            // the run and its token data can be reused.
+            discard_tokens(parser);
         }
     }
-    struct fill_run_state top = c.stack[c.top_index];
-    free(c.stack);
-    if (string[tokenizer.offset] != '\0') {
+    if (tokenizer->deferred)
+        return true;
+    if (tokenizer->offset < length) {
         tree->error = ERROR_INVALID_TOKEN;
-        estimate_next_token_range(&tokenizer, &tree->error_range.start, &tree->error_range.end);
-        free_token_runs(&token_run);
+        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);
+        return false;
+    }
+    return true;
+}
+#ifdef OWL_THREADS
+struct speculative_base {
+    uint32_t state;
+    uint32_t reachability_mask[1];
+};
+static const struct speculative_base speculative_bases[183] = {
+    { 0, { 0 } },
+    { 1, { 0 } },
+    { 2, { 0 } },
+    { 3, { 0 } },
+    { 4, { 0 } },
+    { 5, { 0 } },
+    { 6, { 0 } },
+    { 7, { 0 } },
+    { 8, { 0 } },
+    { 9, { 0 } },
+    { 10, { 0 } },
+    { 11, { 0 } },
+    { 12, { 0 } },
+    { 13, { 0 } },
+    { 14, { 0 } },
+    { 15, { 0 } },
+    { 16, { 0 } },
+    { 17, { 0 } },
+    { 18, { 0 } },
+    { 19, { 0 } },
+    { 20, { 0 } },
+    { 21, { 0 } },
+    { 22, { 0 } },
+    { 23, { 0 } },
+    { 24, { 0 } },
+    { 25, { 0 } },
+    { 26, { 0 } },
+    { 27, { 0 } },
+    { 28, { 0 } },
+    { 29, { 0 } },
+    { 30, { 0 } },
+    { 31, { 0 } },
+    { 32, { 0 } },
+    { 33, { 0 } },
+    { 34, { 0 } },
+    { 35, { 0 } },
+    { 36, { 0 } },
+    { 37, { 0 } },
+    { 38, { 0 } },
+    { 39, { 0 } },
+    { 40, { 0 } },
+    { 41, { 0 } },
+    { 42, { 0 } },
+    { 43, { 0 } },
+    { 44, { 0 } },
+    { 45, { 0 } },
+    { 46, { 0 } },
+    { 47, { 0 } },
+    { 48, { 0 } },
+    { 49, { 0 } },
+    { 50, { 0 } },
+    { 51, { 0 } },
+    { 52, { 0 } },
+    { 53, { 0 } },
+    { 54, { 0 } },
+    { 55, { 0 } },
+    { 56, { 0 } },
+    { 57, { 0 } },
+    { 58, { 0 } },
+    { 59, { 0 } },
+    { 60, { 0 } },
+    { 61, { 0 } },
+    { 62, { 0 } },
+    { 63, { 0 } },
+    { 64, { 0 } },
+    { 65, { 0 } },
+    { 66, { 0 } },
+    { 67, { 0 } },
+    { 68, { 0 } },
+    { 69, {5} },
+    { 69, {7} },
+    { 70, {5} },
+    { 70, {7} },
+    { 71, {5} },
+    { 71, {7} },
+    { 72, {5} },
+    { 72, {7} },
+    { 74, {5} },
+    { 74, {7} },
+    { 75, {5} },
+    { 75, {7} },
+    { 76, {5} },
+    { 76, {7} },
+    { 77, {5} },
+    { 77, {7} },
+    { 78, {5} },
+    { 78, {7} },
+    { 79, {5} },
+    { 79, {7} },
+    { 80, {5} },
+    { 80, {7} },
+    { 81, {5} },
+    { 81, {7} },
+    { 82, {5} },
+    { 82, {7} },
+    { 83, {5} },
+    { 83, {7} },
+    { 84, {5} },
+    { 84, {7} },
+    { 85, {5} },
+    { 85, {7} },
+    { 86, {5} },
+    { 86, {7} },
+    { 87, {5} },
+    { 87, {7} },
+    { 88, {5} },
+    { 88, {7} },
+    { 89, {5} },
+    { 89, {7} },
+    { 90, {5} },
+    { 90, {7} },
+    { 91, {5} },
+    { 91, {7} },
+    { 92, {5} },
+    { 92, {7} },
+    { 93, {5} },
+    { 93, {7} },
+    { 94, {5} },
+    { 94, {7} },
+    { 95, {5} },
+    { 95, {7} },
+    { 96, {5} },
+    { 96, {7} },
+    { 97, {5} },
+    { 97, {7} },
+    { 98, {5} },
+    { 98, {7} },
+    { 99, {5} },
+    { 99, {7} },
+    { 100, {5} },
+    { 100, {7} },
+    { 101, {5} },
+    { 101, {7} },
+    { 102, {5} },
+    { 102, {7} },
+    { 103, {5} },
+    { 103, {7} },
+    { 104, {5} },
+    { 104, {7} },
+    { 105, {5} },
+    { 105, {7} },
+    { 106, {5} },
+    { 106, {7} },
+    { 107, {5} },
+    { 107, {7} },
+    { 109, {5} },
+    { 109, {7} },
+    { 110, {5} },
+    { 110, {7} },
+    { 111, {5} },
+    { 111, {7} },
+    { 112, {5} },
+    { 112, {7} },
+    { 113, {5} },
+    { 113, {7} },
+    { 114, {5} },
+    { 114, {7} },
+    { 115, {5} },
+    { 115, {7} },
+    { 116, {5} },
+    { 116, {7} },
+    { 117, {5} },
+    { 117, {7} },
+    { 119, {5} },
+    { 119, {7} },
+    { 120, {5} },
+    { 120, {7} },
+    { 121, {5} },
+    { 121, {7} },
+    { 122, {5} },
+    { 122, {7} },
+    { 123, {5} },
+    { 123, {7} },
+    { 124, {5} },
+    { 124, {7} },
+    { 125, {5} },
+    { 125, {7} },
+    { 126, {5} },
+    { 126, {7} },
+    { 127, {5} },
+    { 127, {7} },
+    { 128, {5} },
+    { 128, {7} },
+};
+// Inputs with fewer than twice this many token runs are checked on one thread.
+#ifndef OWL_THREAD_MIN_RUNS
+#define OWL_THREAD_MIN_RUNS 16
+#endif
+// Workers give up guessing the stack if they need more guesses than this.
+#ifndef OWL_THREAD_MAX_GUESSES
+#define OWL_THREAD_MAX_GUESSES 1024
+#endif
+// Inputs with fewer than twice this many bytes are tokenized on one thread.
+#ifndef OWL_THREAD_MIN_BYTES
+#define OWL_THREAD_MIN_BYTES (1 << 20)
+#endif
+// A worker's guess at the stack while it doesn't know what's on the real one.
+struct stack_guess {
+    struct fill_run_continuation cont;
+    // Positions count tokens as if every run were full.
+    size_t position;
+    // Set if the guess needs another frame at the bottom of its stack, because
+    // a bracket ended with nothing below it (or, if `empty` is set, because it
+    // doesn't have a stack yet).
+    bool out_of_stack;
+    bool empty;
+};
+// Tokens a worker has filled in, starting with the stack in `before` and ending
+// with the stack in `after`.  The bottom frame of `before` stands for whatever
+// frame is at that depth on the real stack; the bottom frame of `after` is the
+// same frame, in the state the stretch left it in.
+struct filled_stretch {
+    size_t start;
+    size_t end;
+    struct fill_run_state *before;
+    size_t before_depth;
+    struct fill_run_state *after;
+    size_t after_depth;
+};
+// A piece of the input for a worker thread.  The worker starts without knowing
+// the stack, so it guesses until it's sure of the top of it, then fills in
+// tokens until a bracket ends with nothing below it, then guesses again, and so
+// on.  Once the earlier pieces are done, the stretches it filled in are checked
+// against the real stack, and only the gaps between them are filled in again.
+struct parallel_chunk {
+    struct owl_token_run **runs;
+    size_t number_of_runs;
+    struct owl_allocator *allocator;
+    struct filled_stretch *stretches;
+    size_t number_of_stretches;
+    size_t stretches_capacity;
+    bool started;
+    pthread_t thread;
+    // These are only used by the worker.
+    struct fill_run_continuation cont;
+    struct stack_guess *guesses;
+    size_t number_of_guesses;
+    size_t guesses_capacity;
+    struct owl_token_run *scratch;
+};
+static void reserve_fill_run_stack(struct fill_run_continuation *cont, size_t size) {
+    if (size <= cont->capacity)
+        return;
+    struct fill_run_state *stack = reallocate_memory(cont->stack, cont->capacity * sizeof(struct fill_run_state), size * sizeof(struct fill_run_state), cont->allocator);
+    if (!stack)
+        abort();
+    cont->stack = stack;
+    cont->capacity = size;
+}
+static void copy_fill_run_stack(struct fill_run_continuation *to, const struct fill_run_state *stack, size_t depth) {
+    reserve_fill_run_stack(to, depth);
+    memcpy(to->stack, stack, depth * sizeof(struct fill_run_state));
+    for (size_t i = 0; i < depth; ++i)
+        to->stack[i].cont = to;
+    to->top_index = depth - 1;
+}
+static struct fill_run_state *save_fill_run_stack(struct fill_run_continuation *cont, struct owl_allocator *allocator) {
+    struct fill_run_state *stack = allocate_memory((cont->top_index + 1) * sizeof(struct fill_run_state), allocator);
+    if (!stack)
+        abort();
+    memcpy(stack, cont->stack, (cont->top_index + 1) * sizeof(struct fill_run_state));
+    return stack;
+}
+// Fills in the states of the tokens from position `start` up to `end`.  Unless
+// `write` is set, the tokens are copied into `scratch` first, so the runs are
+// left alone.
+static bool fill_positions(struct owl_token_run **runs, size_t start, size_t end, struct fill_run_continuation *cont, struct owl_token_run *scratch, bool write, size_t *failing_run, uint16_t *failing_index) {
+    while (start < end) {
+        size_t run_index = start / 4096;
+        struct owl_token_run *run = runs[run_index];
+        uint16_t from = start % 4096;
+        uint16_t to = run->number_of_tokens;
+        if (end - run_index * 4096 < to)
+            to = end - run_index * 4096;
+        bool ok;
+        cont->error = 0;
+        if (write && from == 0 && to == run->number_of_tokens)
+            ok = fill_run_states(run, cont, failing_index);
+        else {
+            memcpy(scratch->tokens, run->tokens + from, (to - from) * sizeof(run->tokens[0]));
+            scratch->number_of_tokens = to - from;
+            ok = fill_run_states(scratch, cont, failing_index);
+            if (write) {
+                memcpy(run->tokens + from, scratch->tokens, (to - from) * sizeof(run->tokens[0]));
+                memcpy(run->states + from, scratch->states, (to - from) * sizeof(run->states[0]));
+            }
+            *failing_index += from;
+        }
+        if (!ok) {
+            *failing_run = run_index;
+            return false;
+        }
+        if (to == run->number_of_tokens)
+            start = (run_index + 1) * 4096;
+        else
+            start = run_index * 4096 + to;
+    }
+    return true;
+}
+// The position `count` tokens after `position`, or the end of the chunk.
+static size_t position_after(struct parallel_chunk *chunk, size_t position, size_t count) {
+    size_t run = position / 4096;
+    size_t index = position % 4096 + count;
+    while (run < chunk->number_of_runs && index >= chunk->runs[run]->number_of_tokens) {
+        index -= chunk->runs[run]->number_of_tokens;
+        run++;
+    }
+    if (run == chunk->number_of_runs)
+        return run * 4096;
+    return run * 4096 + index;
+}
+static struct stack_guess *add_guess(struct parallel_chunk *chunk) {
+    if (chunk->number_of_guesses >= chunk->guesses_capacity) {
+        size_t new_capacity = (chunk->guesses_capacity + 2) * 3 / 2;
+        struct stack_guess *guesses = reallocate_memory(chunk->guesses, chunk->guesses_capacity * sizeof(struct stack_guess), new_capacity * sizeof(struct stack_guess), chunk->allocator);
+        if (!guesses)
+            abort();
+        for (size_t i = chunk->guesses_capacity; i < new_capacity; ++i)
+            guesses[i] = (struct stack_guess){ .cont.allocator = chunk->allocator };
+        chunk->guesses = guesses;
+        chunk->guesses_capacity = new_capacity;
+    }
+    struct stack_guess *guess = &chunk->guesses[chunk->number_of_guesses++];
+    guess->out_of_stack = false;
+    guess->empty = false;
+    return guess;
+}
+static void start_guessing(struct parallel_chunk *chunk, size_t start, bool empty) {
+    chunk->number_of_guesses = 0;
+    struct stack_guess *guess = add_guess(chunk);
+    if (!empty)
+        copy_fill_run_stack(&guess->cont, chunk->cont.stack, chunk->cont.top_index + 1);
+    guess->position = start;
+    guess->out_of_stack = true;
+    guess->empty = empty;
+}
+static void put_base_below(struct stack_guess *guess, const struct speculative_base *base) {
+    size_t depth = guess->empty ? 0 : guess->cont.top_index + 1;
+    reserve_fill_run_stack(&guess->cont, depth + 1);
+    memmove(guess->cont.stack + 1, guess->cont.stack, depth * sizeof(struct fill_run_state));
+    guess->cont.stack[0].state = base->state;
+    memcpy(guess->cont.stack[0].reachability_mask, base->reachability_mask, sizeof(base->reachability_mask));
+    guess->cont.top_index = depth;
+    guess->out_of_stack = false;
+    guess->empty = false;
+}
+static void fork_guess(struct parallel_chunk *chunk, size_t from, const struct speculative_base *base) {
+    struct stack_guess *guess = add_guess(chunk);
+    struct stack_guess *parent = &chunk->guesses[from];
+    size_t depth = parent->empty ? 0 : parent->cont.top_index + 1;
+    reserve_fill_run_stack(&guess->cont, depth + 1);
+    // An empty guess may not have a stack to copy from.
+    if (depth > 0)
+        memcpy(guess->cont.stack, parent->cont.stack, depth * sizeof(struct fill_run_state));
+    guess->cont.top_index = parent->cont.top_index;
+    guess->position = parent->position;
+    guess->empty = parent->empty;
+    put_base_below(guess, base);
+}
+// Runs the guesses up to position `end`.  Guesses which fail are dropped, and
+// guesses which run out of stack fork into a guess for each speculative base
+// below them.  Returns false if there would be too many guesses.
+static bool advance_guesses(struct parallel_chunk *chunk, size_t end) {
+    size_t i = 0;
+    while (i < chunk->number_of_guesses) {
+        struct stack_guess *guess = &chunk->guesses[i];
+        if (guess->position >= end) {
+            i++;
+            continue;
+        }
+        if (guess->out_of_stack) {
+            if (chunk->number_of_guesses > 1 && chunk->number_of_guesses + 183 - 1 > OWL_THREAD_MAX_GUESSES)
+                return false;
+            for (size_t j = 1; j < 183; ++j)
+                fork_guess(chunk, i, &speculative_bases[j]);
+            put_base_below(&chunk->guesses[i], &speculative_bases[0]);
+            continue;
+        }
+        for (size_t j = 0; j <= guess->cont.top_index; ++j)
+            guess->cont.stack[j].cont = &guess->cont;
+        size_t failing_run;
+        uint16_t failing_index;
+        if (fill_positions(chunk->runs, guess->position, end, &guess->cont, chunk->scratch, false, &failing_run, &failing_index))
+            guess->position = end;
+        else if (guess->cont.error == 2) {
+            guess->position = failing_run * 4096 + failing_index;
+            guess->out_of_stack = true;
+        } else {
+            // Swap the failed guess with the last one, so its stack can be
+            // reused.
+            struct stack_guess failed = *guess;
+            *guess = chunk->guesses[--chunk->number_of_guesses];
+            chunk->guesses[chunk->number_of_guesses] = failed;
+        }
+    }
+    return true;
+}
+// Returns the guess all the guesses agree with, if they agree on everything
+// but the mask at the bottom of the stack.  That mask becomes the bits they
+// all share: reachability checks which pass with it pass with each of theirs.
+static struct stack_guess *agreed_guess(struct parallel_chunk *chunk) {
+    struct stack_guess *agreed = &chunk->guesses[0];
+    for (size_t i = 0; i < chunk->number_of_guesses; ++i) {
+        struct stack_guess *guess = &chunk->guesses[i];
+        if (guess->out_of_stack || guess->cont.top_index != agreed->cont.top_index)
+            return 0;
+        for (size_t j = 0; j <= agreed->cont.top_index; ++j) {
+            if (guess->cont.stack[j].state != agreed->cont.stack[j].state)
+                return 0;
+            if (j > 0 && memcmp(guess->cont.stack[j].reachability_mask, agreed->cont.stack[j].reachability_mask, sizeof(agreed->cont.stack[j].reachability_mask)))
+                return 0;
+        }
+    }
+    for (size_t i = 1; i < chunk->number_of_guesses; ++i) {
+        for (int j = 0; j < 1; ++j)
+            agreed->cont.stack[0].reachability_mask[j] &= chunk->guesses[i].cont.stack[0].reachability_mask[j];
+    }
+    return agreed;
+}
+// Guesses the stack from `start`, where the worker's stack has run out (or,
+// with `empty`, where the worker doesn't have a stack yet).  The guesses run
+// over longer and longer windows until they agree.  If they don't, or there
+// are too many of them, the worker starts guessing again further on.  Returns
+// the position where the guesses agreed, with the agreed stack in the worker's
+// cont, or the end of the chunk if they never did.
+static size_t guess_stack(struct parallel_chunk *chunk, size_t start, bool empty) {
+    size_t chunk_end = chunk->number_of_runs * 4096;
+    size_t window = 16;
+    start_guessing(chunk, start, empty);
+    while (true) {
+        size_t end = position_after(chunk, start, window);
+        bool ok = advance_guesses(chunk, end);
+        if (end == chunk_end || chunk->number_of_guesses == 0)
+            return chunk_end;
+        struct stack_guess *agreed = ok ? agreed_guess(chunk) : 0;
+        if (agreed) {
+            copy_fill_run_stack(&chunk->cont, agreed->cont.stack, agreed->cont.top_index + 1);
+            return end;
+        }
+        if (ok && window < 16384)
+            window *= 4;
+        else {
+            // Bracket symbol placeholders are only ever seen by the state
+            // which ends a bracket, so guessing can't start at one.
+            start = end;
+            if (chunk->runs[start / 4096]->tokens[start % 4096] == 4294967295U)
+                start = position_after(chunk, start, 1);
+            window = 16;
+            start_guessing(chunk, start, true);
+        }
+    }
+}
+static void *check_chunk(void *data) {
+    struct parallel_chunk *chunk = data;
+    size_t chunk_end = chunk->number_of_runs * 4096;
+    chunk->scratch = allocate_memory(sizeof(struct owl_token_run), chunk->allocator);
+    if (!chunk->scratch)
+        abort();
+    size_t position = guess_stack(chunk, 0, true);
+    while (position < chunk_end) {
+        struct filled_stretch stretch = {
+            .start = position,
+            .before = save_fill_run_stack(&chunk->cont, chunk->allocator),
+            .before_depth = chunk->cont.top_index + 1,
+        };
+        size_t failing_run;
+        uint16_t failing_index;
+        bool ok = fill_positions(chunk->runs, position, chunk_end, &chunk->cont, chunk->scratch, true, &failing_run, &failing_index);
+        if (!ok && chunk->cont.error != 2) {
+            // This is either a real error or a bad guess; either way, it's
+            // left for the sequential pass.
+            free_memory(stretch.before, stretch.before_depth * sizeof(struct fill_run_state), chunk->allocator);
+            break;
+        }
+        stretch.end = ok ? chunk_end : failing_run * 4096 + failing_index;
+        stretch.after = save_fill_run_stack(&chunk->cont, chunk->allocator);
+        stretch.after_depth = chunk->cont.top_index + 1;
+        if (chunk->number_of_stretches >= chunk->stretches_capacity) {
+            size_t new_capacity = (chunk->stretches_capacity + 2) * 3 / 2;
+            struct filled_stretch *stretches = reallocate_memory(chunk->stretches, chunk->stretches_capacity * sizeof(struct filled_stretch), new_capacity * sizeof(struct filled_stretch), chunk->allocator);
+            if (!stretches)
+                abort();
+            chunk->stretches = stretches;
+            chunk->stretches_capacity = new_capacity;
+        }
+        chunk->stretches[chunk->number_of_stretches++] = stretch;
+        if (ok)
+            break;
+        position = guess_stack(chunk, stretch.end, false);
+    }
+    for (size_t i = 0; i < chunk->guesses_capacity; ++i)
+        free_memory(chunk->guesses[i].cont.stack, chunk->guesses[i].cont.capacity * sizeof(struct fill_run_state), chunk->allocator);
+    free_memory(chunk->guesses, chunk->guesses_capacity * sizeof(struct stack_guess), chunk->allocator);
+    free_memory(chunk->cont.stack, chunk->cont.capacity * sizeof(struct fill_run_state), chunk->allocator);
+    free_memory(chunk->scratch, sizeof(struct owl_token_run), chunk->allocator);
+    return 0;
+}
+// Checks whether the top of the real stack matches the stack a stretch started
+// with, so filling it in from the real stack would do exactly what the worker
+// did.  The real frame at the bottom can have more mask bits than the guess.
+static bool stretch_matches(struct fill_run_continuation *cont, struct filled_stretch *stretch) {
+    if (cont->top_index + 1 < stretch->before_depth)
+        return false;
+    struct fill_run_state *top = cont->stack + cont->top_index + 1 - stretch->before_depth;
+    for (size_t i = 0; i < stretch->before_depth; ++i) {
+        if (top[i].state != stretch->before[i].state)
+            return false;
+        for (int j = 0; j < 1; ++j) {
+            uint32_t bits = stretch->before[i].reachability_mask[j];
+            uint32_t real_bits = top[i].reachability_mask[j];
+            if (i == 0 ? (real_bits & bits) != bits : real_bits != bits)
+                return false;
+        }
+    }
+    return true;
+}
+static void take_stretch_stack(struct fill_run_continuation *cont, struct filled_stretch *stretch) {
+    size_t base = cont->top_index + 1 - stretch->before_depth;
+    reserve_fill_run_stack(cont, base + stretch->after_depth);
+    cont->stack[base].state = stretch->after[0].state;
+    for (size_t i = 1; i < stretch->after_depth; ++i) {
+        cont->stack[base + i] = stretch->after[i];
+        cont->stack[base + i].cont = cont;
+    }
+    cont->top_index = base + stretch->after_depth - 1;
+}
+// Puts back the bracket placeholders a worker replaced with bracket symbols
+// while filling in a stretch.
+static void restore_bracket_placeholders(struct owl_token_run **runs, size_t start, size_t end) {
+    for (size_t i = start; i < end; ++i) {
+        struct owl_token_run *run = runs[i / 4096];
+        if (i % 4096 >= run->number_of_tokens) {
+            i = (i / 4096 + 1) * 4096 - 1;
+            continue;
+        }
+        if (run->tokens[i % 4096] >= 30)
+            run->tokens[i % 4096] = 4294967295U;
+    }
+}
+static void add_run_end(struct run_end **ends, size_t *number_of_runs, size_t *capacity, struct run_end end, struct owl_allocator *allocator) {
+    if (*number_of_runs >= *capacity) {
+        size_t new_capacity = (*capacity + 2) * 3 / 2;
+        struct run_end *new_ends = reallocate_memory(*ends, *capacity * sizeof(struct run_end), new_capacity * sizeof(struct run_end), allocator);
+        if (!new_ends)
+            abort();
+        *ends = new_ends;
+        *capacity = new_capacity;
+    }
+    (*ends)[(*number_of_runs)++] = end;
+}
+// Tokenizes until the tokenizer reaches its `stop` (or the end of the text, or
+// an invalid token).
+static void tokenize_runs(struct owl_parser *parser, struct run_end **ends, size_t *number_of_runs, size_t *capacity) {
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    while (owl_default_tokenizer_advance(tokenizer, &parser->token_run))
+        add_run_end(ends, number_of_runs, capacity, (struct run_end){ tokenizer->offset, tokenizer->whitespace }, &parser->allocator);
+}
+// Writes the token data from a worker's log into the tree.
+static void replay_token_log(struct owl_tree *tree, struct token_log *log, const char *text, size_t start, size_t end) {
+    (void)text;
+    for (size_t i = start; i < end; ++i) {
+        struct logged_token token = log->tokens[i];
+        switch (token.kind) {
+        case LOGGED_IDENTIFIER_TOKEN:
+            write_identifier_token(token.offset, token.length, tree);
+            break;
+        case LOGGED_INTEGER_TOKEN:
+            write_integer_token(token.offset, token.length, token.data, tree);
+            break;
+        case LOGGED_STRING_TOKEN:
+            if (token.has_escapes) {
+                char *string = allocate_string_contents(token.extra, tree);
+                memcpy(string, log->strings + token.data, token.extra);
+                write_string_token(token.offset, token.length, string, token.extra, true, tree);
+            } else
+                write_string_token(token.offset, token.length, text + token.offset + 1, token.extra, false, tree);
+            break;
+        default:
+            break;
+        }
+    }
+}
+// Workers start their tokenizers with this much whitespace, so the whitespace
+// before their first token takes as many bytes as any length can.  Once the
+// real amount is known, it's written over the top (see set_first_whitespace).
+#define UNKNOWN_WHITESPACE (SIZE_MAX / 2 + 1)
+static void set_first_whitespace(struct owl_token_run *run, size_t whitespace) {
+    // Skip over the first token's length.
+    uint16_t start = 1;
+    while (run->lengths[start] & 0x80)
+        start++;
+    uint16_t end = start + 1;
+    while (end < run->lengths_size && (run->lengths[end] & 0x80))
+        end++;
+    size_t value = 0;
+    for (uint16_t i = end; i > start; --i)
+        value = value << 7 | (run->lengths[i - 1] & 0x7f);
+    value = value - UNKNOWN_WHITESPACE + whitespace;
+    // Higher groups of zeros pad the new value out to the same size.
+    for (uint16_t i = start; i < end; ++i) {
+        run->lengths[i] = (i > start ? 0x80 : 0) | (value & 0x7f);
+        value >>= 7;
+    }
+}
+// A token run from a worker, with where the worker's tokenizer was before and
+// after it.
+struct tokenized_run {
+    struct owl_token_run *run;
+    struct run_end start;
+    struct run_end end;
+    // The run's token data starts at this index in the worker's log.
+    size_t first_logged_token;
+};
+// A range of the text for a worker thread to tokenize.  The worker doesn't know
+// where tokens start in the range, so it guesses.  Its runs are only used if
+// the main thread's tokenizer (which knows where it is) reaches the start of
+// one in the same state -- after that, both tokenizers see the same tokens.
+struct tokenized_range {
+    const char *text;
+    size_t start;
+    size_t end;
+    // The number of double quotes in the range which don't follow a backslash,
+    // and whether the range starts inside a double-quoted string.
+    size_t quotes;
+    bool in_string;
+    struct owl_default_tokenizer tokenizer;
+    // A copy of the tree which writes its token data to `log`.
+    struct owl_tree tree;
+    struct token_log log;
+    struct tokenized_run *runs;
+    size_t number_of_runs;
+    size_t runs_capacity;
+    bool started;
+    pthread_t thread;
+};
+// Counts the double quotes in [start, end) which don't follow a backslash.
+// Comments and single-quoted strings aren't taken into account, so this is only
+// an estimate of how many strings start or end in the range.
+static size_t count_quotes(const char *text, size_t start, size_t end) {
+    size_t count = 0;
+    size_t offset = start;
+#ifdef OWL_SIMD
+    // Like simdjson, make a mask of the quotes and a mask of the bytes after
+    // backslashes for each block.
+    uint32_t escaped = offset > 0 && text[offset - 1] == '\\';
+    while (offset + 16 <= end) {
+        vector_bytes_sse2 x;
+        memcpy(&x, text + offset, 16);
+        uint32_t quotes = (uint32_t)__builtin_ia32_pmovmskb128(vector_equal_sse2(x, '"'));
+        uint32_t backslashes = (uint32_t)__builtin_ia32_pmovmskb128(vector_equal_sse2(x, '\\'));
+        count += (size_t)__builtin_popcount(quotes & ~(backslashes << 1 | escaped));
+        escaped = backslashes >> 15;
+        offset += 16;
+    }
+#endif
+    for (; offset < end; ++offset) {
+        if (text[offset] == '"' && (offset == 0 || text[offset - 1] != '\\'))
+            count++;
+    }
+    return count;
+}
+static void *count_range_quotes(void *data) {
+    struct tokenized_range *range = data;
+    range->quotes = count_quotes(range->text, range->start, range->end);
+    return 0;
+}
+// Guesses where a token starts in [offset, end): at the start of a line (after
+// its indentation), or where a string starts or ends.  Returns `end` if there's
+// nowhere to guess.
+static size_t guess_token_start(const char *text, size_t offset, size_t end, bool in_string) {
+    for (; offset < end; ++offset) {
+        if (text[offset] == '"' && (offset == 0 || text[offset - 1] != '\\')) {
+            return in_string ? offset + 1 : offset;
+        }
+        if (!in_string && text[offset] == '\n') {
+            offset++;
+            size_t whitespace;
+            while (offset < end && (whitespace = read_whitespace(text + offset, end - offset, 0)) > 0)
+                offset += whitespace;
+            return offset < end ? offset : end;
+        }
+    }
+    return end;
+}
+static void *tokenize_range(void *data) {
+    struct tokenized_range *range = data;
+    struct owl_default_tokenizer *tokenizer = &range->tokenizer;
+    size_t limit = tokenizer->stop ? tokenizer->stop : tokenizer->length;
+    size_t offset = range->start;
+    while (offset < limit) {
+        tokenizer->offset = offset;
+        tokenizer->whitespace = UNKNOWN_WHITESPACE;
+        for (;;) {
+            struct tokenized_run t = {
+                .start = { tokenizer->offset, tokenizer->whitespace },
+                .first_logged_token = range->log.number_of_tokens,
+            };
+            if (!owl_default_tokenizer_advance(tokenizer, &t.run))
+                break;
+            t.end = (struct run_end){ tokenizer->offset, tokenizer->whitespace };
+            if (range->number_of_runs >= range->runs_capacity) {
+                size_t capacity = (range->runs_capacity + 8) * 2;
+                struct tokenized_run *runs = reallocate_memory(range->runs, range->runs_capacity * sizeof(struct tokenized_run), capacity * sizeof(struct tokenized_run), tokenizer->allocator);
+                if (!runs)
+                    abort();
+                range->runs = runs;
+                range->runs_capacity = capacity;
+            }
+            range->runs[range->number_of_runs++] = t;
+        }
+        if (tokenizer->offset >= limit)
+            break;
+        // Either the guess was wrong or the text has an invalid token here.  In
+        // case it was the guess, guess again further on.
+        offset = guess_token_start(range->text, tokenizer->offset + 1, limit, false);
+    }
+    return 0;
+}
+// Tokenizes the text into the parser's token runs, with the tokenizer ending up
+// where it would have if it had tokenized the text by itself.  The text is
+// split into ranges; worker threads tokenize all of them but the first, while
+// this thread tokenizes the first, then goes through the workers' runs in order.
+static void tokenize_in_parallel(struct owl_parser *parser, const char *text, size_t length, unsigned threads, struct run_end **ends, size_t *number_of_runs, size_t *capacity) {
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    size_t number_of_ranges = length / OWL_THREAD_MIN_BYTES;
+    if (number_of_ranges > threads)
+        number_of_ranges = threads;
+    if (number_of_ranges < 2) {
+        tokenize_runs(parser, ends, number_of_runs, capacity);
+        return;
+    }
+    struct owl_tree tree_before = *parser->tree;
+    struct tokenized_range *ranges = allocate_memory(number_of_ranges * sizeof(struct tokenized_range), &parser->allocator);
+    if (!ranges)
+        abort();
+    for (size_t i = 0; i < number_of_ranges; ++i) {
+        ranges[i] = (struct tokenized_range){
+            .text = text,
+            .start = length * i / number_of_ranges,
+            .end = length * (i + 1) / number_of_ranges,
+        };
+    }
+    // Which ranges start inside strings depends on the quotes in all the ranges
+    // before them (but not the last one).
+    for (size_t i = 1; i + 1 < number_of_ranges; ++i) {
+        ranges[i].started = pthread_create(&ranges[i].thread, 0, count_range_quotes, &ranges[i]) == 0;
+        if (!ranges[i].started)
+            count_range_quotes(&ranges[i]);
+    }
+    count_range_quotes(&ranges[0]);
+    for (size_t i = 1; i < number_of_ranges; ++i) {
+        struct tokenized_range *before = &ranges[i - 1];
+        if (before->started)
+            pthread_join(before->thread, 0);
+        before->started = false;
+        ranges[i].in_string = before->in_string != (before->quotes % 2 == 1);
+    }
+    for (size_t i = 1; i < number_of_ranges; ++i)
+        ranges[i].start = guess_token_start(text, ranges[i].start, ranges[i].end, ranges[i].in_string);
+    for (size_t i = 1; i < number_of_ranges; ++i) {
+        struct tokenized_range *range = &ranges[i];
+        range->log = (struct token_log){
+            .discard = parser->validating,
+            .allocator = &parser->allocator,
+        };
+        range->tree = *parser->tree;
+        range->tree.token_log = &range->log;
+        range->tokenizer = *tokenizer;
+        range->tokenizer.info = &range->tree;
+        range->tokenizer.free_runs = 0;
+        range->tokenizer.stop = i + 1 < number_of_ranges ? ranges[i + 1].start : 0;
+        range->started = pthread_create(&range->thread, 0, tokenize_range, range) == 0;
+    }
+    bool failed = false;
+    for (size_t i = 1; i < number_of_ranges; ++i) {
+        struct tokenized_range *range = &ranges[i];
+        if (!failed) {
+            tokenizer->stop = range->start;
+            tokenize_runs(parser, ends, number_of_runs, capacity);
+            failed = tokenizer->offset < tokenizer->stop;
+        }
+        if (range->started)
+            pthread_join(range->thread, 0);
+        for (size_t j = 0; j < range->number_of_runs; ++j) {
+            struct tokenized_run *t = &range->runs[j];
+            if (!failed && tokenizer->offset < t->start.offset) {
+                tokenizer->stop = t->start.offset;
+                tokenize_runs(parser, ends, number_of_runs, capacity);
+                failed = tokenizer->offset < tokenizer->stop;
+            }
+            bool unknown_whitespace = t->start.whitespace >= UNKNOWN_WHITESPACE;
+            if (failed || tokenizer->offset != t->start.offset || (!unknown_whitespace && tokenizer->whitespace != t->start.whitespace)) {
+                t->run->prev = tokenizer->free_runs;
+                tokenizer->free_runs = t->run;
+                continue;
+            }
+            if (unknown_whitespace)
+                set_first_whitespace(t->run, tokenizer->whitespace);
+            size_t end = j + 1 < range->number_of_runs ? t[1].first_logged_token : range->log.number_of_tokens;
+            replay_token_log(parser->tree, &range->log, text, t->first_logged_token, end);
+            t->run->prev = parser->token_run;
+            parser->token_run = t->run;
+            add_run_end(ends, number_of_runs, capacity, t->end, &parser->allocator);
+            tokenizer->offset = t->end.offset;
+            tokenizer->whitespace = t->end.whitespace;
+        }
+        free_memory(range->runs, range->runs_capacity * sizeof(struct tokenized_run), &parser->allocator);
+        free_token_runs(&range->tokenizer.free_runs, &parser->allocator);
+        free_token_log(&range->log);
+    }
+    tokenizer->stop = 0;
+    if (!failed)
+        tokenize_runs(parser, ends, number_of_runs, capacity);
+    free_memory(ranges, number_of_ranges * sizeof(struct tokenized_range), &parser->allocator);
+    if (tokenizer->offset < length) {
+        // The tokens in the run with an invalid token are never checked, so
+        // which error gets reported depends on where the runs end -- and they
+        // end in different places here than they do in parse_text.  To report
+        // the same error, start again on this thread.
+        recycle_token_runs(parser);
+        *number_of_runs = 0;
+        uint8_t *parse_tree = parser->tree->parse_tree;
+        size_t parse_tree_size = parser->tree->parse_tree_size;
+        *parser->tree = tree_before;
+        parser->tree->parse_tree = parse_tree;
+        parser->tree->parse_tree_size = parse_tree_size;
+        tokenizer->offset = 0;
+        tokenizer->whitespace = 0;
+        tokenize_runs(parser, ends, number_of_runs, capacity);
+    }
+}
+// Like parse_text, but tokenizes all the text first (see tokenize_in_parallel),
+// then splits the tokens into chunks for up to `threads` threads.
+static bool parse_text_in_parallel(struct owl_parser *parser, const char *text, size_t length, unsigned threads) {
+    struct owl_tree *tree = parser->tree;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    tokenizer->text = text;
+    tokenizer->length = length;
+    tokenizer->more_input = false;
+    struct run_end *ends = 0;
+    size_t number_of_runs = 0;
+    size_t ends_capacity = 0;
+    tokenize_in_parallel(parser, text, length, threads, &ends, &number_of_runs, &ends_capacity);
+    struct owl_token_run **runs = allocate_memory((number_of_runs + 1) * sizeof(struct owl_token_run *), &parser->allocator);
+    struct owl_token_run *scratch = allocate_memory(sizeof(struct owl_token_run), &parser->allocator);
+    if (!runs || !scratch)
+        abort();
+    struct owl_token_run *run = parser->token_run;
+    for (size_t i = number_of_runs; i > 0; --i) {
+        runs[i - 1] = run;
+        run = run->prev;
+    }
+    size_t number_of_chunks = number_of_runs / OWL_THREAD_MIN_RUNS;
+    if (number_of_chunks > threads)
+        number_of_chunks = threads;
+    if (number_of_chunks == 0)
+        number_of_chunks = 1;
+    struct parallel_chunk *chunks = allocate_memory(number_of_chunks * sizeof(struct parallel_chunk), &parser->allocator);
+    if (!chunks)
+        abort();
+    size_t first_run = 0;
+    for (size_t i = 0; i < number_of_chunks; ++i) {
+        size_t end_run = number_of_runs * (i + 1) / number_of_chunks;
+        chunks[i] = (struct parallel_chunk){
+            .runs = runs + first_run,
+            .number_of_runs = end_run - first_run,
+            .allocator = &parser->allocator,
+            .cont.allocator = &parser->allocator,
+        };
+        // The first chunk starts with the real stack, so it's filled in on
+        // this thread while the workers guess.
+        if (i > 0)
+            chunks[i].started = pthread_create(&chunks[i].thread, 0, check_chunk, &chunks[i]) == 0;
+        first_run = end_run;
+    }
+    size_t failing_run = number_of_runs;
+    uint16_t failing_index = 0;
+    for (size_t i = 0; i < number_of_chunks; ++i) {
+        struct parallel_chunk *chunk = &chunks[i];
+        if (chunk->started)
+            pthread_join(chunk->thread, 0);
+        size_t position = 0;
+        size_t chunk_failing_run = 0;
+        bool ok = failing_run == number_of_runs;
+        for (size_t j = 0; j < chunk->number_of_stretches; ++j) {
+            struct filled_stretch *stretch = &chunk->stretches[j];
+            if (ok)
+                ok = fill_positions(chunk->runs, position, stretch->start, &parser->cont, scratch, true, &chunk_failing_run, &failing_index);
+            if (ok && stretch_matches(&parser->cont, stretch)) {
+                take_stretch_stack(&parser->cont, stretch);
+                position = stretch->end;
+            } else if (ok) {
+                restore_bracket_placeholders(chunk->runs, stretch->start, stretch->end);
+                position = stretch->start;
+            }
+            free_memory(stretch->before, stretch->before_depth * sizeof(struct fill_run_state), &parser->allocator);
+            free_memory(stretch->after, stretch->after_depth * sizeof(struct fill_run_state), &parser->allocator);
+        }
+        if (ok)
+            ok = fill_positions(chunk->runs, position, chunk->number_of_runs * 4096, &parser->cont, scratch, true, &chunk_failing_run, &failing_index);
+        if (!ok && failing_run == number_of_runs)
+            failing_run = chunk->runs - runs + chunk_failing_run;
+        free_memory(chunk->stretches, chunk->stretches_capacity * sizeof(struct filled_stretch), &parser->allocator);
+    }
+    bool ok = true;
+    if (failing_run < number_of_runs) {
+        struct owl_default_tokenizer at_run = *tokenizer;
+        at_run.offset = ends[failing_run].offset;
+        at_run.whitespace = ends[failing_run].whitespace;
+        tree->error = ERROR_UNEXPECTED_TOKEN;
+        find_token_range(&at_run, runs[failing_run], failing_index, &tree->error_range.start, &tree->error_range.end);
+        ok = false;
+    } else if (tokenizer->offset < length) {
+        tree->error = ERROR_INVALID_TOKEN;
+        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);
+        ok = false;
+    }
+    free_memory(chunks, number_of_chunks * sizeof(struct parallel_chunk), &parser->allocator);
+    free_memory(scratch, sizeof(struct owl_token_run), &parser->allocator);
+    free_memory(runs, (number_of_runs + 1) * sizeof(struct owl_token_run *), &parser->allocator);
+    free_memory(ends, ends_capacity * sizeof(struct run_end), &parser->allocator);
+    if (parser->validating)
+        discard_tokens(parser);
+    return ok;
+}
+// How many token runs the tokenizer can get ahead of the state machine when
+// parsing is pipelined.
+#ifndef OWL_PIPELINE_RUNS
+#define OWL_PIPELINE_RUNS 4
+#endif
+// Token runs passed from the tokenizing thread to the thread filling in their
+// states.  `head` and `tail` count the runs taken and added so far.
+struct run_queue {
+    struct owl_parser *parser;
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    struct owl_token_run *runs[OWL_PIPELINE_RUNS];
+    struct run_end ends[OWL_PIPELINE_RUNS];
+    size_t head;
+    size_t tail;
+    // Set by the tokenizing thread once the text is used up (or a token is
+    // invalid).
+    bool finished;
+    // Set by the other thread when a run has an unexpected token, so the rest
+    // of the text doesn't need to be tokenized.
+    bool stopped;
+};
+static void *tokenize_into_queue(void *arg) {
+    struct run_queue *queue = arg;
+    struct owl_parser *parser = queue->parser;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    bool more = true;
+    while (more) {
+        more = owl_default_tokenizer_advance(tokenizer, &parser->token_run);
+        pthread_mutex_lock(&queue->lock);
+        if (more) {
+            size_t slot = queue->tail % OWL_PIPELINE_RUNS;
+            queue->runs[slot] = parser->token_run;
+            queue->ends[slot] = (struct run_end){
+                .offset = tokenizer->offset,
+                .whitespace = tokenizer->whitespace,
+            };
+            queue->tail++;
+        } else
+            queue->finished = true;
+        pthread_cond_signal(&queue->not_empty);
+        while (more && queue->tail - queue->head == OWL_PIPELINE_RUNS && !queue->stopped)
+            pthread_cond_wait(&queue->not_full, &queue->lock);
+        if (queue->stopped)
+            more = false;
+        pthread_mutex_unlock(&queue->lock);
+    }
+    return 0;
+}
+// Like parse_text, but the text is tokenized on another thread while this one
+// fills in the states of the runs it has already tokenized.
+static bool parse_text_pipelined(struct owl_parser *parser, const char *text, size_t length) {
+    struct owl_tree *tree = parser->tree;
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    tokenizer->text = text;
+    tokenizer->length = length;
+    tokenizer->more_input = false;
+    struct run_queue queue = { .parser = parser };
+    pthread_mutex_init(&queue.lock, 0);
+    pthread_cond_init(&queue.not_empty, 0);
+    pthread_cond_init(&queue.not_full, 0);
+    pthread_t thread;
+    if (pthread_create(&thread, 0, tokenize_into_queue, &queue) != 0) {
+        pthread_cond_destroy(&queue.not_full);
+        pthread_cond_destroy(&queue.not_empty);
+        pthread_mutex_destroy(&queue.lock);
+        return parse_text(parser, text, length, false);
+    }
+    struct owl_token_run *failing_run = 0;
+    struct run_end failing_end = { 0 };
+    uint16_t failing_index = 0;
+    while (true) {
+        pthread_mutex_lock(&queue.lock);
+        while (queue.head == queue.tail && !queue.finished)
+            pthread_cond_wait(&queue.not_empty, &queue.lock);
+        if (queue.head == queue.tail) {
+            pthread_mutex_unlock(&queue.lock);
+            break;
+        }
+        size_t slot = queue.head % OWL_PIPELINE_RUNS;
+        struct owl_token_run *run = queue.runs[slot];
+        struct run_end end = queue.ends[slot];
+        queue.head++;
+        pthread_cond_signal(&queue.not_full);
+        pthread_mutex_unlock(&queue.lock);
+        if (!fill_run_states(run, &parser->cont, &failing_index)) {
+            failing_run = run;
+            failing_end = end;
+            pthread_mutex_lock(&queue.lock);
+            queue.stopped = true;
+            pthread_cond_signal(&queue.not_full);
+            pthread_mutex_unlock(&queue.lock);
+            break;
+        }
+    }
+    pthread_join(thread, 0);
+    pthread_cond_destroy(&queue.not_full);
+    pthread_cond_destroy(&queue.not_empty);
+    pthread_mutex_destroy(&queue.lock);
+    bool ok = true;
+    if (failing_run) {
+        struct owl_default_tokenizer at_run = *tokenizer;
+        at_run.offset = failing_end.offset;
+        at_run.whitespace = failing_end.whitespace;
+        tree->error = ERROR_UNEXPECTED_TOKEN;
+        find_token_range(&at_run, failing_run, failing_index, &tree->error_range.start, &tree->error_range.end);
+        ok = false;
+    } else if (tokenizer->offset < length) {
+        tree->error = ERROR_INVALID_TOKEN;
+        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);
+        ok = false;
+    }
+    if (parser->validating)
+        discard_tokens(parser);
+    return ok;
+}
+#endif
+static void finish_parsing(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    struct fill_run_state top = parser->cont.stack[parser->cont.top_index];
+    if (tree->error != ERROR_NONE) {
+        recycle_token_runs(parser);
         return;
     }
     switch (top.state) {
@@ -3068,14 +5734,46 @@ static void parse_string(struct owl_tree *tree, const char *string) {
         break;
     default:
         tree->error = ERROR_MORE_INPUT_NEEDED;
-        find_end_range(&tokenizer, &tree->error_range.start, &tree->error_range.end);
-        free_token_runs(&token_run);
+        find_end_range(&parser->tokenizer, &tree->error_range.start, &tree->error_range.end);
+        recycle_token_runs(parser);
         return;
     }
-    tree->root_offset = build_parse_tree(&tokenizer, token_run, tree);
+    if (parser->validating)
+        return;
+    tree->root_offset = build_parse_tree(parser);
+#ifdef OWL_INDEX
+    if (tree->rule_index || tree->location_index)
+        finish_indexes(tree);
+#endif
+}
+// Parses a string into `tree`, reusing the parser's memory from earlier parses.
+// If `pipeline` is set, the text is tokenized on another thread (see
+// parse_text_pipelined).
+static void parse_string_reusing(struct owl_parser *parser, struct owl_tree *tree, const char *string, size_t length, bool validate, unsigned threads, bool pipeline) {
+    parser->validating = validate;
+    tree->string = string;
+    start_parsing(parser, tree);
+#ifdef OWL_THREADS
+    if (threads > 1)
+        parse_text_in_parallel(parser, string, length, threads);
+    else if (pipeline)
+        parse_text_pipelined(parser, string, length);
+    else
+        parse_text(parser, string, length, false);
+#else
+    (void)threads;
+    (void)pipeline;
+    parse_text(parser, string, length, false);
+#endif
+    finish_parsing(parser);
+}
+static void parse_string(struct owl_tree *tree, const char *string, size_t length, bool validate, unsigned threads, bool pipeline) {
+    struct owl_parser parser = { .allocator = tree->allocator };
+    parse_string_reusing(&parser, tree, string, length, validate, threads, pipeline);
+    free_parser_memory(&parser);
 }
 static struct owl_tree *owl_tree_create_with_error(enum owl_error e) {
-    struct owl_tree *tree = owl_tree_create_empty();
+    struct owl_tree *tree = owl_tree_create_empty((struct owl_allocator){ 0 });
     tree->error = e;
     return tree;
 }
@@ -3087,18 +5785,83 @@ struct owl_tree *owl_tree_create_from_file(FILE *file) {
         return owl_tree_create_with_error(ERROR_INVALID_FILE);
     return owl_tree_create_with_options((struct owl_tree_options){ .file = file });
 }
-struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options) {
-    if (!options.file == !options.string)
+#ifdef OWL_MMAP
+// Reads the rest of `fd` into a new buffer.  For regular files, `size` is the
+// size of the file and the buffer is allocated once, at exactly that size.
+static char *read_file_descriptor(int fd, size_t size, size_t *length, size_t *capacity_out, struct owl_allocator *allocator) {
+    size_t capacity = size ? size : 65536;
+    char *buffer = allocate_memory(capacity, allocator);
+    size_t offset = 0;
+    while (buffer) {
+        if (offset == capacity) {
+            if (size)
+                break;
+            char *b = reallocate_memory(buffer, capacity, capacity * 2, allocator);
+            if (!b)
+                free_memory(buffer, capacity, allocator);
+            buffer = b;
+            capacity *= 2;
+            continue;
+        }
+        ssize_t n = read(fd, buffer + offset, capacity - offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0) {
+            free_memory(buffer, capacity, allocator);
+            return 0;
+        }
+        if (n == 0)
+            break;
+        offset += (size_t)n;
+    }
+    *length = offset;
+    *capacity_out = capacity;
+    return buffer;
+}
+#endif
+static bool allocator_options_are_valid(struct owl_tree_options options) {
+    return !options.allocate == !options.reallocate && !options.allocate == !options.deallocate;
+}
+static struct owl_allocator allocator_from_options(struct owl_tree_options options) {
+    return (struct owl_allocator){
+        .allocate = options.allocate,
+        .reallocate = options.reallocate,
+        .deallocate = options.deallocate,
+        .info = options.allocator_info,
+    };
+}
+// Sets up `tree` for the options, then parses `length` bytes of `string` into
+// it.  The arguments are the same as for create_tree.
+static void parse_into_tree(struct owl_tree *tree, struct owl_tree_options options, const char *string, size_t length, bool validate, const struct owl_builder *builder, struct owl_parser *parser) {
+    tree->builder = builder;
+#ifdef OWL_INDEX
+    if (options.index_rules && !validate && !builder)
+        tree->rule_index = create_rule_index(&tree->allocator);
+    if (options.index_locations && !validate && !builder)
+        tree->location_index = create_location_index(&tree->allocator);
+#endif
+    if (parser)
+        parse_string_reusing(parser, tree, string, length, validate, options.threads, options.pipeline);
+    else
+        parse_string(tree, string, length, validate, options.threads, options.pipeline);
+}
+// Creates a tree from the options.  If `validate` is set, the tree isn't built;
+// if `builder` is set, it's used to build nodes instead.  If `parser` is set,
+// its memory is reused; it must use the same allocator as the options.
+static struct owl_tree *create_tree(struct owl_tree_options options, bool validate, const struct owl_builder *builder, struct owl_parser *parser) {
+    if (!options.file == !options.string || !allocator_options_are_valid(options))
         return owl_tree_create_with_error(ERROR_INVALID_OPTIONS);
+    struct owl_allocator allocator = allocator_from_options(options);
+    size_t len = 32;
     if (options.file) {
         char *str = 0;
-        size_t len = 32;
         size_t off = 0;
         while (true) {
+            size_t old_len = str ? len : 0;
             len = len * 3 / 2;
-            char *s = realloc(str, len);
+            char *s = reallocate_memory(str, old_len, len, &allocator);
             if (!s) {
-                free(str);
+                free_memory(str, old_len, &allocator);
                 return 0;
             }
             str = s;
@@ -3109,13 +5872,351 @@ struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options) {
             }
         }
         options.string = str;
-    }
-    struct owl_tree *tree = owl_tree_create_empty();
+        options.length = off;
+    } else if (!options.length && !options.has_length)
+        options.length = strlen(options.string);
+    struct owl_tree *tree = owl_tree_create_empty(allocator);
     if (options.file)
-        tree->owns_string = true;
-    parse_string(tree, options.string);
+        tree->owned_string_size = len;
+    parse_into_tree(tree, options, options.string, options.length, validate, builder, parser);
+    return tree;
+}
+struct owl_tree *owl_tree_create_with_options(struct owl_tree_options options) {
+    return create_tree(options, false, 0, 0);
+}
+struct owl_tree *owl_tree_create_from_path(const char *path) {
+    return owl_tree_create_from_path_with_options(path, (struct owl_tree_options){ 0 });
+}
+struct owl_tree *owl_tree_create_from_path_with_options(const char *path, struct owl_tree_options options) {
+    if (!path)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    if (options.file || options.string || !allocator_options_are_valid(options))
+        return owl_tree_create_with_error(ERROR_INVALID_OPTIONS);
+#ifdef OWL_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    }
+    struct owl_tree *tree = owl_tree_create_empty(allocator_from_options(options));
+    size_t length = 0;
+    if (S_ISREG(st.st_mode) && st.st_size > 0 && (uintmax_t)st.st_size <= SIZE_MAX) {
+        length = (size_t)st.st_size;
+        void *map = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+#if defined(MADV_SEQUENTIAL)
+            madvise(map, length, MADV_SEQUENTIAL);
+#elif defined(POSIX_MADV_SEQUENTIAL)
+            posix_madvise(map, length, POSIX_MADV_SEQUENTIAL);
+#endif
+            tree->mapped_length = length;
+            tree->string = map;
+        }
+    }
+    if (!tree->mapped_length) {
+        // Pipes and other special files can't be mapped.
+        size_t capacity = 0;
+        char *string = read_file_descriptor(fd, length, &length, &capacity, &tree->allocator);
+        if (!string) {
+            close(fd);
+            owl_tree_destroy(tree);
+            return owl_tree_create_with_error(ERROR_INVALID_FILE);
+        }
+        tree->string = string;
+        tree->owned_string_size = capacity;
+    }
+    close(fd);
+    parse_into_tree(tree, options, tree->string, length, false, 0, 0);
+    return tree;
+#else
+    FILE *file = fopen(path, "rb");
+    if (!file)
+        return owl_tree_create_with_error(ERROR_INVALID_FILE);
+    options.file = file;
+    struct owl_tree *tree = owl_tree_create_with_options(options);
+    fclose(file);
+    return tree;
+#endif
+}
+enum owl_error owl_validate(const char *string, size_t length, struct source_range *error_range) {
+    return owl_validate_with_options((struct owl_tree_options){ .string = string, .length = length, .has_length = true }, error_range);
+}
+enum owl_error owl_validate_with_options(struct owl_tree_options options, struct source_range *error_range) {
+    struct owl_tree *tree = create_tree(options, true, 0, 0);
+    if (!tree)
+        return ERROR_INVALID_FILE;
+    enum owl_error error = owl_tree_get_error(tree, error_range);
+    owl_tree_destroy(tree);
+    return error;
+}
+#ifdef OWL_BUILDER
+enum owl_error owl_build(const char *string, size_t length, struct owl_builder builder, void **root, struct source_range *error_range) {
+    return owl_build_with_options((struct owl_tree_options){ .string = string, .length = length, .has_length = true }, builder, root, error_range);
+}
+enum owl_error owl_build_with_options(struct owl_tree_options options, struct owl_builder builder, void **root, struct source_range *error_range) {
+    if (root)
+        *root = 0;
+    if (!builder.build)
+        return ERROR_INVALID_OPTIONS;
+    struct owl_tree *tree = create_tree(options, false, &builder, 0);
+    if (!tree)
+        return ERROR_INVALID_FILE;
+    enum owl_error error = owl_tree_get_error(tree, error_range);
+    if (error == ERROR_NONE && root)
+        *root = (void *)(uintptr_t)tree->root_offset;
+    owl_tree_destroy(tree);
+    return error;
+}
+#endif
+#ifdef OWL_BATCH
+// Parses inputs[index] into out[index].
+static void parse_batch_input(struct owl_tree_options options, const char **inputs, const size_t *lengths, struct owl_tree **out, size_t index, struct owl_parser *parser) {
+    options.string = inputs[index];
+    options.length = lengths ? lengths[index] : 0;
+    options.has_length = lengths != 0;
+    options.threads = 1;
+    out[index] = create_tree(options, false, 0, parser);
+}
+#ifdef OWL_THREADS
+// Each worker parses the inputs from `next` up to `end`.  Once it runs out, it
+// steals the second half of another worker's remaining inputs.
+struct batch_worker {
+    struct batch *batch;
+    size_t index;
+    pthread_mutex_t lock;
+    size_t next;
+    size_t end;
+    pthread_t thread;
+    bool started;
+};
+struct batch {
+    struct owl_tree_options options;
+    const char **inputs;
+    const size_t *lengths;
+    struct owl_tree **out;
+    struct batch_worker *workers;
+    size_t number_of_workers;
+};
+// Finds the next input for a worker to parse, stealing if its own are gone.
+static bool take_batch_input(struct batch_worker *worker, size_t *index) {
+    pthread_mutex_lock(&worker->lock);
+    bool found = worker->next < worker->end;
+    if (found)
+        *index = worker->next++;
+    pthread_mutex_unlock(&worker->lock);
+    if (found)
+        return true;
+    struct batch *batch = worker->batch;
+    for (size_t i = 1; i < batch->number_of_workers; ++i) {
+        struct batch_worker *victim = &batch->workers[(worker->index + i) % batch->number_of_workers];
+        pthread_mutex_lock(&victim->lock);
+        size_t end = victim->end;
+        size_t start = end - (end - victim->next) / 2;
+        if (start == end && victim->next < end)
+            start--;
+        victim->end = start;
+        pthread_mutex_unlock(&victim->lock);
+        if (start == end)
+            continue;
+        pthread_mutex_lock(&worker->lock);
+        worker->next = start + 1;
+        worker->end = end;
+        pthread_mutex_unlock(&worker->lock);
+        *index = start;
+        return true;
+    }
+    return false;
+}
+static void *run_batch_worker(void *data) {
+    struct batch_worker *worker = data;
+    struct batch *batch = worker->batch;
+    // Each worker has a parser of its own, which keeps its memory from one input
+    // to the next.
+    struct owl_parser parser = { .allocator = allocator_from_options(batch->options) };
+    size_t index;
+    while (take_batch_input(worker, &index))
+        parse_batch_input(batch->options, batch->inputs, batch->lengths, batch->out, index, &parser);
+    free_parser_memory(&parser);
+    return 0;
+}
+#endif
+void owl_parse_batch(const char **inputs, const size_t *lengths, size_t n, struct owl_tree **out, int threads) {
+    owl_parse_batch_with_options((struct owl_tree_options){ .threads = threads > 0 ? (unsigned)threads : 1 }, inputs, lengths, n, out);
+}
+void owl_parse_batch_with_options(struct owl_tree_options options, const char **inputs, const size_t *lengths, size_t n, struct owl_tree **out) {
+    if (options.file || options.string || !allocator_options_are_valid(options)) {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = owl_tree_create_with_error(ERROR_INVALID_OPTIONS);
+        return;
+    }
+#ifdef OWL_THREADS
+    size_t number_of_workers = options.threads < n ? options.threads : n;
+    if (number_of_workers > 1) {
+        struct owl_allocator allocator = allocator_from_options(options);
+        struct batch_worker *workers = allocate_memory(number_of_workers * sizeof(struct batch_worker), &allocator);
+        if (!workers)
+            abort();
+        struct batch batch = {
+            .options = options,
+            .inputs = inputs,
+            .lengths = lengths,
+            .out = out,
+            .workers = workers,
+            .number_of_workers = number_of_workers,
+        };
+        for (size_t i = 0; i < number_of_workers; ++i) {
+            workers[i] = (struct batch_worker){
+                .batch = &batch,
+                .index = i,
+                .next = n * i / number_of_workers,
+                .end = n * (i + 1) / number_of_workers,
+            };
+            pthread_mutex_init(&workers[i].lock, 0);
+        }
+        // The calling thread is the first worker.
+        for (size_t i = 1; i < number_of_workers; ++i)
+            workers[i].started = pthread_create(&workers[i].thread, 0, run_batch_worker, &workers[i]) == 0;
+        run_batch_worker(&workers[0]);
+        for (size_t i = 1; i < number_of_workers; ++i) {
+            if (workers[i].started)
+                pthread_join(workers[i].thread, 0);
+        }
+        for (size_t i = 0; i < number_of_workers; ++i)
+            pthread_mutex_destroy(&workers[i].lock);
+        free_memory(workers, number_of_workers * sizeof(struct batch_worker), &allocator);
+        return;
+    }
+#endif
+    struct owl_parser parser = { .allocator = allocator_from_options(options) };
+    for (size_t i = 0; i < n; ++i)
+        parse_batch_input(options, inputs, lengths, out, i, &parser);
+    free_parser_memory(&parser);
+}
+#endif
+#ifdef OWL_PARSER_API
+struct owl_parser *owl_parser_create(void) {
+    return owl_parser_create_with_options((struct owl_tree_options){ 0 });
+}
+struct owl_parser *owl_parser_create_with_options(struct owl_tree_options options) {
+    bool valid = allocator_options_are_valid(options);
+    struct owl_allocator allocator = { 0 };
+    if (valid)
+        allocator = allocator_from_options(options);
+    struct owl_parser *parser = allocate_memory(sizeof(struct owl_parser), &allocator);
+    if (!parser)
+        return 0;
+    *parser = (struct owl_parser){ .allocator = allocator };
+    parser->capacity = FEED_BATCH_SIZE;
+    parser->buffer = allocate_memory(parser->capacity, &allocator);
+    if (!parser->buffer) {
+        free_memory(parser, sizeof(struct owl_parser), &allocator);
+        return 0;
+    }
+    parser->buffer[0] = '\0';
+    parser->resume_length = FEED_BATCH_SIZE;
+    struct owl_tree *tree = owl_tree_create_empty(allocator);
+    if (options.file || options.string || !valid)
+        tree->error = ERROR_INVALID_OPTIONS;
+#ifdef OWL_INDEX
+    if (options.index_rules)
+        tree->rule_index = create_rule_index(&tree->allocator);
+    if (options.index_locations)
+        tree->location_index = create_location_index(&tree->allocator);
+#endif
+    start_parsing(parser, tree);
+    return parser;
+}
+bool owl_parser_feed(struct owl_parser *parser, const char *chunk, size_t length) {
+    if (parser->finished || parser->tree->error != ERROR_NONE)
+        return false;
+    if (length >= parser->capacity - parser->length) {
+        size_t capacity = parser->capacity;
+        while (length >= capacity - parser->length) {
+            if (capacity > SIZE_MAX / 2)
+                abort();
+            capacity *= 2;
+        }
+        char *buffer = reallocate_memory(parser->buffer, parser->capacity, capacity, &parser->allocator);
+        if (!buffer)
+            abort();
+        parser->buffer = buffer;
+        parser->capacity = capacity;
+    }
+    memcpy(parser->buffer + parser->length, chunk, length);
+    parser->length += length;
+    parser->buffer[parser->length] = '\0';
+    if (parser->length < parser->resume_length)
+        return true;
+    if (!parse_text(parser, parser->buffer, parser->length, true))
+        return false;
+    // If a long token is still incomplete, wait for the pending input to double
+    // before scanning it again.
+    size_t pending = parser->length - parser->tokenizer.offset;
+    parser->resume_length = parser->length + (pending > FEED_BATCH_SIZE ? pending : FEED_BATCH_SIZE);
+    return true;
+}
+struct owl_tree *owl_parser_finish(struct owl_parser *parser) {
+    struct owl_tree *tree = parser->tree;
+    if (parser->finished)
+        free_memory(parser->buffer, parser->capacity, &parser->allocator);
+    else {
+        tree->string = parser->buffer;
+        tree->owned_string_size = parser->capacity;
+        if (tree->error == ERROR_NONE)
+            parse_text(parser, parser->buffer, parser->length, false);
+        finish_parsing(parser);
+    }
+    free_parser_memory(parser);
+    free_memory(parser, sizeof(struct owl_parser), &parser->allocator);
+    return tree;
+}
+void owl_parser_reset(struct owl_parser *parser) {
+    recycle_token_runs(parser);
+    struct owl_tree *tree = parser->tree;
+    *tree = (struct owl_tree){
+        .allocator = tree->allocator,
+        .parse_tree = tree->parse_tree,
+        .parse_tree_size = tree->parse_tree_size,
+#ifdef OWL_INDEX
+        .rule_index = tree->rule_index,
+        .location_index = tree->location_index,
+#endif
+        // Invalid options stay invalid.
+        .error = tree->error == ERROR_INVALID_OPTIONS ? ERROR_INVALID_OPTIONS : ERROR_NONE,
+    };
+#ifdef OWL_INDEX
+    clear_indexes(tree);
+#endif
+    parser->finished = false;
+    parser->length = 0;
+    parser->buffer[0] = '\0';
+    parser->resume_length = FEED_BATCH_SIZE;
+    start_parsing(parser, tree);
+}
+struct owl_tree *owl_parser_parse(struct owl_parser *parser, const char *string) {
+    owl_parser_reset(parser);
+    struct owl_tree *tree = parser->tree;
+    parser->finished = true;
+    if (tree->error != ERROR_NONE)
+        return tree;
+    tree->string = string;
+    parse_text(parser, string, strlen(string), false);
+    finish_parsing(parser);
     return tree;
 }
+void owl_parser_destroy(struct owl_parser *parser) {
+    if (!parser)
+        return;
+    free_parser_memory(parser);
+    owl_tree_destroy(parser->tree);
+    struct owl_allocator allocator = parser->allocator;
+    free_memory(parser->buffer, parser->capacity, &allocator);
+    free_memory(parser, sizeof(struct owl_parser), &allocator);
+}
+#endif
 enum owl_error owl_tree_get_error(struct owl_tree *tree, struct source_range *error_range) {
     if (error_range)
         *error_range = tree->error_range;
@@ -3124,26 +6225,434 @@ enum owl_error owl_tree_get_error(struct owl_tree *tree, struct source_range *er
 void owl_tree_destroy(struct owl_tree *tree) {
     if (!tree)
         return;
-    if (tree->owns_string)
-        free((void *)tree->string);
-    free(tree->parse_tree);
-    free(tree);
+    if (tree->owned_string_size)
+        free_memory((void *)tree->string, tree->owned_string_size, &tree->allocator);
+#ifdef OWL_MMAP
+    if (tree->mapped_length)
+        munmap((void *)tree->string, tree->mapped_length);
+#endif
+    struct owl_allocator allocator = tree->allocator;
+#ifdef OWL_INDEX
+    if (tree->rule_index) {
+        for (size_t i = 0; i < 36; ++i)
+            free_match_list(&tree->rule_index->lists[i], &allocator);
+        free_memory(tree->rule_index, sizeof(struct rule_index), &allocator);
+    }
+    if (tree->location_index) {
+        struct location_index *index = tree->location_index;
+        free_match_list(&index->nodes, &allocator);
+        free_memory(index->furthest_ends, index->furthest_ends_capacity * sizeof(size_t), &allocator);
+        free_memory(index, sizeof(struct location_index), &allocator);
+    }
+#endif
+    free_memory(tree->parse_tree, tree->parse_tree_size, &allocator);
+    free_memory(tree, sizeof(struct owl_tree), &allocator);
 }
-static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index) {
-    uint16_t token_index = 0;
-    uint16_t number_of_tokens = run->number_of_tokens;
-    while (token_index < number_of_tokens) {
-        struct fill_run_state *top = &cont->stack[cont->top_index];
-        run->states[token_index] = top->state;
-        state_funcs[top->state](run, top, token_index);
-        if (cont->error) {
-            *failing_index = token_index - (cont->error > 0 ? 0 : 1);
-            return false;
+#ifdef OWL_COMPACT
+// An element of the tree, as read by owl_tree_compact().
+struct compact_element {
+    size_t start;
+    size_t end;
+    // The choice, or zero if the rule doesn't have any.
+    uint32_t type;
+    size_t number_of_slots;
+    struct owl_ref slots[10];
+    bool is_token;
+    bool has_value;
+    uint64_t value;
+    bool is_string;
+    // The contents of a string with escapes, which are kept in the tree.
+    const char *string;
+    size_t string_length;
+};
+struct compaction {
+    struct owl_tree *tree;
+    // For each element in preorder: the offset to its next sibling, if there is
+    // one, then the offset to its token record or to each non-empty slot's list.
+    size_t *offsets;
+    size_t number_of_offsets;
+    size_t offsets_capacity;
+    size_t next_offset;
+    // Absolute offsets are padded to this many bytes.
+    size_t offset_width;
+};
+static size_t tree_field_size(uint64_t value)
+{
+    size_t size = 1;
+    while (value >>= 7)
+        size++;
+    return size;
+}
+static void write_tree_padded(struct owl_tree *tree, uint64_t value, size_t width)
+{
+    size_t reserved_size = tree->next_offset + RESERVATION_AMOUNT;
+    if (tree->parse_tree_size <= reserved_size && !grow_tree(tree, reserved_size))
+        abort();
+    for (size_t i = 1; i < width; ++i) {
+        tree->parse_tree[tree->next_offset++] = 0x80 | (value & 0x7f);
+        value >>= 7;
+    }
+    tree->parse_tree[tree->next_offset++] = value & 0x7f;
+}
+static void describe_element(struct owl_ref ref, struct compact_element *e)
+{
+    *e = (struct compact_element){0};
+    switch (ref._type) {
+    case 0: {
+        struct parsed_grammar it = parsed_grammar_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->slots[0] = it.rule;
+        e->slots[1] = it.comment_token;
+        e->slots[2] = it.custom_token;
+        e->slots[3] = it.whitespace;
+        e->number_of_slots = 4;
+        break;
+    }
+    case 1: {
+        struct parsed_rule it = parsed_rule_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->slots[0] = it.identifier;
+        e->slots[1] = it.body;
+        e->number_of_slots = 2;
+        break;
+    }
+    case 2: {
+        struct parsed_body it = parsed_body_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->slots[0] = it.expr;
+        e->slots[1] = it.identifier;
+        e->slots[2] = it.operators;
+        e->number_of_slots = 3;
+        break;
+    }
+    case 3: {
+        struct parsed_operators it = parsed_operators_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->slots[0] = it.fixity;
+        e->slots[1] = it.operator;
+        e->number_of_slots = 2;
+        break;
+    }
+    case 4: {
+        struct parsed_fixity it = parsed_fixity_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->type = it.type;
+        e->slots[0] = it.assoc;
+        e->number_of_slots = 1;
+        break;
+    }
+    case 5: {
+        struct parsed_assoc it = parsed_assoc_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->type = it.type;
+        break;
+    }
+    case 6: {
+        struct parsed_operator it = parsed_operator_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->slots[0] = it.expr;
+        e->slots[1] = it.identifier;
+        e->number_of_slots = 2;
+        break;
+    }
+    case 7: {
+        struct parsed_expr it = parsed_expr_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->type = it.type;
+        e->slots[0] = it.identifier;
+        e->slots[1] = it.exception;
+        e->slots[2] = it.rename;
+        e->slots[3] = it.string;
+        e->slots[4] = it.expr;
+        e->slots[5] = it.begin_token;
+        e->slots[6] = it.end_token;
+        e->slots[7] = it.repetition;
+        e->slots[8] = it.operand;
+        e->number_of_slots = 9;
+        break;
+    }
+    case 8: {
+        struct parsed_repetition it = parsed_repetition_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->type = it.type;
+        e->slots[0] = it.begin;
+        e->slots[1] = it.end;
+        e->number_of_slots = 2;
+        break;
+    }
+    case 9: {
+        struct parsed_comment_token it = parsed_comment_token_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->slots[0] = it.string;
+        e->slots[1] = it.comment_token_v1;
+        e->number_of_slots = 2;
+        break;
+    }
+    case 10: {
+        struct parsed_comment_token_v1 it = parsed_comment_token_v1_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->slots[0] = it.string;
+        e->number_of_slots = 1;
+        break;
+    }
+    case 11: {
+        struct parsed_custom_token it = parsed_custom_token_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->slots[0] = it.identifier;
+        e->slots[1] = it.string;
+        e->number_of_slots = 2;
+        break;
+    }
+    case 12: {
+        struct parsed_whitespace it = parsed_whitespace_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->slots[0] = it.string;
+        e->number_of_slots = 1;
+        break;
+    }
+    case 13: {
+        struct parsed_identifier it = parsed_identifier_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->is_token = true;
+        break;
+    }
+    case 14: {
+        struct parsed_string it = parsed_string_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->is_token = true;
+        e->is_string = true;
+        uintptr_t contents = (uintptr_t)ref._tree->parse_tree;
+        if ((uintptr_t)it.string >= contents && (uintptr_t)it.string < contents + ref._tree->parse_tree_size) {
+            e->string = it.string;
+            e->string_length = it.length;
         }
-        token_index++;
+        break;
     }
-    return true;
+    case 15: {
+        struct parsed_integer it = parsed_integer_get(ref);
+        e->start = it.range.start;
+        e->end = it.range.end;
+        e->is_token = true;
+        e->has_value = true;
+        e->value = it.integer;
+        break;
+    }
+    default:
+        break;
+    }
+}
+static size_t string_contents_size(size_t length)
+{
+    return length;
+}
+// Returns the size of a token's record, and any string contents after it.
+static size_t token_record_size(struct compaction *c, struct compact_element *e)
+{
+    size_t size = tree_field_size(0) + tree_field_size(e->start) + tree_field_size(e->end - e->start);
+    if (e->has_value)
+        size += tree_field_size(e->value);
+    if (e->is_string && e->string)
+        size += c->offset_width + tree_field_size(e->string_length) + string_contents_size(e->string_length);
+    else if (e->is_string)
+        size += tree_field_size(0);
+    return size;
+}
+static size_t measure_list(struct compaction *c, struct owl_ref ref);
+// Returns the number of offsets recorded for an element.
+static size_t count_offsets(struct compact_element *e, struct owl_ref next)
+{
+    size_t count = next.empty ? 0 : 1;
+    if (e->is_token)
+        return count + 1;
+    for (size_t i = 0; i < e->number_of_slots; ++i) {
+        if (!e->slots[i].empty)
+            count++;
+    }
+    return count;
+}
+static size_t measure_element(struct compaction *c, struct owl_ref ref, struct owl_ref next)
+{
+    struct compact_element e;
+    describe_element(ref, &e);
+    size_t index = c->number_of_offsets;
+    size_t count = count_offsets(&e, next);
+    if (index + count > c->offsets_capacity) {
+        size_t capacity = (index + count) * 2 + 64;
+        size_t *offsets = reallocate_memory(c->offsets, c->offsets_capacity * sizeof(size_t),
+         capacity * sizeof(size_t), &c->tree->allocator);
+        if (!offsets)
+            abort();
+        c->offsets = offsets;
+        c->offsets_capacity = capacity;
+    }
+    c->number_of_offsets += count;
+    // The size of everything after the header: the slots' lists or the record.
+    size_t lists[10];
+    size_t body = 0;
+    for (size_t i = 0; i < e.number_of_slots; ++i) {
+        lists[i] = measure_list(c, e.slots[i]);
+        body += lists[i];
+    }
+    // Every header field except the offsets to later elements.
+    size_t fields = 0;
+    if (e.is_token)
+        body = token_record_size(c, &e);
+    else
+        fields += tree_field_size(e.start) + tree_field_size(e.end - e.start);
+    if (e.type)
+        fields += tree_field_size(e.type);
+    for (size_t i = 0; i < e.number_of_slots; ++i) {
+        if (e.slots[i].empty)
+            fields += tree_field_size(0);
+    }
+    // The offsets depend on the size of the header, which depends on the size of
+    // the offsets.  Start small and grow the header until they fit.
+    size_t header = fields;
+    while (true) {
+        size_t size = fields + tree_field_size(next.empty ? 0 : header + body);
+        if (e.is_token)
+            size += tree_field_size(header);
+        size_t list_offset = header;
+        for (size_t i = 0; i < e.number_of_slots; ++i) {
+            if (!e.slots[i].empty)
+                size += tree_field_size(list_offset);
+            list_offset += lists[i];
+        }
+        if (size == header)
+            break;
+        header = size;
+    }
+    if (!next.empty)
+        c->offsets[index++] = header + body;
+    if (e.is_token)
+        c->offsets[index++] = header;
+    size_t list_offset = header;
+    for (size_t i = 0; i < e.number_of_slots; ++i) {
+        if (!e.slots[i].empty)
+            c->offsets[index++] = list_offset;
+        list_offset += lists[i];
+    }
+    return header + body;
+}
+static size_t measure_list(struct compaction *c, struct owl_ref ref)
+{
+    size_t size = 0;
+    while (!ref.empty) {
+        struct owl_ref next = owl_next(ref);
+        size += measure_element(c, ref, next);
+        ref = next;
+    }
+    return size;
+}
+static void write_list(struct compaction *c, struct owl_ref ref);
+static void write_element(struct compaction *c, struct owl_ref ref, struct owl_ref next)
+{
+    struct owl_tree *tree = c->tree;
+    struct compact_element e;
+    describe_element(ref, &e);
+    size_t index = c->next_offset;
+    c->next_offset += count_offsets(&e, next);
+    size_t offset = tree->next_offset;
+#ifdef OWL_INDEX
+    if (tree->rule_index || tree->location_index)
+        index_match(tree, ref._type, e.type, offset, e.start, e.end);
+#endif
+    size_t size = next.empty ? 0 : c->offsets[index++];
+    write_tree(tree, size);
+    if (e.is_token) {
+        size_t header = c->offsets[index];
+        write_tree(tree, header);
+        write_tree(tree, 0);
+        write_tree(tree, e.start);
+        write_tree(tree, e.end - e.start);
+        if (e.has_value)
+            write_tree(tree, e.value);
+        if (e.is_string && e.string) {
+            // The contents go right after the record.
+            size_t record_size = tree->next_offset - offset - header;
+            record_size += c->offset_width + tree_field_size(e.string_length);
+            write_tree_padded(tree, offset + header + record_size, c->offset_width);
+            write_tree(tree, e.string_length);
+            memcpy(allocate_string_contents(e.string_length, tree), e.string, e.string_length);
+        } else if (e.is_string)
+            write_tree(tree, 0);
+        return;
+    }
+    write_tree(tree, e.start);
+    write_tree(tree, e.end - e.start);
+    if (e.type)
+        write_tree(tree, e.type);
+    for (size_t i = 0; i < e.number_of_slots; ++i) {
+        if (e.slots[i].empty) {
+            write_tree(tree, 0);
+            continue;
+        }
+        write_tree(tree, c->offsets[index++]);
+    }
+    for (size_t i = 0; i < e.number_of_slots; ++i)
+        write_list(c, e.slots[i]);
 }
+static void write_list(struct compaction *c, struct owl_ref ref)
+{
+    while (!ref.empty) {
+        struct owl_ref next = owl_next(ref);
+        write_element(c, ref, next);
+        ref = next;
+    }
+}
+void owl_tree_compact(struct owl_tree *tree) {
+    if (tree->error != ERROR_NONE || tree->root_offset == 0)
+        return;
+    // The old tree is read through a copy while the new one is written.
+    struct owl_tree old = *tree;
+    struct owl_ref root = owl_tree_root_ref(&old);
+    struct compaction c = {
+        .tree = tree,
+        .offset_width = tree_field_size(old.next_offset),
+    };
+    size_t size = measure_list(&c, root);
+    while (tree_field_size(1 + size) > c.offset_width) {
+        c.offset_width++;
+        c.number_of_offsets = 0;
+        size = measure_list(&c, root);
+    }
+    // Leave room after the last element for read_tree's bounds check.
+    size_t parse_tree_size = 1 + size + RESERVATION_AMOUNT + 1;
+    uint8_t *parse_tree = allocate_memory(parse_tree_size, &tree->allocator);
+    if (parse_tree) {
+        tree->parse_tree = parse_tree;
+        tree->parse_tree_size = parse_tree_size;
+        tree->next_offset = 1;
+        tree->root_offset = 1;
+        tree->compacted = true;
+#ifdef OWL_INDEX
+        clear_indexes(tree);
+        write_list(&c, root);
+        if (tree->rule_index || tree->location_index)
+            finish_indexes(tree);
+#else
+        write_list(&c, root);
+#endif
+        free_memory(old.parse_tree, old.parse_tree_size, &tree->allocator);
+    }
+    free_memory(c.offsets, c.offsets_capacity * sizeof(size_t), &tree->allocator);
+}
+#endif
 static const uint16_t actions[] = {
 0,0,4096,0,4096,4096,0,4096,4096,32768,32769,16385,0,4096,4096,32768,32769,32770,32769,16385,0,4096,4096,32768,32769,36864,40960,16384,0,4096,
 4096,32768,32769,36864,40960,16385,0,4096,4096,32768,32769,36864,40960,16386,0,4096,4096,32768,32769,36864,40961,16387,0,4096,4096,32768,32769,36864,40962,0,
@@ -3164,455 +6673,817 @@ static const uint16_t actions[] = {
 12288,16384,0,32775,12289,0,32775,12290,16385,0,36864,40960,16384,0,36864,40960,16385,0,36864,40960,16386,0,36864,40961,16387,0,36864,40962,0,36864,
 40963,0,36864,45060,0,36864,45061,0,36864,45062,0,36864,45063,0,36868,40960,16384,0,36868,40960,16385,0,36868,40960,16386,0,36868,40961,16387,0,
 36868,40962,0,36868,40963,0,36868,45060,0,36868,45061,0,36868,45062,0,36868,45063,0,};
-static const uint8_t action_table[1024][4][7] = {
-{{217,68,68,217,16,6,0,},{212,228,112,206,216,7,0,},},{{221,156,125,244,141,5,15,},{207,228,104,208,104,7,0,},},{{240,156,121,253,237,213,13,},{240,144,109,221,172,5,0,},},
-{{236,237,69,235,149,8,0,},{235,249,125,244,41,182,30,},},{{238,69,4,218,0,0,0,},{206,224,124,244,141,53,13,},},{{220,108,124,244,37,184,13,},{216,248,73,235,121,5,0,},
-{216,220,125,244,141,181,30,},},{{246,57,108,213,164,3,0,},{214,92,108,214,200,4,0,},{212,208,64,211,0,8,0,},},{{239,57,92,208,0,0,0,},{208,64,124,244,25,147,13,},
-{206,196,124,244,141,53,13,},},{{245,157,108,214,164,3,0,},{220,124,124,244,37,184,13,},},{{219,156,128,10,250,101,13,},{210,64,104,208,104,7,0,},{208,24,120,253,161,82,13,},},
-{{234,45,129,10,126,120,13,},{216,236,65,235,81,5,0,},},{{237,229,104,208,0,0,0,},{219,148,64,219,4,6,0,},{212,216,128,10,246,231,12,},},{{238,57,4,218,0,0,0,},
-{241,160,129,10,126,216,13,},{206,212,88,211,160,5,0,},},{{218,56,128,10,246,87,13,},{210,8,113,5,94,7,0,},{210,88,64,217,228,6,0,},},{{240,172,113,221,220,5,0,},
-{219,120,120,253,237,101,13,},{217,88,68,217,16,6,0,},},{{215,52,65,233,81,5,0,},{213,28,64,217,80,5,0,},},{{233,77,109,215,172,5,0,},{240,140,129,10,250,213,13,},
-{208,0,104,208,136,3,0,},},{{212,188,124,244,37,56,13,},{206,184,128,10,62,229,12,},},{{239,1,93,208,0,0,0,},{220,128,108,214,168,7,0,},},{{234,41,73,233,161,8,0,},
-{209,52,104,208,208,1,0,},},{{233,53,69,233,17,6,0,},{217,80,112,213,220,5,0,},{216,208,73,235,121,5,0,},},{{234,53,125,244,173,152,30,},{213,52,128,10,62,85,13,},},
-{{220,112,108,214,168,7,0,},{218,28,72,217,24,8,0,},{209,68,124,244,97,145,13,},},{{209,60,112,213,180,0,0,},},{{240,17,101,208,0,0,0,},{233,121,73,233,29,6,0,},
-{211,164,108,206,172,5,0,},{206,168,36,16,114,4,0,},},{{208,60,108,213,48,2,0,},},{{214,148,72,219,120,5,0,},{206,244,128,10,62,229,12,},},{{239,93,92,208,0,0,0,},
-{218,88,120,253,233,87,13,},{217,52,108,213,172,5,0,},},{{233,45,125,244,41,150,30,},{217,28,108,213,172,5,0,},},{{248,173,109,221,164,3,0,},{219,132,64,219,4,6,0,},
-{219,92,112,214,220,5,0,},{212,232,72,211,24,8,0,},},{{215,80,129,10,62,117,13,},{207,44,108,238,53,6,0,},},{{220,104,64,219,0,8,0,},},{{221,140,113,221,16,5,0,},
-{215,40,65,233,81,5,0,},},{{234,41,109,215,48,8,0,},{214,108,72,219,120,5,0,},},{{210,68,64,217,228,6,0,},{208,28,112,213,132,2,0,},},{{218,40,72,217,24,8,0,},
-{211,208,124,244,41,54,13,},},{{235,221,109,216,172,5,0,},{213,68,68,217,100,5,0,},{209,24,120,253,213,80,13,},},{{247,33,109,215,164,3,0,},{235,1,126,244,41,182,30,},
-{235,237,65,235,5,6,0,},{219,144,108,0,206,5,0,},},{{218,32,68,217,12,8,0,},{210,92,104,208,104,7,0,},{208,28,72,217,0,3,0,},},{{240,160,121,253,237,213,13,},
-{218,56,72,217,24,8,0,},{207,52,128,10,210,86,13,},},{{239,5,93,208,0,0,0,},{241,168,69,240,148,8,0,},{209,76,108,4,150,0,0,},},{{241,172,121,253,113,216,13,},
-{219,128,108,214,172,5,0,},{217,56,124,244,41,150,13,},},{{243,173,108,206,164,3,0,},{210,40,124,244,33,151,13,},},{{211,244,64,211,4,6,0,},{206,208,128,10,62,229,12,},},
-{{242,33,108,208,164,3,0,},{240,33,100,208,0,0,0,},{234,45,113,215,96,8,0,},{213,40,120,253,41,85,13,},},{{219,116,120,253,237,101,13,},{206,188,68,211,100,5,0,},},
-{{238,113,4,220,0,0,0,},{240,136,73,240,28,6,0,},{212,244,120,253,233,231,12,},{211,172,120,253,237,229,12,},},{{252,61,77,234,9,0,0,},{240,196,109,221,172,5,0,},
-{210,56,72,217,12,7,0,},},{{250,197,113,241,188,3,0,},{220,116,64,219,0,8,0,},{213,48,112,213,16,5,0,},},{{206,252,68,211,100,5,0,},},{{241,57,96,209,0,0,0,},
-{210,48,68,217,248,6,0,},{208,68,72,217,0,3,0,},},{{236,233,113,216,96,8,0,},{212,192,120,253,233,231,12,},},{{216,0,70,235,101,5,0,},{213,56,72,217,120,5,0,},
-{210,48,72,217,12,7,0,},},{{237,29,104,208,0,0,0,},{233,41,125,244,41,150,30,},{218,24,128,10,246,87,13,},{208,68,128,10,186,82,13,},},{{241,41,96,209,0,0,0,},
-{241,136,129,10,126,216,13,},{240,188,129,10,250,213,13,},{206,232,124,244,141,53,13,},},{{240,136,113,221,220,5,0,},{217,88,128,10,250,85,13,},{210,12,108,240,81,7,0,},},
-{{234,65,125,244,173,152,30,},{207,84,108,18,118,6,0,},{207,32,104,208,104,7,0,},},{{233,53,125,244,41,150,30,},{241,136,109,221,48,8,0,},},{{24,74,117,252,165,3,0,},
-{252,65,77,234,9,0,0,},{245,149,108,214,164,3,0,},{215,40,113,215,16,5,0,},},{{247,69,109,215,164,3,0,},{235,1,122,253,237,133,13,},{210,28,108,213,92,6,0,},},
-{{0}},{{218,80,124,244,37,152,13,},{214,112,64,219,80,5,0,},},{{241,9,97,209,0,0,0,},{234,69,129,10,126,120,13,},{214,152,108,15,226,4,0,},},{{210,64,112,213,164,6,0,},},
-{{216,236,73,235,121,5,0,},{213,64,128,10,62,85,13,},{211,208,68,211,16,6,0,},},{{254,93,117,25,154,7,0,},{235,221,69,235,17,6,0,},{219,148,72,219,28,6,0,},},
-{{217,52,124,244,41,150,13,},{215,68,73,233,121,5,0,},{206,212,64,211,80,5,0,},},{{214,136,88,219,160,5,0,},{210,88,120,253,189,86,13,},},{{240,172,121,253,237,213,13,},
-{218,68,124,244,37,152,13,},{209,68,128,10,242,80,13,},},{{221,168,109,221,200,4,0,},{213,28,72,217,120,5,0,},{211,240,108,2,206,5,0,},},{{236,249,69,235,149,8,0,},
-{219,112,112,214,220,5,0,},{216,0,74,235,121,5,0,},{214,100,64,219,80,5,0,},},{{236,225,73,235,161,8,0,},{236,25,121,253,113,136,13,},{214,116,68,219,100,5,0,},},
-{{213,88,88,217,160,5,0,},{213,64,0,242,209,3,0,},},{{221,184,109,12,250,4,0,},{220,132,68,219,12,8,0,},{211,224,108,206,172,5,0,},},{{252,129,77,234,9,0,0,},
-{217,36,108,213,172,5,0,},{206,196,112,206,16,5,0,},},{{234,33,129,10,126,120,13,},{240,188,69,240,16,6,0,},{214,100,128,10,62,101,13,},{208,52,108,213,48,2,0,},},
-{{233,57,121,253,237,117,13,},{218,28,64,217,0,8,0,},},{{246,85,108,18,174,3,0,},{215,64,109,215,200,4,0,},{209,60,120,253,213,80,13,},},{{233,121,113,215,220,5,0,},
-{206,168,28,16,50,4,0,},},{{236,209,121,253,113,136,13,},{208,64,120,253,161,82,13,},{206,244,68,211,100,5,0,},},{{220,120,124,244,37,184,13,},{212,224,68,211,12,8,0,},},
-{{246,69,108,213,164,3,0,},{217,60,128,10,250,85,13,},{211,200,68,211,16,6,0,},{208,40,64,217,208,2,0,},},{{214,120,72,219,120,5,0,},{212,208,108,206,168,7,0,},},
-{{212,232,112,206,216,7,0,},{210,28,124,244,33,151,13,},},{{221,172,121,253,41,213,13,},{207,64,72,217,12,7,0,},},{{241,1,97,209,0,0,0,},{220,104,72,219,24,8,0,},},
-{{241,144,129,10,126,216,13,},},{{247,41,109,215,164,3,0,},{236,201,65,235,137,8,0,},{218,80,128,10,246,87,13,},{208,80,124,244,25,147,13,},},{{233,69,129,10,250,117,13,},
-{210,68,72,217,12,7,0,},{208,28,120,253,161,82,13,},},{{213,68,128,10,62,85,13,},{209,92,104,208,208,1,0,},},{{253,205,53,236,1,0,0,},{215,56,89,233,161,5,0,},
-{209,68,108,213,84,0,0,},},{{219,136,108,214,172,5,0,},{217,48,124,244,41,150,13,},{213,52,124,244,141,149,13,},},{{216,232,109,216,200,4,0,},},{{220,156,108,214,168,7,0,},
-{219,132,128,10,250,101,13,},{218,56,64,217,0,8,0,},},{{219,156,120,253,237,101,13,},{206,200,124,244,141,53,13,},},{{235,229,125,244,41,182,30,},{218,48,128,10,246,87,13,},
-{206,208,112,206,16,5,0,},},{{234,69,121,253,113,120,13,},{240,132,121,253,237,213,13,},{210,4,105,208,104,7,0,},},{{221,172,73,240,120,5,0,},{219,124,128,10,250,101,13,},
-{211,244,72,211,28,6,0,},},{{218,68,68,217,12,8,0,},{209,48,72,217,68,1,0,},},{{219,116,64,219,4,6,0,},{212,184,128,10,246,231,12,},{206,188,124,244,141,53,13,},},
-{{217,32,128,10,250,85,13,},{212,244,112,206,216,7,0,},{208,40,108,213,48,2,0,},},{{210,56,64,217,228,6,0,},},{{217,40,64,217,4,6,0,},{209,56,112,213,180,0,0,},},
-{{241,152,69,240,148,8,0,},{241,132,129,10,126,216,13,},{219,100,64,219,4,6,0,},},{{236,213,65,235,137,8,0,},{208,48,68,217,232,2,0,},{206,96,12,7,226,3,0,},},
-{{233,57,129,10,250,117,13,},{216,204,125,244,141,181,30,},{207,68,104,208,104,7,0,},},{{218,68,64,217,0,8,0,},{211,160,112,206,220,5,0,},{209,32,120,253,213,80,13,},},
-{{250,141,113,241,188,3,0,},{217,68,120,253,237,85,13,},{207,68,128,10,210,86,13,},},{{234,57,125,244,173,152,30,},{209,64,124,244,97,145,13,},},{{240,136,121,253,237,213,13,},
-{207,40,68,217,248,6,0,},},{{234,65,69,233,149,8,0,},{212,188,128,10,246,231,12,},},{{235,249,109,216,172,5,0,},{212,244,68,211,12,8,0,},{208,40,104,208,136,3,0,},},
-{{245,125,108,214,164,3,0,},{206,224,108,206,200,4,0,},},{{220,124,120,253,233,103,13,},{207,56,68,217,248,6,0,},},{{221,156,69,240,100,5,0,},{209,88,64,217,12,1,0,},},
-{{235,233,109,216,172,5,0,},{216,220,65,235,81,5,0,},{212,228,128,10,246,231,12,},},{{243,245,108,206,164,3,0,},{242,37,108,208,164,3,0,},{219,156,68,219,16,6,0,},},
-{{243,177,108,206,164,3,0,},{214,116,108,214,200,4,0,},{210,64,120,253,189,86,13,},},{{251,209,4,212,0,0,0,},{240,144,73,240,28,6,0,},{209,28,68,217,40,1,0,},},
-{{221,160,109,221,200,4,0,},{217,88,64,217,4,6,0,},{211,248,108,17,190,5,0,},},{{219,120,64,219,4,6,0,},{217,40,120,253,237,85,13,},{206,212,72,211,120,5,0,},},
-{{214,108,68,219,100,5,0,},{210,88,112,213,164,6,0,},},{{218,52,112,213,216,7,0,},{210,80,68,217,248,6,0,},{208,36,72,217,0,3,0,},},{{209,56,124,244,97,145,13,},},
-{{219,132,124,244,41,182,13,},{214,100,72,219,120,5,0,},{210,36,64,217,228,6,0,},},{{236,225,65,235,137,8,0,},{217,36,128,10,250,85,13,},{212,188,108,206,168,7,0,},
-{207,0,105,208,104,7,0,},},{{234,69,65,233,137,8,0,},{221,144,73,240,120,5,0,},{213,36,108,213,200,4,0,},},{{7,94,8,6,10,0,0,},{211,180,112,206,220,5,0,},
-{209,52,120,253,213,80,13,},},{{239,229,92,208,0,0,0,},{219,104,112,214,220,5,0,},{206,196,120,253,41,229,12,},},{{236,233,121,253,113,136,13,},{208,8,105,208,136,3,0,},},
-{{247,57,109,215,164,3,0,},{220,112,124,244,37,184,13,},{207,64,64,217,228,6,0,},},{{238,101,4,220,0,0,0,},{213,52,88,217,160,5,0,},{211,216,124,244,41,54,13,},
-{206,176,128,10,62,229,12,},},{{4,90,44,246,1,0,0,},{241,156,109,221,48,8,0,},{207,88,128,10,210,86,13,},},{{236,209,113,216,96,8,0,},{217,68,128,10,250,85,13,},
-{208,64,112,213,132,2,0,},},{{251,213,4,212,0,0,0,},{240,140,113,221,220,5,0,},{207,88,104,208,104,7,0,},},{{235,225,129,10,250,133,13,},{241,172,69,240,148,8,0,},
-{219,132,68,219,16,6,0,},},{{233,45,109,215,172,5,0,},{217,28,124,244,41,150,13,},{214,156,72,219,120,5,0,},},{{215,56,113,215,16,5,0,},{212,232,120,253,233,231,12,},},
-{{240,148,121,253,237,213,13,},{216,208,109,216,200,4,0,},{207,80,112,213,164,6,0,},},{{236,205,129,10,126,136,13,},{210,16,104,208,104,7,0,},},{{235,245,109,14,206,5,0,},
-{209,16,112,237,225,1,0,},},{{236,201,73,235,161,8,0,},{214,156,68,219,100,5,0,},{208,88,72,217,0,3,0,},},{{252,57,77,234,9,0,0,},{216,224,109,216,200,4,0,},
-{208,28,64,217,208,2,0,},},{{0}},{{0}},{{21,22,81,19,2,0,0,},{0,158,44,245,1,0,0,},{217,68,108,213,172,5,0,},{214,112,72,219,120,5,0,},},{{241,196,73,240,160,8,0,},
-{210,12,105,208,104,7,0,},{207,52,68,217,248,6,0,},},{{218,56,120,253,233,87,13,},{216,232,129,10,62,133,13,},{210,40,104,208,104,7,0,},},{{219,136,128,10,250,101,13,},
-{211,252,68,211,16,6,0,},{210,8,105,208,104,7,0,},},{{219,124,112,214,220,5,0,},{206,208,120,253,41,229,12,},},{{220,100,112,214,216,7,0,},{208,32,108,213,48,2,0,},},
-{{234,129,113,215,96,8,0,},{241,172,129,10,126,216,13,},{218,64,128,10,246,87,13,},},{{240,196,129,10,250,213,13,},{215,116,109,9,250,4,0,},{209,48,64,217,12,1,0,},},
-{{217,80,108,213,172,5,0,},{206,200,112,206,16,5,0,},},{{236,237,113,216,96,8,0,},{241,144,73,240,160,8,0,},{206,192,68,211,100,5,0,},},{{220,116,124,244,37,184,13,},
-{207,24,108,213,92,6,0,},},{{237,89,104,208,0,0,0,},{221,188,125,244,141,5,15,},{217,40,72,217,28,6,0,},{206,172,128,10,62,229,12,},},{{241,196,65,240,136,8,0,},
-{219,100,72,219,28,6,0,},{216,248,129,10,62,133,13,},},{{236,213,121,253,113,136,13,},{208,68,120,253,161,82,13,},{208,48,124,244,25,147,13,},},{{236,221,69,235,149,8,0,},
-{234,77,109,215,48,8,0,},{207,68,112,213,164,6,0,},},{{218,68,72,217,24,8,0,},{211,160,120,253,237,229,12,},{209,32,112,213,180,0,0,},},{{236,225,129,10,126,136,13,},
-{217,68,112,213,220,5,0,},{206,164,108,206,200,4,0,},},{{245,117,108,214,164,3,0,},{233,53,113,215,220,5,0,},{206,232,108,206,200,4,0,},},{{240,136,65,240,4,6,0,},
-{213,80,68,217,100,5,0,},{207,40,124,244,33,151,13,},},{{240,1,100,208,0,0,0,},{220,100,128,10,246,103,13,},{215,40,109,215,200,4,0,},},{{209,80,68,217,40,1,0,},
-{206,232,128,10,62,229,12,},},{{243,253,108,206,164,3,0,},{220,108,64,219,0,8,0,},{214,128,120,253,41,101,13,},{214,112,68,219,100,5,0,},},{{243,185,108,206,164,3,0,},
-{240,152,65,240,4,6,0,},{208,16,104,208,136,3,0,},},{{209,88,72,217,68,1,0,},},{{209,64,68,217,40,1,0,},},{{241,89,96,209,0,0,0,},{206,200,88,211,160,5,0,},},
-{{216,24,113,216,16,5,0,},},{{240,160,125,244,41,6,15,},},{{235,225,125,244,41,182,30,},{213,20,0,242,209,3,0,},},{{241,168,65,240,136,8,0,},{218,68,120,253,233,87,13,},
-{206,212,112,206,16,5,0,},},{{210,88,104,208,104,7,0,},{210,44,108,238,53,6,0,},},{{243,217,108,206,164,3,0,},{218,52,120,253,233,87,13,},{208,36,64,217,208,2,0,},},
-{{244,49,85,254,1,0,0,},{233,129,69,233,17,6,0,},{211,200,112,206,220,5,0,},},{{240,172,129,10,250,213,13,},{212,252,68,211,12,8,0,},},{{6,206,108,251,117,3,0,},
-{233,129,109,215,172,5,0,},{241,132,109,221,48,8,0,},{208,0,105,208,136,3,0,},},{{242,1,109,208,164,3,0,},{208,16,105,208,136,3,0,},},{{220,128,128,10,246,103,13,},
-{211,180,120,253,237,229,12,},{209,52,112,213,180,0,0,},},{{241,148,109,221,48,8,0,},{217,88,112,213,220,5,0,},{206,252,88,211,160,5,0,},},{{220,136,64,219,0,8,0,},
-{208,52,124,244,25,147,13,},},{{207,28,68,217,248,6,0,},},{{241,148,129,10,126,216,13,},{211,172,112,206,220,5,0,},{210,0,113,237,113,7,0,},},{{221,136,65,240,80,5,0,},
-{217,64,120,253,237,85,13,},{211,208,64,211,4,6,0,},},{{250,157,113,241,188,3,0,},{216,200,65,235,81,5,0,},{208,40,68,217,232,2,0,},},{{240,140,121,253,237,213,13,},
-{218,64,108,213,168,7,0,},{207,8,113,5,94,7,0,},},{{216,208,129,10,62,133,13,},{215,80,125,244,141,149,30,},},{{217,28,68,217,16,6,0,},{206,228,128,10,62,229,12,},},
-{{0,134,44,245,1,0,0,},{233,45,129,10,250,117,13,},{241,140,65,240,136,8,0,},},{{14,202,45,249,1,0,0,},{240,148,113,221,220,5,0,},{207,80,120,253,189,86,13,},},
-{{237,13,105,208,0,0,0,},{221,152,121,253,41,213,13,},{221,152,109,221,200,4,0,},{211,192,108,206,172,5,0,},},{{233,81,73,233,29,6,0,},{209,16,104,208,208,1,0,},},
-{{236,201,113,216,96,8,0,},{208,88,112,213,132,2,0,},{207,36,128,10,210,86,13,},},{{214,120,68,219,100,5,0,},{210,68,120,253,189,86,13,},{207,16,105,208,104,7,0,},},
-{{246,53,108,213,164,3,0,},{244,69,85,234,1,0,0,},{215,32,109,215,200,4,0,},{214,144,108,0,250,4,0,},},{{235,1,66,235,5,6,0,},{235,237,125,244,41,182,30,},
-{214,124,72,219,120,5,0,},},{{255,157,40,245,1,0,0,},{219,136,124,244,41,182,13,},{206,216,120,253,41,229,12,},},{{220,148,64,219,0,8,0,},{212,160,108,206,168,7,0,},
-{208,88,64,217,208,2,0,},},{{246,37,108,213,164,3,0,},{240,160,65,240,4,6,0,},{218,56,112,213,216,7,0,},{213,24,108,213,200,4,0,},},{{238,65,4,218,0,0,0,},
-{237,65,104,208,0,0,0,},{233,65,121,253,237,117,13,},{240,152,69,240,16,6,0,},},{{240,168,129,10,250,213,13,},{212,196,108,206,168,7,0,},{210,40,72,217,12,7,0,},},
-{{220,132,64,219,0,8,0,},{210,32,108,213,92,6,0,},},{{234,129,121,253,113,120,13,},{216,204,109,216,200,4,0,},{213,32,68,217,100,5,0,},},{{237,81,104,208,0,0,0,},
-{211,176,112,206,220,5,0,},{209,48,120,253,213,80,13,},},{{212,176,120,253,233,231,12,},{206,188,108,206,200,4,0,},},{{241,144,65,240,136,8,0,},{219,108,68,219,16,6,0,},
-{208,40,124,244,25,147,13,},},{{213,48,68,217,100,5,0,},{212,224,120,253,233,231,12,},},{{242,57,108,208,164,3,0,},{235,209,65,235,5,6,0,},{241,152,129,10,126,216,13,},
-{241,148,113,221,96,8,0,},},{{241,196,121,253,113,216,13,},{219,100,112,214,220,5,0,},{206,172,108,206,200,4,0,},},{{240,37,100,208,0,0,0,},{236,213,113,216,96,8,0,},
-{207,24,128,10,210,86,13,},},{{236,1,66,235,137,8,0,},{220,124,108,214,168,7,0,},{208,56,72,217,0,3,0,},{207,68,120,253,189,86,13,},},{{233,41,65,233,5,6,0,},
-{218,48,108,213,168,7,0,},{211,160,128,10,250,229,12,},},{{213,56,68,217,100,5,0,},{213,28,68,217,100,5,0,},},{{235,249,129,10,250,133,13,},{216,248,113,216,16,5,0,},},
-{{220,100,68,219,12,8,0,},{216,212,69,235,101,5,0,},{212,244,64,211,0,8,0,},},{{207,32,64,217,228,6,0,},},{{251,193,4,212,0,0,0,},},{{235,205,65,235,5,6,0,},
-{220,108,72,219,24,8,0,},{207,56,128,10,210,86,13,},},{{240,152,73,240,28,6,0,},{216,228,69,235,101,5,0,},{208,204,108,251,21,2,0,},},{{237,17,105,208,0,0,0,},
-{209,88,112,213,180,0,0,},},{{216,24,129,10,62,133,13,},{207,24,120,253,189,86,13,},},{{218,28,128,10,246,87,13,},{206,220,128,10,62,229,12,},},{{244,53,85,234,1,0,0,},
-{219,120,112,214,220,5,0,},{216,236,125,244,141,181,30,},{207,48,108,213,92,6,0,},},{{218,60,120,253,233,87,13,},{212,176,128,10,246,231,12,},},{{253,229,53,236,1,0,0,},
-{235,225,69,235,17,6,0,},{241,160,109,221,48,8,0,},{209,24,128,10,242,80,13,},},{{217,52,68,217,16,6,0,},{212,216,108,206,168,7,0,},{206,212,120,253,41,229,12,},},
-{{214,136,64,219,80,5,0,},{209,56,120,253,213,80,13,},},{{242,9,109,208,164,3,0,},},{{240,152,109,221,172,5,0,},{211,232,124,244,41,54,13,},{211,188,120,253,237,229,12,},},
-{{247,77,109,215,164,3,0,},{221,144,69,240,100,5,0,},{214,100,88,219,160,5,0,},{212,192,68,211,12,8,0,},},{{236,225,113,216,96,8,0,},{235,221,129,10,250,133,13,},
-{233,53,129,10,250,117,13,},},{{244,121,85,234,1,0,0,},{213,36,124,244,141,149,13,},{211,232,120,253,237,229,12,},},{{236,229,69,235,149,8,0,},{206,196,68,211,100,5,0,},},
-{{217,88,120,253,237,85,13,},{206,176,108,206,200,4,0,},},{{220,136,72,219,24,8,0,},{210,52,124,244,33,151,13,},{207,28,128,10,210,86,13,},},{{13,202,41,249,1,0,0,},
-{210,52,128,10,210,86,13,},{207,28,124,244,33,151,13,},},{{233,61,113,215,220,5,0,},{213,52,72,217,120,5,0,},{211,216,108,206,172,5,0,},},{{217,64,112,213,220,5,0,},
-{211,208,72,211,28,6,0,},{209,36,68,217,40,1,0,},},{{236,209,129,10,126,136,13,},{220,120,72,219,24,8,0,},{212,224,112,206,216,7,0,},{208,64,128,10,186,82,13,},},
-{{233,121,129,10,250,117,13,},{207,8,105,208,104,7,0,},{207,88,120,253,189,86,13,},},{{221,144,109,221,200,4,0,},{215,80,69,233,101,5,0,},{211,200,108,206,172,5,0,},},
-{{241,136,69,240,148,8,0,},{210,52,108,213,92,6,0,},},{{238,157,4,220,0,0,0,},{241,140,73,240,160,8,0,},{208,252,255,207,8,240,12,},},{{240,148,109,221,172,5,0,},
-{210,228,104,208,104,7,0,},},{{246,61,108,213,164,3,0,},{215,120,113,215,16,5,0,},{213,88,72,217,120,5,0,},},{{16,98,20,7,10,0,0,},{233,81,65,233,5,6,0,},
-{240,132,129,10,250,213,13,},{209,88,68,217,40,1,0,},},{{236,201,121,253,113,136,13,},{210,0,104,208,104,7,0,},{208,88,120,253,161,82,13,},},{{214,148,64,219,80,5,0,},
-{210,24,108,213,92,6,0,},},{{240,29,100,208,0,0,0,},{215,56,109,215,200,4,0,},{214,100,112,214,16,5,0,},},{{235,1,74,235,29,6,0,},{241,188,109,221,48,8,0,},},
-{{247,129,109,215,164,3,0,},{214,112,88,219,160,5,0,},{206,216,112,206,16,5,0,},},{{241,69,96,209,0,0,0,},{220,148,120,253,233,103,13,},},{{220,156,68,219,12,8,0,},},
-{{235,229,109,216,172,5,0,},{233,65,113,215,220,5,0,},{217,48,128,10,250,85,13,},},{{1,190,40,243,1,0,0,},{214,132,108,214,200,4,0,},{210,40,64,217,228,6,0,},},
-{{215,44,109,215,200,4,0,},{208,32,124,244,25,147,13,},},{{234,129,65,233,137,8,0,},{213,32,124,244,141,149,13,},},{{254,73,117,252,125,7,0,},{211,176,120,253,237,229,12,},
-{209,48,112,213,180,0,0,},},{{212,176,112,206,216,7,0,},{210,68,112,213,164,6,0,},},{{244,41,85,234,1,0,0,},{243,229,108,206,164,3,0,},{210,56,124,244,33,151,13,},},
-{{220,116,108,214,168,7,0,},{210,48,112,213,164,6,0,},{208,88,128,10,186,82,13,},},{{235,209,73,235,29,6,0,},{221,188,109,221,200,4,0,},{211,228,108,206,172,5,0,},
-{209,56,104,208,208,1,0,},},{{235,201,69,235,17,6,0,},{241,196,113,221,96,8,0,},{241,152,125,244,173,8,15,},{215,124,109,26,226,4,0,},},{{3,90,40,246,1,0,0,},
-{212,252,64,211,0,8,0,},{208,48,108,213,48,2,0,},},{{234,61,109,215,48,8,0,},{215,128,113,215,16,5,0,},},{{221,140,109,221,200,4,0,},{211,212,108,206,172,5,0,},
-{209,32,128,10,242,80,13,},},{{217,24,108,213,172,5,0,},{215,52,113,215,16,5,0,},{212,200,128,10,246,231,12,},},{{243,221,108,206,164,3,0,},{216,200,69,235,101,5,0,},},
-{{207,40,108,213,92,6,0,},},{{246,65,108,213,164,3,0,},{244,81,85,234,1,0,0,},{240,144,69,240,16,6,0,},{207,32,72,217,12,7,0,},},{{221,144,129,10,62,213,13,},
-{206,224,88,211,160,5,0,},},{{236,205,113,216,96,8,0,},{214,124,108,214,200,4,0,},},{{240,152,113,221,220,5,0,},{213,40,88,217,160,5,0,},{207,56,108,213,92,6,0,},},
-{{215,44,69,233,101,5,0,},{213,88,112,213,16,5,0,},{209,88,120,253,213,80,13,},},{{240,160,113,221,220,5,0,},{213,64,68,217,100,5,0,},},{{206,220,120,253,41,229,12,},},
-{{234,81,65,233,137,8,0,},{218,36,68,217,12,8,0,},{210,64,124,244,33,151,13,},},{{218,60,112,213,216,7,0,},{216,0,66,235,81,5,0,},{215,60,69,233,101,5,0,},},
-{{217,52,128,10,250,85,13,},{216,224,73,235,121,5,0,},{216,204,65,235,81,5,0,},},{{247,61,109,215,164,3,0,},{214,132,88,219,160,5,0,},},{{236,249,129,10,126,136,13,},
-{235,213,125,244,41,182,30,},{210,80,112,213,164,6,0,},{208,36,124,244,25,147,13,},},{{233,129,129,10,250,117,13,},{215,52,125,244,141,149,30,},{213,28,124,244,141,149,13,},},
-{{239,17,93,208,0,0,0,},{221,196,73,240,120,5,0,},{211,188,112,206,220,5,0,},},{{212,192,124,244,37,56,13,},{212,180,120,253,233,231,12,},},{{238,117,4,220,0,0,0,},
-{212,200,64,211,0,8,0,},{212,188,68,211,12,8,0,},},{{239,65,92,208,0,0,0,},{236,249,125,244,173,184,30,},{213,88,120,253,41,85,13,},},{{213,24,128,10,62,85,13,},},
-{{238,33,4,218,0,0,0,},{241,148,125,244,173,8,15,},{206,252,72,211,120,5,0,},},{{220,136,112,214,216,7,0,},{210,52,68,217,248,6,0,},},{{220,112,68,219,12,8,0,},
-{217,24,128,10,250,85,13,},{207,64,120,253,189,86,13,},},{{237,93,104,208,0,0,0,},{235,213,121,253,237,133,13,},{214,120,64,219,80,5,0,},{213,52,64,217,80,5,0,},},
-{{17,238,4,1,2,0,0,},{206,244,112,206,16,5,0,},},{{246,25,108,213,164,3,0,},{212,172,108,206,168,7,0,},{207,64,112,213,164,6,0,},},{{234,57,69,233,149,8,0,},
-{218,64,124,244,37,152,13,},{207,88,112,213,164,6,0,},},{{244,85,85,254,1,0,0,},{241,144,121,253,113,216,13,},{207,40,104,208,104,7,0,},},{{236,1,74,235,161,8,0,},
-{215,52,89,233,161,5,0,},{211,220,108,206,172,5,0,},},{{233,69,121,253,237,117,13,},{216,208,89,235,161,5,0,},{207,80,68,217,248,6,0,},},{{220,104,124,244,37,184,13,},
-{213,64,108,213,200,4,0,},{207,36,108,213,92,6,0,},},{{240,229,100,208,0,0,0,},{239,81,92,208,0,0,0,},{221,152,125,244,141,5,15,},{211,192,124,244,41,54,13,},},
-{{233,81,121,253,237,117,13,},{221,152,129,10,62,213,13,},{211,192,128,10,250,229,12,},},{{18,74,4,3,2,0,0,},{220,104,128,10,246,103,13,},{214,156,108,214,200,4,0,},},
-{{212,212,64,211,0,8,0,},{212,200,120,253,233,231,12,},{210,68,104,208,104,7,0,},},{{240,1,101,208,0,0,0,},{219,156,112,214,220,5,0,},},{{235,237,109,216,172,5,0,},
-{215,120,129,10,62,117,13,},{210,68,128,10,210,86,13,},},{{2,190,44,243,1,0,0,},{251,245,4,212,0,0,0,},{240,132,113,221,220,5,0,},{206,216,72,211,120,5,0,},},
-{{252,45,77,234,9,0,0,},{220,148,112,214,216,7,0,},{207,52,124,244,33,151,13,},},{{221,148,73,240,120,5,0,},},{{211,184,120,253,237,229,12,},{206,208,68,211,100,5,0,},},
-{{212,220,112,206,216,7,0,},{212,196,124,244,37,56,13,},},{{243,165,108,206,164,3,0,},{236,229,113,216,96,8,0,},{210,32,124,244,33,151,13,},},{{234,129,73,233,161,8,0,},},
-{{253,225,53,236,1,0,0,},{213,40,64,217,80,5,0,},{209,48,104,208,208,1,0,},},{{241,144,125,244,173,8,15,},{219,108,120,253,237,101,13,},{206,192,112,206,16,5,0,},},
-{{218,32,108,213,168,7,0,},},{{234,121,65,233,137,8,0,},{208,48,128,10,186,82,13,},},{{235,209,113,216,220,5,0,},{233,57,113,215,220,5,0,},{217,84,108,18,190,5,0,},
-{213,68,64,217,80,5,0,},},{{253,249,53,236,1,0,0,},{236,237,73,235,161,8,0,},{221,188,129,10,62,213,13,},{211,228,128,10,250,229,12,},},{{220,116,128,10,246,103,13,},
-{208,8,113,5,102,3,0,},},{{218,24,112,213,216,7,0,},{213,56,108,213,200,4,0,},{208,40,112,213,132,2,0,},},{{240,57,100,208,0,0,0,},{209,40,112,213,180,0,0,},},
-{{252,69,77,234,9,0,0,},{212,228,108,206,168,7,0,},},{{0}},{{235,205,69,235,17,6,0,},{240,144,129,10,250,213,13,},{216,220,73,235,121,5,0,},},{{221,148,125,244,141,5,15,},
-{209,80,120,253,213,80,13,},{207,40,128,10,210,86,13,},},{{221,156,129,10,62,213,13,},{211,196,128,10,250,229,12,},{206,224,64,211,80,5,0,},},{{241,81,96,209,0,0,0,},
-{236,205,121,253,113,136,13,},{216,228,129,10,62,133,13,},{216,220,89,235,161,5,0,},},{{240,152,121,253,237,213,13,},{221,136,113,221,16,5,0,},{210,28,68,217,248,6,0,},},
-{{236,225,69,235,149,8,0,},{217,88,72,217,28,6,0,},},{{238,109,4,220,0,0,0,},{210,64,128,10,210,86,13,},},{{241,65,96,209,0,0,0,},{214,116,88,219,160,5,0,},
-{206,220,112,206,16,5,0,},},{{234,81,73,233,161,8,0,},{220,92,108,214,168,7,0,},{216,236,109,216,200,4,0,},{207,48,124,244,33,151,13,},},{{215,60,125,244,141,149,30,},
-{210,36,72,217,12,7,0,},},{{241,160,125,244,173,8,15,},{219,148,112,214,220,5,0,},},{{234,69,73,233,161,8,0,},{221,160,129,10,62,213,13,},{212,216,124,244,37,56,13,},},
-{{7,230,8,6,10,0,0,},{216,252,109,31,226,4,0,},{210,80,120,253,189,86,13,},{210,36,124,244,33,151,13,},},{{221,168,65,240,80,5,0,},{215,120,121,253,41,117,13,},
-{213,80,120,253,41,85,13,},},{{233,77,113,215,220,5,0,},{214,136,120,253,41,101,13,},{211,188,72,211,28,6,0,},},{{249,253,109,31,174,3,0,},{236,249,109,216,48,8,0,},
-{218,88,112,213,216,7,0,},{212,180,112,206,216,7,0,},},{{236,229,65,235,137,8,0,},{240,188,109,221,172,5,0,},{208,44,108,238,1,2,0,},},{{12,138,45,248,1,0,0,},
-{213,88,128,10,62,85,13,},{211,224,64,211,4,6,0,},},{{235,221,121,253,237,133,13,},{233,53,121,253,237,117,13,},{217,36,72,217,28,6,0,},},{{211,216,128,10,250,229,12,},
-{206,252,64,211,80,5,0,},},{{220,112,128,10,246,103,13,},{208,52,68,217,232,2,0,},},{{218,28,120,253,233,87,13,},{207,28,108,213,92,6,0,},},{{211,164,112,206,220,5,0,},
-{209,36,120,253,213,80,13,},{206,192,124,244,141,53,13,},},{{236,209,69,235,149,8,0,},{212,248,108,17,186,7,0,},{206,244,120,253,41,229,12,},},{{254,49,69,27,142,7,0,},
-{241,37,96,209,0,0,0,},{216,200,89,235,161,5,0,},},{{241,136,65,240,136,8,0,},{218,64,68,217,12,8,0,},{207,88,72,217,12,7,0,},},{{234,69,69,233,149,8,0,},
-{221,144,125,244,141,5,15,},{218,88,72,217,24,8,0,},{211,200,124,244,41,54,13,},},{{235,25,129,10,250,133,13,},{233,61,65,233,5,6,0,},{206,160,108,206,200,4,0,},},
-{{240,148,69,240,16,6,0,},{221,196,129,10,62,213,13,},{208,80,112,213,132,2,0,},},{{240,156,113,221,220,5,0,},{218,80,68,217,12,8,0,},},{{221,152,69,240,100,5,0,},
-{211,192,68,211,16,6,0,},},{{233,81,113,215,220,5,0,},{241,168,73,240,160,8,0,},{216,0,110,216,200,4,0,},},{{241,5,97,209,0,0,0,},{219,116,112,214,220,5,0,},
-{208,88,104,208,136,3,0,},},{{238,81,4,218,0,0,0,},{218,40,108,213,168,7,0,},{210,80,124,244,33,151,13,},},{{215,56,125,244,141,149,30,},{209,68,72,217,68,1,0,},},
-{{241,188,125,244,173,8,15,},},{{243,225,108,206,164,3,0,},{220,100,72,219,24,8,0,},{206,216,64,211,80,5,0,},},{{13,2,42,249,1,0,0,},{220,156,128,10,246,103,13,},
-{218,36,128,10,246,87,13,},},{{242,93,108,208,164,3,0,},{214,112,128,10,62,101,13,},{211,244,68,211,16,6,0,},},{{219,124,68,219,16,6,0,},{211,184,112,206,220,5,0,},},
-{{214,132,124,244,141,181,13,},{214,104,64,219,80,5,0,},},{{236,229,73,235,161,8,0,},{214,132,128,10,62,101,13,},{210,32,68,217,248,6,0,},},{{246,29,108,213,164,3,0,},
-{221,172,113,221,16,5,0,},{213,32,108,213,200,4,0,},{211,244,112,206,220,5,0,},},{{234,45,65,233,137,8,0,},{213,40,72,217,120,5,0,},},{{219,108,112,214,220,5,0,},
-{208,40,72,217,0,3,0,},{206,192,120,253,41,229,12,},},{{240,196,73,240,28,6,0,},{210,56,108,213,92,6,0,},{208,228,104,208,136,3,0,},},{{3,30,40,246,1,0,0,},
-{234,121,121,253,113,120,13,},{213,48,108,213,200,4,0,},},{{248,137,109,221,164,3,0,},{234,65,129,10,126,120,13,},{233,33,129,10,250,117,13,},{215,128,125,244,141,149,30,},},
-{{233,53,73,233,29,6,0,},{241,152,109,221,48,8,0,},},{{236,1,126,244,173,184,30,},{236,221,113,216,96,8,0,},{240,196,65,240,4,6,0,},{207,68,68,217,248,6,0,},},
-{{234,61,125,244,173,152,30,},{216,200,73,235,121,5,0,},{215,68,113,215,16,5,0,},},{{239,69,92,208,0,0,0,},{221,140,125,244,141,5,15,},{211,212,124,244,41,54,13,},
-{209,40,120,253,213,80,13,},},{{0}},{{0}},{{240,144,121,253,237,213,13,},{215,60,129,10,62,117,13,},},{{254,105,117,28,154,7,0,},{241,136,73,240,160,8,0,},{209,80,112,213,180,0,0,},},
-{{221,168,121,253,41,213,13,},{206,224,72,211,120,5,0,},},{{236,205,65,235,137,8,0,},{210,4,112,239,53,7,0,},},{{216,228,109,216,200,4,0,},{207,56,124,244,33,151,13,},},
-{{221,156,109,221,200,4,0,},{211,196,108,206,172,5,0,},{209,88,104,208,208,1,0,},},{{244,89,85,254,1,0,0,},{212,188,72,211,24,8,0,},},{{214,116,64,219,80,5,0,},
-{212,208,124,244,37,56,13,},},{{234,81,113,215,96,8,0,},{207,48,68,217,248,6,0,},},{{214,108,128,10,62,101,13,},{209,28,108,213,84,0,0,},},{{239,49,92,208,0,0,0,},
-{221,160,69,240,100,5,0,},{220,120,64,219,0,8,0,},{219,148,120,253,237,101,13,},},{{4,66,44,246,1,0,0,},{246,49,108,213,164,3,0,},{214,136,124,244,141,181,13,},},
-{{240,172,69,240,16,6,0,},{214,128,128,10,62,101,13,},{208,36,108,213,48,2,0,},},{{246,33,108,213,164,3,0,},{213,80,112,213,16,5,0,},{213,28,108,213,200,4,0,},
-{211,244,108,206,172,5,0,},},{{253,1,54,236,1,0,0,},{233,77,121,253,237,117,13,},{211,232,68,211,16,6,0,},{211,188,64,211,4,6,0,},},{{219,112,64,219,4,6,0,},
-{210,36,128,10,210,86,13,},},{{220,128,120,253,233,103,13,},{211,180,128,10,250,229,12,},{209,36,112,213,180,0,0,},},{{211,224,72,211,28,6,0,},{209,52,68,217,40,1,0,},},
-{{235,221,113,216,220,5,0,},{217,36,64,217,4,6,0,},{216,228,73,235,121,5,0,},},{{212,240,108,2,202,7,0,},{206,252,120,253,41,229,12,},},{{241,156,65,240,136,8,0,},
-{207,4,112,239,53,7,0,},},{{218,28,112,213,216,7,0,},{207,64,104,208,104,7,0,},},{{241,156,73,240,160,8,0,},{211,164,120,253,237,229,12,},{208,56,112,213,132,2,0,},},
-{{212,172,112,206,216,7,0,},},{{221,152,65,240,80,5,0,},},{{234,77,113,215,96,8,0,},{233,69,125,244,41,150,30,},{207,88,64,217,228,6,0,},},{{218,88,64,217,0,8,0,},
-{208,80,128,10,186,82,13,},},{{235,25,121,253,237,133,13,},{219,92,108,214,172,5,0,},{217,88,108,213,172,5,0,},},{{243,249,108,17,174,3,0,},{208,80,104,208,136,3,0,},},
-{{214,156,128,10,62,101,13,},{207,36,124,244,33,151,13,},},{{244,45,85,234,1,0,0,},{212,200,124,244,37,56,13,},},{{220,156,64,219,0,8,0,},{208,68,112,213,132,2,0,},},
-{{243,233,108,206,164,3,0,},{214,44,108,238,169,4,0,},{212,212,124,244,37,56,13,},},{{251,253,4,212,0,0,0,},{234,69,109,215,48,8,0,},{240,132,109,221,172,5,0,},},
-{{213,68,112,213,16,5,0,},{209,40,68,217,40,1,0,},},{{241,188,69,240,148,8,0,},{218,40,64,217,0,8,0,},{208,28,128,10,186,82,13,},},{{214,112,112,214,16,5,0,},
-{206,216,88,211,160,5,0,},},{{218,32,124,244,37,152,13,},{207,52,108,213,92,6,0,},},{{233,65,69,233,17,6,0,},{240,188,65,240,4,6,0,},{209,88,128,10,242,80,13,},},
-{{217,56,64,217,4,6,0,},{210,60,108,213,92,6,0,},},{{9,130,45,247,1,0,0,},{214,104,120,253,41,101,13,},{210,32,128,10,210,86,13,},},{{237,1,113,237,165,3,0,},
-{212,196,128,10,246,231,12,},{208,4,113,5,102,3,0,},{208,32,68,217,232,2,0,},},{{241,148,73,240,160,8,0,},{218,48,72,217,24,8,0,},{211,244,120,253,237,229,12,},},
-{{236,237,129,10,126,136,13,},{220,104,108,214,168,7,0,},{206,188,88,211,160,5,0,},},{{248,197,109,221,164,3,0,},{240,156,73,240,28,6,0,},{212,184,112,206,216,7,0,},},
-{{209,48,128,10,242,80,13,},{208,12,105,208,136,3,0,},},{{240,81,100,208,0,0,0,},{234,121,113,215,96,8,0,},{219,124,108,214,172,5,0,},},{{221,188,69,240,100,5,0,},
-{217,40,112,213,220,5,0,},{209,56,64,217,12,1,0,},},{{23,22,81,19,10,0,0,},{11,138,41,248,1,0,0,},{212,160,120,253,233,231,12,},{206,96,16,7,250,3,0,},},
-{{236,221,121,253,113,136,13,},{216,204,89,235,161,5,0,},{208,56,124,244,25,147,13,},},{{216,0,114,216,16,5,0,},{215,68,121,253,41,117,13,},{213,56,124,244,141,149,13,},},
-{{213,56,128,10,62,85,13,},{211,212,68,211,16,6,0,},{209,40,64,217,12,1,0,},},{{235,205,121,253,237,133,13,},{217,68,72,217,28,6,0,},{208,56,128,10,186,82,13,},},
-{{240,69,100,208,0,0,0,},{206,232,68,211,100,5,0,},},{{240,144,113,221,220,5,0,},{218,84,108,18,186,7,0,},{207,32,124,244,33,151,13,},},{{248,157,109,221,164,3,0,},
-{235,249,73,235,29,6,0,},{209,80,104,208,208,1,0,},},{{236,225,121,253,113,136,13,},{221,136,125,244,141,5,15,},{206,224,112,206,16,5,0,},},{{243,201,108,206,164,3,0,},
-{236,205,73,235,161,8,0,},{210,28,128,10,210,86,13,},},{{220,100,108,214,168,7,0,},{214,124,68,219,100,5,0,},},{{212,200,68,211,12,8,0,},{209,64,104,208,208,1,0,},},
-{{208,24,128,10,186,82,13,},{206,200,128,10,62,229,12,},},{{214,116,72,219,120,5,0,},{214,92,128,10,62,101,13,},},{{220,124,128,10,246,103,13,},{218,36,124,244,37,152,13,},},
-{{246,41,108,213,164,3,0,},{215,60,109,215,200,4,0,},},{{219,148,128,10,250,101,13,},{214,104,124,244,141,181,13,},{212,216,64,211,0,8,0,},},{{236,25,109,216,48,8,0,},
-{220,148,108,214,168,7,0,},{208,40,128,10,186,82,13,},},{{235,229,129,10,250,133,13,},{210,36,108,213,92,6,0,},},{{238,49,4,218,0,0,0,},{221,168,113,221,16,5,0,},
-{213,80,72,217,120,5,0,},},{{217,60,112,213,220,5,0,},{215,52,129,10,62,117,13,},{213,28,128,10,62,85,13,},},{{219,112,72,219,28,6,0,},{214,100,120,253,41,101,13,},
-{208,36,128,10,186,82,13,},},{{220,128,112,214,216,7,0,},{213,36,64,217,80,5,0,},{209,52,128,10,242,80,13,},},{{234,41,125,244,173,152,30,},{221,160,125,244,141,5,15,},},
-{{219,104,108,214,172,5,0,},{217,80,124,244,41,150,13,},{217,36,120,253,237,85,13,},},{{214,156,124,244,141,181,13,},{206,252,112,206,16,5,0,},},{{240,188,125,244,41,6,15,},
-{218,52,68,217,12,8,0,},{215,56,69,233,101,5,0,},},{{235,213,69,235,17,6,0,},{215,64,113,215,16,5,0,},{214,108,88,219,160,5,0,},{209,0,105,208,208,1,0,},},
-{{235,205,73,235,29,6,0,},{233,121,69,233,17,6,0,},{213,60,128,10,62,85,13,},{209,36,104,208,208,1,0,},},{{212,172,120,253,233,231,12,},{207,92,104,208,104,7,0,},},
-{{233,61,69,233,17,6,0,},{215,120,73,233,121,5,0,},},{{221,136,129,10,62,213,13,},{211,208,128,10,250,229,12,},{209,8,113,5,190,1,0,},},{{233,45,113,215,220,5,0,},
-{240,152,129,10,250,213,13,},},{{235,233,121,253,237,133,13,},{235,25,113,216,220,5,0,},{241,140,125,244,173,8,15,},},{{216,208,65,235,81,5,0,},{210,8,112,241,65,7,0,},
-{208,12,108,240,85,3,0,},},{{240,156,65,240,4,6,0,},{207,36,68,217,248,6,0,},},{{216,236,89,235,161,5,0,},{214,132,120,253,41,101,13,},},{{239,37,92,208,0,0,0,},
-{215,40,129,10,62,117,13,},{213,48,88,217,160,5,0,},},{{216,224,65,235,81,5,0,},{208,28,108,213,48,2,0,},},{{241,160,73,240,160,8,0,},{218,40,124,244,37,152,13,},
-{207,60,108,213,92,6,0,},},{{213,68,72,217,120,5,0,},{209,68,120,253,213,80,13,},},{{233,57,65,233,5,6,0,},{212,164,108,206,168,7,0,},},{{214,112,120,253,41,101,13,},
-{212,220,108,206,168,7,0,},},{{20,22,57,19,2,0,0,},{240,160,109,221,172,5,0,},{220,156,112,214,216,7,0,},{207,204,108,251,69,6,0,},},{{242,13,109,208,164,3,0,},
-{235,229,65,235,5,6,0,},{209,228,104,208,208,1,0,},},{{217,56,72,217,28,6,0,},{213,32,128,10,62,85,13,},},{{9,42,45,247,1,0,0,},{214,104,112,214,16,5,0,},
-{212,196,68,211,12,8,0,},{208,32,128,10,186,82,13,},},{{220,132,120,253,233,103,13,},{208,4,105,208,136,3,0,},},{{3,66,40,246,1,0,0,},{235,209,121,253,237,133,13,},
-{234,45,125,244,173,152,30,},},{{234,81,121,253,113,120,13,},{219,116,108,214,172,5,0,},},{{212,184,120,253,233,231,12,},{206,180,108,206,200,4,0,},},{{240,196,121,253,237,213,13,},
-{215,128,121,253,41,117,13,},},{{244,109,85,254,1,0,0,},{218,76,108,4,202,7,0,},{213,48,124,244,141,149,13,},},{{238,105,4,220,0,0,0,},{215,52,121,253,41,117,13,},
-{209,56,72,217,68,1,0,},},{{243,193,108,206,164,3,0,},{212,252,124,244,37,56,13,},{212,160,112,206,216,7,0,},},{{236,1,110,216,48,8,0,},{220,124,64,219,0,8,0,},
-{208,60,120,253,161,82,13,},},{{215,68,65,233,81,5,0,},{211,212,128,10,250,229,12,},{209,32,108,213,84,0,0,},},{{234,61,129,10,126,120,13,},{233,125,109,26,190,5,0,},
-{215,128,89,233,161,5,0,},{209,40,72,217,68,1,0,},},{{236,1,130,10,126,136,13,},{217,68,64,217,4,6,0,},},{{25,86,77,24,2,0,0,},{234,53,65,233,137,8,0,},
-{233,61,109,215,172,5,0,},{209,8,105,208,208,1,0,},},{{234,65,113,215,96,8,0,},{215,68,89,233,161,5,0,},},{{237,9,105,208,0,0,0,},{235,249,65,235,5,6,0,},
-{240,160,73,240,28,6,0,},},{{239,33,92,208,0,0,0,},{215,44,129,10,62,117,13,},{206,224,120,253,41,229,12,},},{{218,68,108,213,168,7,0,},{216,220,113,216,16,5,0,},
-{211,252,64,211,4,6,0,},},{{240,93,100,208,0,0,0,},{216,0,90,235,161,5,0,},{216,204,73,235,121,5,0,},},{{213,64,112,213,16,5,0,},},{{241,184,109,12,82,8,0,},
-{210,80,72,217,12,7,0,},},{{214,116,112,214,16,5,0,},{212,252,72,211,24,8,0,},},{{218,52,128,10,246,87,13,},{216,236,69,235,101,5,0,},},{{234,121,73,233,161,8,0,},
-{221,196,65,240,80,5,0,},{209,28,124,244,97,145,13,},},{{251,233,4,212,0,0,0,},{241,168,109,221,48,8,0,},{212,216,72,211,24,8,0,},},{{214,136,108,214,200,4,0,},
-{214,108,120,253,41,101,13,},},{{240,156,109,221,172,5,0,},{211,188,124,244,41,54,13,},},{{215,120,65,233,81,5,0,},{213,80,64,217,80,5,0,},{211,232,128,10,250,229,12,},},
-{{218,48,112,213,216,7,0,},{217,60,120,253,237,85,13,},},{{212,188,112,206,216,7,0,},{206,196,128,10,62,229,12,},},{{27,34,117,23,166,3,0,},{213,36,88,217,160,5,0,},},
-{{217,32,112,213,220,5,0,},},{{235,221,65,235,5,6,0,},{233,53,65,233,5,6,0,},{217,36,112,213,220,5,0,},{206,196,108,206,200,4,0,},},{{215,64,129,10,62,117,13,},
-{212,164,120,253,233,231,12,},},{{250,161,113,241,188,3,0,},{234,65,109,215,48,8,0,},},{{212,164,128,10,246,231,12,},{209,60,108,213,84,0,0,},},{{234,57,129,10,126,120,13,},
-{211,208,108,206,172,5,0,},{206,168,32,16,82,4,0,},},{{249,213,109,216,164,3,0,},{236,209,109,216,48,8,0,},{233,69,113,215,220,5,0,},{208,64,108,213,48,2,0,},},
-{{220,120,112,214,216,7,0,},{216,200,113,216,16,5,0,},{212,224,72,211,24,8,0,},},{{240,140,73,240,28,6,0,},{213,60,108,213,200,4,0,},{213,52,108,213,200,4,0,},},
-{{233,45,121,253,237,117,13,},},{{234,117,109,9,82,8,0,},{212,232,68,211,12,8,0,},{206,228,112,206,16,5,0,},},{{237,5,105,208,0,0,0,},{216,208,121,253,41,133,13,},
-{206,200,108,206,200,4,0,},},{{215,68,129,10,62,117,13,},{208,68,108,213,48,2,0,},},{{215,40,69,233,101,5,0,},{207,0,113,237,113,7,0,},},{{215,80,109,215,200,4,0,},
-{214,156,88,219,160,5,0,},},{{241,13,97,209,0,0,0,},{216,224,89,235,161,5,0,},{214,104,88,219,160,5,0,},{210,68,68,217,248,6,0,},},{{221,148,65,240,80,5,0,},
-{211,196,120,253,237,229,12,},},{{218,40,128,10,246,87,13,},{209,68,112,213,180,0,0,},},{{239,13,93,208,0,0,0,},{235,1,114,216,220,5,0,},{214,148,128,10,62,101,13,},
-{212,220,120,253,233,231,12,},},{{218,32,64,217,0,8,0,},{210,16,112,237,113,7,0,},},{{244,129,85,234,1,0,0,},{220,156,120,253,233,103,13,},{220,120,108,214,168,7,0,},},
-{{242,229,108,208,164,3,0,},{235,229,73,235,29,6,0,},{221,196,121,253,41,213,13,},{211,252,112,206,220,5,0,},},{{217,56,112,213,220,5,0,},},{{240,65,100,208,0,0,0,},
-{219,132,108,214,172,5,0,},{210,40,120,253,189,86,13,},},{{240,168,125,244,41,6,15,},{220,132,112,214,216,7,0,},{216,248,109,216,200,4,0,},},{{234,57,109,215,48,8,0,},
-{213,40,124,244,141,149,13,},{211,224,68,211,16,6,0,},},{{217,32,120,253,237,85,13,},{206,188,72,211,120,5,0,},},{{31,242,5,13,2,0,0,},{238,37,4,218,0,0,0,},
-{219,116,128,10,250,101,13,},{212,244,124,244,37,56,13,},},{{240,196,113,221,220,5,0,},{216,248,125,244,141,181,30,},{208,40,120,253,161,82,13,},},{{215,76,113,215,16,5,0,},
-{212,160,128,10,246,231,12,},},{{233,117,109,9,206,5,0,},{217,40,128,10,250,85,13,},},{{210,48,64,217,228,6,0,},{208,48,72,217,0,3,0,},},{{241,17,97,209,0,0,0,},
-{235,205,125,244,41,182,30,},{208,56,108,213,48,2,0,},},{{209,4,113,5,190,1,0,},{208,80,68,217,232,2,0,},},{{237,1,105,208,0,0,0,},{233,41,113,215,220,5,0,},
-{215,128,65,233,81,5,0,},},{{253,201,53,236,1,0,0,},{233,69,73,233,29,6,0,},{213,36,128,10,62,85,13,},{206,232,120,253,41,229,12,},},{{240,136,109,221,172,5,0,},
-{221,136,121,253,41,213,13,},},{{234,65,121,253,113,120,13,},{207,32,108,213,92,6,0,},},{{248,161,109,221,164,3,0,},{235,249,121,253,237,133,13,},},{{0}},{{216,220,121,253,41,133,13,},
-{214,124,128,10,62,101,13,},{212,200,72,211,24,8,0,},},{{217,80,68,217,16,6,0,},},{{209,64,120,253,213,80,13,},},{{239,9,93,208,0,0,0,},{219,156,72,219,28,6,0,},
-{216,208,125,244,141,181,30,},},{{212,208,68,211,12,8,0,},{210,64,108,213,92,6,0,},},{{218,36,108,213,168,7,0,},},{{237,49,104,208,0,0,0,},{221,160,121,253,41,213,13,},
-{219,148,68,219,16,6,0,},{214,136,112,214,16,5,0,},},{{217,52,120,253,237,85,13,},{206,212,68,211,100,5,0,},},{{214,108,112,214,16,5,0,},{210,88,68,217,248,6,0,},},
-{{240,172,125,244,41,6,15,},{218,52,108,213,168,7,0,},},{{242,89,108,208,164,3,0,},{215,52,69,233,101,5,0,},{213,80,88,217,160,5,0,},{211,252,128,10,250,229,12,},},
-{{247,121,109,215,164,3,0,},{236,249,65,235,137,8,0,},{214,100,68,219,100,5,0,},{206,204,108,251,145,4,0,},},{{243,213,108,206,164,3,0,},{219,104,128,10,250,101,13,},
-{212,188,120,253,233,231,12,},},{{235,1,110,216,172,5,0,},{219,104,68,219,16,6,0,},},{{221,140,69,240,100,5,0,},{216,212,89,235,161,5,0,},{209,52,108,213,84,0,0,},},
-{{236,237,121,253,113,136,13,},{215,56,65,233,81,5,0,},{206,184,120,253,41,229,12,},},{{212,164,112,206,216,7,0,},{210,52,112,213,164,6,0,},},{{218,28,68,217,12,8,0,},},
-{{233,61,73,233,29,6,0,},{211,216,72,211,28,6,0,},},{{217,64,108,213,172,5,0,},{215,120,69,233,101,5,0,},{206,168,24,16,18,4,0,},},{{206,244,88,211,160,5,0,},},
-{{238,29,4,218,0,0,0,},{220,120,120,253,233,103,13,},{216,200,121,253,41,133,13,},{212,224,64,211,0,8,0,},},{{218,88,124,244,37,152,13,},{211,200,72,211,28,6,0,},
-{207,80,128,10,210,86,13,},},{{217,28,112,213,220,5,0,},{212,232,128,10,246,231,12,},},{{241,140,109,221,48,8,0,},{206,228,120,253,41,229,12,},},{{216,208,113,216,16,5,0,},
-{214,132,68,219,100,5,0,},{207,80,108,213,92,6,0,},},{{220,104,68,219,12,8,0,},{213,232,0,242,209,3,0,},{212,252,108,206,168,7,0,},},{{237,37,104,208,0,0,0,},
-{241,160,69,240,148,8,0,},},{{238,133,4,220,0,0,0,},{240,168,69,240,16,6,0,},{220,100,64,219,0,8,0,},},{{8,42,41,247,1,0,0,},{214,148,108,214,200,4,0,},
-{208,28,124,244,25,147,13,},},{{253,221,53,236,1,0,0,},{215,44,121,253,41,117,13,},{215,32,113,215,16,5,0,},},{{30,182,5,11,2,0,0,},{213,68,88,217,160,5,0,},
-{209,68,104,208,208,1,0,},},{{235,237,69,235,17,6,0,},{212,212,128,10,246,231,12,},},{{221,144,113,221,16,5,0,},{218,32,72,217,24,8,0,},},{{212,192,108,206,168,7,0,},},
-{{12,198,45,248,1,0,0,},{220,108,112,214,216,7,0,},{211,252,72,211,28,6,0,},{210,48,124,244,33,151,13,},},{{217,56,120,253,237,85,13,},{214,136,72,219,120,5,0,},
-{206,208,108,206,200,4,0,},},{{249,249,109,216,164,3,0,},{236,253,109,31,66,8,0,},{234,81,125,244,173,152,30,},{210,40,112,213,164,6,0,},},{{213,32,88,217,160,5,0,},
-{210,204,108,251,69,6,0,},},{{252,81,77,234,9,0,0,},{234,45,109,215,48,8,0,},{221,148,129,10,62,213,13,},},{{212,244,128,10,246,231,12,},{206,188,64,211,80,5,0,},},
-{{249,233,109,216,164,3,0,},{236,237,109,216,48,8,0,},{206,192,88,211,160,5,0,},},{{26,114,5,8,2,0,0,},{219,104,124,244,41,182,13,},{213,40,128,10,62,85,13,},},
-{{221,188,113,221,16,5,0,},{211,228,112,206,220,5,0,},},{{242,65,108,208,164,3,0,},{217,40,68,217,16,6,0,},},{{236,213,69,235,149,8,0,},{234,121,129,10,126,120,13,},
-{208,68,68,217,232,2,0,},{208,48,64,217,208,2,0,},},{{216,204,113,216,16,5,0,},{206,164,128,10,62,229,12,},},{{209,4,105,208,208,1,0,},{209,32,124,244,97,145,13,},},
-{{233,41,121,253,237,117,13,},{215,128,73,233,121,5,0,},},{{206,232,112,206,16,5,0,},},{{216,212,121,253,41,133,13,},{207,40,72,217,12,7,0,},},{{234,65,65,233,137,8,0,},
-{240,136,129,10,250,213,13,},{211,216,68,211,16,6,0,},},{{245,113,108,214,164,3,0,},{235,249,113,216,220,5,0,},{221,148,109,221,200,4,0,},},{{253,209,53,236,1,0,0,},
-{216,224,69,235,101,5,0,},},{{216,228,89,235,161,5,0,},{214,124,120,253,41,101,13,},{207,56,72,217,12,7,0,},},{{221,156,65,240,80,5,0,},{211,196,64,211,4,6,0,},
-{206,224,128,10,62,229,12,},},{{233,129,125,244,41,150,30,},{214,148,112,214,16,5,0,},{209,64,112,213,180,0,0,},},{{240,168,109,221,172,5,0,},{219,156,64,219,4,6,0,},
-{212,208,128,10,246,231,12,},},{{0}},{{215,60,89,233,161,5,0,},{209,28,64,217,12,1,0,},},{{241,160,65,240,136,8,0,},{221,160,113,221,16,5,0,},},{{11,198,41,248,1,0,0,},
-{241,168,125,244,173,8,15,},{219,120,68,219,16,6,0,},{217,52,112,213,220,5,0,},},{{220,144,108,0,202,7,0,},{210,88,124,244,33,151,13,},},{{210,80,64,217,228,6,0,},
-{210,36,68,217,248,6,0,},},{{248,149,109,221,164,3,0,},{216,248,89,235,161,5,0,},{216,228,65,235,81,5,0,},},{{19,18,253,19,2,240,12,},{219,132,120,253,237,101,13,},
-{219,112,124,244,41,182,13,},{212,208,112,206,216,7,0,},},{{219,108,128,10,250,101,13,},{210,28,72,217,12,7,0,},},{{233,121,121,253,237,117,13,},{208,56,120,253,161,82,13,},},
-{{5,14,108,240,165,3,0,},{244,97,85,254,1,0,0,},{234,41,69,233,149,8,0,},{211,180,108,206,172,5,0,},},{{248,141,109,221,164,3,0,},{241,144,109,221,48,8,0,},
-{206,184,112,206,16,5,0,},},{{211,220,120,253,237,229,12,},{208,52,104,208,136,3,0,},},{{220,136,128,10,246,103,13,},{220,112,120,253,233,103,13,},{207,28,72,217,12,7,0,},},
-{{242,17,109,208,164,3,0,},{209,0,113,237,225,1,0,},{206,252,128,10,62,229,12,},},{{235,205,113,216,220,5,0,},{233,121,125,244,41,150,30,},{219,120,72,219,28,6,0,},
-{218,24,120,253,233,87,13,},},{{236,209,125,244,173,184,30,},{208,60,112,213,132,2,0,},{206,244,64,211,80,5,0,},},{{241,156,129,10,126,216,13,},{215,20,81,19,198,3,0,},
-{207,88,108,213,92,6,0,},},{{221,196,69,240,100,5,0,},{221,144,65,240,80,5,0,},{211,200,64,211,4,6,0,},},{{250,169,113,241,188,3,0,},{217,28,120,253,237,85,13,},
-{208,68,104,208,136,3,0,},},{{2,234,44,243,1,0,0,},{221,132,129,10,62,213,13,},{210,84,108,18,118,6,0,},},{{235,201,125,244,41,182,30,},{240,148,125,244,41,6,15,},
-{208,80,72,217,0,3,0,},},{{234,53,109,215,48,8,0,},{218,80,108,213,168,7,0,},},{{221,148,69,240,100,5,0,},{211,196,124,244,41,54,13,},},{{236,201,69,235,149,8,0,},
-{216,224,125,244,141,181,30,},{208,88,68,217,232,2,0,},},{{236,229,125,244,173,184,30,},{210,24,120,253,189,86,13,},{208,28,68,217,232,2,0,},},{{242,1,108,208,164,3,0,},
-{218,40,68,217,12,8,0,},{215,56,129,10,62,117,13,},{215,32,121,253,41,117,13,},},{{242,69,108,208,164,3,0,},{214,148,88,219,160,5,0,},{207,60,128,10,210,86,13,},},
-{{217,48,120,253,237,85,13,},{206,216,108,206,200,4,0,},},{{236,245,109,14,82,8,0,},{221,196,125,244,141,5,15,},{216,232,113,216,16,5,0,},{207,52,64,217,228,6,0,},},
-{{220,148,128,10,246,103,13,},{220,116,68,219,12,8,0,},{218,56,68,217,12,8,0,},},{{244,65,85,234,1,0,0,},{235,229,121,253,237,133,13,},{206,192,128,10,62,229,12,},},
-{{219,128,112,214,220,5,0,},{219,124,124,244,41,182,13,},{216,212,125,244,141,181,30,},},{{249,225,109,216,164,3,0,},{236,229,109,216,48,8,0,},{240,168,65,240,4,6,0,},
-{208,32,104,208,136,3,0,},},{{238,121,4,220,0,0,0,},{234,129,109,215,48,8,0,},{218,48,124,244,37,152,13,},{207,8,112,241,65,7,0,},},{{213,40,108,213,200,4,0,},
-{209,48,68,217,40,1,0,},},{{217,32,72,217,28,6,0,},{212,176,108,206,168,7,0,},{206,188,120,253,41,229,12,},},{{240,13,101,208,0,0,0,},{241,156,113,221,96,8,0,},
-{219,108,72,219,28,6,0,},{206,192,64,211,80,5,0,},},{{243,161,108,206,164,3,0,},{210,56,68,217,248,6,0,},{207,0,104,208,104,7,0,},},{{239,1,92,208,0,0,0,},
-{221,188,121,253,41,213,13,},{213,100,0,242,209,3,0,},{208,56,64,217,208,2,0,},},{{235,209,129,10,250,133,13,},{233,33,121,253,237,117,13,},{241,152,65,240,136,8,0,},
-{219,100,68,219,16,6,0,},},{{236,213,125,244,173,184,30,},{241,144,69,240,148,8,0,},{208,68,124,244,25,147,13,},{208,48,120,253,161,82,13,},},{{216,204,121,253,41,133,13,},
-{207,16,104,208,104,7,0,},},{{221,132,113,221,16,5,0,},{211,220,112,206,220,5,0,},},{{245,133,108,214,164,3,0,},{217,68,124,244,41,150,13,},{217,24,112,213,220,5,0,},},
-{{234,45,121,253,113,120,13,},{219,100,120,253,237,101,13,},},{{240,136,125,244,41,6,15,},{216,212,113,216,16,5,0,},{207,40,64,217,228,6,0,},},{{234,65,73,233,161,8,0,},
-{209,80,128,10,242,80,13,},},{{241,136,113,221,96,8,0,},{217,80,64,217,4,6,0,},{209,80,72,217,68,1,0,},},{{220,108,68,219,12,8,0,},{216,220,69,235,101,5,0,},},
-{{233,41,109,215,172,5,0,},{214,124,112,214,16,5,0,},{207,56,64,217,228,6,0,},},{{221,156,73,240,120,5,0,},{215,44,113,215,16,5,0,},{211,196,72,211,28,6,0,},},
-{{5,10,113,5,174,3,0,},{213,64,88,217,160,5,0,},{209,64,72,217,68,1,0,},{207,48,128,10,210,86,13,},},{{0}},{{253,237,53,236,1,0,0,},{218,60,108,213,168,7,0,},
-{208,24,108,213,48,2,0,},},{{221,172,65,240,80,5,0,},{209,28,72,217,68,1,0,},},{{235,225,113,216,220,5,0,},{234,129,125,244,173,152,30,},{206,212,128,10,62,229,12,},},
-{{241,29,96,209,0,0,0,},{219,120,124,244,41,182,13,},{217,52,72,217,28,6,0,},},{{233,53,109,215,172,5,0,},{218,60,128,10,246,87,13,},{214,108,64,219,80,5,0,},},
-{{240,172,109,221,172,5,0,},{218,52,124,244,37,152,13,},{208,36,68,217,232,2,0,},},{{233,129,73,233,29,6,0,},{219,104,64,219,4,6,0,},{211,188,108,206,172,5,0,},},
-{{248,133,109,221,164,3,0,},{212,192,72,211,24,8,0,},},{{14,2,46,249,1,0,0,},{217,80,128,10,250,85,13,},{212,200,108,206,168,7,0,},},{{234,41,129,10,126,120,13,},
-{213,88,108,213,200,4,0,},},{{209,52,124,244,97,145,13,},},{{233,65,109,215,172,5,0,},{233,61,129,10,250,117,13,},{241,192,109,30,66,8,0,},},{{240,188,73,240,28,6,0,},
-{211,160,108,206,172,5,0,},{210,52,104,208,104,7,0,},},{{233,81,129,10,250,117,13,},{220,112,112,214,216,7,0,},{207,28,64,217,228,6,0,},},{{244,57,85,234,1,0,0,},
-{237,17,104,208,0,0,0,},{211,216,120,253,237,229,12,},},{{221,136,69,240,100,5,0,},{217,64,124,244,41,150,13,},{209,36,72,217,68,1,0,},},{{243,197,108,206,164,3,0,},
-{216,0,122,253,41,133,13,},{206,244,72,211,120,5,0,},},{{241,196,125,244,173,8,15,},{219,116,124,244,41,182,13,},},{{218,88,108,213,168,7,0,},{214,132,64,219,80,5,0,},
-{210,80,104,208,104,7,0,},},{{241,132,121,253,113,216,13,},{217,28,64,217,4,6,0,},{206,160,112,206,16,5,0,},},{{212,232,124,244,37,56,13,},},{{252,121,77,234,9,0,0,},
-{218,88,128,10,246,87,13,},{208,80,64,217,208,2,0,},{207,80,124,244,33,151,13,},},{{233,57,73,233,29,6,0,},{215,40,121,253,41,117,13,},{209,84,108,18,118,0,0,},},
-{{215,44,125,244,141,149,30,},},{{214,156,64,219,80,5,0,},},{{210,68,124,244,33,151,13,},{210,24,112,213,164,6,0,},},{{240,89,100,208,0,0,0,},{239,41,92,208,0,0,0,},
-{219,136,112,214,220,5,0,},},{{235,1,70,235,17,6,0,},{235,237,121,253,237,133,13,},},{{233,65,129,10,250,117,13,},{217,48,112,213,220,5,0,},},{{216,232,121,253,41,133,13,},
-{214,120,120,253,41,101,13,},{207,52,72,217,12,7,0,},},{{218,56,124,244,37,152,13,},},{{238,53,4,218,0,0,0,},{237,53,104,208,0,0,0,},{233,65,125,244,41,150,30,},},
-{{241,172,109,221,48,8,0,},{219,128,120,253,237,101,13,},{206,208,124,244,141,53,13,},},{{240,168,73,240,28,6,0,},{210,40,128,10,210,86,13,},{210,32,104,208,104,7,0,},},
-{{217,56,128,10,250,85,13,},{213,36,72,217,120,5,0,},{213,32,72,217,120,5,0,},},{{219,104,120,253,237,101,13,},{209,48,124,244,97,145,13,},},{{217,32,64,217,4,6,0,},
-{206,188,112,206,16,5,0,},},{{236,237,125,244,173,184,30,},{219,108,64,219,4,6,0,},{214,128,108,214,200,4,0,},{206,192,72,211,120,5,0,},},{{220,116,120,253,233,103,13,},
-{213,48,72,217,120,5,0,},{207,76,108,4,142,6,0,},},{{235,209,69,235,17,6,0,},{233,57,69,233,17,6,0,},{241,136,125,244,173,8,15,},{219,100,128,10,250,101,13,},},
-{{233,33,113,215,220,5,0,},{241,196,69,240,148,8,0,},{241,152,73,240,160,8,0,},},{{210,48,120,253,189,86,13,},{208,48,112,213,132,2,0,},},{{236,221,65,235,137,8,0,},
-{221,132,109,221,200,4,0,},{208,56,68,217,232,2,0,},{207,16,112,237,113,7,0,},},{{235,201,129,10,250,133,13,},{233,41,69,233,17,6,0,},},{{250,173,113,241,188,3,0,},
-{245,109,108,214,164,3,0,},{217,24,120,253,237,85,13,},{206,240,108,2,250,4,0,},},{{252,41,77,234,9,0,0,},{211,216,64,211,4,6,0,},},{{240,136,69,240,16,6,0,},
-{216,212,73,235,121,5,0,},{207,40,120,253,189,86,13,},},{{214,116,124,244,141,181,13,},{207,32,68,217,248,6,0,},},{{217,76,108,4,206,5,0,},{209,80,64,217,12,1,0,},},
-{{249,201,109,216,164,3,0,},{236,205,109,216,48,8,0,},{220,132,108,214,168,7,0,},{214,148,124,244,141,181,13,},},{{242,49,108,208,164,3,0,},{240,168,113,221,220,5,0,},
-{210,28,120,253,189,86,13,},},{{2,254,44,243,1,0,0,},{215,44,73,233,121,5,0,},{211,196,112,206,220,5,0,},},{{219,152,108,15,190,5,0,},{208,92,104,208,136,3,0,},},
-{{221,156,113,221,16,5,0,},},{{220,92,112,214,216,7,0,},{216,236,113,216,16,5,0,},{213,68,120,253,41,85,13,},},{{215,60,73,233,121,5,0,},},{{235,225,121,253,237,133,13,},
-{219,120,128,10,250,101,13,},{218,48,120,253,233,87,13,},},{{247,53,109,215,164,3,0,},{216,228,125,244,141,181,30,},{206,212,124,244,141,53,13,},},{{210,88,108,213,92,6,0,},
-{207,252,255,207,0,240,12,},},{{215,120,109,215,200,4,0,},{213,80,108,213,200,4,0,},{213,28,112,213,16,5,0,},},{{242,5,109,208,164,3,0,},{233,129,65,233,5,6,0,},
-{220,124,72,219,24,8,0,},},{{219,112,108,214,172,5,0,},{212,192,64,211,0,8,0,},},{{236,225,125,244,173,184,30,},{214,92,120,253,41,101,13,},},{{241,196,129,10,126,216,13,},
-{213,36,120,253,41,85,13,},},{{234,77,129,10,126,120,13,},{215,52,73,233,121,5,0,},{211,224,120,253,237,229,12,},},{{221,172,129,10,62,213,13,},{217,88,124,244,41,150,13,},
-{216,200,125,244,141,181,30,},},{{220,136,68,219,12,8,0,},{208,52,120,253,161,82,13,},{207,64,128,10,210,86,13,},},{{220,112,72,219,24,8,0,},{218,28,108,213,168,7,0,},
-{207,28,120,253,189,86,13,},},{{235,213,109,216,172,5,0,},{215,64,89,233,161,5,0,},{211,216,112,206,220,5,0,},},{{233,121,109,215,172,5,0,},{241,156,121,253,113,216,13,},
-{209,36,64,217,12,1,0,},},{{220,120,68,219,12,8,0,},{212,224,124,244,37,56,13,},{208,60,128,10,186,82,13,},},{{234,57,73,233,161,8,0,},{218,64,112,213,216,7,0,},
-{207,88,124,244,33,151,13,},},{{235,201,121,253,237,133,13,},{215,80,121,253,41,117,13,},{208,16,112,237,149,3,0,},},{{217,28,72,217,28,6,0,},{206,160,120,253,41,229,12,},},
-{{241,140,69,240,148,8,0,},{209,68,64,217,12,1,0,},},{{220,148,72,219,24,8,0,},{220,104,112,214,216,7,0,},},{{253,213,53,236,1,0,0,},{216,224,113,216,16,5,0,},
-{211,232,108,206,172,5,0,},},{{5,6,113,5,174,3,0,},{236,229,121,253,113,136,13,},{233,81,69,233,17,6,0,},},{{240,9,101,208,0,0,0,},{240,156,129,10,250,213,13,},
-{214,156,120,253,41,101,13,},{214,148,68,219,100,5,0,},},{{216,224,121,253,41,133,13,},{214,120,88,219,160,5,0,},},{{240,41,100,208,0,0,0,},{221,196,113,221,16,5,0,},},
-{{248,189,109,221,164,3,0,},{235,237,113,216,220,5,0,},{241,148,69,240,148,8,0,},{216,224,129,10,62,133,13,},},{{219,136,120,253,237,101,13,},{206,216,124,244,141,53,13,},},
-{{29,30,113,20,182,3,0,},{220,148,124,244,37,184,13,},{207,52,112,213,164,6,0,},},{{240,160,69,240,16,6,0,},{213,76,108,4,250,4,0,},},{{241,49,96,209,0,0,0,},
-{219,124,120,253,237,101,13,},{218,48,64,217,0,8,0,},},{{0}},{{216,248,65,235,81,5,0,},{210,32,112,213,164,6,0,},{208,32,120,253,161,82,13,},},{{213,32,64,217,80,5,0,},
-{212,244,108,206,168,7,0,},},{{0}},{{247,125,109,26,174,3,0,},{206,180,128,10,62,229,12,},},{{6,46,108,238,245,1,0,},{210,56,120,253,189,86,13,},},{{241,168,113,221,96,8,0,},
-{220,116,112,214,216,7,0,},{213,48,64,217,80,5,0,},},{{215,76,129,10,62,117,13,},{209,56,108,213,84,0,0,},},{{245,101,108,214,164,3,0,},{235,201,73,235,29,6,0,},
-{241,152,113,221,96,8,0,},{206,248,108,17,226,4,0,},},{{249,209,109,216,164,3,0,},{236,213,109,216,48,8,0,},{235,213,65,235,5,6,0,},{208,48,104,208,136,3,0,},},
-{{236,1,70,235,149,8,0,},{220,120,128,10,246,103,13,},{207,68,124,244,33,151,13,},},{{211,220,128,10,250,229,12,},{209,40,108,213,84,0,0,},},{{10,170,61,250,1,0,0,},
-{216,204,129,10,62,133,13,},{206,164,112,206,16,5,0,},},{{208,84,108,18,78,2,0,},{206,232,88,211,160,5,0,},},{{244,61,85,234,1,0,0,},{216,212,65,235,81,5,0,},
-{207,40,112,213,164,6,0,},},{{240,144,65,240,4,6,0,},},{{0}},{{208,8,112,241,65,3,0,},},{{220,136,120,253,233,103,13,},{210,28,112,213,164,6,0,},},{{215,44,65,233,81,5,0,},
-{207,80,104,208,104,7,0,},},{{220,92,128,10,246,103,13,},{216,236,129,10,62,133,13,},{213,64,72,217,120,5,0,},},{{221,172,69,240,100,5,0,},{210,64,64,217,228,6,0,},},
-{{235,233,129,10,250,133,13,},{220,92,120,253,233,103,13,},{216,236,121,253,41,133,13,},{207,48,104,208,104,7,0,},},{{215,60,65,233,81,5,0,},{210,88,128,10,210,86,13,},},
-{{235,225,65,235,5,6,0,},{241,168,129,10,126,216,13,},{215,40,125,244,141,149,30,},},{{241,172,125,244,173,8,15,},{219,120,108,214,172,5,0,},{212,216,112,206,216,7,0,},},
-{{214,136,68,219,100,5,0,},{206,192,108,206,200,4,0,},},{{213,28,120,253,41,85,13,},{212,180,128,10,246,231,12,},},{{221,168,129,10,62,213,13,},{212,196,72,211,24,8,0,},
-{209,16,105,208,208,1,0,},},{{214,128,112,214,16,5,0,},{210,52,120,253,189,86,13,},},{{251,225,4,212,0,0,0,},{251,197,4,212,0,0,0,},{214,92,112,214,16,5,0,},},
-{{235,221,73,235,29,6,0,},{213,88,124,244,141,149,13,},{213,36,112,213,16,5,0,},},{{219,104,72,219,28,6,0,},{217,28,128,10,250,85,13,},{206,196,64,211,80,5,0,},},
-{{238,149,4,220,0,0,0,},{241,148,121,253,113,216,13,},{206,176,112,206,16,5,0,},},{{249,237,109,216,164,3,0,},{236,233,109,216,48,8,0,},{216,220,129,10,62,133,13,},
-{208,52,112,213,132,2,0,},},{{220,112,64,219,0,8,0,},{207,64,124,244,33,151,13,},{207,28,112,213,164,6,0,},},{{215,64,65,233,81,5,0,},{211,172,108,206,172,5,0,},},
-{{236,209,73,235,161,8,0,},{216,200,129,10,62,133,13,},{208,64,72,217,0,3,0,},},{{249,221,109,216,164,3,0,},{221,136,73,240,120,5,0,},{210,80,108,213,92,6,0,},},
-{{235,205,129,10,250,133,13,},{234,57,65,233,137,8,0,},{240,140,109,221,172,5,0,},{218,64,120,253,233,87,13,},},{{221,196,109,221,200,4,0,},{215,80,65,233,81,5,0,},
-{209,64,128,10,242,80,13,},},{{239,89,92,208,0,0,0,},{233,45,65,233,5,6,0,},{241,140,129,10,126,216,13,},{217,56,108,213,172,5,0,},},{{235,225,109,216,172,5,0,},
-{212,232,108,206,168,7,0,},},{{220,104,120,253,233,103,13,},{207,36,104,208,104,7,0,},},{{221,152,113,221,16,5,0,},{211,192,112,206,220,5,0,},},{{233,81,125,244,41,150,30,},
-{211,228,120,253,237,229,12,},},{{236,201,125,244,173,184,30,},{214,156,112,214,16,5,0,},{214,104,128,10,62,101,13,},{208,88,124,244,25,147,13,},},{{235,237,129,10,250,133,13,},
-{219,112,68,219,16,6,0,},{212,212,68,211,12,8,0,},{210,68,108,213,92,6,0,},},{{220,108,120,253,233,103,13,},{214,120,124,244,141,181,13,},{213,68,108,213,200,4,0,},},
-{{235,209,109,216,172,5,0,},{241,188,113,221,96,8,0,},{210,28,104,208,104,7,0,},},{{220,152,108,15,186,7,0,},{207,64,68,217,248,6,0,},},{{240,172,73,240,28,6,0,},
-{240,160,129,10,250,213,13,},{207,52,120,253,189,86,13,},},{{218,56,108,213,168,7,0,},{215,128,109,215,200,4,0,},{213,24,112,213,16,5,0,},},{{219,124,72,219,28,6,0,},
-{211,244,128,10,250,229,12,},{206,208,64,211,80,5,0,},},{{220,132,128,10,246,103,13,},{210,40,68,217,248,6,0,},},{{243,209,108,206,164,3,0,},{210,32,120,253,189,86,13,},
-{208,32,112,213,132,2,0,},},{{242,41,108,208,164,3,0,},{234,129,69,233,149,8,0,},{213,32,120,253,41,85,13,},},{{213,40,68,217,100,5,0,},{209,48,108,213,84,0,0,},},
-{{241,136,121,253,113,216,13,},},{{210,56,112,213,164,6,0,},},{{240,49,100,208,0,0,0,},{233,61,121,253,237,117,13,},{206,200,64,211,80,5,0,},},{{250,145,113,241,188,3,0,},
-{235,229,113,216,220,5,0,},},{{235,201,65,235,5,6,0,},{241,152,121,253,113,216,13,},{219,100,124,244,41,182,13,},{216,24,121,253,41,133,13,},},{{217,64,68,217,16,6,0,},
-{210,48,104,208,104,7,0,},},{{233,41,129,10,250,117,13,},{218,68,112,213,216,7,0,},{209,32,72,217,68,1,0,},},{{240,148,129,10,250,213,13,},{219,128,128,10,250,101,13,},
-{211,212,112,206,220,5,0,},},{{248,153,109,221,164,3,0,},{206,164,120,253,41,229,12,},},{{251,201,4,212,0,0,0,},{214,116,120,253,41,101,13,},},{{234,53,113,215,96,8,0,},
-{214,148,120,253,41,101,13,},{207,32,128,10,210,86,13,},},{{8,130,41,247,1,0,0,},{221,148,121,253,41,213,13,},{209,80,124,244,97,145,13,},},{{251,189,4,212,0,0,0,},
-{248,169,109,221,164,3,0,},{234,121,69,233,149,8,0,},},{{241,229,96,209,0,0,0,},{236,205,125,244,173,184,30,},{219,132,112,214,220,5,0,},{209,24,108,213,84,0,0,},},
-{{214,124,88,219,160,5,0,},{207,56,104,208,104,7,0,},},{{235,213,129,10,250,133,13,},{215,44,89,233,161,5,0,},{210,252,255,207,4,240,12,},},{{237,41,104,208,0,0,0,},
-{235,233,113,216,220,5,0,},{221,140,129,10,62,213,13,},{213,64,64,217,80,5,0,},},{{210,64,72,217,12,7,0,},},{{218,36,64,217,0,8,0,},{216,228,121,253,41,133,13,},
-{207,48,112,213,164,6,0,},},{{236,25,129,10,126,136,13,},{215,60,121,253,41,117,13,},{212,208,72,211,24,8,0,},},{{235,225,73,235,29,6,0,},{219,148,108,214,172,5,0,},
-{217,32,68,217,16,6,0,},},{{233,69,65,233,5,6,0,},{212,216,120,253,233,231,12,},{206,212,108,206,200,4,0,},},{{218,52,64,217,0,8,0,},{210,36,112,213,164,6,0,},
-{208,36,120,253,161,82,13,},},{{254,85,69,24,142,7,0,},{221,168,69,240,100,5,0,},{215,120,125,244,141,149,30,},{213,80,124,244,141,149,13,},},{{242,81,108,208,164,3,0,},
-{211,232,112,206,220,5,0,},{209,12,108,240,169,1,0,},},{{237,57,104,208,0,0,0,},{212,192,112,206,216,7,0,},{210,0,105,208,104,7,0,},},{{249,229,109,216,164,3,0,},
-{233,69,109,215,172,5,0,},{212,188,64,211,0,8,0,},{210,60,120,253,189,86,13,},},{{234,125,109,26,66,8,0,},{234,61,69,233,149,8,0,},{209,52,72,217,68,1,0,},},
-{{210,60,128,10,210,86,13,},{206,196,72,211,120,5,0,},},{{211,172,128,10,250,229,12,},{206,176,120,253,41,229,12,},},{{240,192,109,30,190,5,0,},{208,52,72,217,0,3,0,},},
-{{236,233,129,10,126,136,13,},{218,28,124,244,37,152,13,},{207,28,104,208,104,7,0,},},{{237,17,112,237,165,3,0,},{233,61,125,244,41,150,30,},{215,64,73,233,121,5,0,},
-{213,52,68,217,100,5,0,},},{{236,209,65,235,137,8,0,},{208,64,64,217,208,2,0,},{206,244,124,244,141,53,13,},},{{250,137,113,241,188,3,0,},{215,80,113,215,16,5,0,},
-{212,224,108,206,168,7,0,},},{{234,57,121,253,113,120,13,},{218,64,64,217,0,8,0,},{213,60,112,213,16,5,0,},},{{220,148,68,219,12,8,0,},{215,80,73,233,121,5,0,},
-{213,60,120,253,41,85,13,},},{{245,137,108,214,164,3,0,},{233,45,73,233,29,6,0,},},{{240,148,73,240,28,6,0,},{207,80,64,217,228,6,0,},},{{236,201,129,10,126,136,13,},
-{218,80,64,217,0,8,0,},{207,36,112,213,164,6,0,},},{{216,20,49,19,198,3,0,},{211,192,120,253,237,229,12,},{209,204,108,251,53,0,0,},},{{245,153,108,15,174,3,0,},
-{240,140,125,244,41,6,15,},},{{215,76,121,253,41,117,13,},},{{241,1,96,209,0,0,0,},{207,60,120,253,189,86,13,},},{{0}},{{241,188,121,253,113,216,13,},{210,24,128,10,210,86,13,},},
-{{219,136,72,219,28,6,0,},{211,176,128,10,250,229,12,},{209,64,64,217,12,1,0,},},{{218,32,112,213,216,7,0,},{217,64,128,10,250,85,13,},},{{220,156,72,219,24,8,0,},
-{213,24,120,253,41,85,13,},},{{219,124,64,219,4,6,0,},{206,208,72,211,120,5,0,},},{{214,132,112,214,16,5,0,},{212,196,120,253,233,231,12,},},{{210,32,64,217,228,6,0,},
-{208,32,72,217,0,3,0,},},{{221,172,109,221,200,4,0,},{213,32,112,213,16,5,0,},{210,64,68,217,248,6,0,},},{{240,5,101,208,0,0,0,},{234,45,69,233,149,8,0,},
-{211,176,108,206,172,5,0,},{210,56,128,10,210,86,13,},},{{236,237,65,235,137,8,0,},{219,108,124,244,41,182,13,},{206,180,112,206,16,5,0,},},{{239,17,92,208,0,0,0,},
-{233,69,69,233,17,6,0,},{210,56,104,208,104,7,0,},},{{236,213,129,10,126,136,13,},{240,184,109,12,206,5,0,},{221,136,109,221,200,4,0,},{207,24,112,213,164,6,0,},},
-{{235,209,125,244,41,182,30,},{241,188,129,10,126,216,13,},{217,40,108,213,172,5,0,},},{{248,145,109,221,164,3,0,},{241,196,109,221,48,8,0,},{220,100,124,244,37,184,13,},
-{206,172,120,253,41,229,12,},},{{236,1,122,253,113,136,13,},{207,68,64,217,228,6,0,},},{{246,81,108,213,164,3,0,},{215,68,109,215,200,4,0,},{209,32,64,217,12,1,0,},},
-{{221,140,121,253,41,213,13,},{209,12,105,208,208,1,0,},{209,40,124,244,97,145,13,},},{{0}},{{206,232,72,211,120,5,0,},},{{234,53,121,253,113,120,13,},{215,80,89,233,161,5,0,},
-{214,104,108,214,200,4,0,},},{{221,148,113,221,16,5,0,},{219,112,120,253,237,101,13,},{218,68,128,10,246,87,13,},},{{237,33,104,208,0,0,0,},{220,136,124,244,37,184,13,},
-{206,224,68,211,100,5,0,},},{{236,205,69,235,149,8,0,},{234,77,121,253,113,120,13,},{211,212,120,253,237,229,12,},},{{240,152,125,244,41,6,15,},{216,228,113,216,16,5,0,},
-{210,28,64,217,228,6,0,},},{{215,128,129,10,62,117,13,},{209,88,108,213,84,0,0,},},{{247,45,109,215,164,3,0,},{219,156,108,214,172,5,0,},},{{212,208,120,253,233,231,12,},
-{206,220,108,206,200,4,0,},},{{218,36,72,217,24,8,0,},{216,24,109,216,200,4,0,},{207,48,120,253,189,86,13,},},{{215,60,113,215,16,5,0,},{209,28,104,208,208,1,0,},},
-{{241,160,121,253,113,216,13,},{221,160,73,240,120,5,0,},{211,224,112,206,220,5,0,},},{{214,108,108,214,200,4,0,},{209,28,128,10,242,80,13,},},{{218,52,72,217,24,8,0,},
-{210,36,120,253,189,86,13,},{208,36,112,213,132,2,0,},},{{238,125,4,220,0,0,0,},{217,60,108,213,172,5,0,},{214,124,124,244,141,181,13,},},{{236,221,73,235,161,8,0,},
-{211,232,72,211,28,6,0,},},{{215,120,89,233,161,5,0,},{212,180,108,206,168,7,0,},{210,80,128,10,210,86,13,},},{{238,41,4,218,0,0,0,},{233,77,129,10,250,117,13,},
-{210,60,112,213,164,6,0,},{209,88,124,244,97,145,13,},},{{1,254,40,243,1,0,0,},{209,52,64,217,12,1,0,},{209,40,128,10,242,80,13,},},{{250,149,113,241,188,3,0,},
-{235,221,125,244,41,182,30,},{217,80,72,217,28,6,0,},{211,252,120,253,237,229,12,},},{{219,116,68,219,16,6,0,},{209,60,128,10,242,80,13,},{206,252,124,244,141,53,13,},},
-{{234,33,109,215,48,8,0,},{210,52,72,217,12,7,0,},{208,52,64,217,208,2,0,},},{{234,33,121,253,113,120,13,},{214,132,72,219,120,5,0,},{207,64,108,213,92,6,0,},},
-{{241,156,69,240,148,8,0,},{217,64,72,217,28,6,0,},{209,36,124,244,97,145,13,},},{{245,129,108,214,164,3,0,},{234,45,73,233,161,8,0,},{241,132,113,221,96,8,0,},},
-{{0}},{{234,57,113,215,96,8,0,},{218,64,72,217,24,8,0,},{207,88,68,217,248,6,0,},},{{221,144,121,253,41,213,13,},{215,64,69,233,101,5,0,},{211,200,120,253,237,229,12,},},
-{{241,140,113,221,96,8,0,},},{{240,148,65,240,4,6,0,},{211,200,128,10,250,229,12,},{207,80,72,217,12,7,0,},},{{218,80,72,217,24,8,0,},{207,36,120,253,189,86,13,},},
-{{235,253,109,31,190,5,0,},{215,40,89,233,161,5,0,},{211,192,64,211,4,6,0,},},{{233,81,109,215,172,5,0,},{214,120,112,214,16,5,0,},},{{249,205,109,216,164,3,0,},
-{236,201,109,216,48,8,0,},{208,88,108,213,48,2,0,},},{{255,101,40,245,1,0,0,},{210,16,105,208,104,7,0,},{207,60,112,213,164,6,0,},},{{215,32,129,10,62,117,13,},
-{213,68,124,244,141,149,13,},},{{10,142,61,250,1,0,0,},{241,93,96,209,0,0,0,},{238,137,4,220,0,0,0,},{241,188,65,240,136,8,0,},},{{243,181,108,206,164,3,0,},
-{219,136,64,219,4,6,0,},{214,112,108,214,200,4,0,},{206,216,68,211,100,5,0,},},{{218,32,120,253,233,87,13,},{207,52,104,208,104,7,0,},},{{211,252,108,206,172,5,0,},
-{209,0,104,208,208,1,0,},},{{241,172,65,240,136,8,0,},{217,56,68,217,16,6,0,},{211,184,108,206,172,5,0,},},{{214,104,68,219,100,5,0,},{212,196,112,206,216,7,0,},
-{206,216,128,10,62,229,12,},},{{15,142,4,255,1,0,0,},{216,248,121,253,41,133,13,},{210,32,72,217,12,7,0,},{208,32,64,217,208,2,0,},},{{218,48,68,217,12,8,0,},
-{213,84,108,18,226,4,0,},{209,8,112,241,145,1,0,},},{{217,32,108,213,172,5,0,},{206,200,68,211,100,5,0,},},{{241,144,113,221,96,8,0,},{212,184,108,206,168,7,0,},
-{206,180,120,253,41,229,12,},},{{244,101,85,254,1,0,0,},{234,69,113,215,96,8,0,},{240,196,69,240,16,6,0,},},{{246,89,108,213,164,3,0,},{234,121,125,244,173,152,30,},
-{234,53,73,233,161,8,0,},{215,76,109,215,200,4,0,},},{{221,188,65,240,80,5,0,},{209,56,68,217,40,1,0,},{209,40,104,208,208,1,0,},},{{219,100,108,214,172,5,0,},
-{206,172,112,206,16,5,0,},},{{236,1,114,216,96,8,0,},{236,221,125,244,173,184,30,},{207,68,72,217,12,7,0,},},{{234,61,121,253,113,120,13,},{218,24,108,213,168,7,0,},
-{216,0,126,244,141,181,30,},{213,56,112,213,16,5,0,},},{{221,140,65,240,80,5,0,},{211,212,64,211,4,6,0,},{208,0,113,237,149,3,0,},},{{241,33,96,209,0,0,0,},
-{233,129,113,215,220,5,0,},{207,68,108,213,92,6,0,},},{{244,33,85,21,2,0,0,},{241,160,113,221,96,8,0,},{206,232,64,211,80,5,0,},},{{234,53,129,10,126,120,13,},
-{240,144,125,244,41,6,15,},{207,32,112,213,164,6,0,},},{{0,102,44,245,1,0,0,},{221,156,121,253,41,213,13,},{209,80,108,213,84,0,0,},},{{250,189,113,241,188,3,0,},
-{240,156,125,244,41,6,15,},{209,56,128,10,242,80,13,},},{{220,108,108,214,168,7,0,},{216,220,109,216,200,4,0,},{207,4,105,208,104,7,0,},},{{207,56,120,253,189,86,13,},},
-{{242,29,108,208,164,3,0,},{213,64,124,244,141,149,13,},{213,28,88,217,160,5,0,},{209,64,108,213,84,0,0,},},{{216,248,69,235,101,5,0,},},{{208,52,128,10,186,82,13,},},
-{{218,36,112,213,216,7,0,},{207,48,64,217,228,6,0,},},{{220,124,112,214,216,7,0,},{209,28,112,213,180,0,0,},},{{221,160,65,240,80,5,0,},{219,148,124,244,41,182,13,},
-{212,192,128,10,246,231,12,},},{{210,48,128,10,210,86,13,},},{{240,172,65,240,4,6,0,},{213,80,128,10,62,85,13,},{208,36,104,208,136,3,0,},},{{237,69,104,208,0,0,0,},
-{234,81,129,10,126,120,13,},{221,28,113,20,186,4,0,},},{{234,61,65,233,137,8,0,},{211,232,64,211,4,6,0,},{211,188,68,211,16,6,0,},},{{236,249,121,253,113,136,13,},
-{219,132,72,219,28,6,0,},{214,100,124,244,141,181,13,},},{{213,88,64,217,80,5,0,},{211,224,128,10,250,229,12,},{207,12,108,240,81,7,0,},},{{234,41,121,253,113,120,13,},
-{212,212,72,211,24,8,0,},},{{217,36,68,217,16,6,0,},{206,196,88,211,160,5,0,},},{{241,53,96,209,0,0,0,},{241,148,65,240,136,8,0,},},{{240,188,113,221,220,5,0,},},
-{{235,201,113,216,220,5,0,},{233,41,73,233,29,6,0,},{213,52,120,253,41,85,13,},},{{217,64,64,217,4,6,0,},{214,104,72,219,120,5,0,},{211,208,120,253,237,229,12,},},
-{{247,65,109,215,164,3,0,},{245,105,108,214,164,3,0,},{206,244,108,206,200,4,0,},},{{239,29,92,208,0,0,0,},{216,0,130,10,62,133,13,},{212,172,128,10,246,231,12,},},
-{{240,140,69,240,16,6,0,},{211,164,128,10,250,229,12,},},{{218,88,68,217,12,8,0,},{209,44,108,238,29,0,0,},{209,32,68,217,40,1,0,},},{{247,81,109,215,164,3,0,},
-{245,121,108,214,164,3,0,},{241,140,121,253,113,216,13,},{206,228,108,206,200,4,0,},},{{208,80,108,213,48,2,0,},},{{240,156,69,240,16,6,0,},{218,80,112,213,216,7,0,},
-{207,36,64,217,228,6,0,},},{{238,89,4,218,0,0,0,},{221,152,73,240,120,5,0,},{211,192,72,211,28,6,0,},},{{0}},{{243,189,108,206,164,3,0,},{235,1,130,10,250,133,13,},
-{214,120,108,214,200,4,0,},{212,212,120,253,233,231,12,},},{{218,40,120,253,233,87,13,},{215,56,121,253,41,117,13,},},{{213,56,88,217,160,5,0,},{209,68,68,217,40,1,0,},},
-{{241,188,73,240,160,8,0,},{214,120,128,10,62,101,13,},{211,208,112,206,220,5,0,},},{{233,65,73,233,29,6,0,},{217,48,72,217,28,6,0,},},{{241,156,125,244,173,8,15,},
-{218,32,128,10,246,87,13,},{213,88,68,217,100,5,0,},},{{239,53,92,208,0,0,0,},{233,65,65,233,5,6,0,},{217,48,108,213,172,5,0,},},{{235,205,109,216,172,5,0,},
-{241,172,73,240,160,8,0,},{206,208,88,211,160,5,0,},},{{219,112,128,10,250,101,13,},{210,4,113,5,94,7,0,},{210,40,108,213,92,6,0,},},{{241,168,121,253,113,216,13,},
-{220,132,124,244,37,184,13,},{214,100,108,214,200,4,0,},},{{221,172,125,244,141,5,15,},{211,244,124,244,41,54,13,},{211,184,128,10,250,229,12,},},{{250,153,113,241,188,3,0,},
-{240,17,100,208,0,0,0,},{210,76,108,4,142,6,0,},},{{236,225,109,216,48,8,0,},{219,108,108,214,172,5,0,},{212,244,72,211,24,8,0,},},{{250,133,113,29,190,3,0,},
-{240,196,125,244,41,6,15,},},{{220,100,120,253,233,103,13,},},{{251,217,4,212,0,0,0,},{233,57,109,215,172,5,0,},{221,188,73,240,120,5,0,},{217,40,124,244,41,150,13,},},
-{{236,249,73,235,161,8,0,},{215,64,121,253,41,117,13,},{212,252,112,206,216,7,0,},},{{220,124,68,219,12,8,0,},{216,204,69,235,101,5,0,},},{{234,61,113,215,96,8,0,},
-{215,68,125,244,141,149,30,},{213,56,120,253,41,85,13,},},{{221,140,73,240,120,5,0,},{216,244,109,14,250,4,0,},{211,212,72,211,28,6,0,},},{{236,221,129,10,126,136,13,},
-{212,228,120,253,233,231,12,},},{{234,53,69,233,149,8,0,},{216,212,109,216,200,4,0,},{207,12,105,208,104,7,0,},},{{207,32,120,253,189,86,13,},},{{235,249,69,235,17,6,0,},
-{234,81,69,233,149,8,0,},},{{242,17,108,208,164,3,0,},},{{242,53,108,208,164,3,0,},{217,52,64,217,4,6,0,},{207,4,113,5,94,7,0,},},{{240,140,65,240,4,6,0,},
-{214,124,64,219,80,5,0,},{207,56,112,213,164,6,0,},},{{248,193,109,30,174,3,0,},},{{219,156,124,244,41,182,13,},{214,116,128,10,62,101,13,},},{{249,25,109,216,164,3,0,},
-{219,92,128,10,250,101,13,},{208,24,112,213,132,2,0,},},{{218,36,120,253,233,87,13,},{211,224,124,244,41,54,13,},{207,48,72,217,12,7,0,},},{{214,136,128,10,62,101,13,},
-{209,28,120,253,213,80,13,},},{{234,41,65,233,137,8,0,},{212,216,68,211,12,8,0,},{210,52,64,217,228,6,0,},},{{236,25,113,216,96,8,0,},{214,108,124,244,141,181,13,},
-{210,88,72,217,12,7,0,},},{{221,168,73,240,120,5,0,},{210,36,104,208,104,7,0,},{209,252,255,207,16,240,12,},},{{221,168,125,244,141,5,15,},{211,188,128,10,250,229,12,},
-{209,4,112,239,125,1,0,},},{{237,1,104,208,0,0,0,},{233,129,121,253,237,117,13,},{217,48,68,217,16,6,0,},},{{212,200,112,206,216,7,0,},},{{236,213,73,235,161,8,0,},
-{213,36,68,217,100,5,0,},},{{234,41,113,215,96,8,0,},{234,33,113,215,96,8,0,},{219,116,72,219,28,6,0,},},{{28,50,77,27,2,0,0,},{217,80,120,253,237,85,13,},
-{217,36,124,244,41,150,13,},{206,184,108,206,200,4,0,},},{{235,213,113,216,220,5,0,},{220,132,72,219,24,8,0,},{206,252,108,206,200,4,0,},},{{240,188,121,253,237,213,13,},
-{220,136,108,214,168,7,0,},},{{240,53,100,208,0,0,0,},{235,213,73,235,29,6,0,},{215,64,125,244,141,149,30,},{213,52,112,213,16,5,0,},},{{233,57,125,244,41,150,30,},
-{209,36,108,213,84,0,0,},},{{249,1,110,216,164,3,0,},{208,64,104,208,136,3,0,},},{{236,249,113,216,96,8,0,},{216,200,109,216,200,4,0,},{208,4,112,239,49,3,0,},},
-{{4,30,44,246,1,0,0,},{209,36,128,10,242,80,13,},},{{219,136,68,219,16,6,0,},},{{235,25,109,216,172,5,0,},{212,232,64,211,0,8,0,},{206,160,128,10,62,229,12,},},
-{{216,208,69,235,101,5,0,},{210,48,108,213,92,6,0,},},{{220,108,128,10,246,103,13,},{218,80,120,253,233,87,13,},{207,36,72,217,12,7,0,},},{{234,81,109,215,48,8,0,},
-{215,40,73,233,121,5,0,},{208,64,68,217,232,2,0,},},{{233,121,65,233,5,6,0,},},{{212,212,112,206,216,7,0,},{208,28,104,208,136,3,0,},},{{218,40,112,213,216,7,0,},
-{208,80,120,253,161,82,13,},},{{254,33,117,23,126,7,0,},{215,56,73,233,121,5,0,},{215,52,109,215,200,4,0,},{209,24,112,213,180,0,0,},},{{252,53,77,234,9,0,0,},
-{235,237,73,235,29,6,0,},{213,64,120,253,41,85,13,},},{{241,17,96,209,0,0,0,},{217,48,64,217,4,6,0,},{214,112,124,244,141,181,13,},},{{220,156,124,244,37,184,13,},
-{219,92,120,253,237,101,13,},{216,212,129,10,62,133,13,},},{{235,229,69,235,17,6,0,},{212,220,128,10,246,231,12,},{211,252,124,244,41,54,13,},},{{234,129,129,10,126,120,13,},
-{241,172,113,221,96,8,0,},{212,212,108,206,168,7,0,},},{{236,229,129,10,126,136,13,},{212,196,64,211,0,8,0,},{206,200,120,253,41,229,12,},},{{240,168,121,253,237,213,13,},
-{208,68,64,217,208,2,0,},},{{221,132,121,253,41,213,13,},{213,40,112,213,16,5,0,},},{{234,69,125,244,173,152,30,},{217,32,124,244,41,150,13,},{206,200,72,211,120,5,0,},},
-{{245,93,108,214,164,3,0,},{233,45,69,233,17,6,0,},{206,188,128,10,62,229,12,},},{{255,133,40,245,1,0,0,},{211,196,68,211,16,6,0,},},{{234,121,109,215,48,8,0,},
-{220,116,72,219,24,8,0,},{213,48,120,253,41,85,13,},{212,252,128,10,246,231,12,},},{{235,201,109,216,172,5,0,},{233,33,109,215,172,5,0,},},{{1,234,40,243,1,0,0,},
-{213,48,128,10,62,85,13,},{212,252,120,253,233,231,12,},},{{236,221,109,216,48,8,0,},{208,76,108,4,106,2,0,},{208,56,104,208,136,3,0,},},{{234,61,73,233,161,8,0,},
-{215,68,69,233,101,5,0,},{213,56,64,217,80,5,0,},{209,32,104,208,208,1,0,},},{{221,192,109,30,226,4,0,},{215,128,69,233,101,5,0,},{212,224,128,10,246,231,12,},},
+static const uint16_t action_table_displacements[1344] = {
+38,1283,57,1422,10,1,187,501,1356,2,571,783,200,16,44,0,
+48,81,0,16,262,169,653,37,196,0,59,2,82,0,35,15,
+0,23,0,39,0,275,3,0,18,2,77,22,49,537,15,0,
+191,23,1,1,125,15,0,43,252,11,0,5,0,114,42,0,
+81,51,18,15,1,2,70,0,0,84,82,42,85,3,5,69,
+31,0,0,140,113,2,38,2,245,0,20,12,3,17,35,70,
+10,19,0,24,106,23,12,244,4,8,4,5,0,25,14,13,
+85,1,85,44,24,22,125,21,13,5,0,2,1,0,123,0,
+26,80,24,29,104,7,28,0,58,64,86,1,6,25,7,14,
+22,4,7,17,2,51,5,0,74,144,50,47,0,0,51,0,
+39,53,14,39,83,1,40,40,13,24,0,7,0,15,86,0,
+176,1,10,0,56,9,2,8,0,21,0,0,47,9,9,16,
+6,15,2,22,48,0,43,108,30,0,90,2,27,0,7,79,
+2,8,0,1,30,8,8,0,5,13,0,4,26,0,0,1,
+4,48,12,21,1,0,0,25,2,12,9,51,0,153,38,0,
+0,0,32,38,8,91,0,0,6,7,6,2,7,0,11,47,
+1,0,0,4,18,9,59,3,0,10,14,0,1,0,112,0,
+26,7,0,0,31,1,0,1,0,8,2,1,13,1,6,3,
+5,0,1,17,0,0,26,23,48,0,9,3,0,12,8,8,
+7,3,45,10,55,80,0,53,35,0,7,21,41,0,18,0,
+1,1,8,2,11,13,2,1,0,16,10,47,4,23,10,0,
+1,5,6,27,0,31,32,0,1,21,24,0,34,40,30,2,
+2,0,3,0,56,0,3,16,0,13,37,0,0,33,78,0,
+7,1,0,4,1,2,0,9,48,0,8,28,20,0,15,5,
+3,51,17,12,5,1,13,1,0,2,0,14,0,34,0,0,
+22,0,2,26,15,0,0,43,15,88,19,45,2,5,138,110,
+0,0,19,10,11,6,0,3,4,10,0,2,20,2,2,35,
+14,68,18,43,0,2,4,7,2,7,10,0,2,10,4,6,
+1,27,14,19,0,10,0,1,30,4,2,0,31,11,2,41,
+0,25,6,0,8,15,3,20,75,1,1,2,2,7,1,0,
+1,24,26,8,35,68,0,3,8,0,2,6,6,1,50,6,
+8,11,5,0,38,1,0,5,18,31,8,0,1,0,0,8,
+10,0,7,0,0,15,5,1,23,12,9,54,3,3,23,4,
+2,44,16,36,3,0,7,4,10,20,0,1,3,5,0,9,
+4,0,3,27,0,25,20,2,25,0,9,5,37,1,11,8,
+0,8,1,9,0,19,13,0,0,32,21,12,4,0,11,50,
+0,33,40,7,0,2,7,2,12,0,2,2,12,0,2,3,
+54,7,1,0,37,0,0,4,4,3,1,1,22,17,18,10,
+11,0,6,10,0,0,1,7,4,11,7,5,28,1,10,39,
+6,12,16,21,17,0,17,0,14,0,9,26,2,29,6,2,
+13,13,1,6,0,0,0,13,4,34,0,0,3,13,0,22,
+3,4,0,5,21,17,30,1,3,0,0,2,7,3,0,10,
+24,6,8,5,22,2,16,6,29,1,10,4,3,0,16,6,
+3,1,2,1,1,9,18,22,18,16,19,47,0,6,17,1,
+0,2,1,0,68,7,37,3,6,11,40,0,4,3,8,0,
+15,19,5,10,2,10,2,10,12,8,1,0,0,4,12,3,
+23,0,5,1,6,0,0,7,14,26,9,9,1,12,5,7,
+5,3,3,18,0,3,1,13,10,4,17,0,25,13,2,23,
+4,8,2,0,5,5,3,7,7,4,30,0,2,0,2,40,
+9,24,3,16,6,0,2,0,2,0,0,1,0,2,0,7,
+4,1,0,5,3,5,20,2,12,0,1,4,6,6,7,0,
+4,0,17,1,8,0,2,5,9,0,0,7,4,9,17,4,
+1,3,1,1,12,3,0,2,9,2,0,0,0,3,3,6,
+6,2,0,10,56,2,23,17,9,1,1,44,4,4,1,4,
+9,10,9,0,2,17,15,10,4,13,0,1,5,40,0,0,
+16,0,6,3,6,0,2,33,10,0,27,0,24,10,3,0,
+6,0,1,2,11,4,0,1,10,0,6,12,1,48,5,0,
+0,5,0,3,2,4,14,5,13,1,0,3,2,0,16,8,
+1,2,4,0,0,8,0,7,29,2,3,22,1,19,8,0,
+17,8,1,0,0,21,0,0,8,0,0,11,0,33,9,0,
+21,7,0,5,0,4,0,1,1,4,31,14,0,1,1,4,
+6,1,3,1,0,2,1,2,11,0,1,1,19,19,6,19,
+0,4,0,5,9,5,26,5,5,20,0,0,1,1,1,0,
+0,22,3,0,0,11,14,0,14,0,1,1,15,7,22,3,
+0,5,0,2,9,9,15,3,10,0,1,0,7,4,0,0,
+12,10,3,13,3,3,2,2,7,0,13,0,5,10,1,6,
+0,13,0,4,0,5,3,0,1,4,8,5,2,1,2,7,
+2,4,5,2,0,0,4,0,0,5,0,11,9,0,3,0,
+7,1,0,0,14,0,1,1,0,0,0,3,1,13,0,0,
+0,4,4,3,0,7,13,43,5,6,1,0,1,4,6,3,
+9,0,0,17,1,9,35,18,1,3,0,3,1,0,1,9,
+5,2,3,1,0,7,13,0,0,1,13,0,0,0,0,19,
+0,2,3,17,0,0,11,0,0,2,18,11,5,5,0,0,
+1,1,12,2,0,0,9,0,9,3,0,3,5,3,2,1,
+3,11,9,9,6,1,18,6,22,0,4,10,3,1,3,0,
+18,0,9,10,3,1,0,0,5,1,7,0,8,0,6,1,
+0,5,0,0,4,4,0,6,16,7,0,5,0,0,8,8,
+4,6,19,3,0,0,15,2,1,2,8,1,4,0,0,0,
+4,6,0,2,5,8,0,2,10,18,0,2,0,0,1,11,
+0,9,3,15,0,0,0,1,0,1,2,4,0,0,6,2,
+3,0,7,1,1,1,2,7,0,0,2,3,34,0,5,2,
+3,0,0,4,0,19,0,1,2,0,0,0,0,8,4,0,
+0,0,12,0,4,1,0,6,0,1,6,0,4,0,2,0,
+4,3,7,0,0,0,0,1,0,4,0,18,0,11,6,3,
+};
+static const uint16_t action_table_slot_for_column[4386] = {
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,236,1268,1491,0,457,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1828,
+2161,1273,0,2248,0,0,0,0,0,0,278,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1013,
+0,0,0,0,0,0,0,0,646,865,0,0,0,0,0,0,
+0,0,0,0,2412,914,2609,2064,0,0,0,0,0,0,0,0,
+0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,171,640,1987,1722,0,0,0,0,0,0,
+0,0,0,370,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,846,965,816,2259,0,0,0,0,
+0,0,0,0,0,279,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,944,1831,1264,2232,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,1274,
+2159,262,0,0,0,0,0,0,0,0,0,592,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1922,2391,2607,648,0,0,0,0,0,0,0,0,0,1121,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1493,9,1191,1809,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2216,775,0,0,0,0,0,0,0,0,329,1021,0,0,0,0,
+0,0,0,0,0,0,1065,1534,1262,17,0,0,0,0,0,0,
+0,0,0,757,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1512,1353,303,1871,0,0,0,0,
+0,0,0,0,0,2395,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2566,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,542,1885,
+2605,1393,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1239,0,0,
+0,0,0,0,0,0,1086,2049,0,0,0,0,0,0,0,0,
+0,0,544,1532,2455,2018,0,0,0,0,0,0,0,0,0,0,
+1347,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,97,2532,2106,0,0,0,0,0,0,0,0,
+0,0,0,900,912,89,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1167,2116,0,0,0,0,0,0,0,0,87,374,0,0,
+0,0,0,0,0,0,0,0,1830,0,0,0,0,0,0,0,
+0,0,0,0,0,489,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,147,0,0,0,0,0,
+0,0,0,0,0,0,0,700,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,
+0,0,0,0,0,0,0,0,0,771,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1128,0,
+0,0,0,0,0,0,0,0,0,0,0,1219,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+119,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2521,0,0,0,0,0,0,0,0,0,0,0,0,918,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,888,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,2061,0,0,0,0,0,0,0,0,267,2536,0,0,
+0,0,0,0,0,0,0,0,1376,0,0,0,0,0,0,0,
+0,0,0,0,0,1938,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,584,0,0,0,0,0,
+0,0,0,0,0,0,0,1533,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2426,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+558,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1678,
+0,0,0,0,0,0,0,0,2473,881,0,0,0,0,0,0,
+0,0,0,0,2284,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1834,39,2121,890,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1986,
+0,0,0,0,0,0,0,0,1666,1725,0,0,0,0,0,0,
+0,0,0,0,2348,0,0,0,0,0,0,0,0,0,0,0,
+0,686,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,
+0,0,0,949,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1466,0,0,0,0,0,0,0,
+0,0,0,0,0,2444,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2447,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2246,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2523,0,
+0,0,0,0,0,0,0,0,0,0,0,252,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2039,0,0,0,0,0,0,0,0,0,0,0,0,2102,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2112,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1801,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,940,0,0,0,0,0,0,0,0,0,
+0,0,0,0,1334,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1073,1180,1822,0,0,0,0,
+0,0,0,0,2501,8,0,0,0,0,0,0,0,0,265,158,
+0,0,0,0,0,0,0,0,0,0,1548,0,0,0,0,0,
+0,0,0,0,0,0,0,2193,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1351,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2323,
+0,0,0,0,0,0,0,0,1994,856,0,0,0,0,0,0,
+0,0,0,0,2154,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,155,787,1661,0,256,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2091,2140,240,0,2676,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1649,613,2136,0,332,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,78,1275,1737,
+0,2123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1735,
+2006,392,0,2358,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1049,0,1233,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,501,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,1860,2100,
+0,0,0,0,0,0,0,2249,0,134,1056,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,2167,0,582,1969,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1792,0,2631,0,1030,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2346,0,1857,
+408,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2479,
+0,22,1745,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,2011,0,1343,549,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1842,0,1541,2649,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1455,0,2085,1367,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1561,0,454,1870,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,204,0,1050,0,2371,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1537,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1999,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,985,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,1850,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,1681,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1342,0,0,0,0,
+0,0,0,0,0,0,0,0,0,768,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1140,
+0,1024,1714,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,2234,1807,0,0,0,0,
+0,0,0,2098,0,1919,2315,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,948,1139,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1440,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,511,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,2510,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,1884,2275,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2530,337,
+0,1606,0,0,0,0,0,0,0,0,1382,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1338,0,0,0,0,0,0,0,0,1654,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,1535,0,0,0,0,0,0,0,0,825,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,114,0,0,0,0,0,0,0,0,
+391,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,1378,0,0,0,0,
+0,0,0,0,2550,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,2166,0,0,
+0,0,0,0,0,0,1068,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1339,
+0,0,0,0,0,0,0,0,758,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,1924,0,0,0,0,0,0,0,0,1478,0,0,0,
+0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1143,0,0,0,0,0,0,
+0,0,227,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1336,2466,0,301,0,0,
+0,0,0,0,0,0,1203,0,0,0,0,0,0,0,0,0,
+0,0,};
+static const uint8_t action_table[2688][7] = {
+{1,16,18,21,192,0,0,},{35,28,16,35,129,1,0,},{11,17,27,1,233,0,0,},{6,10,16,21,67,0,0,},{4,20,26,1,0,0,0,},{23,30,1,36,0,0,0,},
+{98,22,27,15,233,0,0,},{74,58,1,73,0,0,0,},{2,14,23,1,0,0,0,},{66,49,18,72,94,1,0,},{23,12,1,22,0,0,0,},{110,68,26,1,218,1,0,},
+{118,84,17,124,89,1,0,},{205,124,1,201,0,0,0,},{6,8,17,21,74,0,0,},{73,40,27,66,234,1,0,},{3,16,25,1,0,0,0,},{192,114,27,185,12,2,0,},
+{185,117,30,193,74,229,2,},{125,83,32,170,31,218,1,},{6,51,27,74,13,0,0,},{115,78,21,125,0,0,0,},{66,61,22,72,104,1,0,},{43,38,27,48,235,0,0,},
+{110,13,27,15,151,1,0,},{166,100,27,160,107,1,0,},{124,77,17,124,132,1,0,},{110,20,26,1,218,1,0,},{29,30,30,193,74,117,0,},{185,120,17,191,89,1,0,},
+{160,104,31,115,99,153,2,},{15,12,16,21,84,1,0,},{35,23,30,193,123,117,0,},{29,33,17,35,89,1,0,},{73,48,30,193,250,9,1,},{72,55,32,170,126,9,1,},
+{29,27,22,35,104,1,0,},{21,20,31,115,138,85,0,},{66,42,7,55,12,1,0,},{177,102,27,160,233,0,0,},{6,10,31,115,88,84,0,},{15,20,27,15,50,1,0,},
+{125,81,30,193,28,218,1,},{167,113,27,160,12,2,0,},{72,58,16,72,129,1,0,},{6,8,26,1,116,0,0,},{167,107,27,160,12,2,0,},{166,98,18,166,135,1,0,},
+{110,14,27,15,151,1,0,},{35,39,18,35,135,1,0,},{192,126,18,191,40,2,0,},{133,72,29,116,223,1,0,},{23,8,1,22,0,0,0,},{110,64,26,1,218,1,0,},
+{185,126,27,185,50,1,0,},{66,48,22,72,104,1,0,},{192,114,18,191,40,2,0,},{36,38,27,48,238,1,0,},{72,45,32,170,126,9,1,},{72,58,17,72,132,1,0,},
+{1,7,27,15,140,0,0,},{35,39,31,115,138,141,0,},{192,127,27,205,16,2,0,},{185,128,27,185,50,1,0,},{192,120,28,185,24,2,0,},{6,13,17,21,74,0,0,},
+{35,39,16,35,129,1,0,},{66,45,32,170,79,9,1,},{6,0,26,1,116,0,0,},{0,14,30,193,175,61,0,},{22,17,27,15,234,1,0,},{66,52,31,115,99,33,1,},
+{192,123,28,185,24,2,0,},{73,52,32,170,253,9,1,},{36,39,17,35,3,2,0,},{0,10,26,1,218,1,0,},{36,33,17,35,3,2,0,},{2,67,23,1,0,0,0,},
+{36,27,17,35,3,2,0,},{167,107,30,193,28,130,2,},{167,101,30,193,28,130,2,},{35,33,18,35,135,1,0,},{85,54,27,66,233,0,0,},{110,9,32,170,180,61,0,},
+{73,44,30,193,250,9,1,},{166,102,17,166,132,1,0,},{44,25,10,43,0,0,0,},{1,8,32,170,174,60,0,},{55,24,5,51,2,0,0,},{15,15,30,193,74,61,0,},
+{192,70,28,185,24,2,0,},{66,41,32,170,79,9,1,},{167,106,16,166,34,2,0,},{166,106,18,166,135,1,0,},{191,128,28,185,119,1,0,},{110,12,27,15,151,1,0,},
+{2,23,23,1,0,0,0,},{29,29,18,35,94,1,0,},{185,121,32,170,79,229,2,},{124,96,30,193,123,217,1,},{22,16,30,193,250,61,0,},{36,27,30,193,250,117,0,},
+{22,22,30,193,250,61,0,},{66,52,18,72,94,1,0,},{160,113,27,160,50,1,0,},{15,9,16,21,84,1,0,},{72,47,28,66,119,1,0,},{6,11,27,23,7,0,0,},
+{110,13,18,21,195,1,0,},{22,8,28,15,246,1,0,},{66,63,18,72,94,1,0,},{118,93,27,144,62,1,0,},{185,114,18,191,94,1,0,},{193,117,13,192,0,0,0,},
+{21,8,27,15,107,1,0,},{191,121,28,185,119,1,0,},{191,115,28,185,119,1,0,},{124,79,16,124,129,1,0,},{29,29,22,35,104,1,0,},{15,6,28,15,68,1,0,},
+{15,22,16,21,84,1,0,},{29,27,18,35,94,1,0,},{124,74,32,170,126,217,1,},{160,101,31,115,99,153,2,},{36,31,27,29,234,1,0,},{6,12,27,15,21,0,0,},
+{125,83,28,118,24,2,0,},{36,25,17,35,3,2,0,},{125,96,18,124,40,2,0,},{0,65,26,1,218,1,0,},{160,101,17,166,89,1,0,},{124,77,30,193,123,217,1,},
+{73,41,27,66,234,1,0,},{115,74,21,125,0,0,0,},{36,29,18,35,6,2,0,},{98,9,27,15,233,0,0,},{160,101,18,166,94,1,0,},{124,96,28,118,119,1,0,},
+{185,123,32,170,79,229,2,},{192,121,27,185,12,2,0,},{15,7,17,21,89,1,0,},{192,115,27,185,12,2,0,},{118,77,18,124,94,1,0,},{36,30,16,35,0,2,0,},
+{0,17,26,1,218,1,0,},{160,113,31,115,99,153,2,},{29,26,22,35,104,1,0,},{22,21,27,103,238,1,0,},{166,102,16,166,129,1,0,},{15,8,17,21,89,1,0,},
+{110,20,17,21,190,1,0,},{160,98,31,115,99,153,2,},{110,17,32,170,180,61,0,},{110,13,17,21,190,1,0,},{2,64,23,1,0,0,0,},{29,25,27,29,50,1,0,},
+{110,15,28,15,169,1,0,},{87,58,11,85,0,0,0,},{185,125,27,202,62,1,0,},{185,117,28,185,68,1,0,},{15,16,30,193,74,61,0,},{185,117,16,191,84,1,0,},
+{15,12,22,21,104,1,0,},{35,28,27,29,107,1,0,},{185,70,30,193,74,229,2,},{11,20,27,1,233,0,0,},{124,78,31,115,138,241,1,},{0,12,26,1,218,1,0,},
+{166,99,16,166,129,1,0,},{35,27,28,29,119,1,0,},{15,8,22,21,104,1,0,},{110,57,26,1,218,1,0,},{72,44,27,66,107,1,0,},{43,39,27,29,233,0,0,},
+{124,72,28,118,119,1,0,},{6,10,32,170,60,60,0,},{110,13,30,193,175,61,0,},{1,20,32,170,174,60,0,},{22,16,28,15,246,1,0,},{118,72,27,118,50,1,0,},
+{21,12,17,21,132,1,0,},{185,70,28,185,68,1,0,},{167,97,28,160,24,2,0,},{0,129,33,0,0,0,0,},{160,99,30,193,74,129,2,},{21,14,18,21,135,1,0,},
+{35,25,18,35,135,1,0,},{21,8,18,21,135,1,0,},{185,128,17,191,89,1,0,},{36,27,27,29,234,1,0,},{0,20,31,115,200,85,0,},{185,116,18,191,94,1,0,},
+{21,12,16,21,129,1,0,},{166,111,27,160,107,1,0,},{0,8,31,115,200,85,0,},{166,113,16,166,129,1,0,},{1,14,27,15,140,0,0,},{185,120,32,170,79,229,2,},
+{21,13,27,15,107,1,0,},{118,80,30,193,74,217,1,},{72,46,28,66,119,1,0,},{160,100,32,170,79,129,2,},{35,29,28,29,119,1,0,},{133,85,17,129,227,1,0,},
+{185,126,17,191,89,1,0,},{166,99,27,160,107,1,0,},{160,98,28,160,68,1,0,},{6,20,27,15,21,0,0,},{124,84,18,124,135,1,0,},{6,14,27,15,21,0,0,},
+{167,107,28,160,24,2,0,},{6,7,17,21,74,0,0,},{73,53,32,170,253,9,1,},{21,16,28,15,119,1,0,},{72,54,30,193,123,9,1,},{1,20,30,193,168,60,0,},
+{72,63,27,66,107,1,0,},{1,20,16,21,180,0,0,},{160,107,18,166,94,1,0,},{185,70,32,170,79,229,2,},{15,13,16,21,84,1,0,},{66,47,30,193,74,9,1,},
+{124,93,27,144,115,1,0,},{66,41,30,193,74,9,1,},{22,10,32,170,253,61,0,},{15,20,18,21,94,1,0,},{185,126,22,191,104,1,0,},{21,7,31,115,138,85,0,},
+{160,98,30,193,74,129,2,},{21,15,32,170,126,61,0,},{118,77,32,170,79,217,1,},{21,10,27,15,107,1,0,},{85,45,27,66,233,0,0,},{0,16,16,21,185,1,0,},
+{36,28,31,115,9,142,0,},{2,0,23,1,0,0,0,},{160,104,32,170,79,129,2,},{1,6,28,15,161,0,0,},{15,12,30,193,74,61,0,},{3,65,25,1,0,0,0,},
+{166,103,16,166,129,1,0,},{35,36,27,45,115,1,0,},{22,9,27,15,234,1,0,},{72,61,30,193,123,9,1,},{160,111,18,166,94,1,0,},{160,102,30,193,74,129,2,},
+{73,57,32,170,253,9,1,},{36,25,18,35,6,2,0,},{6,12,30,193,53,60,0,},{160,107,30,193,74,129,2,},{36,31,18,35,6,2,0,},{74,53,1,73,0,0,0,},
+{72,49,17,72,132,1,0,},{0,14,18,21,195,1,0,},{29,32,32,170,79,117,0,},{11,64,27,1,233,0,0,},{200,128,27,185,233,0,0,},{36,34,30,193,250,117,0,},
+{66,49,16,72,84,1,0,},{6,65,26,1,116,0,0,},{200,116,27,185,233,0,0,},{3,12,25,1,0,0,0,},{0,12,32,170,180,61,0,},{21,7,30,193,123,61,0,},
+{86,58,10,85,0,0,0,},{66,55,30,193,74,9,1,},{44,33,10,43,0,0,0,},{200,126,27,185,233,0,0,},{160,107,32,170,79,129,2,},{185,123,16,191,84,1,0,},
+{0,8,18,21,195,1,0,},{6,16,17,21,74,0,0,},{192,114,16,191,34,2,0,},{15,22,32,170,79,61,0,},{6,17,26,1,116,0,0,},{167,110,27,179,20,2,0,},
+{160,106,17,166,89,1,0,},{15,5,0,11,244,0,0,},{23,10,1,22,0,0,0,},{167,98,27,160,12,2,0,},{36,26,31,115,9,142,0,},{125,77,31,115,43,242,1,},
+{160,106,28,160,68,1,0,},{66,62,27,90,56,1,0,},{66,58,31,115,99,33,1,},{169,107,28,167,239,0,0,},{166,98,16,166,129,1,0,},{73,61,32,170,253,9,1,},
+{118,80,18,124,94,1,0,},{185,117,32,170,79,229,2,},{1,13,30,193,168,60,0,},{15,8,16,21,84,1,0,},{166,111,30,193,123,129,2,},{66,56,27,66,50,1,0,},
+{167,102,17,166,37,2,0,},{36,26,30,193,250,117,0,},{36,28,17,35,3,2,0,},{191,128,32,170,126,229,2,},{29,33,18,35,94,1,0,},{21,16,17,21,132,1,0,},
+{193,128,13,192,0,0,0,},{43,29,27,29,233,0,0,},{7,17,24,6,0,0,0,},{185,119,18,191,94,1,0,},{21,13,28,15,119,1,0,},{0,4,26,1,218,1,0,},
+{124,81,27,118,107,1,0,},{192,126,17,191,37,2,0,},{66,50,16,72,84,1,0,},{1,20,28,15,161,0,0,},{167,111,17,166,37,2,0,},{66,52,16,72,84,1,0,},
+{177,111,27,160,233,0,0,},{160,112,27,182,56,1,0,},{35,38,27,48,111,1,0,},{166,113,27,160,107,1,0,},{0,17,27,15,151,1,0,},{142,74,27,118,233,0,0,},
+{166,104,18,166,135,1,0,},{21,8,16,21,129,1,0,},{191,128,16,191,129,1,0,},{118,79,27,118,50,1,0,},{191,126,27,185,107,1,0,},{0,10,27,15,151,1,0,},
+{191,126,18,191,135,1,0,},{73,40,28,66,246,1,0,},{110,65,26,1,218,1,0,},{192,114,32,170,31,230,2,},{99,16,10,98,0,0,0,},{118,94,17,124,89,1,0,},
+{66,40,32,170,79,9,1,},{11,66,27,1,233,0,0,},{1,16,27,15,140,0,0,},{124,80,16,124,129,1,0,},{124,78,27,118,107,1,0,},{124,77,31,115,138,241,1,},
+{202,114,11,200,0,0,0,},{118,80,16,124,84,1,0,},{73,53,31,115,9,34,1,},{118,74,16,124,84,1,0,},{29,26,31,115,99,141,0,},{4,65,26,1,0,0,0,},
+{73,50,32,170,253,9,1,},{167,100,18,166,40,2,0,},{110,16,26,1,218,1,0,},{6,6,27,15,21,0,0,},{110,9,28,15,169,1,0,},{167,98,28,160,24,2,0,},
+{36,37,31,115,9,142,0,},{1,14,28,15,161,0,0,},{0,22,17,21,190,1,0,},{1,8,28,15,161,0,0,},{0,10,17,21,190,1,0,},{72,58,18,72,135,1,0,},
+{66,41,28,66,68,1,0,},{125,74,27,118,12,2,0,},{35,26,27,29,107,1,0,},{35,31,16,35,129,1,0,},{166,107,27,160,107,1,0,},{72,53,18,72,135,1,0,},
+{21,12,18,21,135,1,0,},{21,20,16,21,129,1,0,},{35,29,18,35,135,1,0,},{185,115,28,185,68,1,0,},{125,84,18,124,40,2,0,},{73,54,32,170,253,9,1,},
+{191,119,31,115,138,253,2,},{36,29,28,29,246,1,0,},{22,12,28,15,246,1,0,},{23,9,1,22,0,0,0,},{185,114,17,191,89,1,0,},{21,22,28,15,119,1,0,},
+{6,129,33,0,4,0,0,},{45,25,11,43,0,0,0,},{0,65,28,107,215,1,0,},{66,45,27,66,50,1,0,},{73,63,30,193,250,9,1,},{73,57,30,193,250,9,1,},
+{166,113,17,166,132,1,0,},{185,128,31,115,99,253,2,},{73,58,30,193,250,9,1,},{36,34,18,35,6,2,0,},{36,29,17,35,3,2,0,},{72,60,27,87,115,1,0,},
+{185,117,27,185,50,1,0,},{72,47,31,115,138,33,1,},{36,39,32,170,253,117,0,},{0,17,30,193,175,61,0,},{124,96,31,115,138,241,1,},{118,75,28,118,68,1,0,},
+{185,117,22,191,104,1,0,},{3,68,25,1,0,0,0,},{35,33,28,29,119,1,0,},{72,53,27,66,107,1,0,},{6,23,26,1,116,0,0,},{160,102,16,166,84,1,0,},
+{167,102,32,170,31,130,2,},{15,22,30,193,74,61,0,},{15,14,17,21,89,1,0,},{72,50,32,170,126,9,1,},{167,113,31,115,43,154,2,},{192,119,27,185,12,2,0,},
+{66,55,27,66,50,1,0,},{36,28,16,35,0,2,0,},{73,48,16,72,0,2,0,},{29,29,30,193,74,117,0,},{29,23,30,193,74,117,0,},{118,77,22,124,104,1,0,},
+{15,17,18,21,94,1,0,},{125,84,17,124,37,2,0,},{72,41,30,193,123,9,1,},{0,9,16,21,185,1,0,},{36,28,32,170,253,117,0,},{35,39,30,193,123,117,0,},
+{1,17,27,15,140,0,0,},{72,54,17,72,132,1,0,},{35,33,30,193,123,117,0,},{22,22,31,115,9,86,0,},{72,61,28,66,119,1,0,},{118,81,17,124,89,1,0,},
+{110,9,30,193,175,61,0,},{192,128,27,185,12,2,0,},{72,48,30,193,123,9,1,},{125,95,27,147,16,2,0,},{22,22,32,170,253,61,0,},{0,13,17,21,190,1,0,},
+{185,117,18,191,94,1,0,},{29,30,16,35,84,1,0,},{29,39,16,35,84,1,0,},{73,57,27,66,234,1,0,},{191,122,30,193,123,229,2,},{191,126,30,193,123,229,2,},
+{29,27,16,35,84,1,0,},{21,8,32,170,126,61,0,},{15,8,18,21,94,1,0,},{125,79,16,124,34,2,0,},{29,34,27,29,50,1,0,},{21,9,30,193,123,61,0,},
+{66,53,28,66,68,1,0,},{191,119,32,170,126,229,2,},{167,102,28,160,24,2,0,},{29,27,27,29,50,1,0,},{22,15,28,15,246,1,0,},{35,23,28,29,119,1,0,},
+{191,115,16,191,129,1,0,},{110,12,28,15,169,1,0,},{124,80,31,115,138,241,1,},{167,100,27,160,12,2,0,},{124,74,31,115,138,241,1,},{191,126,17,191,132,1,0,},
+{6,7,31,115,88,84,0,},{118,79,31,115,99,241,1,},{11,12,27,1,233,0,0,},{115,84,21,125,0,0,0,},{0,20,27,15,151,1,0,},{166,110,27,179,115,1,0,},
+{11,0,27,1,233,0,0,},{160,110,27,179,62,1,0,},{72,47,32,170,126,9,1,},{29,32,28,29,68,1,0,},{185,123,17,191,89,1,0,},{36,32,28,29,246,1,0,},
+{29,33,28,29,68,1,0,},{167,99,31,115,43,154,2,},{15,22,17,21,89,1,0,},{167,99,30,193,28,130,2,},{160,99,18,166,94,1,0,},{1,16,17,21,186,0,0,},
+{110,7,32,170,180,61,0,},{110,20,28,15,169,1,0,},{85,40,27,66,233,0,0,},{124,84,17,124,132,1,0,},{85,46,27,66,233,0,0,},{1,6,32,170,174,60,0,},
+{15,7,31,115,99,85,0,},{43,27,27,29,233,0,0,},{35,30,31,115,138,141,0,},{124,75,31,115,138,241,1,},{35,31,27,29,107,1,0,},{110,15,27,15,151,1,0,},
+{118,94,18,124,94,1,0,},{1,14,26,1,226,0,0,},{6,14,16,21,67,0,0,},{1,8,26,1,226,0,0,},{185,116,17,191,89,1,0,},{118,94,27,118,50,1,0,},
+{21,6,28,15,119,1,0,},{6,7,30,193,53,60,0,},{23,26,1,36,0,0,0,},{66,52,27,66,50,1,0,},{160,71,28,113,46,1,0,},{66,46,27,66,50,1,0,},
+{124,80,30,193,123,217,1,},{167,100,17,166,37,2,0,},{66,50,27,66,50,1,0,},{66,44,27,66,50,1,0,},{192,128,28,185,24,2,0,},{15,17,17,21,89,1,0,},
+{1,13,27,15,140,0,0,},{192,122,28,185,24,2,0,},{115,72,21,114,0,0,0,},{36,31,17,35,3,2,0,},{66,63,31,115,99,33,1,},{1,57,26,1,226,0,0,},
+{36,23,27,29,234,1,0,},{73,53,27,66,234,1,0,},{21,16,27,15,107,1,0,},{73,63,28,66,246,1,0,},{110,6,27,15,151,1,0,},{21,22,27,15,107,1,0,},
+{170,106,15,169,0,0,0,},{118,75,27,118,50,1,0,},{36,25,31,115,9,142,0,},{166,104,16,166,129,1,0,},{160,103,31,115,99,153,2,},{167,99,28,160,24,2,0,},
+{6,20,32,170,60,60,0,},{21,7,32,170,126,61,0,},{36,33,31,115,9,142,0,},{0,23,26,1,218,1,0,},{160,101,28,160,68,1,0,},{36,27,31,115,9,142,0,},
+{21,20,28,15,119,1,0,},{185,114,30,193,74,229,2,},{36,34,17,35,3,2,0,},{29,37,27,29,50,1,0,},{192,119,30,193,28,230,2,},{1,17,31,115,198,84,0,},
+{167,102,30,193,28,130,2,},{29,33,30,193,74,117,0,},{166,100,18,166,135,1,0,},{110,12,32,170,180,61,0,},{0,9,18,21,195,1,0,},{1,15,32,170,174,60,0,},
+{15,13,18,21,94,1,0,},{36,28,30,193,250,117,0,},{43,30,27,29,233,0,0,},{15,10,31,115,99,85,0,},{29,23,28,29,68,1,0,},{35,33,31,115,138,141,0,},
+{35,29,30,193,123,117,0,},{15,20,22,21,104,1,0,},{66,49,28,66,68,1,0,},{15,22,22,21,104,1,0,},{22,17,30,193,250,61,0,},{4,66,26,1,0,0,0,},
+{160,103,30,193,74,129,2,},{29,23,32,170,79,117,0,},{118,79,22,124,104,1,0,},{1,13,17,21,186,0,0,},{36,30,30,193,250,117,0,},{72,54,28,66,119,1,0,},
+{72,49,16,72,129,1,0,},{21,9,18,21,135,1,0,},{192,121,17,191,37,2,0,},{191,123,17,191,132,1,0,},{11,9,27,1,233,0,0,},{29,37,22,35,104,1,0,},
+{118,72,32,170,79,217,1,},{124,94,32,170,126,217,1,},{66,58,18,72,94,1,0,},{160,97,27,160,50,1,0,},{1,7,18,21,192,0,0,},{98,13,27,15,233,0,0,},
+{191,116,28,185,119,1,0,},{185,115,32,170,79,229,2,},{35,31,17,35,132,1,0,},{22,8,32,170,253,61,0,},{6,10,17,21,74,0,0,},{36,34,31,115,9,142,0,},
+{166,99,30,193,123,129,2,},{142,81,27,118,233,0,0,},{66,47,28,66,68,1,0,},{125,96,17,124,37,2,0,},{1,12,18,21,192,0,0,},{6,66,28,107,111,0,0,},
+{73,54,27,66,234,1,0,},{0,6,32,170,180,61,0,},{169,102,28,167,239,0,0,},{15,7,16,21,84,1,0,},{0,16,30,193,175,61,0,},{115,75,21,125,0,0,0,},
+{36,25,28,29,246,1,0,},{29,34,22,35,104,1,0,},{35,37,30,193,123,117,0,},{110,7,17,21,190,1,0,},{35,26,32,170,126,117,0,},{21,15,30,193,123,61,0,},
+{36,37,16,35,0,2,0,},{166,107,28,160,119,1,0,},{36,31,16,35,0,2,0,},{23,13,1,22,0,0,0,},{118,80,17,124,89,1,0,},{22,12,18,21,6,2,0,},
+{73,52,16,72,0,2,0,},{110,13,31,115,200,85,0,},{0,7,18,21,195,1,0,},{110,7,31,115,200,85,0,},{6,22,16,21,67,0,0,},{29,38,27,48,56,1,0,},
+{21,17,16,21,129,1,0,},{160,101,32,170,79,129,2,},{125,84,28,118,24,2,0,},{142,96,27,118,233,0,0,},{167,103,17,166,37,2,0,},{125,74,28,118,24,2,0,},
+{166,100,31,115,138,153,2,},{124,94,30,193,123,217,1,},{116,69,20,111,2,0,0,},{110,17,30,193,175,61,0,},{191,114,28,185,119,1,0,},{35,30,32,170,126,117,0,},
+{7,66,24,6,0,0,0,},{191,114,16,191,129,1,0,},{166,102,27,160,107,1,0,},{66,52,28,66,68,1,0,},{72,57,27,66,107,1,0,},{36,39,28,29,246,1,0,},
+{0,12,17,21,190,1,0,},{22,10,17,21,3,2,0,},{1,68,26,1,226,0,0,},{167,113,30,193,28,130,2,},{27,11,27,23,125,0,0,},{1,22,17,21,186,0,0,},
+{160,99,16,166,84,1,0,},{29,28,27,29,50,1,0,},{167,111,32,170,31,130,2,},{191,125,27,202,115,1,0,},{4,10,26,1,0,0,0,},{191,119,27,185,107,1,0,},
+{66,47,17,72,89,1,0,},{110,20,18,21,195,1,0,},{73,53,30,193,250,9,1,},{124,94,31,115,138,241,1,},{15,9,31,115,99,85,0,},{1,20,17,21,186,0,0,},
+{98,16,27,15,233,0,0,},{0,13,27,15,151,1,0,},{0,19,27,100,163,1,0,},{2,8,23,1,0,0,0,},{185,116,32,170,79,229,2,},{73,52,18,72,6,2,0,},
+{66,50,32,170,79,9,1,},{124,83,28,118,119,1,0,},{0,7,27,15,151,1,0,},{99,7,10,98,0,0,0,},{110,13,32,170,180,61,0,},{3,13,25,1,0,0,0,},
+{21,10,16,21,129,1,0,},{22,12,16,21,0,2,0,},{166,102,18,166,135,1,0,},{35,31,30,193,123,117,0,},{0,8,26,1,218,1,0,},{118,81,18,124,94,1,0,},
+{73,49,17,72,3,2,0,},{6,21,27,103,29,0,0,},{15,10,16,21,84,1,0,},{6,15,27,15,21,0,0,},{110,14,26,1,218,1,0,},{6,9,27,15,21,0,0,},
+{118,94,28,118,68,1,0,},{6,3,27,3,106,0,0,},{110,10,18,21,195,1,0,},{125,75,18,124,40,2,0,},{21,10,28,15,119,1,0,},{72,63,18,72,135,1,0,},
+{15,22,28,15,68,1,0,},{1,9,30,193,168,60,0,},{15,16,28,15,68,1,0,},{6,7,18,21,81,0,0,},{125,77,27,118,12,2,0,},{29,33,16,35,84,1,0,},
+{35,25,31,115,138,141,0,},{0,8,32,170,180,61,0,},{35,31,31,115,138,141,0,},{118,74,18,124,94,1,0,},{15,12,32,170,79,61,0,},{185,122,30,193,74,229,2,},
+{6,20,26,1,116,0,0,},{6,12,28,15,45,0,0,},{1,19,27,100,154,0,0,},{73,43,30,193,250,9,1,},{191,120,16,191,129,1,0,},{15,9,27,15,50,1,0,},
+{6,17,32,170,60,60,0,},{74,48,1,73,0,0,0,},{142,77,27,118,233,0,0,},{192,119,16,191,34,2,0,},{72,63,32,170,126,9,1,},{167,112,27,182,16,2,0,},
+{167,102,18,166,40,2,0,},{0,14,27,15,151,1,0,},{125,78,18,124,40,2,0,},{200,119,27,185,233,0,0,},{185,116,16,191,84,1,0,},{118,74,31,115,99,241,1,},
+{66,49,27,66,50,1,0,},{4,22,26,1,0,0,0,},{72,47,16,72,129,1,0,},{23,27,1,36,0,0,0,},{166,99,17,166,132,1,0,},{166,101,17,166,132,1,0,},
+{36,26,17,35,3,2,0,},{0,21,27,103,157,1,0,},{192,126,32,170,31,230,2,},{166,104,17,166,132,1,0,},{6,66,26,1,116,0,0,},{118,96,28,118,68,1,0,},
+{166,101,32,170,126,129,2,},{191,70,30,193,123,229,2,},{66,58,32,170,79,9,1,},{72,45,27,66,107,1,0,},{124,74,27,118,107,1,0,},{66,46,32,170,79,9,1,},
+{167,101,18,166,40,2,0,},{1,16,30,193,168,60,0,},{35,26,18,35,135,1,0,},{125,80,18,124,40,2,0,},{160,113,18,166,94,1,0,},{118,95,27,147,56,1,0,},
+{29,30,32,170,79,117,0,},{29,26,18,35,94,1,0,},{35,34,16,35,129,1,0,},{192,126,16,191,34,2,0,},{118,77,27,118,50,1,0,},{1,65,28,107,217,0,0,},
+{0,57,26,1,218,1,0,},{72,63,17,72,132,1,0,},{29,33,31,115,99,141,0,},{192,126,27,185,12,2,0,},{0,22,16,21,185,1,0,},{72,54,18,72,135,1,0,},
+{6,9,32,170,60,60,0,},{15,17,27,15,50,1,0,},{72,61,32,170,126,9,1,},{192,121,30,193,28,230,2,},{110,16,30,193,175,61,0,},{15,7,27,15,50,1,0,},
+{124,79,17,124,132,1,0,},{73,49,18,72,6,2,0,},{0,1,28,2,205,1,0,},{167,104,32,170,31,130,2,},{1,12,26,1,226,0,0,},{21,13,16,21,129,1,0,},
+{0,13,28,15,169,1,0,},{0,15,32,170,180,61,0,},{29,34,18,35,94,1,0,},{21,17,27,15,107,1,0,},{29,28,18,35,94,1,0,},{72,61,18,72,135,1,0,},
+{73,52,31,115,9,34,1,},{167,97,32,170,31,130,2,},{29,30,28,29,68,1,0,},{110,15,30,193,175,61,0,},{125,96,31,115,43,242,1,},{35,25,28,29,119,1,0,},
+{23,17,1,22,0,0,0,},{185,121,22,191,104,1,0,},{191,128,18,191,135,1,0,},{6,16,30,193,53,60,0,},{36,36,27,45,242,1,0,},{177,106,27,160,233,0,0,},
+{160,100,16,166,84,1,0,},{35,29,16,35,129,1,0,},{166,101,18,166,135,1,0,},{167,99,18,166,40,2,0,},{85,58,27,66,233,0,0,},{147,92,1,143,0,0,0,},
+{22,9,18,21,6,2,0,},{6,17,16,21,67,0,0,},{23,28,1,36,0,0,0,},{118,94,16,124,84,1,0,},{125,78,30,193,28,218,1,},{191,121,16,191,129,1,0,},
+{23,16,1,22,0,0,0,},{191,115,18,191,135,1,0,},{125,72,30,193,28,218,1,},{160,100,17,166,89,1,0,},{1,9,32,170,174,60,0,},{1,22,28,15,161,0,0,},
+{110,10,32,170,180,61,0,},{166,103,32,170,126,129,2,},{124,79,27,118,107,1,0,},{166,97,28,160,119,1,0,},{110,16,32,170,180,61,0,},{118,81,16,124,84,1,0,},
+{7,64,24,6,0,0,0,},{118,75,16,124,84,1,0,},{73,61,31,115,9,34,1,},{73,47,17,72,3,2,0,},{22,8,27,15,234,1,0,},{35,27,31,115,138,141,0,},
+{66,43,28,66,68,1,0,},{11,16,27,1,233,0,0,},{66,53,17,72,89,1,0,},{160,99,28,160,68,1,0,},{110,4,28,4,220,1,0,},{185,119,16,191,84,1,0,},
+{35,37,18,35,135,1,0,},{1,9,28,15,161,0,0,},{66,48,28,66,68,1,0,},{118,94,31,115,99,241,1,},{35,33,27,29,107,1,0,},{192,116,31,115,43,254,2,},
+{35,27,27,29,107,1,0,},{192,115,16,191,34,2,0,},{4,12,26,1,0,0,0,},{185,128,28,185,68,1,0,},{66,58,30,193,74,9,1,},{185,122,28,185,68,1,0,},
+{21,8,28,15,119,1,0,},{191,126,31,115,138,253,2,},{22,20,32,170,253,61,0,},{166,112,27,182,111,1,0,},{125,79,18,124,40,2,0,},{7,9,24,6,0,0,0,},
+{1,13,18,21,192,0,0,},{118,77,31,115,99,241,1,},{125,79,17,124,37,2,0,},{35,30,17,35,132,1,0,},{160,106,16,166,84,1,0,},{110,6,30,193,175,61,0,},
+{191,121,17,191,132,1,0,},{167,101,32,170,31,130,2,},{185,116,22,191,104,1,0,},{0,14,16,21,185,1,0,},{118,84,30,193,74,217,1,},{43,23,27,29,233,0,0,},
+{72,56,17,72,132,1,0,},{191,70,32,170,126,229,2,},{21,16,16,21,129,1,0,},{191,116,32,170,126,229,2,},{22,17,28,15,246,1,0,},{118,78,30,193,74,217,1,},
+{125,81,31,115,43,242,1,},{21,22,31,115,138,85,0,},{1,9,26,1,226,0,0,},{73,48,27,66,234,1,0,},{166,103,27,160,107,1,0,},{6,22,31,115,88,84,0,},
+{66,44,28,66,68,1,0,},{0,6,28,15,169,1,0,},{191,120,17,191,132,1,0,},{6,9,16,21,67,0,0,},{35,25,30,193,123,117,0,},{15,9,22,21,104,1,0,},
+{191,121,31,115,138,253,2,},{125,77,17,124,37,2,0,},{72,53,17,72,132,1,0,},{72,61,16,72,129,1,0,},{1,14,16,21,180,0,0,},{72,47,17,72,132,1,0,},
+{118,83,32,170,79,217,1,},{29,30,27,29,50,1,0,},{36,28,28,29,246,1,0,},{87,63,11,85,0,0,0,},{160,103,27,160,50,1,0,},{110,17,17,21,190,1,0,},
+{125,81,17,124,37,2,0,},{66,54,32,170,79,9,1,},{72,54,16,72,129,1,0,},{150,72,29,116,233,0,0,},{15,9,17,21,89,1,0,},{1,12,27,15,140,0,0,},
+{100,7,11,98,0,0,0,},{1,6,27,15,140,0,0,},{6,20,17,21,74,0,0,},{185,70,27,185,50,1,0,},{1,17,32,170,174,60,0,},{72,49,30,193,123,9,1,},
+{160,98,18,166,94,1,0,},{72,43,30,193,123,9,1,},{21,10,32,170,126,61,0,},{125,94,18,124,40,2,0,},{191,123,31,115,138,253,2,},{29,27,17,35,89,1,0,},
+{72,56,28,66,119,1,0,},{29,34,16,35,84,1,0,},{6,7,26,1,116,0,0,},{73,50,18,72,6,2,0,},{45,39,11,43,0,0,0,},{22,20,30,193,250,61,0,},
+{1,8,31,115,198,84,0,},{15,13,31,115,99,85,0,},{166,106,32,170,126,129,2,},{124,96,17,124,132,1,0,},{166,100,32,170,126,129,2,},{29,31,22,35,104,1,0,},
+{66,52,30,193,74,9,1,},{66,42,9,55,28,1,0,},{1,14,31,115,198,84,0,},{1,20,31,115,198,84,0,},{118,77,28,118,68,1,0,},{125,81,32,170,31,218,1,},
+{73,50,17,72,3,2,0,},{124,94,16,124,129,1,0,},{73,46,32,170,253,9,1,},{35,26,30,193,123,117,0,},{21,13,32,170,126,61,0,},{66,24,3,51,248,0,0,},
+{1,22,30,193,168,60,0,},{167,103,28,160,24,2,0,},{110,7,28,15,169,1,0,},{0,8,17,21,190,1,0,},{73,44,27,66,234,1,0,},{15,17,28,15,68,1,0,},
+{0,9,27,15,151,1,0,},{1,22,18,21,192,0,0,},{6,13,30,193,53,60,0,},{167,106,31,115,43,154,2,},{0,14,32,170,180,61,0,},{66,24,4,51,254,0,0,},
+{66,43,30,193,74,9,1,},{2,7,23,1,0,0,0,},{6,20,16,21,67,0,0,},{36,33,16,35,0,2,0,},{35,34,18,35,135,1,0,},{23,31,1,36,0,0,0,},
+{166,113,31,115,138,153,2,},{15,14,31,115,99,85,0,},{110,14,30,193,175,61,0,},{160,103,17,166,89,1,0,},{110,22,26,1,218,1,0,},{160,111,32,170,79,129,2,},
+{85,55,27,66,233,0,0,},{15,10,27,15,50,1,0,},{0,7,16,21,185,1,0,},{167,104,28,160,24,2,0,},{110,4,26,1,218,1,0,},{118,81,30,193,74,217,1,},
+{22,16,31,115,9,86,0,},{72,40,32,170,126,9,1,},{160,100,27,160,50,1,0,},{35,37,31,115,138,141,0,},{110,7,18,21,195,1,0,},{21,13,18,21,135,1,0,},
+{167,104,17,166,37,2,0,},{185,114,31,115,99,253,2,},{4,13,26,1,0,0,0,},{66,56,22,72,104,1,0,},{0,6,27,15,151,1,0,},{72,63,31,115,138,33,1,},
+{0,12,27,15,151,1,0,},{15,10,22,21,104,1,0,},{21,10,31,115,138,85,0,},{167,107,18,166,40,2,0,},{29,37,17,35,89,1,0,},{178,98,10,177,0,0,0,},
+{74,49,1,73,0,0,0,},{160,111,30,193,74,129,2,},{118,75,17,124,89,1,0,},{166,103,31,115,138,153,2,},{6,4,26,1,116,0,0,},{1,10,16,21,180,0,0,},
+{1,9,17,21,186,0,0,},{166,103,18,166,135,1,0,},{22,9,16,21,0,2,0,},{1,64,28,4,229,0,0,},{124,74,18,124,135,1,0,},{124,84,30,193,123,217,1,},
+{36,29,31,115,9,142,0,},{124,78,30,193,123,217,1,},{36,31,32,170,253,117,0,},{15,16,27,15,50,1,0,},{2,9,23,1,0,0,0,},{6,8,30,193,53,60,0,},
+{29,25,16,35,84,1,0,},{73,60,27,87,242,1,0,},{167,106,28,160,24,2,0,},{160,102,18,166,94,1,0,},{73,49,32,170,253,9,1,},{124,77,32,170,126,217,1,},
+{166,106,30,193,123,129,2,},{185,122,27,185,50,1,0,},{167,100,28,160,24,2,0,},{73,48,31,115,9,34,1,},{167,103,30,193,28,130,2,},{0,13,32,170,180,61,0,},
+{167,97,30,193,28,130,2,},{192,117,32,170,31,230,2,},{66,61,32,170,79,9,1,},{1,16,32,170,174,60,0,},{192,115,28,185,24,2,0,},{1,10,32,170,174,60,0,},
+{115,88,21,133,0,0,0,},{169,103,28,167,239,0,0,},{66,43,32,170,79,9,1,},{166,111,31,115,138,153,2,},{35,28,31,115,138,141,0,},{15,16,32,170,79,61,0,},
+{185,126,30,193,74,229,2,},{66,52,17,72,89,1,0,},{36,39,31,115,9,142,0,},{15,14,27,15,50,1,0,},{73,53,16,72,0,2,0,},{160,104,28,160,68,1,0,},
+{160,113,28,160,68,1,0,},{43,26,27,29,233,0,0,},{160,102,32,170,79,129,2,},{167,99,27,160,12,2,0,},{192,123,16,191,34,2,0,},{72,49,28,66,119,1,0,},
+{185,119,31,115,99,253,2,},{72,43,28,66,119,1,0,},{29,33,27,29,50,1,0,},{110,9,18,21,195,1,0,},{66,40,30,193,74,9,1,},{1,16,16,21,180,0,0,},
+{35,34,27,29,107,1,0,},{72,50,16,72,129,1,0,},{191,123,28,185,119,1,0,},{191,121,30,193,123,229,2,},{23,7,1,22,0,0,0,},{15,20,17,21,89,1,0,},
+{29,29,28,29,68,1,0,},{22,9,32,170,253,61,0,},{166,104,32,170,126,129,2,},{35,30,28,29,119,1,0,},{166,100,30,193,123,129,2,},{118,77,17,124,89,1,0,},
+{100,16,11,98,0,0,0,},{85,56,27,66,233,0,0,},{73,61,27,66,234,1,0,},{115,94,21,125,0,0,0,},{73,55,27,66,234,1,0,},{66,55,28,66,68,1,0,},
+{0,12,28,15,169,1,0,},{166,106,17,166,132,1,0,},{66,55,32,170,79,9,1,},{115,76,21,133,0,0,0,},{6,9,28,15,45,0,0,},{6,13,16,21,67,0,0,},
+{72,52,31,115,138,33,1,},{6,17,18,21,81,0,0,},{66,40,27,66,50,1,0,},{192,123,27,185,12,2,0,},{124,79,28,118,119,1,0,},{29,29,32,170,79,117,0,},
+{110,20,32,170,180,61,0,},{6,15,28,15,45,0,0,},{36,26,16,35,0,2,0,},{110,20,31,115,200,85,0,},{166,98,17,166,132,1,0,},{6,1,28,2,95,0,0,},
+{21,16,30,193,123,61,0,},{110,8,31,115,200,85,0,},{110,12,16,21,185,1,0,},{29,29,27,29,50,1,0,},{185,69,12,111,241,0,0,},{131,85,19,129,0,0,0,},
+{125,81,28,118,24,2,0,},{118,72,30,193,74,217,1,},{125,75,28,118,24,2,0,},{0,16,28,15,169,1,0,},{192,122,27,185,12,2,0,},{118,74,22,124,104,1,0,},
+{160,100,31,115,99,153,2,},{21,17,17,21,132,1,0,},{185,126,31,115,99,253,2,},{0,4,28,4,220,1,0,},{118,78,18,124,94,1,0,},{73,54,31,115,9,34,1,},
+{73,41,28,66,246,1,0,},{36,33,27,29,234,1,0,},{15,16,22,21,104,1,0,},{6,13,31,115,88,84,0,},{72,52,27,66,107,1,0,},{185,120,22,191,104,1,0,},
+{73,54,16,72,0,2,0,},{1,12,30,193,168,60,0,},{72,40,27,66,107,1,0,},{36,39,30,193,250,117,0,},{2,57,23,1,0,0,0,},{185,114,28,185,68,1,0,},
+{66,56,17,72,89,1,0,},{22,14,32,170,253,61,0,},{125,77,18,124,40,2,0,},{191,120,27,185,107,1,0,},{0,66,26,1,218,1,0,},{21,22,18,21,135,1,0,},
+{66,54,16,72,84,1,0,},{35,25,16,35,129,1,0,},{118,79,18,124,94,1,0,},{142,79,27,118,233,0,0,},{22,9,31,115,9,86,0,},{99,22,10,98,0,0,0,},
+{0,17,16,21,185,1,0,},{191,114,18,191,135,1,0,},{167,104,18,166,40,2,0,},{72,58,30,193,123,9,1,},{124,72,30,193,123,217,1,},{124,84,28,118,119,1,0,},
+{124,79,32,170,126,217,1,},{124,78,28,118,119,1,0,},{15,13,27,15,50,1,0,},{110,14,32,170,180,61,0,},{192,114,28,185,24,2,0,},{124,96,16,124,129,1,0,},
+{166,107,18,166,135,1,0,},{66,58,28,66,68,1,0,},{66,46,28,66,68,1,0,},{166,103,17,166,132,1,0,},{1,7,32,170,174,60,0,},{6,22,27,15,21,0,0,},
+{1,1,28,2,204,0,0,},{22,16,17,21,3,2,0,},{6,10,27,15,21,0,0,},{35,25,27,29,107,1,0,},{118,81,32,170,79,217,1,},{35,33,16,35,129,1,0,},
+{1,15,30,193,168,60,0,},{11,13,27,1,233,0,0,},{66,61,30,193,74,9,1,},{142,83,27,118,233,0,0,},{191,70,27,185,107,1,0,},{21,16,32,170,126,61,0,},
+{98,12,27,15,233,0,0,},{191,119,16,191,129,1,0,},{29,28,17,35,89,1,0,},{125,72,27,118,12,2,0,},{23,14,1,22,0,0,0,},{29,32,27,29,50,1,0,},
+{21,9,31,115,138,85,0,},{160,98,17,166,89,1,0,},{124,77,18,124,135,1,0,},{185,123,30,193,74,229,2,},{15,8,30,193,74,61,0,},{29,28,22,35,104,1,0,},
+{125,79,32,170,31,218,1,},{43,28,27,29,233,0,0,},{35,31,32,170,126,117,0,},{22,8,16,21,0,2,0,},{4,64,26,1,0,0,0,},{185,114,16,191,84,1,0,},
+{118,78,17,124,89,1,0,},{160,103,16,166,84,1,0,},{66,48,30,193,74,9,1,},{110,9,16,21,185,1,0,},{179,98,11,177,0,0,0,},{127,94,19,125,2,0,0,},
+{167,101,28,160,24,2,0,},{118,81,31,115,99,241,1,},{193,126,13,192,0,0,0,},{73,56,31,115,9,34,1,},{185,120,16,191,84,1,0,},{73,47,32,170,253,9,1,},
+{73,48,32,170,253,9,1,},{73,41,32,170,253,9,1,},{36,28,27,29,234,1,0,},{21,7,17,21,132,1,0,},{166,106,27,160,107,1,0,},{21,13,31,115,138,85,0,},
+{110,19,27,100,163,1,0,},{72,54,31,115,138,33,1,},{6,67,26,1,116,0,0,},{0,13,30,193,175,61,0,},{0,12,16,21,185,1,0,},{0,7,30,193,175,61,0,},
+{118,78,32,170,79,217,1,},{124,75,27,118,107,1,0,},{66,58,17,72,89,1,0,},{0,8,16,21,185,1,0,},{21,17,28,15,119,1,0,},{72,55,30,193,123,9,1,},
+{72,53,32,170,126,9,1,},{0,10,31,115,200,85,0,},{15,25,0,11,244,0,0,},{118,84,27,118,50,1,0,},{22,12,32,170,253,61,0,},{160,100,30,193,74,129,2,},
+{200,70,27,185,233,0,0,},{6,13,26,1,116,0,0,},{110,14,16,21,185,1,0,},{167,106,27,160,12,2,0,},{22,7,16,21,0,2,0,},{21,20,27,15,107,1,0,},
+{124,84,27,118,107,1,0,},{0,10,30,193,175,61,0,},{0,17,32,170,180,61,0,},{7,57,24,6,0,0,0,},{72,50,18,72,135,1,0,},{192,121,18,191,40,2,0,},
+{6,14,30,193,53,60,0,},{72,56,32,170,126,9,1,},{22,19,27,100,242,1,0,},{1,14,32,170,174,60,0,},{15,6,27,15,50,1,0,},{72,44,32,170,126,9,1,},
+{72,53,28,66,119,1,0,},{192,70,32,170,31,230,2,},{7,14,24,6,0,0,0,},{160,107,28,160,68,1,0,},{125,80,17,124,37,2,0,},{22,16,16,21,0,2,0,},
+{160,104,18,166,94,1,0,},{29,33,32,170,79,117,0,},{72,54,32,170,126,9,1,},{6,22,18,21,81,0,0,},{0,66,28,107,215,1,0,},{160,97,32,170,79,129,2,},
+{1,17,16,21,180,0,0,},{110,9,27,15,151,1,0,},{185,128,22,191,104,1,0,},{66,56,16,72,84,1,0,},{124,84,32,170,126,217,1,},{192,116,16,191,34,2,0,},
+{192,120,17,191,37,2,0,},{177,113,27,160,233,0,0,},{22,12,30,193,250,61,0,},{124,74,17,124,132,1,0,},{73,40,30,193,250,9,1,},{177,101,27,160,233,0,0,},
+{185,120,30,193,74,229,2,},{0,22,30,193,175,61,0,},{36,33,28,29,246,1,0,},{192,120,30,193,28,230,2,},{200,121,27,185,233,0,0,},{124,80,18,124,135,1,0,},
+{23,29,1,36,0,0,0,},{1,11,27,23,128,0,0,},{118,79,28,118,68,1,0,},{15,14,28,15,68,1,0,},{185,117,17,191,89,1,0,},{160,107,17,166,89,1,0,},
+{6,14,32,170,60,60,0,},{110,65,28,107,215,1,0,},{169,113,28,167,239,0,0,},{21,12,31,115,138,85,0,},{167,107,32,170,31,130,2,},{191,123,30,193,123,229,2,},
+{125,75,16,124,34,2,0,},{160,103,18,166,94,1,0,},{113,69,14,111,0,0,0,},{29,34,31,115,99,141,0,},{6,13,32,170,60,60,0,},{29,28,31,115,99,141,0,},
+{15,10,17,21,89,1,0,},{73,48,17,72,3,2,0,},{23,22,1,22,0,0,0,},{110,10,26,1,218,1,0,},{110,17,28,15,169,1,0,},{21,22,32,170,126,61,0,},
+{36,32,27,29,234,1,0,},{85,57,27,66,233,0,0,},{192,128,17,191,37,2,0,},{0,13,26,1,218,1,0,},{1,10,28,15,161,0,0,},{29,39,31,115,99,141,0,},
+{1,4,28,4,229,0,0,},{169,97,28,157,239,0,0,},{21,13,17,21,132,1,0,},{6,12,18,21,81,0,0,},{66,47,18,72,94,1,0,},{29,27,31,115,99,141,0,},
+{22,8,18,21,6,2,0,},{22,15,32,170,253,61,0,},{4,7,26,1,0,0,0,},{118,84,28,118,68,1,0,},{73,45,30,193,250,9,1,},{160,113,30,193,74,129,2,},
+{73,63,18,72,6,2,0,},{7,16,24,6,0,0,0,},{29,26,17,35,89,1,0,},{7,10,24,6,0,0,0,},{167,104,16,166,34,2,0,},{191,115,32,170,126,229,2,},
+{6,12,26,1,116,0,0,},{7,0,24,6,0,0,0,},{11,23,27,1,233,0,0,},{72,50,31,115,138,33,1,},{1,16,28,15,161,0,0,},{157,71,28,113,237,0,0,},
+{3,4,25,1,0,0,0,},{2,12,23,1,0,0,0,},{7,67,24,6,0,0,0,},{15,6,30,193,74,61,0,},{0,10,16,21,185,1,0,},{22,17,32,170,253,61,0,},
+{72,49,31,115,138,33,1,},{125,75,27,118,12,2,0,},{6,8,18,21,81,0,0,},{22,15,30,193,250,61,0,},{15,19,27,100,62,1,0,},{66,49,31,115,99,33,1,},
+{118,96,30,193,74,217,1,},{35,23,32,170,126,117,0,},{72,56,27,66,107,1,0,},{166,100,28,160,119,1,0,},{0,7,28,15,169,1,0,},{4,68,26,1,0,0,0,},
+{160,104,16,166,84,1,0,},{66,57,27,66,50,1,0,},{185,117,31,115,99,253,2,},{29,34,28,29,68,1,0,},{72,55,27,66,107,1,0,},{191,121,32,170,126,229,2,},
+{72,61,27,66,107,1,0,},{72,49,27,66,107,1,0,},{66,53,16,72,84,1,0,},{11,7,27,1,233,0,0,},{1,8,16,21,180,0,0,},{66,56,28,66,68,1,0,},
+{15,13,32,170,79,61,0,},{27,51,27,74,221,0,0,},{15,6,32,170,79,61,0,},{110,20,27,15,151,1,0,},{125,74,31,115,43,242,1,},{167,113,18,166,40,2,0,},
+{192,120,27,185,12,2,0,},{73,54,28,66,246,1,0,},{35,31,28,29,119,1,0,},{22,22,18,21,6,2,0,},{66,43,27,66,50,1,0,},{118,74,32,170,79,217,1,},
+{36,29,16,35,0,2,0,},{166,101,16,166,129,1,0,},{125,78,27,118,12,2,0,},{166,107,16,166,129,1,0,},{6,9,17,21,74,0,0,},{72,44,30,193,123,9,1,},
+{1,22,31,115,198,84,0,},{6,16,18,21,81,0,0,},{1,20,27,15,140,0,0,},{110,129,33,0,1,0,0,},{185,120,27,185,50,1,0,},{15,22,18,21,94,1,0,},
+{21,22,30,193,123,61,0,},{160,111,27,160,50,1,0,},{66,63,28,66,68,1,0,},{35,29,17,35,132,1,0,},{166,113,32,170,126,129,2,},{73,40,32,170,253,9,1,},
+{118,79,17,124,89,1,0,},{51,57,2,27,2,0,0,},{166,97,30,193,123,129,2,},{201,128,10,200,0,0,0,},{73,58,27,66,234,1,0,},{193,115,13,192,0,0,0,},
+{193,121,13,192,0,0,0,},{73,52,27,66,234,1,0,},{169,106,28,167,239,0,0,},{115,91,21,133,0,0,0,},{115,79,21,125,0,0,0,},{118,84,16,124,84,1,0,},
+{21,14,16,21,129,1,0,},{22,6,27,15,234,1,0,},{51,23,2,27,2,0,0,},{4,23,26,1,0,0,0,},{35,37,16,35,129,1,0,},{0,22,27,15,151,1,0,},
+{74,61,1,73,0,0,0,},{0,16,27,15,151,1,0,},{2,17,23,1,0,0,0,},{29,37,28,29,68,1,0,},{6,20,30,193,53,60,0,},{160,111,17,166,89,1,0,},
+{36,27,18,35,6,2,0,},{6,6,32,170,60,60,0,},{166,98,27,160,107,1,0,},{66,56,31,115,99,33,1,},{1,21,27,103,147,0,0,},{1,64,26,1,226,0,0,},
+{15,16,17,21,89,1,0,},{110,16,16,21,185,1,0,},{72,48,28,66,119,1,0,},{6,14,31,115,88,84,0,},{118,81,22,124,104,1,0,},{167,102,31,115,43,154,2,},
+{191,122,32,170,126,229,2,},{124,80,17,124,132,1,0,},{110,23,26,1,218,1,0,},{124,78,32,170,126,217,1,},{110,17,26,1,218,1,0,},{36,25,27,29,234,1,0,},
+{1,22,26,1,226,0,0,},{29,33,22,35,104,1,0,},{124,81,17,124,132,1,0,},{193,119,13,192,0,0,0,},{66,63,30,193,74,9,1,},{29,30,17,35,89,1,0,},
+{6,15,30,193,53,60,0,},{185,114,22,191,104,1,0,},{15,13,28,15,68,1,0,},{167,98,17,166,37,2,0,},{6,8,31,115,88,84,0,},{160,102,27,160,50,1,0,},
+{22,17,16,21,0,2,0,},{15,10,18,21,94,1,0,},{167,104,27,160,12,2,0,},{85,52,27,66,233,0,0,},{166,98,28,160,119,1,0,},{125,96,30,193,28,218,1,},
+{3,20,25,1,0,0,0,},{125,80,16,124,34,2,0,},{110,16,31,115,200,85,0,},{21,7,27,15,107,1,0,},{192,117,18,191,40,2,0,},{110,8,28,15,169,1,0,},
+{192,123,18,191,40,2,0,},{185,115,30,193,74,229,2,},{160,103,28,160,68,1,0,},{0,67,26,1,218,1,0,},{124,78,16,124,129,1,0,},{35,27,30,193,123,117,0,},
+{72,41,28,66,119,1,0,},{1,10,27,15,140,0,0,},{66,49,17,72,89,1,0,},{107,3,27,3,233,0,0,},{73,47,28,66,246,1,0,},{36,39,27,29,234,1,0,},
+{85,62,27,90,235,0,0,},{0,0,26,1,218,1,0,},{21,17,18,21,135,1,0,},{192,119,32,170,31,230,2,},{169,99,28,167,239,0,0,},{22,14,27,15,234,1,0,},
+{21,12,27,15,107,1,0,},{110,8,17,21,190,1,0,},{36,30,32,170,253,117,0,},{22,15,27,15,234,1,0,},{66,61,28,66,68,1,0,},{36,30,17,35,3,2,0,},
+{15,17,30,193,74,61,0,},{21,8,30,193,123,61,0,},{167,104,30,193,28,130,2,},{167,98,30,193,28,130,2,},{1,22,32,170,174,60,0,},{118,83,30,193,74,217,1,},
+{110,6,32,170,180,61,0,},{72,63,28,66,119,1,0,},{15,12,27,15,50,1,0,},{29,32,30,193,74,117,0,},{36,26,32,170,253,117,0,},{72,50,27,66,107,1,0,},
+{29,25,28,29,68,1,0,},{72,45,28,66,119,1,0,},{35,29,31,115,138,141,0,},{192,128,18,191,40,2,0,},{0,16,26,1,218,1,0,},{170,99,15,169,0,0,0,},
+{110,7,16,21,185,1,0,},{6,16,16,21,67,0,0,},{0,20,18,21,195,1,0,},{1,12,16,21,180,0,0,},{166,111,18,166,135,1,0,},{160,104,27,160,50,1,0,},
+{15,17,16,21,84,1,0,},{160,102,28,160,68,1,0,},{22,13,30,193,250,61,0,},{185,123,18,191,94,1,0,},{160,99,27,160,50,1,0,},{167,102,16,166,34,2,0,},
+{166,99,31,115,138,153,2,},{35,28,17,35,132,1,0,},{127,81,19,125,2,0,0,},{73,63,31,115,9,34,1,},{192,114,30,193,28,230,2,},{1,9,18,21,192,0,0,},
+{35,27,18,35,135,1,0,},{35,39,17,35,132,1,0,},{124,94,17,124,132,1,0,},{22,16,32,170,253,61,0,},{166,113,30,193,123,129,2,},{35,27,17,35,132,1,0,},
+{29,25,17,35,89,1,0,},{66,49,22,72,104,1,0,},{0,2,28,7,208,1,0,},{1,16,26,1,226,0,0,},{124,75,16,124,129,1,0,},{0,20,32,170,180,61,0,},
+{22,17,18,21,6,2,0,},{192,126,31,115,43,254,2,},{125,80,28,118,24,2,0,},{169,104,28,167,239,0,0,},{167,100,31,115,43,154,2,},{191,70,28,185,119,1,0,},
+{73,50,28,66,246,1,0,},{185,123,22,191,104,1,0,},{98,6,27,15,233,0,0,},{6,22,32,170,60,60,0,},{72,56,30,193,123,9,1,},{125,75,30,193,28,218,1,},
+{22,20,16,21,0,2,0,},{35,25,32,170,126,117,0,},{36,39,16,35,0,2,0,},{6,20,28,15,45,0,0,},{142,75,27,118,233,0,0,},{192,116,28,185,24,2,0,},
+{15,9,30,193,74,61,0,},{167,113,28,160,24,2,0,},{3,0,25,1,0,0,0,},{6,2,28,7,100,0,0,},{15,14,22,21,104,1,0,},{110,9,31,115,200,85,0,},
+{125,94,28,118,24,2,0,},{142,80,27,118,233,0,0,},{110,10,17,21,190,1,0,},{66,53,31,115,99,33,1,},{66,57,32,170,79,9,1,},{110,8,32,170,180,61,0,},
+{36,30,18,35,6,2,0,},{15,7,30,193,74,61,0,},{124,94,18,124,135,1,0,},{185,128,16,191,84,1,0,},{21,20,18,21,135,1,0,},{73,56,28,66,246,1,0,},
+{66,48,17,72,89,1,0,},{124,81,31,115,138,241,1,},{185,121,31,115,99,253,2,},{15,16,18,21,94,1,0,},{29,29,16,35,84,1,0,},{15,17,22,21,104,1,0,},
+{35,27,16,35,129,1,0,},{73,49,31,115,9,34,1,},{192,122,32,170,31,230,2,},{0,7,26,1,218,1,0,},{160,101,16,166,84,1,0,},{72,41,27,66,107,1,0,},
+{29,31,27,29,50,1,0,},{110,64,28,4,220,1,0,},{66,63,17,72,89,1,0,},{125,96,16,124,34,2,0,},{73,46,30,193,250,9,1,},{110,12,26,1,218,1,0,},
+{191,121,27,185,107,1,0,},{1,15,28,15,161,0,0,},{191,115,27,185,107,1,0,},{166,101,27,160,107,1,0,},{35,30,16,35,129,1,0,},{110,0,26,1,218,1,0,},
+{22,13,17,21,3,2,0,},{2,22,23,1,0,0,0,},{48,35,1,44,0,0,0,},{2,16,23,1,0,0,0,},{193,116,13,192,0,0,0,},{73,47,27,66,234,1,0,},
+{115,86,21,133,0,0,0,},{0,17,18,21,195,1,0,},{6,7,28,15,45,0,0,},{66,50,31,115,99,33,1,},{115,80,21,125,0,0,0,},{118,77,30,193,74,217,1,},
+{6,7,16,21,67,0,0,},{22,7,18,21,6,2,0,},{191,121,18,191,135,1,0,},{0,12,31,115,200,85,0,},{166,104,30,193,123,129,2,},{66,58,22,72,104,1,0,},
+{192,117,27,185,12,2,0,},{22,13,32,170,253,61,0,},{124,74,28,118,119,1,0,},{167,97,27,160,12,2,0,},{6,17,27,15,21,0,0,},{15,21,27,103,56,1,0,},
+{36,37,28,29,246,1,0,},{15,7,18,21,94,1,0,},{110,12,17,21,190,1,0,},{185,116,31,115,99,253,2,},{142,72,27,118,233,0,0,},{185,115,27,185,50,1,0,},
+{127,84,19,125,2,0,0,},{191,120,32,170,126,229,2,},{66,56,30,193,74,9,1,},{1,2,28,7,208,0,0,},{72,54,27,66,107,1,0,},{160,106,27,160,50,1,0,},
+{21,12,32,170,126,61,0,},{21,14,27,15,107,1,0,},{21,16,31,115,138,85,0,},{1,129,33,0,2,0,0,},{73,50,31,115,9,34,1,},{72,50,17,72,132,1,0,},
+{125,93,27,144,20,2,0,},{110,16,18,21,195,1,0,},{22,10,18,21,6,2,0,},{191,116,16,191,129,1,0,},{0,16,31,115,200,85,0,},{160,113,32,170,79,129,2,},
+{29,28,28,29,68,1,0,},{66,53,32,170,79,9,1,},{192,115,18,191,40,2,0,},{110,22,16,21,185,1,0,},{66,47,32,170,79,9,1,},{35,26,31,115,138,141,0,},
+{72,49,18,72,135,1,0,},{191,114,31,115,138,253,2,},{167,103,27,160,12,2,0,},{185,121,28,185,68,1,0,},{22,14,30,193,250,61,0,},{73,63,16,72,0,2,0,},
+{1,9,31,115,198,84,0,},{4,0,26,1,0,0,0,},{73,53,28,66,246,1,0,},{36,28,18,35,6,2,0,},{167,111,16,166,34,2,0,},{167,111,18,166,40,2,0,},
+{22,8,30,193,250,61,0,},{21,8,17,21,132,1,0,},{4,4,28,4,233,0,0,},{185,126,16,191,84,1,0,},{0,20,30,193,175,61,0,},{124,94,27,118,107,1,0,},
+{6,68,26,1,116,0,0,},{0,9,32,170,180,61,0,},{36,27,28,29,246,1,0,},{193,114,13,192,0,0,0,},{124,80,27,118,107,1,0,},{0,8,28,15,169,1,0,},
+{0,6,30,193,175,61,0,},{0,10,32,170,180,61,0,},{22,13,31,115,9,86,0,},{167,101,16,166,34,2,0,},{22,13,18,21,6,2,0,},{166,111,17,166,132,1,0,},
+{124,79,30,193,123,217,1,},{1,12,17,21,186,0,0,},{192,120,32,170,31,230,2,},{118,74,17,124,89,1,0,},{21,6,27,15,107,1,0,},{6,14,26,1,116,0,0,},
+{22,14,16,21,0,2,0,},{35,28,28,29,119,1,0,},{167,101,27,160,12,2,0,},{22,7,28,15,246,1,0,},{15,7,32,170,79,61,0,},{36,30,31,115,9,142,0,},
+{125,80,31,115,43,242,1,},{118,74,30,193,74,217,1,},{22,17,31,115,9,86,0,},{192,120,18,191,40,2,0,},{1,14,30,193,168,60,0,},{114,69,20,111,0,0,0,},
+{125,96,28,118,24,2,0,},{110,17,31,115,200,85,0,},{6,22,17,21,74,0,0,},{142,78,27,118,233,0,0,},{118,78,27,118,50,1,0,},{110,20,16,21,185,1,0,},
+{6,14,28,15,45,0,0,},{29,29,31,115,99,141,0,},{36,23,30,193,250,117,0,},{6,12,16,21,67,0,0,},{125,79,30,193,28,218,1,},{29,30,18,35,94,1,0,},
+{118,94,30,193,74,217,1,},{72,62,27,90,111,1,0,},{110,8,26,1,218,1,0,},{166,106,28,160,119,1,0,},{2,66,23,1,0,0,0,},{72,50,28,66,119,1,0,},
+{72,44,28,66,119,1,0,},{185,120,28,185,68,1,0,},{15,17,32,170,79,61,0,},{185,115,22,191,104,1,0,},{22,7,31,115,9,86,0,},{118,79,30,193,74,217,1,},
+{66,54,18,72,94,1,0,},{160,102,31,115,99,153,2,},{192,117,17,191,37,2,0,},{36,30,28,29,246,1,0,},{3,64,25,1,0,0,0,},{0,16,18,21,195,1,0,},
+{191,123,27,185,107,1,0,},{29,37,31,115,99,141,0,},{167,111,31,115,43,154,2,},{86,47,10,85,0,0,0,},{125,81,18,124,40,2,0,},{36,37,18,35,6,2,0,},
+{29,39,17,35,89,1,0,},{191,123,18,191,135,1,0,},{21,20,17,21,132,1,0,},{6,17,30,193,53,60,0,},{110,66,28,107,215,1,0,},{167,104,31,115,43,154,2,},
+{110,16,17,21,190,1,0,},{66,58,27,66,50,1,0,},{72,52,18,72,135,1,0,},{23,39,1,36,0,0,0,},{124,77,16,124,129,1,0,},{66,53,27,66,50,1,0,},
+{133,90,29,152,230,1,0,},{73,61,17,72,3,2,0,},{118,75,18,124,94,1,0,},{125,80,27,118,12,2,0,},{125,77,32,170,31,218,1,},{125,84,31,115,43,242,1,},
+{36,31,31,115,9,142,0,},{192,128,31,115,43,254,2,},{192,125,27,202,20,2,0,},{22,9,17,21,3,2,0,},{110,22,30,193,175,61,0,},{29,37,30,193,74,117,0,},
+{1,17,28,15,161,0,0,},{6,12,32,170,60,60,0,},{192,123,17,191,37,2,0,},{22,8,17,21,3,2,0,},{73,58,17,72,3,2,0,},{1,8,30,193,168,60,0,},
+{6,13,18,21,81,0,0,},{35,29,27,29,107,1,0,},{72,48,31,115,138,33,1,},{73,63,32,170,253,9,1,},{166,107,31,115,138,153,2,},{124,96,32,170,126,217,1,},
+{66,61,18,72,94,1,0,},{110,9,26,1,218,1,0,},{73,45,32,170,253,9,1,},{191,128,31,115,138,253,2,},{110,8,16,21,185,1,0,},{185,119,27,185,50,1,0,},
+{191,116,31,115,138,253,2,},{0,9,31,115,200,85,0,},{160,101,30,193,74,129,2,},{118,94,22,124,104,1,0,},{191,117,18,191,135,1,0,},{191,123,16,191,129,1,0,},
+{22,9,28,15,246,1,0,},{73,55,28,66,246,1,0,},{73,49,28,66,246,1,0,},{73,61,28,66,246,1,0,},{36,29,27,29,234,1,0,},{3,8,25,1,0,0,0,},
+{160,107,31,115,99,153,2,},{125,83,30,193,28,218,1,},{87,47,11,85,0,0,0,},{72,52,17,72,132,1,0,},{110,12,31,115,200,85,0,},{72,56,31,115,138,33,1,},
+{1,65,26,1,226,0,0,},{0,8,30,193,175,61,0,},{6,9,18,21,81,0,0,},{192,128,30,193,28,230,2,},{0,20,28,15,169,1,0,},{192,122,30,193,28,230,2,},
+{2,68,23,1,0,0,0,},{192,116,30,193,28,230,2,},{3,67,25,1,0,0,0,},{35,37,27,29,107,1,0,},{191,114,17,191,132,1,0,},{72,61,17,72,132,1,0,},
+{15,9,18,21,94,1,0,},{167,99,32,170,31,130,2,},{110,12,30,193,175,61,0,},{110,51,27,74,145,1,0,},{118,78,22,124,104,1,0,},{36,37,27,29,234,1,0,},
+{29,31,28,29,68,1,0,},{29,26,32,170,79,117,0,},{200,122,27,185,233,0,0,},{29,26,30,193,74,117,0,},{6,6,28,15,45,0,0,},{124,78,18,124,135,1,0,},
+{110,21,27,103,157,1,0,},{0,68,26,1,218,1,0,},{1,12,31,115,198,84,0,},{72,57,32,170,126,9,1,},{29,26,27,29,50,1,0,},{0,10,18,21,195,1,0,},
+{35,30,30,193,123,117,0,},{21,17,32,170,126,61,0,},{98,8,27,15,233,0,0,},{72,63,30,193,123,9,1,},{72,50,30,193,123,9,1,},{72,57,30,193,123,9,1,},
+{66,41,27,66,50,1,0,},{35,25,17,35,132,1,0,},{72,45,30,193,123,9,1,},{185,126,18,191,94,1,0,},{0,16,17,21,190,1,0,},{185,127,27,205,56,1,0,},
+{185,120,18,191,94,1,0,},{185,121,27,185,50,1,0,},{1,17,30,193,168,60,0,},{125,75,17,124,37,2,0,},{160,106,18,166,94,1,0,},{125,77,16,124,34,2,0,},
+{125,78,17,124,37,2,0,},{66,44,30,193,74,9,1,},{0,9,17,21,190,1,0,},{125,79,27,118,12,2,0,},{29,27,30,193,74,117,0,},{166,102,32,170,126,129,2,},
+{11,57,27,1,233,0,0,},{22,14,28,15,246,1,0,},{21,22,16,21,129,1,0,},{192,123,31,115,43,254,2,},{85,43,27,66,233,0,0,},{160,99,17,166,89,1,0,},
+{191,120,18,191,135,1,0,},{1,7,17,21,186,0,0,},{185,116,30,193,74,229,2,},{133,76,17,150,227,1,0,},{4,14,26,1,0,0,0,},{110,14,18,21,195,1,0,},
+{167,103,32,170,31,130,2,},{1,9,16,21,180,0,0,},{110,8,18,21,195,1,0,},{1,22,16,21,180,0,0,},{98,20,27,15,233,0,0,},{177,99,27,160,233,0,0,},
+{74,56,1,73,0,0,0,},{22,10,30,193,250,61,0,},{191,122,28,185,119,1,0,},{15,20,16,21,84,1,0,},{110,66,26,1,218,1,0,},{160,107,27,160,50,1,0,},
+{144,96,11,142,0,0,0,},{36,33,32,170,253,117,0,},{3,14,25,1,0,0,0,},{110,14,17,21,190,1,0,},{1,14,18,21,192,0,0,},{85,49,27,66,233,0,0,},
+{124,80,32,170,126,217,1,},{15,22,31,115,99,85,0,},{118,80,32,170,79,217,1,},{35,39,32,170,126,117,0,},{125,77,30,193,28,218,1,},{35,33,32,170,126,117,0,},
+{124,75,17,124,132,1,0,},{35,27,32,170,126,117,0,},{166,104,28,160,119,1,0,},{3,57,25,1,0,0,0,},{1,23,26,1,226,0,0,},{11,22,27,1,233,0,0,},
+{22,20,27,15,234,1,0,},{185,128,32,170,79,229,2,},{72,56,16,72,129,1,0,},{2,4,23,1,0,0,0,},{22,12,27,15,234,1,0,},{29,25,22,35,104,1,0,},
+{2,10,23,1,0,0,0,},{167,106,17,166,37,2,0,},{124,83,30,193,123,217,1,},{66,42,6,55,4,1,0,},{73,57,28,66,246,1,0,},{21,14,32,170,126,61,0,},
+{29,11,27,23,42,1,0,},{36,39,18,35,6,2,0,},{98,7,27,15,233,0,0,},{6,9,31,115,88,84,0,},{15,22,27,15,50,1,0,},{127,80,19,125,2,0,0,},
+{6,13,28,15,45,0,0,},{22,17,17,21,3,2,0,},{110,3,27,3,212,1,0,},{166,100,16,166,129,1,0,},{110,17,27,15,151,1,0,},{192,119,28,185,24,2,0,},
+{15,10,28,15,68,1,0,},{115,89,21,133,0,0,0,},{35,31,18,35,135,1,0,},{21,19,27,100,115,1,0,},{73,62,27,90,238,1,0,},{22,16,18,21,6,2,0,},
+{1,8,27,15,140,0,0,},{85,48,27,66,233,0,0,},{115,77,21,125,0,0,0,},{169,98,28,167,239,0,0,},{124,74,30,193,123,217,1,},{143,74,10,142,0,0,0,},
+{73,43,28,66,246,1,0,},{6,22,28,15,45,0,0,},{124,96,18,124,135,1,0,},{21,20,32,170,126,61,0,},{36,27,32,170,253,117,0,},{6,8,28,15,45,0,0,},
+{0,14,26,1,218,1,0,},{36,37,17,35,3,2,0,},{110,13,16,21,185,1,0,},{118,84,22,124,104,1,0,},{3,17,25,1,0,0,0,},{6,6,30,193,53,60,0,},
+{160,111,16,166,84,1,0,},{66,49,30,193,74,9,1,},{1,66,28,107,217,0,0,},{35,32,30,193,123,117,0,},{66,63,32,170,79,9,1,},{125,80,30,193,28,218,1,},
+{1,12,32,170,174,60,0,},{73,54,30,193,250,9,1,},{125,74,30,193,28,218,1,},{29,26,28,29,68,1,0,},{15,13,30,193,74,61,0,},{178,113,10,177,0,0,0,},
+{2,20,23,1,0,0,0,},{1,20,26,1,226,0,0,},{191,126,16,191,129,1,0,},{185,115,31,115,99,253,2,},{15,15,27,15,50,1,0,},{36,31,30,193,250,117,0,},
+{185,119,32,170,79,229,2,},{1,10,17,21,186,0,0,},{6,12,31,115,88,84,0,},{66,56,32,170,79,9,1,},{72,57,28,66,119,1,0,},{22,10,27,15,234,1,0,},
+{72,52,16,72,129,1,0,},{22,16,27,15,234,1,0,},{167,103,16,166,34,2,0,},{110,17,18,21,195,1,0,},{66,44,32,170,79,9,1,},{73,56,18,72,6,2,0,},
+{110,12,18,21,195,1,0,},{124,94,28,118,119,1,0,},{98,17,27,15,233,0,0,},{1,10,18,21,192,0,0,},{0,8,27,15,151,1,0,},{191,119,28,185,119,1,0,},
+{1,14,17,21,186,0,0,},{35,34,17,35,132,1,0,},{1,8,17,21,186,0,0,},{167,106,18,166,40,2,0,},{1,7,26,1,226,0,0,},{166,102,30,193,123,129,2,},
+{73,61,30,193,250,9,1,},{36,34,27,29,234,1,0,},{1,13,26,1,226,0,0,},{73,63,27,66,234,1,0,},{115,96,21,125,0,0,0,},{191,119,17,191,132,1,0,},
+{191,117,17,191,132,1,0,},{15,13,22,21,104,1,0,},{191,116,30,193,123,229,2,},{193,123,13,192,0,0,0,},{118,77,16,124,84,1,0,},{35,33,17,35,132,1,0,},
+{66,48,18,72,94,1,0,},{21,7,28,15,119,1,0,},{167,103,18,166,40,2,0,},{185,128,18,191,94,1,0,},{22,9,30,193,250,61,0,},{166,99,32,170,126,129,2,},
+{36,32,32,170,253,117,0,},{36,34,16,35,0,2,0,},{6,12,17,21,74,0,0,},{192,120,16,191,34,2,0,},{167,99,17,166,37,2,0,},{23,34,1,36,0,0,0,},
+{6,8,32,170,60,60,0,},{15,13,17,21,89,1,0,},{110,10,31,115,200,85,0,},{15,10,32,170,79,61,0,},{73,49,16,72,0,2,0,},{66,61,16,72,84,1,0,},
+{66,53,30,193,74,9,1,},{66,54,31,115,99,33,1,},{6,65,28,107,111,0,0,},{35,30,18,35,135,1,0,},{125,77,28,118,24,2,0,},{66,48,16,72,84,1,0,},
+{36,23,28,29,246,1,0,},{21,14,17,21,132,1,0,},{166,113,28,160,119,1,0,},{0,13,18,21,195,1,0,},{124,83,32,170,126,217,1,},{36,33,30,193,250,117,0,},
+{73,43,32,170,253,9,1,},{22,13,28,15,246,1,0,},{185,119,17,191,89,1,0,},{1,17,26,1,226,0,0,},{73,53,17,72,3,2,0,},{21,8,31,115,138,85,0,},
+{73,55,32,170,253,9,1,},{72,48,27,66,107,1,0,},{73,49,27,66,234,1,0,},{22,14,18,21,6,2,0,},{6,57,26,1,116,0,0,},{192,121,28,185,24,2,0,},
+{118,75,22,124,104,1,0,},{22,10,28,15,246,1,0,},{191,128,27,185,107,1,0,},{15,16,31,115,99,85,0,},{191,122,27,185,107,1,0,},{124,84,16,124,129,1,0,},
+{191,116,27,185,107,1,0,},{125,84,16,124,34,2,0,},{72,53,30,193,123,9,1,},{21,16,18,21,135,1,0,},{72,48,16,72,129,1,0,},{1,17,17,21,186,0,0,},
+{98,14,27,15,233,0,0,},{166,102,31,115,138,153,2,},{191,120,31,115,138,253,2,},{11,8,27,1,233,0,0,},{167,101,31,115,43,154,2,},{74,47,1,73,0,0,0,},
+{7,8,24,6,0,0,0,},{22,20,31,115,9,86,0,},{124,80,28,118,119,1,0,},{36,25,16,35,0,2,0,},{21,10,18,21,135,1,0,},{125,94,30,193,28,218,1,},
+{118,96,18,124,94,1,0,},{86,63,10,85,0,0,0,},{118,69,20,111,241,0,0,},{35,32,32,170,126,117,0,},{118,84,18,124,94,1,0,},{110,7,27,15,151,1,0,},
+{133,87,29,131,230,1,0,},{125,80,32,170,31,218,1,},{21,14,30,193,123,61,0,},{124,72,32,170,126,217,1,},{125,74,32,170,31,218,1,},{22,6,30,193,250,61,0,},
+{72,58,32,170,126,9,1,},{7,68,24,6,0,0,0,},{73,45,28,66,246,1,0,},{1,10,26,1,226,0,0,},{11,10,27,1,233,0,0,},{111,129,33,111,0,0,0,},
+{127,79,19,125,2,0,0,},{167,113,32,170,31,130,2,},{1,6,30,193,168,60,0,},{66,45,30,193,74,9,1,},{6,10,18,21,81,0,0,},{15,7,28,15,68,1,0,},
+{21,17,31,115,138,85,0,},{3,22,25,1,0,0,0,},{66,58,16,72,84,1,0,},{15,9,32,170,79,61,0,},{166,106,16,166,129,1,0,},{160,104,30,193,74,129,2,},
+{66,61,27,66,50,1,0,},{0,12,18,21,195,1,0,},{1,22,27,15,140,0,0,},{160,99,32,170,79,129,2,},{72,55,28,66,119,1,0,},{29,34,32,170,79,117,0,},
+{98,15,27,15,233,0,0,},{73,54,18,72,6,2,0,},{167,107,16,166,34,2,0,},{110,17,16,21,185,1,0,},{125,84,32,170,31,218,1,},{66,48,31,115,99,33,1,},
+{0,17,31,115,200,85,0,},{72,47,30,193,123,9,1,},{1,20,18,21,192,0,0,},{36,37,32,170,253,117,0,},{66,53,22,72,104,1,0,},{185,122,32,170,79,229,2,},
+{72,53,31,115,138,33,1,},{185,123,27,185,50,1,0,},{191,127,27,205,111,1,0,},{66,48,32,170,79,9,1,},{35,32,27,29,107,1,0,},{21,9,17,21,132,1,0,},
+{185,123,28,185,68,1,0,},{124,81,16,124,129,1,0,},{100,22,11,98,0,0,0,},{192,123,32,170,31,230,2,},{0,15,30,193,175,61,0,},{200,120,27,185,233,0,0,},
+{200,114,27,185,233,0,0,},{124,83,27,118,107,1,0,},{192,116,17,191,37,2,0,},{124,77,27,118,107,1,0,},{72,47,27,66,107,1,0,},{66,49,32,170,79,9,1,},
+{185,119,30,193,74,229,2,},{15,12,17,21,89,1,0,},{23,33,1,36,0,0,0,},{160,101,27,160,50,1,0,},{29,39,32,170,79,117,0,},{3,7,25,1,0,0,0,},
+{129,82,29,127,233,0,0,},{29,27,32,170,79,117,0,},{191,120,30,193,123,229,2,},{73,47,18,72,6,2,0,},{15,12,18,21,94,1,0,},{6,9,26,1,116,0,0,},
+{167,102,27,160,12,2,0,},{66,54,27,66,50,1,0,},{118,74,27,118,50,1,0,},{110,10,16,21,185,1,0,},{167,99,16,166,34,2,0,},{73,47,31,115,9,34,1,},
+{73,46,28,66,246,1,0,},{73,50,30,193,250,9,1,},{35,39,28,29,119,1,0,},{43,37,27,29,233,0,0,},{22,12,17,21,3,2,0,},{167,111,28,160,24,2,0,},
+{177,107,27,160,233,0,0,},{73,47,16,72,0,2,0,},{115,81,21,125,0,0,0,},{29,39,18,35,94,1,0,},{35,34,31,115,138,141,0,},{0,10,28,15,169,1,0,},
+{191,117,32,170,126,229,2,},{191,126,32,170,126,229,2,},{2,65,23,1,0,0,0,},{160,111,31,115,99,153,2,},{29,25,18,35,94,1,0,},{110,20,30,193,175,61,0,},
+{36,32,30,193,250,117,0,},{15,15,32,170,79,61,0,},{66,57,30,193,74,9,1,},{127,96,19,125,2,0,0,},{166,98,30,193,123,129,2,},{144,74,11,142,0,0,0,},
+{29,37,32,170,79,117,0,},{74,54,1,73,0,0,0,},{21,13,30,193,123,61,0,},{72,52,28,66,119,1,0,},{191,115,30,193,123,229,2,},{3,23,25,1,0,0,0,},
+{72,56,18,72,135,1,0,},{36,26,18,35,6,2,0,},{177,97,27,160,233,0,0,},{1,17,18,21,192,0,0,},{36,27,16,35,0,2,0,},{66,54,22,72,104,1,0,},
+{35,26,16,35,129,1,0,},{0,20,26,1,218,1,0,},{15,20,31,115,99,85,0,},{23,25,1,36,0,0,0,},{43,34,27,29,233,0,0,},{72,49,32,170,126,9,1,},
+{192,114,31,115,43,254,2,},{118,79,16,124,84,1,0,},{66,42,8,55,20,1,0,},{118,94,32,170,79,217,1,},{11,67,27,1,233,0,0,},{35,28,30,193,123,117,0,},
+{118,96,16,124,84,1,0,},{73,58,18,72,6,2,0,},{21,9,32,170,126,61,0,},{192,119,17,191,37,2,0,},{85,41,27,66,233,0,0,},{29,27,28,29,68,1,0,},
+{29,30,31,115,99,141,0,},{29,23,27,29,50,1,0,},{72,53,16,72,129,1,0,},{0,51,27,74,145,1,0,},{192,116,32,170,31,230,2,},{3,66,25,1,0,0,0,},
+{4,57,26,1,0,0,0,},{110,13,28,15,169,1,0,},{110,15,32,170,180,61,0,},{7,65,24,6,0,0,0,},{4,4,26,1,0,0,0,},{110,1,28,2,205,1,0,},
+{160,98,32,170,79,129,2,},{72,61,31,115,138,33,1,},{0,20,16,21,185,1,0,},{66,45,28,66,68,1,0,},{6,14,18,21,81,0,0,},{35,30,27,29,107,1,0,},
+{35,34,28,29,119,1,0,},{6,15,32,170,60,60,0,},{124,77,28,118,119,1,0,},{4,9,26,1,0,0,0,},{167,98,18,166,40,2,0,},{66,63,22,72,104,1,0,},
+{125,74,18,124,40,2,0,},{125,94,17,124,37,2,0,},{29,34,17,35,89,1,0,},{36,26,28,29,246,1,0,},{7,12,24,6,0,0,0,},{73,49,30,193,250,9,1,},
+{7,4,24,6,0,0,0,},{192,114,17,191,37,2,0,},{191,117,30,193,123,229,2,},{6,16,31,115,88,84,0,},{125,83,27,118,12,2,0,},{193,120,13,192,0,0,0,},
+{127,75,19,125,2,0,0,},{160,106,31,115,99,153,2,},{6,8,27,15,21,0,0,},{29,31,30,193,74,117,0,},{22,14,17,21,3,2,0,},{160,98,27,160,50,1,0,},
+{124,81,32,170,126,217,1,},{73,56,16,72,0,2,0,},{124,75,32,170,126,217,1,},{177,104,27,160,233,0,0,},{73,50,16,72,0,2,0,},{125,78,31,115,43,242,1,},
+{73,52,30,193,250,9,1,},{6,17,31,115,88,84,0,},{15,15,28,15,68,1,0,},{192,123,30,193,28,230,2,},{192,115,30,193,28,230,2,},{192,117,30,193,28,230,2,},
+{0,9,28,15,169,1,0,},{191,115,17,191,132,1,0,},{4,17,26,1,0,0,0,},{167,106,32,170,31,130,2,},{15,12,28,15,68,1,0,},{125,74,17,124,37,2,0,},
+{118,78,31,115,99,241,1,},{167,113,16,166,34,2,0,},{90,59,1,86,0,0,0,},{22,20,28,15,246,1,0,},{118,84,31,115,99,241,1,},{1,51,27,74,133,0,0,},
+{15,20,32,170,79,61,0,},{15,14,32,170,79,61,0,},{73,55,30,193,250,9,1,},{124,79,18,124,135,1,0,},{110,22,27,15,151,1,0,},{166,99,28,160,119,1,0,},
+{110,16,27,15,151,1,0,},{22,7,32,170,253,61,0,},{191,119,30,193,123,229,2,},{22,7,27,15,234,1,0,},{66,60,27,87,62,1,0,},{200,115,27,185,233,0,0,},
+{1,9,27,15,140,0,0,},{35,39,27,29,107,1,0,},{1,3,27,3,213,0,0,},{6,17,17,21,74,0,0,},{72,52,30,193,123,9,1,},{35,34,30,193,123,117,0,},
+{72,46,30,193,123,9,1,},{15,16,0,11,244,0,0,},{72,40,30,193,123,9,1,},{6,9,30,193,53,60,0,},{0,11,27,23,141,1,0,},{191,117,16,191,129,1,0,},
+{185,116,28,185,68,1,0,},{185,116,27,185,50,1,0,},{29,31,16,35,84,1,0,},{66,50,17,72,89,1,0,},{0,22,26,1,218,1,0,},{191,114,30,193,123,229,2,},
+{6,7,32,170,60,60,0,},{85,63,27,66,233,0,0,},{124,75,28,118,119,1,0,},{36,34,28,29,246,1,0,},{125,79,28,118,24,2,0,},{3,10,25,1,0,0,0,},
+{185,121,30,193,74,229,2,},{143,96,10,142,0,0,0,},{118,80,27,118,50,1,0,},{191,116,17,191,132,1,0,},{192,115,17,191,37,2,0,},{124,84,31,115,138,241,1,},
+{4,64,28,4,233,0,0,},{110,16,28,15,169,1,0,},{125,96,32,170,31,218,1,},{110,22,28,15,169,1,0,},{110,10,28,15,169,1,0,},{85,47,27,66,233,0,0,},
+{29,28,30,193,74,117,0,},{74,52,1,73,0,0,0,},{35,26,17,35,132,1,0,},{11,4,27,1,233,0,0,},{127,74,19,125,2,0,0,},{6,22,30,193,53,60,0,},
+{0,17,17,21,190,1,0,},{177,112,27,182,235,0,0,},{110,67,26,1,218,1,0,},{6,10,30,193,53,60,0,},{167,103,31,115,43,154,2,},{169,101,28,167,239,0,0,},
+{72,47,18,72,135,1,0,},{185,121,17,191,89,1,0,},{3,9,25,1,0,0,0,},{21,9,16,21,129,1,0,},{6,17,28,15,45,0,0,},{66,51,27,74,36,1,0,},
+{15,17,31,115,99,85,0,},{192,117,31,115,43,254,2,},{35,34,32,170,126,117,0,},{125,81,16,124,34,2,0,},{35,28,32,170,126,117,0,},{166,101,30,193,123,129,2,},
+{43,25,27,29,233,0,0,},{35,29,32,170,126,117,0,},{125,94,27,118,12,2,0,},{110,7,26,1,218,1,0,},{21,17,30,193,123,61,0,},{185,123,31,115,99,253,2,},
+{179,113,11,177,0,0,0,},{0,15,28,15,169,1,0,},{43,32,27,29,233,0,0,},{15,12,31,115,99,85,0,},{66,40,28,66,68,1,0,},{166,104,31,115,138,153,2,},
+{6,8,16,21,67,0,0,},{167,101,17,166,37,2,0,},{15,9,28,15,68,1,0,},{29,39,22,35,104,1,0,},{110,22,18,21,195,1,0,},{125,94,16,124,34,2,0,},
+{110,10,30,193,175,61,0,},{36,25,32,170,253,117,0,},{110,6,28,15,169,1,0,},{29,31,32,170,79,117,0,},{118,96,17,124,89,1,0,},{191,119,18,191,135,1,0,},
+{98,10,27,15,233,0,0,},{36,29,32,170,253,117,0,},{110,9,17,21,190,1,0,},{4,8,26,1,0,0,0,},{107,66,28,107,235,0,0,},{35,23,27,29,107,1,0,},
+{22,13,16,21,0,2,0,},{118,75,32,170,79,217,1,},{167,98,31,115,43,154,2,},{1,67,26,1,226,0,0,},{73,63,17,72,3,2,0,},{6,20,18,21,81,0,0,},
+{124,81,30,193,123,217,1,},{0,12,30,193,175,61,0,},{124,75,30,193,123,217,1,},{185,115,17,191,89,1,0,},{22,22,27,15,234,1,0,},{200,123,27,185,233,0,0,},
+{1,7,16,21,180,0,0,},{160,100,18,166,94,1,0,},{118,80,31,115,99,241,1,},{125,72,32,170,31,218,1,},{118,96,22,124,104,1,0,},{166,103,30,193,123,129,2,},
+{22,6,32,170,253,61,0,},{43,33,27,29,233,0,0,},{22,22,28,15,246,1,0,},{167,106,30,193,28,130,2,},{85,50,27,66,233,0,0,},{167,100,30,193,28,130,2,},
+{74,63,1,73,0,0,0,},{66,47,31,115,99,33,1,},{200,117,27,185,233,0,0,},{29,39,28,29,68,1,0,},{1,13,32,170,174,60,0,},{66,52,32,170,79,9,1,},
+{73,46,27,66,234,1,0,},{15,14,30,193,74,61,0,},{0,14,28,15,169,1,0,},{22,20,18,21,6,2,0,},{166,106,31,115,138,153,2,},{0,14,31,115,200,85,0,},
+{73,52,28,66,246,1,0,},{185,128,30,193,74,229,2,},{185,126,32,170,79,229,2,},{73,58,16,72,0,2,0,},{73,53,18,72,6,2,0,},{35,32,28,29,119,1,0,},
+{185,114,32,170,79,229,2,},{35,26,28,29,119,1,0,},{72,58,28,66,119,1,0,},{125,94,32,170,31,218,1,},{6,4,28,4,120,0,0,},{127,77,19,125,2,0,0,},
+{142,84,27,118,233,0,0,},{66,47,22,72,104,1,0,},{167,98,16,166,34,2,0,},{1,13,16,21,180,0,0,},{66,61,31,115,99,33,1,},{118,96,27,118,50,1,0,},
+{66,56,18,72,94,1,0,},{191,126,28,185,119,1,0,},{36,37,30,193,250,117,0,},{191,120,28,185,119,1,0,},{72,63,16,72,129,1,0,},{11,68,27,1,233,0,0,},
+{36,25,30,193,250,117,0,},{192,128,32,170,31,230,2,},{166,107,32,170,126,129,2,},{36,23,32,170,253,117,0,},{0,9,26,1,218,1,0,},{192,120,31,115,43,254,2,},
+{0,22,32,170,180,61,0,},{124,78,17,124,132,1,0,},{0,16,32,170,180,61,0,},{6,64,28,4,120,0,0,},{15,16,16,21,84,1,0,},{118,78,28,118,68,1,0,},
+{115,85,21,133,0,0,0,},{15,20,30,193,74,61,0,},{118,72,28,118,68,1,0,},{185,115,16,191,84,1,0,},{192,121,32,170,31,230,2,},{29,25,30,193,74,117,0,},
+{21,9,28,15,119,1,0,},{22,20,17,21,3,2,0,},{192,116,27,185,12,2,0,},{142,95,27,147,235,0,0,},{29,31,17,35,89,1,0,},{35,37,32,170,126,117,0,},
+{177,100,27,160,233,0,0,},{6,16,28,15,45,0,0,},{6,10,28,15,45,0,0,},{0,3,27,3,212,1,0,},{0,15,27,15,151,1,0,},{73,48,28,66,246,1,0,},
+{73,58,32,170,253,9,1,},{21,12,28,15,119,1,0,},{2,13,23,1,0,0,0,},{72,40,28,66,119,1,0,},{29,36,27,45,62,1,0,},{1,10,31,115,198,84,0,},
+{103,18,1,99,0,0,0,},{125,78,28,118,24,2,0,},{192,70,27,185,12,2,0,},{125,72,28,118,24,2,0,},{110,8,27,15,151,1,0,},{167,113,17,166,37,2,0,},
+{192,126,28,185,24,2,0,},{73,45,27,66,234,1,0,},{73,56,17,72,3,2,0,},{21,10,30,193,123,61,0,},{167,98,32,170,31,130,2,},{160,98,16,166,84,1,0,},
+{66,54,30,193,74,9,1,},{169,111,28,167,239,0,0,},{0,7,17,21,190,1,0,},{167,107,17,166,37,2,0,},{192,121,31,115,43,254,2,},{15,7,22,21,104,1,0,},
+{125,79,31,115,43,242,1,},{72,43,27,66,107,1,0,},{160,99,31,115,99,153,2,},{22,6,28,15,246,1,0,},{192,119,31,115,43,254,2,},{22,7,30,193,250,61,0,},
+{124,72,27,118,107,1,0,},{66,50,30,193,74,9,1,},{166,104,27,160,107,1,0,},{66,63,16,72,84,1,0,},{191,117,27,185,107,1,0,},{36,26,27,29,234,1,0,},
+{0,64,26,1,218,1,0,},{23,37,1,36,0,0,0,},{0,22,18,21,195,1,0,},{21,7,18,21,135,1,0,},{142,94,27,118,233,0,0,},{66,63,27,66,50,1,0,},
+{160,102,17,166,89,1,0,},{73,47,30,193,250,9,1,},{29,28,32,170,79,117,0,},{0,13,31,115,200,85,0,},{73,41,30,193,250,9,1,},{6,14,17,21,74,0,0,},
+{124,81,28,118,119,1,0,},{21,20,30,193,123,61,0,},{166,100,17,166,132,1,0,},{166,107,17,166,132,1,0,},{73,61,18,72,6,2,0,},{118,80,28,118,68,1,0,},
+{110,22,32,170,180,61,0,},{74,50,1,73,0,0,0,},{85,44,27,66,233,0,0,},{166,97,32,170,126,129,2,},{66,50,22,72,104,1,0,},{133,82,29,127,223,1,0,},
+{6,19,27,100,37,0,0,},{6,13,27,15,21,0,0,},{118,74,28,118,68,1,0,},{6,7,27,15,21,0,0,},{98,21,27,103,235,0,0,},{118,84,32,170,79,217,1,},
+{7,22,24,6,0,0,0,},{110,8,30,193,175,61,0,},{118,79,32,170,79,217,1,},{118,96,32,170,79,217,1,},{72,48,32,170,126,9,1,},{1,7,30,193,168,60,0,},
+{125,81,27,118,12,2,0,},{160,113,17,166,89,1,0,},{1,66,26,1,226,0,0,},{15,8,28,15,68,1,0,},{191,116,18,191,135,1,0,},{202,128,11,200,0,0,0,},
+{110,22,17,21,190,1,0,},{166,113,18,166,135,1,0,},{125,84,30,193,28,218,1,},{166,97,27,160,107,1,0,},{72,58,31,115,138,33,1,},{36,34,32,170,253,117,0,},
+{44,39,10,43,0,0,0,},{73,54,17,72,3,2,0,},{124,74,16,124,129,1,0,},{43,31,27,29,233,0,0,},{160,103,32,170,79,129,2,},{4,67,26,1,0,0,0,},
+{127,78,19,125,2,0,0,},{66,47,27,66,50,1,0,},{118,96,31,115,99,241,1,},{22,10,31,115,9,86,0,},{185,121,16,191,84,1,0,},{29,39,30,193,74,117,0,},
+{125,94,31,115,43,242,1,},{110,7,30,193,175,61,0,},{73,56,32,170,253,9,1,},{110,2,28,7,208,1,0,},{21,22,17,21,132,1,0,},{125,75,31,115,43,242,1,},
+{73,44,32,170,253,9,1,},{72,48,18,72,135,1,0,},{0,13,16,21,185,1,0,},{166,103,28,160,119,1,0,},{110,10,27,15,151,1,0,},{160,113,16,166,84,1,0,},
+{200,127,27,205,235,0,0,},{124,96,27,118,107,1,0,},{15,8,32,170,79,61,0,},{6,64,26,1,116,0,0,},{15,58,0,11,244,0,0,},{192,121,16,191,34,2,0,},
+{73,56,30,193,250,9,1,},{73,58,28,66,246,1,0,},{21,14,28,15,119,1,0,},{185,115,18,191,94,1,0,},{66,61,17,72,89,1,0,},{15,8,27,15,50,1,0,},
+{66,48,27,66,50,1,0,},{182,109,1,178,0,0,0,},{35,37,17,35,132,1,0,},{29,29,17,35,89,1,0,},{6,22,26,1,116,0,0,},{22,22,16,21,0,2,0,},
+{6,16,26,1,116,0,0,},{73,48,18,72,6,2,0,},{6,10,26,1,116,0,0,},{22,10,16,21,0,2,0,},{22,8,31,115,9,86,0,},{29,37,16,35,84,1,0,},
+{29,30,22,35,104,1,0,},{192,115,32,170,31,230,2,},{66,52,22,72,104,1,0,},{15,20,28,15,68,1,0,},{1,12,28,15,161,0,0,},{1,13,31,115,198,84,0,},
+{192,116,18,191,40,2,0,},{15,8,31,115,99,85,0,},{166,101,31,115,138,153,2,},{201,114,10,200,0,0,0,},{0,7,31,115,200,85,0,},{7,23,24,6,0,0,0,},
+{72,41,32,170,126,9,1,},{29,25,32,170,79,117,0,},{185,119,28,185,68,1,0,},{45,33,11,43,0,0,0,},{191,114,32,170,126,229,2,},{167,111,27,160,12,2,0,},
+{185,114,27,185,50,1,0,},{107,65,28,107,235,0,0,},{191,117,31,115,138,253,2,},{66,50,28,66,68,1,0,},{160,107,16,166,84,1,0,},{22,14,31,115,9,86,0,},
+{192,117,28,185,24,2,0,},{191,123,32,170,126,229,2,},{191,128,30,193,123,229,2,},{191,128,17,191,132,1,0,},{166,101,28,160,119,1,0,},{185,119,22,191,104,1,0,},
+{118,75,31,115,99,241,1,},{167,111,30,193,28,130,2,},{118,75,30,193,74,217,1,},{72,43,32,170,126,9,1,},{66,54,17,72,89,1,0,},{85,53,27,66,233,0,0,},
+{177,98,27,160,233,0,0,},{15,14,18,21,94,1,0,},{166,107,30,193,123,129,2,},{21,7,16,21,129,1,0,},{166,111,32,170,126,129,2,},{36,29,30,193,250,117,0,},
+{0,14,17,21,190,1,0,},{1,10,30,193,168,60,0,},{0,20,17,21,190,1,0,},{23,20,1,22,0,0,0,},{125,84,27,118,12,2,0,},{73,50,27,66,234,1,0,},
+{160,104,17,166,89,1,0,},{1,16,31,115,198,84,0,},{177,103,27,160,233,0,0,},{73,56,27,66,234,1,0,},{166,111,16,166,129,1,0,},{35,28,18,35,135,1,0,},
+{118,83,27,118,50,1,0,},{21,14,31,115,138,85,0,},{118,83,28,118,68,1,0,},{15,10,30,193,74,61,0,},{29,31,31,115,99,141,0,},{6,16,32,170,60,60,0,},
+{29,25,31,115,99,141,0,},{125,78,16,124,34,2,0,},{160,106,32,170,79,129,2,},{110,13,26,1,218,1,0,},{167,100,32,170,31,130,2,},{110,14,28,15,169,1,0,},
+{29,26,16,35,84,1,0,},{125,74,16,124,34,2,0,},{118,78,16,124,84,1,0,},{1,13,28,15,161,0,0,},{1,0,26,1,226,0,0,},{1,7,28,15,161,0,0,},
+{169,100,28,167,239,0,0,},{6,16,27,15,21,0,0,},{21,6,30,193,123,61,0,},{22,22,17,21,3,2,0,},{66,50,18,72,94,1,0,},{4,16,26,1,0,0,0,},
+{125,78,32,170,31,218,1,},{66,57,28,66,68,1,0,},{185,126,28,185,68,1,0,},{191,115,31,115,138,253,2,},{125,96,27,118,12,2,0,},{73,44,28,66,246,1,0,},
+{7,20,24,6,0,0,0,},{36,33,18,35,6,2,0,},{7,13,24,6,0,0,0,},{192,115,31,115,43,254,2,},{7,7,24,6,0,0,0,},{167,100,16,166,34,2,0,},
+{160,97,30,193,74,129,2,},{11,14,27,1,233,0,0,},{22,12,31,115,9,86,0,},{191,114,27,185,107,1,0,},{0,64,28,4,220,1,0,},{22,13,27,15,234,1,0,},
+{160,100,28,160,68,1,0,},{0,22,31,115,200,85,0,},{66,54,28,66,68,1,0,},{166,99,18,166,135,1,0,},{167,107,31,115,43,154,2,},{29,28,16,35,84,1,0,},
+{72,48,17,72,132,1,0,},{15,14,16,21,84,1,0,},{160,106,30,193,74,129,2,},{192,119,18,191,40,2,0,},{110,11,27,23,141,1,0,},{72,52,32,170,126,9,1,},
+{0,22,28,15,169,1,0,},{21,10,17,21,132,1,0,},{152,76,19,150,0,0,0,},{29,37,18,35,94,1,0,},{6,20,31,115,88,84,0,},{73,52,17,72,3,2,0,},
+{192,126,30,193,28,230,2,},{21,15,27,15,107,1,0,},{0,17,28,15,169,1,0,},{185,120,31,115,99,253,2,},{29,31,18,35,94,1,0,},{72,58,27,66,107,1,0,},
+{21,21,27,103,111,1,0,},{72,46,27,66,107,1,0,},{1,4,26,1,226,0,0,},{29,34,30,193,74,117,0,},{72,46,32,170,126,9,1,},{36,31,28,29,246,1,0,},
+{192,70,30,193,28,230,2,},{1,15,27,15,140,0,0,},{118,80,22,124,104,1,0,},{124,75,18,124,135,1,0,},{124,81,18,124,135,1,0,},{21,6,32,170,126,61,0,},
+{166,111,28,160,119,1,0,},{73,61,16,72,0,2,0,},{192,128,16,191,34,2,0,},{21,9,27,15,107,1,0,},{160,111,28,160,68,1,0,},{118,81,27,118,50,1,0,},
+{110,22,31,115,200,85,0,},{110,14,31,115,200,85,0,},{192,117,16,191,34,2,0,},{66,46,30,193,74,9,1,},{21,15,28,15,119,1,0,},{166,98,31,115,138,153,2,},
+{1,7,31,115,198,84,0,},{36,30,27,29,234,1,0,},{29,39,27,29,50,1,0,},{1,8,18,21,192,0,0,},{66,53,18,72,94,1,0,},{85,61,27,66,233,0,0,},
+{191,117,28,185,119,1,0,},{125,75,32,170,31,218,1,},{22,7,17,21,3,2,0,},{73,58,31,115,9,34,1,},{166,102,28,160,119,1,0,},{11,65,27,1,233,0,0,},
+{21,12,30,193,123,61,0,},{185,121,18,191,94,1,0,},{0,9,30,193,175,61,0,},{166,98,32,170,126,129,2,},{35,37,28,29,119,1,0,},{124,95,27,147,111,1,0,},
+{118,81,28,118,68,1,0,},{0,7,32,170,180,61,0,},{160,97,28,160,68,1,0,},{66,47,16,72,84,1,0,},{73,43,27,66,234,1,0,},{124,79,31,115,138,241,1,},
 };
 
 struct action_table_key {
@@ -3621,10 +7492,8 @@ struct action_table_key {
 static inline struct action_table_key encode_key(uint32_t target_nfa_state, uint32_t dfa_state, uint32_t dfa_symbol) {
     struct action_table_key key = {{0}};
     key.bytes[0] |= (target_nfa_state >> 0) & 255;
-    key.bytes[1] |= (target_nfa_state >> 8) & 3;
-    key.bytes[1] |= (dfa_state << 2) & 255;
-    key.bytes[2] |= (dfa_state >> 6) & 3;
-    key.bytes[2] |= (dfa_symbol << 2) & 255;
+    key.bytes[1] |= (dfa_state >> 0) & 255;
+    key.bytes[2] |= (dfa_symbol >> 0) & 63;
     return key;
 }
 struct action_table_entry {
@@ -3635,29 +7504,20 @@ struct action_table_entry {
 static struct action_table_entry decode_entry(const uint8_t *bytes) {
     struct action_table_entry entry = {0};
     entry.nfa_state |= ((uint32_t)bytes[3] & 255) << 0;
-    entry.nfa_state |= ((uint32_t)bytes[4] & 3) << 8;
-    entry.actions |= ((uint32_t)bytes[4] & 255) >> 2;
-    entry.actions |= ((uint32_t)bytes[5] & 15) << 6;
-    entry.push_nfa_state |= ((uint32_t)bytes[5] & 255) >> 4;
-    entry.push_nfa_state |= ((uint32_t)bytes[6] & 63) << 4;
+    entry.actions |= ((uint32_t)bytes[4] & 255) << 0;
+    entry.actions |= ((uint32_t)bytes[5] & 3) << 8;
+    entry.push_nfa_state |= ((uint32_t)bytes[5] & 255) >> 2;
+    entry.push_nfa_state |= ((uint32_t)bytes[6] & 3) << 6;
     return entry;
 }
 static struct action_table_entry action_table_lookup(uint32_t nfa_state, uint32_t dfa_state, uint32_t token) {
-    uint32_t hash = ((((((0xe5aa55e5 ^ (nfa_state)) * 0xe5aa55e5) ^ (dfa_state)) * 0xe5aa55e5) ^ (token)) * 0xe5aa55e5);
-    uint32_t index1 = hash & 1023;
-    uint32_t index2 = hash >> 22;
+    uint64_t packed = (uint64_t)nfa_state << 32 | (uint32_t)(dfa_state * 34 + token);
+    uint32_t hash = (uint32_t)((packed * ((uint64_t)2654435769U << 32 | 2135587861)) >> 32);
+    uint32_t displacement = action_table_displacements[(uint64_t)hash * 1344 >> 32];
+    uint32_t slot = (hash << 16 | hash >> 16) ^ displacement * 0x9e3779b9u;
+    const uint8_t *entry = action_table[(uint64_t)slot * 2688 >> 32];
     struct action_table_key key = encode_key(nfa_state, dfa_state, token);
-    uint32_t j = 0;
-    const uint8_t *entry = 0;
-    for (; j < 4; ++j) {
-        entry = action_table[index1][j];
-        if (!memcmp(key.bytes, entry, sizeof(key.bytes)))
-            break;
-        entry = action_table[index2][j];
-        if (!memcmp(key.bytes, entry, sizeof(key.bytes)))
-            break;
-    }
-    if (j >= 4)
+    if (memcmp(key.bytes, entry, sizeof(key.bytes)) != 0)
         abort();
     return decode_entry(entry);
 }
@@ -3670,72 +7530,132 @@ static void apply_actions(struct construct_state *state, uint32_t index, size_t
         construct_action_apply(state, actions[i], offset);
     }
 }
-static size_t build_parse_tree(struct owl_default_tokenizer *tokenizer, struct owl_token_run *run, struct owl_tree *tree) {
-    struct construct_state construct_state = { .info = tree };
-    uint32_t *state_stack = 0;
-    uint32_t stack_depth = 0;
-    size_t stack_capacity = 0;
-    size_t whitespace = tokenizer->whitespace;
-    size_t offset = tokenizer->offset - whitespace;
-    construct_begin(&construct_state, offset, CONSTRUCT_NORMAL_ROOT);
-    uint32_t nfa_state = 210;
-    while (run) {
-        uint16_t length_offset = run->lengths_size - 1;
-        uint16_t n = run->number_of_tokens;
-        uint16_t i;
-        for (i = n - 1; i < n; i--) {
-            size_t end = offset;
-            size_t len = 0;
-            struct action_table_entry entry = action_table_lookup(nfa_state, run->states[i], run->tokens[i]);
-            if (run->tokens[i] < 30)
-                len = decode_token_length(run, &length_offset, &offset);
-            else {
-                if (stack_depth >= stack_capacity) {
-                    size_t new_capacity = (stack_capacity + 2) * 3 / 2;
-                    if (new_capacity <= stack_capacity)
-                        abort();
-                    uint32_t *new_stack = realloc(state_stack, new_capacity * sizeof(uint32_t));
-                    if (!new_stack)
-                        abort();
-                    state_stack = new_stack;
-                    stack_capacity = new_capacity;
-                }
-                state_stack[stack_depth++] = entry.push_nfa_state;
-            }
-            apply_actions(&construct_state, entry.actions, end, end + whitespace);
-            if (run->states[i] == 69) {
-                if (stack_depth == 0)
+// Where the backward pass is between calls to build_tokens.
+struct build_state {
+    struct construct_state *construct_state;
+    uint32_t *state_stack;
+    size_t stack_depth;
+    size_t stack_capacity;
+    uint32_t nfa_state;
+    size_t offset;
+    size_t whitespace;
+    struct owl_allocator *allocator;
+};
+// Runs the backward pass over the tokens from `start` up to `end` in a run.
+// Tokens after `end` are only skipped over.  If `after_split` is set, the tree
+// was split during the last token's actions, and only the ones before the
+// split (in input order) are applied.
+static inline void build_tokens(struct build_state *b, struct owl_token_run *run, uint16_t start, uint16_t end, bool after_split) {
+    (void)after_split;
+    struct construct_state *construct_state = b->construct_state;
+    uint32_t *state_stack = b->state_stack;
+    size_t stack_depth = b->stack_depth;
+    size_t stack_capacity = b->stack_capacity;
+    uint32_t nfa_state = b->nfa_state;
+    size_t offset = b->offset;
+    size_t whitespace = b->whitespace;
+    uint16_t length_offset = run->lengths_size - 1;
+    uint16_t i;
+    for (i = run->number_of_tokens; i > end;) {
+        i--;
+        size_t token_end = offset;
+        size_t len = 0;
+        if (run->tokens[i] < 30)
+            len = decode_token_length(run, &length_offset, &offset);
+        whitespace = token_end - offset - len;
+    }
+    while (i > start) {
+        i--;
+        size_t end = offset;
+        size_t len = 0;
+        uint32_t column = run->states[i] * 34 + run->tokens[i];
+        struct action_table_entry entry;
+        if (action_table_slot_for_column[column])
+            entry = decode_entry(action_table[action_table_slot_for_column[column] - 1]);
+        else
+            entry = action_table_lookup(nfa_state, run->states[i], run->tokens[i]);
+        if (run->tokens[i] < 30)
+            len = decode_token_length(run, &length_offset, &offset);
+        else {
+            if (stack_depth >= stack_capacity) {
+                size_t new_capacity = (stack_capacity + 2) * 3 / 2;
+                if (new_capacity <= stack_capacity)
                     abort();
-                nfa_state = state_stack[--stack_depth];
-            } else
-                nfa_state = entry.nfa_state;
-            whitespace = end - offset - len;
+                uint32_t *new_stack = reallocate_memory(state_stack, stack_capacity * sizeof(uint32_t), new_capacity * sizeof(uint32_t), b->allocator);
+                if (!new_stack)
+                    abort();
+                state_stack = new_stack;
+                stack_capacity = new_capacity;
+            }
+            state_stack[stack_depth++] = entry.push_nfa_state;
         }
+        apply_actions(construct_state, entry.actions, end, end + whitespace);
+        if (run->states[i] == 69) {
+            if (stack_depth == 0)
+                abort();
+            nfa_state = state_stack[--stack_depth];
+        } else
+            nfa_state = entry.nfa_state;
+        whitespace = end - offset - len;
+    }
+    b->state_stack = state_stack;
+    b->stack_depth = stack_depth;
+    b->stack_capacity = stack_capacity;
+    b->nfa_state = nfa_state;
+    b->offset = offset;
+    b->whitespace = whitespace;
+}
+// Applies the actions before the first token.
+static void build_first_actions(struct build_state *b) {
+    struct action_table_entry entry = action_table_lookup(b->nfa_state, 129, 33);
+    apply_actions(b->construct_state, entry.actions, b->offset, b->offset + b->whitespace);
+}
+static size_t finish_building(struct owl_parser *parser, struct build_state *b) {
+    parser->state_stack = b->state_stack;
+    parser->state_stack_capacity = b->stack_capacity;
+    return construct_finish(b->construct_state, b->offset);
+}
+static size_t build_parse_tree(struct owl_parser *parser) {
+    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;
+    struct build_state b = {
+        .construct_state = &parser->construct_state,
+        .state_stack = parser->state_stack,
+        .stack_capacity = parser->state_stack_capacity,
+        .nfa_state = 110,
+        .offset = tokenizer->offset - tokenizer->whitespace,
+        .whitespace = tokenizer->whitespace,
+        .allocator = &parser->allocator,
+    };
+    parser->construct_state.info = parser->tree;
+    construct_begin(&parser->construct_state, b.offset, CONSTRUCT_NORMAL_ROOT);
+    struct owl_token_run *run = parser->token_run;
+    while (run) {
+        build_tokens(&b, run, 0, run->number_of_tokens, false);
         struct owl_token_run *old = run;
         run = run->prev;
-        free(old);
+        old->prev = tokenizer->free_runs;
+        tokenizer->free_runs = old;
     }
-    struct action_table_entry entry = action_table_lookup(nfa_state, UINT32_MAX, UINT32_MAX);
-    apply_actions(&construct_state, entry.actions, offset, offset + whitespace);
-    free(state_stack);
-    free_token_runs(&run);
-    return construct_finish(&construct_state, offset);
+    parser->token_run = 0;
+    build_first_actions(&b);
+    return finish_building(parser, &b);
 }
-static size_t read_whitespace(const char *text, void *info) {
+static size_t read_whitespace(const char *text, size_t length, void *info) {
     switch (text[0]) {
     case 32:
-        return 1;
     case 9:
-        return 1;
     case 10:
-        return 1;
     case 13:
+#ifdef OWL_SIMD
+        return vector_scan(text, 1, length, VECTOR_SCAN_WHITESPACE, 0);
+#else
         return 1;
+#endif
     default:
         return 0;
     }
 }
-static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, void *info) {
+static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *text, size_t length, void *info) {
     switch (text[0]) {
     case 35:
         *end_token = false;
@@ -3762,9 +7682,9 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
         *token = 19;
         return 1;
     case 46:
-        switch (text[1]) {
+        switch (length > 1 ? text[1] : 0) {
         case 108:
-            if (text[2] == 105 && text[3] == 110 && text[4] == 101 && text[5] == 45 && text[6] == 99 && text[7] == 111 && text[8] == 109 && text[9] == 109 && text[10] == 101 && text[11] == 110 && text[12] == 116 && text[13] == 45 && text[14] == 116 && text[15] == 111 && text[16] == 107 && text[17] == 101 && text[18] == 110) {
+            if (length >= 19 && text[2] == 105 && text[3] == 110 && text[4] == 101 && text[5] == 45 && text[6] == 99 && text[7] == 111 && text[8] == 109 && text[9] == 109 && text[10] == 101 && text[11] == 110 && text[12] == 116 && text[13] == 45 && text[14] == 116 && text[15] == 111 && text[16] == 107 && text[17] == 101 && text[18] == 110) {
                 *end_token = false;
                 *token = 23;
                 return 19;
@@ -3772,7 +7692,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
                 return 0;
             }
         case 111:
-            if (text[2] == 112 && text[3] == 101 && text[4] == 114 && text[5] == 97 && text[6] == 116 && text[7] == 111 && text[8] == 114 && text[9] == 115) {
+            if (length >= 10 && text[2] == 112 && text[3] == 101 && text[4] == 114 && text[5] == 97 && text[6] == 116 && text[7] == 111 && text[8] == 114 && text[9] == 115) {
                 *end_token = false;
                 *token = 2;
                 return 10;
@@ -3780,7 +7700,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
                 return 0;
             }
         case 116:
-            if (text[2] == 111 && text[3] == 107 && text[4] == 101 && text[5] == 110) {
+            if (length >= 6 && text[2] == 111 && text[3] == 107 && text[4] == 101 && text[5] == 110) {
                 *end_token = false;
                 *token = 25;
                 return 6;
@@ -3788,7 +7708,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
                 return 0;
             }
         case 119:
-            if (text[2] == 104 && text[3] == 105 && text[4] == 116 && text[5] == 101 && text[6] == 115 && text[7] == 112 && text[8] == 97 && text[9] == 99 && text[10] == 101) {
+            if (length >= 11 && text[2] == 104 && text[3] == 105 && text[4] == 116 && text[5] == 101 && text[6] == 115 && text[7] == 112 && text[8] == 97 && text[9] == 99 && text[10] == 101) {
                 *end_token = false;
                 *token = 26;
                 return 11;
@@ -3827,7 +7747,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
         *token = 15;
         return 1;
     case 102:
-        if (text[1] == 108 && text[2] == 97 && text[3] == 116) {
+        if (length >= 4 && text[1] == 108 && text[2] == 97 && text[3] == 116) {
             *end_token = false;
             *token = 6;
             return 4;
@@ -3835,7 +7755,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
             return 0;
         }
     case 105:
-        if (text[1] == 110 && text[2] == 102 && text[3] == 105 && text[4] == 120) {
+        if (length >= 5 && text[1] == 110 && text[2] == 102 && text[3] == 105 && text[4] == 120) {
             *end_token = false;
             *token = 5;
             return 5;
@@ -3843,9 +7763,9 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
             return 0;
         }
     case 108:
-        switch (text[1]) {
+        switch (length > 1 ? text[1] : 0) {
         case 101:
-            if (text[2] == 102 && text[3] == 116) {
+            if (length >= 4 && text[2] == 102 && text[3] == 116) {
                 *end_token = false;
                 *token = 7;
                 return 4;
@@ -3853,7 +7773,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
                 return 0;
             }
         case 105:
-            if (text[2] == 110 && text[3] == 101 && text[4] == 45 && text[5] == 99 && text[6] == 111 && text[7] == 109 && text[8] == 109 && text[9] == 101 && text[10] == 110 && text[11] == 116 && text[12] == 45 && text[13] == 116 && text[14] == 111 && text[15] == 107 && text[16] == 101 && text[17] == 110) {
+            if (length >= 18 && text[2] == 110 && text[3] == 101 && text[4] == 45 && text[5] == 99 && text[6] == 111 && text[7] == 109 && text[8] == 109 && text[9] == 101 && text[10] == 110 && text[11] == 116 && text[12] == 45 && text[13] == 116 && text[14] == 111 && text[15] == 107 && text[16] == 101 && text[17] == 110) {
                 *end_token = false;
                 *token = 24;
                 return 18;
@@ -3864,7 +7784,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
             return 0;
         }
     case 110:
-        if (text[1] == 111 && text[2] == 110 && text[3] == 97 && text[4] == 115 && text[5] == 115 && text[6] == 111 && text[7] == 99) {
+        if (length >= 8 && text[1] == 111 && text[2] == 110 && text[3] == 97 && text[4] == 115 && text[5] == 115 && text[6] == 111 && text[7] == 99) {
             *end_token = false;
             *token = 9;
             return 8;
@@ -3872,9 +7792,9 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
             return 0;
         }
     case 112:
-        switch (text[1]) {
+        switch (length > 1 ? text[1] : 0) {
         case 111:
-            if (text[2] == 115 && text[3] == 116 && text[4] == 102 && text[5] == 105 && text[6] == 120) {
+            if (length >= 7 && text[2] == 115 && text[3] == 116 && text[4] == 102 && text[5] == 105 && text[6] == 120) {
                 *end_token = false;
                 *token = 3;
                 return 7;
@@ -3882,7 +7802,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
                 return 0;
             }
         case 114:
-            if (text[2] == 101 && text[3] == 102 && text[4] == 105 && text[5] == 120) {
+            if (length >= 6 && text[2] == 101 && text[3] == 102 && text[4] == 105 && text[5] == 120) {
                 *end_token = false;
                 *token = 4;
                 return 6;
@@ -3893,7 +7813,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token, const char *t
             return 0;
         }
     case 114:
-        if (text[1] == 105 && text[2] == 103 && text[3] == 104 && text[4] == 116) {
+        if (length >= 5 && text[1] == 105 && text[2] == 103 && text[3] == 104 && text[4] == 116) {
             *end_token = false;
             *token = 8;
             return 5;
@@ -340,6 +340,8 @@ static void determinize_automaton(struct context context)
     }
 }
 
+static void find_token_classes(struct combined_grammar *grammar,
+ struct deterministic_grammar *result);
 static int compare_state_ids(const void *aa, const void *bb);
 static int compare_bracket_transitions(const void *aa, const void *bb);
 static bool equal_bracket_transitions(struct bracket_transitions *a,
@@ -618,6 +620,139 @@ void determinize(struct combined_grammar *grammar,
     }
     state_array_destroy(&worklist);
     automaton_destroy(&reversed);
+
+    find_token_classes(grammar, result);
+}
+
+// Each keyword token gets a signature listing everything the generated parser
+// does with it: the transitions it takes and the action map entries it keys.
+// Tokens with equal signatures are interchangeable.
+struct token_signature {
+    uint32_t *values;
+    uint32_t values_allocated_bytes;
+    uint32_t number_of_values;
+    symbol_id symbol;
+};
+
+static void token_signature_append(struct token_signature *signature,
+ uint32_t a, uint32_t b, uint32_t c)
+{
+    if (signature->number_of_values + 3 < signature->number_of_values)
+        abort();
+    signature->values = grow_array(signature->values,
+     &signature->values_allocated_bytes,
+     (signature->number_of_values + 3) * sizeof(uint32_t));
+    signature->values[signature->number_of_values++] = a;
+    signature->values[signature->number_of_values++] = b;
+    signature->values[signature->number_of_values++] = c;
+}
+
+static int compare_token_signatures(const void *aa, const void *bb)
+{
+    const struct token_signature *a = aa;
+    const struct token_signature *b = bb;
+    if (a->number_of_values < b->number_of_values)
+        return -1;
+    if (a->number_of_values > b->number_of_values)
+        return 1;
+    for (uint32_t i = 0; i < a->number_of_values; ++i) {
+        if (a->values[i] < b->values[i])
+            return -1;
+        if (a->values[i] > b->values[i])
+            return 1;
+    }
+    if (a->symbol < b->symbol)
+        return -1;
+    if (a->symbol > b->symbol)
+        return 1;
+    return 0;
+}
+
+static void find_token_classes(struct combined_grammar *grammar,
+ struct deterministic_grammar *result)
+{
+    uint32_t number_of_symbols = grammar->number_of_tokens;
+    struct automaton *automata[] = {
+        &result->automaton, &result->bracket_automaton,
+    };
+    for (int i = 0; i < 2; ++i) {
+        struct automaton *a = automata[i];
+        for (state_id j = 0; j < a->number_of_states; ++j) {
+            struct state s = a->states[j];
+            if (s.accepting && s.transition_symbol != SYMBOL_EPSILON &&
+             s.transition_symbol >= number_of_symbols)
+                number_of_symbols = s.transition_symbol + 1;
+            for (uint32_t k = 0; k < s.number_of_transitions; ++k) {
+                if (s.transitions[k].symbol >= number_of_symbols)
+                    number_of_symbols = s.transitions[k].symbol + 1;
+            }
+        }
+    }
+
+    uint32_t n = grammar->number_of_keyword_tokens;
+    struct token_signature *signatures =
+     calloc(n, sizeof(struct token_signature));
+    for (symbol_id i = 0; i < n; ++i)
+        signatures[i].symbol = i;
+    for (int i = 0; i < 2; ++i) {
+        struct automaton *a = automata[i];
+        for (state_id j = 0; j < a->number_of_states; ++j) {
+            struct state s = a->states[j];
+            for (uint32_t k = 0; k < s.number_of_transitions; ++k) {
+                struct transition t = s.transitions[k];
+                if (t.symbol < n)
+                    token_signature_append(&signatures[t.symbol], i, j, t.target);
+            }
+        }
+        struct action_map *map = i == 0 ? &result->action_map :
+         &result->bracket_action_map;
+        for (uint32_t j = 0; j < map->number_of_entries; ++j) {
+            struct action_map_entry e = map->entries[j];
+            if (e.dfa_symbol >= n)
+                continue;
+            // Actions were de-duplicated above, so equal actions have equal
+            // indexes.
+            struct token_signature *signature = &signatures[e.dfa_symbol];
+            token_signature_append(signature, i, e.target_nfa_state,
+             e.dfa_state);
+            token_signature_append(signature, e.nfa_state,
+             (uint32_t)(e.actions - result->actions), 0);
+        }
+    }
+    qsort(signatures, n, sizeof(struct token_signature),
+     compare_token_signatures);
+
+    // Classes are numbered in order of their first symbol, so tokens which
+    // don't share a class keep their relative order.
+    symbol_id *first_symbol_in_class = calloc(n, sizeof(symbol_id));
+    for (uint32_t i = 0; i < n; ++i) {
+        symbol_id symbol = signatures[i].symbol;
+        if (i == 0 || signatures[i].number_of_values !=
+         signatures[i - 1].number_of_values || memcmp(signatures[i].values,
+         signatures[i - 1].values,
+         signatures[i].number_of_values * sizeof(uint32_t)))
+            first_symbol_in_class[symbol] = symbol;
+        else
+            first_symbol_in_class[symbol] =
+             first_symbol_in_class[signatures[i - 1].symbol];
+    }
+    result->token_classes = calloc(number_of_symbols, sizeof(symbol_id));
+    uint32_t next_class = 0;
+    for (symbol_id i = 0; i < number_of_symbols; ++i) {
+        if (i < n && first_symbol_in_class[i] != i)
+            result->token_classes[i] =
+             result->token_classes[first_symbol_in_class[i]];
+        else
+            result->token_classes[i] = next_class++;
+        if (i + 1 == grammar->number_of_tokens)
+            result->number_of_token_classes = next_class;
+    }
+    result->number_of_symbols = number_of_symbols;
+    result->number_of_classes = next_class;
+    for (uint32_t i = 0; i < n; ++i)
+        free(signatures[i].values);
+    free(signatures);
+    free(first_symbol_in_class);
 }
 
 static void action_map_destroy(struct action_map *map)
@@ -631,6 +766,7 @@ void deterministic_grammar_destroy(struct deterministic_grammar *grammar)
     for (uint32_t i = 0; i < grammar->bracket_automaton.number_of_states; ++i)
         bitset_destroy(&grammar->bracket_reachability[i]);
     free(grammar->bracket_reachability);
+    free(grammar->token_classes);
     free(grammar->actions);
     automaton_destroy(&grammar->automaton);
     automaton_destroy(&grammar->bracket_automaton);
@@ -54,6 +54,17 @@ struct deterministic_grammar {
     // set against the expected transitions as we parse in order to know exactly
     // where the text stops being a valid prefix of the recognized language.
     struct bitset *bracket_reachability;
+
+    // Keyword tokens which behave the same way everywhere -- with the same
+    // transitions from every state and the same actions -- share a token
+    // class.  The generated parser only ever sees token classes.
+    // `token_classes` maps every symbol (tokens first, then bracket symbols)
+    // to its class.  Token classes come first, followed by one class for each
+    // bracket symbol, starting at `number_of_token_classes`.
+    symbol_id *token_classes;
+    uint32_t number_of_symbols;
+    uint32_t number_of_token_classes;
+    uint32_t number_of_classes;
 };
 
 void determinize(struct combined_grammar *grammar,
@@ -7,6 +7,7 @@
 #define READ_WHITESPACE read_whitespace
 #define READ_KEYWORD_TOKEN read_keyword_token
 #define READ_CUSTOM_TOKEN %%read-custom-token
+#define READ_NUMBER read_number
 #define NUMBER_TOKEN_DATA NUMBER_TOKEN_DATA
 #define CUSTOM_TOKEN_DATA CUSTOM_TOKEN_DATA
 #define WRITE_NUMBER_TOKEN %%write-number-token
@@ -15,11 +16,19 @@
 #define WRITE_STRING_TOKEN %%write-string-token
 #define WRITE_CUSTOM_TOKEN %%write-custom-token
 #define ALLOCATE_STRING allocate_string_contents
+#define ALLOCATE_MEMORY allocate_memory
+#define REALLOCATE_MEMORY reallocate_memory
+#define FREE_MEMORY free_memory
 #define ALLOW_DASHES_IN_IDENTIFIERS(...) %%allow-dashes-in-identifiers
+#define SKIP_IDENTIFIER_CHARS SKIP_IDENTIFIER_CHARS
+#define SKIP_DIGITS SKIP_DIGITS
+#define SKIP_STRING_CHARS SKIP_STRING_CHARS
+#define SKIP_LINE SKIP_LINE
 #define IF_NUMBER_TOKEN IF_NUMBER_TOKEN
 #define IF_STRING_TOKEN IF_STRING_TOKEN
 #define IF_IDENTIFIER_TOKEN IF_IDENTIFIER_TOKEN
 #define IF_INTEGER_TOKEN IF_INTEGER_TOKEN
+#define IF_IDENTIFIER_KEYWORDS IF_IDENTIFIER_KEYWORDS
 #define ESCAPE_CHAR ESCAPE_CHAR
 #define IDENTIFIER_TOKEN %%identifier-token
 #define INTEGER_TOKEN %%integer-token
@@ -47,6 +56,13 @@
  (left_right_operand_slots_lookup(rule, &(left), &(right), &(operand), info))
 #define CONSTRUCT_BODY(...) static const char *construct_source = EVALUATE_MACROS_AND_STRINGIFY(__VA_ARGS__);
 #include "x-construct-parse-tree.h"
+#define OWL_MULTIPLY_HIGH OWL_MULTIPLY_HIGH
+#define OWL_LEADING_ZEROS OWL_LEADING_ZEROS
+#define READ_NUMBER_BODY(...) static const char *number_reader_source = EVALUATE_MACROS_AND_STRINGIFY(__VA_ARGS__);
+// The table of powers of five in x-read-number.h isn't part of the source
+// string -- it's written out separately by generate_number_reader.
+#include <stdint.h>
+#include "x-read-number.h"
 
 // Now we can start the #includes as usual.
 #include "6a-generate.h"
@@ -65,9 +81,37 @@ struct generated_token {
 static void generate_keyword_reader(struct generated_token *tokens,
  uint32_t number_of_tokens, struct generator_output *out);
 
+static void generate_keyword_hash(struct generated_token *tokens,
+ uint32_t number_of_tokens, struct generator_output *out);
+
+static bool keyword_is_identifier_shaped(struct token keyword,
+ bool allow_dashes);
+
+static void generate_state_functions(struct generator *gen,
+ struct generator_output *out);
+
+static void generate_state_table(struct generator *gen,
+ struct generator_output *out);
+
 static void generate_action_table(struct generator *gen,
  struct generator_output *out);
 
+static uint32_t *find_root_split_columns(struct generator *gen);
+
+static void generate_split_actions(struct generator_output *out);
+
+static void generate_parallel_build(struct generator *gen,
+ struct generator_output *out, uint32_t *split_columns);
+
+static void generate_vector_scanner(struct generator *gen,
+ struct generator_output *out);
+
+static void generate_number_reader(struct generator_output *out);
+static void generate_tree_compaction(struct generator *gen,
+ struct generator_output *out);
+
+static bool has_single_byte_whitespace(struct grammar *grammar);
+
 static void output_indentation(struct generator_output *out,
  size_t indentation);
 
@@ -84,11 +128,41 @@ static int compare_choice_names(const void *aa, const void *bb)
     return memcmp(a->name, b->name, a->name_length);
 }
 
+// The generated parser identifies tokens by their token class (see
+// find_token_classes in 5-determinize.c) rather than by symbol.
+static symbol_id token_class(struct generator *gen, symbol_id symbol)
+{
+    return gen->deterministic->token_classes[symbol];
+}
+
 static uint32_t reachability_mask_width(struct generator *gen)
 {
     return (gen->deterministic->transitions.number_of_transitions + 31) / 32;
 }
 
+// The number of bytes the tokenizer may need to look at to decide which token
+// starts at a given offset (not counting identifiers, strings, and other
+// tokens whose length isn't fixed).  The streaming parser doesn't tokenize
+// within this distance of the end of the input it has so far.
+static size_t stream_lookahead(struct generator *gen)
+{
+    // Hexadecimal integers need three bytes ("0x" and a digit).
+    size_t lookahead = 3;
+    for (uint32_t i = 0; i < gen->combined->number_of_keyword_tokens; ++i) {
+        if (gen->combined->tokens[i].length > lookahead)
+            lookahead = gen->combined->tokens[i].length;
+    }
+    for (uint32_t i = 0; i < gen->grammar->number_of_whitespace_tokens; ++i) {
+        if (gen->grammar->whitespace_tokens[i].length > lookahead)
+            lookahead = gen->grammar->whitespace_tokens[i].length;
+    }
+    for (uint32_t i = 0; i < gen->grammar->number_of_comment_tokens; ++i) {
+        if (gen->grammar->comment_tokens[i].length > lookahead)
+            lookahead = gen->grammar->comment_tokens[i].length;
+    }
+    return lookahead;
+}
+
 struct state_in_automaton {
     struct bitset *reachability_mask;
     struct automaton *automaton;
@@ -138,8 +212,10 @@ static int compare_state_transitions(const void *aa, const void *bb) {
     }
     return 0;
 }
-static void generate_reachability_mask_check(struct generator *gen,
+static void generate_reachability_mask_condition(struct generator *gen,
  struct generator_output *out, struct bitset *r);
+static void generate_speculative_bases(struct generator *gen,
+ struct generator_output *out);
 
 void generate(struct generator *gen)
 {
@@ -161,6 +237,19 @@ void generate(struct generator *gen)
             break;
         }
     }
+    bool split_root = false;
+    if (gen->split_root) {
+        uint32_t *split_columns = find_root_split_columns(gen);
+        split_root = split_columns != 0;
+        free(split_columns);
+    }
+    // The rule index has a list of matches for each rule, then one for each
+    // named option of each rule.
+    uint32_t number_of_match_lists = n;
+    for (uint32_t i = 0; i < n; ++i)
+        number_of_match_lists += gen->grammar->rules[i]->number_of_choices;
+    set_unsigned_number_substitution(out, "number-of-match-lists",
+     number_of_match_lists);
     if (gen->prefix) {
         set_substitution(out, "PREFIX", gen->prefix, strlen(gen->prefix),
          UPPERCASE_WITH_UNDERSCORES);
@@ -188,6 +277,21 @@ void generate(struct generator *gen)
     output_line(out, "//");
     output_line(out, "//   #define %%PREFIX_PARSER_IMPLEMENTATION");
     output_line(out, "//   #include \"parser.h\"");
+    output_line(out, "//");
+    output_line(out, "// Some parts of the interface are only declared and compiled if you define");
+    output_line(out, "// these before including this file (everywhere it's included):");
+    output_line(out, "//");
+    output_line(out, "//   OWL_PARSER_API  %%prefix_parser_...() for streaming and reusing memory");
+    output_line(out, "//   OWL_BATCH       %%prefix_parse_batch()");
+    output_line(out, "//   OWL_COMPACT     %%prefix_tree_compact()");
+    output_line(out, "//   OWL_INDEX       %%prefix_tree_nodes_of_rule() and the other index queries");
+    output_line(out, "//   OWL_BUILDER     %%prefix_build(), for building your own nodes");
+    output_line(out, "//");
+    set_unsigned_number_substitution(out, "number-of-tokens",
+     gen->combined->number_of_tokens);
+    set_unsigned_number_substitution(out, "number-of-token-classes",
+     gen->deterministic->number_of_token_classes);
+    output_line(out, "// The grammar's %%number-of-tokens tokens fall into %%number-of-token-classes token classes.");
     output_line(out, "");
     output_line(out, "#ifndef %%PREFIX_PARSER_H");
     output_line(out, "#define %%PREFIX_PARSER_H");
@@ -210,34 +314,136 @@ void generate(struct generator *gen)
     output_line(out, "// Creates an %%prefix_tree by reading from a file.");
     output_line(out, "struct %%prefix_tree *%%prefix_tree_create_from_file(FILE *file);");
     output_line(out, "");
+    output_line(out, "// Creates an %%prefix_tree from the file at `path`.  Where possible, the tree");
+    output_line(out, "// references a memory mapping of the file instead of a copy.");
+    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_from_path(const char *path);");
+    output_line(out, "");
     output_line(out, "// Explicitly create a tree with particular options.");
     if (has_custom_tokens)
-        output_line(out, "typedef struct %%prefix_token (*%%prefix_token_func_t)(const char *string, void *info);");
+        output_line(out, "typedef struct %%prefix_token (*%%prefix_token_func_t)(const char *string, size_t length, void *info);");
     output_line(out, "struct %%prefix_tree_options {");
     output_line(out, "    // Exactly one of string or file should be set.");
     output_line(out, "    const char *string;");
     output_line(out, "    FILE *file;");
+    output_line(out, "    // The length of the string in bytes.  If this is set, the string doesn't");
+    output_line(out, "    // need to be zero-terminated, and any zero bytes in it are invalid tokens.");
+    output_line(out, "    size_t length;");
+    output_line(out, "    // If set, `length` is used even if it's zero.  Otherwise, a `length` of zero");
+    output_line(out, "    // means the string is zero-terminated.");
+    output_line(out, "    bool has_length;");
+    output_line(out, "    // If set, the tree keeps a list of the matches of each rule, which");
+    output_line(out, "    // %%prefix_tree_nodes_of_rule() returns.  This and index_locations only");
+    output_line(out, "    // have an effect with OWL_INDEX defined.");
+    output_line(out, "    bool index_rules;");
+    output_line(out, "    // If set, the tree keeps an index of where each match is, which");
+    output_line(out, "    // %%prefix_tree_node_at() and %%prefix_tree_nodes_in_range() search.");
+    output_line(out, "    bool index_locations;");
+    output_line(out, "    // If more than one, the input is checked against the grammar on up to this");
+    output_line(out, "    // many threads.  This only has an effect if the implementation is compiled");
+    output_line(out, "    // with OWL_THREADS defined.");
+    output_line(out, "    unsigned threads;");
+    output_line(out, "    // If set (and `threads` is at most one), the input is tokenized on a second");
+    output_line(out, "    // thread while this one checks the tokens against the grammar.  This also");
+    output_line(out, "    // only has an effect with OWL_THREADS defined.");
+    output_line(out, "    bool pipeline;");
     if (has_custom_tokens) {
         output_line(out, "    // A custom tokenizer function.");
         output_line(out, "    %%prefix_token_func_t tokenize;");
         output_line(out, "    // This pointer will be passed into the tokenize function.");
         output_line(out, "    void *tokenize_info;");
     }
+    output_line(out, "    // Functions for allocating and freeing memory.  Either all three or none of");
+    output_line(out, "    // them should be set; if they aren't set, malloc, realloc, and free are used.");
+    output_line(out, "    // The tree and everything allocated while building it come from these");
+    output_line(out, "    // functions, and the tree keeps using them until it's destroyed.");
+    output_line(out, "    void *(*allocate)(size_t size, void *info);");
+    output_line(out, "    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);");
+    output_line(out, "    void (*deallocate)(void *pointer, size_t size, void *info);");
+    output_line(out, "    // This pointer will be passed into the allocation functions.");
+    output_line(out, "    void *allocator_info;");
     output_line(out, "};");
     output_line(out, "struct %%prefix_tree *%%prefix_tree_create_with_options(struct %%prefix_tree_options options);");
     output_line(out, "");
+    output_line(out, "// Creates a tree from the file at `path` like %%prefix_tree_create_from_path(),");
+    output_line(out, "// with the other options set.  The file and string options must be left unset.");
+    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_from_path_with_options(const char *path, struct %%prefix_tree_options options);");
+    output_line(out, "");
+    output_line(out, "#ifdef OWL_BATCH");
+    output_line(out, "// Parses `n` strings, setting out[i] to the tree for inputs[i].  If `lengths`");
+    output_line(out, "// is set, lengths[i] is the length of inputs[i], even if it's zero; otherwise");
+    output_line(out, "// every string must be zero-terminated.  If the implementation is");
+    output_line(out, "// compiled with OWL_THREADS defined, up to `threads` strings are parsed at");
+    output_line(out, "// once.  The trees are independent of each other: destroy each one with");
+    output_line(out, "// %%prefix_tree_destroy().");
+    output_line(out, "void %%prefix_parse_batch(const char **inputs, const size_t *lengths, size_t n, struct %%prefix_tree **out, int threads);");
+    output_line(out, "");
+    output_line(out, "// Explicitly parse a batch with particular options, which apply to each string.");
+    output_line(out, "// The string and file options must be left unset, and `threads` is how many");
+    output_line(out, "// strings are parsed at once.");
+    output_line(out, "void %%prefix_parse_batch_with_options(struct %%prefix_tree_options options, const char **inputs, const size_t *lengths, size_t n, struct %%prefix_tree **out);");
+    output_line(out, "#endif");
+    output_line(out, "");
+    output_line(out, "#ifdef OWL_PARSER_API");
+    output_line(out, "// An %%prefix_parser parses input which arrives in pieces.  Pass each piece to");
+    output_line(out, "// %%prefix_parser_feed() as it arrives, then call %%prefix_parser_finish() to get");
+    output_line(out, "// the tree.  Input is tokenized and checked as it's fed in; the tree itself is");
+    output_line(out, "// built when parsing finishes.");
+    output_line(out, "//");
+    output_line(out, "// A parser can also parse many strings in a row with %%prefix_parser_parse(),");
+    output_line(out, "// reusing its memory instead of allocating it again for each one.");
+    output_line(out, "struct %%prefix_parser;");
+    output_line(out, "");
+    output_line(out, "// Creates an %%prefix_parser.  The parser keeps its own copy of the input.");
+    output_line(out, "struct %%prefix_parser *%%prefix_parser_create(void);");
+    output_line(out, "");
+    output_line(out, "// Explicitly create a parser with particular options.  The string and file");
+    output_line(out, "// options must be left unset.");
+    output_line(out, "struct %%prefix_parser *%%prefix_parser_create_with_options(struct %%prefix_tree_options options);");
+    output_line(out, "");
+    output_line(out, "// Appends the next `length` bytes of input.  Returns false once the input is");
+    output_line(out, "// known to contain an error; the tree returned by %%prefix_parser_finish() will");
+    output_line(out, "// report it.");
+    output_line(out, "bool %%prefix_parser_feed(struct %%prefix_parser *parser, const char *chunk, size_t length);");
+    output_line(out, "");
+    output_line(out, "// Parses the rest of the input and returns the resulting tree.  The tree takes");
+    output_line(out, "// ownership of the parser's copy of the input, and the parser is destroyed.");
+    output_line(out, "struct %%prefix_tree *%%prefix_parser_finish(struct %%prefix_parser *parser);");
+    output_line(out, "");
+    output_line(out, "// Parses a null-terminated string, reusing the memory from earlier parses.  The");
+    output_line(out, "// tree belongs to the parser and references the string: keep both around until");
+    output_line(out, "// the next call to %%prefix_parser_parse(), %%prefix_parser_reset(), or");
+    output_line(out, "// %%prefix_parser_destroy(), and don't pass the tree to %%prefix_tree_destroy().");
+    output_line(out, "struct %%prefix_tree *%%prefix_parser_parse(struct %%prefix_parser *parser, const char *string);");
+    output_line(out, "");
+    output_line(out, "// Discards any input fed to the parser and any tree it returned, keeping its");
+    output_line(out, "// memory for the next parse.");
+    output_line(out, "void %%prefix_parser_reset(struct %%prefix_parser *parser);");
+    output_line(out, "");
+    output_line(out, "// Destroys an %%prefix_parser without finishing it.");
+    output_line(out, "void %%prefix_parser_destroy(struct %%prefix_parser *parser);");
+    output_line(out, "#endif");
+    output_line(out, "");
     output_line(out, "// Destroys an %%prefix_tree, freeing its resources back to the system.");
     output_line(out, "void %%prefix_tree_destroy(struct %%prefix_tree *);");
     output_line(out, "");
     output_line(out, "// Prints a representation of the tree to standard output.");
     output_line(out, "void %%prefix_tree_print(struct %%prefix_tree *);");
     output_line(out, "");
+    output_line(out, "#ifdef OWL_COMPACT");
+    output_line(out, "// Rewrites a finished tree so each node is followed by its children, in source");
+    output_line(out, "// order, and shrinks its memory to fit.  Walking the tree afterwards reads memory");
+    output_line(out, "// front to back.  Any refs into the tree are invalidated.");
+    output_line(out, "void %%prefix_tree_compact(struct %%prefix_tree *tree);");
+    output_line(out, "#endif");
+    output_line(out, "");
     output_line(out, "// An %%prefix_ref references a list of children in the parse tree.  Use the");
     output_line(out, "// %%parsed_..._get() function corresponding to the element type to unpack the");
     output_line(out, "// child into its appropriate %%parsed_... struct.");
     output_line(out, "struct %%prefix_ref {");
     output_line(out, "    struct %%prefix_tree *_tree;");
     output_line(out, "    size_t _offset;");
+    if (gen->tree_layout == GENERATOR_TREE_LAYOUT_RELATIVE)
+        output_line(out, "    size_t _start;");
     output_line(out, "    uint32_t _type;");
     output_line(out, "    bool empty;");
     output_line(out, "};");
@@ -269,6 +475,7 @@ void generate(struct generator *gen)
     output_line(out, "");
     output_line(out, "    // The options passed to %%prefix_tree_create_with_options weren't valid --");
     output_line(out, "    // both file and string were specified at the same time or neither were.");
+    output_line(out, "    // Also reported if either was passed to %%prefix_parser_create_with_options.");
     output_line(out, "    ERROR_INVALID_OPTIONS,");
     output_line(out, "");
     output_line(out, "    // A piece of text couldn't be matched as a token.");
@@ -284,6 +491,15 @@ void generate(struct generator *gen)
     output_line(out, "// Returns an error code, or ERROR_NONE if there wasn't an error.");
     output_line(out, "// The error_range parameter can be null.");
     output_line(out, "enum %%prefix_error %%prefix_tree_get_error(struct %%prefix_tree *tree, struct source_range *error_range);");
+    output_line(out, "");
+    output_line(out, "// Checks whether a string matches the grammar without building a tree.  The");
+    output_line(out, "// result (and error range) is the same as creating a tree would report, but");
+    output_line(out, "// memory use depends only on how deeply the input is nested, not its length.");
+    output_line(out, "// The string is `length` bytes long and doesn't need to be zero-terminated.");
+    output_line(out, "enum %%prefix_error %%prefix_validate(const char *string, size_t length, struct source_range *error_range);");
+    output_line(out, "");
+    output_line(out, "// Explicitly validate input with particular options.");
+    output_line(out, "enum %%prefix_error %%prefix_validate_with_options(struct %%prefix_tree_options options, struct source_range *error_range);");
     struct choice **choices = 0;
     uint32_t choices_allocated_bytes = 0;
     uint32_t choice_index = 0;
@@ -378,7 +594,7 @@ void generate(struct generator *gen)
                 continue;
             set_substitution(out, "name", token->string, token->length,
              UPPERCASE_WITH_UNDERSCORES);
-            set_unsigned_number_substitution(out, "index", i);
+            set_unsigned_number_substitution(out, "index", token_class(gen, i));
             output_line(out, "    %%PREFIX_TOKEN_%%name = %%index,");
         }
         output_line(out, "    %%PREFIX_WHITESPACE = -1,");
@@ -392,8 +608,96 @@ void generate(struct generator *gen)
         output_line(out, "        void *pointer;");
         output_line(out, "    } data;");
         output_line(out, "};");
-        output_line(out, "static struct %%prefix_token %%prefix_token_no_match;");
+        output_line(out, "static const struct %%prefix_token %%prefix_token_no_match;");
+    }
+    output_line(out, "");
+    output_line(out, "// The rules of the grammar, as passed to %%prefix_builder functions and");
+    output_line(out, "// %%prefix_tree_nodes_of_rule().");
+    output_line(out, "enum %%prefix_rule {");
+    for (uint32_t i = 0; i < n; ++i) {
+        struct rule *rule = gen->grammar->rules[i];
+        set_substitution(out, "rule-name", rule->name, rule->name_length,
+         UPPERCASE_WITH_UNDERSCORES);
+        set_unsigned_number_substitution(out, "rule-index", i);
+        output_line(out, "    %%PREFIX_RULE_%%rule-name = %%rule-index,");
+    }
+    output_line(out, "};");
+    output_line(out, "");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "// Returns the matches of `rule` in source order, setting `count` to the number");
+    output_line(out, "// of them.  The tree must have been created with the index_rules option;");
+    output_line(out, "// otherwise there aren't any.  The array belongs to the tree, and");
+    output_line(out, "// %%prefix_tree_compact() updates it in place.");
+    output_line(out, "const struct %%prefix_ref *%%prefix_tree_nodes_of_rule(struct %%prefix_tree *tree, enum %%prefix_rule rule, size_t *count);");
+    if (choice_index > 0) {
+        output_line(out, "");
+        output_line(out, "// Like %%prefix_tree_nodes_of_rule(), but only returns matches of the named");
+        output_line(out, "// option `type`.");
+        output_line(out, "const struct %%prefix_ref *%%prefix_tree_nodes_of_option(struct %%prefix_tree *tree, enum %%prefix_rule rule, enum %%parsed_type type, size_t *count);");
+    }
+    output_line(out, "");
+    output_line(out, "// Returns the innermost match containing the byte at `location`, or an empty");
+    output_line(out, "// ref if there isn't one.  The tree must have been created with the");
+    output_line(out, "// index_locations option.");
+    output_line(out, "struct %%prefix_ref %%prefix_tree_node_at(struct %%prefix_tree *tree, size_t location);");
+    output_line(out, "");
+    output_line(out, "// Returns the matches which start in the range [start, end), setting `count` to");
+    output_line(out, "// the number of them.  Matches are in source order, with each match before the");
+    output_line(out, "// matches inside it.  The tree must have been created with the index_locations");
+    output_line(out, "// option.  The array belongs to the tree.");
+    output_line(out, "const struct %%prefix_ref *%%prefix_tree_nodes_in_range(struct %%prefix_tree *tree, size_t start, size_t end, size_t *count);");
+    output_line(out, "#endif");
+    output_line(out, "");
+    output_line(out, "// Returns the rule a ref matched.");
+    output_line(out, "enum %%prefix_rule %%prefix_ref_rule(struct %%prefix_ref ref);");
+    output_line(out, "");
+    output_line(out, "#ifdef OWL_BUILDER");
+    output_line(out, "// A rule or token match, as passed to an %%prefix_builder function.");
+    output_line(out, "struct %%prefix_match {");
+    output_line(out, "    enum %%prefix_rule rule;");
+    output_line(out, "    struct source_range range;");
+    if (choice_index > 0) {
+        output_line(out, "    // For rules with named options, the option which matched.");
+        output_line(out, "    enum %%parsed_type type;");
+    }
+    output_line(out, "    // The nodes built for each of the rule's fields, in the same order as the");
+    output_line(out, "    // fields of its %%parsed_... struct.  Each one is the first node of a list");
+    output_line(out, "    // linked by `next_sibling`, or null if the field is empty.");
+    output_line(out, "    void **slots;");
+    output_line(out, "    // Token data, as in the token's %%parsed_... struct.  The identifier and");
+    output_line(out, "    // string pointers may only be valid until building finishes.");
+    output_line(out, "    const char *identifier;");
+    output_line(out, "    const char *string;");
+    output_line(out, "    size_t length;");
+    output_line(out, "    uint64_t integer;");
+    output_line(out, "    double number;");
+    if (has_custom_tokens) {
+        output_line(out, "    union {");
+        output_line(out, "        uint64_t integer;");
+        output_line(out, "        double real;");
+        output_line(out, "        void *pointer;");
+        output_line(out, "    } data;");
     }
+    output_line(out, "};");
+    output_line(out, "struct %%prefix_builder {");
+    output_line(out, "    // Called once for each match, after the matches inside it.  `next_sibling` is");
+    output_line(out, "    // the node built for the following match in the same field, if there is one.");
+    output_line(out, "    // Returns the new node; returning null leaves the match out.");
+    output_line(out, "    void *(*build)(const struct %%prefix_match *match, void *next_sibling, void *info);");
+    output_line(out, "    // This pointer will be passed into the build function.");
+    output_line(out, "    void *info;");
+    output_line(out, "};");
+    output_line(out, "");
+    output_line(out, "// Parses a string, building your own nodes with `builder` instead of creating");
+    output_line(out, "// a tree.  Nodes are only built once the whole input has been checked, so");
+    output_line(out, "// nothing is built if there's an error.  Otherwise, `root` is set to the node");
+    output_line(out, "// built for the root match.  The string is `length` bytes long and doesn't");
+    output_line(out, "// need to be zero-terminated.");
+    output_line(out, "enum %%prefix_error %%prefix_build(const char *string, size_t length, struct %%prefix_builder builder, void **root, struct source_range *error_range);");
+    output_line(out, "");
+    output_line(out, "// Explicitly build nodes with particular options.");
+    output_line(out, "enum %%prefix_error %%prefix_build_with_options(struct %%prefix_tree_options options, struct %%prefix_builder builder, void **root, struct source_range *error_range);");
+    output_line(out, "#endif");
     output_line(out, "");
     output_line(out, "#endif");
     output_line(out, "");
@@ -405,6 +709,19 @@ void generate(struct generator *gen)
     output_line(out, "#include <stdlib.h>");
     output_line(out, "#include <string.h>");
 
+    output_line(out, "#if !defined(OWL_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))");
+    output_line(out, "#define OWL_MMAP");
+    output_line(out, "#include <errno.h>");
+    output_line(out, "#include <fcntl.h>");
+    output_line(out, "#include <sys/mman.h>");
+    output_line(out, "#include <sys/stat.h>");
+    output_line(out, "#include <unistd.h>");
+    output_line(out, "#endif");
+
+    output_line(out, "#ifdef OWL_THREADS");
+    output_line(out, "#include <pthread.h>");
+    output_line(out, "#endif");
+
     output_line(out, "#if defined(__clang__) || defined(__GNUC__)");
     output_line(out, "#define OWL_DONT_INLINE __attribute__((noinline))");
     output_line(out, "#else");
@@ -412,19 +729,128 @@ void generate(struct generator *gen)
     output_line(out, "#endif");
 
     output_line(out, "");
+    output_line(out, "// The allocation functions from %%prefix_tree_options.");
+    output_line(out, "struct owl_allocator {");
+    output_line(out, "    void *(*allocate)(size_t size, void *info);");
+    output_line(out, "    void *(*reallocate)(void *pointer, size_t old_size, size_t new_size, void *info);");
+    output_line(out, "    void (*deallocate)(void *pointer, size_t size, void *info);");
+    output_line(out, "    void *info;");
+    output_line(out, "};");
+    output_line(out, "static void *allocate_memory(size_t size, void *allocator) {");
+    output_line(out, "    struct owl_allocator *a = allocator;");
+    output_line(out, "    if (a->allocate)");
+    output_line(out, "        return a->allocate(size, a->info);");
+    output_line(out, "    return malloc(size);");
+    output_line(out, "}");
+    output_line(out, "static void *reallocate_memory(void *pointer, size_t old_size, size_t new_size, void *allocator) {");
+    output_line(out, "    struct owl_allocator *a = allocator;");
+    output_line(out, "    if (a->reallocate)");
+    output_line(out, "        return a->reallocate(pointer, old_size, new_size, a->info);");
+    output_line(out, "    return realloc(pointer, new_size);");
+    output_line(out, "}");
+    output_line(out, "static void free_memory(void *pointer, size_t size, void *allocator) {");
+    output_line(out, "    struct owl_allocator *a = allocator;");
+    output_line(out, "    if (!pointer)");
+    output_line(out, "        return;");
+    output_line(out, "    if (a->deallocate)");
+    output_line(out, "        a->deallocate(pointer, size, a->info);");
+    output_line(out, "    else");
+    output_line(out, "        free(pointer);");
+    output_line(out, "}");
+    output_line(out, "");
+    bool relative = gen->tree_layout == GENERATOR_TREE_LAYOUT_RELATIVE;
+    if (relative) {
+        output_line(out, "struct pending_start {");
+        output_line(out, "    size_t offset;");
+        output_line(out, "    size_t start;");
+        output_line(out, "};");
+    }
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "struct match_to_sort {");
+    output_line(out, "    size_t start;");
+    output_line(out, "    size_t end;");
+    output_line(out, "    struct %%prefix_ref ref;");
+    output_line(out, "};");
+    output_line(out, "// A list of matches, kept in source order.");
+    output_line(out, "struct match_list {");
+    output_line(out, "    struct %%prefix_ref *matches;");
+    output_line(out, "    // The start location of each match, for keeping the list in order.");
+    output_line(out, "    size_t *starts;");
+    output_line(out, "    // The end location of each match, if keeps_ends is set.");
+    output_line(out, "    size_t *ends;");
+    output_line(out, "    bool keeps_ends;");
+    output_line(out, "    size_t count;");
+    output_line(out, "    size_t capacity;");
+    output_line(out, "    // Matches which arrived too far out of order to insert, which are merged");
+    output_line(out, "    // into the list once the tree is finished.");
+    output_line(out, "    struct match_to_sort *late;");
+    output_line(out, "    size_t late_count;");
+    output_line(out, "    size_t late_capacity;");
+    output_line(out, "};");
+    output_line(out, "// Matches for %%prefix_tree_nodes_of_rule().  There's a list for each rule,");
+    output_line(out, "// followed by a list for each named option of each rule.");
+    output_line(out, "struct rule_index {");
+    output_line(out, "    struct match_list lists[%%number-of-match-lists];");
+    output_line(out, "};");
+    output_line(out, "// Every match, for %%prefix_tree_node_at() and %%prefix_tree_nodes_in_range().");
+    output_line(out, "struct location_index {");
+    output_line(out, "    struct match_list nodes;");
+    output_line(out, "    // A complete binary tree with the end locations of the nodes as its leaves.");
+    output_line(out, "    // Each branch holds the furthest end location of any leaf below it.  Leaf k");
+    output_line(out, "    // is number k + number_of_leaves, so only the branches are stored here,");
+    output_line(out, "    // starting from one.");
+    output_line(out, "    size_t *furthest_ends;");
+    output_line(out, "    size_t furthest_ends_capacity;");
+    output_line(out, "    size_t number_of_leaves;");
+    output_line(out, "};");
+    output_line(out, "#endif");
     output_line(out, "struct %%prefix_tree {");
     output_line(out, "    const char *string;");
-    output_line(out, "    bool owns_string;");
+    output_line(out, "    // If nonzero, the tree owns the string, which is an allocation of this many");
+    output_line(out, "    // bytes.");
+    output_line(out, "    size_t owned_string_size;");
+    output_line(out, "    // If nonzero, the string is a memory mapping of this many bytes.");
+    output_line(out, "    size_t mapped_length;");
     if (has_custom_tokens) {
         output_line(out, "    %%prefix_token_func_t custom_tokenize;");
         output_line(out, "    void *custom_tokenize_info;");
     }
+    output_line(out, "    struct owl_allocator allocator;");
+    output_line(out, "    // If set, nodes are built with this instead of being written to parse_tree.");
+    output_line(out, "    const struct %%prefix_builder *builder;");
     output_line(out, "    uint8_t *parse_tree;");
     output_line(out, "    size_t parse_tree_size;");
     output_line(out, "    size_t next_offset;");
     output_line(out, "    enum %%prefix_error error;");
     output_line(out, "    struct source_range error_range;");
     output_line(out, "    size_t root_offset;");
+    output_line(out, "    // Set by %%prefix_tree_compact(), after which links to siblings and children");
+    output_line(out, "    // point forward instead of backward.");
+    output_line(out, "    bool compacted;");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "    // Set if the tree was created with the index_rules option.");
+    output_line(out, "    struct rule_index *rule_index;");
+    output_line(out, "    // Set if the tree was created with the index_locations option.");
+    output_line(out, "    struct location_index *location_index;");
+    output_line(out, "#endif");
+    output_line(out, "#ifdef OWL_THREADS");
+    output_line(out, "    // Set on the copies of the tree which worker threads tokenize with.  Token");
+    output_line(out, "    // data goes to the log instead of parse_tree, to be written in order later.");
+    output_line(out, "    struct token_log *token_log;");
+    if (split_root) {
+        output_line(out, "    // Set on the copies of the tree which worker threads build with.  Finished");
+        output_line(out, "    // nodes go to the log instead, to be written in order later.");
+        output_line(out, "    struct node_log *node_log;");
+    }
+    output_line(out, "#endif");
+    if (relative) {
+        output_line(out, "    size_t root_start;");
+        output_line(out, "    // While the tree is being built, the start locations of nodes which");
+        output_line(out, "    // haven't been written into a parent or sibling yet.");
+        output_line(out, "    struct pending_start *pending_starts;");
+        output_line(out, "    size_t number_of_pending_starts;");
+        output_line(out, "    size_t pending_starts_capacity;");
+    }
     for (uint32_t i = 0; i < n; ++i) {
         struct rule *rule = gen->grammar->rules[i];
         if (!rule->is_token || rule->token_type == RULE_TOKEN_CUSTOM)
@@ -432,41 +858,78 @@ void generate(struct generator *gen)
         set_substitution(out, "rule", rule->name, rule->name_length,
          LOWERCASE_WITH_UNDERSCORES);
         output_line(out, "    size_t next_%%rule_token_offset;");
+        if (relative)
+            output_line(out, "    size_t next_%%rule_token_location;");
     }
-    if (has_custom_tokens)
+    if (has_custom_tokens) {
         output_line(out, "    size_t next_custom_token_offset;");
+        if (relative)
+            output_line(out, "    size_t next_custom_token_location;");
+    }
     output_line(out, "};");
 
     set_literal_substitution(out, "token-type", "uint32_t");
     set_literal_substitution(out, "state-type", "uint32_t");
 
     // Code for reading and writing packed parse trees.
-    output_line(out, "// Reserve 10 bytes for each entry (the maximum encoded size of a 64-bit value).");
-    output_line(out, "#define RESERVATION_AMOUNT 10");
-    output_line(out, "static inline uint64_t read_tree(size_t *offset, struct %%prefix_tree *tree) {");
-    output_line(out, "    uint8_t *parse_tree = tree->parse_tree;");
-    output_line(out, "    size_t parse_tree_size = tree->parse_tree_size;");
-    output_line(out, "    size_t i = *offset;");
-    output_line(out, "    if (i + RESERVATION_AMOUNT >= parse_tree_size)");
-    output_line(out, "        return 0;");
-    output_line(out, "    uint64_t result = 0;");
-    output_line(out, "    int shift_amount = 0;");
-    output_line(out, "    while ((parse_tree[i] & 0x80) != 0 && shift_amount < 64) {");
-    output_line(out, "        result |= ((uint64_t)parse_tree[i] & 0x7f) << shift_amount;");
-    output_line(out, "        shift_amount += 7;");
-    output_line(out, "        i++;");
-    output_line(out, "    }");
-    output_line(out, "    result |= ((uint64_t)parse_tree[i] & 0x7f) << shift_amount;");
-    output_line(out, "    i++;");
-    output_line(out, "    *offset = i;");
-    output_line(out, "    return result;");
-    output_line(out, "}");
+    bool fixed_width = gen->tree_layout == GENERATOR_TREE_LAYOUT_FIXED;
+    if (fixed_width) {
+        // Offset zero means "no node", so the first node starts at the next
+        // aligned offset.
+        set_literal_substitution(out, "first-tree-offset", "4");
+        set_literal_substitution(out, "read-tree-wide", "read_tree_wide");
+        set_literal_substitution(out, "write-tree-wide", "write_tree_wide");
+        output_line(out, "// Every field is a 32-bit word; 64-bit values take two.");
+        output_line(out, "#define RESERVATION_AMOUNT 8");
+        output_line(out, "static inline uint32_t tree_field(struct %%prefix_tree *tree, size_t offset, size_t index) {");
+        output_line(out, "    uint32_t field;");
+        output_line(out, "    memcpy(&field, tree->parse_tree + offset + index * 4, 4);");
+        output_line(out, "    return field;");
+        output_line(out, "}");
+        output_line(out, "static inline uint64_t tree_field_wide(struct %%prefix_tree *tree, size_t offset, size_t index) {");
+        output_line(out, "    return tree_field(tree, offset, index) | (uint64_t)tree_field(tree, offset, index + 1) << 32;");
+        output_line(out, "}");
+        output_line(out, "static inline uint64_t read_tree(size_t *offset, struct %%prefix_tree *tree) {");
+        output_line(out, "    uint32_t result = tree_field(tree, *offset, 0);");
+        output_line(out, "    *offset += 4;");
+        output_line(out, "    return result;");
+        output_line(out, "}");
+        output_line(out, "static inline uint64_t read_tree_wide(size_t *offset, struct %%prefix_tree *tree) {");
+        output_line(out, "    uint64_t result = tree_field_wide(tree, *offset, 0);");
+        output_line(out, "    *offset += 8;");
+        output_line(out, "    return result;");
+        output_line(out, "}");
+    } else {
+        set_literal_substitution(out, "first-tree-offset", "1");
+        set_literal_substitution(out, "read-tree-wide", "read_tree");
+        set_literal_substitution(out, "write-tree-wide", "write_tree");
+        output_line(out, "// Reserve 10 bytes for each entry (the maximum encoded size of a 64-bit value).");
+        output_line(out, "#define RESERVATION_AMOUNT 10");
+        output_line(out, "static inline uint64_t read_tree(size_t *offset, struct %%prefix_tree *tree) {");
+        output_line(out, "    uint8_t *parse_tree = tree->parse_tree;");
+        output_line(out, "    size_t parse_tree_size = tree->parse_tree_size;");
+        output_line(out, "    size_t i = *offset;");
+        output_line(out, "    if (i + RESERVATION_AMOUNT >= parse_tree_size)");
+        output_line(out, "        return 0;");
+        output_line(out, "    uint64_t result = 0;");
+        output_line(out, "    int shift_amount = 0;");
+        output_line(out, "    while ((parse_tree[i] & 0x80) != 0 && shift_amount < 64) {");
+        output_line(out, "        result |= ((uint64_t)parse_tree[i] & 0x7f) << shift_amount;");
+        output_line(out, "        shift_amount += 7;");
+        output_line(out, "        i++;");
+        output_line(out, "    }");
+        output_line(out, "    result |= ((uint64_t)parse_tree[i] & 0x7f) << shift_amount;");
+        output_line(out, "    i++;");
+        output_line(out, "    *offset = i;");
+        output_line(out, "    return result;");
+        output_line(out, "}");
+    }
     output_line(out, "static bool grow_tree(struct %%prefix_tree *tree, size_t size)");
     output_line(out, "{");
     output_line(out, "    size_t n = tree->parse_tree_size;");
     output_line(out, "    while (n < size || n < 4096)");
     output_line(out, "        n = (n + 1) * 3 / 2;");
-    output_line(out, "    uint8_t *parse_tree = realloc(tree->parse_tree, n);");
+    output_line(out, "    uint8_t *parse_tree = reallocate_memory(tree->parse_tree, tree->parse_tree_size, n, &tree->allocator);");
     output_line(out, "    if (!parse_tree)");
     output_line(out, "        return false;");
     output_line(out, "    tree->parse_tree_size = n;");
@@ -478,12 +941,94 @@ void generate(struct generator *gen)
     output_line(out, "    size_t reserved_size = tree->next_offset + RESERVATION_AMOUNT;");
     output_line(out, "    if (tree->parse_tree_size <= reserved_size && !grow_tree(tree, reserved_size))");
     output_line(out, "        abort();");
-    output_line(out, "    while (value >> 7 != 0) {");
-    output_line(out, "        tree->parse_tree[tree->next_offset++] = 0x80 | (value & 0x7f);");
-    output_line(out, "        value >>= 7;");
-    output_line(out, "    }");
-    output_line(out, "    tree->parse_tree[tree->next_offset++] = value & 0x7f;");
+    if (fixed_width) {
+        output_line(out, "    // Offsets and locations must fit in a field.");
+        output_line(out, "    if (value > UINT32_MAX)");
+        output_line(out, "        abort();");
+        output_line(out, "    uint32_t field = (uint32_t)value;");
+        output_line(out, "    memcpy(tree->parse_tree + tree->next_offset, &field, 4);");
+        output_line(out, "    tree->next_offset += 4;");
+    } else {
+        output_line(out, "    while (value >> 7 != 0) {");
+        output_line(out, "        tree->parse_tree[tree->next_offset++] = 0x80 | (value & 0x7f);");
+        output_line(out, "        value >>= 7;");
+        output_line(out, "    }");
+        output_line(out, "    tree->parse_tree[tree->next_offset++] = value & 0x7f;");
+    }
+    output_line(out, "}");
+    if (fixed_width) {
+        output_line(out, "static void write_tree_wide(struct %%prefix_tree *tree, uint64_t value)");
+        output_line(out, "{");
+        output_line(out, "    write_tree(tree, value & UINT32_MAX);");
+        output_line(out, "    write_tree(tree, value >> 32);");
+        output_line(out, "}");
+    }
+    output_line(out, "static inline size_t follow_link(struct %%prefix_tree *tree, size_t offset, size_t delta)");
+    output_line(out, "{");
+    output_line(out, "    return tree->compacted ? offset + delta : offset - delta;");
     output_line(out, "}");
+    if (!fixed_width && !relative) {
+        output_line(out, "// Offsets to children and token records are absolute while the tree is built,");
+        output_line(out, "// and relative to the node once it's been compacted.");
+        output_line(out, "static inline size_t read_child_offset(size_t *offset, struct %%prefix_ref ref)");
+        output_line(out, "{");
+        output_line(out, "    size_t child = read_tree(offset, ref._tree);");
+        output_line(out, "    return child && ref._tree->compacted ? ref._offset + child : child;");
+        output_line(out, "}");
+    }
+    if (relative) {
+        output_line(out, "static void push_start(struct %%prefix_tree *tree, size_t offset, size_t start)");
+        output_line(out, "{");
+        output_line(out, "    size_t n = tree->number_of_pending_starts;");
+        output_line(out, "    if (n == tree->pending_starts_capacity) {");
+        output_line(out, "        size_t capacity = n * 2 + 16;");
+        output_line(out, "        struct pending_start *pending_starts = reallocate_memory(tree->pending_starts,");
+        output_line(out, "         n * sizeof(struct pending_start), capacity * sizeof(struct pending_start), &tree->allocator);");
+        output_line(out, "        if (!pending_starts)");
+        output_line(out, "            abort();");
+        output_line(out, "        tree->pending_starts = pending_starts;");
+        output_line(out, "        tree->pending_starts_capacity = capacity;");
+        output_line(out, "    }");
+        output_line(out, "    tree->pending_starts[n] = (struct pending_start){ .offset = offset, .start = start };");
+        output_line(out, "    tree->number_of_pending_starts = n + 1;");
+        output_line(out, "}");
+        output_line(out, "// Nodes are almost always referenced right after they're finished, so the");
+        output_line(out, "// search starts with the most recent.");
+        output_line(out, "static size_t take_start(struct %%prefix_tree *tree, size_t offset)");
+        output_line(out, "{");
+        output_line(out, "    size_t n = tree->number_of_pending_starts;");
+        output_line(out, "    size_t i = n;");
+        output_line(out, "    while (i > 0 && tree->pending_starts[i - 1].offset != offset)");
+        output_line(out, "        i--;");
+        output_line(out, "    if (i == 0)");
+        output_line(out, "        abort();");
+        output_line(out, "    size_t start = tree->pending_starts[i - 1].start;");
+        output_line(out, "    memmove(tree->pending_starts + i - 1, tree->pending_starts + i, (n - i) * sizeof(struct pending_start));");
+        output_line(out, "    tree->number_of_pending_starts = n - 1;");
+        output_line(out, "    return start;");
+        output_line(out, "}");
+        output_line(out, "static void write_slot(struct %%prefix_tree *tree, size_t offset, size_t start_location, size_t slot)");
+        output_line(out, "{");
+        output_line(out, "    if (slot == 0) {");
+        output_line(out, "        write_tree(tree, 0);");
+        output_line(out, "        return;");
+        output_line(out, "    }");
+        output_line(out, "    write_tree(tree, offset - slot);");
+        output_line(out, "    write_tree(tree, take_start(tree, slot) - start_location);");
+        output_line(out, "}");
+        output_line(out, "static inline struct %%prefix_ref read_slot(size_t *offset, struct %%prefix_ref ref, size_t start_location, uint32_t type)");
+        output_line(out, "{");
+        output_line(out, "    size_t delta = read_tree(offset, ref._tree);");
+        output_line(out, "    if (delta == 0)");
+        output_line(out, "        return (struct %%prefix_ref){ ._tree = ref._tree, ._type = type, .empty = true };");
+        output_line(out, "    return (struct %%prefix_ref){");
+        output_line(out, "        ._tree = ref._tree,");
+        output_line(out, "        ._offset = follow_link(ref._tree, ref._offset, delta),");
+        output_line(out, "        ._start = start_location + read_tree(offset, ref._tree),");
+        output_line(out, "        ._type = type,");
+        output_line(out, "    };");
+        output_line(out, "}");
+    }
     for (uint32_t i = 0; i < n; ++i) {
         struct rule *rule = gen->grammar->rules[i];
         set_unsigned_number_substitution(out, "rule-index", i);
@@ -501,23 +1046,67 @@ void generate(struct generator *gen)
             output_line(out, "            {0}");
         output_line(out, "        };");
         output_line(out, "    }");
-        output_line(out, "    size_t offset = ref._offset;");
-        output_line(out, "    read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.");
-        if (rule->is_token) {
-            output_line(out, "    size_t token_offset = read_tree(&offset, ref._tree);");
-            output_line(out, "    read_tree(&token_offset, ref._tree);");
-            output_line(out, "    size_t start_location = read_tree(&token_offset, ref._tree);");
-            output_line(out, "    size_t end_location = start_location + read_tree(&token_offset, ref._tree);");
+        // In the fixed-width layout, each field is read directly: a node is
+        // [next sibling, start, length, choice?, slots...] and a token record
+        // is [previous token, start, length, value...].
+        uint32_t type_field = 3;
+        uint32_t first_slot_field = rule->number_of_choices > 0 ? 4 : 3;
+        if (fixed_width && rule->is_token) {
+            output_line(out, "    size_t token_offset = tree_field(ref._tree, ref._offset, 1);");
+            output_line(out, "    size_t start_location = tree_field(ref._tree, token_offset, 1);");
+            output_line(out, "    size_t end_location = start_location + tree_field(ref._tree, token_offset, 2);");
             if (rule->token_type == RULE_TOKEN_STRING) {
-                output_line(out, "    size_t string_offset = read_tree(&token_offset, ref._tree);");
+                output_line(out, "    size_t string_offset = tree_field(ref._tree, token_offset, 3);");
                 output_line(out, "    const char *string = string_offset ?");
                 output_line(out, "     (const char *)ref._tree->parse_tree + string_offset : ref._tree->string + start_location + 1;");
                 output_line(out, "    size_t string_length = string_offset ?");
-                output_line(out, "     read_tree(&token_offset, ref._tree) : end_location - start_location - 2;");
+                output_line(out, "     tree_field(ref._tree, token_offset, 4) : end_location - start_location - 2;");
             }
+        } else if (fixed_width) {
+            output_line(out, "    size_t start_location = tree_field(ref._tree, ref._offset, 1);");
+            output_line(out, "    size_t end_location = start_location + tree_field(ref._tree, ref._offset, 2);");
+        } else if (relative) {
+            // A relative node is [next sibling, gap after this node (if there
+            // is a next sibling), length, choice?, slots...], where each slot
+            // is [offset, start relative to this node (if non-empty)].  Its own
+            // start comes from the ref.
+            output_line(out, "    size_t offset = ref._offset;");
+            output_line(out, "    if (read_tree(&offset, ref._tree) != 0)");
+            output_line(out, "        read_tree(&offset, ref._tree); // Read and ignore the 'next gap' field.");
+            output_line(out, "    size_t start_location = ref._start;");
+            if (rule->is_token) {
+                output_line(out, "    size_t token_offset = follow_link(ref._tree, ref._offset, read_tree(&offset, ref._tree));");
+                output_line(out, "    read_tree(&token_offset, ref._tree);");
+                output_line(out, "    read_tree(&token_offset, ref._tree);");
+                output_line(out, "    size_t end_location = start_location + read_tree(&token_offset, ref._tree);");
+                if (rule->token_type == RULE_TOKEN_STRING) {
+                    output_line(out, "    size_t string_offset = read_tree(&token_offset, ref._tree);");
+                    output_line(out, "    const char *string = string_offset ?");
+                    output_line(out, "     (const char *)ref._tree->parse_tree + string_offset : ref._tree->string + start_location + 1;");
+                    output_line(out, "    size_t string_length = string_offset ?");
+                    output_line(out, "     read_tree(&token_offset, ref._tree) : end_location - start_location - 2;");
+                }
+            } else
+                output_line(out, "    size_t end_location = start_location + read_tree(&offset, ref._tree);");
         } else {
-            output_line(out, "    size_t start_location = read_tree(&offset, ref._tree);");
-            output_line(out, "    size_t end_location = start_location + read_tree(&offset, ref._tree);");
+            output_line(out, "    size_t offset = ref._offset;");
+            output_line(out, "    read_tree(&offset, ref._tree); // Read and ignore the 'next offset' field.");
+            if (rule->is_token) {
+                output_line(out, "    size_t token_offset = read_child_offset(&offset, ref);");
+                output_line(out, "    read_tree(&token_offset, ref._tree);");
+                output_line(out, "    size_t start_location = read_tree(&token_offset, ref._tree);");
+                output_line(out, "    size_t end_location = start_location + read_tree(&token_offset, ref._tree);");
+                if (rule->token_type == RULE_TOKEN_STRING) {
+                    output_line(out, "    size_t string_offset = read_tree(&token_offset, ref._tree);");
+                    output_line(out, "    const char *string = string_offset ?");
+                    output_line(out, "     (const char *)ref._tree->parse_tree + string_offset : ref._tree->string + start_location + 1;");
+                    output_line(out, "    size_t string_length = string_offset ?");
+                    output_line(out, "     read_tree(&token_offset, ref._tree) : end_location - start_location - 2;");
+                }
+            } else {
+                output_line(out, "    size_t start_location = read_tree(&offset, ref._tree);");
+                output_line(out, "    size_t end_location = start_location + read_tree(&offset, ref._tree);");
+            }
         }
         output_line(out, "    struct %%parsed_%%rule result = {");
         output_line(out, "        .range.start = start_location,");
@@ -529,21 +1118,33 @@ void generate(struct generator *gen)
                 output_line(out, "        .length = end_location - start_location,");
                 break;
             case RULE_TOKEN_INTEGER:
-                output_line(out, "        .integer = read_tree(&token_offset, ref._tree),");
+                if (fixed_width)
+                    output_line(out, "        .integer = tree_field_wide(ref._tree, token_offset, 3),");
+                else
+                    output_line(out, "        .integer = read_tree(&token_offset, ref._tree),");
                 break;
             case RULE_TOKEN_NUMBER:
-                output_line(out, "        .number = (union { double n; uint64_t v; }){ .v = read_tree(&token_offset, ref._tree) }.n,");
+                if (fixed_width)
+                    output_line(out, "        .number = (union { double n; uint64_t v; }){ .v = tree_field_wide(ref._tree, token_offset, 3) }.n,");
+                else
+                    output_line(out, "        .number = (union { double n; uint64_t v; }){ .v = read_tree(&token_offset, ref._tree) }.n,");
                 break;
             case RULE_TOKEN_STRING:
                 output_line(out, "        .string = string,");
                 output_line(out, "        .length = string_length,");
                 break;
             case RULE_TOKEN_CUSTOM:
-                output_line(out, "        .data.integer = read_tree(&token_offset, ref._tree),");
+                if (fixed_width)
+                    output_line(out, "        .data.integer = tree_field_wide(ref._tree, token_offset, 3),");
+                else
+                    output_line(out, "        .data.integer = read_tree(&token_offset, ref._tree),");
                 break;
             }
         }
-        if (rule->number_of_choices > 0)
+        set_unsigned_number_substitution(out, "type-field", type_field);
+        if (rule->number_of_choices > 0 && fixed_width)
+            output_line(out, "        .type = (enum %%parsed_type)tree_field(ref._tree, ref._offset, %%type-field),");
+        else if (rule->number_of_choices > 0)
             output_line(out, "        .type = (enum %%parsed_type)read_tree(&offset, ref._tree),");
         output_line(out, "    };");
         for (uint32_t j = 0; j < rule->number_of_slots; ++j) {
@@ -552,58 +1153,72 @@ void generate(struct generator *gen)
              slot.name_length, LOWERCASE_WITH_UNDERSCORES);
             set_unsigned_number_substitution(out, "referenced-slot-type",
              slot.rule_index);
+            set_unsigned_number_substitution(out, "slot-field",
+             first_slot_field + j);
+            if (relative) {
+                output_line(out, "    result.%%referenced-slot = read_slot(&offset, ref, start_location, %%referenced-slot-type);");
+                continue;
+            }
             output_line(out, "    result.%%referenced-slot._tree = ref._tree;");
-            output_line(out, "    result.%%referenced-slot._offset = read_tree(&offset, ref._tree);");
+            if (fixed_width)
+                output_line(out, "    result.%%referenced-slot._offset = tree_field(ref._tree, ref._offset, %%slot-field);");
+            else
+                output_line(out, "    result.%%referenced-slot._offset = read_child_offset(&offset, ref);");
             output_line(out, "    result.%%referenced-slot._type = %%referenced-slot-type;");
             output_line(out, "    result.%%referenced-slot.empty = result.%%referenced-slot._offset == 0;");
         }
         output_line(out, "    return result;");
         output_line(out, "}");
     }
-    output_line(out, "static size_t finish_node(uint32_t rule, uint32_t choice, "
-     "size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, void *info) {");
-    output_line(out, "    struct %%prefix_tree *tree = info;");
-    output_line(out, "    size_t offset = tree->next_offset;");
-    output_line(out, "    write_tree(tree, next_sibling ? offset - next_sibling : 0);");
-    output_line(out, "    write_tree(tree, start_location);");
-    output_line(out, "    write_tree(tree, end_location - start_location);");
-    output_line(out, "    switch (rule) {");
-    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
-        struct rule *rule = gen->grammar->rules[i];
-        if (rule->is_token)
-            continue;
-        set_unsigned_number_substitution(out, "rule-index", i);
-        output_line(out, "    case %%rule-index: {");
-        if (rule->number_of_choices > 0) {
+    uint32_t max_slots = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        if (gen->grammar->rules[i]->number_of_slots > max_slots)
+            max_slots = gen->grammar->rules[i]->number_of_slots;
+    }
+    set_unsigned_number_substitution(out, "max-slots", max_slots + 1);
+    output_line(out, "static size_t number_of_slots_lookup(uint32_t rule, void *context);");
+    output_line(out, "#ifdef OWL_BUILDER");
+    output_line(out, "static size_t build_node(uint32_t rule, uint32_t choice, "
+     "size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, struct %%prefix_tree *tree) {");
+    output_line(out, "    void *children[%%max-slots];");
+    output_line(out, "    size_t number_of_slots = number_of_slots_lookup(rule, tree);");
+    output_line(out, "    for (size_t i = 0; i < number_of_slots; ++i)");
+    output_line(out, "        children[i] = (void *)(uintptr_t)slots[i];");
+    output_line(out, "    struct %%prefix_match match = {");
+    output_line(out, "        .rule = (enum %%prefix_rule)rule,");
+    output_line(out, "        .range = { start_location, end_location },");
+    output_line(out, "        .slots = children,");
+    output_line(out, "    };");
+    if (choice_index > 0) {
+        output_line(out, "    switch (rule) {");
+        for (uint32_t i = 0; i < n; ++i) {
+            struct rule *rule = gen->grammar->rules[i];
+            if (rule->is_token || rule->number_of_choices == 0)
+                continue;
+            set_unsigned_number_substitution(out, "rule-index", i);
+            output_line(out, "    case %%rule-index:");
             output_line(out, "        switch (choice) {");
-            for (uint32_t i = 0; i < rule->number_of_choices; ++i) {
-                set_unsigned_number_substitution(out, "choice-index", i);
-                set_substitution(out, "choice-name", rule->choices[i].name,
-                 rule->choices[i].name_length, UPPERCASE_WITH_UNDERSCORES);
+            for (uint32_t j = 0; j < rule->number_of_choices; ++j) {
+                set_unsigned_number_substitution(out, "choice-index", j);
+                set_substitution(out, "choice-name", rule->choices[j].name,
+                 rule->choices[j].name_length, UPPERCASE_WITH_UNDERSCORES);
                 output_line(out, "        case %%choice-index:");
-                output_line(out, "            write_tree(tree, %%PARSED_%%choice-name);");
+                output_line(out, "            match.type = %%PARSED_%%choice-name;");
                 output_line(out, "            break;");
             }
             output_line(out, "        }");
+            output_line(out, "        break;");
         }
-        for (uint32_t j = 0; j < rule->number_of_slots; ++j) {
-            set_unsigned_number_substitution(out, "slot-index", j);
-            output_line(out, "        write_tree(tree, slots[%%slot-index]);");
-        }
+        output_line(out, "    default:");
         output_line(out, "        break;");
         output_line(out, "    }");
     }
-    output_line(out, "    default:");
-    output_line(out, "        break;");
-    output_line(out, "    }");
-    output_line(out, "    return offset;");
+    output_line(out, "    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);");
     output_line(out, "}");
-    output_line(out, "static size_t finish_token(uint32_t rule, size_t next_sibling, void *info) {");
-    output_line(out, "    struct %%prefix_tree *tree = info;");
-    output_line(out, "    size_t offset = tree->next_offset;");
-    output_line(out, "    write_tree(tree, next_sibling ? offset - next_sibling : 0);");
+    output_line(out, "static size_t build_token(uint32_t rule, size_t next_sibling, struct %%prefix_tree *tree) {");
+    output_line(out, "    struct %%prefix_match match = { .rule = (enum %%prefix_rule)rule };");
     output_line(out, "    switch (rule) {");
-    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
+    for (uint32_t i = 0; i < n; ++i) {
         struct rule *rule = gen->grammar->rules[i];
         if (!rule->is_token)
             continue;
@@ -615,55 +1230,569 @@ void generate(struct generator *gen)
              LOWERCASE_WITH_UNDERSCORES);
         }
         output_line(out, "    case %%rule-index: {");
-        output_line(out, "        size_t offset%%rule-index = tree->next_%%rule_token_offset;");
-        output_line(out, "        if (offset%%rule-index == 0)");
+        output_line(out, "        size_t offset = tree->next_%%rule_token_offset;");
+        output_line(out, "        if (offset == 0)");
         output_line(out, "            abort();");
-        output_line(out, "        write_tree(tree, offset%%rule-index);");
-        output_line(out, "        tree->next_%%rule_token_offset = offset%%rule-index;");
-        output_line(out, "        tree->next_%%rule_token_offset -= read_tree(&offset%%rule-index, tree);");
+        output_line(out, "        tree->next_%%rule_token_offset -= read_tree(&offset, tree);");
+        if (relative) {
+            output_line(out, "        match.range.start = tree->next_%%rule_token_location;");
+            output_line(out, "        tree->next_%%rule_token_location -= read_tree(&offset, tree);");
+        } else
+            output_line(out, "        match.range.start = read_tree(&offset, tree);");
+        output_line(out, "        match.range.end = match.range.start + read_tree(&offset, tree);");
+        switch (rule->token_type) {
+        case RULE_TOKEN_IDENTIFIER:
+            output_line(out, "        match.identifier = tree->string + match.range.start;");
+            output_line(out, "        match.length = match.range.end - match.range.start;");
+            break;
+        case RULE_TOKEN_INTEGER:
+            output_line(out, "        match.integer = %%read-tree-wide(&offset, tree);");
+            break;
+        case RULE_TOKEN_NUMBER:
+            output_line(out, "        match.number = (union { double n; uint64_t v; }){ .v = %%read-tree-wide(&offset, tree) }.n;");
+            break;
+        case RULE_TOKEN_STRING:
+            output_line(out, "        size_t string_offset = read_tree(&offset, tree);");
+            output_line(out, "        if (string_offset) {");
+            output_line(out, "            match.string = (const char *)tree->parse_tree + string_offset;");
+            output_line(out, "            match.length = read_tree(&offset, tree);");
+            output_line(out, "        } else {");
+            output_line(out, "            match.string = tree->string + match.range.start + 1;");
+            output_line(out, "            match.length = match.range.end - match.range.start - 2;");
+            output_line(out, "        }");
+            break;
+        case RULE_TOKEN_CUSTOM:
+            output_line(out, "        match.data.integer = %%read-tree-wide(&offset, tree);");
+            break;
+        }
         output_line(out, "        break;");
         output_line(out, "    }");
     }
     output_line(out, "    default:");
     output_line(out, "        break;");
     output_line(out, "    }");
-    output_line(out, "    return offset;");
+    output_line(out, "    return (size_t)(uintptr_t)tree->builder->build(&match, (void *)(uintptr_t)next_sibling, tree->builder->info);");
     output_line(out, "}");
-    output_line(out, "static void check_for_error(struct %%prefix_tree *tree) {");
-    output_line(out, "    if (tree->error == ERROR_NONE)");
-    output_line(out, "        return;");
-    output_line(out, "    fprintf(stderr, \"parse error: \");");
-    output_line(out, "    switch (tree->error) {");
-    output_line(out, "    case ERROR_INVALID_FILE:");
-    output_line(out, "        fprintf(stderr, \"invalid file\\n\");");
-    output_line(out, "        break;");
-    output_line(out, "    case ERROR_INVALID_OPTIONS:");
-    output_line(out, "        fprintf(stderr, \"invalid options\\n\");");
-    output_line(out, "        break;");
-    output_line(out, "    case ERROR_INVALID_TOKEN:");
-    output_line(out, "        fprintf(stderr, \"invalid token '%.*s'\\n\", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);");
-    output_line(out, "        break;");
-    output_line(out, "    case ERROR_UNEXPECTED_TOKEN:");
-    output_line(out, "        fprintf(stderr, \"unexpected token '%.*s'\\n\", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);");
-    output_line(out, "        break;");
-    output_line(out, "    case ERROR_MORE_INPUT_NEEDED:");
-    output_line(out, "        fprintf(stderr, \"more input needed\\n\");");
-    output_line(out, "        break;");
-    output_line(out, "    default:");
-    output_line(out, "        break;");
+    output_line(out, "#endif");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "static void grow_match_list(struct %%prefix_tree *tree, struct match_list *list, size_t capacity)");
+    output_line(out, "{");
+    output_line(out, "    size_t n = list->capacity;");
+    output_line(out, "    struct %%prefix_ref *matches = reallocate_memory(list->matches,");
+    output_line(out, "     n * sizeof(struct %%prefix_ref), capacity * sizeof(struct %%prefix_ref), &tree->allocator);");
+    output_line(out, "    if (!matches)");
+    output_line(out, "        abort();");
+    output_line(out, "    list->matches = matches;");
+    output_line(out, "    size_t *starts = reallocate_memory(list->starts,");
+    output_line(out, "     n * sizeof(size_t), capacity * sizeof(size_t), &tree->allocator);");
+    output_line(out, "    if (!starts)");
+    output_line(out, "        abort();");
+    output_line(out, "    list->starts = starts;");
+    output_line(out, "    if (list->keeps_ends) {");
+    output_line(out, "        size_t *ends = reallocate_memory(list->ends,");
+    output_line(out, "         n * sizeof(size_t), capacity * sizeof(size_t), &tree->allocator);");
+    output_line(out, "        if (!ends)");
+    output_line(out, "            abort();");
+    output_line(out, "        list->ends = ends;");
     output_line(out, "    }");
-    output_line(out, "    exit(-1);");
+    output_line(out, "    list->capacity = capacity;");
     output_line(out, "}");
-    // Only generate print functions that will actually be called (mostly to
-    // avoid compiler warnings).
-    struct bitset printable_rules = bitset_create_empty(n);
-    bitset_add(&printable_rules, gen->grammar->root_rule);
+    output_line(out, "// Matches are added in the order they're written to the tree: from the end of");
+    output_line(out, "// the input to the start while it's built, and from the start to the end while");
+    output_line(out, "// it's compacted.  Operators finish their operands a little out of order, so");
+    output_line(out, "// each match is moved back past any later ones, up to this many places.");
+    output_line(out, "// Matches which are further out of place are set aside until the tree is");
+    output_line(out, "// finished.");
+    output_line(out, "#define MATCH_LIST_SHIFT_LIMIT 16");
+    output_line(out, "static void add_to_match_list(struct %%prefix_tree *tree, struct match_list *list, struct %%prefix_ref ref, size_t start_location, size_t end_location)");
+    output_line(out, "{");
+    output_line(out, "    size_t n = list->count;");
+    output_line(out, "    if (n == list->capacity)");
+    output_line(out, "        grow_match_list(tree, list, n * 2 + 16);");
+    output_line(out, "    struct %%prefix_ref *matches = list->matches;");
+    output_line(out, "    size_t *starts = list->starts;");
+    output_line(out, "    size_t i = n;");
+    output_line(out, "    while (i > 0 &&");
+    output_line(out, "     (tree->compacted ? starts[i - 1] > start_location : starts[i - 1] < start_location)) {");
+    output_line(out, "        if (n - i == MATCH_LIST_SHIFT_LIMIT) {");
+    output_line(out, "            if (list->late_count == list->late_capacity) {");
+    output_line(out, "                size_t capacity = list->late_capacity * 2 + 16;");
+    output_line(out, "                struct match_to_sort *late = reallocate_memory(list->late,");
+    output_line(out, "                 list->late_capacity * sizeof(struct match_to_sort),");
+    output_line(out, "                 capacity * sizeof(struct match_to_sort), &tree->allocator);");
+    output_line(out, "                if (!late)");
+    output_line(out, "                    abort();");
+    output_line(out, "                list->late = late;");
+    output_line(out, "                list->late_capacity = capacity;");
+    output_line(out, "            }");
+    output_line(out, "            list->late[list->late_count++] = (struct match_to_sort){");
+    output_line(out, "                .start = start_location,");
+    output_line(out, "                .end = end_location,");
+    output_line(out, "                .ref = ref,");
+    output_line(out, "            };");
+    output_line(out, "            return;");
+    output_line(out, "        }");
+    output_line(out, "        i--;");
+    output_line(out, "    }");
+    output_line(out, "    memmove(matches + i + 1, matches + i, (n - i) * sizeof(struct %%prefix_ref));");
+    output_line(out, "    memmove(starts + i + 1, starts + i, (n - i) * sizeof(size_t));");
+    output_line(out, "    matches[i] = ref;");
+    output_line(out, "    starts[i] = start_location;");
+    output_line(out, "    if (list->keeps_ends) {");
+    output_line(out, "        memmove(list->ends + i + 1, list->ends + i, (n - i) * sizeof(size_t));");
+    output_line(out, "        list->ends[i] = end_location;");
+    output_line(out, "    }");
+    output_line(out, "    list->count = n + 1;");
+    output_line(out, "}");
+    output_line(out, "// Returns the list of matches for a named option of a rule, or zero if the");
+    output_line(out, "// rule doesn't have that option.");
+    output_line(out, "static uint32_t option_list(uint32_t rule, uint32_t type)");
+    output_line(out, "{");
+    output_line(out, "    switch (rule) {");
+    uint32_t option_list = n;
     for (uint32_t i = 0; i < n; ++i) {
         struct rule *rule = gen->grammar->rules[i];
-        for (uint32_t j = 0; j < rule->number_of_slots; ++j)
-            bitset_add(&printable_rules, rule->slots[j].rule_index);
-    }
-    for (uint32_t i = 0; i < n; ++i) {
+        if (rule->number_of_choices == 0)
+            continue;
+        set_unsigned_number_substitution(out, "rule-index", i);
+        output_line(out, "    case %%rule-index:");
+        output_line(out, "        switch (type) {");
+        for (uint32_t j = 0; j < rule->number_of_choices; ++j) {
+            set_substitution(out, "choice-name", rule->choices[j].name,
+             rule->choices[j].name_length, UPPERCASE_WITH_UNDERSCORES);
+            set_unsigned_number_substitution(out, "option-list", option_list++);
+            output_line(out, "        case %%PARSED_%%choice-name:");
+            output_line(out, "            return %%option-list;");
+        }
+        output_line(out, "        }");
+        output_line(out, "        break;");
+    }
+    output_line(out, "    default:");
+    output_line(out, "        break;");
+    output_line(out, "    }");
+    output_line(out, "    return 0;");
+    output_line(out, "}");
+    output_line(out, "static void index_match(struct %%prefix_tree *tree, uint32_t rule, uint32_t type, size_t offset, size_t start_location, size_t end_location)");
+    output_line(out, "{");
+    output_line(out, "    struct %%prefix_ref ref = {");
+    output_line(out, "        ._tree = tree,");
+    output_line(out, "        ._offset = offset,");
+    if (relative)
+        output_line(out, "        ._start = start_location,");
+    output_line(out, "        ._type = rule,");
+    output_line(out, "    };");
+    output_line(out, "    if (tree->rule_index) {");
+    output_line(out, "        add_to_match_list(tree, &tree->rule_index->lists[rule], ref, start_location, end_location);");
+    output_line(out, "        uint32_t list = option_list(rule, type);");
+    output_line(out, "        if (list)");
+    output_line(out, "            add_to_match_list(tree, &tree->rule_index->lists[list], ref, start_location, end_location);");
+    output_line(out, "    }");
+    output_line(out, "    if (tree->location_index)");
+    output_line(out, "        add_to_match_list(tree, &tree->location_index->nodes, ref, start_location, end_location);");
+    output_line(out, "}");
+    output_line(out, "// Matches that start at the same place are nested, so the outer one comes");
+    output_line(out, "// first.  It's written after the inner one while the tree is built, and before");
+    output_line(out, "// it while the tree is compacted.");
+    output_line(out, "static inline bool match_precedes(const struct match_to_sort *a, const struct match_to_sort *b)");
+    output_line(out, "{");
+    output_line(out, "    if (a->start != b->start)");
+    output_line(out, "        return a->start < b->start;");
+    output_line(out, "    return (a->ref._offset < b->ref._offset) == a->ref._tree->compacted;");
+    output_line(out, "}");
+    output_line(out, "// Sorts matches by merging the runs which are already in order.  A long chain");
+    output_line(out, "// of operators can finish its operands in the opposite order to everything");
+    output_line(out, "// else, so runs in reverse order are turned around first.");
+    output_line(out, "static void sort_matches(struct %%prefix_tree *tree, struct match_to_sort *matches, size_t n)");
+    output_line(out, "{");
+    output_line(out, "    size_t size = n * sizeof(struct match_to_sort);");
+    output_line(out, "    struct match_to_sort *sorting = matches;");
+    output_line(out, "    struct match_to_sort *merged = allocate_memory(size, &tree->allocator);");
+    output_line(out, "    size_t *run_ends = allocate_memory(n * sizeof(size_t), &tree->allocator);");
+    output_line(out, "    if (!merged || !run_ends)");
+    output_line(out, "        abort();");
+    output_line(out, "    size_t number_of_runs = 0;");
+    output_line(out, "    for (size_t i = 0; i < n; ) {");
+    output_line(out, "        size_t j = i + 1;");
+    output_line(out, "        if (j < n && match_precedes(&sorting[j], &sorting[i])) {");
+    output_line(out, "            while (j < n && match_precedes(&sorting[j], &sorting[j - 1]))");
+    output_line(out, "                j++;");
+    output_line(out, "            for (size_t a = i, b = j - 1; a < b; ++a, --b) {");
+    output_line(out, "                struct match_to_sort match = sorting[a];");
+    output_line(out, "                sorting[a] = sorting[b];");
+    output_line(out, "                sorting[b] = match;");
+    output_line(out, "            }");
+    output_line(out, "        } else {");
+    output_line(out, "            while (j < n && match_precedes(&sorting[j - 1], &sorting[j]))");
+    output_line(out, "                j++;");
+    output_line(out, "        }");
+    output_line(out, "        run_ends[number_of_runs++] = j;");
+    output_line(out, "        i = j;");
+    output_line(out, "    }");
+    output_line(out, "    while (number_of_runs > 1) {");
+    output_line(out, "        size_t runs = 0;");
+    output_line(out, "        size_t start = 0;");
+    output_line(out, "        for (size_t r = 0; r < number_of_runs; r += 2) {");
+    output_line(out, "            size_t middle = run_ends[r];");
+    output_line(out, "            size_t end = r + 1 < number_of_runs ? run_ends[r + 1] : middle;");
+    output_line(out, "            size_t a = start;");
+    output_line(out, "            size_t b = middle;");
+    output_line(out, "            size_t k = start;");
+    output_line(out, "            while (a < middle && b < end)");
+    output_line(out, "                merged[k++] = match_precedes(&sorting[b], &sorting[a]) ? sorting[b++] : sorting[a++];");
+    output_line(out, "            memcpy(merged + k, sorting + a, (middle - a) * sizeof(struct match_to_sort));");
+    output_line(out, "            k += middle - a;");
+    output_line(out, "            memcpy(merged + k, sorting + b, (end - b) * sizeof(struct match_to_sort));");
+    output_line(out, "            run_ends[runs++] = end;");
+    output_line(out, "            start = end;");
+    output_line(out, "        }");
+    output_line(out, "        struct match_to_sort *swap = sorting;");
+    output_line(out, "        sorting = merged;");
+    output_line(out, "        merged = swap;");
+    output_line(out, "        number_of_runs = runs;");
+    output_line(out, "    }");
+    output_line(out, "    if (sorting != matches) {");
+    output_line(out, "        memcpy(matches, sorting, size);");
+    output_line(out, "        merged = sorting;");
+    output_line(out, "    }");
+    output_line(out, "    free_memory(merged, size, &tree->allocator);");
+    output_line(out, "    free_memory(run_ends, n * sizeof(size_t), &tree->allocator);");
+    output_line(out, "}");
+    output_line(out, "// Puts a list of matches in source order once the tree is finished.");
+    output_line(out, "static void finish_match_list(struct %%prefix_tree *tree, struct match_list *list)");
+    output_line(out, "{");
+    output_line(out, "    size_t n = list->count;");
+    output_line(out, "    if (!tree->compacted) {");
+    output_line(out, "        for (size_t j = 0; j < n / 2; ++j) {");
+    output_line(out, "            struct %%prefix_ref match = list->matches[j];");
+    output_line(out, "            list->matches[j] = list->matches[n - 1 - j];");
+    output_line(out, "            list->matches[n - 1 - j] = match;");
+    output_line(out, "            size_t start = list->starts[j];");
+    output_line(out, "            list->starts[j] = list->starts[n - 1 - j];");
+    output_line(out, "            list->starts[n - 1 - j] = start;");
+    output_line(out, "            if (list->keeps_ends) {");
+    output_line(out, "                size_t end = list->ends[j];");
+    output_line(out, "                list->ends[j] = list->ends[n - 1 - j];");
+    output_line(out, "                list->ends[n - 1 - j] = end;");
+    output_line(out, "            }");
+    output_line(out, "        }");
+    output_line(out, "    }");
+    output_line(out, "    size_t number_of_late = list->late_count;");
+    output_line(out, "    if (number_of_late == 0)");
+    output_line(out, "        return;");
+    output_line(out, "    sort_matches(tree, list->late, number_of_late);");
+    output_line(out, "    if (n + number_of_late > list->capacity)");
+    output_line(out, "        grow_match_list(tree, list, n + number_of_late);");
+    output_line(out, "    // Merge the late matches in from the back, so nothing is overwritten");
+    output_line(out, "    // before it's moved.");
+    output_line(out, "    size_t i = n;");
+    output_line(out, "    size_t j = number_of_late;");
+    output_line(out, "    while (j > 0) {");
+    output_line(out, "        size_t k = i + j - 1;");
+    output_line(out, "        struct match_to_sort match = list->late[j - 1];");
+    output_line(out, "        if (i > 0) {");
+    output_line(out, "            struct match_to_sort last = {");
+    output_line(out, "                .start = list->starts[i - 1],");
+    output_line(out, "                .end = list->keeps_ends ? list->ends[i - 1] : 0,");
+    output_line(out, "                .ref = list->matches[i - 1],");
+    output_line(out, "            };");
+    output_line(out, "            if (match_precedes(&match, &last)) {");
+    output_line(out, "                match = last;");
+    output_line(out, "                i--;");
+    output_line(out, "            } else");
+    output_line(out, "                j--;");
+    output_line(out, "        } else");
+    output_line(out, "            j--;");
+    output_line(out, "        list->matches[k] = match.ref;");
+    output_line(out, "        list->starts[k] = match.start;");
+    output_line(out, "        if (list->keeps_ends)");
+    output_line(out, "            list->ends[k] = match.end;");
+    output_line(out, "    }");
+    output_line(out, "    list->count = n + number_of_late;");
+    output_line(out, "    list->late_count = 0;");
+    output_line(out, "}");
+    output_line(out, "static size_t furthest_end(const struct location_index *index, size_t k)");
+    output_line(out, "{");
+    output_line(out, "    if (k < index->number_of_leaves)");
+    output_line(out, "        return index->furthest_ends[k];");
+    output_line(out, "    k -= index->number_of_leaves;");
+    output_line(out, "    return k < index->nodes.count ? index->nodes.ends[k] : 0;");
+    output_line(out, "}");
+    output_line(out, "static void finish_indexes(struct %%prefix_tree *tree)");
+    output_line(out, "{");
+    output_line(out, "    if (tree->rule_index) {");
+    output_line(out, "        for (uint32_t i = 0; i < %%number-of-match-lists; ++i)");
+    output_line(out, "            finish_match_list(tree, &tree->rule_index->lists[i]);");
+    output_line(out, "    }");
+    output_line(out, "    struct location_index *index = tree->location_index;");
+    output_line(out, "    if (!index)");
+    output_line(out, "        return;");
+    output_line(out, "    finish_match_list(tree, &index->nodes);");
+    output_line(out, "    size_t leaves = 1;");
+    output_line(out, "    while (leaves < index->nodes.count)");
+    output_line(out, "        leaves *= 2;");
+    output_line(out, "    if (leaves > index->furthest_ends_capacity) {");
+    output_line(out, "        size_t *furthest_ends = reallocate_memory(index->furthest_ends,");
+    output_line(out, "         index->furthest_ends_capacity * sizeof(size_t), leaves * sizeof(size_t), &tree->allocator);");
+    output_line(out, "        if (!furthest_ends)");
+    output_line(out, "            abort();");
+    output_line(out, "        index->furthest_ends = furthest_ends;");
+    output_line(out, "        index->furthest_ends_capacity = leaves;");
+    output_line(out, "    }");
+    output_line(out, "    index->number_of_leaves = leaves;");
+    output_line(out, "    for (size_t k = leaves - 1; k > 0; --k) {");
+    output_line(out, "        size_t left = furthest_end(index, 2 * k);");
+    output_line(out, "        size_t right = furthest_end(index, 2 * k + 1);");
+    output_line(out, "        index->furthest_ends[k] = left > right ? left : right;");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "// Empties the indexes before a tree is rebuilt, keeping their memory.");
+    output_line(out, "static void clear_indexes(struct %%prefix_tree *tree)");
+    output_line(out, "{");
+    output_line(out, "    if (tree->rule_index) {");
+    output_line(out, "        for (uint32_t i = 0; i < %%number-of-match-lists; ++i) {");
+    output_line(out, "            tree->rule_index->lists[i].count = 0;");
+    output_line(out, "            tree->rule_index->lists[i].late_count = 0;");
+    output_line(out, "        }");
+    output_line(out, "    }");
+    output_line(out, "    if (tree->location_index) {");
+    output_line(out, "        tree->location_index->nodes.count = 0;");
+    output_line(out, "        tree->location_index->nodes.late_count = 0;");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    if (split_root) {
+        output_line(out, "#ifdef OWL_THREADS");
+        output_line(out, "struct logged_node {");
+        output_line(out, "    // Replaced with the node's offset in the tree once it's been written.");
+        output_line(out, "    size_t next_sibling;");
+        output_line(out, "    size_t start_location;");
+        output_line(out, "    size_t end_location;");
+        output_line(out, "    uint32_t rule;");
+        output_line(out, "    // UINT32_MAX for tokens.");
+        output_line(out, "    uint32_t choice;");
+        output_line(out, "};");
+        output_line(out, "// The nodes and tokens finished by a worker thread, in the order they were");
+        output_line(out, "// finished.  Their slots are kept one after another in `slots`.");
+        output_line(out, "struct node_log {");
+        output_line(out, "    struct logged_node *nodes;");
+        output_line(out, "    size_t number_of_nodes;");
+        output_line(out, "    size_t nodes_capacity;");
+        output_line(out, "    size_t *slots;");
+        output_line(out, "    size_t number_of_slots;");
+        output_line(out, "    size_t slots_capacity;");
+        output_line(out, "    struct owl_allocator *allocator;");
+        output_line(out, "};");
+        output_line(out, "// Returns the node's index in the log plus one, which stands in for its");
+        output_line(out, "// offset until the log is replayed.");
+        output_line(out, "static size_t log_node(struct node_log *log, struct logged_node node, size_t *slots, size_t number_of_slots) {");
+        output_line(out, "    if (log->number_of_nodes >= log->nodes_capacity) {");
+        output_line(out, "        size_t capacity = (log->nodes_capacity + 64) * 2;");
+        output_line(out, "        struct logged_node *nodes = reallocate_memory(log->nodes, log->nodes_capacity * sizeof(struct logged_node), capacity * sizeof(struct logged_node), log->allocator);");
+        output_line(out, "        if (!nodes)");
+        output_line(out, "            abort();");
+        output_line(out, "        log->nodes = nodes;");
+        output_line(out, "        log->nodes_capacity = capacity;");
+        output_line(out, "    }");
+        output_line(out, "    if (log->number_of_slots + number_of_slots > log->slots_capacity) {");
+        output_line(out, "        size_t capacity = (log->number_of_slots + number_of_slots + 64) * 2;");
+        output_line(out, "        size_t *new_slots = reallocate_memory(log->slots, log->slots_capacity * sizeof(size_t), capacity * sizeof(size_t), log->allocator);");
+        output_line(out, "        if (!new_slots)");
+        output_line(out, "            abort();");
+        output_line(out, "        log->slots = new_slots;");
+        output_line(out, "        log->slots_capacity = capacity;");
+        output_line(out, "    }");
+        output_line(out, "    if (number_of_slots > 0)");
+        output_line(out, "        memcpy(log->slots + log->number_of_slots, slots, number_of_slots * sizeof(size_t));");
+        output_line(out, "    log->number_of_slots += number_of_slots;");
+        output_line(out, "    log->nodes[log->number_of_nodes++] = node;");
+        output_line(out, "    return log->number_of_nodes;");
+        output_line(out, "}");
+        output_line(out, "static void free_node_log(struct node_log *log) {");
+        output_line(out, "    free_memory(log->nodes, log->nodes_capacity * sizeof(struct logged_node), log->allocator);");
+        output_line(out, "    free_memory(log->slots, log->slots_capacity * sizeof(size_t), log->allocator);");
+        output_line(out, "}");
+        output_line(out, "#endif");
+    }
+    output_line(out, "static size_t finish_node(uint32_t rule, uint32_t choice, "
+     "size_t next_sibling, size_t *slots, size_t start_location, size_t end_location, void *info) {");
+    output_line(out, "    struct %%prefix_tree *tree = info;");
+    if (split_root) {
+        output_line(out, "#ifdef OWL_THREADS");
+        output_line(out, "    if (tree->node_log)");
+        output_line(out, "        return log_node(tree->node_log, (struct logged_node){ next_sibling, start_location, end_location, rule, choice }, slots, number_of_slots_lookup(rule, tree));");
+        output_line(out, "#endif");
+    }
+    output_line(out, "#ifdef OWL_BUILDER");
+    output_line(out, "    if (tree->builder)");
+    output_line(out, "        return build_node(rule, choice, next_sibling, slots, start_location, end_location, tree);");
+    output_line(out, "#endif");
+    output_line(out, "    size_t offset = tree->next_offset;");
+    output_line(out, "    uint32_t type = 0;");
+    output_line(out, "    write_tree(tree, next_sibling ? offset - next_sibling : 0);");
+    if (relative) {
+        output_line(out, "    if (next_sibling)");
+        output_line(out, "        write_tree(tree, take_start(tree, next_sibling) - end_location);");
+    } else
+        output_line(out, "    write_tree(tree, start_location);");
+    output_line(out, "    write_tree(tree, end_location - start_location);");
+    output_line(out, "    switch (rule) {");
+    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
+        struct rule *rule = gen->grammar->rules[i];
+        if (rule->is_token)
+            continue;
+        set_unsigned_number_substitution(out, "rule-index", i);
+        output_line(out, "    case %%rule-index: {");
+        if (rule->number_of_choices > 0) {
+            output_line(out, "        switch (choice) {");
+            for (uint32_t i = 0; i < rule->number_of_choices; ++i) {
+                set_unsigned_number_substitution(out, "choice-index", i);
+                set_substitution(out, "choice-name", rule->choices[i].name,
+                 rule->choices[i].name_length, UPPERCASE_WITH_UNDERSCORES);
+                output_line(out, "        case %%choice-index:");
+                output_line(out, "            type = %%PARSED_%%choice-name;");
+                output_line(out, "            break;");
+            }
+            output_line(out, "        }");
+            output_line(out, "        write_tree(tree, type);");
+        }
+        for (uint32_t j = 0; j < rule->number_of_slots; ++j) {
+            set_unsigned_number_substitution(out, "slot-index", j);
+            if (relative)
+                output_line(out, "        write_slot(tree, offset, start_location, slots[%%slot-index]);");
+            else
+                output_line(out, "        write_tree(tree, slots[%%slot-index]);");
+        }
+        output_line(out, "        break;");
+        output_line(out, "    }");
+    }
+    output_line(out, "    default:");
+    output_line(out, "        break;");
+    output_line(out, "    }");
+    if (relative)
+        output_line(out, "    push_start(tree, offset, start_location);");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "    if (tree->rule_index || tree->location_index)");
+    output_line(out, "        index_match(tree, rule, type, offset, start_location, end_location);");
+    output_line(out, "#else");
+    output_line(out, "    (void)type;");
+    output_line(out, "#endif");
+    output_line(out, "    return offset;");
+    output_line(out, "}");
+    output_line(out, "static size_t finish_token(uint32_t rule, size_t next_sibling, void *info) {");
+    output_line(out, "    struct %%prefix_tree *tree = info;");
+    if (split_root) {
+        output_line(out, "#ifdef OWL_THREADS");
+        output_line(out, "    if (tree->node_log)");
+        output_line(out, "        return log_node(tree->node_log, (struct logged_node){ .next_sibling = next_sibling, .rule = rule, .choice = UINT32_MAX }, 0, 0);");
+        output_line(out, "#endif");
+    }
+    output_line(out, "#ifdef OWL_BUILDER");
+    output_line(out, "    if (tree->builder)");
+    output_line(out, "        return build_token(rule, next_sibling, tree);");
+    output_line(out, "#endif");
+    output_line(out, "    size_t offset = tree->next_offset;");
+    if (relative) {
+        // The next sibling's position is relative to the end of this token, so
+        // the token record has to be read before anything is written.
+        output_line(out, "    size_t token_offset = 0;");
+        output_line(out, "    size_t start_location = 0;");
+        output_line(out, "    size_t end_location = 0;");
+    } else {
+        output_line(out, "#ifdef OWL_INDEX");
+        output_line(out, "    size_t start_location = 0;");
+        output_line(out, "    size_t end_location = 0;");
+        output_line(out, "#endif");
+        output_line(out, "    write_tree(tree, next_sibling ? offset - next_sibling : 0);");
+    }
+    output_line(out, "    switch (rule) {");
+    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
+        struct rule *rule = gen->grammar->rules[i];
+        if (!rule->is_token)
+            continue;
+        set_unsigned_number_substitution(out, "rule-index", i);
+        if (rule->token_type == RULE_TOKEN_CUSTOM)
+            set_literal_substitution(out, "rule", "custom");
+        else {
+            set_substitution(out, "rule", rule->name, rule->name_length,
+             LOWERCASE_WITH_UNDERSCORES);
+        }
+        output_line(out, "    case %%rule-index: {");
+        output_line(out, "        size_t offset%%rule-index = tree->next_%%rule_token_offset;");
+        output_line(out, "        if (offset%%rule-index == 0)");
+        output_line(out, "            abort();");
+        if (relative)
+            output_line(out, "        token_offset = offset%%rule-index;");
+        else
+            output_line(out, "        write_tree(tree, offset%%rule-index);");
+        output_line(out, "        tree->next_%%rule_token_offset = offset%%rule-index;");
+        output_line(out, "        tree->next_%%rule_token_offset -= read_tree(&offset%%rule-index, tree);");
+        if (!relative) {
+            output_line(out, "#ifdef OWL_INDEX");
+            output_line(out, "        if (tree->rule_index || tree->location_index) {");
+            output_line(out, "            start_location = read_tree(&offset%%rule-index, tree);");
+            output_line(out, "            end_location = start_location + read_tree(&offset%%rule-index, tree);");
+            output_line(out, "        }");
+            output_line(out, "#endif");
+        }
+        if (relative) {
+            output_line(out, "        start_location = tree->next_%%rule_token_location;");
+            output_line(out, "        tree->next_%%rule_token_location -= read_tree(&offset%%rule-index, tree);");
+            output_line(out, "        end_location = start_location + read_tree(&offset%%rule-index, tree);");
+        }
+        output_line(out, "        break;");
+        output_line(out, "    }");
+    }
+    output_line(out, "    default:");
+    output_line(out, "        break;");
+    output_line(out, "    }");
+    if (relative) {
+        output_line(out, "    write_tree(tree, next_sibling ? offset - next_sibling : 0);");
+        output_line(out, "    if (next_sibling)");
+        output_line(out, "        write_tree(tree, take_start(tree, next_sibling) - end_location);");
+        output_line(out, "    write_tree(tree, offset - token_offset);");
+        output_line(out, "    push_start(tree, offset, start_location);");
+    }
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "    if (tree->rule_index || tree->location_index)");
+    output_line(out, "        index_match(tree, rule, 0, offset, start_location, end_location);");
+    output_line(out, "#endif");
+    output_line(out, "    return offset;");
+    output_line(out, "}");
+    output_line(out, "static void check_for_error(struct %%prefix_tree *tree) {");
+    output_line(out, "    if (tree->error == ERROR_NONE)");
+    output_line(out, "        return;");
+    output_line(out, "    fprintf(stderr, \"parse error: \");");
+    output_line(out, "    switch (tree->error) {");
+    output_line(out, "    case ERROR_INVALID_FILE:");
+    output_line(out, "        fprintf(stderr, \"invalid file\\n\");");
+    output_line(out, "        break;");
+    output_line(out, "    case ERROR_INVALID_OPTIONS:");
+    output_line(out, "        fprintf(stderr, \"invalid options\\n\");");
+    output_line(out, "        break;");
+    output_line(out, "    case ERROR_INVALID_TOKEN:");
+    output_line(out, "        fprintf(stderr, \"invalid token '%.*s'\\n\", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);");
+    output_line(out, "        break;");
+    output_line(out, "    case ERROR_UNEXPECTED_TOKEN:");
+    output_line(out, "        fprintf(stderr, \"unexpected token '%.*s'\\n\", (int)(tree->error_range.end - tree->error_range.start), tree->string + tree->error_range.start);");
+    output_line(out, "        break;");
+    output_line(out, "    case ERROR_MORE_INPUT_NEEDED:");
+    output_line(out, "        fprintf(stderr, \"more input needed\\n\");");
+    output_line(out, "        break;");
+    output_line(out, "    default:");
+    output_line(out, "        break;");
+    output_line(out, "    }");
+    output_line(out, "    exit(-1);");
+    output_line(out, "}");
+    // Only generate print functions that will actually be called (mostly to
+    // avoid compiler warnings).
+    struct bitset printable_rules = bitset_create_empty(n);
+    bitset_add(&printable_rules, gen->grammar->root_rule);
+    for (uint32_t i = 0; i < n; ++i) {
+        struct rule *rule = gen->grammar->rules[i];
+        for (uint32_t j = 0; j < rule->number_of_slots; ++j)
+            bitset_add(&printable_rules, rule->slots[j].rule_index);
+    }
+    for (uint32_t i = 0; i < n; ++i) {
         if (!bitset_contains(&printable_rules, i))
             continue;
         struct rule *rule = gen->grammar->rules[i];
@@ -740,10 +1869,43 @@ void generate(struct generator *gen)
     output_line(out, "struct %%prefix_ref %%prefix_next(struct %%prefix_ref ref) {");
     output_line(out, "    if (ref.empty) return ref;");
     output_line(out, "    size_t offset = ref._offset;");
-    output_line(out, "    size_t delta = read_tree(&ref._offset, ref._tree);");
+    if (fixed_width)
+        output_line(out, "    size_t delta = tree_field(ref._tree, offset, 0);");
+    else
+        output_line(out, "    size_t delta = read_tree(&ref._offset, ref._tree);");
+    if (relative) {
+        // The next sibling starts a gap after the end of this node, so we need
+        // this node's length too.  Token nodes keep it in their token record.
+        output_line(out, "    size_t start = 0;");
+        output_line(out, "    if (delta != 0) {");
+        output_line(out, "        size_t gap = read_tree(&ref._offset, ref._tree);");
+        output_line(out, "        size_t length_offset = ref._offset;");
+        output_line(out, "        switch (ref._type) {");
+        bool has_tokens = false;
+        for (uint32_t i = 0; i < n; ++i) {
+            if (!gen->grammar->rules[i]->is_token)
+                continue;
+            set_unsigned_number_substitution(out, "rule-index", i);
+            output_line(out, "        case %%rule-index:");
+            has_tokens = true;
+        }
+        if (has_tokens) {
+            output_line(out, "            length_offset = follow_link(ref._tree, offset, read_tree(&ref._offset, ref._tree));");
+            output_line(out, "            read_tree(&length_offset, ref._tree);");
+            output_line(out, "            read_tree(&length_offset, ref._tree);");
+            output_line(out, "            break;");
+        }
+        output_line(out, "        default:");
+        output_line(out, "            break;");
+        output_line(out, "        }");
+        output_line(out, "        start = ref._start + read_tree(&length_offset, ref._tree) + gap;");
+        output_line(out, "    }");
+    }
     output_line(out, "    return (struct %%prefix_ref){");
     output_line(out, "        ._tree = ref._tree,");
-    output_line(out, "        ._offset = offset - delta,");
+    output_line(out, "        ._offset = follow_link(ref._tree, offset, delta),");
+    if (relative)
+        output_line(out, "        ._start = start,");
     output_line(out, "        ._type = ref._type,");
     output_line(out, "        .empty = delta == 0,");
     output_line(out, "    };");
@@ -758,6 +1920,8 @@ void generate(struct generator *gen)
     output_line(out, "    return (struct %%prefix_ref){");
     output_line(out, "        ._tree = tree,");
     output_line(out, "        ._offset = tree->root_offset,");
+    if (relative)
+        output_line(out, "        ._start = tree->root_start,");
     output_line(out, "        ._type = %%root-rule-index,");
     output_line(out, "        .empty = tree->root_offset == 0,");
     output_line(out, "    };");
@@ -768,6 +1932,85 @@ void generate(struct generator *gen)
     output_line(out, "    return %%parsed_%%root-rule_get(%%prefix_tree_root_ref(tree));");
     output_line(out, "}");
 
+    set_unsigned_number_substitution(out, "number-of-rules", n);
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "const struct %%prefix_ref *%%prefix_tree_nodes_of_rule(struct %%prefix_tree *tree, enum %%prefix_rule rule, size_t *count) {");
+    output_line(out, "    check_for_error(tree);");
+    output_line(out, "    *count = 0;");
+    output_line(out, "    if (!tree->rule_index || (uint32_t)rule >= %%number-of-rules)");
+    output_line(out, "        return 0;");
+    output_line(out, "    *count = tree->rule_index->lists[rule].count;");
+    output_line(out, "    return tree->rule_index->lists[rule].matches;");
+    output_line(out, "}");
+    if (choice_index > 0) {
+        output_line(out, "const struct %%prefix_ref *%%prefix_tree_nodes_of_option(struct %%prefix_tree *tree, enum %%prefix_rule rule, enum %%parsed_type type, size_t *count) {");
+        output_line(out, "    check_for_error(tree);");
+        output_line(out, "    *count = 0;");
+        output_line(out, "    uint32_t list = option_list(rule, type);");
+        output_line(out, "    if (!tree->rule_index || list == 0)");
+        output_line(out, "        return 0;");
+        output_line(out, "    *count = tree->rule_index->lists[list].count;");
+        output_line(out, "    return tree->rule_index->lists[list].matches;");
+        output_line(out, "}");
+    }
+    output_line(out, "// Returns the number of nodes which start at or before the location.");
+    output_line(out, "static size_t count_nodes_starting_by(const struct location_index *index, size_t location) {");
+    output_line(out, "    size_t low = 0;");
+    output_line(out, "    size_t high = index->nodes.count;");
+    output_line(out, "    while (low < high) {");
+    output_line(out, "        size_t middle = low + (high - low) / 2;");
+    output_line(out, "        if (index->nodes.starts[middle] <= location)");
+    output_line(out, "            low = middle + 1;");
+    output_line(out, "        else");
+    output_line(out, "            high = middle;");
+    output_line(out, "    }");
+    output_line(out, "    return low;");
+    output_line(out, "}");
+    output_line(out, "struct %%prefix_ref %%prefix_tree_node_at(struct %%prefix_tree *tree, size_t location) {");
+    output_line(out, "    check_for_error(tree);");
+    output_line(out, "    struct location_index *index = tree->location_index;");
+    output_line(out, "    if (!index)");
+    output_line(out, "        return (struct %%prefix_ref){ .empty = true };");
+    output_line(out, "    // Every node which starts by the location comes before this leaf, and");
+    output_line(out, "    // nodes which contain the location are nested in order, so the innermost");
+    output_line(out, "    // one is the last of them which ends after the location.");
+    output_line(out, "    size_t k = index->number_of_leaves + count_nodes_starting_by(index, location) - 1;");
+    output_line(out, "    if (k < index->number_of_leaves)");
+    output_line(out, "        return (struct %%prefix_ref){ .empty = true };");
+    output_line(out, "    while (furthest_end(index, k) <= location) {");
+    output_line(out, "        // Move up to the nearest subtree to the left.");
+    output_line(out, "        while (k % 2 == 0)");
+    output_line(out, "            k /= 2;");
+    output_line(out, "        if (k == 1)");
+    output_line(out, "            return (struct %%prefix_ref){ .empty = true };");
+    output_line(out, "        k--;");
+    output_line(out, "    }");
+    output_line(out, "    // Move down to the rightmost leaf which ends after the location.");
+    output_line(out, "    while (k < index->number_of_leaves) {");
+    output_line(out, "        k = 2 * k + 1;");
+    output_line(out, "        if (furthest_end(index, k) <= location)");
+    output_line(out, "            k--;");
+    output_line(out, "    }");
+    output_line(out, "    return index->nodes.matches[k - index->number_of_leaves];");
+    output_line(out, "}");
+    output_line(out, "const struct %%prefix_ref *%%prefix_tree_nodes_in_range(struct %%prefix_tree *tree, size_t start, size_t end, size_t *count) {");
+    output_line(out, "    check_for_error(tree);");
+    output_line(out, "    *count = 0;");
+    output_line(out, "    struct location_index *index = tree->location_index;");
+    output_line(out, "    if (!index || end <= start)");
+    output_line(out, "        return 0;");
+    output_line(out, "    size_t first = start > 0 ? count_nodes_starting_by(index, start - 1) : 0;");
+    output_line(out, "    size_t last = count_nodes_starting_by(index, end - 1);");
+    output_line(out, "    if (first == last)");
+    output_line(out, "        return 0;");
+    output_line(out, "    *count = last - first;");
+    output_line(out, "    return index->nodes.matches + first;");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    output_line(out, "enum %%prefix_rule %%prefix_ref_rule(struct %%prefix_ref ref) {");
+    output_line(out, "    return (enum %%prefix_rule)ref._type;");
+    output_line(out, "}");
+
     if (version_capable(gen->version, SINGLE_CHAR_ESCAPES)) {
         set_literal_substitution(out, "escape-char-single",
          STRINGIFY(ESCAPE_CHAR_SINGLE(c, info)));
@@ -790,11 +2033,11 @@ void generate(struct generator *gen)
     if (has_custom_tokens) {
         output_line(out, "#define CUSTOM_TOKEN_DATA(identifier) uint64_t identifier = 0");
         set_literal_substitution(out, "read-custom-token", "read_custom_token");
-        output_line(out, "static bool read_custom_token(uint32_t *token, size_t *token_length, const char *text, bool *whitespace, uint64_t *data, void *info) {");
+        output_line(out, "static bool read_custom_token(uint32_t *token, size_t *token_length, const char *text, size_t length, bool *whitespace, uint64_t *data, void *info) {");
         output_line(out, "    struct %%prefix_tree *tree = info;");
         output_line(out, "    if (!tree->custom_tokenize)");
         output_line(out, "        return false;");
-        output_line(out, "    struct %%prefix_token t = tree->custom_tokenize(text, tree->custom_tokenize_info);");
+        output_line(out, "    struct %%prefix_token t = tree->custom_tokenize(text, length, tree->custom_tokenize_info);");
         output_line(out, "    if (t.length <= *token_length)");
         output_line(out, "        return false;");
         output_line(out, "    *token = t.type;");
@@ -817,19 +2060,23 @@ void generate(struct generator *gen)
         struct rule *rule = gen->grammar->rules[rule_index];
         switch (rule->token_type) {
         case RULE_TOKEN_IDENTIFIER:
-            set_unsigned_number_substitution(out, "identifier-token", i);
+            set_unsigned_number_substitution(out, "identifier-token",
+             token_class(gen, i));
             has_identifier_token = true;
             break;
         case RULE_TOKEN_INTEGER:
-            set_unsigned_number_substitution(out, "integer-token", i);
+            set_unsigned_number_substitution(out, "integer-token",
+             token_class(gen, i));
             has_integer_token = true;
             break;
         case RULE_TOKEN_NUMBER:
-            set_unsigned_number_substitution(out, "number-token", i);
+            set_unsigned_number_substitution(out, "number-token",
+             token_class(gen, i));
             has_number_token = true;
             break;
         case RULE_TOKEN_STRING:
-            set_unsigned_number_substitution(out, "string-token", i);
+            set_unsigned_number_substitution(out, "string-token",
+             token_class(gen, i));
             has_string_token = true;
             break;
         case RULE_TOKEN_CUSTOM:
@@ -858,8 +2105,80 @@ void generate(struct generator *gen)
         output_line(out, "#define IF_STRING_TOKEN(...) if (0) { /* no string tokens */  }");
     else
         output_line(out, "#define IF_STRING_TOKEN(cond, ...) if (cond) __VA_ARGS__");
-    output_line(out, "static size_t read_whitespace(const char *text, void *info);");
-    output_line(out, "static size_t read_keyword_token(%%token-type *token, bool *end_token, const char *text, void *info);");
+    if (has_number_token)
+        output_line(out, "static double read_number(const char *text, size_t length, size_t *number_length, void *allocator);");
+    output_line(out, "static size_t read_whitespace(const char *text, size_t length, void *info);");
+    output_line(out, "static size_t read_keyword_token(%%token-type *token, bool *end_token, const char *text, size_t length, void *info);");
+    if (gen->hash_keywords && has_identifier_token) {
+        output_line(out, "static bool read_identifier_keyword(%%token-type *token, bool *end_token, const char *text, size_t length);");
+        output_line(out, "#define IF_IDENTIFIER_KEYWORDS(cond, ...) if (cond) __VA_ARGS__");
+    } else
+        output_line(out, "#define IF_IDENTIFIER_KEYWORDS(...)");
+    output_line(out, "#ifdef OWL_THREADS");
+    output_line(out, "enum logged_token_kind {");
+    output_line(out, "    LOGGED_IDENTIFIER_TOKEN,");
+    output_line(out, "    LOGGED_INTEGER_TOKEN,");
+    output_line(out, "    LOGGED_NUMBER_TOKEN,");
+    output_line(out, "    LOGGED_STRING_TOKEN,");
+    output_line(out, "    LOGGED_CUSTOM_TOKEN,");
+    output_line(out, "};");
+    output_line(out, "struct logged_token {");
+    output_line(out, "    size_t offset;");
+    output_line(out, "    size_t length;");
+    output_line(out, "    // The token's value, or where its unescaped contents start in `strings`.");
+    output_line(out, "    uint64_t data;");
+    output_line(out, "    // The length of the unescaped contents, or the custom token's type.");
+    output_line(out, "    size_t extra;");
+    output_line(out, "    uint8_t kind;");
+    output_line(out, "    bool has_escapes;");
+    output_line(out, "};");
+    output_line(out, "// The token data from a worker thread's tokenizer, in the order the tokens");
+    output_line(out, "// appear in the text.");
+    output_line(out, "struct token_log {");
+    output_line(out, "    struct logged_token *tokens;");
+    output_line(out, "    size_t number_of_tokens;");
+    output_line(out, "    size_t tokens_capacity;");
+    output_line(out, "    char *strings;");
+    output_line(out, "    size_t strings_size;");
+    output_line(out, "    size_t strings_capacity;");
+    output_line(out, "    // When validating, nothing is kept.");
+    output_line(out, "    bool discard;");
+    output_line(out, "    struct owl_allocator *allocator;");
+    output_line(out, "};");
+    output_line(out, "static void log_token(struct token_log *log, struct logged_token token) {");
+    output_line(out, "    if (log->discard)");
+    output_line(out, "        return;");
+    output_line(out, "    if (log->number_of_tokens >= log->tokens_capacity) {");
+    output_line(out, "        size_t capacity = (log->tokens_capacity + 64) * 2;");
+    output_line(out, "        struct logged_token *tokens = reallocate_memory(log->tokens, log->tokens_capacity * sizeof(struct logged_token), capacity * sizeof(struct logged_token), log->allocator);");
+    output_line(out, "        if (!tokens)");
+    output_line(out, "            abort();");
+    output_line(out, "        log->tokens = tokens;");
+    output_line(out, "        log->tokens_capacity = capacity;");
+    output_line(out, "    }");
+    output_line(out, "    log->tokens[log->number_of_tokens++] = token;");
+    output_line(out, "}");
+    output_line(out, "static void *log_string_contents(struct token_log *log, size_t size) {");
+    output_line(out, "    // Discarded contents are overwritten by the next string.");
+    output_line(out, "    if (log->discard)");
+    output_line(out, "        log->strings_size = 0;");
+    output_line(out, "    if (log->strings_size + size > log->strings_capacity) {");
+    output_line(out, "        size_t capacity = (log->strings_size + size + 256) * 2;");
+    output_line(out, "        char *strings = reallocate_memory(log->strings, log->strings_capacity, capacity, log->allocator);");
+    output_line(out, "        if (!strings)");
+    output_line(out, "            abort();");
+    output_line(out, "        log->strings = strings;");
+    output_line(out, "        log->strings_capacity = capacity;");
+    output_line(out, "    }");
+    output_line(out, "    void *p = log->strings + log->strings_size;");
+    output_line(out, "    log->strings_size += size;");
+    output_line(out, "    return p;");
+    output_line(out, "}");
+    output_line(out, "static void free_token_log(struct token_log *log) {");
+    output_line(out, "    free_memory(log->tokens, log->tokens_capacity * sizeof(struct logged_token), log->allocator);");
+    output_line(out, "    free_memory(log->strings, log->strings_capacity, log->allocator);");
+    output_line(out, "}");
+    output_line(out, "#endif");
     bool has_write_custom_token = false;
     for (uint32_t i = 0; i < n; ++i) {
         struct rule *rule = gen->grammar->rules[i];
@@ -894,7 +2213,6 @@ void generate(struct generator *gen)
             set_literal_substitution(out, "write-string-token", "write_string_token");
             output_line(out, "static void write_string_token(size_t offset, size_t length, const char *string, size_t string_length, bool has_escapes, void *info) {");
             output_line(out, "    struct %%prefix_tree *tree = info;");
-            output_line(out, "    size_t string_offset = has_escapes ? (uint8_t *)string - tree->parse_tree : 0;");
             break;
         case RULE_TOKEN_CUSTOM:
             set_literal_substitution(out, "write-custom-token", "write_custom_token");
@@ -902,20 +2220,49 @@ void generate(struct generator *gen)
             output_line(out, "    struct %%prefix_tree *tree = info;");
             break;
         }
+        output_line(out, "#ifdef OWL_THREADS");
+        output_line(out, "    if (tree->token_log) {");
+        switch (rule->token_type) {
+        case RULE_TOKEN_IDENTIFIER:
+            output_line(out, "        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_IDENTIFIER_TOKEN, .offset = offset, .length = length });");
+            break;
+        case RULE_TOKEN_INTEGER:
+            output_line(out, "        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_INTEGER_TOKEN, .offset = offset, .length = length, .data = integer });");
+            break;
+        case RULE_TOKEN_NUMBER:
+            output_line(out, "        union { double n; uint64_t v; } u = { .n = number };");
+            output_line(out, "        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_NUMBER_TOKEN, .offset = offset, .length = length, .data = u.v });");
+            break;
+        case RULE_TOKEN_STRING:
+            output_line(out, "        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_STRING_TOKEN, .offset = offset, .length = length, .data = has_escapes ? (uint64_t)(string - tree->token_log->strings) : 0, .extra = string_length, .has_escapes = has_escapes });");
+            break;
+        case RULE_TOKEN_CUSTOM:
+            output_line(out, "        log_token(tree->token_log, (struct logged_token){ .kind = LOGGED_CUSTOM_TOKEN, .offset = offset, .length = length, .data = data, .extra = token });");
+            break;
+        }
+        output_line(out, "        return;");
+        output_line(out, "    }");
+        output_line(out, "#endif");
+        if (rule->token_type == RULE_TOKEN_STRING)
+            output_line(out, "    size_t string_offset = has_escapes ? (uint8_t *)string - tree->parse_tree : 0;");
         output_line(out, "    size_t token_offset = tree->next_offset;");
         output_line(out, "    write_tree(tree, token_offset - tree->next_%%rule_token_offset);");
-        output_line(out, "    write_tree(tree, offset);");
+        if (relative) {
+            output_line(out, "    write_tree(tree, offset - tree->next_%%rule_token_location);");
+            output_line(out, "    tree->next_%%rule_token_location = offset;");
+        } else
+            output_line(out, "    write_tree(tree, offset);");
         output_line(out, "    write_tree(tree, length);");
         switch (rule->token_type) {
         case RULE_TOKEN_IDENTIFIER:
             // We don't need to do anything else.
             break;
         case RULE_TOKEN_INTEGER:
-            output_line(out, "    write_tree(tree, integer);");
+            output_line(out, "    %%write-tree-wide(tree, integer);");
             break;
         case RULE_TOKEN_NUMBER:
             output_line(out, "    union { double n; uint64_t v; } u = { .n = number };");
-            output_line(out, "    write_tree(tree, u.v);");
+            output_line(out, "    %%write-tree-wide(tree, u.v);");
             break;
         case RULE_TOKEN_STRING:
             output_line(out, "    if (string_offset) {");
@@ -925,7 +2272,7 @@ void generate(struct generator *gen)
             output_line(out, "        write_tree(tree, 0);");
             break;
         case RULE_TOKEN_CUSTOM:
-            output_line(out, "    write_tree(tree, data);");
+            output_line(out, "    %%write-tree-wide(tree, data);");
             break;
         }
         output_line(out, "    tree->next_%%rule_token_offset = token_offset;");
@@ -933,17 +2280,35 @@ void generate(struct generator *gen)
     }
     output_line(out, "static void *allocate_string_contents(size_t size, void *info) {");
     output_line(out, "    struct %%prefix_tree *tree = info;");
-    output_line(out, "    if (tree->next_offset + size > tree->parse_tree_size)");
-    output_line(out, "        grow_tree(tree, tree->next_offset + size);");
-    output_line(out, "    void *p = tree->parse_tree + tree->next_offset;");
-    output_line(out, "    tree->next_offset += size;");
+    output_line(out, "#ifdef OWL_THREADS");
+    output_line(out, "    if (tree->token_log)");
+    output_line(out, "        return log_string_contents(tree->token_log, size);");
+    output_line(out, "#endif");
+    if (fixed_width) {
+        output_line(out, "    // Keep the fields after the string aligned, with the padding zeroed so");
+        output_line(out, "    // the same text always makes the same tree.");
+        output_line(out, "    size_t padding = -size & 3;");
+        output_line(out, "    if (tree->next_offset + size + padding > tree->parse_tree_size)");
+        output_line(out, "        grow_tree(tree, tree->next_offset + size + padding);");
+        output_line(out, "    void *p = tree->parse_tree + tree->next_offset;");
+        output_line(out, "    memset((uint8_t *)p + size, 0, padding);");
+        output_line(out, "    tree->next_offset += size + padding;");
+    } else {
+        output_line(out, "    if (tree->next_offset + size > tree->parse_tree_size)");
+        output_line(out, "        grow_tree(tree, tree->next_offset + size);");
+        output_line(out, "    void *p = tree->parse_tree + tree->next_offset;");
+        output_line(out, "    tree->next_offset += size;");
+    }
     output_line(out, "    return p;");
     output_line(out, "}");
     if (SHOULD_ALLOW_DASHES_IN_IDENTIFIERS(gen->combined))
         set_literal_substitution(out, "allow-dashes-in-identifiers", "true");
     else
         set_literal_substitution(out, "allow-dashes-in-identifiers", "false");
+    generate_vector_scanner(gen, out);
     output_formatted_source(out, tokenizer_source);
+    if (has_number_token)
+        generate_number_reader(out);
     output_line(out, "static uint32_t rule_lookup(uint32_t parent, uint32_t slot, void *context);");
     output_line(out, "static void fixity_associativity_precedence_lookup(int *fixity_associativity, int *precedence, uint32_t rule, uint32_t choice, void *context);");
     output_line(out, "static size_t number_of_slots_lookup(uint32_t rule, void *context);");
@@ -968,1046 +2333,4329 @@ void generate(struct generator *gen)
     output_line(out, "    struct fill_run_state *stack;");
     output_line(out, "    size_t top_index;");
     output_line(out, "    size_t capacity;");
+    output_line(out, "    // -1 if a reachability check failed on the token before this one, 2 if a");
+    output_line(out, "    // bracket ended with nothing below it on the stack, or 1 for any other");
+    output_line(out, "    // error.");
     output_line(out, "    int error;");
+    output_line(out, "    struct owl_allocator *allocator;");
     output_line(out, "};");
-    struct automaton *a = &gen->deterministic->automaton;
-    struct automaton *b = &gen->deterministic->bracket_automaton;
     set_unsigned_number_substitution(out, "first-bracket-state-id",
-     a->number_of_states);
-    output_string(out, "static void bracket_entry_state(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index");
-    for (uint32_t i = 0; i < mask_width; ++i) {
-        set_unsigned_number_substitution(out, "mask-index", i);
-        output_string(out, ", uint32_t mask%%mask-index");
-    }
-    output_line(out, ");");
-    uint32_t total_states = a->number_of_states + b->number_of_states;
-    struct state_in_automaton *sorted_states =
-     malloc(sizeof(struct state_in_automaton) * total_states);
-    for (state_id i = 0; i < a->number_of_states; ++i) {
-        sorted_states[i] = (struct state_in_automaton){
-            .reachability_mask = 0,
-            .automaton = a,
-            .state = i,
-            .state_offset = 0,
-        };
+     gen->deterministic->automaton.number_of_states);
+    if (gen->backend == GENERATOR_BACKEND_TABLE)
+        generate_state_table(gen, out);
+    else
+        generate_state_functions(gen, out);
+    output_line(out, "static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index);");
+    output_line(out, "struct %%prefix_parser;");
+    output_line(out, "static size_t build_parse_tree(struct %%prefix_parser *parser);");
+    if (split_root) {
+        output_line(out, "#ifdef OWL_THREADS");
+        output_line(out, "static size_t build_parse_tree_in_parallel(struct %%prefix_parser *parser);");
+        output_line(out, "#endif");
     }
-    for (state_id i = 0; i < b->number_of_states; ++i) {
-        sorted_states[i + a->number_of_states] = (struct state_in_automaton){
-            .reachability_mask = &gen->deterministic->bracket_reachability[i],
-            .automaton = b,
-            .state = i,
-            .state_offset = a->number_of_states,
-            .bracket_accepting = b->states[i].accepting,
-        };
-    }
-    qsort(sorted_states, total_states, sizeof(struct state_in_automaton),
-     compare_state_transitions);
-    set_unsigned_number_substitution(out, "total-number-of-states", total_states);
-    output_line(out, "static void (*state_funcs[%%total-number-of-states])(struct owl_token_run *, struct fill_run_state *, uint16_t);");
-    state_id *func_id_for_state = calloc(total_states, sizeof(state_id));
-    state_id func_id = 0;
-    for (uint32_t i = 0; i < total_states; ++i) {
-        if (i > 0 && compare_state_transitions(sorted_states + i,
-         sorted_states + i - 1) == 0) {
-            func_id_for_state[sorted_states[i].state +
-             sorted_states[i].state_offset] = func_id;
-            continue;
-        }
-        func_id = sorted_states[i].state + sorted_states[i].state_offset;
-        func_id_for_state[sorted_states[i].state +
-         sorted_states[i].state_offset] = func_id;
-        struct state s = sorted_states[i].automaton->states[sorted_states[i].state];
-        set_unsigned_number_substitution(out, "func-id", func_id);
-        output_line(out, "static void state_func_%%func-id(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {");
-        uint32_t mask_width = reachability_mask_width(gen);
-        if (sorted_states[i].reachability_mask) {
-            generate_reachability_mask_check(gen, out,
-             sorted_states[i].reachability_mask);
-        }
-        if (sorted_states[i].bracket_accepting) {
-            set_unsigned_number_substitution(out, "state-transition-symbol",
-             s.transition_symbol);
-            output_line(out, "    if (top->cont->top_index == 0) {");
-            output_line(out, "        top->cont->error = 1;");
-            output_line(out, "        return;");
-            output_line(out, "    }");
-            output_line(out, "    top->cont->top_index--;");
-            output_line(out, "    top--;");
-            output_line(out, "    run->tokens[token_index] = %%state-transition-symbol;");
-            output_line(out, "    run->states[token_index] = top->state;");
-            output_line(out, "    state_funcs[top->state](run, top, token_index);");
-            output_line(out, "    return;");
-            output_line(out, "}");
-            continue;
-        }
-        output_line(out, "    %%token-type token = run->tokens[token_index];");
-        output_line(out, "    switch (token) {");
-        struct bitset reachability_mask = bitset_create_empty(gen->deterministic->transitions.number_of_transitions);
-        for (uint32_t j = 0; j < s.number_of_transitions; ++j) {
-            struct transition t = s.transitions[j];
-            if (t.symbol >= gen->combined->number_of_tokens) {
-                // Symbols are either tokens or bracket symbols, so this must
-                // be a bracket symbol.
-                struct bracket_transitions ts = gen->deterministic->transitions;
-                for (uint32_t k = 0; k < ts.number_of_transitions; ++k) {
-                    if (ts.transitions[k].deterministic_transition_symbol == t.symbol)
-                        bitset_add(&reachability_mask, k);
-                }
-            }
-            set_unsigned_number_substitution(out, "token-symbol", t.symbol);
-            set_unsigned_number_substitution(out, "token-target", t.target + sorted_states[i].state_offset);
-            output_line(out, "    case %%token-symbol: top->state = %%token-target; return;");
-        }
-        output_string(out, "    default:");
-        if (!bitset_is_empty(&reachability_mask)) {
-            output_line(out, "");
-            output_string(out, "        bracket_entry_state(run, top, token_index");
-            for (uint32_t i = 0; i < mask_width; ++i) {
-                set_unsigned_number_substitution(out, "mask-index", i);
-                uint64_t bits = reachability_mask.bit_groups[i / 2];
-                if (i % 2)
-                    bits >>= 32;
-                else
-                    bits &= UINT32_MAX;
-                set_unsigned_number_substitution(out, "mask-bits", (uint32_t)bits);
-                output_string(out, ", %%mask-bits");
-            }
-            output_line(out, ");");
-            output_line(out, "        return;");
-        } else
-            output_line(out, " top->cont->error = 1; return;");
-        bitset_destroy(&reachability_mask);
-        output_line(out, "    }");
-        output_line(out, "}");
-    }
-    output_string(out, "static void (*state_funcs[%%total-number-of-states])(struct owl_token_run *, struct fill_run_state *, uint16_t) = {");
-    const int funcs_per_line = 4;
-    for (state_id i = 0; i < total_states; ++i) {
-        set_unsigned_number_substitution(out, "func-id", func_id_for_state[i]);
-        if (i % funcs_per_line == 0) {
-            output_line(out, "");
-            output_string(out, "   ");
-        }
-        output_string(out, " state_func_%%func-id,");
-    }
-    output_line(out, "};");
-    free(sorted_states);
-    free(func_id_for_state);
-    output_string(out, "static void bracket_entry_state(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index");
-    for (uint32_t i = 0; i < mask_width; ++i) {
-        set_unsigned_number_substitution(out, "mask-index", i);
-        output_string(out, ", uint32_t mask%%mask-index");
-    }
-    output_line(out, ") {");
-    output_line(out, "    struct fill_run_continuation *cont = top->cont;");
-    output_line(out, "    cont->top_index++;");
-    output_line(out, "    if (cont->top_index >= cont->capacity) {");
-    output_line(out, "        size_t new_capacity = (cont->capacity + 2) * 3 / 2;");
-    output_line(out, "        if (new_capacity <= cont->capacity)");
-    output_line(out, "            abort();");
-    output_line(out, "        struct fill_run_state *new_states = realloc(cont->stack, new_capacity * sizeof(struct fill_run_state));");
-    output_line(out, "        if (!new_states)");
-    output_line(out, "            abort();");
-    output_line(out, "        cont->stack = new_states;");
-    output_line(out, "        cont->capacity = new_capacity;");
-    output_line(out, "        top = &cont->stack[cont->top_index];");
-    output_line(out, "    } else");
-    output_line(out, "        top++;");
-    output_line(out, "    top->cont = cont;");
-    for (uint32_t i = 0; i < mask_width; ++i) {
-        set_unsigned_number_substitution(out, "mask-index", i);
-        output_line(out, "    top->reachability_mask[%%mask-index] = mask%%mask-index;");
-    }
-    output_line(out, "    run->states[token_index] = %%first-bracket-state-id;");
-    output_line(out, "    state_func_%%first-bracket-state-id(run, top, token_index);");
-    output_line(out, "    if (top->cont->error == -1)");
-    output_line(out, "        top->cont->error = 1;");
-    output_line(out, "}");
-    output_line(out, "static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index);");
-    output_line(out, "static size_t build_parse_tree(struct owl_default_tokenizer *, struct owl_token_run *, struct %%prefix_tree *);");
     output_line(out, "");
-    output_line(out, "static struct %%prefix_tree *%%prefix_tree_create_empty(void) {");
-    output_line(out, "    return calloc(1, sizeof(struct %%prefix_tree));");
+    output_line(out, "static struct %%prefix_tree *%%prefix_tree_create_empty(struct owl_allocator allocator) {");
+    output_line(out, "    struct %%prefix_tree *tree = allocate_memory(sizeof(struct %%prefix_tree), &allocator);");
+    output_line(out, "    if (!tree)");
+    output_line(out, "        abort();");
+    output_line(out, "    *tree = (struct %%prefix_tree){ .allocator = allocator };");
+    output_line(out, "    return tree;");
     output_line(out, "}");
-    output_line(out, "");
-    output_line(out, "static void free_token_runs(struct owl_token_run **run) {");
-    output_line(out, "    while (*run) {");
-    output_line(out, "        struct owl_token_run *prev = (*run)->prev;");
-    output_line(out, "        free(*run);");
-    output_line(out, "        *run = prev;");
-    output_line(out, "    }");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "static struct rule_index *create_rule_index(struct owl_allocator *allocator) {");
+    output_line(out, "    struct rule_index *index = allocate_memory(sizeof(struct rule_index), allocator);");
+    output_line(out, "    if (!index)");
+    output_line(out, "        abort();");
+    output_line(out, "    *index = (struct rule_index){ 0 };");
+    output_line(out, "    return index;");
     output_line(out, "}");
-    output_line(out, "static void parse_string(struct %%prefix_tree *tree, const char *string) {");
-    output_line(out, "    tree->string = string;");
-    output_line(out, "    tree->next_offset = 1;");
-    output_line(out, "    struct owl_default_tokenizer tokenizer = {");
-    output_line(out, "        .text = string,");
+    output_line(out, "static struct location_index *create_location_index(struct owl_allocator *allocator) {");
+    output_line(out, "    struct location_index *index = allocate_memory(sizeof(struct location_index), allocator);");
+    output_line(out, "    if (!index)");
+    output_line(out, "        abort();");
+    output_line(out, "    *index = (struct location_index){ .nodes.keeps_ends = true };");
+    output_line(out, "    return index;");
+    output_line(out, "}");
+    output_line(out, "static void free_match_list(struct match_list *list, struct owl_allocator *allocator) {");
+    output_line(out, "    free_memory(list->matches, list->capacity * sizeof(struct %%prefix_ref), allocator);");
+    output_line(out, "    free_memory(list->starts, list->capacity * sizeof(size_t), allocator);");
+    output_line(out, "    if (list->keeps_ends)");
+    output_line(out, "        free_memory(list->ends, list->capacity * sizeof(size_t), allocator);");
+    output_line(out, "    free_memory(list->late, list->late_capacity * sizeof(struct match_to_sort), allocator);");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    output_line(out, "");
+    set_unsigned_number_substitution(out, "stream-lookahead",
+     stream_lookahead(gen));
+    output_line(out, "// The streaming parser waits for about this many bytes of new input before");
+    output_line(out, "// tokenizing again, so token runs don't end up mostly empty.");
+    output_line(out, "#ifndef FEED_BATCH_SIZE");
+    output_line(out, "#define FEED_BATCH_SIZE 16384");
+    output_line(out, "#endif");
+    output_line(out, "#ifdef OWL_THREADS");
+    output_line(out, "// Where the tokenizer was after each token run, for reporting errors in runs");
+    output_line(out, "// other than the last one.");
+    output_line(out, "struct run_end {");
+    output_line(out, "    size_t offset;");
+    output_line(out, "    size_t whitespace;");
+    output_line(out, "};");
+    output_line(out, "#endif");
+    output_line(out, "struct %%prefix_parser {");
+    output_line(out, "    struct %%prefix_tree *tree;");
+    output_line(out, "    struct owl_allocator allocator;");
+    output_line(out, "    struct owl_default_tokenizer tokenizer;");
+    output_line(out, "    struct owl_token_run *token_run;");
+    output_line(out, "    struct fill_run_continuation cont;");
+    output_line(out, "    // The state stack and construct pools are only used while building the");
+    output_line(out, "    // tree, but they're kept (along with the token runs and the fill_run stack)");
+    output_line(out, "    // so later parses don't have to allocate them again.");
+    output_line(out, "    %%state-type *state_stack;");
+    output_line(out, "    size_t state_stack_capacity;");
+    output_line(out, "    struct construct_state construct_state;");
+    output_line(out, "    // Set once %%prefix_parser_parse has built a tree, until the next reset.");
+    output_line(out, "    bool finished;");
+    output_line(out, "    // When validating, token runs are recycled as soon as they've been checked and");
+    output_line(out, "    // no tree is built.");
+    output_line(out, "    bool validating;");
+    output_line(out, "    char *buffer;");
+    output_line(out, "    size_t length;");
+    output_line(out, "    size_t capacity;");
+    output_line(out, "    size_t resume_length;");
+    if (split_root) {
+        output_line(out, "#ifdef OWL_THREADS");
+        output_line(out, "    // Kept by parse_text_in_parallel so the tree can be built on several threads");
+        output_line(out, "    // too.");
+        output_line(out, "    struct run_end *run_ends;");
+        output_line(out, "    size_t number_of_runs;");
+        output_line(out, "    size_t run_ends_capacity;");
+        output_line(out, "    unsigned threads;");
+        output_line(out, "#endif");
+    }
+    output_line(out, "};");
+    output_line(out, "static void start_parsing(struct %%prefix_parser *parser, struct %%prefix_tree *tree) {");
+    output_line(out, "    tree->next_offset = %%first-tree-offset;");
+    output_line(out, "    parser->tree = tree;");
+    output_line(out, "    parser->tokenizer = (struct owl_default_tokenizer){");
     output_line(out, "        .info = tree,");
+    output_line(out, "        .lookahead = %%stream-lookahead,");
+    output_line(out, "        .free_runs = parser->tokenizer.free_runs,");
+    output_line(out, "        .allocator = &parser->allocator,");
     output_line(out, "    };");
-    output_line(out, "    struct owl_token_run *token_run = 0;");
-    output_line(out, "    struct fill_run_continuation c = {");
-    output_line(out, "        .capacity = 8,");
-    output_line(out, "        .top_index = 0,");
+    output_line(out, "    parser->token_run = 0;");
+    output_line(out, "    parser->cont.allocator = &parser->allocator;");
+    output_line(out, "    parser->construct_state.allocator = &parser->allocator;");
+    output_line(out, "    if (!parser->cont.stack) {");
+    output_line(out, "        parser->cont.capacity = 8;");
+    output_line(out, "        parser->cont.stack = allocate_memory(parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);");
+    output_line(out, "        if (!parser->cont.stack)");
+    output_line(out, "            abort();");
+    output_line(out, "    }");
+    output_line(out, "    parser->cont.top_index = 0;");
+    output_line(out, "    parser->cont.error = 0;");
+    output_line(out, "    parser->cont.stack[0] = (struct fill_run_state){");
+    output_line(out, "        .state = %%start-state,");
+    output_line(out, "        .cont = &parser->cont,");
     output_line(out, "    };");
-    output_line(out, "    c.stack = calloc(c.capacity, sizeof(struct fill_run_state));");
-    output_line(out, "    c.stack[0].state = %%start-state;");
-    output_line(out, "    c.stack[0].cont = &c;");
+    output_line(out, "}");
+    output_line(out, "// Moves the parser's token runs to the tokenizer's free list.");
+    output_line(out, "static void recycle_token_runs(struct %%prefix_parser *parser) {");
+    output_line(out, "    while (parser->token_run) {");
+    output_line(out, "        struct owl_token_run *run = parser->token_run;");
+    output_line(out, "        parser->token_run = run->prev;");
+    output_line(out, "        run->prev = parser->tokenizer.free_runs;");
+    output_line(out, "        parser->tokenizer.free_runs = run;");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "// Throws away the token runs and the token data written to the tree, which");
+    output_line(out, "// aren't kept when validating.  The token lists start over too.");
+    output_line(out, "static void discard_tokens(struct %%prefix_parser *parser) {");
+    output_line(out, "    struct %%prefix_tree *tree = parser->tree;");
+    output_line(out, "    recycle_token_runs(parser);");
+    output_line(out, "    tree->next_offset = %%first-tree-offset;");
+    for (uint32_t i = 0; i < n; ++i) {
+        struct rule *rule = gen->grammar->rules[i];
+        if (!rule->is_token || rule->token_type == RULE_TOKEN_CUSTOM)
+            continue;
+        set_substitution(out, "rule", rule->name, rule->name_length,
+         LOWERCASE_WITH_UNDERSCORES);
+        output_line(out, "    tree->next_%%rule_token_offset = 0;");
+        if (relative)
+            output_line(out, "    tree->next_%%rule_token_location = 0;");
+    }
+    if (has_custom_tokens) {
+        output_line(out, "    tree->next_custom_token_offset = 0;");
+        if (relative)
+            output_line(out, "    tree->next_custom_token_location = 0;");
+    }
+    output_line(out, "}");
+    output_line(out, "// Frees the memory kept between parses (but not the tree or input buffer).");
+    output_line(out, "static void free_parser_memory(struct %%prefix_parser *parser) {");
+    output_line(out, "    free_token_runs(&parser->token_run, &parser->allocator);");
+    output_line(out, "    free_token_runs(&parser->tokenizer.free_runs, &parser->allocator);");
+    output_line(out, "    free_memory(parser->cont.stack, parser->cont.capacity * sizeof(struct fill_run_state), &parser->allocator);");
+    output_line(out, "    free_memory(parser->state_stack, parser->state_stack_capacity * sizeof(%%state-type), &parser->allocator);");
+    output_line(out, "    construct_free_pools(&parser->construct_state);");
+    if (split_root) {
+        output_line(out, "#ifdef OWL_THREADS");
+        output_line(out, "    free_memory(parser->run_ends, parser->run_ends_capacity * sizeof(struct run_end), &parser->allocator);");
+        output_line(out, "#endif");
+    }
+    output_line(out, "}");
+    output_line(out, "// Tokenizes as much of the text as possible, running each token run through");
+    output_line(out, "// the state machine.  Set `more_input` if more text will follow `length`.");
+    output_line(out, "static bool parse_text(struct %%prefix_parser *parser, const char *text, size_t length, bool more_input) {");
+    output_line(out, "    struct %%prefix_tree *tree = parser->tree;");
+    output_line(out, "    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;");
+    output_line(out, "    tokenizer->text = text;");
+    output_line(out, "    tokenizer->length = length;");
+    output_line(out, "    tokenizer->more_input = more_input;");
     output_line(out, "    uint16_t failing_index = 0;");
-    output_line(out, "    while (owl_default_tokenizer_advance(&tokenizer, &token_run)) {");
-    output_line(out, "        if (!fill_run_states(token_run, &c, &failing_index)) {");
-    output_line(out, "            free(c.stack);");
+    output_line(out, "    while (owl_default_tokenizer_advance(tokenizer, &parser->token_run)) {");
+    output_line(out, "        if (!fill_run_states(parser->token_run, &parser->cont, &failing_index)) {");
     output_line(out, "            tree->error = ERROR_UNEXPECTED_TOKEN;");
-    output_line(out, "            find_token_range(&tokenizer, token_run, failing_index, &tree->error_range.start, &tree->error_range.end);");
-    output_line(out, "            free_token_runs(&token_run);");
-    output_line(out, "            return;");
+    output_line(out, "            find_token_range(tokenizer, parser->token_run, failing_index, &tree->error_range.start, &tree->error_range.end);");
+    output_line(out, "            return false;");
+    output_line(out, "        }");
+    output_line(out, "        if (parser->validating) {");
+    output_line(out, "            // Only the tokenizer's position is needed to report later errors, so");
+    output_line(out, "            // the run and its token data can be reused.");
+    output_line(out, "            discard_tokens(parser);");
     output_line(out, "        }");
     output_line(out, "    }");
-    output_line(out, "    struct fill_run_state top = c.stack[c.top_index];");
-    output_line(out, "    free(c.stack);");
-    output_line(out, "    if (string[tokenizer.offset] != '\\0') {");
+    output_line(out, "    if (tokenizer->deferred)");
+    output_line(out, "        return true;");
+    output_line(out, "    if (tokenizer->offset < length) {");
     output_line(out, "        tree->error = ERROR_INVALID_TOKEN;");
-    output_line(out, "        estimate_next_token_range(&tokenizer, &tree->error_range.start, &tree->error_range.end);");
-    output_line(out, "        free_token_runs(&token_run);");
-    output_line(out, "        return;");
+    output_line(out, "        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);");
+    output_line(out, "        return false;");
     output_line(out, "    }");
-    output_line(out, "    switch (top.state) {");
-    for (state_id i = 0; i < gen->deterministic->automaton.number_of_states; ++i) {
-        if (!gen->deterministic->automaton.states[i].accepting)
-            continue;
-        set_unsigned_number_substitution(out, "state-id", i);
-        output_line(out, "    case %%state-id:");
-    }
-    output_line(out, "        break;");
-    output_line(out, "    default:");
-    output_line(out, "        tree->error = ERROR_MORE_INPUT_NEEDED;");
-    output_line(out, "        find_end_range(&tokenizer, &tree->error_range.start, &tree->error_range.end);");
-    output_line(out, "        free_token_runs(&token_run);");
+    output_line(out, "    return true;");
+    output_line(out, "}");
+    output_line(out, "#ifdef OWL_THREADS");
+    set_unsigned_number_substitution(out, "token-run-length", TOKEN_RUN_LENGTH);
+    generate_speculative_bases(gen, out);
+    output_line(out, "// Inputs with fewer than twice this many token runs are checked on one thread.");
+    output_line(out, "#ifndef OWL_THREAD_MIN_RUNS");
+    output_line(out, "#define OWL_THREAD_MIN_RUNS 16");
+    output_line(out, "#endif");
+    output_line(out, "// Workers give up guessing the stack if they need more guesses than this.");
+    output_line(out, "#ifndef OWL_THREAD_MAX_GUESSES");
+    output_line(out, "#define OWL_THREAD_MAX_GUESSES 1024");
+    output_line(out, "#endif");
+    output_line(out, "// Inputs with fewer than twice this many bytes are tokenized on one thread.");
+    output_line(out, "#ifndef OWL_THREAD_MIN_BYTES");
+    output_line(out, "#define OWL_THREAD_MIN_BYTES (1 << 20)");
+    output_line(out, "#endif");
+    output_line(out, "// A worker's guess at the stack while it doesn't know what's on the real one.");
+    output_line(out, "struct stack_guess {");
+    output_line(out, "    struct fill_run_continuation cont;");
+    output_line(out, "    // Positions count tokens as if every run were full.");
+    output_line(out, "    size_t position;");
+    output_line(out, "    // Set if the guess needs another frame at the bottom of its stack, because");
+    output_line(out, "    // a bracket ended with nothing below it (or, if `empty` is set, because it");
+    output_line(out, "    // doesn't have a stack yet).");
+    output_line(out, "    bool out_of_stack;");
+    output_line(out, "    bool empty;");
+    output_line(out, "};");
+    output_line(out, "// Tokens a worker has filled in, starting with the stack in `before` and ending");
+    output_line(out, "// with the stack in `after`.  The bottom frame of `before` stands for whatever");
+    output_line(out, "// frame is at that depth on the real stack; the bottom frame of `after` is the");
+    output_line(out, "// same frame, in the state the stretch left it in.");
+    output_line(out, "struct filled_stretch {");
+    output_line(out, "    size_t start;");
+    output_line(out, "    size_t end;");
+    output_line(out, "    struct fill_run_state *before;");
+    output_line(out, "    size_t before_depth;");
+    output_line(out, "    struct fill_run_state *after;");
+    output_line(out, "    size_t after_depth;");
+    output_line(out, "};");
+    output_line(out, "// A piece of the input for a worker thread.  The worker starts without knowing");
+    output_line(out, "// the stack, so it guesses until it's sure of the top of it, then fills in");
+    output_line(out, "// tokens until a bracket ends with nothing below it, then guesses again, and so");
+    output_line(out, "// on.  Once the earlier pieces are done, the stretches it filled in are checked");
+    output_line(out, "// against the real stack, and only the gaps between them are filled in again.");
+    output_line(out, "struct parallel_chunk {");
+    output_line(out, "    struct owl_token_run **runs;");
+    output_line(out, "    size_t number_of_runs;");
+    output_line(out, "    struct owl_allocator *allocator;");
+    output_line(out, "    struct filled_stretch *stretches;");
+    output_line(out, "    size_t number_of_stretches;");
+    output_line(out, "    size_t stretches_capacity;");
+    output_line(out, "    bool started;");
+    output_line(out, "    pthread_t thread;");
+    output_line(out, "    // These are only used by the worker.");
+    output_line(out, "    struct fill_run_continuation cont;");
+    output_line(out, "    struct stack_guess *guesses;");
+    output_line(out, "    size_t number_of_guesses;");
+    output_line(out, "    size_t guesses_capacity;");
+    output_line(out, "    struct owl_token_run *scratch;");
+    output_line(out, "};");
+    output_line(out, "static void reserve_fill_run_stack(struct fill_run_continuation *cont, size_t size) {");
+    output_line(out, "    if (size <= cont->capacity)");
     output_line(out, "        return;");
-    output_line(out, "    }");
-    /*
-    output_line(out, "    struct owl_token_run *run_to_print = token_run;");
-    output_line(out, "    while (run_to_print) {");
-    output_line(out, "        for (uint32_t i = 0; i < run_to_print->number_of_tokens; ++i) {");
-    output_line(out, "            printf(\"%u -> %u\\n\", run_to_print->tokens[i], run_to_print->states[i]);");
+    output_line(out, "    struct fill_run_state *stack = reallocate_memory(cont->stack, cont->capacity * sizeof(struct fill_run_state), size * sizeof(struct fill_run_state), cont->allocator);");
+    output_line(out, "    if (!stack)");
+    output_line(out, "        abort();");
+    output_line(out, "    cont->stack = stack;");
+    output_line(out, "    cont->capacity = size;");
+    output_line(out, "}");
+    output_line(out, "static void copy_fill_run_stack(struct fill_run_continuation *to, const struct fill_run_state *stack, size_t depth) {");
+    output_line(out, "    reserve_fill_run_stack(to, depth);");
+    output_line(out, "    memcpy(to->stack, stack, depth * sizeof(struct fill_run_state));");
+    output_line(out, "    for (size_t i = 0; i < depth; ++i)");
+    output_line(out, "        to->stack[i].cont = to;");
+    output_line(out, "    to->top_index = depth - 1;");
+    output_line(out, "}");
+    output_line(out, "static struct fill_run_state *save_fill_run_stack(struct fill_run_continuation *cont, struct owl_allocator *allocator) {");
+    output_line(out, "    struct fill_run_state *stack = allocate_memory((cont->top_index + 1) * sizeof(struct fill_run_state), allocator);");
+    output_line(out, "    if (!stack)");
+    output_line(out, "        abort();");
+    output_line(out, "    memcpy(stack, cont->stack, (cont->top_index + 1) * sizeof(struct fill_run_state));");
+    output_line(out, "    return stack;");
+    output_line(out, "}");
+    output_line(out, "// Fills in the states of the tokens from position `start` up to `end`.  Unless");
+    output_line(out, "// `write` is set, the tokens are copied into `scratch` first, so the runs are");
+    output_line(out, "// left alone.");
+    output_line(out, "static bool fill_positions(struct owl_token_run **runs, size_t start, size_t end, struct fill_run_continuation *cont, struct owl_token_run *scratch, bool write, size_t *failing_run, uint16_t *failing_index) {");
+    output_line(out, "    while (start < end) {");
+    output_line(out, "        size_t run_index = start / %%token-run-length;");
+    output_line(out, "        struct owl_token_run *run = runs[run_index];");
+    output_line(out, "        uint16_t from = start % %%token-run-length;");
+    output_line(out, "        uint16_t to = run->number_of_tokens;");
+    output_line(out, "        if (end - run_index * %%token-run-length < to)");
+    output_line(out, "            to = end - run_index * %%token-run-length;");
+    output_line(out, "        bool ok;");
+    output_line(out, "        cont->error = 0;");
+    output_line(out, "        if (write && from == 0 && to == run->number_of_tokens)");
+    output_line(out, "            ok = fill_run_states(run, cont, failing_index);");
+    output_line(out, "        else {");
+    output_line(out, "            memcpy(scratch->tokens, run->tokens + from, (to - from) * sizeof(run->tokens[0]));");
+    output_line(out, "            scratch->number_of_tokens = to - from;");
+    output_line(out, "            ok = fill_run_states(scratch, cont, failing_index);");
+    output_line(out, "            if (write) {");
+    output_line(out, "                memcpy(run->tokens + from, scratch->tokens, (to - from) * sizeof(run->tokens[0]));");
+    output_line(out, "                memcpy(run->states + from, scratch->states, (to - from) * sizeof(run->states[0]));");
+    output_line(out, "            }");
+    output_line(out, "            *failing_index += from;");
     output_line(out, "        }");
-    output_line(out, "        printf(\"--\\n\");");
-    output_line(out, "        run_to_print = run_to_print->prev;");
+    output_line(out, "        if (!ok) {");
+    output_line(out, "            *failing_run = run_index;");
+    output_line(out, "            return false;");
+    output_line(out, "        }");
+    output_line(out, "        if (to == run->number_of_tokens)");
+    output_line(out, "            start = (run_index + 1) * %%token-run-length;");
+    output_line(out, "        else");
+    output_line(out, "            start = run_index * %%token-run-length + to;");
     output_line(out, "    }");
-     */
-    output_line(out, "    tree->root_offset = build_parse_tree(&tokenizer, token_run, tree);");
+    output_line(out, "    return true;");
     output_line(out, "}");
-    output_line(out, "static struct %%prefix_tree *%%prefix_tree_create_with_error(enum %%prefix_error e) {");
-    output_line(out, "    struct %%prefix_tree *tree = %%prefix_tree_create_empty();");
-    output_line(out, "    tree->error = e;");
-    output_line(out, "    return tree;");
+    output_line(out, "// The position `count` tokens after `position`, or the end of the chunk.");
+    output_line(out, "static size_t position_after(struct parallel_chunk *chunk, size_t position, size_t count) {");
+    output_line(out, "    size_t run = position / %%token-run-length;");
+    output_line(out, "    size_t index = position % %%token-run-length + count;");
+    output_line(out, "    while (run < chunk->number_of_runs && index >= chunk->runs[run]->number_of_tokens) {");
+    output_line(out, "        index -= chunk->runs[run]->number_of_tokens;");
+    output_line(out, "        run++;");
+    output_line(out, "    }");
+    output_line(out, "    if (run == chunk->number_of_runs)");
+    output_line(out, "        return run * %%token-run-length;");
+    output_line(out, "    return run * %%token-run-length + index;");
     output_line(out, "}");
-    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_from_string(const char *string) {");
-    output_line(out, "    return %%prefix_tree_create_with_options((struct %%prefix_tree_options){ .string = string });");
+    output_line(out, "static struct stack_guess *add_guess(struct parallel_chunk *chunk) {");
+    output_line(out, "    if (chunk->number_of_guesses >= chunk->guesses_capacity) {");
+    output_line(out, "        size_t new_capacity = (chunk->guesses_capacity + 2) * 3 / 2;");
+    output_line(out, "        struct stack_guess *guesses = reallocate_memory(chunk->guesses, chunk->guesses_capacity * sizeof(struct stack_guess), new_capacity * sizeof(struct stack_guess), chunk->allocator);");
+    output_line(out, "        if (!guesses)");
+    output_line(out, "            abort();");
+    output_line(out, "        for (size_t i = chunk->guesses_capacity; i < new_capacity; ++i)");
+    output_line(out, "            guesses[i] = (struct stack_guess){ .cont.allocator = chunk->allocator };");
+    output_line(out, "        chunk->guesses = guesses;");
+    output_line(out, "        chunk->guesses_capacity = new_capacity;");
+    output_line(out, "    }");
+    output_line(out, "    struct stack_guess *guess = &chunk->guesses[chunk->number_of_guesses++];");
+    output_line(out, "    guess->out_of_stack = false;");
+    output_line(out, "    guess->empty = false;");
+    output_line(out, "    return guess;");
     output_line(out, "}");
-    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_from_file(FILE *file) {");
-    output_line(out, "    if (!file)");
-    output_line(out, "        return %%prefix_tree_create_with_error(ERROR_INVALID_FILE);");
-    output_line(out, "    return %%prefix_tree_create_with_options((struct %%prefix_tree_options){ .file = file });");
+    output_line(out, "static void start_guessing(struct parallel_chunk *chunk, size_t start, bool empty) {");
+    output_line(out, "    chunk->number_of_guesses = 0;");
+    output_line(out, "    struct stack_guess *guess = add_guess(chunk);");
+    output_line(out, "    if (!empty)");
+    output_line(out, "        copy_fill_run_stack(&guess->cont, chunk->cont.stack, chunk->cont.top_index + 1);");
+    output_line(out, "    guess->position = start;");
+    output_line(out, "    guess->out_of_stack = true;");
+    output_line(out, "    guess->empty = empty;");
     output_line(out, "}");
-    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_with_options(struct %%prefix_tree_options options) {");
-    output_line(out, "    if (!options.file == !options.string)");
-    output_line(out, "        return %%prefix_tree_create_with_error(ERROR_INVALID_OPTIONS);");
-    output_line(out, "    if (options.file) {");
-    output_line(out, "        char *str = 0;");
-    output_line(out, "        size_t len = 32;");
-    output_line(out, "        size_t off = 0;");
-    output_line(out, "        while (true) {");
-    output_line(out, "            len = len * 3 / 2;");
-    output_line(out, "            char *s = realloc(str, len);");
-    output_line(out, "            if (!s) {");
-    output_line(out, "                free(str);");
+    output_line(out, "static void put_base_below(struct stack_guess *guess, const struct speculative_base *base) {");
+    output_line(out, "    size_t depth = guess->empty ? 0 : guess->cont.top_index + 1;");
+    output_line(out, "    reserve_fill_run_stack(&guess->cont, depth + 1);");
+    output_line(out, "    memmove(guess->cont.stack + 1, guess->cont.stack, depth * sizeof(struct fill_run_state));");
+    output_line(out, "    guess->cont.stack[0].state = base->state;");
+    output_line(out, "    memcpy(guess->cont.stack[0].reachability_mask, base->reachability_mask, sizeof(base->reachability_mask));");
+    output_line(out, "    guess->cont.top_index = depth;");
+    output_line(out, "    guess->out_of_stack = false;");
+    output_line(out, "    guess->empty = false;");
+    output_line(out, "}");
+    output_line(out, "static void fork_guess(struct parallel_chunk *chunk, size_t from, const struct speculative_base *base) {");
+    output_line(out, "    struct stack_guess *guess = add_guess(chunk);");
+    output_line(out, "    struct stack_guess *parent = &chunk->guesses[from];");
+    output_line(out, "    size_t depth = parent->empty ? 0 : parent->cont.top_index + 1;");
+    output_line(out, "    reserve_fill_run_stack(&guess->cont, depth + 1);");
+    output_line(out, "    // An empty guess may not have a stack to copy from.");
+    output_line(out, "    if (depth > 0)");
+    output_line(out, "        memcpy(guess->cont.stack, parent->cont.stack, depth * sizeof(struct fill_run_state));");
+    output_line(out, "    guess->cont.top_index = parent->cont.top_index;");
+    output_line(out, "    guess->position = parent->position;");
+    output_line(out, "    guess->empty = parent->empty;");
+    output_line(out, "    put_base_below(guess, base);");
+    output_line(out, "}");
+    output_line(out, "// Runs the guesses up to position `end`.  Guesses which fail are dropped, and");
+    output_line(out, "// guesses which run out of stack fork into a guess for each speculative base");
+    output_line(out, "// below them.  Returns false if there would be too many guesses.");
+    output_line(out, "static bool advance_guesses(struct parallel_chunk *chunk, size_t end) {");
+    output_line(out, "    size_t i = 0;");
+    output_line(out, "    while (i < chunk->number_of_guesses) {");
+    output_line(out, "        struct stack_guess *guess = &chunk->guesses[i];");
+    output_line(out, "        if (guess->position >= end) {");
+    output_line(out, "            i++;");
+    output_line(out, "            continue;");
+    output_line(out, "        }");
+    output_line(out, "        if (guess->out_of_stack) {");
+    output_line(out, "            if (chunk->number_of_guesses > 1 && chunk->number_of_guesses + %%number-of-speculative-bases - 1 > OWL_THREAD_MAX_GUESSES)");
+    output_line(out, "                return false;");
+    output_line(out, "            for (size_t j = 1; j < %%number-of-speculative-bases; ++j)");
+    output_line(out, "                fork_guess(chunk, i, &speculative_bases[j]);");
+    output_line(out, "            put_base_below(&chunk->guesses[i], &speculative_bases[0]);");
+    output_line(out, "            continue;");
+    output_line(out, "        }");
+    output_line(out, "        for (size_t j = 0; j <= guess->cont.top_index; ++j)");
+    output_line(out, "            guess->cont.stack[j].cont = &guess->cont;");
+    output_line(out, "        size_t failing_run;");
+    output_line(out, "        uint16_t failing_index;");
+    output_line(out, "        if (fill_positions(chunk->runs, guess->position, end, &guess->cont, chunk->scratch, false, &failing_run, &failing_index))");
+    output_line(out, "            guess->position = end;");
+    output_line(out, "        else if (guess->cont.error == 2) {");
+    output_line(out, "            guess->position = failing_run * %%token-run-length + failing_index;");
+    output_line(out, "            guess->out_of_stack = true;");
+    output_line(out, "        } else {");
+    output_line(out, "            // Swap the failed guess with the last one, so its stack can be");
+    output_line(out, "            // reused.");
+    output_line(out, "            struct stack_guess failed = *guess;");
+    output_line(out, "            *guess = chunk->guesses[--chunk->number_of_guesses];");
+    output_line(out, "            chunk->guesses[chunk->number_of_guesses] = failed;");
+    output_line(out, "        }");
+    output_line(out, "    }");
+    output_line(out, "    return true;");
+    output_line(out, "}");
+    output_line(out, "// Returns the guess all the guesses agree with, if they agree on everything");
+    output_line(out, "// but the mask at the bottom of the stack.  That mask becomes the bits they");
+    output_line(out, "// all share: reachability checks which pass with it pass with each of theirs.");
+    output_line(out, "static struct stack_guess *agreed_guess(struct parallel_chunk *chunk) {");
+    output_line(out, "    struct stack_guess *agreed = &chunk->guesses[0];");
+    output_line(out, "    for (size_t i = 0; i < chunk->number_of_guesses; ++i) {");
+    output_line(out, "        struct stack_guess *guess = &chunk->guesses[i];");
+    output_line(out, "        if (guess->out_of_stack || guess->cont.top_index != agreed->cont.top_index)");
+    output_line(out, "            return 0;");
+    output_line(out, "        for (size_t j = 0; j <= agreed->cont.top_index; ++j) {");
+    output_line(out, "            if (guess->cont.stack[j].state != agreed->cont.stack[j].state)");
+    output_line(out, "                return 0;");
+    output_line(out, "            if (j > 0 && memcmp(guess->cont.stack[j].reachability_mask, agreed->cont.stack[j].reachability_mask, sizeof(agreed->cont.stack[j].reachability_mask)))");
     output_line(out, "                return 0;");
-    output_line(out, "            }");
-    output_line(out, "            str = s;");
-    output_line(out, "            off += fread(str + off, 1, len - off, options.file);");
-    output_line(out, "            if (off < len) {");
-    output_line(out, "                str[off] = '\\0';");
-    output_line(out, "                break;");
-    output_line(out, "            }");
     output_line(out, "        }");
-    output_line(out, "        options.string = str;");
     output_line(out, "    }");
-    output_line(out, "    struct %%prefix_tree *tree = %%prefix_tree_create_empty();");
-    output_line(out, "    if (options.file)");
-    output_line(out, "        tree->owns_string = true;");
-    if (has_custom_tokens) {
-        output_line(out, "    tree->custom_tokenize = options.tokenize;");
-        output_line(out, "    tree->custom_tokenize_info = options.tokenize_info;");
-    }
-    output_line(out, "    parse_string(tree, options.string);");
-    output_line(out, "    return tree;");
+    output_line(out, "    for (size_t i = 1; i < chunk->number_of_guesses; ++i) {");
+    output_line(out, "        for (int j = 0; j < %%reachability-mask-width; ++j)");
+    output_line(out, "            agreed->cont.stack[0].reachability_mask[j] &= chunk->guesses[i].cont.stack[0].reachability_mask[j];");
+    output_line(out, "    }");
+    output_line(out, "    return agreed;");
     output_line(out, "}");
-    output_line(out, "enum %%prefix_error %%prefix_tree_get_error(struct %%prefix_tree *tree, struct source_range *error_range) {");
-    output_line(out, "    if (error_range)");
-    output_line(out, "        *error_range = tree->error_range;");
-    output_line(out, "    return tree->error;");
+    output_line(out, "// Guesses the stack from `start`, where the worker's stack has run out (or,");
+    output_line(out, "// with `empty`, where the worker doesn't have a stack yet).  The guesses run");
+    output_line(out, "// over longer and longer windows until they agree.  If they don't, or there");
+    output_line(out, "// are too many of them, the worker starts guessing again further on.  Returns");
+    output_line(out, "// the position where the guesses agreed, with the agreed stack in the worker's");
+    output_line(out, "// cont, or the end of the chunk if they never did.");
+    output_line(out, "static size_t guess_stack(struct parallel_chunk *chunk, size_t start, bool empty) {");
+    output_line(out, "    size_t chunk_end = chunk->number_of_runs * %%token-run-length;");
+    output_line(out, "    size_t window = 16;");
+    output_line(out, "    start_guessing(chunk, start, empty);");
+    output_line(out, "    while (true) {");
+    output_line(out, "        size_t end = position_after(chunk, start, window);");
+    output_line(out, "        bool ok = advance_guesses(chunk, end);");
+    output_line(out, "        if (end == chunk_end || chunk->number_of_guesses == 0)");
+    output_line(out, "            return chunk_end;");
+    output_line(out, "        struct stack_guess *agreed = ok ? agreed_guess(chunk) : 0;");
+    output_line(out, "        if (agreed) {");
+    output_line(out, "            copy_fill_run_stack(&chunk->cont, agreed->cont.stack, agreed->cont.top_index + 1);");
+    output_line(out, "            return end;");
+    output_line(out, "        }");
+    output_line(out, "        if (ok && window < 16384)");
+    output_line(out, "            window *= 4;");
+    output_line(out, "        else {");
+    output_line(out, "            // Bracket symbol placeholders are only ever seen by the state");
+    output_line(out, "            // which ends a bracket, so guessing can't start at one.");
+    output_line(out, "            start = end;");
+    output_line(out, "            if (chunk->runs[start / %%token-run-length]->tokens[start % %%token-run-length] == %%bracket-symbol-token)");
+    output_line(out, "                start = position_after(chunk, start, 1);");
+    output_line(out, "            window = 16;");
+    output_line(out, "            start_guessing(chunk, start, true);");
+    output_line(out, "        }");
+    output_line(out, "    }");
     output_line(out, "}");
-    output_line(out, "void %%prefix_tree_destroy(struct %%prefix_tree *tree) {");
-    output_line(out, "    if (!tree)");
-    output_line(out, "        return;");
-    output_line(out, "    if (tree->owns_string)");
-    output_line(out, "        free((void *)tree->string);");
-    output_line(out, "    free(tree->parse_tree);");
-    output_line(out, "    free(tree);");
+    output_line(out, "static void *check_chunk(void *data) {");
+    output_line(out, "    struct parallel_chunk *chunk = data;");
+    output_line(out, "    size_t chunk_end = chunk->number_of_runs * %%token-run-length;");
+    output_line(out, "    chunk->scratch = allocate_memory(sizeof(struct owl_token_run), chunk->allocator);");
+    output_line(out, "    if (!chunk->scratch)");
+    output_line(out, "        abort();");
+    output_line(out, "    size_t position = guess_stack(chunk, 0, true);");
+    output_line(out, "    while (position < chunk_end) {");
+    output_line(out, "        struct filled_stretch stretch = {");
+    output_line(out, "            .start = position,");
+    output_line(out, "            .before = save_fill_run_stack(&chunk->cont, chunk->allocator),");
+    output_line(out, "            .before_depth = chunk->cont.top_index + 1,");
+    output_line(out, "        };");
+    output_line(out, "        size_t failing_run;");
+    output_line(out, "        uint16_t failing_index;");
+    output_line(out, "        bool ok = fill_positions(chunk->runs, position, chunk_end, &chunk->cont, chunk->scratch, true, &failing_run, &failing_index);");
+    output_line(out, "        if (!ok && chunk->cont.error != 2) {");
+    output_line(out, "            // This is either a real error or a bad guess; either way, it's");
+    output_line(out, "            // left for the sequential pass.");
+    output_line(out, "            free_memory(stretch.before, stretch.before_depth * sizeof(struct fill_run_state), chunk->allocator);");
+    output_line(out, "            break;");
+    output_line(out, "        }");
+    output_line(out, "        stretch.end = ok ? chunk_end : failing_run * %%token-run-length + failing_index;");
+    output_line(out, "        stretch.after = save_fill_run_stack(&chunk->cont, chunk->allocator);");
+    output_line(out, "        stretch.after_depth = chunk->cont.top_index + 1;");
+    output_line(out, "        if (chunk->number_of_stretches >= chunk->stretches_capacity) {");
+    output_line(out, "            size_t new_capacity = (chunk->stretches_capacity + 2) * 3 / 2;");
+    output_line(out, "            struct filled_stretch *stretches = reallocate_memory(chunk->stretches, chunk->stretches_capacity * sizeof(struct filled_stretch), new_capacity * sizeof(struct filled_stretch), chunk->allocator);");
+    output_line(out, "            if (!stretches)");
+    output_line(out, "                abort();");
+    output_line(out, "            chunk->stretches = stretches;");
+    output_line(out, "            chunk->stretches_capacity = new_capacity;");
+    output_line(out, "        }");
+    output_line(out, "        chunk->stretches[chunk->number_of_stretches++] = stretch;");
+    output_line(out, "        if (ok)");
+    output_line(out, "            break;");
+    output_line(out, "        position = guess_stack(chunk, stretch.end, false);");
+    output_line(out, "    }");
+    output_line(out, "    for (size_t i = 0; i < chunk->guesses_capacity; ++i)");
+    output_line(out, "        free_memory(chunk->guesses[i].cont.stack, chunk->guesses[i].cont.capacity * sizeof(struct fill_run_state), chunk->allocator);");
+    output_line(out, "    free_memory(chunk->guesses, chunk->guesses_capacity * sizeof(struct stack_guess), chunk->allocator);");
+    output_line(out, "    free_memory(chunk->cont.stack, chunk->cont.capacity * sizeof(struct fill_run_state), chunk->allocator);");
+    output_line(out, "    free_memory(chunk->scratch, sizeof(struct owl_token_run), chunk->allocator);");
+    output_line(out, "    return 0;");
     output_line(out, "}");
-    output_line(out, "static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index) {");
-    output_line(out, "    uint16_t token_index = 0;");
-    output_line(out, "    uint16_t number_of_tokens = run->number_of_tokens;");
-    output_line(out, "    while (token_index < number_of_tokens) {");
-    output_line(out, "        struct fill_run_state *top = &cont->stack[cont->top_index];");
-    output_line(out, "        run->states[token_index] = top->state;");
-    output_line(out, "        state_funcs[top->state](run, top, token_index);");
-    output_line(out, "        if (cont->error) {");
-    output_line(out, "            *failing_index = token_index - (cont->error > 0 ? 0 : 1);");
+    output_line(out, "// Checks whether the top of the real stack matches the stack a stretch started");
+    output_line(out, "// with, so filling it in from the real stack would do exactly what the worker");
+    output_line(out, "// did.  The real frame at the bottom can have more mask bits than the guess.");
+    output_line(out, "static bool stretch_matches(struct fill_run_continuation *cont, struct filled_stretch *stretch) {");
+    output_line(out, "    if (cont->top_index + 1 < stretch->before_depth)");
+    output_line(out, "        return false;");
+    output_line(out, "    struct fill_run_state *top = cont->stack + cont->top_index + 1 - stretch->before_depth;");
+    output_line(out, "    for (size_t i = 0; i < stretch->before_depth; ++i) {");
+    output_line(out, "        if (top[i].state != stretch->before[i].state)");
     output_line(out, "            return false;");
+    output_line(out, "        for (int j = 0; j < %%reachability-mask-width; ++j) {");
+    output_line(out, "            uint32_t bits = stretch->before[i].reachability_mask[j];");
+    output_line(out, "            uint32_t real_bits = top[i].reachability_mask[j];");
+    output_line(out, "            if (i == 0 ? (real_bits & bits) != bits : real_bits != bits)");
+    output_line(out, "                return false;");
     output_line(out, "        }");
-    output_line(out, "        token_index++;");
     output_line(out, "    }");
     output_line(out, "    return true;");
     output_line(out, "}");
-    generate_action_table(gen, out);
-    output_line(out, "static size_t read_whitespace(const char *text, void *info) {");
-    struct generated_token *tokens = malloc(sizeof(struct generated_token) *
-     gen->grammar->number_of_whitespace_tokens);
-    if (!tokens) {
-        fputs("critical error: out of memory\n", stderr);
-        exit(-1);
-    }
-    for (uint32_t i = 0; i < gen->grammar->number_of_whitespace_tokens; ++i)
-        tokens[i].token = gen->grammar->whitespace_tokens[i];
-    generate_keyword_reader(tokens, gen->grammar->number_of_whitespace_tokens,
-     out);
-    free(tokens);
+    output_line(out, "static void take_stretch_stack(struct fill_run_continuation *cont, struct filled_stretch *stretch) {");
+    output_line(out, "    size_t base = cont->top_index + 1 - stretch->before_depth;");
+    output_line(out, "    reserve_fill_run_stack(cont, base + stretch->after_depth);");
+    output_line(out, "    cont->stack[base].state = stretch->after[0].state;");
+    output_line(out, "    for (size_t i = 1; i < stretch->after_depth; ++i) {");
+    output_line(out, "        cont->stack[base + i] = stretch->after[i];");
+    output_line(out, "        cont->stack[base + i].cont = cont;");
+    output_line(out, "    }");
+    output_line(out, "    cont->top_index = base + stretch->after_depth - 1;");
     output_line(out, "}");
-    output_line(out, "static size_t read_keyword_token(%%token-type *token, bool *end_token, const char *text, void *info) {");
-    uint32_t number_of_tokens = gen->combined->number_of_keyword_tokens +
-     gen->grammar->number_of_comment_tokens;
-    tokens = malloc(sizeof(struct generated_token) * (size_t)number_of_tokens);
-    if (!tokens) {
-        fputs("critical error: out of memory\n", stderr);
-        exit(-1);
-    }
-    uint32_t i = 0;
-    for (; i < gen->combined->number_of_keyword_tokens; ++i)
-        tokens[i].token = gen->combined->tokens[i];
-    for (uint32_t j = 0; j < gen->grammar->number_of_comment_tokens; ++j)
-        tokens[i + j].token = gen->grammar->comment_tokens[j];
-    qsort(tokens, number_of_tokens, sizeof(struct generated_token),
-     compare_tokens);
-    generate_keyword_reader(tokens, number_of_tokens, out);
-    free(tokens);
+    output_line(out, "// Puts back the bracket placeholders a worker replaced with bracket symbols");
+    output_line(out, "// while filling in a stretch.");
+    output_line(out, "static void restore_bracket_placeholders(struct owl_token_run **runs, size_t start, size_t end) {");
+    output_line(out, "    for (size_t i = start; i < end; ++i) {");
+    output_line(out, "        struct owl_token_run *run = runs[i / %%token-run-length];");
+    output_line(out, "        if (i % %%token-run-length >= run->number_of_tokens) {");
+    output_line(out, "            i = (i / %%token-run-length + 1) * %%token-run-length - 1;");
+    output_line(out, "            continue;");
+    output_line(out, "        }");
+    output_line(out, "        if (run->tokens[i % %%token-run-length] >= %%number-of-token-classes)");
+    output_line(out, "            run->tokens[i % %%token-run-length] = %%bracket-symbol-token;");
+    output_line(out, "    }");
     output_line(out, "}");
-    output_line(out, "static uint32_t rule_lookup(uint32_t parent, uint32_t slot, void *context) {");
-    output_line(out, "    switch (parent) {");
-    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
-        struct rule *rule = gen->grammar->rules[i];
-        if (rule->number_of_slots == 0)
-            continue;
-        set_unsigned_number_substitution(out, "rule-index", i);
-        output_line(out, "    case %%rule-index:");
-        output_line(out, "        switch (slot) {");
-        for (uint32_t j = 0; j < rule->number_of_slots; ++j) {
-            set_unsigned_number_substitution(out, "slot-index", j);
-            set_unsigned_number_substitution(out, "slot-rule-index",
-             rule->slots[j].rule_index);
-            output_line(out, "        case %%slot-index: return %%slot-rule-index;");
-        }
+    output_line(out, "static void add_run_end(struct run_end **ends, size_t *number_of_runs, size_t *capacity, struct run_end end, struct owl_allocator *allocator) {");
+    output_line(out, "    if (*number_of_runs >= *capacity) {");
+    output_line(out, "        size_t new_capacity = (*capacity + 2) * 3 / 2;");
+    output_line(out, "        struct run_end *new_ends = reallocate_memory(*ends, *capacity * sizeof(struct run_end), new_capacity * sizeof(struct run_end), allocator);");
+    output_line(out, "        if (!new_ends)");
+    output_line(out, "            abort();");
+    output_line(out, "        *ends = new_ends;");
+    output_line(out, "        *capacity = new_capacity;");
+    output_line(out, "    }");
+    output_line(out, "    (*ends)[(*number_of_runs)++] = end;");
+    output_line(out, "}");
+    output_line(out, "// Tokenizes until the tokenizer reaches its `stop` (or the end of the text, or");
+    output_line(out, "// an invalid token).");
+    output_line(out, "static void tokenize_runs(struct %%prefix_parser *parser, struct run_end **ends, size_t *number_of_runs, size_t *capacity) {");
+    output_line(out, "    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;");
+    output_line(out, "    while (owl_default_tokenizer_advance(tokenizer, &parser->token_run))");
+    output_line(out, "        add_run_end(ends, number_of_runs, capacity, (struct run_end){ tokenizer->offset, tokenizer->whitespace }, &parser->allocator);");
+    output_line(out, "}");
+    output_line(out, "// Writes the token data from a worker's log into the tree.");
+    output_line(out, "static void replay_token_log(struct %%prefix_tree *tree, struct token_log *log, const char *text, size_t start, size_t end) {");
+    output_line(out, "    (void)text;");
+    output_line(out, "    for (size_t i = start; i < end; ++i) {");
+    output_line(out, "        struct logged_token token = log->tokens[i];");
+    output_line(out, "        switch (token.kind) {");
+    if (has_identifier_token) {
+    output_line(out, "        case LOGGED_IDENTIFIER_TOKEN:");
+    output_line(out, "            write_identifier_token(token.offset, token.length, tree);");
+    output_line(out, "            break;");
+    }
+    if (has_integer_token) {
+    output_line(out, "        case LOGGED_INTEGER_TOKEN:");
+    output_line(out, "            write_integer_token(token.offset, token.length, token.data, tree);");
+    output_line(out, "            break;");
+    }
+    if (has_number_token) {
+    output_line(out, "        case LOGGED_NUMBER_TOKEN: {");
+    output_line(out, "            union { double n; uint64_t v; } u = { .v = token.data };");
+    output_line(out, "            write_number_token(token.offset, token.length, u.n, tree);");
+    output_line(out, "            break;");
+    output_line(out, "        }");
+    }
+    if (has_string_token) {
+    output_line(out, "        case LOGGED_STRING_TOKEN:");
+    output_line(out, "            if (token.has_escapes) {");
+    output_line(out, "                char *string = allocate_string_contents(token.extra, tree);");
+    output_line(out, "                memcpy(string, log->strings + token.data, token.extra);");
+    output_line(out, "                write_string_token(token.offset, token.length, string, token.extra, true, tree);");
+    output_line(out, "            } else");
+    output_line(out, "                write_string_token(token.offset, token.length, text + token.offset + 1, token.extra, false, tree);");
+    output_line(out, "            break;");
+    }
+    if (has_write_custom_token) {
+    output_line(out, "        case LOGGED_CUSTOM_TOKEN:");
+    output_line(out, "            write_custom_token(token.offset, token.length, (uint32_t)token.extra, token.data, tree);");
+    output_line(out, "            break;");
+    }
+    output_line(out, "        default:");
+    output_line(out, "            break;");
+    output_line(out, "        }");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "// Workers start their tokenizers with this much whitespace, so the whitespace");
+    output_line(out, "// before their first token takes as many bytes as any length can.  Once the");
+    output_line(out, "// real amount is known, it's written over the top (see set_first_whitespace).");
+    output_line(out, "#define UNKNOWN_WHITESPACE (SIZE_MAX / 2 + 1)");
+    output_line(out, "static void set_first_whitespace(struct owl_token_run *run, size_t whitespace) {");
+    output_line(out, "    // Skip over the first token's length.");
+    output_line(out, "    uint16_t start = 1;");
+    output_line(out, "    while (run->lengths[start] & 0x80)");
+    output_line(out, "        start++;");
+    output_line(out, "    uint16_t end = start + 1;");
+    output_line(out, "    while (end < run->lengths_size && (run->lengths[end] & 0x80))");
+    output_line(out, "        end++;");
+    output_line(out, "    size_t value = 0;");
+    output_line(out, "    for (uint16_t i = end; i > start; --i)");
+    output_line(out, "        value = value << 7 | (run->lengths[i - 1] & 0x7f);");
+    output_line(out, "    value = value - UNKNOWN_WHITESPACE + whitespace;");
+    output_line(out, "    // Higher groups of zeros pad the new value out to the same size.");
+    output_line(out, "    for (uint16_t i = start; i < end; ++i) {");
+    output_line(out, "        run->lengths[i] = (i > start ? 0x80 : 0) | (value & 0x7f);");
+    output_line(out, "        value >>= 7;");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "// A token run from a worker, with where the worker's tokenizer was before and");
+    output_line(out, "// after it.");
+    output_line(out, "struct tokenized_run {");
+    output_line(out, "    struct owl_token_run *run;");
+    output_line(out, "    struct run_end start;");
+    output_line(out, "    struct run_end end;");
+    output_line(out, "    // The run's token data starts at this index in the worker's log.");
+    output_line(out, "    size_t first_logged_token;");
+    output_line(out, "};");
+    output_line(out, "// A range of the text for a worker thread to tokenize.  The worker doesn't know");
+    output_line(out, "// where tokens start in the range, so it guesses.  Its runs are only used if");
+    output_line(out, "// the main thread's tokenizer (which knows where it is) reaches the start of");
+    output_line(out, "// one in the same state -- after that, both tokenizers see the same tokens.");
+    output_line(out, "struct tokenized_range {");
+    output_line(out, "    const char *text;");
+    output_line(out, "    size_t start;");
+    output_line(out, "    size_t end;");
+    output_line(out, "    // The number of double quotes in the range which don't follow a backslash,");
+    output_line(out, "    // and whether the range starts inside a double-quoted string.");
+    output_line(out, "    size_t quotes;");
+    output_line(out, "    bool in_string;");
+    output_line(out, "    struct owl_default_tokenizer tokenizer;");
+    output_line(out, "    // A copy of the tree which writes its token data to `log`.");
+    output_line(out, "    struct %%prefix_tree tree;");
+    output_line(out, "    struct token_log log;");
+    output_line(out, "    struct tokenized_run *runs;");
+    output_line(out, "    size_t number_of_runs;");
+    output_line(out, "    size_t runs_capacity;");
+    output_line(out, "    bool started;");
+    output_line(out, "    pthread_t thread;");
+    output_line(out, "};");
+    if (has_string_token) {
+    output_line(out, "// Counts the double quotes in [start, end) which don't follow a backslash.");
+    output_line(out, "// Comments and single-quoted strings aren't taken into account, so this is only");
+    output_line(out, "// an estimate of how many strings start or end in the range.");
+    output_line(out, "static size_t count_quotes(const char *text, size_t start, size_t end) {");
+    output_line(out, "    size_t count = 0;");
+    output_line(out, "    size_t offset = start;");
+    output_line(out, "#ifdef OWL_SIMD");
+    output_line(out, "    // Like simdjson, make a mask of the quotes and a mask of the bytes after");
+    output_line(out, "    // backslashes for each block.");
+    output_line(out, "    uint32_t escaped = offset > 0 && text[offset - 1] == '\\\\';");
+    output_line(out, "    while (offset + 16 <= end) {");
+    output_line(out, "        vector_bytes_sse2 x;");
+    output_line(out, "        memcpy(&x, text + offset, 16);");
+    output_line(out, "        uint32_t quotes = (uint32_t)__builtin_ia32_pmovmskb128(vector_equal_sse2(x, '\"'));");
+    output_line(out, "        uint32_t backslashes = (uint32_t)__builtin_ia32_pmovmskb128(vector_equal_sse2(x, '\\\\'));");
+    output_line(out, "        count += (size_t)__builtin_popcount(quotes & ~(backslashes << 1 | escaped));");
+    output_line(out, "        escaped = backslashes >> 15;");
+    output_line(out, "        offset += 16;");
+    output_line(out, "    }");
+    output_line(out, "#endif");
+    output_line(out, "    for (; offset < end; ++offset) {");
+    output_line(out, "        if (text[offset] == '\"' && (offset == 0 || text[offset - 1] != '\\\\'))");
+    output_line(out, "            count++;");
+    output_line(out, "    }");
+    output_line(out, "    return count;");
+    output_line(out, "}");
+    output_line(out, "static void *count_range_quotes(void *data) {");
+    output_line(out, "    struct tokenized_range *range = data;");
+    output_line(out, "    range->quotes = count_quotes(range->text, range->start, range->end);");
+    output_line(out, "    return 0;");
+    output_line(out, "}");
+    }
+    output_line(out, "// Guesses where a token starts in [offset, end): at the start of a line (after");
+    output_line(out, "// its indentation), or where a string starts or ends.  Returns `end` if there's");
+    output_line(out, "// nowhere to guess.");
+    output_line(out, "static size_t guess_token_start(const char *text, size_t offset, size_t end, bool in_string) {");
+    output_line(out, "    for (; offset < end; ++offset) {");
+    if (has_string_token) {
+    output_line(out, "        if (text[offset] == '\"' && (offset == 0 || text[offset - 1] != '\\\\')) {");
+    output_line(out, "            return in_string ? offset + 1 : offset;");
+    output_line(out, "        }");
+    }
+    output_line(out, "        if (!in_string && text[offset] == '\\n') {");
+    output_line(out, "            offset++;");
+    output_line(out, "            size_t whitespace;");
+    output_line(out, "            while (offset < end && (whitespace = read_whitespace(text + offset, end - offset, 0)) > 0)");
+    output_line(out, "                offset += whitespace;");
+    output_line(out, "            return offset < end ? offset : end;");
+    output_line(out, "        }");
+    output_line(out, "    }");
+    output_line(out, "    return end;");
+    output_line(out, "}");
+    output_line(out, "static void *tokenize_range(void *data) {");
+    output_line(out, "    struct tokenized_range *range = data;");
+    output_line(out, "    struct owl_default_tokenizer *tokenizer = &range->tokenizer;");
+    output_line(out, "    size_t limit = tokenizer->stop ? tokenizer->stop : tokenizer->length;");
+    output_line(out, "    size_t offset = range->start;");
+    output_line(out, "    while (offset < limit) {");
+    output_line(out, "        tokenizer->offset = offset;");
+    output_line(out, "        tokenizer->whitespace = UNKNOWN_WHITESPACE;");
+    output_line(out, "        for (;;) {");
+    output_line(out, "            struct tokenized_run t = {");
+    output_line(out, "                .start = { tokenizer->offset, tokenizer->whitespace },");
+    output_line(out, "                .first_logged_token = range->log.number_of_tokens,");
+    output_line(out, "            };");
+    output_line(out, "            if (!owl_default_tokenizer_advance(tokenizer, &t.run))");
+    output_line(out, "                break;");
+    output_line(out, "            t.end = (struct run_end){ tokenizer->offset, tokenizer->whitespace };");
+    output_line(out, "            if (range->number_of_runs >= range->runs_capacity) {");
+    output_line(out, "                size_t capacity = (range->runs_capacity + 8) * 2;");
+    output_line(out, "                struct tokenized_run *runs = reallocate_memory(range->runs, range->runs_capacity * sizeof(struct tokenized_run), capacity * sizeof(struct tokenized_run), tokenizer->allocator);");
+    output_line(out, "                if (!runs)");
+    output_line(out, "                    abort();");
+    output_line(out, "                range->runs = runs;");
+    output_line(out, "                range->runs_capacity = capacity;");
+    output_line(out, "            }");
+    output_line(out, "            range->runs[range->number_of_runs++] = t;");
+    output_line(out, "        }");
+    output_line(out, "        if (tokenizer->offset >= limit)");
+    output_line(out, "            break;");
+    output_line(out, "        // Either the guess was wrong or the text has an invalid token here.  In");
+    output_line(out, "        // case it was the guess, guess again further on.");
+    output_line(out, "        offset = guess_token_start(range->text, tokenizer->offset + 1, limit, false);");
+    output_line(out, "    }");
+    output_line(out, "    return 0;");
+    output_line(out, "}");
+    output_line(out, "// Tokenizes the text into the parser's token runs, with the tokenizer ending up");
+    output_line(out, "// where it would have if it had tokenized the text by itself.  The text is");
+    output_line(out, "// split into ranges; worker threads tokenize all of them but the first, while");
+    output_line(out, "// this thread tokenizes the first, then goes through the workers' runs in order.");
+    output_line(out, "static void tokenize_in_parallel(struct %%prefix_parser *parser, const char *text, size_t length, unsigned threads, struct run_end **ends, size_t *number_of_runs, size_t *capacity) {");
+    output_line(out, "    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;");
+    output_line(out, "    size_t number_of_ranges = length / OWL_THREAD_MIN_BYTES;");
+    output_line(out, "    if (number_of_ranges > threads)");
+    output_line(out, "        number_of_ranges = threads;");
+    if (has_custom_tokens) {
+    output_line(out, "    // Custom tokenizers aren't expected to be called from more than one thread.");
+    output_line(out, "    if (parser->tree->custom_tokenize)");
+    output_line(out, "        number_of_ranges = 0;");
+    }
+    output_line(out, "    if (number_of_ranges < 2) {");
+    output_line(out, "        tokenize_runs(parser, ends, number_of_runs, capacity);");
+    output_line(out, "        return;");
+    output_line(out, "    }");
+    output_line(out, "    struct %%prefix_tree tree_before = *parser->tree;");
+    output_line(out, "    struct tokenized_range *ranges = allocate_memory(number_of_ranges * sizeof(struct tokenized_range), &parser->allocator);");
+    output_line(out, "    if (!ranges)");
+    output_line(out, "        abort();");
+    output_line(out, "    for (size_t i = 0; i < number_of_ranges; ++i) {");
+    output_line(out, "        ranges[i] = (struct tokenized_range){");
+    output_line(out, "            .text = text,");
+    output_line(out, "            .start = length * i / number_of_ranges,");
+    output_line(out, "            .end = length * (i + 1) / number_of_ranges,");
+    output_line(out, "        };");
+    output_line(out, "    }");
+    if (has_string_token) {
+    output_line(out, "    // Which ranges start inside strings depends on the quotes in all the ranges");
+    output_line(out, "    // before them (but not the last one).");
+    output_line(out, "    for (size_t i = 1; i + 1 < number_of_ranges; ++i) {");
+    output_line(out, "        ranges[i].started = pthread_create(&ranges[i].thread, 0, count_range_quotes, &ranges[i]) == 0;");
+    output_line(out, "        if (!ranges[i].started)");
+    output_line(out, "            count_range_quotes(&ranges[i]);");
+    output_line(out, "    }");
+    output_line(out, "    count_range_quotes(&ranges[0]);");
+    output_line(out, "    for (size_t i = 1; i < number_of_ranges; ++i) {");
+    output_line(out, "        struct tokenized_range *before = &ranges[i - 1];");
+    output_line(out, "        if (before->started)");
+    output_line(out, "            pthread_join(before->thread, 0);");
+    output_line(out, "        before->started = false;");
+    output_line(out, "        ranges[i].in_string = before->in_string != (before->quotes % 2 == 1);");
+    output_line(out, "    }");
+    }
+    output_line(out, "    for (size_t i = 1; i < number_of_ranges; ++i)");
+    output_line(out, "        ranges[i].start = guess_token_start(text, ranges[i].start, ranges[i].end, ranges[i].in_string);");
+    output_line(out, "    for (size_t i = 1; i < number_of_ranges; ++i) {");
+    output_line(out, "        struct tokenized_range *range = &ranges[i];");
+    output_line(out, "        range->log = (struct token_log){");
+    output_line(out, "            .discard = parser->validating,");
+    output_line(out, "            .allocator = &parser->allocator,");
+    output_line(out, "        };");
+    output_line(out, "        range->tree = *parser->tree;");
+    output_line(out, "        range->tree.token_log = &range->log;");
+    output_line(out, "        range->tokenizer = *tokenizer;");
+    output_line(out, "        range->tokenizer.info = &range->tree;");
+    output_line(out, "        range->tokenizer.free_runs = 0;");
+    output_line(out, "        range->tokenizer.stop = i + 1 < number_of_ranges ? ranges[i + 1].start : 0;");
+    output_line(out, "        range->started = pthread_create(&range->thread, 0, tokenize_range, range) == 0;");
+    output_line(out, "    }");
+    output_line(out, "    bool failed = false;");
+    output_line(out, "    for (size_t i = 1; i < number_of_ranges; ++i) {");
+    output_line(out, "        struct tokenized_range *range = &ranges[i];");
+    output_line(out, "        if (!failed) {");
+    output_line(out, "            tokenizer->stop = range->start;");
+    output_line(out, "            tokenize_runs(parser, ends, number_of_runs, capacity);");
+    output_line(out, "            failed = tokenizer->offset < tokenizer->stop;");
+    output_line(out, "        }");
+    output_line(out, "        if (range->started)");
+    output_line(out, "            pthread_join(range->thread, 0);");
+    output_line(out, "        for (size_t j = 0; j < range->number_of_runs; ++j) {");
+    output_line(out, "            struct tokenized_run *t = &range->runs[j];");
+    output_line(out, "            if (!failed && tokenizer->offset < t->start.offset) {");
+    output_line(out, "                tokenizer->stop = t->start.offset;");
+    output_line(out, "                tokenize_runs(parser, ends, number_of_runs, capacity);");
+    output_line(out, "                failed = tokenizer->offset < tokenizer->stop;");
+    output_line(out, "            }");
+    output_line(out, "            bool unknown_whitespace = t->start.whitespace >= UNKNOWN_WHITESPACE;");
+    output_line(out, "            if (failed || tokenizer->offset != t->start.offset || (!unknown_whitespace && tokenizer->whitespace != t->start.whitespace)) {");
+    output_line(out, "                t->run->prev = tokenizer->free_runs;");
+    output_line(out, "                tokenizer->free_runs = t->run;");
+    output_line(out, "                continue;");
+    output_line(out, "            }");
+    output_line(out, "            if (unknown_whitespace)");
+    output_line(out, "                set_first_whitespace(t->run, tokenizer->whitespace);");
+    output_line(out, "            size_t end = j + 1 < range->number_of_runs ? t[1].first_logged_token : range->log.number_of_tokens;");
+    output_line(out, "            replay_token_log(parser->tree, &range->log, text, t->first_logged_token, end);");
+    output_line(out, "            t->run->prev = parser->token_run;");
+    output_line(out, "            parser->token_run = t->run;");
+    output_line(out, "            add_run_end(ends, number_of_runs, capacity, t->end, &parser->allocator);");
+    output_line(out, "            tokenizer->offset = t->end.offset;");
+    output_line(out, "            tokenizer->whitespace = t->end.whitespace;");
+    output_line(out, "        }");
+    output_line(out, "        free_memory(range->runs, range->runs_capacity * sizeof(struct tokenized_run), &parser->allocator);");
+    output_line(out, "        free_token_runs(&range->tokenizer.free_runs, &parser->allocator);");
+    output_line(out, "        free_token_log(&range->log);");
+    output_line(out, "    }");
+    output_line(out, "    tokenizer->stop = 0;");
+    output_line(out, "    if (!failed)");
+    output_line(out, "        tokenize_runs(parser, ends, number_of_runs, capacity);");
+    output_line(out, "    free_memory(ranges, number_of_ranges * sizeof(struct tokenized_range), &parser->allocator);");
+    output_line(out, "    if (tokenizer->offset < length) {");
+    output_line(out, "        // The tokens in the run with an invalid token are never checked, so");
+    output_line(out, "        // which error gets reported depends on where the runs end -- and they");
+    output_line(out, "        // end in different places here than they do in parse_text.  To report");
+    output_line(out, "        // the same error, start again on this thread.");
+    output_line(out, "        recycle_token_runs(parser);");
+    output_line(out, "        *number_of_runs = 0;");
+    output_line(out, "        uint8_t *parse_tree = parser->tree->parse_tree;");
+    output_line(out, "        size_t parse_tree_size = parser->tree->parse_tree_size;");
+    output_line(out, "        *parser->tree = tree_before;");
+    output_line(out, "        parser->tree->parse_tree = parse_tree;");
+    output_line(out, "        parser->tree->parse_tree_size = parse_tree_size;");
+    output_line(out, "        tokenizer->offset = 0;");
+    output_line(out, "        tokenizer->whitespace = 0;");
+    output_line(out, "        tokenize_runs(parser, ends, number_of_runs, capacity);");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "// Like parse_text, but tokenizes all the text first (see tokenize_in_parallel),");
+    output_line(out, "// then splits the tokens into chunks for up to `threads` threads.");
+    output_line(out, "static bool parse_text_in_parallel(struct %%prefix_parser *parser, const char *text, size_t length, unsigned threads) {");
+    output_line(out, "    struct %%prefix_tree *tree = parser->tree;");
+    output_line(out, "    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;");
+    output_line(out, "    tokenizer->text = text;");
+    output_line(out, "    tokenizer->length = length;");
+    output_line(out, "    tokenizer->more_input = false;");
+    output_line(out, "    struct run_end *ends = 0;");
+    output_line(out, "    size_t number_of_runs = 0;");
+    output_line(out, "    size_t ends_capacity = 0;");
+    output_line(out, "    tokenize_in_parallel(parser, text, length, threads, &ends, &number_of_runs, &ends_capacity);");
+    output_line(out, "    struct owl_token_run **runs = allocate_memory((number_of_runs + 1) * sizeof(struct owl_token_run *), &parser->allocator);");
+    output_line(out, "    struct owl_token_run *scratch = allocate_memory(sizeof(struct owl_token_run), &parser->allocator);");
+    output_line(out, "    if (!runs || !scratch)");
+    output_line(out, "        abort();");
+    output_line(out, "    struct owl_token_run *run = parser->token_run;");
+    output_line(out, "    for (size_t i = number_of_runs; i > 0; --i) {");
+    output_line(out, "        runs[i - 1] = run;");
+    output_line(out, "        run = run->prev;");
+    output_line(out, "    }");
+    output_line(out, "    size_t number_of_chunks = number_of_runs / OWL_THREAD_MIN_RUNS;");
+    output_line(out, "    if (number_of_chunks > threads)");
+    output_line(out, "        number_of_chunks = threads;");
+    output_line(out, "    if (number_of_chunks == 0)");
+    output_line(out, "        number_of_chunks = 1;");
+    output_line(out, "    struct parallel_chunk *chunks = allocate_memory(number_of_chunks * sizeof(struct parallel_chunk), &parser->allocator);");
+    output_line(out, "    if (!chunks)");
+    output_line(out, "        abort();");
+    output_line(out, "    size_t first_run = 0;");
+    output_line(out, "    for (size_t i = 0; i < number_of_chunks; ++i) {");
+    output_line(out, "        size_t end_run = number_of_runs * (i + 1) / number_of_chunks;");
+    output_line(out, "        chunks[i] = (struct parallel_chunk){");
+    output_line(out, "            .runs = runs + first_run,");
+    output_line(out, "            .number_of_runs = end_run - first_run,");
+    output_line(out, "            .allocator = &parser->allocator,");
+    output_line(out, "            .cont.allocator = &parser->allocator,");
+    output_line(out, "        };");
+    output_line(out, "        // The first chunk starts with the real stack, so it's filled in on");
+    output_line(out, "        // this thread while the workers guess.");
+    output_line(out, "        if (i > 0)");
+    output_line(out, "            chunks[i].started = pthread_create(&chunks[i].thread, 0, check_chunk, &chunks[i]) == 0;");
+    output_line(out, "        first_run = end_run;");
+    output_line(out, "    }");
+    output_line(out, "    size_t failing_run = number_of_runs;");
+    output_line(out, "    uint16_t failing_index = 0;");
+    output_line(out, "    for (size_t i = 0; i < number_of_chunks; ++i) {");
+    output_line(out, "        struct parallel_chunk *chunk = &chunks[i];");
+    output_line(out, "        if (chunk->started)");
+    output_line(out, "            pthread_join(chunk->thread, 0);");
+    output_line(out, "        size_t position = 0;");
+    output_line(out, "        size_t chunk_failing_run = 0;");
+    output_line(out, "        bool ok = failing_run == number_of_runs;");
+    output_line(out, "        for (size_t j = 0; j < chunk->number_of_stretches; ++j) {");
+    output_line(out, "            struct filled_stretch *stretch = &chunk->stretches[j];");
+    output_line(out, "            if (ok)");
+    output_line(out, "                ok = fill_positions(chunk->runs, position, stretch->start, &parser->cont, scratch, true, &chunk_failing_run, &failing_index);");
+    output_line(out, "            if (ok && stretch_matches(&parser->cont, stretch)) {");
+    output_line(out, "                take_stretch_stack(&parser->cont, stretch);");
+    output_line(out, "                position = stretch->end;");
+    output_line(out, "            } else if (ok) {");
+    output_line(out, "                restore_bracket_placeholders(chunk->runs, stretch->start, stretch->end);");
+    output_line(out, "                position = stretch->start;");
+    output_line(out, "            }");
+    output_line(out, "            free_memory(stretch->before, stretch->before_depth * sizeof(struct fill_run_state), &parser->allocator);");
+    output_line(out, "            free_memory(stretch->after, stretch->after_depth * sizeof(struct fill_run_state), &parser->allocator);");
+    output_line(out, "        }");
+    output_line(out, "        if (ok)");
+    output_line(out, "            ok = fill_positions(chunk->runs, position, chunk->number_of_runs * %%token-run-length, &parser->cont, scratch, true, &chunk_failing_run, &failing_index);");
+    output_line(out, "        if (!ok && failing_run == number_of_runs)");
+    output_line(out, "            failing_run = chunk->runs - runs + chunk_failing_run;");
+    output_line(out, "        free_memory(chunk->stretches, chunk->stretches_capacity * sizeof(struct filled_stretch), &parser->allocator);");
+    output_line(out, "    }");
+    output_line(out, "    bool ok = true;");
+    output_line(out, "    if (failing_run < number_of_runs) {");
+    output_line(out, "        struct owl_default_tokenizer at_run = *tokenizer;");
+    output_line(out, "        at_run.offset = ends[failing_run].offset;");
+    output_line(out, "        at_run.whitespace = ends[failing_run].whitespace;");
+    output_line(out, "        tree->error = ERROR_UNEXPECTED_TOKEN;");
+    output_line(out, "        find_token_range(&at_run, runs[failing_run], failing_index, &tree->error_range.start, &tree->error_range.end);");
+    output_line(out, "        ok = false;");
+    output_line(out, "    } else if (tokenizer->offset < length) {");
+    output_line(out, "        tree->error = ERROR_INVALID_TOKEN;");
+    output_line(out, "        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);");
+    output_line(out, "        ok = false;");
+    output_line(out, "    }");
+    output_line(out, "    free_memory(chunks, number_of_chunks * sizeof(struct parallel_chunk), &parser->allocator);");
+    output_line(out, "    free_memory(scratch, sizeof(struct owl_token_run), &parser->allocator);");
+    output_line(out, "    free_memory(runs, (number_of_runs + 1) * sizeof(struct owl_token_run *), &parser->allocator);");
+    if (split_root) {
+        output_line(out, "    if (ok && !parser->validating) {");
+        output_line(out, "        parser->run_ends = ends;");
+        output_line(out, "        parser->number_of_runs = number_of_runs;");
+        output_line(out, "        parser->run_ends_capacity = ends_capacity;");
+        output_line(out, "        parser->threads = threads;");
+        output_line(out, "    } else");
+        output_line(out, "        free_memory(ends, ends_capacity * sizeof(struct run_end), &parser->allocator);");
+    } else
+        output_line(out, "    free_memory(ends, ends_capacity * sizeof(struct run_end), &parser->allocator);");
+    output_line(out, "    if (parser->validating)");
+    output_line(out, "        discard_tokens(parser);");
+    output_line(out, "    return ok;");
+    output_line(out, "}");
+    output_line(out, "// How many token runs the tokenizer can get ahead of the state machine when");
+    output_line(out, "// parsing is pipelined.");
+    output_line(out, "#ifndef OWL_PIPELINE_RUNS");
+    output_line(out, "#define OWL_PIPELINE_RUNS 4");
+    output_line(out, "#endif");
+    output_line(out, "// Token runs passed from the tokenizing thread to the thread filling in their");
+    output_line(out, "// states.  `head` and `tail` count the runs taken and added so far.");
+    output_line(out, "struct run_queue {");
+    output_line(out, "    struct %%prefix_parser *parser;");
+    output_line(out, "    pthread_mutex_t lock;");
+    output_line(out, "    pthread_cond_t not_empty;");
+    output_line(out, "    pthread_cond_t not_full;");
+    output_line(out, "    struct owl_token_run *runs[OWL_PIPELINE_RUNS];");
+    output_line(out, "    struct run_end ends[OWL_PIPELINE_RUNS];");
+    output_line(out, "    size_t head;");
+    output_line(out, "    size_t tail;");
+    output_line(out, "    // Set by the tokenizing thread once the text is used up (or a token is");
+    output_line(out, "    // invalid).");
+    output_line(out, "    bool finished;");
+    output_line(out, "    // Set by the other thread when a run has an unexpected token, so the rest");
+    output_line(out, "    // of the text doesn't need to be tokenized.");
+    output_line(out, "    bool stopped;");
+    output_line(out, "};");
+    output_line(out, "static void *tokenize_into_queue(void *arg) {");
+    output_line(out, "    struct run_queue *queue = arg;");
+    output_line(out, "    struct %%prefix_parser *parser = queue->parser;");
+    output_line(out, "    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;");
+    output_line(out, "    bool more = true;");
+    output_line(out, "    while (more) {");
+    output_line(out, "        more = owl_default_tokenizer_advance(tokenizer, &parser->token_run);");
+    output_line(out, "        pthread_mutex_lock(&queue->lock);");
+    output_line(out, "        if (more) {");
+    output_line(out, "            size_t slot = queue->tail % OWL_PIPELINE_RUNS;");
+    output_line(out, "            queue->runs[slot] = parser->token_run;");
+    output_line(out, "            queue->ends[slot] = (struct run_end){");
+    output_line(out, "                .offset = tokenizer->offset,");
+    output_line(out, "                .whitespace = tokenizer->whitespace,");
+    output_line(out, "            };");
+    output_line(out, "            queue->tail++;");
+    output_line(out, "        } else");
+    output_line(out, "            queue->finished = true;");
+    output_line(out, "        pthread_cond_signal(&queue->not_empty);");
+    output_line(out, "        while (more && queue->tail - queue->head == OWL_PIPELINE_RUNS && !queue->stopped)");
+    output_line(out, "            pthread_cond_wait(&queue->not_full, &queue->lock);");
+    output_line(out, "        if (queue->stopped)");
+    output_line(out, "            more = false;");
+    output_line(out, "        pthread_mutex_unlock(&queue->lock);");
+    output_line(out, "    }");
+    output_line(out, "    return 0;");
+    output_line(out, "}");
+    output_line(out, "// Like parse_text, but the text is tokenized on another thread while this one");
+    output_line(out, "// fills in the states of the runs it has already tokenized.");
+    output_line(out, "static bool parse_text_pipelined(struct %%prefix_parser *parser, const char *text, size_t length) {");
+    output_line(out, "    struct %%prefix_tree *tree = parser->tree;");
+    output_line(out, "    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;");
+    output_line(out, "    tokenizer->text = text;");
+    output_line(out, "    tokenizer->length = length;");
+    output_line(out, "    tokenizer->more_input = false;");
+    output_line(out, "    struct run_queue queue = { .parser = parser };");
+    output_line(out, "    pthread_mutex_init(&queue.lock, 0);");
+    output_line(out, "    pthread_cond_init(&queue.not_empty, 0);");
+    output_line(out, "    pthread_cond_init(&queue.not_full, 0);");
+    output_line(out, "    pthread_t thread;");
+    output_line(out, "    if (pthread_create(&thread, 0, tokenize_into_queue, &queue) != 0) {");
+    output_line(out, "        pthread_cond_destroy(&queue.not_full);");
+    output_line(out, "        pthread_cond_destroy(&queue.not_empty);");
+    output_line(out, "        pthread_mutex_destroy(&queue.lock);");
+    output_line(out, "        return parse_text(parser, text, length, false);");
+    output_line(out, "    }");
+    output_line(out, "    struct owl_token_run *failing_run = 0;");
+    output_line(out, "    struct run_end failing_end = { 0 };");
+    output_line(out, "    uint16_t failing_index = 0;");
+    output_line(out, "    while (true) {");
+    output_line(out, "        pthread_mutex_lock(&queue.lock);");
+    output_line(out, "        while (queue.head == queue.tail && !queue.finished)");
+    output_line(out, "            pthread_cond_wait(&queue.not_empty, &queue.lock);");
+    output_line(out, "        if (queue.head == queue.tail) {");
+    output_line(out, "            pthread_mutex_unlock(&queue.lock);");
+    output_line(out, "            break;");
+    output_line(out, "        }");
+    output_line(out, "        size_t slot = queue.head % OWL_PIPELINE_RUNS;");
+    output_line(out, "        struct owl_token_run *run = queue.runs[slot];");
+    output_line(out, "        struct run_end end = queue.ends[slot];");
+    output_line(out, "        queue.head++;");
+    output_line(out, "        pthread_cond_signal(&queue.not_full);");
+    output_line(out, "        pthread_mutex_unlock(&queue.lock);");
+    output_line(out, "        if (!fill_run_states(run, &parser->cont, &failing_index)) {");
+    output_line(out, "            failing_run = run;");
+    output_line(out, "            failing_end = end;");
+    output_line(out, "            pthread_mutex_lock(&queue.lock);");
+    output_line(out, "            queue.stopped = true;");
+    output_line(out, "            pthread_cond_signal(&queue.not_full);");
+    output_line(out, "            pthread_mutex_unlock(&queue.lock);");
+    output_line(out, "            break;");
+    output_line(out, "        }");
+    output_line(out, "    }");
+    output_line(out, "    pthread_join(thread, 0);");
+    output_line(out, "    pthread_cond_destroy(&queue.not_full);");
+    output_line(out, "    pthread_cond_destroy(&queue.not_empty);");
+    output_line(out, "    pthread_mutex_destroy(&queue.lock);");
+    output_line(out, "    bool ok = true;");
+    output_line(out, "    if (failing_run) {");
+    output_line(out, "        struct owl_default_tokenizer at_run = *tokenizer;");
+    output_line(out, "        at_run.offset = failing_end.offset;");
+    output_line(out, "        at_run.whitespace = failing_end.whitespace;");
+    output_line(out, "        tree->error = ERROR_UNEXPECTED_TOKEN;");
+    output_line(out, "        find_token_range(&at_run, failing_run, failing_index, &tree->error_range.start, &tree->error_range.end);");
+    output_line(out, "        ok = false;");
+    output_line(out, "    } else if (tokenizer->offset < length) {");
+    output_line(out, "        tree->error = ERROR_INVALID_TOKEN;");
+    output_line(out, "        estimate_next_token_range(tokenizer, &tree->error_range.start, &tree->error_range.end);");
+    output_line(out, "        ok = false;");
+    output_line(out, "    }");
+    output_line(out, "    if (parser->validating)");
+    output_line(out, "        discard_tokens(parser);");
+    output_line(out, "    return ok;");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    output_line(out, "static void finish_parsing(struct %%prefix_parser *parser) {");
+    output_line(out, "    struct %%prefix_tree *tree = parser->tree;");
+    output_line(out, "    struct fill_run_state top = parser->cont.stack[parser->cont.top_index];");
+    output_line(out, "    if (tree->error != ERROR_NONE) {");
+    output_line(out, "        recycle_token_runs(parser);");
+    output_line(out, "        return;");
+    output_line(out, "    }");
+    output_line(out, "    switch (top.state) {");
+    for (state_id i = 0; i < gen->deterministic->automaton.number_of_states; ++i) {
+        if (!gen->deterministic->automaton.states[i].accepting)
+            continue;
+        set_unsigned_number_substitution(out, "state-id", i);
+        output_line(out, "    case %%state-id:");
+    }
+    output_line(out, "        break;");
+    output_line(out, "    default:");
+    output_line(out, "        tree->error = ERROR_MORE_INPUT_NEEDED;");
+    output_line(out, "        find_end_range(&parser->tokenizer, &tree->error_range.start, &tree->error_range.end);");
+    output_line(out, "        recycle_token_runs(parser);");
+    output_line(out, "        return;");
+    output_line(out, "    }");
+    /*
+    output_line(out, "    struct owl_token_run *run_to_print = parser->token_run;");
+    output_line(out, "    while (run_to_print) {");
+    output_line(out, "        for (uint32_t i = 0; i < run_to_print->number_of_tokens; ++i) {");
+    output_line(out, "            printf(\"%u -> %u\\n\", run_to_print->tokens[i], run_to_print->states[i]);");
+    output_line(out, "        }");
+    output_line(out, "        printf(\"--\\n\");");
+    output_line(out, "        run_to_print = run_to_print->prev;");
+    output_line(out, "    }");
+     */
+    output_line(out, "    if (parser->validating)");
+    output_line(out, "        return;");
+    if (split_root) {
+        output_line(out, "#ifdef OWL_THREADS");
+        output_line(out, "    if (parser->run_ends)");
+        output_line(out, "        tree->root_offset = build_parse_tree_in_parallel(parser);");
+        output_line(out, "    else");
+        output_line(out, "#endif");
+        output_line(out, "        tree->root_offset = build_parse_tree(parser);");
+    } else
+        output_line(out, "    tree->root_offset = build_parse_tree(parser);");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "    if (tree->rule_index || tree->location_index)");
+    output_line(out, "        finish_indexes(tree);");
+    output_line(out, "#endif");
+    if (relative) {
+        output_line(out, "    if (tree->root_offset && !tree->builder)");
+        output_line(out, "        tree->root_start = take_start(tree, tree->root_offset);");
+        output_line(out, "    if (tree->pending_starts) {");
+        output_line(out, "        free_memory(tree->pending_starts, tree->pending_starts_capacity * sizeof(struct pending_start), &tree->allocator);");
+        output_line(out, "        tree->pending_starts = 0;");
+        output_line(out, "        tree->number_of_pending_starts = 0;");
+        output_line(out, "        tree->pending_starts_capacity = 0;");
+        output_line(out, "    }");
+    }
+    output_line(out, "}");
+    output_line(out, "// Parses a string into `tree`, reusing the parser's memory from earlier parses.");
+    output_line(out, "// If `pipeline` is set, the text is tokenized on another thread (see");
+    output_line(out, "// parse_text_pipelined).");
+    output_line(out, "static void parse_string_reusing(struct %%prefix_parser *parser, struct %%prefix_tree *tree, const char *string, size_t length, bool validate, unsigned threads, bool pipeline) {");
+    output_line(out, "    parser->validating = validate;");
+    output_line(out, "    tree->string = string;");
+    output_line(out, "    start_parsing(parser, tree);");
+    output_line(out, "#ifdef OWL_THREADS");
+    output_line(out, "    if (threads > 1)");
+    output_line(out, "        parse_text_in_parallel(parser, string, length, threads);");
+    output_line(out, "    else if (pipeline)");
+    output_line(out, "        parse_text_pipelined(parser, string, length);");
+    output_line(out, "    else");
+    output_line(out, "        parse_text(parser, string, length, false);");
+    output_line(out, "#else");
+    output_line(out, "    (void)threads;");
+    output_line(out, "    (void)pipeline;");
+    output_line(out, "    parse_text(parser, string, length, false);");
+    output_line(out, "#endif");
+    output_line(out, "    finish_parsing(parser);");
+    output_line(out, "}");
+    output_line(out, "static void parse_string(struct %%prefix_tree *tree, const char *string, size_t length, bool validate, unsigned threads, bool pipeline) {");
+    output_line(out, "    struct %%prefix_parser parser = { .allocator = tree->allocator };");
+    output_line(out, "    parse_string_reusing(&parser, tree, string, length, validate, threads, pipeline);");
+    output_line(out, "    free_parser_memory(&parser);");
+    output_line(out, "}");
+    output_line(out, "static struct %%prefix_tree *%%prefix_tree_create_with_error(enum %%prefix_error e) {");
+    output_line(out, "    struct %%prefix_tree *tree = %%prefix_tree_create_empty((struct owl_allocator){ 0 });");
+    output_line(out, "    tree->error = e;");
+    output_line(out, "    return tree;");
+    output_line(out, "}");
+    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_from_string(const char *string) {");
+    output_line(out, "    return %%prefix_tree_create_with_options((struct %%prefix_tree_options){ .string = string });");
+    output_line(out, "}");
+    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_from_file(FILE *file) {");
+    output_line(out, "    if (!file)");
+    output_line(out, "        return %%prefix_tree_create_with_error(ERROR_INVALID_FILE);");
+    output_line(out, "    return %%prefix_tree_create_with_options((struct %%prefix_tree_options){ .file = file });");
+    output_line(out, "}");
+    output_line(out, "#ifdef OWL_MMAP");
+    output_line(out, "// Reads the rest of `fd` into a new buffer.  For regular files, `size` is the");
+    output_line(out, "// size of the file and the buffer is allocated once, at exactly that size.");
+    output_line(out, "static char *read_file_descriptor(int fd, size_t size, size_t *length, size_t *capacity_out, struct owl_allocator *allocator) {");
+    output_line(out, "    size_t capacity = size ? size : 65536;");
+    output_line(out, "    char *buffer = allocate_memory(capacity, allocator);");
+    output_line(out, "    size_t offset = 0;");
+    output_line(out, "    while (buffer) {");
+    output_line(out, "        if (offset == capacity) {");
+    output_line(out, "            if (size)");
+    output_line(out, "                break;");
+    output_line(out, "            char *b = reallocate_memory(buffer, capacity, capacity * 2, allocator);");
+    output_line(out, "            if (!b)");
+    output_line(out, "                free_memory(buffer, capacity, allocator);");
+    output_line(out, "            buffer = b;");
+    output_line(out, "            capacity *= 2;");
+    output_line(out, "            continue;");
+    output_line(out, "        }");
+    output_line(out, "        ssize_t n = read(fd, buffer + offset, capacity - offset);");
+    output_line(out, "        if (n < 0 && errno == EINTR)");
+    output_line(out, "            continue;");
+    output_line(out, "        if (n < 0) {");
+    output_line(out, "            free_memory(buffer, capacity, allocator);");
+    output_line(out, "            return 0;");
+    output_line(out, "        }");
+    output_line(out, "        if (n == 0)");
+    output_line(out, "            break;");
+    output_line(out, "        offset += (size_t)n;");
+    output_line(out, "    }");
+    output_line(out, "    *length = offset;");
+    output_line(out, "    *capacity_out = capacity;");
+    output_line(out, "    return buffer;");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    output_line(out, "static bool allocator_options_are_valid(struct %%prefix_tree_options options) {");
+    output_line(out, "    return !options.allocate == !options.reallocate && !options.allocate == !options.deallocate;");
+    output_line(out, "}");
+    output_line(out, "static struct owl_allocator allocator_from_options(struct %%prefix_tree_options options) {");
+    output_line(out, "    return (struct owl_allocator){");
+    output_line(out, "        .allocate = options.allocate,");
+    output_line(out, "        .reallocate = options.reallocate,");
+    output_line(out, "        .deallocate = options.deallocate,");
+    output_line(out, "        .info = options.allocator_info,");
+    output_line(out, "    };");
+    output_line(out, "}");
+    output_line(out, "// Sets up `tree` for the options, then parses `length` bytes of `string` into");
+    output_line(out, "// it.  The arguments are the same as for create_tree.");
+    output_line(out, "static void parse_into_tree(struct %%prefix_tree *tree, struct %%prefix_tree_options options, const char *string, size_t length, bool validate, const struct %%prefix_builder *builder, struct %%prefix_parser *parser) {");
+    if (has_custom_tokens) {
+        output_line(out, "    tree->custom_tokenize = options.tokenize;");
+        output_line(out, "    tree->custom_tokenize_info = options.tokenize_info;");
+    }
+    output_line(out, "    tree->builder = builder;");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "    if (options.index_rules && !validate && !builder)");
+    output_line(out, "        tree->rule_index = create_rule_index(&tree->allocator);");
+    output_line(out, "    if (options.index_locations && !validate && !builder)");
+    output_line(out, "        tree->location_index = create_location_index(&tree->allocator);");
+    output_line(out, "#endif");
+    output_line(out, "    if (parser)");
+    output_line(out, "        parse_string_reusing(parser, tree, string, length, validate, options.threads, options.pipeline);");
+    output_line(out, "    else");
+    output_line(out, "        parse_string(tree, string, length, validate, options.threads, options.pipeline);");
+    output_line(out, "}");
+    output_line(out, "// Creates a tree from the options.  If `validate` is set, the tree isn't built;");
+    output_line(out, "// if `builder` is set, it's used to build nodes instead.  If `parser` is set,");
+    output_line(out, "// its memory is reused; it must use the same allocator as the options.");
+    output_line(out, "static struct %%prefix_tree *create_tree(struct %%prefix_tree_options options, bool validate, const struct %%prefix_builder *builder, struct %%prefix_parser *parser) {");
+    output_line(out, "    if (!options.file == !options.string || !allocator_options_are_valid(options))");
+    output_line(out, "        return %%prefix_tree_create_with_error(ERROR_INVALID_OPTIONS);");
+    output_line(out, "    struct owl_allocator allocator = allocator_from_options(options);");
+    output_line(out, "    size_t len = 32;");
+    output_line(out, "    if (options.file) {");
+    output_line(out, "        char *str = 0;");
+    output_line(out, "        size_t off = 0;");
+    output_line(out, "        while (true) {");
+    output_line(out, "            size_t old_len = str ? len : 0;");
+    output_line(out, "            len = len * 3 / 2;");
+    output_line(out, "            char *s = reallocate_memory(str, old_len, len, &allocator);");
+    output_line(out, "            if (!s) {");
+    output_line(out, "                free_memory(str, old_len, &allocator);");
+    output_line(out, "                return 0;");
+    output_line(out, "            }");
+    output_line(out, "            str = s;");
+    output_line(out, "            off += fread(str + off, 1, len - off, options.file);");
+    output_line(out, "            if (off < len) {");
+    output_line(out, "                str[off] = '\\0';");
+    output_line(out, "                break;");
+    output_line(out, "            }");
+    output_line(out, "        }");
+    output_line(out, "        options.string = str;");
+    output_line(out, "        options.length = off;");
+    output_line(out, "    } else if (!options.length && !options.has_length)");
+    output_line(out, "        options.length = strlen(options.string);");
+    output_line(out, "    struct %%prefix_tree *tree = %%prefix_tree_create_empty(allocator);");
+    output_line(out, "    if (options.file)");
+    output_line(out, "        tree->owned_string_size = len;");
+    output_line(out, "    parse_into_tree(tree, options, options.string, options.length, validate, builder, parser);");
+    output_line(out, "    return tree;");
+    output_line(out, "}");
+    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_with_options(struct %%prefix_tree_options options) {");
+    output_line(out, "    return create_tree(options, false, 0, 0);");
+    output_line(out, "}");
+    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_from_path(const char *path) {");
+    output_line(out, "    return %%prefix_tree_create_from_path_with_options(path, (struct %%prefix_tree_options){ 0 });");
+    output_line(out, "}");
+    output_line(out, "struct %%prefix_tree *%%prefix_tree_create_from_path_with_options(const char *path, struct %%prefix_tree_options options) {");
+    output_line(out, "    if (!path)");
+    output_line(out, "        return %%prefix_tree_create_with_error(ERROR_INVALID_FILE);");
+    output_line(out, "    if (options.file || options.string || !allocator_options_are_valid(options))");
+    output_line(out, "        return %%prefix_tree_create_with_error(ERROR_INVALID_OPTIONS);");
+    output_line(out, "#ifdef OWL_MMAP");
+    output_line(out, "    int fd = open(path, O_RDONLY);");
+    output_line(out, "    if (fd < 0)");
+    output_line(out, "        return %%prefix_tree_create_with_error(ERROR_INVALID_FILE);");
+    output_line(out, "    struct stat st;");
+    output_line(out, "    if (fstat(fd, &st) != 0) {");
+    output_line(out, "        close(fd);");
+    output_line(out, "        return %%prefix_tree_create_with_error(ERROR_INVALID_FILE);");
+    output_line(out, "    }");
+    output_line(out, "    struct %%prefix_tree *tree = %%prefix_tree_create_empty(allocator_from_options(options));");
+    output_line(out, "    size_t length = 0;");
+    output_line(out, "    if (S_ISREG(st.st_mode) && st.st_size > 0 && (uintmax_t)st.st_size <= SIZE_MAX) {");
+    output_line(out, "        length = (size_t)st.st_size;");
+    output_line(out, "        void *map = mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);");
+    output_line(out, "        if (map != MAP_FAILED) {");
+    output_line(out, "#if defined(MADV_SEQUENTIAL)");
+    output_line(out, "            madvise(map, length, MADV_SEQUENTIAL);");
+    output_line(out, "#elif defined(POSIX_MADV_SEQUENTIAL)");
+    output_line(out, "            posix_madvise(map, length, POSIX_MADV_SEQUENTIAL);");
+    output_line(out, "#endif");
+    output_line(out, "            tree->mapped_length = length;");
+    output_line(out, "            tree->string = map;");
+    output_line(out, "        }");
+    output_line(out, "    }");
+    output_line(out, "    if (!tree->mapped_length) {");
+    output_line(out, "        // Pipes and other special files can't be mapped.");
+    output_line(out, "        size_t capacity = 0;");
+    output_line(out, "        char *string = read_file_descriptor(fd, length, &length, &capacity, &tree->allocator);");
+    output_line(out, "        if (!string) {");
+    output_line(out, "            close(fd);");
+    output_line(out, "            %%prefix_tree_destroy(tree);");
+    output_line(out, "            return %%prefix_tree_create_with_error(ERROR_INVALID_FILE);");
+    output_line(out, "        }");
+    output_line(out, "        tree->string = string;");
+    output_line(out, "        tree->owned_string_size = capacity;");
+    output_line(out, "    }");
+    output_line(out, "    close(fd);");
+    output_line(out, "    parse_into_tree(tree, options, tree->string, length, false, 0, 0);");
+    output_line(out, "    return tree;");
+    output_line(out, "#else");
+    output_line(out, "    FILE *file = fopen(path, \"rb\");");
+    output_line(out, "    if (!file)");
+    output_line(out, "        return %%prefix_tree_create_with_error(ERROR_INVALID_FILE);");
+    output_line(out, "    options.file = file;");
+    output_line(out, "    struct %%prefix_tree *tree = %%prefix_tree_create_with_options(options);");
+    output_line(out, "    fclose(file);");
+    output_line(out, "    return tree;");
+    output_line(out, "#endif");
+    output_line(out, "}");
+    output_line(out, "enum %%prefix_error %%prefix_validate(const char *string, size_t length, struct source_range *error_range) {");
+    output_line(out, "    return %%prefix_validate_with_options((struct %%prefix_tree_options){ .string = string, .length = length, .has_length = true }, error_range);");
+    output_line(out, "}");
+    output_line(out, "enum %%prefix_error %%prefix_validate_with_options(struct %%prefix_tree_options options, struct source_range *error_range) {");
+    output_line(out, "    struct %%prefix_tree *tree = create_tree(options, true, 0, 0);");
+    output_line(out, "    if (!tree)");
+    output_line(out, "        return ERROR_INVALID_FILE;");
+    output_line(out, "    enum %%prefix_error error = %%prefix_tree_get_error(tree, error_range);");
+    output_line(out, "    %%prefix_tree_destroy(tree);");
+    output_line(out, "    return error;");
+    output_line(out, "}");
+    output_line(out, "#ifdef OWL_BUILDER");
+    output_line(out, "enum %%prefix_error %%prefix_build(const char *string, size_t length, struct %%prefix_builder builder, void **root, struct source_range *error_range) {");
+    output_line(out, "    return %%prefix_build_with_options((struct %%prefix_tree_options){ .string = string, .length = length, .has_length = true }, builder, root, error_range);");
+    output_line(out, "}");
+    output_line(out, "enum %%prefix_error %%prefix_build_with_options(struct %%prefix_tree_options options, struct %%prefix_builder builder, void **root, struct source_range *error_range) {");
+    output_line(out, "    if (root)");
+    output_line(out, "        *root = 0;");
+    output_line(out, "    if (!builder.build)");
+    output_line(out, "        return ERROR_INVALID_OPTIONS;");
+    output_line(out, "    struct %%prefix_tree *tree = create_tree(options, false, &builder, 0);");
+    output_line(out, "    if (!tree)");
+    output_line(out, "        return ERROR_INVALID_FILE;");
+    output_line(out, "    enum %%prefix_error error = %%prefix_tree_get_error(tree, error_range);");
+    output_line(out, "    if (error == ERROR_NONE && root)");
+    output_line(out, "        *root = (void *)(uintptr_t)tree->root_offset;");
+    output_line(out, "    %%prefix_tree_destroy(tree);");
+    output_line(out, "    return error;");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    output_line(out, "#ifdef OWL_BATCH");
+    output_line(out, "// Parses inputs[index] into out[index].");
+    output_line(out, "static void parse_batch_input(struct %%prefix_tree_options options, const char **inputs, const size_t *lengths, struct %%prefix_tree **out, size_t index, struct %%prefix_parser *parser) {");
+    output_line(out, "    options.string = inputs[index];");
+    output_line(out, "    options.length = lengths ? lengths[index] : 0;");
+    output_line(out, "    options.has_length = lengths != 0;");
+    output_line(out, "    options.threads = 1;");
+    output_line(out, "    out[index] = create_tree(options, false, 0, parser);");
+    output_line(out, "}");
+    output_line(out, "#ifdef OWL_THREADS");
+    output_line(out, "// Each worker parses the inputs from `next` up to `end`.  Once it runs out, it");
+    output_line(out, "// steals the second half of another worker's remaining inputs.");
+    output_line(out, "struct batch_worker {");
+    output_line(out, "    struct batch *batch;");
+    output_line(out, "    size_t index;");
+    output_line(out, "    pthread_mutex_t lock;");
+    output_line(out, "    size_t next;");
+    output_line(out, "    size_t end;");
+    output_line(out, "    pthread_t thread;");
+    output_line(out, "    bool started;");
+    output_line(out, "};");
+    output_line(out, "struct batch {");
+    output_line(out, "    struct %%prefix_tree_options options;");
+    output_line(out, "    const char **inputs;");
+    output_line(out, "    const size_t *lengths;");
+    output_line(out, "    struct %%prefix_tree **out;");
+    output_line(out, "    struct batch_worker *workers;");
+    output_line(out, "    size_t number_of_workers;");
+    output_line(out, "};");
+    output_line(out, "// Finds the next input for a worker to parse, stealing if its own are gone.");
+    output_line(out, "static bool take_batch_input(struct batch_worker *worker, size_t *index) {");
+    output_line(out, "    pthread_mutex_lock(&worker->lock);");
+    output_line(out, "    bool found = worker->next < worker->end;");
+    output_line(out, "    if (found)");
+    output_line(out, "        *index = worker->next++;");
+    output_line(out, "    pthread_mutex_unlock(&worker->lock);");
+    output_line(out, "    if (found)");
+    output_line(out, "        return true;");
+    output_line(out, "    struct batch *batch = worker->batch;");
+    output_line(out, "    for (size_t i = 1; i < batch->number_of_workers; ++i) {");
+    output_line(out, "        struct batch_worker *victim = &batch->workers[(worker->index + i) % batch->number_of_workers];");
+    output_line(out, "        pthread_mutex_lock(&victim->lock);");
+    output_line(out, "        size_t end = victim->end;");
+    output_line(out, "        size_t start = end - (end - victim->next) / 2;");
+    output_line(out, "        if (start == end && victim->next < end)");
+    output_line(out, "            start--;");
+    output_line(out, "        victim->end = start;");
+    output_line(out, "        pthread_mutex_unlock(&victim->lock);");
+    output_line(out, "        if (start == end)");
+    output_line(out, "            continue;");
+    output_line(out, "        pthread_mutex_lock(&worker->lock);");
+    output_line(out, "        worker->next = start + 1;");
+    output_line(out, "        worker->end = end;");
+    output_line(out, "        pthread_mutex_unlock(&worker->lock);");
+    output_line(out, "        *index = start;");
+    output_line(out, "        return true;");
+    output_line(out, "    }");
+    output_line(out, "    return false;");
+    output_line(out, "}");
+    output_line(out, "static void *run_batch_worker(void *data) {");
+    output_line(out, "    struct batch_worker *worker = data;");
+    output_line(out, "    struct batch *batch = worker->batch;");
+    output_line(out, "    // Each worker has a parser of its own, which keeps its memory from one input");
+    output_line(out, "    // to the next.");
+    output_line(out, "    struct %%prefix_parser parser = { .allocator = allocator_from_options(batch->options) };");
+    output_line(out, "    size_t index;");
+    output_line(out, "    while (take_batch_input(worker, &index))");
+    output_line(out, "        parse_batch_input(batch->options, batch->inputs, batch->lengths, batch->out, index, &parser);");
+    output_line(out, "    free_parser_memory(&parser);");
+    output_line(out, "    return 0;");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    output_line(out, "void %%prefix_parse_batch(const char **inputs, const size_t *lengths, size_t n, struct %%prefix_tree **out, int threads) {");
+    output_line(out, "    %%prefix_parse_batch_with_options((struct %%prefix_tree_options){ .threads = threads > 0 ? (unsigned)threads : 1 }, inputs, lengths, n, out);");
+    output_line(out, "}");
+    output_line(out, "void %%prefix_parse_batch_with_options(struct %%prefix_tree_options options, const char **inputs, const size_t *lengths, size_t n, struct %%prefix_tree **out) {");
+    output_line(out, "    if (options.file || options.string || !allocator_options_are_valid(options)) {");
+    output_line(out, "        for (size_t i = 0; i < n; ++i)");
+    output_line(out, "            out[i] = %%prefix_tree_create_with_error(ERROR_INVALID_OPTIONS);");
+    output_line(out, "        return;");
+    output_line(out, "    }");
+    output_line(out, "#ifdef OWL_THREADS");
+    output_line(out, "    size_t number_of_workers = options.threads < n ? options.threads : n;");
+    output_line(out, "    if (number_of_workers > 1) {");
+    output_line(out, "        struct owl_allocator allocator = allocator_from_options(options);");
+    output_line(out, "        struct batch_worker *workers = allocate_memory(number_of_workers * sizeof(struct batch_worker), &allocator);");
+    output_line(out, "        if (!workers)");
+    output_line(out, "            abort();");
+    output_line(out, "        struct batch batch = {");
+    output_line(out, "            .options = options,");
+    output_line(out, "            .inputs = inputs,");
+    output_line(out, "            .lengths = lengths,");
+    output_line(out, "            .out = out,");
+    output_line(out, "            .workers = workers,");
+    output_line(out, "            .number_of_workers = number_of_workers,");
+    output_line(out, "        };");
+    output_line(out, "        for (size_t i = 0; i < number_of_workers; ++i) {");
+    output_line(out, "            workers[i] = (struct batch_worker){");
+    output_line(out, "                .batch = &batch,");
+    output_line(out, "                .index = i,");
+    output_line(out, "                .next = n * i / number_of_workers,");
+    output_line(out, "                .end = n * (i + 1) / number_of_workers,");
+    output_line(out, "            };");
+    output_line(out, "            pthread_mutex_init(&workers[i].lock, 0);");
+    output_line(out, "        }");
+    output_line(out, "        // The calling thread is the first worker.");
+    output_line(out, "        for (size_t i = 1; i < number_of_workers; ++i)");
+    output_line(out, "            workers[i].started = pthread_create(&workers[i].thread, 0, run_batch_worker, &workers[i]) == 0;");
+    output_line(out, "        run_batch_worker(&workers[0]);");
+    output_line(out, "        for (size_t i = 1; i < number_of_workers; ++i) {");
+    output_line(out, "            if (workers[i].started)");
+    output_line(out, "                pthread_join(workers[i].thread, 0);");
+    output_line(out, "        }");
+    output_line(out, "        for (size_t i = 0; i < number_of_workers; ++i)");
+    output_line(out, "            pthread_mutex_destroy(&workers[i].lock);");
+    output_line(out, "        free_memory(workers, number_of_workers * sizeof(struct batch_worker), &allocator);");
+    output_line(out, "        return;");
+    output_line(out, "    }");
+    output_line(out, "#endif");
+    output_line(out, "    struct %%prefix_parser parser = { .allocator = allocator_from_options(options) };");
+    output_line(out, "    for (size_t i = 0; i < n; ++i)");
+    output_line(out, "        parse_batch_input(options, inputs, lengths, out, i, &parser);");
+    output_line(out, "    free_parser_memory(&parser);");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    output_line(out, "#ifdef OWL_PARSER_API");
+    output_line(out, "struct %%prefix_parser *%%prefix_parser_create(void) {");
+    output_line(out, "    return %%prefix_parser_create_with_options((struct %%prefix_tree_options){ 0 });");
+    output_line(out, "}");
+    output_line(out, "struct %%prefix_parser *%%prefix_parser_create_with_options(struct %%prefix_tree_options options) {");
+    output_line(out, "    bool valid = allocator_options_are_valid(options);");
+    output_line(out, "    struct owl_allocator allocator = { 0 };");
+    output_line(out, "    if (valid)");
+    output_line(out, "        allocator = allocator_from_options(options);");
+    output_line(out, "    struct %%prefix_parser *parser = allocate_memory(sizeof(struct %%prefix_parser), &allocator);");
+    output_line(out, "    if (!parser)");
+    output_line(out, "        return 0;");
+    output_line(out, "    *parser = (struct %%prefix_parser){ .allocator = allocator };");
+    output_line(out, "    parser->capacity = FEED_BATCH_SIZE;");
+    output_line(out, "    parser->buffer = allocate_memory(parser->capacity, &allocator);");
+    output_line(out, "    if (!parser->buffer) {");
+    output_line(out, "        free_memory(parser, sizeof(struct %%prefix_parser), &allocator);");
+    output_line(out, "        return 0;");
+    output_line(out, "    }");
+    output_line(out, "    parser->buffer[0] = '\\0';");
+    output_line(out, "    parser->resume_length = FEED_BATCH_SIZE;");
+    output_line(out, "    struct %%prefix_tree *tree = %%prefix_tree_create_empty(allocator);");
+    output_line(out, "    if (options.file || options.string || !valid)");
+    output_line(out, "        tree->error = ERROR_INVALID_OPTIONS;");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "    if (options.index_rules)");
+    output_line(out, "        tree->rule_index = create_rule_index(&tree->allocator);");
+    output_line(out, "    if (options.index_locations)");
+    output_line(out, "        tree->location_index = create_location_index(&tree->allocator);");
+    output_line(out, "#endif");
+    if (has_custom_tokens) {
+        output_line(out, "    tree->custom_tokenize = options.tokenize;");
+        output_line(out, "    tree->custom_tokenize_info = options.tokenize_info;");
+    }
+    output_line(out, "    start_parsing(parser, tree);");
+    output_line(out, "    return parser;");
+    output_line(out, "}");
+    output_line(out, "bool %%prefix_parser_feed(struct %%prefix_parser *parser, const char *chunk, size_t length) {");
+    output_line(out, "    if (parser->finished || parser->tree->error != ERROR_NONE)");
+    output_line(out, "        return false;");
+    output_line(out, "    if (length >= parser->capacity - parser->length) {");
+    output_line(out, "        size_t capacity = parser->capacity;");
+    output_line(out, "        while (length >= capacity - parser->length) {");
+    output_line(out, "            if (capacity > SIZE_MAX / 2)");
+    output_line(out, "                abort();");
+    output_line(out, "            capacity *= 2;");
+    output_line(out, "        }");
+    output_line(out, "        char *buffer = reallocate_memory(parser->buffer, parser->capacity, capacity, &parser->allocator);");
+    output_line(out, "        if (!buffer)");
+    output_line(out, "            abort();");
+    output_line(out, "        parser->buffer = buffer;");
+    output_line(out, "        parser->capacity = capacity;");
+    output_line(out, "    }");
+    output_line(out, "    memcpy(parser->buffer + parser->length, chunk, length);");
+    output_line(out, "    parser->length += length;");
+    output_line(out, "    parser->buffer[parser->length] = '\\0';");
+    output_line(out, "    if (parser->length < parser->resume_length)");
+    output_line(out, "        return true;");
+    output_line(out, "    if (!parse_text(parser, parser->buffer, parser->length, true))");
+    output_line(out, "        return false;");
+    output_line(out, "    // If a long token is still incomplete, wait for the pending input to double");
+    output_line(out, "    // before scanning it again.");
+    output_line(out, "    size_t pending = parser->length - parser->tokenizer.offset;");
+    output_line(out, "    parser->resume_length = parser->length + (pending > FEED_BATCH_SIZE ? pending : FEED_BATCH_SIZE);");
+    output_line(out, "    return true;");
+    output_line(out, "}");
+    output_line(out, "struct %%prefix_tree *%%prefix_parser_finish(struct %%prefix_parser *parser) {");
+    output_line(out, "    struct %%prefix_tree *tree = parser->tree;");
+    output_line(out, "    if (parser->finished)");
+    output_line(out, "        free_memory(parser->buffer, parser->capacity, &parser->allocator);");
+    output_line(out, "    else {");
+    output_line(out, "        tree->string = parser->buffer;");
+    output_line(out, "        tree->owned_string_size = parser->capacity;");
+    output_line(out, "        if (tree->error == ERROR_NONE)");
+    output_line(out, "            parse_text(parser, parser->buffer, parser->length, false);");
+    output_line(out, "        finish_parsing(parser);");
+    output_line(out, "    }");
+    output_line(out, "    free_parser_memory(parser);");
+    output_line(out, "    free_memory(parser, sizeof(struct %%prefix_parser), &parser->allocator);");
+    output_line(out, "    return tree;");
+    output_line(out, "}");
+    output_line(out, "void %%prefix_parser_reset(struct %%prefix_parser *parser) {");
+    output_line(out, "    recycle_token_runs(parser);");
+    output_line(out, "    struct %%prefix_tree *tree = parser->tree;");
+    output_line(out, "    *tree = (struct %%prefix_tree){");
+    output_line(out, "        .allocator = tree->allocator,");
+    output_line(out, "        .parse_tree = tree->parse_tree,");
+    output_line(out, "        .parse_tree_size = tree->parse_tree_size,");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "        .rule_index = tree->rule_index,");
+    output_line(out, "        .location_index = tree->location_index,");
+    output_line(out, "#endif");
+    output_line(out, "        // Invalid options stay invalid.");
+    output_line(out, "        .error = tree->error == ERROR_INVALID_OPTIONS ? ERROR_INVALID_OPTIONS : ERROR_NONE,");
+    if (has_custom_tokens) {
+        output_line(out, "        .custom_tokenize = tree->custom_tokenize,");
+        output_line(out, "        .custom_tokenize_info = tree->custom_tokenize_info,");
+    }
+    output_line(out, "    };");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "    clear_indexes(tree);");
+    output_line(out, "#endif");
+    output_line(out, "    parser->finished = false;");
+    output_line(out, "    parser->length = 0;");
+    output_line(out, "    parser->buffer[0] = '\\0';");
+    output_line(out, "    parser->resume_length = FEED_BATCH_SIZE;");
+    output_line(out, "    start_parsing(parser, tree);");
+    output_line(out, "}");
+    output_line(out, "struct %%prefix_tree *%%prefix_parser_parse(struct %%prefix_parser *parser, const char *string) {");
+    output_line(out, "    %%prefix_parser_reset(parser);");
+    output_line(out, "    struct %%prefix_tree *tree = parser->tree;");
+    output_line(out, "    parser->finished = true;");
+    output_line(out, "    if (tree->error != ERROR_NONE)");
+    output_line(out, "        return tree;");
+    output_line(out, "    tree->string = string;");
+    output_line(out, "    parse_text(parser, string, strlen(string), false);");
+    output_line(out, "    finish_parsing(parser);");
+    output_line(out, "    return tree;");
+    output_line(out, "}");
+    output_line(out, "void %%prefix_parser_destroy(struct %%prefix_parser *parser) {");
+    output_line(out, "    if (!parser)");
+    output_line(out, "        return;");
+    output_line(out, "    free_parser_memory(parser);");
+    output_line(out, "    %%prefix_tree_destroy(parser->tree);");
+    output_line(out, "    struct owl_allocator allocator = parser->allocator;");
+    output_line(out, "    free_memory(parser->buffer, parser->capacity, &allocator);");
+    output_line(out, "    free_memory(parser, sizeof(struct %%prefix_parser), &allocator);");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    output_line(out, "enum %%prefix_error %%prefix_tree_get_error(struct %%prefix_tree *tree, struct source_range *error_range) {");
+    output_line(out, "    if (error_range)");
+    output_line(out, "        *error_range = tree->error_range;");
+    output_line(out, "    return tree->error;");
+    output_line(out, "}");
+    output_line(out, "void %%prefix_tree_destroy(struct %%prefix_tree *tree) {");
+    output_line(out, "    if (!tree)");
+    output_line(out, "        return;");
+    output_line(out, "    if (tree->owned_string_size)");
+    output_line(out, "        free_memory((void *)tree->string, tree->owned_string_size, &tree->allocator);");
+    output_line(out, "#ifdef OWL_MMAP");
+    output_line(out, "    if (tree->mapped_length)");
+    output_line(out, "        munmap((void *)tree->string, tree->mapped_length);");
+    output_line(out, "#endif");
+    output_line(out, "    struct owl_allocator allocator = tree->allocator;");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "    if (tree->rule_index) {");
+    output_line(out, "        for (size_t i = 0; i < %%number-of-match-lists; ++i)");
+    output_line(out, "            free_match_list(&tree->rule_index->lists[i], &allocator);");
+    output_line(out, "        free_memory(tree->rule_index, sizeof(struct rule_index), &allocator);");
+    output_line(out, "    }");
+    output_line(out, "    if (tree->location_index) {");
+    output_line(out, "        struct location_index *index = tree->location_index;");
+    output_line(out, "        free_match_list(&index->nodes, &allocator);");
+    output_line(out, "        free_memory(index->furthest_ends, index->furthest_ends_capacity * sizeof(size_t), &allocator);");
+    output_line(out, "        free_memory(index, sizeof(struct location_index), &allocator);");
+    output_line(out, "    }");
+    output_line(out, "#endif");
+    output_line(out, "    free_memory(tree->parse_tree, tree->parse_tree_size, &allocator);");
+    output_line(out, "    free_memory(tree, sizeof(struct %%prefix_tree), &allocator);");
+    output_line(out, "}");
+    output_line(out, "#ifdef OWL_COMPACT");
+    generate_tree_compaction(gen, out);
+    output_line(out, "#endif");
+    generate_action_table(gen, out);
+    output_line(out, "static size_t read_whitespace(const char *text, size_t length, void *info) {");
+    if (has_single_byte_whitespace(gen->grammar)) {
+        // Every whitespace token is a single byte, so any run of whitespace
+        // bytes can be skipped at once.
+        bool seen[256] = {0};
+        output_line(out, "    switch (text[0]) {");
+        for (uint32_t i = 0; i < gen->grammar->number_of_whitespace_tokens; ++i) {
+            unsigned char c = gen->grammar->whitespace_tokens[i].string[0];
+            if (seen[c])
+                continue;
+            seen[c] = true;
+            set_unsigned_number_substitution(out, "character", c);
+            output_line(out, "    case %%character:");
+        }
+        output_line(out, "#ifdef OWL_SIMD");
+        output_line(out, "        return vector_scan(text, 1, length, VECTOR_SCAN_WHITESPACE, 0);");
+        output_line(out, "#else");
+        output_line(out, "        return 1;");
+        output_line(out, "#endif");
+        output_line(out, "    default:");
+        output_line(out, "        return 0;");
+        output_line(out, "    }");
+        output_line(out, "}");
+    } else {
+        struct generated_token *tokens = malloc(sizeof(struct generated_token)
+         * gen->grammar->number_of_whitespace_tokens);
+        if (!tokens) {
+            fputs("critical error: out of memory\n", stderr);
+            exit(-1);
+        }
+        for (uint32_t i = 0; i < gen->grammar->number_of_whitespace_tokens; ++i)
+            tokens[i].token = gen->grammar->whitespace_tokens[i];
+        generate_keyword_reader(tokens,
+         gen->grammar->number_of_whitespace_tokens, out);
+        free(tokens);
+        output_line(out, "}");
+    }
+    output_line(out, "static size_t read_keyword_token(%%token-type *token, bool *end_token, const char *text, size_t length, void *info) {");
+    uint32_t number_of_tokens = gen->combined->number_of_keyword_tokens +
+     gen->grammar->number_of_comment_tokens;
+    struct generated_token *tokens = malloc(sizeof(struct generated_token) * (size_t)number_of_tokens);
+    if (!tokens) {
+        fputs("critical error: out of memory\n", stderr);
+        exit(-1);
+    }
+    uint32_t i = 0;
+    for (; i < gen->combined->number_of_keyword_tokens; ++i) {
+        tokens[i].token = gen->combined->tokens[i];
+        tokens[i].token.symbol = token_class(gen, i);
+    }
+    for (uint32_t j = 0; j < gen->grammar->number_of_comment_tokens; ++j)
+        tokens[i + j].token = gen->grammar->comment_tokens[j];
+    qsort(tokens, number_of_tokens, sizeof(struct generated_token),
+     compare_tokens);
+    uint32_t number_of_hashed_tokens = 0;
+    if (gen->hash_keywords && has_identifier_token) {
+        // Keywords which look like identifiers are matched by hashing the
+        // identifier after it's been scanned.  Move them to the end of the
+        // array so the trie only handles the remaining keywords.
+        bool allow_dashes = SHOULD_ALLOW_DASHES_IN_IDENTIFIERS(gen->combined);
+        struct generated_token *hashed = malloc(sizeof(struct generated_token)
+         * (size_t)number_of_tokens);
+        if (!hashed) {
+            fputs("critical error: out of memory\n", stderr);
+            exit(-1);
+        }
+        uint32_t number_of_trie_tokens = 0;
+        for (uint32_t j = 0; j < number_of_tokens; ++j) {
+            struct token token = tokens[j].token;
+            // Duplicate strings are left to the trie, which already knows how
+            // to choose between them.
+            bool duplicate = (j > 0 && compare_tokens(&tokens[j - 1],
+             &tokens[j]) == 0) || (j + 1 < number_of_tokens &&
+             compare_tokens(&tokens[j], &tokens[j + 1]) == 0);
+            if (token.type != TOKEN_START_LINE_COMMENT && !duplicate &&
+             keyword_is_identifier_shaped(token, allow_dashes))
+                hashed[number_of_hashed_tokens++] = tokens[j];
+            else
+                tokens[number_of_trie_tokens++] = tokens[j];
+        }
+        memcpy(tokens + number_of_trie_tokens, hashed,
+         sizeof(struct generated_token) * number_of_hashed_tokens);
+        free(hashed);
+    }
+    generate_keyword_reader(tokens, number_of_tokens - number_of_hashed_tokens,
+     out);
+    output_line(out, "}");
+    if (gen->hash_keywords && has_identifier_token) {
+        generate_keyword_hash(tokens + number_of_tokens -
+         number_of_hashed_tokens, number_of_hashed_tokens, out);
+    }
+    free(tokens);
+    output_line(out, "static uint32_t rule_lookup(uint32_t parent, uint32_t slot, void *context) {");
+    output_line(out, "    switch (parent) {");
+    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
+        struct rule *rule = gen->grammar->rules[i];
+        if (rule->number_of_slots == 0)
+            continue;
+        set_unsigned_number_substitution(out, "rule-index", i);
+        output_line(out, "    case %%rule-index:");
+        output_line(out, "        switch (slot) {");
+        for (uint32_t j = 0; j < rule->number_of_slots; ++j) {
+            set_unsigned_number_substitution(out, "slot-index", j);
+            set_unsigned_number_substitution(out, "slot-rule-index",
+             rule->slots[j].rule_index);
+            output_line(out, "        case %%slot-index: return %%slot-rule-index;");
+        }
         output_line(out, "        default: break;");
         output_line(out, "        }");
         output_line(out, "        break;");
     }
-    output_line(out, "    default: break;");
+    output_line(out, "    default: break;");
+    output_line(out, "    }");
+    output_line(out, "    return UINT32_MAX;");
+    output_line(out, "}");
+    output_line(out, "static void fixity_associativity_precedence_lookup(int *fixity_associativity, int *precedence, uint32_t rule, uint32_t choice, void *context) {");
+    output_line(out, "    switch (rule) {");
+    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
+        struct rule *rule = gen->grammar->rules[i];
+        if (rule->first_operator_choice == rule->number_of_choices)
+            continue;
+        set_unsigned_number_substitution(out, "rule-index", i);
+        output_line(out, "    case %%rule-index:");
+        output_line(out, "        switch (choice) {");
+        for (uint32_t j = rule->first_operator_choice;
+         j < rule->number_of_choices; ++j) {
+            struct choice op = rule->choices[j];
+            set_unsigned_number_substitution(out, "choice-index", j);
+            set_signed_number_substitution(out, "operator-precedence",
+             op.precedence);
+            output_line(out, "        case %%choice-index:");
+            output_line(out, "            *precedence = %%operator-precedence;");
+            if (op.fixity == PREFIX)
+                output_line(out, "            *fixity_associativity = CONSTRUCT_PREFIX;");
+            else if (op.fixity == POSTFIX)
+                output_line(out, "            *fixity_associativity = CONSTRUCT_POSTFIX;");
+            else if (op.associativity == RIGHT)
+                output_line(out, "            *fixity_associativity = CONSTRUCT_INFIX_RIGHT;");
+            else if (op.associativity == FLAT)
+                output_line(out, "            *fixity_associativity = CONSTRUCT_INFIX_FLAT;");
+            else
+                output_line(out, "            *fixity_associativity = CONSTRUCT_INFIX_LEFT;");
+            output_line(out, "            return;");
+        }
+        output_line(out, "        default: return;");
+        output_line(out, "        }");
+    }
+    output_line(out, "    default: return;");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "static size_t number_of_slots_lookup(uint32_t rule, void *context) {");
+    output_line(out, "    switch (rule) {");
+    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
+        set_unsigned_number_substitution(out, "rule-index", i);
+        set_unsigned_number_substitution(out, "number-of-slots",
+         gen->grammar->rules[i]->number_of_slots);
+        output_line(out, "    case %%rule-index: return %%number-of-slots;");
+    }
+    output_line(out, "    default: return 0;");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "static void left_right_operand_slots_lookup(uint32_t rule, uint32_t *left, uint32_t *right, uint32_t *operand, void *context) {");
+    output_line(out, "    switch (rule) {");
+    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
+        struct rule *rule = gen->grammar->rules[i];
+        set_unsigned_number_substitution(out, "rule-index", i);
+        set_unsigned_number_substitution(out, "left-slot",
+         rule->left_slot_index);
+        set_unsigned_number_substitution(out, "right-slot",
+         rule->right_slot_index);
+        set_unsigned_number_substitution(out, "operand-slot",
+         rule->operand_slot_index);
+        output_line(out, "    case %%rule-index:");
+        output_line(out, "        *left = %%left-slot;");
+        output_line(out, "        *right = %%right-slot;");
+        output_line(out, "        *operand = %%operand-slot;");
+        output_line(out, "        break;");
+    }
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "#endif");
+    output_line(out, "");
+    output_destroy(out);
+}
+
+static void generate_keyword(struct generator_output *out, struct token keyword,
+ size_t indentation)
+{
+    if (keyword.length > UINT32_MAX)
+        abort();
+    set_unsigned_number_substitution(out, "token-length",
+     (uint32_t)keyword.length);
+    if (keyword.type != TOKEN_WHITESPACE) {
+        output_indentation(out, indentation);
+        if (keyword.type == TOKEN_END)
+            output_line(out, "*end_token = true;");
+        else
+            output_line(out, "*end_token = false;");
+        output_indentation(out, indentation);
+        if (keyword.type == TOKEN_START_LINE_COMMENT)
+            output_line(out, "*token = %%comment-token;");
+        else {
+            set_unsigned_number_substitution(out, "token-index",
+             keyword.symbol);
+            output_line(out, "*token = %%token-index;");
+        }
+    }
+    output_indentation(out, indentation);
+    output_line(out, "return %%token-length;");
+}
+
+static void generate_keyword_reader(struct generated_token *tokens,
+ uint32_t number_of_tokens, struct generator_output *out) {
+    output_line(out, "    switch (text[0]) {");
+    uint32_t n = number_of_tokens;
+    size_t shared_length = 0;
+    struct generated_token *prefix = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        struct generated_token *token = &tokens[i];
+        struct token keyword = token->token;
+        struct generated_token *next = 0;
+        size_t next_length = 0;
+        if (i + 1 < n) {
+            next = &tokens[i + 1];
+            next_length = next->token.length;
+        }
+        size_t shared = 0;
+        for (; shared < keyword.length && shared < next_length; shared++) {
+            if (keyword.string[shared] != next->token.string[shared])
+                break;
+        }
+        while (shared > shared_length) {
+            set_unsigned_number_substitution(out, "character",
+             keyword.string[shared_length]);
+            output_indentation(out, shared_length + 1);
+            output_line(out, "case %%character:");
+            shared_length++;
+            if (shared_length > UINT32_MAX)
+                abort();
+            set_unsigned_number_substitution(out, "index",
+             (uint32_t)shared_length);
+            output_indentation(out, shared_length + 1);
+            output_line(out, "switch (length > %%index ? text[%%index] : 0) {");
+        }
+        token->prefix = prefix;
+        if (shared == keyword.length) {
+            prefix = token;
+            continue;
+        }
+        set_unsigned_number_substitution(out, "character",
+         keyword.string[shared_length]);
+        output_indentation(out, shared_length + 1);
+        output_line(out, "case %%character:");
+        if (keyword.length <= shared_length + 1)
+            generate_keyword(out, keyword, shared_length + 2);
+        else {
+            if (shared_length + 1 > UINT32_MAX)
+                abort();
+            set_unsigned_number_substitution(out, "offset",
+             (uint32_t)(shared_length + 1));
+            set_unsigned_number_substitution(out, "keyword-length",
+             (uint32_t)keyword.length);
+            output_indentation(out, shared_length + 2);
+            output_string(out, "if (length >= %%keyword-length && ");
+            for (size_t j = shared_length + 1; j < keyword.length; ++j) {
+                set_unsigned_number_substitution(out, "character",
+                 keyword.string[j]);
+                set_unsigned_number_substitution(out, "index", (uint32_t)j);
+                output_string(out, "text[%%index] == %%character");
+                if (j + 1 < keyword.length)
+                    output_string(out, " && ");
+            }
+            if (keyword.length - shared_length - 1 > UINT32_MAX)
+                abort();
+            output_line(out, ") {");
+            generate_keyword(out, keyword, shared_length + 3);
+            output_indentation(out, shared_length + 2);
+            output_line(out, "} else {");
+            if (prefix)
+                generate_keyword(out, prefix->token, shared_length + 3);
+            else {
+                output_indentation(out, shared_length + 3);
+                output_line(out, "return 0;");
+            }
+            output_indentation(out, shared_length + 2);
+            output_line(out, "}");
+        }
+        while (shared_length > shared) {
+            output_indentation(out, shared_length + 1);
+            output_line(out, "default:");
+            if (prefix) {
+                generate_keyword(out, prefix->token, shared_length + 2);
+                if (prefix->token.length >= shared_length)
+                    prefix = prefix->prefix;
+            } else {
+                output_indentation(out, shared_length + 2);
+                output_line(out, "return 0;");
+            }
+            output_indentation(out, shared_length + 1);
+            output_line(out, "}");
+            shared_length--;
+        }
+    }
+    output_line(out, "    default:");
+    output_line(out, "        return 0;");
+    output_line(out, "    }");
+}
+
+// The keyword hash is FNV-1a, starting from a seed chosen by the generator.
+// Each bucket of keywords gets a displacement which is mixed into the hash to
+// choose a slot; displacements are picked so that no two keywords share a
+// slot (this is the "hash and displace" construction).
+static uint32_t keyword_hash(struct token keyword, uint32_t seed)
+{
+    uint32_t hash = seed;
+    for (size_t i = 0; i < keyword.length; ++i) {
+        hash ^= (uint8_t)keyword.string[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t keyword_slot(uint32_t hash, uint32_t displacement,
+ uint32_t number_of_slots)
+{
+    uint32_t slot = hash + displacement;
+    slot ^= slot >> 16;
+    slot *= 0x85ebca6bu;
+    slot ^= slot >> 13;
+    return slot % number_of_slots;
+}
+
+static int compare_bucket_sizes(const void *aa, const void *bb)
+{
+    uint64_t a = *(const uint64_t *)aa;
+    uint64_t b = *(const uint64_t *)bb;
+    if (a > b)
+        return -1;
+    if (a < b)
+        return 1;
+    return 0;
+}
+
+#define MAX_DISPLACEMENT (1 << 20)
+
+static void generate_keyword_hash(struct generated_token *tokens,
+ uint32_t number_of_tokens, struct generator_output *out)
+{
+    uint32_t n = number_of_tokens;
+    if (n == 0) {
+        output_line(out, "static bool read_identifier_keyword(%%token-type *token, bool *end_token, const char *text, size_t length) {");
+        output_line(out, "    return false;");
+        output_line(out, "}");
+        return;
+    }
+    uint32_t number_of_buckets = (n + 1) / 2;
+    uint32_t *hashes = calloc(n, sizeof(uint32_t));
+    uint32_t *slots = calloc(n, sizeof(uint32_t));
+    uint32_t *token_in_slot = calloc(n, sizeof(uint32_t));
+    uint32_t *displacements = calloc(number_of_buckets, sizeof(uint32_t));
+    uint64_t *buckets = calloc(number_of_buckets, sizeof(uint64_t));
+    if (!hashes || !slots || !token_in_slot || !displacements || !buckets) {
+        fputs("critical error: out of memory\n", stderr);
+        exit(-1);
+    }
+    uint32_t seed = 2166136261u;
+    for (;; seed++) {
+        for (uint32_t i = 0; i < n; ++i)
+            hashes[i] = keyword_hash(tokens[i].token, seed);
+        // Handle the biggest buckets first, while there are lots of free slots.
+        for (uint32_t i = 0; i < number_of_buckets; ++i)
+            buckets[i] = i;
+        for (uint32_t i = 0; i < n; ++i)
+            buckets[hashes[i] % number_of_buckets] += (uint64_t)1 << 32;
+        qsort(buckets, number_of_buckets, sizeof(uint64_t),
+         compare_bucket_sizes);
+        for (uint32_t i = 0; i < n; ++i)
+            token_in_slot[i] = UINT32_MAX;
+        bool found = true;
+        for (uint32_t i = 0; i < number_of_buckets && found; ++i) {
+            uint32_t bucket = (uint32_t)buckets[i];
+            if (buckets[i] >> 32 == 0)
+                break;
+            uint32_t d = 0;
+            for (; d < MAX_DISPLACEMENT; ++d) {
+                uint32_t placed = 0;
+                for (uint32_t j = 0; j < n; ++j) {
+                    if (hashes[j] % number_of_buckets != bucket)
+                        continue;
+                    uint32_t slot = keyword_slot(hashes[j], d, n);
+                    if (token_in_slot[slot] != UINT32_MAX)
+                        break;
+                    token_in_slot[slot] = j;
+                    slots[placed++] = slot;
+                }
+                if (placed == buckets[i] >> 32)
+                    break;
+                for (uint32_t j = 0; j < placed; ++j)
+                    token_in_slot[slots[j]] = UINT32_MAX;
+            }
+            displacements[bucket] = d;
+            if (d == MAX_DISPLACEMENT)
+                found = false;
+        }
+        if (found)
+            break;
+    }
+    set_unsigned_number_substitution(out, "number-of-keywords", n);
+    set_unsigned_number_substitution(out, "number-of-buckets",
+     number_of_buckets);
+    set_unsigned_number_substitution(out, "seed", seed);
+    size_t min_length = SIZE_MAX;
+    size_t max_length = 0;
+    output_line(out, "struct identifier_keyword {");
+    output_line(out, "    const char *string;");
+    output_line(out, "    uint32_t length;");
+    output_line(out, "    %%token-type token;");
+    output_line(out, "    bool end_token;");
+    output_line(out, "};");
+    output_line(out, "static const struct identifier_keyword identifier_keywords[%%number-of-keywords] = {");
+    for (uint32_t i = 0; i < n; ++i) {
+        struct token keyword = tokens[token_in_slot[i]].token;
+        if (keyword.length < min_length)
+            min_length = keyword.length;
+        if (keyword.length > max_length)
+            max_length = keyword.length;
+        if (keyword.length > UINT32_MAX)
+            abort();
+        set_substitution(out, "keyword", keyword.string, keyword.length,
+         NO_TRANSFORM);
+        set_unsigned_number_substitution(out, "keyword-length",
+         (uint32_t)keyword.length);
+        set_unsigned_number_substitution(out, "token-index", keyword.symbol);
+        set_literal_substitution(out, "end-token",
+         keyword.type == TOKEN_END ? "true" : "false");
+        output_line(out, "    { \"%%keyword\", %%keyword-length, %%token-index, %%end-token },");
+    }
+    output_line(out, "};");
+    output_line(out, "static const uint32_t identifier_keyword_displacements[%%number-of-buckets] = {");
+    for (uint32_t i = 0; i < number_of_buckets; ++i) {
+        set_unsigned_number_substitution(out, "displacement",
+         displacements[i]);
+        output_line(out, "    %%displacement,");
+    }
+    output_line(out, "};");
+    set_unsigned_number_substitution(out, "min-length", (uint32_t)min_length);
+    set_unsigned_number_substitution(out, "max-length", (uint32_t)max_length);
+    output_line(out, "static bool read_identifier_keyword(%%token-type *token, bool *end_token, const char *text, size_t length) {");
+    output_line(out, "    if (length < %%min-length || length > %%max-length)");
+    output_line(out, "        return false;");
+    output_line(out, "    uint32_t hash = %%seed;");
+    output_line(out, "    for (size_t i = 0; i < length; ++i) {");
+    output_line(out, "        hash ^= (uint8_t)text[i];");
+    output_line(out, "        hash *= 16777619u;");
+    output_line(out, "    }");
+    output_line(out, "    uint32_t slot = hash + identifier_keyword_displacements[hash % %%number-of-buckets];");
+    output_line(out, "    slot ^= slot >> 16;");
+    output_line(out, "    slot *= 0x85ebca6bu;");
+    output_line(out, "    slot ^= slot >> 13;");
+    output_line(out, "    const struct identifier_keyword *keyword = &identifier_keywords[slot % %%number-of-keywords];");
+    output_line(out, "    if (keyword->length != length || memcmp(keyword->string, text, length) != 0)");
+    output_line(out, "        return false;");
+    output_line(out, "    *token = keyword->token;");
+    output_line(out, "    *end_token = keyword->end_token;");
+    output_line(out, "    return true;");
+    output_line(out, "}");
+    free(hashes);
+    free(slots);
+    free(token_in_slot);
+    free(displacements);
+    free(buckets);
+}
+
+static bool keyword_is_identifier_shaped(struct token keyword,
+ bool allow_dashes)
+{
+    if (keyword.length == 0)
+        return false;
+    for (size_t i = 0; i < keyword.length; ++i) {
+        char c = keyword.string[i];
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_')
+            continue;
+        if (i > 0 && c >= '0' && c <= '9')
+            continue;
+        if (i > 0 && i + 1 < keyword.length && c == '-' && allow_dashes)
+            continue;
+        return false;
+    }
+    return true;
+}
+
+// Outputs a condition which is true if none of the bracket transitions in `r`
+// are expected by the bracket on top of the stack.
+static void generate_reachability_mask_condition(struct generator *gen,
+ struct generator_output *out, struct bitset *r)
+{
+    uint32_t mask_width = reachability_mask_width(gen);
+    for (uint32_t i = 0; i < mask_width; ++i) {
+        if (i > 0)
+            output_string(out, " && ");
+        set_unsigned_number_substitution(out, "mask-index", i);
+        uint64_t bits = r->bit_groups[i / 2];
+        if (i % 2)
+            bits >>= 32;
+        else
+            bits &= UINT32_MAX;
+        set_unsigned_number_substitution(out, "mask-bits", (uint32_t)bits);
+        output_string(out, "!(%%mask-bits & top->reachability_mask[%%mask-index])");
+    }
+}
+
+// The reachability mask of a bracket entered from state `s`: the bracket
+// transitions whose symbols `s` can continue with once the bracket ends.
+static struct bitset bracket_entry_mask(struct generator *gen, struct state s)
+{
+    struct bracket_transitions ts = gen->deterministic->transitions;
+    struct bitset mask = bitset_create_empty(ts.number_of_transitions);
+    for (uint32_t j = 0; j < s.number_of_transitions; ++j) {
+        symbol_id symbol = s.transitions[j].symbol;
+        if (symbol < gen->combined->number_of_tokens)
+            continue;
+        for (uint32_t k = 0; k < ts.number_of_transitions; ++k) {
+            if (ts.transitions[k].deterministic_transition_symbol == symbol)
+                bitset_add(&mask, k);
+        }
+    }
+    return mask;
+}
+
+static void generate_state_functions(struct generator *gen,
+ struct generator_output *out)
+{
+    uint32_t mask_width = reachability_mask_width(gen);
+    if (mask_width == 0)
+        mask_width = 1;
+    struct automaton *a = &gen->deterministic->automaton;
+    struct automaton *b = &gen->deterministic->bracket_automaton;
+    uint32_t total_states = a->number_of_states + b->number_of_states;
+    struct state_in_automaton *sorted_states =
+     malloc(sizeof(struct state_in_automaton) * total_states);
+    for (state_id i = 0; i < a->number_of_states; ++i) {
+        sorted_states[i] = (struct state_in_automaton){
+            .reachability_mask = 0,
+            .automaton = a,
+            .state = i,
+            .state_offset = 0,
+        };
+    }
+    for (state_id i = 0; i < b->number_of_states; ++i) {
+        sorted_states[i + a->number_of_states] = (struct state_in_automaton){
+            .reachability_mask = &gen->deterministic->bracket_reachability[i],
+            .automaton = b,
+            .state = i,
+            .state_offset = a->number_of_states,
+            .bracket_accepting = b->states[i].accepting,
+        };
+    }
+    qsort(sorted_states, total_states, sizeof(struct state_in_automaton),
+     compare_state_transitions);
+    // States with the same transitions share their code.
+    state_id *func_id_for_state = calloc(total_states, sizeof(state_id));
+    state_id func_id = 0;
+    for (uint32_t i = 0; i < total_states; ++i) {
+        if (i == 0 || compare_state_transitions(sorted_states + i,
+         sorted_states + i - 1) != 0)
+            func_id = sorted_states[i].state + sorted_states[i].state_offset;
+        func_id_for_state[sorted_states[i].state +
+         sorted_states[i].state_offset] = func_id;
+    }
+    state_id first_bracket_state = a->number_of_states;
+    set_unsigned_number_substitution(out, "first-bracket-func-id",
+     func_id_for_state[first_bracket_state]);
+
+    output_string(out, "static struct fill_run_state *bracket_entry_state(struct fill_run_continuation *cont");
+    for (uint32_t i = 0; i < mask_width; ++i) {
+        set_unsigned_number_substitution(out, "mask-index", i);
+        output_string(out, ", uint32_t mask%%mask-index");
+    }
+    output_line(out, ") {");
+    output_line(out, "    cont->top_index++;");
+    output_line(out, "    if (cont->top_index >= cont->capacity) {");
+    output_line(out, "        size_t new_capacity = (cont->capacity + 2) * 3 / 2;");
+    output_line(out, "        if (new_capacity <= cont->capacity)");
+    output_line(out, "            abort();");
+    output_line(out, "        struct fill_run_state *new_states = reallocate_memory(cont->stack, cont->capacity * sizeof(struct fill_run_state), new_capacity * sizeof(struct fill_run_state), cont->allocator);");
+    output_line(out, "        if (!new_states)");
+    output_line(out, "            abort();");
+    output_line(out, "        cont->stack = new_states;");
+    output_line(out, "        cont->capacity = new_capacity;");
+    output_line(out, "    }");
+    output_line(out, "    struct fill_run_state *top = &cont->stack[cont->top_index];");
+    output_line(out, "    top->cont = cont;");
+    for (uint32_t i = 0; i < mask_width; ++i) {
+        set_unsigned_number_substitution(out, "mask-index", i);
+        output_line(out, "    top->reachability_mask[%%mask-index] = mask%%mask-index;");
+    }
+    output_line(out, "    return top;");
+    output_line(out, "}");
+
+    // Each state has a label in fill_run_states.  Transitions jump straight to
+    // the label for the target state, so a run of tokens never leaves the
+    // function.  Brackets push or pop the stack, then jump back in through a
+    // switch on the new state.
+    output_line(out, "static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index) {");
+    output_line(out, "    uint16_t token_index = 0;");
+    output_line(out, "    uint16_t number_of_tokens = run->number_of_tokens;");
+    output_line(out, "    struct fill_run_state *top = &cont->stack[cont->top_index];");
+    output_line(out, "    %%state-type state = top->state;");
+    output_line(out, "    if (number_of_tokens == 0)");
+    output_line(out, "        return true;");
+    // Only the end of a bracket jumps back to the switch.
+    bool has_brackets = false;
+    for (uint32_t i = 0; i < total_states; ++i)
+        has_brackets = has_brackets || sorted_states[i].bracket_accepting;
+    if (has_brackets)
+        output_line(out, "dispatch:");
+    output_line(out, "    switch (state) {");
+    for (state_id i = 0; i < total_states; ++i) {
+        set_unsigned_number_substitution(out, "state-id", i);
+        set_unsigned_number_substitution(out, "func-id", func_id_for_state[i]);
+        output_line(out, "    case %%state-id: goto state_%%func-id;");
+    }
+    output_line(out, "    default: abort();");
     output_line(out, "    }");
-    output_line(out, "    return UINT32_MAX;");
+    bool has_transitions = false;
+    for (uint32_t i = 0; i < total_states; ++i) {
+        if (i > 0 && compare_state_transitions(sorted_states + i,
+         sorted_states + i - 1) == 0)
+            continue;
+        state_id offset = sorted_states[i].state_offset;
+        struct state s = sorted_states[i].automaton->states[sorted_states[i].state];
+        set_unsigned_number_substitution(out, "func-id",
+         sorted_states[i].state + offset);
+        output_line(out, "state_%%func-id:");
+        output_line(out, "    run->states[token_index] = state;");
+        if (sorted_states[i].bracket_accepting) {
+            // The bracket ends here: pop it and replace this token with the
+            // bracket's symbol for the state below to read.
+            set_unsigned_number_substitution(out, "state-transition-symbol",
+             token_class(gen, s.transition_symbol));
+            output_line(out, "    if (cont->top_index == 0) {");
+            output_line(out, "        top->state = state;");
+            output_line(out, "        cont->error = 2;");
+            output_line(out, "        *failing_index = token_index;");
+            output_line(out, "        return false;");
+            output_line(out, "    }");
+            output_line(out, "    cont->top_index--;");
+            output_line(out, "    top--;");
+            output_line(out, "    run->tokens[token_index] = %%state-transition-symbol;");
+            output_line(out, "    state = top->state;");
+            output_line(out, "    goto dispatch;");
+            continue;
+        }
+        if (sorted_states[i].reachability_mask &&
+         reachability_mask_width(gen) > 0) {
+            // Check if any of the end states we're expecting are still
+            // reachable.
+            output_string(out, "    if (");
+            generate_reachability_mask_condition(gen, out,
+             sorted_states[i].reachability_mask);
+            output_line(out, ") {");
+            output_line(out, "        cont->error = -1;");
+            output_line(out, "        *failing_index = token_index - 1;");
+            output_line(out, "        return false;");
+            output_line(out, "    }");
+        }
+        output_line(out, "    switch (run->tokens[token_index]) {");
+        for (uint32_t j = 0; j < s.number_of_transitions; ++j) {
+            struct transition t = s.transitions[j];
+            // Tokens in the same class share a case.
+            bool seen_class = false;
+            for (uint32_t k = 0; k < j && !seen_class; ++k) {
+                seen_class = token_class(gen, s.transitions[k].symbol) ==
+                 token_class(gen, t.symbol);
+            }
+            if (seen_class)
+                continue;
+            set_unsigned_number_substitution(out, "token-symbol",
+             token_class(gen, t.symbol));
+            set_unsigned_number_substitution(out, "token-target",
+             t.target + offset);
+            set_unsigned_number_substitution(out, "target-func-id",
+             func_id_for_state[t.target + offset]);
+            output_line(out, "    case %%token-symbol: state = %%token-target; if (++token_index < number_of_tokens) goto state_%%target-func-id; goto done;");
+            has_transitions = true;
+        }
+        output_line(out, "    default:");
+        output_line(out, "        top->state = state;");
+        // Any other token starts a bracket, as long as the bracket can end
+        // with a symbol this state accepts.
+        struct bitset mask = bracket_entry_mask(gen, s);
+        if (!bitset_is_empty(&mask) && (reachability_mask_width(gen) == 0 ||
+         bitset_intersects(&mask,
+         &gen->deterministic->bracket_reachability[0]))) {
+            output_string(out, "        top = bracket_entry_state(cont");
+            for (uint32_t k = 0; k < mask_width; ++k) {
+                uint64_t bits = k / 2 < mask.number_of_bit_groups ?
+                 mask.bit_groups[k / 2] : 0;
+                if (k % 2)
+                    bits >>= 32;
+                else
+                    bits &= UINT32_MAX;
+                set_unsigned_number_substitution(out, "mask-bits", (uint32_t)bits);
+                output_string(out, ", %%mask-bits");
+            }
+            output_line(out, ");");
+            output_line(out, "        state = %%first-bracket-state-id;");
+            output_line(out, "        goto state_%%first-bracket-func-id;");
+        } else {
+            output_line(out, "        cont->error = 1;");
+            output_line(out, "        *failing_index = token_index;");
+            output_line(out, "        return false;");
+        }
+        bitset_destroy(&mask);
+        output_line(out, "    }");
+    }
+    if (has_transitions)
+        output_line(out, "done:");
+    output_line(out, "    top->state = state;");
+    output_line(out, "    return true;");
     output_line(out, "}");
-    output_line(out, "static void fixity_associativity_precedence_lookup(int *fixity_associativity, int *precedence, uint32_t rule, uint32_t choice, void *context) {");
-    output_line(out, "    switch (rule) {");
-    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
-        struct rule *rule = gen->grammar->rules[i];
-        if (rule->first_operator_choice == rule->number_of_choices)
+    free(sorted_states);
+    free(func_id_for_state);
+}
+
+static const char *smallest_unsigned_type(uint32_t max_value)
+{
+    if (max_value <= UINT8_MAX)
+        return "uint8_t";
+    if (max_value <= UINT16_MAX)
+        return "uint16_t";
+    return "uint32_t";
+}
+
+static void output_reachability_mask(struct generator *gen,
+ struct generator_output *out, struct bitset *mask)
+{
+    uint32_t mask_width = reachability_mask_width(gen);
+    output_string(out, "{");
+    for (uint32_t i = 0; i < mask_width; ++i) {
+        uint64_t bits = mask->bit_groups[i / 2];
+        if (i % 2)
+            bits >>= 32;
+        else
+            bits &= UINT32_MAX;
+        set_unsigned_number_substitution(out, "mask-bits", (uint32_t)bits);
+        output_string(out, i > 0 ? ", %%mask-bits" : "%%mask-bits");
+    }
+    output_string(out, "}");
+}
+
+static void generate_state_table(struct generator *gen,
+ struct generator_output *out)
+{
+    struct automaton *a = &gen->deterministic->automaton;
+    struct automaton *b = &gen->deterministic->bracket_automaton;
+    uint32_t mask_width = reachability_mask_width(gen);
+    uint32_t total_states = a->number_of_states + b->number_of_states;
+
+    // Every token class gets a column.  The extra column at the end stands
+    // for the bracket symbol placeholder the tokenizer writes after end tokens,
+    // which no state transitions on.
+    uint32_t number_of_classes = gen->deterministic->number_of_classes;
+    uint32_t number_of_columns = number_of_classes + 1;
+
+    // Entries below `total_states` are targets.  `total_states` itself means
+    // there's no transition, and larger entries mean the token should start a
+    // bracket, with the reachability mask at index `entry - total_states - 1`
+    // of `bracket_entry_masks`.
+    uint32_t no_transition = total_states;
+    uint32_t *entries = calloc((size_t)total_states * number_of_columns,
+     sizeof(uint32_t));
+    struct bitset *entry_masks = 0;
+    uint32_t number_of_entry_masks = 0;
+    for (state_id i = 0; i < total_states; ++i) {
+        bool in_bracket = i >= a->number_of_states;
+        struct state s = in_bracket ? b->states[i - a->number_of_states] :
+         a->states[i];
+        state_id offset = in_bracket ? a->number_of_states : 0;
+        uint32_t *row = entries + (size_t)i * number_of_columns;
+        for (uint32_t j = 0; j < number_of_columns; ++j)
+            row[j] = no_transition;
+        if (in_bracket && s.accepting)
             continue;
-        set_unsigned_number_substitution(out, "rule-index", i);
-        output_line(out, "    case %%rule-index:");
-        output_line(out, "        switch (choice) {");
-        for (uint32_t j = rule->first_operator_choice;
-         j < rule->number_of_choices; ++j) {
-            struct choice op = rule->choices[j];
-            set_unsigned_number_substitution(out, "choice-index", j);
-            set_signed_number_substitution(out, "operator-precedence",
-             op.precedence);
-            output_line(out, "        case %%choice-index:");
-            output_line(out, "            *precedence = %%operator-precedence;");
-            if (op.fixity == PREFIX)
-                output_line(out, "            *fixity_associativity = CONSTRUCT_PREFIX;");
-            else if (op.fixity == POSTFIX)
-                output_line(out, "            *fixity_associativity = CONSTRUCT_POSTFIX;");
-            else if (op.associativity == RIGHT)
-                output_line(out, "            *fixity_associativity = CONSTRUCT_INFIX_RIGHT;");
-            else if (op.associativity == FLAT)
-                output_line(out, "            *fixity_associativity = CONSTRUCT_INFIX_FLAT;");
-            else
-                output_line(out, "            *fixity_associativity = CONSTRUCT_INFIX_LEFT;");
-            output_line(out, "            return;");
+        for (uint32_t j = 0; j < s.number_of_transitions; ++j) {
+            struct transition t = s.transitions[j];
+            row[token_class(gen, t.symbol)] = t.target + offset;
         }
-        output_line(out, "        default: return;");
+        struct bitset mask = bracket_entry_mask(gen, s);
+        if (bitset_is_empty(&mask)) {
+            bitset_destroy(&mask);
+            continue;
+        }
+        uint32_t mask_index = 0;
+        while (mask_index < number_of_entry_masks &&
+         bitset_compare(&entry_masks[mask_index], &mask) != 0)
+            mask_index++;
+        if (mask_index == number_of_entry_masks) {
+            entry_masks = realloc(entry_masks,
+             sizeof(struct bitset) * (number_of_entry_masks + 1));
+            entry_masks[number_of_entry_masks++] = bitset_move(&mask);
+        } else
+            bitset_destroy(&mask);
+        for (uint32_t j = 0; j < number_of_columns; ++j) {
+            if (row[j] == no_transition)
+                row[j] = no_transition + 1 + mask_index;
+        }
+    }
+
+    set_unsigned_number_substitution(out, "number-of-classes",
+     number_of_classes);
+    set_unsigned_number_substitution(out, "total-number-of-states",
+     total_states);
+    set_unsigned_number_substitution(out, "no-transition", no_transition);
+    set_unsigned_number_substitution(out, "number-of-entry-masks",
+     number_of_entry_masks);
+    set_unsigned_number_substitution(out, "number-of-bracket-states",
+     b->number_of_states);
+    set_literal_substitution(out, "transition-type",
+     smallest_unsigned_type(no_transition + number_of_entry_masks));
+    const int numbers_per_line = 16;
+    output_line(out, "static const %%transition-type state_transitions[%%total-number-of-states][%%number-of-classes + 1] = {");
+    for (state_id i = 0; i < total_states; ++i) {
+        output_string(out, "    {");
+        for (uint32_t c = 0; c < number_of_columns; ++c) {
+            set_unsigned_number_substitution(out, "transition",
+             entries[(size_t)i * number_of_columns + c]);
+            output_string(out, c > 0 ? ", %%transition" : "%%transition");
+        }
+        output_line(out, "},");
+    }
+    output_line(out, "};");
+    bool has_masks = mask_width > 0 && b->number_of_states > 0;
+    if (has_masks) {
+        set_unsigned_number_substitution(out, "reachability-mask-width",
+         mask_width);
+        output_line(out, "static const uint32_t bracket_state_masks[%%number-of-bracket-states][%%reachability-mask-width] = {");
+        for (state_id i = 0; i < b->number_of_states; ++i) {
+            output_string(out, "    ");
+            output_reachability_mask(gen, out,
+             &gen->deterministic->bracket_reachability[i]);
+            output_line(out, ",");
+        }
+        output_line(out, "};");
+    }
+    if (number_of_entry_masks > 0) {
+        output_line(out, "static const uint32_t bracket_entry_masks[%%number-of-entry-masks][%%reachability-mask-width] = {");
+        for (uint32_t i = 0; i < number_of_entry_masks; ++i) {
+            output_string(out, "    ");
+            output_reachability_mask(gen, out, &entry_masks[i]);
+            output_line(out, ",");
+        }
+        output_line(out, "};");
+    }
+    if (b->number_of_states > 0) {
+        // Accepting bracket states replace the placeholder with the bracket
+        // symbol and return to the state below them on the stack.
+        output_string(out, "static const %%token-type bracket_exit_symbols[%%number-of-bracket-states] = {");
+        for (state_id i = 0; i < b->number_of_states; ++i) {
+            if (i % numbers_per_line == 0) {
+                output_line(out, "");
+                output_string(out, "   ");
+            }
+            set_unsigned_number_substitution(out, "exit-symbol",
+             b->states[i].accepting ?
+             token_class(gen, b->states[i].transition_symbol) : UINT32_MAX);
+            output_string(out, " %%exit-symbol,");
+        }
+        output_line(out, "");
+        output_line(out, "};");
+    }
+
+    if (has_masks) {
+        output_line(out, "static inline bool bracket_state_is_reachable(struct fill_run_state *top, %%state-type state) {");
+        output_line(out, "    const uint32_t *mask = bracket_state_masks[state - %%first-bracket-state-id];");
+        output_string(out, "    return (");
+        for (uint32_t i = 0; i < mask_width; ++i) {
+            set_unsigned_number_substitution(out, "mask-index", i);
+            output_string(out, i > 0 ? " | (mask[%%mask-index] & top->reachability_mask[%%mask-index])" : "(mask[%%mask-index] & top->reachability_mask[%%mask-index])");
+        }
+        output_line(out, ") != 0;");
+        output_line(out, "}");
+    }
+    output_line(out, "static void table_state_step(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index);");
+    if (number_of_entry_masks > 0) {
+        output_line(out, "static void bracket_entry_state(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index, const uint32_t *mask) {");
+        output_line(out, "    struct fill_run_continuation *cont = top->cont;");
+        output_line(out, "    cont->top_index++;");
+        output_line(out, "    if (cont->top_index >= cont->capacity) {");
+        output_line(out, "        size_t new_capacity = (cont->capacity + 2) * 3 / 2;");
+        output_line(out, "        if (new_capacity <= cont->capacity)");
+        output_line(out, "            abort();");
+        output_line(out, "        struct fill_run_state *new_states = reallocate_memory(cont->stack, cont->capacity * sizeof(struct fill_run_state), new_capacity * sizeof(struct fill_run_state), cont->allocator);");
+        output_line(out, "        if (!new_states)");
+        output_line(out, "            abort();");
+        output_line(out, "        cont->stack = new_states;");
+        output_line(out, "        cont->capacity = new_capacity;");
+        output_line(out, "        top = &cont->stack[cont->top_index];");
+        output_line(out, "    } else");
+        output_line(out, "        top++;");
+        output_line(out, "    top->cont = cont;");
+        output_line(out, "    memcpy(top->reachability_mask, mask, sizeof(top->reachability_mask));");
+        output_line(out, "    top->state = %%first-bracket-state-id;");
+        output_line(out, "    run->states[token_index] = %%first-bracket-state-id;");
+        output_line(out, "    table_state_step(run, top, token_index);");
+        output_line(out, "    if (top->cont->error == -1)");
+        output_line(out, "        top->cont->error = 1;");
+        output_line(out, "}");
+    }
+    // Anything other than a plain transition happens out of line, so the loop
+    // in fill_run_states stays small.
+    output_line(out, "static OWL_DONT_INLINE void table_slow_transition(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index, %%transition-type transition) {");
+    if (number_of_entry_masks > 0) {
+        output_line(out, "    if (transition > %%no-transition) {");
+        output_line(out, "        bracket_entry_state(run, top, token_index, bracket_entry_masks[transition - %%no-transition - 1]);");
+        output_line(out, "        return;");
+        output_line(out, "    }");
+    } else
+        output_line(out, "    (void)transition;");
+    if (b->number_of_states > 0) {
+        output_line(out, "    %%state-type state = top->state;");
+        output_line(out, "    if (state >= %%first-bracket-state-id && bracket_exit_symbols[state - %%first-bracket-state-id] != UINT32_MAX) {");
+        output_line(out, "        if (top->cont->top_index == 0) {");
+        output_line(out, "            top->cont->error = 2;");
+        output_line(out, "            return;");
         output_line(out, "        }");
+        output_line(out, "        top->cont->top_index--;");
+        output_line(out, "        top--;");
+        output_line(out, "        run->tokens[token_index] = bracket_exit_symbols[state - %%first-bracket-state-id];");
+        output_line(out, "        run->states[token_index] = top->state;");
+        output_line(out, "        table_state_step(run, top, token_index);");
+        output_line(out, "        return;");
+        output_line(out, "    }");
     }
-    output_line(out, "    default: return;");
-    output_line(out, "    }");
+    output_line(out, "    top->cont->error = 1;");
     output_line(out, "}");
-    output_line(out, "static size_t number_of_slots_lookup(uint32_t rule, void *context) {");
-    output_line(out, "    switch (rule) {");
-    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
-        set_unsigned_number_substitution(out, "rule-index", i);
-        set_unsigned_number_substitution(out, "number-of-slots",
-         gen->grammar->rules[i]->number_of_slots);
-        output_line(out, "    case %%rule-index: return %%number-of-slots;");
+    output_line(out, "static void table_state_step(struct owl_token_run *run, struct fill_run_state *top, uint16_t token_index) {");
+    output_line(out, "    %%state-type state = top->state;");
+    if (has_masks) {
+        output_line(out, "    if (state >= %%first-bracket-state-id && !bracket_state_is_reachable(top, state)) {");
+        output_line(out, "        top->cont->error = -1;");
+        output_line(out, "        return;");
+        output_line(out, "    }");
     }
-    output_line(out, "    default: return 0;");
+    output_line(out, "    %%token-type token = run->tokens[token_index];");
+    output_line(out, "    %%transition-type transition = state_transitions[state][token < %%number-of-classes ? token : %%number-of-classes];");
+    output_line(out, "    if (transition < %%no-transition)");
+    output_line(out, "        top->state = transition;");
+    output_line(out, "    else");
+    output_line(out, "        table_slow_transition(run, top, token_index, transition);");
+    output_line(out, "}");
+    output_line(out, "static bool fill_run_states(struct owl_token_run *run, struct fill_run_continuation *cont, uint16_t *failing_index) {");
+    output_line(out, "    uint16_t token_index = 0;");
+    output_line(out, "    uint16_t number_of_tokens = run->number_of_tokens;");
+    output_line(out, "    struct fill_run_state *top = &cont->stack[cont->top_index];");
+    output_line(out, "    %%state-type state = top->state;");
+    output_line(out, "    while (token_index < number_of_tokens) {");
+    output_line(out, "        run->states[token_index] = state;");
+    if (has_masks) {
+        output_line(out, "        if (state >= %%first-bracket-state-id && !bracket_state_is_reachable(top, state)) {");
+        output_line(out, "            cont->error = -1;");
+        output_line(out, "            *failing_index = token_index - 1;");
+        output_line(out, "            return false;");
+        output_line(out, "        }");
+    }
+    output_line(out, "        %%token-type token = run->tokens[token_index];");
+    output_line(out, "        %%transition-type transition = state_transitions[state][token < %%number-of-classes ? token : %%number-of-classes];");
+    output_line(out, "        if (transition < %%no-transition)");
+    output_line(out, "            state = transition;");
+    output_line(out, "        else {");
+    output_line(out, "            top->state = state;");
+    output_line(out, "            table_slow_transition(run, top, token_index, transition);");
+    output_line(out, "            if (cont->error) {");
+    output_line(out, "                *failing_index = token_index - (cont->error > 0 ? 0 : 1);");
+    output_line(out, "                return false;");
+    output_line(out, "            }");
+    output_line(out, "            top = &cont->stack[cont->top_index];");
+    output_line(out, "            state = top->state;");
+    output_line(out, "        }");
+    output_line(out, "        token_index++;");
     output_line(out, "    }");
+    output_line(out, "    top->state = state;");
+    output_line(out, "    return true;");
     output_line(out, "}");
-    output_line(out, "static void left_right_operand_slots_lookup(uint32_t rule, uint32_t *left, uint32_t *right, uint32_t *operand, void *context) {");
-    output_line(out, "    switch (rule) {");
-    for (uint32_t i = 0; i < gen->grammar->number_of_rules; ++i) {
-        struct rule *rule = gen->grammar->rules[i];
-        set_unsigned_number_substitution(out, "rule-index", i);
-        set_unsigned_number_substitution(out, "left-slot",
-         rule->left_slot_index);
-        set_unsigned_number_substitution(out, "right-slot",
-         rule->right_slot_index);
-        set_unsigned_number_substitution(out, "operand-slot",
-         rule->operand_slot_index);
-        output_line(out, "    case %%rule-index:");
-        output_line(out, "        *left = %%left-slot;");
-        output_line(out, "        *right = %%right-slot;");
-        output_line(out, "        *operand = %%operand-slot;");
-        output_line(out, "        break;");
+
+    for (uint32_t i = 0; i < number_of_entry_masks; ++i)
+        bitset_destroy(&entry_masks[i]);
+    free(entry_masks);
+    free(entries);
+}
+
+// With OWL_THREADS, worker threads check pieces of the input without knowing
+// what's on the stack below them.  These bases are what that frame could be:
+// any state of the main automaton, or any bracket state with any of the masks
+// a bracket can be entered with.
+static void generate_speculative_bases(struct generator *gen,
+ struct generator_output *out)
+{
+    struct automaton *a = &gen->deterministic->automaton;
+    struct automaton *b = &gen->deterministic->bracket_automaton;
+    struct bitset *entry_masks = 0;
+    uint32_t number_of_entry_masks = 0;
+    for (state_id i = 0; i < a->number_of_states + b->number_of_states; ++i) {
+        bool in_bracket = i >= a->number_of_states;
+        struct state s = in_bracket ? b->states[i - a->number_of_states] :
+         a->states[i];
+        struct bitset mask = bracket_entry_mask(gen, s);
+        uint32_t mask_index = 0;
+        while (mask_index < number_of_entry_masks &&
+         bitset_compare(&entry_masks[mask_index], &mask) != 0)
+            mask_index++;
+        if (!bitset_is_empty(&mask) && mask_index == number_of_entry_masks) {
+            entry_masks = realloc(entry_masks,
+             sizeof(struct bitset) * (number_of_entry_masks + 1));
+            entry_masks[number_of_entry_masks++] = bitset_move(&mask);
+        } else
+            bitset_destroy(&mask);
+    }
+    // Accepting bracket states always pop the stack, so they're never at the
+    // bottom of a worker's stack.
+    uint32_t number_of_bases = a->number_of_states;
+    for (state_id i = 0; i < b->number_of_states; ++i) {
+        if (!b->states[i].accepting)
+            number_of_bases += number_of_entry_masks;
+    }
+    set_unsigned_number_substitution(out, "number-of-speculative-bases",
+     number_of_bases);
+    output_line(out, "struct speculative_base {");
+    output_line(out, "    %%state-type state;");
+    output_line(out, "    uint32_t reachability_mask[%%reachability-mask-width];");
+    output_line(out, "};");
+    output_line(out, "static const struct speculative_base speculative_bases[%%number-of-speculative-bases] = {");
+    for (state_id i = 0; i < a->number_of_states; ++i) {
+        set_unsigned_number_substitution(out, "state-id", i);
+        output_line(out, "    { %%state-id, { 0 } },");
+    }
+    for (state_id i = 0; i < b->number_of_states; ++i) {
+        if (b->states[i].accepting)
+            continue;
+        set_unsigned_number_substitution(out, "state-id",
+         i + a->number_of_states);
+        for (uint32_t j = 0; j < number_of_entry_masks; ++j) {
+            output_string(out, "    { %%state-id, ");
+            output_reachability_mask(gen, out, &entry_masks[j]);
+            output_line(out, " },");
+        }
+    }
+    output_line(out, "};");
+    for (uint32_t i = 0; i < number_of_entry_masks; ++i)
+        bitset_destroy(&entry_masks[i]);
+    free(entry_masks);
+}
+
+// The action table is a perfect hash table built the same way as the keyword
+// hash: entries are grouped into buckets by hash, and each bucket gets a
+// displacement which moves all its entries into free slots.  Every key ends up
+// in a slot of its own, so a lookup reads one slot and compares one key.
+struct action_table_cell {
+    // These include offsets for bracket states.
+    state_id target_nfa_state;
+    state_id dfa_state;
+    state_id nfa_state;
+    symbol_id dfa_symbol;
+    // For bracket transitions; this is the state to push on the stack.
+    state_id push_nfa_state;
+    uint32_t action_index;
+    uint32_t column;
+    uint32_t hash;
+    // Set if another cell with the same target NFA state has the same key,
+    // which happens when both of their symbols are in the same token class.
+    bool duplicate;
+};
+
+// Each row of the action table is a target NFA state, and each column is a
+// DFA state and token class.  Packing both into a 64-bit key lets one
+// multiply hash it, which matters because the backward pass can't start a
+// lookup until the previous one has finished.
+static uint32_t action_table_hash(uint64_t multiplier,
+ state_id target_nfa_state, uint32_t column)
+{
+    uint64_t key = (uint64_t)target_nfa_state << 32 | column;
+    return (uint32_t)((key * multiplier) >> 32);
+}
+
+// Maps a hash onto [0, n) with a multiply instead of a division.
+static uint32_t reduce_hash(uint32_t hash, uint32_t n)
+{
+    return (uint32_t)(((uint64_t)hash * n) >> 32);
+}
+
+// The top bits of the hash pick the bucket, so the slot comes from the bottom
+// bits, which differ between keys in the same bucket.  0x9e3779b9 spreads
+// small displacements across all 32 bits.
+static uint32_t action_table_slot(uint32_t hash, uint32_t displacement,
+ uint32_t number_of_slots)
+{
+    return reduce_hash((hash << 16 | hash >> 16) ^ displacement * 0x9e3779b9u,
+     number_of_slots);
+}
+
+static uint32_t log2u(uint32_t n)
+{
+    uint32_t b = 0;
+    for (; n > 0; n >>= 1, b++);
+    return b;
+}
+
+struct bit_range {
+    uint8_t start_byte;
+    uint8_t start_bit;
+    uint8_t end_byte;
+    uint8_t end_bit;
+};
+
+// sB=0 sb=2
+// eB=2 eb=1
+// 00111111 1
+
+static struct bit_range next_bit_range(struct bit_range r, uint8_t bits)
+{
+    struct bit_range s;
+    s.start_byte = r.end_byte;
+    s.start_bit = r.end_bit;
+    if (r.end_bit == 8) {
+        s.start_byte++;
+        s.start_bit = 0;
+    }
+    uint8_t end_bit = 8 * s.start_byte + s.start_bit + bits;
+    if (end_bit == 0)
+        abort();
+    s.end_byte = (end_bit - 1) / 8;
+    s.end_bit = (end_bit + 7) % 8 + 1;
+    return s;
+}
+
+static void set_bit_range(uint8_t *bytes, struct bit_range r, uint32_t val)
+{
+    for (uint8_t i = r.start_byte; i <= r.end_byte; ++i) {
+        int32_t offset = 8 * (int32_t)(i - r.start_byte) - r.start_bit;
+        int32_t end = 8 * (int32_t)(i - r.end_byte + 1) - r.end_bit;
+        uint32_t v = offset < 0 ? val << -offset : val >> offset;
+        if (end > 0)
+            v &= 0xff >> end;
+        bytes[i] |= v;
     }
-    output_line(out, "    }");
-    output_line(out, "}");
-    output_line(out, "#endif");
-    output_line(out, "");
-    output_destroy(out);
 }
 
-static void generate_keyword(struct generator_output *out, struct token keyword,
- size_t indentation)
+static void encode_bit_range(struct generator_output *out, struct bit_range r,
+ const char *variable)
 {
-    if (keyword.length > UINT32_MAX)
-        abort();
-    set_unsigned_number_substitution(out, "token-length",
-     (uint32_t)keyword.length);
-    if (keyword.type != TOKEN_WHITESPACE) {
-        output_indentation(out, indentation);
-        if (keyword.type == TOKEN_END)
-            output_line(out, "*end_token = true;");
-        else
-            output_line(out, "*end_token = false;");
-        output_indentation(out, indentation);
-        if (keyword.type == TOKEN_START_LINE_COMMENT)
-            output_line(out, "*token = %%comment-token;");
-        else {
-            set_unsigned_number_substitution(out, "token-index",
-             keyword.symbol);
-            output_line(out, "*token = %%token-index;");
+    set_literal_substitution(out, "bits-variable", variable);
+    for (uint8_t i = r.start_byte; i <= r.end_byte; ++i) {
+        int32_t offset = 8 * (int32_t)(i - r.start_byte) - r.start_bit;
+        int32_t end = 8 * (int32_t)(i - r.end_byte + 1) - r.end_bit;
+        set_unsigned_number_substitution(out, "byte-index", i);
+        output_string(out, "    key.bytes[%%byte-index] |= ");
+        if (offset < 0) {
+            set_unsigned_number_substitution(out, "shift-amount", -offset);
+            output_string(out, "(%%bits-variable << %%shift-amount)");
+        } else {
+            set_unsigned_number_substitution(out, "shift-amount", offset);
+            output_string(out, "(%%bits-variable >> %%shift-amount)");
         }
+        uint32_t mask = 0xff;
+        if (end > 0)
+            mask >>= end;
+        set_unsigned_number_substitution(out, "mask", mask);
+        output_line(out, " & %%mask;");
     }
-    output_indentation(out, indentation);
-    output_line(out, "return %%token-length;");
 }
 
-static void generate_keyword_reader(struct generated_token *tokens,
- uint32_t number_of_tokens, struct generator_output *out) {
-    output_line(out, "    switch (text[0]) {");
-    uint32_t n = number_of_tokens;
-    size_t shared_length = 0;
-    struct generated_token *prefix = 0;
-    for (uint32_t i = 0; i < n; ++i) {
-        struct generated_token *token = &tokens[i];
-        struct token keyword = token->token;
-        struct generated_token *next = 0;
-        size_t next_length = 0;
-        if (i + 1 < n) {
-            next = &tokens[i + 1];
-            next_length = next->token.length;
+static void decode_bit_range(struct generator_output *out, struct bit_range r,
+ const char *variable)
+{
+    set_literal_substitution(out, "bits-variable", variable);
+    for (uint8_t i = r.start_byte; i <= r.end_byte; ++i) {
+        int32_t offset = 8 * (int32_t)(i - r.start_byte) - r.start_bit;
+        int32_t end = 8 * (int32_t)(i - r.end_byte + 1) - r.end_bit;
+        set_unsigned_number_substitution(out, "byte-index", i);
+        uint8_t mask = 0xff;
+        if (end > 0)
+            mask >>= end;
+        set_unsigned_number_substitution(out, "mask", mask);
+        output_string(out, "    %%bits-variable |= ((uint32_t)bytes[%%byte-index] & %%mask)");
+        if (offset < 0) {
+            set_unsigned_number_substitution(out, "shift-amount", -offset);
+            output_line(out, " >> %%shift-amount;");
+        } else {
+            set_unsigned_number_substitution(out, "shift-amount", offset);
+            output_line(out, " << %%shift-amount;");
         }
-        size_t shared = 0;
-        for (; shared < keyword.length && shared < next_length; shared++) {
-            if (keyword.string[shared] != next->token.string[shared])
-                break;
+    }
+}
+
+static void generate_action_table(struct generator *gen,
+ struct generator_output *out)
+{
+    struct deterministic_grammar *d = gen->deterministic;
+    uint32_t *split_columns = gen->split_root ?
+     find_root_split_columns(gen) : 0;
+    bool split_root = split_columns != 0;
+
+    // Entries at the start of the automaton have no DFA state or token; they
+    // go in a column after all the others.
+    uint32_t number_of_dfa_states = d->automaton.number_of_states +
+     d->bracket_automaton.number_of_states;
+    uint32_t columns_per_state = d->number_of_classes + 1;
+
+    // Collect the action map entries, marking duplicate keys.  Entries with
+    // the same target_nfa_state are next to each other in the action map.
+    uint32_t number_of_cells = d->action_map.number_of_entries +
+     d->bracket_action_map.number_of_entries;
+    struct action_table_cell *cells = calloc(number_of_cells,
+     sizeof(struct action_table_cell));
+    state_id max_nfa_state = 0;
+    for (int i = 0; i < 2; ++i) {
+        struct action_map *map = i == 0 ? &d->action_map :
+         &d->bracket_action_map;
+        uint32_t offset = i == 0 ? 0 : d->action_map.number_of_entries;
+        uint32_t nfa_state_offset = i == 0 ? 0 :
+         gen->combined->automaton.number_of_states;
+        for (uint32_t j = 0; j < map->number_of_entries;) {
+            uint32_t length = 0;
+            for (; j + length < map->number_of_entries; ++length) {
+                struct action_table_cell *b = &cells[offset + j + length];
+                struct action_map_entry e = map->entries[j + length];
+                *b = (struct action_table_cell){
+                    .target_nfa_state = e.target_nfa_state + nfa_state_offset,
+                    .dfa_state = e.dfa_state == UINT32_MAX ?
+                     number_of_dfa_states : e.dfa_state + (i==0 ? 0 :
+                     d->automaton.number_of_states),
+                    .nfa_state = e.nfa_state + nfa_state_offset,
+                    .dfa_symbol = e.dfa_symbol == UINT32_MAX ?
+                     d->number_of_classes : token_class(gen, e.dfa_symbol),
+                    .action_index = (uint32_t)(e.actions - d->actions),
+                };
+                b->column = b->dfa_state * columns_per_state + b->dfa_symbol;
+                for (uint32_t k = 0; k < length; ++k) {
+                    struct action_table_cell *other = &cells[offset + j + k];
+                    if (other->column == b->column && !other->duplicate)
+                        b->duplicate = true;
+                }
+                if (e.dfa_symbol >= gen->combined->number_of_tokens) {
+                    // This is a bracket transition.  Find the corresponding
+                    // accepting state and store it in the table.
+                    struct automaton bracket = gen->combined->bracket_automaton;
+                    for (state_id i = 0; i < bracket.number_of_states; ++i) {
+                        struct state s = bracket.states[i];
+                        if (!s.accepting || s.transition_symbol != e.nfa_symbol)
+                            continue;
+                        b->push_nfa_state = b->nfa_state;
+                        b->nfa_state = i +
+                         gen->combined->automaton.number_of_states;
+                        break;
+                    }
+                }
+                if (b->target_nfa_state > max_nfa_state)
+                    max_nfa_state = b->target_nfa_state;
+                if (b->nfa_state > max_nfa_state)
+                    max_nfa_state = b->nfa_state;
+                if (map->entries[j].target_nfa_state !=
+                 map->entries[j + length].target_nfa_state)
+                    break;
+            }
+            j += length;
         }
-        while (shared > shared_length) {
-            set_unsigned_number_substitution(out, "character",
-             keyword.string[shared_length]);
-            output_indentation(out, shared_length + 1);
-            output_line(out, "case %%character:");
-            shared_length++;
-            if (shared_length > UINT32_MAX)
-                abort();
-            set_unsigned_number_substitution(out, "index",
-             (uint32_t)shared_length);
-            output_indentation(out, shared_length + 1);
-            output_line(out, "switch (text[%%index]) {");
+    }
+
+    // Find a perfect hash for the keys, trying new multipliers until every
+    // bucket finds a displacement.  There's one slot for each unique key.
+    uint32_t table_size = 0;
+    for (uint32_t i = 0; i < number_of_cells; ++i) {
+        if (!cells[i].duplicate)
+            table_size++;
+    }
+    uint32_t number_of_buckets = (table_size + 1) / 2;
+    uint64_t *buckets = calloc(number_of_buckets, sizeof(uint64_t));
+    uint32_t *bucket_starts = calloc(number_of_buckets + 1, sizeof(uint32_t));
+    uint32_t *bucket_fill = calloc(number_of_buckets, sizeof(uint32_t));
+    uint32_t *cells_by_bucket = calloc(table_size, sizeof(uint32_t));
+    uint32_t *cell_in_slot = calloc(table_size, sizeof(uint32_t));
+    uint32_t *placed_slots = calloc(table_size, sizeof(uint32_t));
+    uint32_t *displacements = calloc(number_of_buckets, sizeof(uint32_t));
+    if (!buckets || !bucket_starts || !bucket_fill || !cells_by_bucket ||
+     !cell_in_slot || !placed_slots || !displacements) {
+        fputs("critical error: out of memory\n", stderr);
+        exit(-1);
+    }
+    // A bucket which can't find a displacement quickly probably never will;
+    // it's faster to start over with a new multiplier.  Stepping by an even
+    // number keeps the multiplier odd.
+    uint32_t max_displacement_tries = 4 * table_size + 256;
+    uint64_t multiplier = 0x9e3779b97f4a7c15;
+    uint32_t max_displacement = 0;
+    for (;; multiplier += 0xbf58476d1ce4e5b8) {
+        memset(bucket_starts, 0, (number_of_buckets + 1) * sizeof(uint32_t));
+        for (uint32_t i = 0; i < number_of_cells; ++i) {
+            struct action_table_cell *c = &cells[i];
+            c->hash = action_table_hash(multiplier, c->target_nfa_state,
+             c->column);
+            if (!c->duplicate)
+                bucket_starts[reduce_hash(c->hash, number_of_buckets) + 1]++;
         }
-        token->prefix = prefix;
-        if (shared == keyword.length) {
-            prefix = token;
-            continue;
+        for (uint32_t i = 0; i < number_of_buckets; ++i) {
+            buckets[i] = i | (uint64_t)bucket_starts[i + 1] << 32;
+            bucket_starts[i + 1] += bucket_starts[i];
         }
-        set_unsigned_number_substitution(out, "character",
-         keyword.string[shared_length]);
-        output_indentation(out, shared_length + 1);
-        output_line(out, "case %%character:");
-        if (keyword.length <= shared_length + 1)
-            generate_keyword(out, keyword, shared_length + 2);
-        else {
-            if (shared_length + 1 > UINT32_MAX)
-                abort();
-            set_unsigned_number_substitution(out, "offset",
-             (uint32_t)(shared_length + 1));
-            output_indentation(out, shared_length + 2);
-            output_string(out, "if (");
-            for (size_t j = shared_length + 1; j < keyword.length; ++j) {
-                set_unsigned_number_substitution(out, "character",
-                 keyword.string[j]);
-                set_unsigned_number_substitution(out, "index", (uint32_t)j);
-                output_string(out, "text[%%index] == %%character");
-                if (j + 1 < keyword.length)
-                    output_string(out, " && ");
-            }
-            if (keyword.length - shared_length - 1 > UINT32_MAX)
-                abort();
-            output_line(out, ") {");
-            generate_keyword(out, keyword, shared_length + 3);
-            output_indentation(out, shared_length + 2);
-            output_line(out, "} else {");
-            if (prefix)
-                generate_keyword(out, prefix->token, shared_length + 3);
-            else {
-                output_indentation(out, shared_length + 3);
-                output_line(out, "return 0;");
-            }
-            output_indentation(out, shared_length + 2);
-            output_line(out, "}");
+        memset(bucket_fill, 0, number_of_buckets * sizeof(uint32_t));
+        for (uint32_t i = 0; i < number_of_cells; ++i) {
+            if (cells[i].duplicate)
+                continue;
+            uint32_t bucket = reduce_hash(cells[i].hash, number_of_buckets);
+            cells_by_bucket[bucket_starts[bucket] + bucket_fill[bucket]++] = i;
         }
-        while (shared_length > shared) {
-            output_indentation(out, shared_length + 1);
-            output_line(out, "default:");
-            if (prefix) {
-                generate_keyword(out, prefix->token, shared_length + 2);
-                if (prefix->token.length >= shared_length)
-                    prefix = prefix->prefix;
-            } else {
-                output_indentation(out, shared_length + 2);
-                output_line(out, "return 0;");
+        // Handle the biggest buckets first, while there are lots of free slots.
+        qsort(buckets, number_of_buckets, sizeof(uint64_t),
+         compare_bucket_sizes);
+        for (uint32_t i = 0; i < table_size; ++i)
+            cell_in_slot[i] = UINT32_MAX;
+        bool found = true;
+        max_displacement = 0;
+        for (uint32_t i = 0; i < number_of_buckets && found; ++i) {
+            uint32_t bucket = (uint32_t)buckets[i];
+            uint32_t size = (uint32_t)(buckets[i] >> 32);
+            if (size == 0)
+                break;
+            uint32_t *members = &cells_by_bucket[bucket_starts[bucket]];
+            uint32_t d = 0;
+            for (; d < max_displacement_tries; ++d) {
+                uint32_t placed = 0;
+                for (; placed < size; ++placed) {
+                    uint32_t slot = action_table_slot(
+                     cells[members[placed]].hash, d, table_size);
+                    if (cell_in_slot[slot] != UINT32_MAX)
+                        break;
+                    cell_in_slot[slot] = members[placed];
+                    placed_slots[placed] = slot;
+                }
+                if (placed == size)
+                    break;
+                for (uint32_t j = 0; j < placed; ++j)
+                    cell_in_slot[placed_slots[j]] = UINT32_MAX;
             }
-            output_indentation(out, shared_length + 1);
-            output_line(out, "}");
-            shared_length--;
+            displacements[bucket] = d;
+            if (d > max_displacement)
+                max_displacement = d;
+            if (d == max_displacement_tries)
+                found = false;
+        }
+        if (found)
+            break;
+    }
+
+    // If a DFA state and token class have only one entry, the backward pass
+    // can find it without knowing the NFA state.  Store these entries' slots
+    // plus one; zero means the column needs a full lookup.
+    uint32_t number_of_columns = number_of_dfa_states * columns_per_state;
+    uint32_t *slot_for_column = calloc(number_of_columns, sizeof(uint32_t));
+    uint32_t number_of_unique_columns = 0;
+    for (uint32_t i = 0; i < table_size; ++i) {
+        uint32_t column = cells[cell_in_slot[i]].column;
+        if (column >= number_of_columns)
+            continue;
+        if (slot_for_column[column] == 0) {
+            slot_for_column[column] = i + 1;
+            number_of_unique_columns++;
+        } else if (slot_for_column[column] != UINT32_MAX) {
+            slot_for_column[column] = UINT32_MAX;
+            number_of_unique_columns--;
+        }
+    }
+    const int actions_per_line = 30;
+    output_line(out, "static const uint16_t actions[] = {");
+    for (uint32_t i = 0; i < d->number_of_actions; ++i) {
+        set_unsigned_number_substitution(out, "action", d->actions[i]);
+        output_string(out, "%%action,");
+        if ((i + 1) % actions_per_line == 0)
+            output_line(out, "");
+    }
+    output_line(out, "};");
+    uint32_t nfa_state_bits = log2u(max_nfa_state);
+    uint32_t dfa_state_bits = log2u(d->automaton.number_of_states +
+     d->bracket_automaton.number_of_states + 1);
+    uint32_t dfa_symbol_bits = log2u(d->number_of_classes + 1);
+    uint32_t action_bits = log2u(d->number_of_actions);
+    uint32_t key_bits = nfa_state_bits + dfa_state_bits + dfa_symbol_bits;
+    uint32_t key_bytes = (key_bits + 7) / 8;
+    uint32_t value_bits = nfa_state_bits * 2 + action_bits;
+    uint32_t value_bytes = (value_bits + 7) / 8;
+    struct bit_range target_nfa_state_range = next_bit_range((struct bit_range){0}, nfa_state_bits);
+    struct bit_range dfa_state_range = next_bit_range(target_nfa_state_range, dfa_state_bits);
+    struct bit_range dfa_symbol_range = next_bit_range(dfa_state_range, dfa_symbol_bits);
+    struct bit_range nfa_state_range = next_bit_range((struct bit_range){.end_byte=key_bytes}, nfa_state_bits);
+    struct bit_range action_range = next_bit_range(nfa_state_range, action_bits);
+    struct bit_range push_nfa_state_range = next_bit_range(action_range, nfa_state_bits);
+    set_unsigned_number_substitution(out, "entry-bytes", key_bytes + value_bytes);
+    set_unsigned_number_substitution(out, "table-size", table_size);
+    set_unsigned_number_substitution(out, "number-of-buckets",
+     number_of_buckets);
+    set_literal_substitution(out, "displacement-type",
+     smallest_unsigned_type(max_displacement));
+    output_line(out, "static const %%displacement-type action_table_displacements[%%number-of-buckets] = {");
+    const int numbers_per_line = 16;
+    for (uint32_t i = 0; i < number_of_buckets; ++i) {
+        set_unsigned_number_substitution(out, "displacement",
+         displacements[i]);
+        output_string(out, "%%displacement,");
+        if ((i + 1) % numbers_per_line == 0)
+            output_line(out, "");
+    }
+    output_line(out, "};");
+    if (number_of_unique_columns > 0) {
+        set_unsigned_number_substitution(out, "number-of-columns",
+         number_of_columns);
+        set_literal_substitution(out, "column-slot-type",
+         smallest_unsigned_type(table_size));
+        output_line(out, "static const %%column-slot-type action_table_slot_for_column[%%number-of-columns] = {");
+        for (uint32_t i = 0; i < number_of_columns; ++i) {
+            set_unsigned_number_substitution(out, "slot",
+             slot_for_column[i] == UINT32_MAX ? 0 : slot_for_column[i]);
+            output_string(out, "%%slot,");
+            if ((i + 1) % numbers_per_line == 0)
+                output_line(out, "");
+        }
+        output_line(out, "};");
+    }
+    output_line(out, "static const uint8_t action_table[%%table-size][%%entry-bytes] = {");
+    const int entries_per_line = 6;
+    uint8_t *bytes = malloc(key_bytes + value_bytes);
+    for (uint32_t i = 0; i < table_size; ++i) {
+        struct action_table_cell *cell = &cells[cell_in_slot[i]];
+        output_string(out, "{");
+        memset(bytes, 0, key_bytes + value_bytes);
+        set_bit_range(bytes, target_nfa_state_range, cell->target_nfa_state);
+        set_bit_range(bytes, dfa_state_range, cell->dfa_state);
+        set_bit_range(bytes, dfa_symbol_range, cell->dfa_symbol);
+        set_bit_range(bytes, nfa_state_range, cell->nfa_state);
+        set_bit_range(bytes, action_range, cell->action_index);
+        if (cell->dfa_symbol >= d->number_of_token_classes)
+            set_bit_range(bytes, push_nfa_state_range, cell->push_nfa_state);
+        for (uint32_t i = 0; i < key_bytes + value_bytes; ++i) {
+            set_unsigned_number_substitution(out, "byte", bytes[i]);
+            output_string(out, "%%byte,");
         }
+        output_string(out, "},");
+        if ((i + 1) % entries_per_line == 0)
+            output_line(out, "");
     }
-    output_line(out, "    default:");
-    output_line(out, "        return 0;");
+    free(bytes);
+    output_line(out, "};");
+    output_line(out, "");
+    set_unsigned_number_substitution(out, "key-bytes", key_bytes);
+    output_line(out, "struct action_table_key {");
+    output_line(out, "    uint8_t bytes[%%key-bytes];");
+    output_line(out, "};");
+    output_line(out, "static inline struct action_table_key encode_key(%%state-type target_nfa_state, %%state-type dfa_state, %%token-type dfa_symbol) {");
+    output_line(out, "    struct action_table_key key = {{0}};");
+    encode_bit_range(out, target_nfa_state_range, "target_nfa_state");
+    encode_bit_range(out, dfa_state_range, "dfa_state");
+    encode_bit_range(out, dfa_symbol_range, "dfa_symbol");
+    output_line(out, "    return key;");
+    output_line(out, "}");
+    output_line(out, "struct action_table_entry {");
+    output_line(out, "    %%state-type nfa_state;");
+    output_line(out, "    uint32_t actions;");
+    output_line(out, "    %%state-type push_nfa_state;");
+    output_line(out, "};");
+    output_line(out, "static struct action_table_entry decode_entry(const uint8_t *bytes) {");
+    output_line(out, "    struct action_table_entry entry = {0};");
+    decode_bit_range(out, nfa_state_range, "entry.nfa_state");
+    decode_bit_range(out, action_range, "entry.actions");
+    decode_bit_range(out, push_nfa_state_range, "entry.push_nfa_state");
+    output_line(out, "    return entry;");
+    output_line(out, "}");
+    output_line(out, "static struct action_table_entry action_table_lookup(%%state-type nfa_state, %%state-type dfa_state, %%token-type token) {");
+    set_unsigned_number_substitution(out, "columns-per-state",
+     columns_per_state);
+    set_unsigned_number_substitution(out, "multiplier-high",
+     (uint32_t)(multiplier >> 32));
+    set_unsigned_number_substitution(out, "multiplier-low",
+     (uint32_t)multiplier);
+    output_line(out, "    uint64_t packed = (uint64_t)nfa_state << 32 | (uint32_t)(dfa_state * %%columns-per-state + token);");
+    output_line(out, "    uint32_t hash = (uint32_t)((packed * ((uint64_t)%%multiplier-high << 32 | %%multiplier-low)) >> 32);");
+    output_line(out, "    uint32_t displacement = action_table_displacements[(uint64_t)hash * %%number-of-buckets >> 32];");
+    output_line(out, "    uint32_t slot = (hash << 16 | hash >> 16) ^ displacement * 0x9e3779b9u;");
+    output_line(out, "    const uint8_t *entry = action_table[(uint64_t)slot * %%table-size >> 32];");
+    output_line(out, "    struct action_table_key key = encode_key(nfa_state, dfa_state, token);");
+    output_line(out, "    if (memcmp(key.bytes, entry, sizeof(key.bytes)) != 0)");
+    output_line(out, "        abort();");
+    output_line(out, "    return decode_entry(entry);");
+    output_line(out, "}");
+    output_line(out, "static void apply_actions(struct construct_state *state, uint32_t index, size_t start, size_t end) {");
+    output_line(out, "    size_t offset = end;");
+    output_line(out, "    uint32_t i;");
+    output_line(out, "    for (i = index; actions[i]; ++i) {");
+    set_literal_substitution(out, "is-end-action", STRINGIFY(CONSTRUCT_IS_END_ACTION(actions[i])));
+    output_line(out, "        if (%%is-end-action)");
+    output_line(out, "            offset = start;");
+    output_line(out, "        construct_action_apply(state, actions[i], offset);");
     output_line(out, "    }");
-}
-
-static void generate_reachability_mask_check(struct generator *gen,
- struct generator_output *out, struct bitset *r)
-{
-    uint32_t mask_width = reachability_mask_width(gen);
-    if (mask_width == 0)
-        return;
-    // Check if any of the end states we're expecting are still
-    // reachable.
-    output_string(out, "    if (");
-    for (uint32_t i = 0; i < mask_width; ++i) {
-        if (i > 0)
-            output_string(out, " && ");
-        set_unsigned_number_substitution(out, "mask-index", i);
-        uint64_t bits = r->bit_groups[i / 2];
-        if (i % 2)
-            bits >>= 32;
-        else
-            bits &= UINT32_MAX;
-        set_unsigned_number_substitution(out, "mask-bits", (uint32_t)bits);
-        output_string(out, "!(%%mask-bits & top->reachability_mask[%%mask-index])");
+    output_line(out, "}");
+    output_line(out, "// Where the backward pass is between calls to build_tokens.");
+    output_line(out, "struct build_state {");
+    output_line(out, "    struct construct_state *construct_state;");
+    output_line(out, "    %%state-type *state_stack;");
+    output_line(out, "    size_t stack_depth;");
+    output_line(out, "    size_t stack_capacity;");
+    output_line(out, "    %%state-type nfa_state;");
+    output_line(out, "    size_t offset;");
+    output_line(out, "    size_t whitespace;");
+    output_line(out, "    struct owl_allocator *allocator;");
+    if (split_root) {
+        output_line(out, "    // How many nodes besides the root are under construction before the first");
+        output_line(out, "    // token's actions, if the tree was split there.");
+        output_line(out, "    uint32_t split_depth;");
     }
-    output_line(out, ") {");
-    output_line(out, "        top->cont->error = -1;");
-    output_line(out, "        return;");
+    output_line(out, "};");
+    if (split_root)
+        generate_split_actions(out);
+    output_line(out, "// Runs the backward pass over the tokens from `start` up to `end` in a run.");
+    output_line(out, "// Tokens after `end` are only skipped over.  If `after_split` is set, the tree");
+    output_line(out, "// was split during the last token's actions, and only the ones before the");
+    output_line(out, "// split (in input order) are applied.");
+    output_line(out, "static inline void build_tokens(struct build_state *b, struct owl_token_run *run, uint16_t start, uint16_t end, bool after_split) {");
+    if (!split_root)
+        output_line(out, "    (void)after_split;");
+    output_line(out, "    struct construct_state *construct_state = b->construct_state;");
+    output_line(out, "    %%state-type *state_stack = b->state_stack;");
+    output_line(out, "    size_t stack_depth = b->stack_depth;");
+    output_line(out, "    size_t stack_capacity = b->stack_capacity;");
+    output_line(out, "    %%state-type nfa_state = b->nfa_state;");
+    output_line(out, "    size_t offset = b->offset;");
+    output_line(out, "    size_t whitespace = b->whitespace;");
+    output_line(out, "    uint16_t length_offset = run->lengths_size - 1;");
+    // Avoid "warning: comparison of unsigned expression < 0 is always false".
+    const char *is_token = "        if (true)";
+    if (d->number_of_token_classes > 0) {
+        set_unsigned_number_substitution(out, "number-of-tokens",
+         d->number_of_token_classes);
+        is_token = "        if (run->tokens[i] < %%number-of-tokens)";
+    }
+    output_line(out, "    uint16_t i;");
+    output_line(out, "    for (i = run->number_of_tokens; i > end;) {");
+    output_line(out, "        i--;");
+    output_line(out, "        size_t token_end = offset;");
+    output_line(out, "        size_t len = 0;");
+    output_line(out, is_token);
+    output_line(out, "            len = decode_token_length(run, &length_offset, &offset);");
+    output_line(out, "        whitespace = token_end - offset - len;");
+    output_line(out, "    }");
+    output_line(out, "    while (i > start) {");
+    output_line(out, "        i--;");
+    output_line(out, "        size_t end = offset;");
+    output_line(out, "        size_t len = 0;");
+    if (number_of_unique_columns > 0) {
+        output_line(out, "        uint32_t column = run->states[i] * %%columns-per-state + run->tokens[i];");
+        output_line(out, "        struct action_table_entry entry;");
+        output_line(out, "        if (action_table_slot_for_column[column])");
+        output_line(out, "            entry = decode_entry(action_table[action_table_slot_for_column[column] - 1]);");
+        output_line(out, "        else");
+        output_line(out, "            entry = action_table_lookup(nfa_state, run->states[i], run->tokens[i]);");
+    } else
+        output_line(out, "        struct action_table_entry entry = action_table_lookup(nfa_state, run->states[i], run->tokens[i]);");
+    output_line(out, is_token);
+    output_line(out, "            len = decode_token_length(run, &length_offset, &offset);");
+    output_line(out, "        else {");
+    output_line(out, "            if (stack_depth >= stack_capacity) {");
+    output_line(out, "                size_t new_capacity = (stack_capacity + 2) * 3 / 2;");
+    output_line(out, "                if (new_capacity <= stack_capacity)");
+    output_line(out, "                    abort();");
+    output_line(out, "                %%state-type *new_stack = reallocate_memory(state_stack, stack_capacity * sizeof(%%state-type), new_capacity * sizeof(%%state-type), b->allocator);");
+    output_line(out, "                if (!new_stack)");
+    output_line(out, "                    abort();");
+    output_line(out, "                state_stack = new_stack;");
+    output_line(out, "                stack_capacity = new_capacity;");
+    output_line(out, "            }");
+    output_line(out, "            state_stack[stack_depth++] = entry.push_nfa_state;");
+    output_line(out, "        }");
+    if (split_root) {
+        output_line(out, "        if (after_split) {");
+        output_line(out, "            uint32_t split = find_split_action(entry.actions, b->split_depth);");
+        output_line(out, "            apply_split_actions(construct_state, entry.actions, split, false, end, end + whitespace);");
+        output_line(out, "            after_split = false;");
+        output_line(out, "        } else");
+        output_line(out, "            apply_actions(construct_state, entry.actions, end, end + whitespace);");
+    } else
+        output_line(out, "        apply_actions(construct_state, entry.actions, end, end + whitespace);");
+    set_unsigned_number_substitution(out, "bracket-start-state",
+     gen->deterministic->bracket_automaton.start_state +
+     gen->deterministic->automaton.number_of_states);
+    output_line(out, "        if (run->states[i] == %%bracket-start-state) {");
+    output_line(out, "            if (stack_depth == 0)");
+    output_line(out, "                abort();");
+    output_line(out, "            nfa_state = state_stack[--stack_depth];");
+    output_line(out, "        } else");
+    output_line(out, "            nfa_state = entry.nfa_state;");
+    output_line(out, "        whitespace = end - offset - len;");
     output_line(out, "    }");
+    output_line(out, "    b->state_stack = state_stack;");
+    output_line(out, "    b->stack_depth = stack_depth;");
+    output_line(out, "    b->stack_capacity = stack_capacity;");
+    output_line(out, "    b->nfa_state = nfa_state;");
+    output_line(out, "    b->offset = offset;");
+    output_line(out, "    b->whitespace = whitespace;");
+    output_line(out, "}");
+    set_unsigned_number_substitution(out, "start-dfa-state",
+     number_of_dfa_states);
+    set_unsigned_number_substitution(out, "start-token", d->number_of_classes);
+    output_line(out, "// Applies the actions before the first token.");
+    output_line(out, "static void build_first_actions(struct build_state *b) {");
+    output_line(out, "    struct action_table_entry entry = action_table_lookup(b->nfa_state, %%start-dfa-state, %%start-token);");
+    output_line(out, "    apply_actions(b->construct_state, entry.actions, b->offset, b->offset + b->whitespace);");
+    output_line(out, "}");
+    output_line(out, "static size_t finish_building(struct %%prefix_parser *parser, struct build_state *b) {");
+    output_line(out, "    parser->state_stack = b->state_stack;");
+    output_line(out, "    parser->state_stack_capacity = b->stack_capacity;");
+    output_line(out, "    return construct_finish(b->construct_state, b->offset);");
+    output_line(out, "}");
+    if (gen->combined->root_rule_is_expression)
+        set_literal_substitution(out, "root-type", "CONSTRUCT_EXPRESSION_ROOT");
+    else
+        set_literal_substitution(out, "root-type", "CONSTRUCT_NORMAL_ROOT");
+    set_unsigned_number_substitution(out, "final-nfa-state",
+     gen->combined->final_nfa_state);
+    output_line(out, "static size_t build_parse_tree(struct %%prefix_parser *parser) {");
+    output_line(out, "    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;");
+    output_line(out, "    struct build_state b = {");
+    output_line(out, "        .construct_state = &parser->construct_state,");
+    output_line(out, "        .state_stack = parser->state_stack,");
+    output_line(out, "        .stack_capacity = parser->state_stack_capacity,");
+    output_line(out, "        .nfa_state = %%final-nfa-state,");
+    output_line(out, "        .offset = tokenizer->offset - tokenizer->whitespace,");
+    output_line(out, "        .whitespace = tokenizer->whitespace,");
+    output_line(out, "        .allocator = &parser->allocator,");
+    output_line(out, "    };");
+    output_line(out, "    parser->construct_state.info = parser->tree;");
+    output_line(out, "    construct_begin(&parser->construct_state, b.offset, %%root-type);");
+    output_line(out, "    struct owl_token_run *run = parser->token_run;");
+    output_line(out, "    while (run) {");
+    output_line(out, "        build_tokens(&b, run, 0, run->number_of_tokens, false);");
+    output_line(out, "        struct owl_token_run *old = run;");
+    output_line(out, "        run = run->prev;");
+    output_line(out, "        old->prev = tokenizer->free_runs;");
+    output_line(out, "        tokenizer->free_runs = old;");
+    output_line(out, "    }");
+    output_line(out, "    parser->token_run = 0;");
+    output_line(out, "    build_first_actions(&b);");
+    output_line(out, "    return finish_building(parser, &b);");
+    output_line(out, "}");
+    if (split_root)
+        generate_parallel_build(gen, out, split_columns);
+    free(split_columns);
+    free(cells);
+    free(buckets);
+    free(bucket_starts);
+    free(bucket_fill);
+    free(cells_by_bucket);
+    free(cell_in_slot);
+    free(placed_slots);
+    free(displacements);
+    free(slot_for_column);
 }
 
-struct action_table_bucket_group {
-    uint32_t index;
-    uint32_t length;
-};
-
-struct action_table_bucket {
-    struct action_table_bucket *next;
-    // These include offsets for bracket states.
-    state_id target_nfa_state;
-    state_id dfa_state;
-    state_id nfa_state;
-    symbol_id dfa_symbol;
-    // For bracket transitions; this is the state to push on the stack.
-    state_id push_nfa_state;
-    uint32_t action_index;
-    uint32_t table_index;
-};
-
-static int compare_action_table_bucket_groups(const void *aa, const void *bb)
+// How many nodes an action leaves open, going forward through the input.
+static int action_depth_change(uint16_t action)
 {
-    const struct action_table_bucket_group *a = aa;
-    const struct action_table_bucket_group *b = bb;
-    // Reverse-sort by length.
-    if (a->length > b->length)
-        return -1;
-    if (a->length < b->length)
+    switch (CONSTRUCT_ACTION_GET_TYPE(action)) {
+    case ACTION_BEGIN_SLOT:
+    case ACTION_BEGIN_EXPRESSION_SLOT:
+    case ACTION_BEGIN_OPERAND:
+    case ACTION_BEGIN_OPERATOR:
         return 1;
-    return 0;
-}
-
-// 0xe5aa55e5 is just an arbitrary 32-bit prime number.
-#define ACTION_TABLE_ENTRY_HASH(target_nfa_state, dfa_state, dfa_symbol) \
- ((((((0xe5aa55e5 ^ (target_nfa_state)) * 0xe5aa55e5) ^ (dfa_state)) * \
- 0xe5aa55e5) ^ (dfa_symbol)) * 0xe5aa55e5)
-
-static uint32_t log2u(uint32_t n)
-{
-    uint32_t b = 0;
-    for (; n > 0; n >>= 1, b++);
-    return b;
+    case ACTION_END_SLOT:
+    case ACTION_END_EXPRESSION_SLOT:
+    case ACTION_END_OPERAND:
+    case ACTION_END_OPERATOR:
+        return -1;
+    default:
+        return 0;
+    }
 }
 
-struct bit_range {
-    uint8_t start_byte;
-    uint8_t start_bit;
-    uint8_t end_byte;
-    uint8_t end_bit;
-};
-
-// sB=0 sb=2
-// eB=2 eb=1
-// 00111111 1
-
-static struct bit_range next_bit_range(struct bit_range r, uint8_t bits)
+// Finds the columns (DFA states and token classes) where the tree can be split
+// before the token, so the backward pass can build the pieces on different
+// threads.  The backward pass always reaches the same NFA state of the root
+// automaton after a token in one of these columns, and the actions it applies
+// next can close every node but the root.  Returns an array with that NFA state
+// plus one for each column of the root automaton (or zero if the column can't
+// be split), or null if there aren't any split columns.
+static uint32_t *find_root_split_columns(struct generator *gen)
 {
-    struct bit_range s;
-    s.start_byte = r.end_byte;
-    s.start_bit = r.end_bit;
-    if (r.end_bit == 8) {
-        s.start_byte++;
-        s.start_bit = 0;
+    if (gen->combined->root_rule_is_expression)
+        return 0;
+    // Find how many nodes are open in each NFA state.  If a state can be
+    // reached with different numbers of open nodes, give up.
+    struct automaton *a = &gen->combined->automaton;
+    int32_t *depths = malloc(a->number_of_states * sizeof(int32_t));
+    state_id *queue = malloc(a->number_of_states * sizeof(state_id));
+    bool *reaches_root = calloc(a->number_of_states, sizeof(bool));
+    if (!depths || !queue || !reaches_root) {
+        fputs("critical error: out of memory\n", stderr);
+        exit(-1);
     }
-    uint8_t end_bit = 8 * s.start_byte + s.start_bit + bits;
-    if (end_bit == 0)
-        abort();
-    s.end_byte = (end_bit - 1) / 8;
-    s.end_bit = (end_bit + 7) % 8 + 1;
-    return s;
+    for (state_id i = 0; i < a->number_of_states; ++i)
+        depths[i] = INT32_MIN;
+    depths[a->start_state] = 0;
+    queue[0] = a->start_state;
+    uint32_t queue_length = 1;
+    bool consistent = true;
+    for (uint32_t i = 0; i < queue_length && consistent; ++i) {
+        struct state *state = &a->states[queue[i]];
+        for (uint32_t j = 0; j < state->number_of_transitions; ++j) {
+            struct transition t = state->transitions[j];
+            int32_t depth = depths[queue[i]] + action_depth_change(t.action);
+            if (depths[t.target] == INT32_MIN) {
+                depths[t.target] = depth;
+                queue[queue_length++] = t.target;
+            } else if (depths[t.target] != depth)
+                consistent = false;
+        }
+    }
+    free(queue);
+    if (!consistent) {
+        free(depths);
+        free(reaches_root);
+        return 0;
+    }
+    // The backward pass applies an entry's actions starting from its target
+    // NFA state, undoing each action's change to the depth.
+    struct deterministic_grammar *d = gen->deterministic;
+    for (uint32_t i = 0; i < d->action_map.number_of_entries; ++i) {
+        struct action_map_entry e = d->action_map.entries[i];
+        int32_t depth = depths[e.target_nfa_state];
+        for (uint16_t *action = e.actions; depth > 0 && action && *action;
+         ++action)
+            depth -= action_depth_change(*action);
+        if (depth == 0)
+            reaches_root[e.target_nfa_state] = true;
+    }
+    uint32_t columns_per_state = d->number_of_classes + 1;
+    uint32_t number_of_columns = d->automaton.number_of_states *
+     columns_per_state;
+    uint32_t *columns = calloc(number_of_columns, sizeof(uint32_t));
+    if (!columns) {
+        fputs("critical error: out of memory\n", stderr);
+        exit(-1);
+    }
+    for (uint32_t i = 0; i < d->action_map.number_of_entries; ++i) {
+        struct action_map_entry e = d->action_map.entries[i];
+        if (e.dfa_state == UINT32_MAX || e.dfa_symbol == UINT32_MAX ||
+         e.dfa_symbol >= gen->combined->number_of_tokens)
+            continue;
+        uint32_t column = e.dfa_state * columns_per_state +
+         token_class(gen, e.dfa_symbol);
+        uint32_t value = reaches_root[e.nfa_state] ? e.nfa_state + 1 :
+         UINT32_MAX;
+        if (columns[column] == 0)
+            columns[column] = value;
+        else if (columns[column] != value)
+            columns[column] = UINT32_MAX;
+    }
+    bool found = false;
+    for (uint32_t i = 0; i < number_of_columns; ++i) {
+        if (columns[i] == UINT32_MAX)
+            columns[i] = 0;
+        if (columns[i] != 0)
+            found = true;
+    }
+    // Store the depths after the NFA states, for generate_parallel_build.
+    if (found) {
+        columns = realloc(columns, (number_of_columns +
+         a->number_of_states) * sizeof(uint32_t));
+        if (!columns) {
+            fputs("critical error: out of memory\n", stderr);
+            exit(-1);
+        }
+        for (state_id i = 0; i < a->number_of_states; ++i)
+            columns[number_of_columns + i] = (uint32_t)depths[i];
+    } else {
+        free(columns);
+        columns = 0;
+    }
+    free(depths);
+    free(reaches_root);
+    return columns;
 }
 
-static void set_bit_range(uint8_t *bytes, struct bit_range r, uint32_t val)
+static void generate_split_actions(struct generator_output *out)
 {
-    for (uint8_t i = r.start_byte; i <= r.end_byte; ++i) {
-        int32_t offset = 8 * (int32_t)(i - r.start_byte) - r.start_bit;
-        int32_t end = 8 * (int32_t)(i - r.end_byte + 1) - r.end_bit;
-        uint32_t v = offset < 0 ? val << -offset : val >> offset;
-        if (end > 0)
-            v &= 0xff >> end;
-        bytes[i] |= v;
+    set_literal_substitution(out, "action-type",
+     STRINGIFY(CONSTRUCT_ACTION_GET_TYPE(actions[i])));
+    output_line(out, "// Finds where the actions in a list leave nothing but the root under");
+    output_line(out, "// construction, given how many other nodes are under construction before the");
+    output_line(out, "// first one.  Returns UINT32_MAX if that never happens.");
+    output_line(out, "static uint32_t find_split_action(uint32_t index, uint32_t depth) {");
+    output_line(out, "    uint32_t i = index;");
+    output_line(out, "    for (; depth > 0 && actions[i]; ++i) {");
+    output_line(out, "        switch (%%action-type) {");
+    uint32_t closing_actions[] = { ACTION_BEGIN_SLOT,
+     ACTION_BEGIN_EXPRESSION_SLOT, ACTION_BEGIN_OPERAND,
+     ACTION_BEGIN_OPERATOR };
+    uint32_t opening_actions[] = { ACTION_END_SLOT,
+     ACTION_END_EXPRESSION_SLOT, ACTION_END_OPERAND, ACTION_END_OPERATOR };
+    for (int i = 0; i < 4; ++i) {
+        set_unsigned_number_substitution(out, "action", closing_actions[i]);
+        output_line(out, "        case %%action:");
     }
+    output_line(out, "            depth--;");
+    output_line(out, "            break;");
+    for (int i = 0; i < 4; ++i) {
+        set_unsigned_number_substitution(out, "action", opening_actions[i]);
+        output_line(out, "        case %%action:");
+    }
+    output_line(out, "            depth++;");
+    output_line(out, "            break;");
+    output_line(out, "        default:");
+    output_line(out, "            break;");
+    output_line(out, "        }");
+    output_line(out, "    }");
+    output_line(out, "    return depth == 0 ? i : UINT32_MAX;");
+    output_line(out, "}");
+    output_line(out, "// Applies the actions on one side of a split: the ones before index `split` if");
+    output_line(out, "// `before` is set, or the rest otherwise.");
+    output_line(out, "static void apply_split_actions(struct construct_state *state, uint32_t index, uint32_t split, bool before, size_t start, size_t end) {");
+    output_line(out, "    size_t offset = end;");
+    output_line(out, "    for (uint32_t i = index; actions[i]; ++i) {");
+    output_line(out, "        if (%%is-end-action)");
+    output_line(out, "            offset = start;");
+    output_line(out, "        if ((i < split) == before)");
+    output_line(out, "            construct_action_apply(state, actions[i], offset);");
+    output_line(out, "    }");
+    output_line(out, "}");
 }
 
-static void encode_bit_range(struct generator_output *out, struct bit_range r,
- const char *variable)
+static void generate_parallel_build(struct generator *gen,
+ struct generator_output *out, uint32_t *split_columns)
 {
-    set_literal_substitution(out, "bits-variable", variable);
-    for (uint8_t i = r.start_byte; i <= r.end_byte; ++i) {
-        int32_t offset = 8 * (int32_t)(i - r.start_byte) - r.start_bit;
-        int32_t end = 8 * (int32_t)(i - r.end_byte + 1) - r.end_bit;
-        set_unsigned_number_substitution(out, "byte-index", i);
-        output_string(out, "    key.bytes[%%byte-index] |= ");
-        if (offset < 0) {
-            set_unsigned_number_substitution(out, "shift-amount", -offset);
-            output_string(out, "(%%bits-variable << %%shift-amount)");
-        } else {
-            set_unsigned_number_substitution(out, "shift-amount", offset);
-            output_string(out, "(%%bits-variable >> %%shift-amount)");
+    struct deterministic_grammar *d = gen->deterministic;
+    uint32_t number_of_columns = d->automaton.number_of_states *
+     (d->number_of_classes + 1);
+    uint32_t *depths = split_columns + number_of_columns;
+    output_line(out, "#ifdef OWL_THREADS");
+    output_line(out, "// Where the tree can be split before a token: the NFA state the backward pass");
+    output_line(out, "// reaches after the token, and how many nodes besides the root are under");
+    output_line(out, "// construction there.");
+    output_line(out, "static bool root_split_state(uint32_t column, %%state-type *nfa_state, uint32_t *depth) {");
+    output_line(out, "    switch (column) {");
+    for (uint32_t i = 0; i < number_of_columns; ++i) {
+        uint32_t value = split_columns[i];
+        if (value == 0)
+            continue;
+        for (uint32_t j = i; j < number_of_columns; ++j) {
+            if (split_columns[j] != value)
+                continue;
+            set_unsigned_number_substitution(out, "column", j);
+            output_line(out, "    case %%column:");
+            split_columns[j] = 0;
         }
-        uint32_t mask = 0xff;
-        if (end > 0)
-            mask >>= end;
-        set_unsigned_number_substitution(out, "mask", mask);
-        output_line(out, " & %%mask;");
+        set_unsigned_number_substitution(out, "nfa-state", value - 1);
+        set_unsigned_number_substitution(out, "depth", depths[value - 1]);
+        output_line(out, "        *nfa_state = %%nfa-state;");
+        output_line(out, "        *depth = %%depth;");
+        output_line(out, "        return true;");
     }
+    output_line(out, "    default:");
+    output_line(out, "        return false;");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "// Positions count tokens as if every run were full.");
+    output_line(out, "struct root_split {");
+    output_line(out, "    size_t position;");
+    output_line(out, "    // The position of the token before the split.");
+    output_line(out, "    size_t previous;");
+    output_line(out, "    %%state-type nfa_state;");
+    output_line(out, "    uint32_t depth;");
+    output_line(out, "};");
+    output_line(out, "// Looks for a token between two positions where the tree can be split.  The");
+    output_line(out, "// actions between it and the token before it have to close every node but the");
+    output_line(out, "// root at some point.");
+    output_line(out, "static bool find_root_split(struct owl_token_run **runs, size_t start, size_t end, struct root_split *split) {");
+    output_line(out, "    size_t previous = SIZE_MAX;");
+    output_line(out, "    size_t position = start;");
+    output_line(out, "    while (position < end) {");
+    output_line(out, "        struct owl_token_run *run = runs[position / %%token-run-length];");
+    output_line(out, "        uint16_t i = position % %%token-run-length;");
+    output_line(out, "        if (i >= run->number_of_tokens) {");
+    output_line(out, "            position += %%token-run-length - i;");
+    output_line(out, "            continue;");
+    output_line(out, "        }");
+    output_line(out, "        if (previous != SIZE_MAX && root_split_state(run->states[i] * %%columns-per-state + run->tokens[i], &split->nfa_state, &split->depth)) {");
+    output_line(out, "            struct owl_token_run *previous_run = runs[previous / %%token-run-length];");
+    output_line(out, "            uint16_t j = previous % %%token-run-length;");
+    output_line(out, "            struct action_table_entry entry = action_table_lookup(split->nfa_state, previous_run->states[j], previous_run->tokens[j]);");
+    output_line(out, "            if (find_split_action(entry.actions, split->depth) != UINT32_MAX) {");
+    output_line(out, "                split->position = position;");
+    output_line(out, "                split->previous = previous;");
+    output_line(out, "                return true;");
+    output_line(out, "            }");
+    output_line(out, "        }");
+    output_line(out, "        previous = position;");
+    output_line(out, "        position++;");
+    output_line(out, "    }");
+    output_line(out, "    return false;");
+    output_line(out, "}");
+    output_line(out, "// Runs the backward pass over the tokens between two positions.");
+    output_line(out, "static void build_positions(struct build_state *b, struct owl_token_run **runs, size_t start, size_t end, bool after_split) {");
+    output_line(out, "    size_t first_run = start / %%token-run-length;");
+    output_line(out, "    size_t last_run = (end - 1) / %%token-run-length;");
+    output_line(out, "    for (size_t i = last_run + 1; i > first_run; --i) {");
+    output_line(out, "        struct owl_token_run *run = runs[i - 1];");
+    output_line(out, "        uint16_t run_start = i - 1 == first_run ? start % %%token-run-length : 0;");
+    output_line(out, "        uint16_t run_end = i - 1 == last_run ? (end - 1) % %%token-run-length + 1 : run->number_of_tokens;");
+    output_line(out, "        build_tokens(b, run, run_start, run_end, after_split && i - 1 == last_run);");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "// Applies the actions between a split and the token after it, finishing the");
+    output_line(out, "// nodes under construction there.");
+    output_line(out, "static void build_to_split(struct build_state *b, struct owl_token_run **runs, struct root_split *split) {");
+    output_line(out, "    struct owl_token_run *run = runs[split->previous / %%token-run-length];");
+    output_line(out, "    uint16_t i = split->previous % %%token-run-length;");
+    output_line(out, "    struct action_table_entry entry = action_table_lookup(b->nfa_state, run->states[i], run->tokens[i]);");
+    output_line(out, "    uint32_t split_action = find_split_action(entry.actions, split->depth);");
+    output_line(out, "    apply_split_actions(b->construct_state, entry.actions, split_action, true, b->offset, b->offset + b->whitespace);");
+    output_line(out, "}");
+    output_line(out, "// The input between two splits, built on a worker thread.  The worker's root");
+    output_line(out, "// node stands in for the real one: its slots start out as SIZE_MAX minus their");
+    output_line(out, "// index, meaning whatever the real root's slot holds once the input after the");
+    output_line(out, "// segment is in the tree.");
+    output_line(out, "struct built_segment {");
+    output_line(out, "    struct owl_token_run **runs;");
+    output_line(out, "    // The first segment doesn't start at a split.");
+    output_line(out, "    struct root_split *start;");
+    output_line(out, "    struct root_split *end;");
+    output_line(out, "    struct build_state build;");
+    output_line(out, "    struct construct_state construct_state;");
+    output_line(out, "    struct %%prefix_tree tree;");
+    output_line(out, "    struct node_log log;");
+    output_line(out, "    pthread_t thread;");
+    output_line(out, "    bool started;");
+    output_line(out, "};");
+    output_line(out, "static void *build_segment(void *data) {");
+    output_line(out, "    struct built_segment *segment = data;");
+    output_line(out, "    struct build_state *b = &segment->build;");
+    output_line(out, "    construct_begin(&segment->construct_state, b->offset, CONSTRUCT_NORMAL_ROOT);");
+    output_line(out, "    struct construct_node *root = segment->construct_state.under_construction;");
+    output_line(out, "    for (size_t i = 0; i < root->number_of_slots; ++i)");
+    output_line(out, "        root->slots[i] = SIZE_MAX - i;");
+    output_line(out, "    root->choice_index = UINT16_MAX;");
+    output_line(out, "    size_t start = segment->start ? segment->start->position : 0;");
+    output_line(out, "    build_positions(b, segment->runs, start, segment->end->previous + 1, true);");
+    output_line(out, "    if (segment->start)");
+    output_line(out, "        build_to_split(b, segment->runs, segment->start);");
+    output_line(out, "    else");
+    output_line(out, "        build_first_actions(b);");
+    output_line(out, "    return 0;");
+    output_line(out, "}");
+    output_line(out, "// Turns a logged node's number (or a stand-in for one of the root's slots)");
+    output_line(out, "// into an offset in the tree.");
+    output_line(out, "static size_t replayed_offset(struct node_log *log, struct construct_node *root, size_t node) {");
+    output_line(out, "    if (node == 0)");
+    output_line(out, "        return 0;");
+    output_line(out, "    if (node > log->number_of_nodes)");
+    output_line(out, "        return root->slots[SIZE_MAX - node];");
+    output_line(out, "    return log->nodes[node - 1].next_sibling;");
+    output_line(out, "}");
+    output_line(out, "// Writes the nodes from a worker's log into the tree, making the same calls in");
+    output_line(out, "// the same order as building on one thread would, then adds what the worker");
+    output_line(out, "// put in its root's slots to the real root.");
+    output_line(out, "static void replay_node_log(struct %%prefix_tree *tree, struct node_log *log, struct construct_node *worker_root, struct construct_node *root) {");
+    output_line(out, "    size_t slots[%%max-slots];");
+    output_line(out, "    size_t first_slot = 0;");
+    output_line(out, "    for (size_t i = 0; i < log->number_of_nodes; ++i) {");
+    output_line(out, "        struct logged_node *node = &log->nodes[i];");
+    output_line(out, "        size_t next_sibling = replayed_offset(log, root, node->next_sibling);");
+    output_line(out, "        if (node->choice == UINT32_MAX) {");
+    output_line(out, "            node->next_sibling = finish_token(node->rule, next_sibling, tree);");
+    output_line(out, "            continue;");
+    output_line(out, "        }");
+    output_line(out, "        size_t number_of_slots = number_of_slots_lookup(node->rule, tree);");
+    output_line(out, "        for (size_t j = 0; j < number_of_slots; ++j)");
+    output_line(out, "            slots[j] = replayed_offset(log, root, log->slots[first_slot + j]);");
+    output_line(out, "        first_slot += number_of_slots;");
+    output_line(out, "        node->next_sibling = finish_node(node->rule, node->choice, next_sibling, slots, node->start_location, node->end_location, tree);");
+    output_line(out, "    }");
+    output_line(out, "    for (size_t i = 0; i < root->number_of_slots; ++i) {");
+    output_line(out, "        if (worker_root->slots[i] != SIZE_MAX - i)");
+    output_line(out, "            root->slots[i] = replayed_offset(log, root, worker_root->slots[i]);");
+    output_line(out, "    }");
+    output_line(out, "    if (worker_root->choice_index != UINT16_MAX)");
+    output_line(out, "        root->choice_index = worker_root->choice_index;");
+    output_line(out, "}");
+    output_line(out, "// Splits the input into about as many segments as there are threads, building");
+    output_line(out, "// the last one on this thread and the others on workers.  The workers log the");
+    output_line(out, "// nodes they finish, which are written into the tree in order afterward, so the");
+    output_line(out, "// tree comes out the same as if it had been built on one thread.");
+    output_line(out, "static size_t build_parse_tree_in_parallel(struct %%prefix_parser *parser) {");
+    output_line(out, "    size_t number_of_runs = parser->number_of_runs;");
+    output_line(out, "    size_t number_of_segments = number_of_runs / OWL_THREAD_MIN_RUNS;");
+    output_line(out, "    if (number_of_segments > parser->threads)");
+    output_line(out, "        number_of_segments = parser->threads;");
+    output_line(out, "    if (number_of_segments < 2)");
+    output_line(out, "        return build_parse_tree(parser);");
+    output_line(out, "    struct owl_token_run **runs = allocate_memory(number_of_runs * sizeof(struct owl_token_run *), &parser->allocator);");
+    output_line(out, "    struct root_split *splits = allocate_memory(number_of_segments * sizeof(struct root_split), &parser->allocator);");
+    output_line(out, "    struct built_segment *segments = allocate_memory(number_of_segments * sizeof(struct built_segment), &parser->allocator);");
+    output_line(out, "    if (!runs || !splits || !segments)");
+    output_line(out, "        abort();");
+    output_line(out, "    struct owl_token_run *run = parser->token_run;");
+    output_line(out, "    for (size_t i = number_of_runs; i > 0; --i) {");
+    output_line(out, "        runs[i - 1] = run;");
+    output_line(out, "        run = run->prev;");
+    output_line(out, "    }");
+    output_line(out, "    size_t number_of_splits = 0;");
+    output_line(out, "    for (size_t i = 1; i < number_of_segments; ++i) {");
+    output_line(out, "        size_t from = number_of_runs * i / number_of_segments * %%token-run-length;");
+    output_line(out, "        size_t to = number_of_runs * (i + 1) / number_of_segments * %%token-run-length;");
+    output_line(out, "        if (find_root_split(runs, from, to, &splits[number_of_splits]))");
+    output_line(out, "            number_of_splits++;");
+    output_line(out, "    }");
+    output_line(out, "    for (size_t i = 0; i < number_of_splits; ++i) {");
+    output_line(out, "        struct root_split *end = &splits[i];");
+    output_line(out, "        // The worker starts from where the tokenizer was after the run with the");
+    output_line(out, "        // token before the split.");
+    output_line(out, "        struct run_end run_end = parser->run_ends[end->previous / %%token-run-length];");
+    output_line(out, "        struct built_segment *segment = &segments[i];");
+    output_line(out, "        *segment = (struct built_segment){");
+    output_line(out, "            .runs = runs,");
+    output_line(out, "            .start = i > 0 ? &splits[i - 1] : 0,");
+    output_line(out, "            .end = end,");
+    output_line(out, "            .build = {");
+    output_line(out, "                .construct_state = &segment->construct_state,");
+    output_line(out, "                .nfa_state = end->nfa_state,");
+    output_line(out, "                .offset = run_end.offset - run_end.whitespace,");
+    output_line(out, "                .whitespace = run_end.whitespace,");
+    output_line(out, "                .allocator = &parser->allocator,");
+    output_line(out, "                .split_depth = end->depth,");
+    output_line(out, "            },");
+    output_line(out, "            .construct_state = {");
+    output_line(out, "                .info = &segment->tree,");
+    output_line(out, "                .allocator = &parser->allocator,");
+    output_line(out, "            },");
+    output_line(out, "            .tree = *parser->tree,");
+    output_line(out, "            .log.allocator = &parser->allocator,");
+    output_line(out, "        };");
+    output_line(out, "        segment->tree.node_log = &segment->log;");
+    output_line(out, "        segment->started = pthread_create(&segment->thread, 0, build_segment, segment) == 0;");
+    output_line(out, "    }");
+    output_line(out, "    struct owl_default_tokenizer *tokenizer = &parser->tokenizer;");
+    output_line(out, "    struct build_state b = {");
+    output_line(out, "        .construct_state = &parser->construct_state,");
+    output_line(out, "        .state_stack = parser->state_stack,");
+    output_line(out, "        .stack_capacity = parser->state_stack_capacity,");
+    output_line(out, "        .nfa_state = %%final-nfa-state,");
+    output_line(out, "        .offset = tokenizer->offset - tokenizer->whitespace,");
+    output_line(out, "        .whitespace = tokenizer->whitespace,");
+    output_line(out, "        .allocator = &parser->allocator,");
+    output_line(out, "    };");
+    output_line(out, "    parser->construct_state.info = parser->tree;");
+    output_line(out, "    construct_begin(&parser->construct_state, b.offset, CONSTRUCT_NORMAL_ROOT);");
+    output_line(out, "    struct construct_node *root = parser->construct_state.under_construction;");
+    output_line(out, "    size_t start = number_of_splits > 0 ? splits[number_of_splits - 1].position : 0;");
+    output_line(out, "    build_positions(&b, runs, start, number_of_runs * %%token-run-length, false);");
+    output_line(out, "    if (number_of_splits > 0)");
+    output_line(out, "        build_to_split(&b, runs, &splits[number_of_splits - 1]);");
+    output_line(out, "    else");
+    output_line(out, "        build_first_actions(&b);");
+    output_line(out, "    for (size_t i = number_of_splits; i > 0; --i) {");
+    output_line(out, "        struct built_segment *segment = &segments[i - 1];");
+    output_line(out, "        if (segment->started)");
+    output_line(out, "            pthread_join(segment->thread, 0);");
+    output_line(out, "        else");
+    output_line(out, "            build_segment(segment);");
+    output_line(out, "        struct construct_node *worker_root = segment->construct_state.under_construction;");
+    output_line(out, "        replay_node_log(parser->tree, &segment->log, worker_root, root);");
+    output_line(out, "        b.nfa_state = segment->build.nfa_state;");
+    output_line(out, "        b.offset = segment->build.offset;");
+    output_line(out, "        b.whitespace = segment->build.whitespace;");
+    output_line(out, "        construct_node_free(&segment->construct_state, worker_root);");
+    output_line(out, "        construct_free_pools(&segment->construct_state);");
+    output_line(out, "        free_node_log(&segment->log);");
+    output_line(out, "        free_memory(segment->build.state_stack, segment->build.stack_capacity * sizeof(%%state-type), &parser->allocator);");
+    output_line(out, "    }");
+    output_line(out, "    recycle_token_runs(parser);");
+    output_line(out, "    free_memory(segments, number_of_segments * sizeof(struct built_segment), &parser->allocator);");
+    output_line(out, "    free_memory(splits, number_of_segments * sizeof(struct root_split), &parser->allocator);");
+    output_line(out, "    free_memory(runs, number_of_runs * sizeof(struct owl_token_run *), &parser->allocator);");
+    output_line(out, "    return finish_building(parser, &b);");
+    output_line(out, "}");
+    output_line(out, "#endif");
 }
 
-static void decode_bit_range(struct generator_output *out, struct bit_range r,
- const char *variable)
+static void generate_vector_scanner(struct generator *gen,
+ struct generator_output *out)
 {
-    set_literal_substitution(out, "bits-variable", variable);
-    for (uint8_t i = r.start_byte; i <= r.end_byte; ++i) {
-        int32_t offset = 8 * (int32_t)(i - r.start_byte) - r.start_bit;
-        int32_t end = 8 * (int32_t)(i - r.end_byte + 1) - r.end_bit;
-        set_unsigned_number_substitution(out, "byte-index", i);
-        uint8_t mask = 0xff;
-        if (end > 0)
-            mask >>= end;
-        set_unsigned_number_substitution(out, "mask", mask);
-        output_string(out, "    %%bits-variable |= ((uint32_t)bytes[%%byte-index] & %%mask)");
-        if (offset < 0) {
-            set_unsigned_number_substitution(out, "shift-amount", -offset);
-            output_line(out, " >> %%shift-amount;");
-        } else {
-            set_unsigned_number_substitution(out, "shift-amount", offset);
-            output_line(out, " << %%shift-amount;");
+    output_line(out, "// Vectorized scanners for the tokenizer.  These load whole aligned blocks,");
+    output_line(out, "// which can include bytes past the end of the input.  Aligned loads never");
+    output_line(out, "// cross a page boundary, so this is safe, but it upsets memory checkers like");
+    output_line(out, "// AddressSanitizer.  Define OWL_NO_SIMD to use the scalar loops instead.");
+    output_line(out, "#if !defined(OWL_NO_SIMD) && defined(__SANITIZE_ADDRESS__)");
+    output_line(out, "#define OWL_NO_SIMD");
+    output_line(out, "#endif");
+    output_line(out, "#if !defined(OWL_NO_SIMD) && defined(__has_feature)");
+    output_line(out, "#if __has_feature(address_sanitizer)");
+    output_line(out, "#define OWL_NO_SIMD");
+    output_line(out, "#endif");
+    output_line(out, "#endif");
+    output_line(out, "#if !defined(OWL_NO_SIMD) && defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))");
+    output_line(out, "#define OWL_SIMD");
+    output_line(out, "enum vector_scan_class {");
+    output_line(out, "    VECTOR_SCAN_IDENTIFIER,");
+    output_line(out, "    VECTOR_SCAN_IDENTIFIER_WITH_DASHES,");
+    output_line(out, "    VECTOR_SCAN_DIGITS,");
+    output_line(out, "    VECTOR_SCAN_HEX_DIGITS,");
+    output_line(out, "    VECTOR_SCAN_WHITESPACE,");
+    output_line(out, "    VECTOR_SCAN_STRING,");
+    output_line(out, "    VECTOR_SCAN_LINE,");
+    output_line(out, "};");
+    // The SSE2 and AVX2 scanners are identical apart from the vector width.
+    // They use vector extensions rather than intrinsics so the generated code
+    // doesn't have to include <immintrin.h>, which is slow to compile.
+    for (int avx2 = 0; avx2 <= 1; ++avx2) {
+        if (avx2) {
+            set_literal_substitution(out, "vector-isa", "avx2");
+            set_literal_substitution(out, "vector-target",
+             "__attribute__((target(\"avx2\"))) ");
+            set_literal_substitution(out, "vector-movemask",
+             "__builtin_ia32_pmovmskb256");
+            set_literal_substitution(out, "vector-mask", "0xffffffffu");
+            set_unsigned_number_substitution(out, "vector-width", 32);
+        } else {
+            set_literal_substitution(out, "vector-isa", "sse2");
+            set_literal_substitution(out, "vector-target", "");
+            set_literal_substitution(out, "vector-movemask",
+             "__builtin_ia32_pmovmskb128");
+            set_literal_substitution(out, "vector-mask", "0xffffu");
+            set_unsigned_number_substitution(out, "vector-width", 16);
+        }
+        output_line(out, "typedef unsigned char vector_bytes_%%vector-isa __attribute__((vector_size(%%vector-width), may_alias));");
+        output_line(out, "typedef char vector_mask_%%vector-isa __attribute__((vector_size(%%vector-width)));");
+        output_line(out, "static inline %%vector-target vector_mask_%%vector-isa vector_equal_%%vector-isa(vector_bytes_%%vector-isa x, unsigned char c) {");
+        output_line(out, "    return (vector_mask_%%vector-isa)(x == c);");
+        output_line(out, "}");
+        output_line(out, "static inline %%vector-target vector_mask_%%vector-isa vector_in_range_%%vector-isa(vector_bytes_%%vector-isa x, unsigned char low, unsigned char high) {");
+        output_line(out, "    return (vector_mask_%%vector-isa)(x - low <= (unsigned char)(high - low));");
+        output_line(out, "}");
+        output_line(out, "static inline %%vector-target uint32_t vector_stop_mask_%%vector-isa(vector_bytes_%%vector-isa x, enum vector_scan_class kind, char quote) {");
+        output_line(out, "    vector_mask_%%vector-isa keep = {0};");
+        output_line(out, "    vector_bytes_%%vector-isa lowercase = x | 0x20;");
+        output_line(out, "    switch (kind) {");
+        output_line(out, "    case VECTOR_SCAN_IDENTIFIER_WITH_DASHES:");
+        output_line(out, "        keep = vector_equal_%%vector-isa(x, '-');");
+        output_line(out, "        // Fall through.");
+        output_line(out, "    case VECTOR_SCAN_IDENTIFIER:");
+        output_line(out, "        keep |= vector_equal_%%vector-isa(x, '_') | vector_in_range_%%vector-isa(lowercase, 'a', 'z') | vector_in_range_%%vector-isa(x, '0', '9');");
+        output_line(out, "        break;");
+        output_line(out, "    case VECTOR_SCAN_HEX_DIGITS:");
+        output_line(out, "        keep = vector_in_range_%%vector-isa(lowercase, 'a', 'f');");
+        output_line(out, "        // Fall through.");
+        output_line(out, "    case VECTOR_SCAN_DIGITS:");
+        output_line(out, "        keep |= vector_in_range_%%vector-isa(x, '0', '9');");
+        output_line(out, "        break;");
+        output_line(out, "    case VECTOR_SCAN_WHITESPACE:");
+        for (uint32_t i = 0; i < gen->grammar->number_of_whitespace_tokens; ++i) {
+            struct token token = gen->grammar->whitespace_tokens[i];
+            if (token.length != 1)
+                continue;
+            set_unsigned_number_substitution(out, "character",
+             (unsigned char)token.string[0]);
+            output_line(out, "        keep |= vector_equal_%%vector-isa(x, %%character);");
         }
+        output_line(out, "        break;");
+        output_line(out, "    case VECTOR_SCAN_STRING:");
+        output_line(out, "        keep = vector_equal_%%vector-isa(x, (unsigned char)quote) | vector_equal_%%vector-isa(x, '\\\\') | vector_equal_%%vector-isa(x, 0);");
+        output_line(out, "        return (uint32_t)%%vector-movemask(keep);");
+        output_line(out, "    case VECTOR_SCAN_LINE:");
+        output_line(out, "        keep = vector_equal_%%vector-isa(x, '\\n') | vector_equal_%%vector-isa(x, 0);");
+        output_line(out, "        return (uint32_t)%%vector-movemask(keep);");
+        output_line(out, "    }");
+        output_line(out, "    // Zero bytes never belong to a run.");
+        output_line(out, "    return ~(uint32_t)%%vector-movemask(keep) & %%vector-mask;");
+        output_line(out, "}");
+        output_line(out, "// Here, `offset` must be less than `end`.  Aligned blocks which contain at");
+        output_line(out, "// least one byte of the text can't cross into an unmapped page.");
+        output_line(out, "static inline %%vector-target size_t vector_scan_%%vector-isa(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {");
+        output_line(out, "    const char *start = text + offset;");
+        output_line(out, "    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)(%%vector-width - 1));");
+        output_line(out, "    uint32_t stop = vector_stop_mask_%%vector-isa(*(const vector_bytes_%%vector-isa *)block, kind, quote) & (%%vector-mask << (start - block));");
+        output_line(out, "    while (!stop) {");
+        output_line(out, "        block += %%vector-width;");
+        output_line(out, "        if (block >= text + end)");
+        output_line(out, "            return end;");
+        output_line(out, "        stop = vector_stop_mask_%%vector-isa(*(const vector_bytes_%%vector-isa *)block, kind, quote);");
+        output_line(out, "    }");
+        output_line(out, "    size_t stop_offset = (size_t)(block - text) + (size_t)__builtin_ctz(stop);");
+        output_line(out, "    return stop_offset < end ? stop_offset : end;");
+        output_line(out, "}");
     }
+    output_line(out, "static inline size_t vector_scan(const char *text, size_t offset, size_t end, enum vector_scan_class kind, char quote) {");
+    output_line(out, "    if (offset >= end)");
+    output_line(out, "        return end;");
+    output_line(out, "#ifdef __AVX2__");
+    output_line(out, "    return vector_scan_avx2(text, offset, end, kind, quote);");
+    output_line(out, "#else");
+    output_line(out, "    // Most runs end within the first block, so only dispatch to AVX2 for the");
+    output_line(out, "    // rest of a longer run.");
+    output_line(out, "    const char *start = text + offset;");
+    output_line(out, "    const char *block = (const char *)((uintptr_t)start & ~(uintptr_t)15);");
+    output_line(out, "    uint32_t stop = vector_stop_mask_sse2(*(const vector_bytes_sse2 *)block, kind, quote) & (0xffffu << (start - block));");
+    output_line(out, "    offset = (size_t)(block - text) + (stop ? (size_t)__builtin_ctz(stop) : 16);");
+    output_line(out, "    if (stop || offset >= end)");
+    output_line(out, "        return offset < end ? offset : end;");
+    output_line(out, "    if (__builtin_cpu_supports(\"avx2\"))");
+    output_line(out, "        return vector_scan_avx2(text, offset, end, kind, quote);");
+    output_line(out, "    return vector_scan_sse2(text, offset, end, kind, quote);");
+    output_line(out, "#endif");
+    output_line(out, "}");
+    if (SHOULD_ALLOW_DASHES_IN_IDENTIFIERS(gen->combined))
+        output_line(out, "#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) vector_scan(text, offset, end, VECTOR_SCAN_IDENTIFIER_WITH_DASHES, 0)");
+    else
+        output_line(out, "#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) vector_scan(text, offset, end, VECTOR_SCAN_IDENTIFIER, 0)");
+    output_line(out, "#define SKIP_DIGITS(text, offset, end, hexadecimal) vector_scan(text, offset, end, (hexadecimal) ? VECTOR_SCAN_HEX_DIGITS : VECTOR_SCAN_DIGITS, 0)");
+    output_line(out, "#define SKIP_STRING_CHARS(text, offset, end, quote) vector_scan(text, offset, end, VECTOR_SCAN_STRING, quote)");
+    output_line(out, "#define SKIP_LINE(text, offset, end) vector_scan(text, offset, end, VECTOR_SCAN_LINE, 0)");
+    output_line(out, "#else");
+    output_line(out, "#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) (offset)");
+    output_line(out, "#define SKIP_DIGITS(text, offset, end, hexadecimal) (offset)");
+    output_line(out, "#define SKIP_STRING_CHARS(text, offset, end, quote) (offset)");
+    output_line(out, "#define SKIP_LINE(text, offset, end) (offset)");
+    output_line(out, "#endif");
 }
 
-static void generate_action_table(struct generator *gen,
+static void generate_tree_compaction(struct generator *gen,
  struct generator_output *out)
 {
-    struct deterministic_grammar *d = gen->deterministic;
-
-    // Collect all the "groups" of action map entries with the same
-    // target_nfa_state.  Sort the groups by size, longest to shortest.
-    struct action_table_bucket *buckets =
-     calloc(d->action_map.number_of_entries +
-     d->bracket_action_map.number_of_entries,
-     sizeof(struct action_table_bucket));
-    struct action_table_bucket_group *groups = 0;
-    state_id max_nfa_state = 0;
-    uint32_t groups_allocated_bytes = 0;
-    uint32_t number_of_groups = 0;
-    for (int i = 0; i < 2; ++i) {
-        struct action_map *map = i == 0 ? &d->action_map :
-         &d->bracket_action_map;
-        uint32_t offset = i == 0 ? 0 : d->action_map.number_of_entries;
-        uint32_t nfa_state_offset = i == 0 ? 0 :
-         gen->combined->automaton.number_of_states;
-        for (uint32_t j = 0; j < map->number_of_entries;) {
-            uint32_t length = 0;
-            for (; j + length < map->number_of_entries; ++length) {
-                struct action_table_bucket *b = &buckets[offset + j + length];
-                struct action_map_entry e = map->entries[j + length];
-                *b = (struct action_table_bucket){
-                    .target_nfa_state = e.target_nfa_state + nfa_state_offset,
-                    .dfa_state = e.dfa_state + (i==0 ? 0 :
-                     d->automaton.number_of_states),
-                    .nfa_state = e.nfa_state + nfa_state_offset,
-                    .dfa_symbol = e.dfa_symbol,
-                    .action_index = (uint32_t)(e.actions - d->actions),
-                };
-                if (e.dfa_symbol >= gen->combined->number_of_tokens) {
-                    // This is a bracket transition.  Find the corresponding
-                    // accepting state and store it in the table.
-                    struct automaton bracket = gen->combined->bracket_automaton;
-                    for (state_id i = 0; i < bracket.number_of_states; ++i) {
-                        struct state s = bracket.states[i];
-                        if (!s.accepting || s.transition_symbol != e.nfa_symbol)
-                            continue;
-                        b->push_nfa_state = b->nfa_state;
-                        b->nfa_state = i +
-                         gen->combined->automaton.number_of_states;
-                        break;
-                    }
-                }
-                if (b->target_nfa_state > max_nfa_state)
-                    max_nfa_state = b->target_nfa_state;
-                if (b->nfa_state > max_nfa_state)
-                    max_nfa_state = b->nfa_state;
-                if (map->entries[j].target_nfa_state !=
-                 map->entries[j + length].target_nfa_state)
-                    break;
-            }
-            if (number_of_groups == UINT32_MAX)
-                abort();
-            groups = grow_array(groups, &groups_allocated_bytes,
-             (number_of_groups + 1) * sizeof(struct action_table_bucket_group));
-            groups[number_of_groups++] = (struct action_table_bucket_group){
-                .index = offset + j,
-                .length = length,
-            };
-            j += length;
-        }
+    bool fixed_width = gen->tree_layout == GENERATOR_TREE_LAYOUT_FIXED;
+    bool relative = gen->tree_layout == GENERATOR_TREE_LAYOUT_RELATIVE;
+    uint32_t n = gen->grammar->number_of_rules;
+    uint32_t max_slots = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        if (gen->grammar->rules[i]->number_of_slots > max_slots)
+            max_slots = gen->grammar->rules[i]->number_of_slots;
     }
-    qsort(groups, number_of_groups, sizeof(struct action_table_bucket_group),
-     compare_action_table_bucket_groups);
-
-    // Size the table to a power of two.
-    uint32_t table_size_bits = 7;
-    uint32_t table_size = 1 << table_size_bits;
-    uint32_t total_entries = d->action_map.number_of_entries +
-     d->bracket_action_map.number_of_entries;
-    uint32_t divisor = 1;
-    // FIXME: Figure out the actual math for the size of this table.
-    while (table_size <= total_entries / divisor) {
-        table_size *= 2;
-        table_size_bits += 1;
-        divisor += 1;
-    }
-    uint32_t table_mask = table_size - 1;
-    // Use the top bits of the hash for a secondary hash value.
-    uint32_t hash2_shift = 32 - table_size_bits;
-
-    // This array maps old NFA states to new NFA states.
-    state_id *nfa_states = malloc((max_nfa_state + 1) * sizeof(state_id));
-    for (state_id i = 0; i < max_nfa_state + 1; ++i)
-        nfa_states[i] = i;
-
-    struct action_table_bucket **table_buckets = calloc(table_size,
-     sizeof(struct action_table_bucket *));
-    uint32_t *bucket_sizes = calloc(table_size, sizeof(uint32_t));
-    uint32_t nfa_state = max_nfa_state + 1;
-    uint32_t saved_nfa_state = 0;
-    // Start at the minimum possible bucket limit.
-    uint32_t bucket_limit = (total_entries + table_size - 1) / table_size;
-    // How many times should we try to randomize indexes?
-#define MAX_TRIES 1000
-    uint32_t tries_left = MAX_TRIES;
-    for (uint32_t i = 0; i < number_of_groups; ++i) {
-        struct action_table_bucket_group group = groups[i];
-        while (true) {
-            if (nfa_state == UINT32_MAX)
-                abort();
-            uint32_t j = 0;
-            for (; j < group.length; ++j) {
-                struct action_table_bucket *bucket = &buckets[group.index + j];
-                uint32_t h = ACTION_TABLE_ENTRY_HASH(nfa_state,
-                 bucket->dfa_state, bucket->dfa_symbol);
-                uint32_t k1 = h & table_mask;
-                uint32_t k2 = h >> hash2_shift;
-                uint32_t k = bucket_sizes[k1] <= bucket_sizes[k2] ? k1 : k2;
-                bucket->table_index = k;
-                bucket->next = table_buckets[k];
-                table_buckets[k] = bucket;
-                if (bucket_sizes[k]++ >= bucket_limit)
-                    goto retry;
-            }
-            nfa_states[buckets[group.index].target_nfa_state] = nfa_state;
-            nfa_state++;
-            saved_nfa_state = nfa_state;
-            break;
-retry:
-            // Roll back changes and try a new nfa_state.
-            for (; j < group.length; --j) {
-                struct action_table_bucket *bucket = &buckets[group.index + j];
-                uint32_t k = bucket->table_index;
-                bucket_sizes[k]--;
-                table_buckets[k] = table_buckets[k]->next;
-            }
-            nfa_state++;
-            if (tries_left-- == 0) {
-                // If we ran out of tries, give ourselves some more room and
-                // keep going.
-                bucket_limit += 1;
-                tries_left = MAX_TRIES;
-                nfa_state = saved_nfa_state;
-            }
-        }
+    set_unsigned_number_substitution(out, "max-slots", max_slots + 1);
+    // Compaction walks the old tree with the parsed_..._get() functions, so
+    // it doesn't depend on how the tree was built.  Each element is measured
+    // first: once the size of everything after a field is known, offsets to
+    // later elements can be written in as few bytes as they need.
+    output_line(out, "// An element of the tree, as read by %%prefix_tree_compact().");
+    output_line(out, "struct compact_element {");
+    output_line(out, "    size_t start;");
+    output_line(out, "    size_t end;");
+    output_line(out, "    // The choice, or zero if the rule doesn't have any.");
+    output_line(out, "    uint32_t type;");
+    output_line(out, "    size_t number_of_slots;");
+    output_line(out, "    struct %%prefix_ref slots[%%max-slots];");
+    output_line(out, "    bool is_token;");
+    output_line(out, "    bool has_value;");
+    output_line(out, "    uint64_t value;");
+    output_line(out, "    bool is_string;");
+    output_line(out, "    // The contents of a string with escapes, which are kept in the tree.");
+    output_line(out, "    const char *string;");
+    output_line(out, "    size_t string_length;");
+    output_line(out, "};");
+    output_line(out, "struct compaction {");
+    output_line(out, "    struct %%prefix_tree *tree;");
+    output_line(out, "    // For each element in preorder: the offset to its next sibling, if there is");
+    output_line(out, "    // one, then the offset to its token record or to each non-empty slot's list.");
+    output_line(out, "    size_t *offsets;");
+    output_line(out, "    size_t number_of_offsets;");
+    output_line(out, "    size_t offsets_capacity;");
+    output_line(out, "    size_t next_offset;");
+    output_line(out, "    // Absolute offsets are padded to this many bytes.");
+    output_line(out, "    size_t offset_width;");
+    output_line(out, "};");
+    output_line(out, "static size_t tree_field_size(uint64_t value)");
+    output_line(out, "{");
+    if (fixed_width) {
+        output_line(out, "    (void)value;");
+        output_line(out, "    return 4;");
+    } else {
+        output_line(out, "    size_t size = 1;");
+        output_line(out, "    while (value >>= 7)");
+        output_line(out, "        size++;");
+        output_line(out, "    return size;");
     }
-    free(groups);
-    const int actions_per_line = 30;
-    output_line(out, "static const uint16_t actions[] = {");
-    for (uint32_t i = 0; i < d->number_of_actions; ++i) {
-        set_unsigned_number_substitution(out, "action", d->actions[i]);
-        output_string(out, "%%action,");
-        if ((i + 1) % actions_per_line == 0)
-            output_line(out, "");
+    output_line(out, "}");
+    output_line(out, "static void write_tree_padded(struct %%prefix_tree *tree, uint64_t value, size_t width)");
+    output_line(out, "{");
+    if (fixed_width) {
+        output_line(out, "    (void)width;");
+        output_line(out, "    write_tree(tree, value);");
+    } else {
+        output_line(out, "    size_t reserved_size = tree->next_offset + RESERVATION_AMOUNT;");
+        output_line(out, "    if (tree->parse_tree_size <= reserved_size && !grow_tree(tree, reserved_size))");
+        output_line(out, "        abort();");
+        output_line(out, "    for (size_t i = 1; i < width; ++i) {");
+        output_line(out, "        tree->parse_tree[tree->next_offset++] = 0x80 | (value & 0x7f);");
+        output_line(out, "        value >>= 7;");
+        output_line(out, "    }");
+        output_line(out, "    tree->parse_tree[tree->next_offset++] = value & 0x7f;");
     }
-    output_line(out, "};");
-    uint32_t nfa_state_bits = log2u(nfa_state);
-    uint32_t dfa_state_bits = log2u(d->automaton.number_of_states +
-     d->bracket_automaton.number_of_states + 1);
-    uint32_t dfa_symbol_bits;
-    if (d->automaton.number_of_symbols > d->bracket_automaton.number_of_symbols)
-        dfa_symbol_bits = log2u(d->automaton.number_of_symbols + 1);
-    else
-        dfa_symbol_bits = log2u(d->bracket_automaton.number_of_symbols + 1);
-    uint32_t action_bits = log2u(d->number_of_actions);
-    uint32_t key_bits = nfa_state_bits + dfa_state_bits + dfa_symbol_bits;
-    uint32_t key_bytes = (key_bits + 7) / 8;
-    uint32_t value_bits = nfa_state_bits * 2 + action_bits;
-    uint32_t value_bytes = (value_bits + 7) / 8;
-    struct bit_range target_nfa_state_range = next_bit_range((struct bit_range){0}, nfa_state_bits);
-    struct bit_range dfa_state_range = next_bit_range(target_nfa_state_range, dfa_state_bits);
-    struct bit_range dfa_symbol_range = next_bit_range(dfa_state_range, dfa_symbol_bits);
-    struct bit_range nfa_state_range = next_bit_range((struct bit_range){.end_byte=key_bytes}, nfa_state_bits);
-    struct bit_range action_range = next_bit_range(nfa_state_range, action_bits);
-    struct bit_range push_nfa_state_range = next_bit_range(action_range, nfa_state_bits);
-    set_unsigned_number_substitution(out, "entry-bytes", key_bytes + value_bytes);
-    set_unsigned_number_substitution(out, "table-size", table_size);
-    set_unsigned_number_substitution(out, "bucket-limit", bucket_limit);
-    output_line(out, "static const uint8_t action_table[%%table-size][%%bucket-limit][%%entry-bytes] = {");
-    const int entries_per_line = 6;
-    int next_newline = entries_per_line;
-    uint8_t *bytes = malloc(key_bytes + value_bytes);
-    for (uint32_t i = 0; i < table_size; ++i) {
-        output_string(out, "{");
-        struct action_table_bucket *bucket = table_buckets[i];
-        if (!bucket)
-            output_string(out, "{0}");
-        for (; bucket; bucket = bucket->next) {
-            output_string(out, "{");
-            memset(bytes, 0, key_bytes + value_bytes);
-            set_bit_range(bytes, target_nfa_state_range, nfa_states[bucket->target_nfa_state]);
-            set_bit_range(bytes, dfa_state_range, bucket->dfa_state);
-            set_bit_range(bytes, dfa_symbol_range, bucket->dfa_symbol);
-            set_bit_range(bytes, nfa_state_range, nfa_states[bucket->nfa_state]);
-            set_bit_range(bytes, action_range, bucket->action_index);
-            if (bucket->dfa_symbol >= gen->combined->number_of_tokens)
-                set_bit_range(bytes, push_nfa_state_range, nfa_states[bucket->push_nfa_state]);
-            for (uint32_t i = 0; i < key_bytes + value_bytes; ++i) {
-                set_unsigned_number_substitution(out, "byte", bytes[i]);
-                output_string(out, "%%byte,");
-            }
-            output_string(out, "},");
-            if (--next_newline == 0 && bucket->next) {
-                output_line(out, "");
-                next_newline = entries_per_line;
-            }
+    output_line(out, "}");
+    output_line(out, "static void describe_element(struct %%prefix_ref ref, struct compact_element *e)");
+    output_line(out, "{");
+    output_line(out, "    *e = (struct compact_element){0};");
+    output_line(out, "    switch (ref._type) {");
+    for (uint32_t i = 0; i < n; ++i) {
+        struct rule *rule = gen->grammar->rules[i];
+        set_unsigned_number_substitution(out, "rule-index", i);
+        set_substitution(out, "rule", rule->name, rule->name_length,
+         LOWERCASE_WITH_UNDERSCORES);
+        output_line(out, "    case %%rule-index: {");
+        output_line(out, "        struct %%parsed_%%rule it = %%parsed_%%rule_get(ref);");
+        output_line(out, "        e->start = it.range.start;");
+        output_line(out, "        e->end = it.range.end;");
+        if (rule->number_of_choices > 0)
+            output_line(out, "        e->type = it.type;");
+        for (uint32_t j = 0; j < rule->number_of_slots; ++j) {
+            set_unsigned_number_substitution(out, "slot-index", j);
+            set_substitution(out, "referenced-slot", rule->slots[j].name,
+             rule->slots[j].name_length, LOWERCASE_WITH_UNDERSCORES);
+            output_line(out, "        e->slots[%%slot-index] = it.%%referenced-slot;");
         }
-        output_string(out, "},");
-        if (next_newline == 0) {
-            output_line(out, "");
-            next_newline = entries_per_line;
+        if (rule->number_of_slots > 0) {
+            set_unsigned_number_substitution(out, "number-of-slots",
+             rule->number_of_slots);
+            output_line(out, "        e->number_of_slots = %%number-of-slots;");
+        }
+        if (rule->is_token)
+            output_line(out, "        e->is_token = true;");
+        switch (rule->is_token ? rule->token_type : RULE_TOKEN_IDENTIFIER) {
+        case RULE_TOKEN_IDENTIFIER:
+            break;
+        case RULE_TOKEN_INTEGER:
+            output_line(out, "        e->has_value = true;");
+            output_line(out, "        e->value = it.integer;");
+            break;
+        case RULE_TOKEN_NUMBER:
+            output_line(out, "        e->has_value = true;");
+            output_line(out, "        e->value = (union { double n; uint64_t v; }){ .n = it.number }.v;");
+            break;
+        case RULE_TOKEN_STRING:
+            output_line(out, "        e->is_string = true;");
+            output_line(out, "        uintptr_t contents = (uintptr_t)ref._tree->parse_tree;");
+            output_line(out, "        if ((uintptr_t)it.string >= contents && (uintptr_t)it.string < contents + ref._tree->parse_tree_size) {");
+            output_line(out, "            e->string = it.string;");
+            output_line(out, "            e->string_length = it.length;");
+            output_line(out, "        }");
+            break;
+        case RULE_TOKEN_CUSTOM:
+            output_line(out, "        e->has_value = true;");
+            output_line(out, "        e->value = it.data.integer;");
+            break;
         }
+        output_line(out, "        break;");
+        output_line(out, "    }");
     }
-    free(bytes);
-    output_line(out, "};");
-    output_line(out, "");
-    set_unsigned_number_substitution(out, "key-bytes", key_bytes);
-    output_line(out, "struct action_table_key {");
-    output_line(out, "    uint8_t bytes[%%key-bytes];");
-    output_line(out, "};");
-    output_line(out, "static inline struct action_table_key encode_key(%%state-type target_nfa_state, %%state-type dfa_state, %%token-type dfa_symbol) {");
-    output_line(out, "    struct action_table_key key = {{0}};");
-    encode_bit_range(out, target_nfa_state_range, "target_nfa_state");
-    encode_bit_range(out, dfa_state_range, "dfa_state");
-    encode_bit_range(out, dfa_symbol_range, "dfa_symbol");
-    output_line(out, "    return key;");
+    output_line(out, "    default:");
+    output_line(out, "        break;");
+    output_line(out, "    }");
     output_line(out, "}");
-    output_line(out, "struct action_table_entry {");
-    output_line(out, "    %%state-type nfa_state;");
-    output_line(out, "    uint32_t actions;");
-    output_line(out, "    %%state-type push_nfa_state;");
-    output_line(out, "};");
-    output_line(out, "static struct action_table_entry decode_entry(const uint8_t *bytes) {");
-    output_line(out, "    struct action_table_entry entry = {0};");
-    decode_bit_range(out, nfa_state_range, "entry.nfa_state");
-    decode_bit_range(out, action_range, "entry.actions");
-    decode_bit_range(out, push_nfa_state_range, "entry.push_nfa_state");
-    output_line(out, "    return entry;");
+    output_line(out, "static size_t string_contents_size(size_t length)");
+    output_line(out, "{");
+    if (fixed_width)
+        output_line(out, "    return (length + 3) & ~(size_t)3;");
+    else
+        output_line(out, "    return length;");
     output_line(out, "}");
-    output_line(out, "static struct action_table_entry action_table_lookup(%%state-type nfa_state, %%state-type dfa_state, %%token-type token) {");
-    set_literal_substitution(out, "action-table-entry-hash", STRINGIFY(ACTION_TABLE_ENTRY_HASH(nfa_state, dfa_state, token)));
-    set_unsigned_number_substitution(out, "action-table-mask", table_mask);
-    set_unsigned_number_substitution(out, "action-table-hash2-shift", hash2_shift);
-    output_line(out, "    uint32_t hash = %%action-table-entry-hash;");
-    output_line(out, "    uint32_t index1 = hash & %%action-table-mask;");
-    output_line(out, "    uint32_t index2 = hash >> %%action-table-hash2-shift;");
-    output_line(out, "    struct action_table_key key = encode_key(nfa_state, dfa_state, token);");
-    output_line(out, "    uint32_t j = 0;");
-    output_line(out, "    const uint8_t *entry = 0;");
-    output_line(out, "    for (; j < %%bucket-limit; ++j) {");
-    output_line(out, "        entry = action_table[index1][j];");
-    output_line(out, "        if (!memcmp(key.bytes, entry, sizeof(key.bytes)))");
-    output_line(out, "            break;");
-    output_line(out, "        entry = action_table[index2][j];");
-    output_line(out, "        if (!memcmp(key.bytes, entry, sizeof(key.bytes)))");
+    output_line(out, "// Returns the size of a token's record, and any string contents after it.");
+    output_line(out, "static size_t token_record_size(struct compaction *c, struct compact_element *e)");
+    output_line(out, "{");
+    if (relative) {
+        output_line(out, "    // Records are only linked to each other while the tree is built, so the");
+        output_line(out, "    // previous-record and location fields are left as zero.");
+        output_line(out, "    size_t size = tree_field_size(0) * 2 + tree_field_size(e->end - e->start);");
+    } else {
+        output_line(out, "    size_t size = tree_field_size(0) + tree_field_size(e->start) + tree_field_size(e->end - e->start);");
+    }
+    output_line(out, "    if (e->has_value)");
+    if (fixed_width)
+        output_line(out, "        size += 8;");
+    else
+        output_line(out, "        size += tree_field_size(e->value);");
+    output_line(out, "    if (e->is_string && e->string)");
+    output_line(out, "        size += c->offset_width + tree_field_size(e->string_length) + string_contents_size(e->string_length);");
+    output_line(out, "    else if (e->is_string)");
+    output_line(out, "        size += tree_field_size(0);");
+    output_line(out, "    return size;");
+    output_line(out, "}");
+    output_line(out, "static size_t measure_list(struct compaction *c, struct %%prefix_ref ref);");
+    output_line(out, "// Returns the number of offsets recorded for an element.");
+    output_line(out, "static size_t count_offsets(struct compact_element *e, struct %%prefix_ref next)");
+    output_line(out, "{");
+    output_line(out, "    size_t count = next.empty ? 0 : 1;");
+    output_line(out, "    if (e->is_token)");
+    output_line(out, "        return count + 1;");
+    output_line(out, "    for (size_t i = 0; i < e->number_of_slots; ++i) {");
+    output_line(out, "        if (!e->slots[i].empty)");
+    output_line(out, "            count++;");
+    output_line(out, "    }");
+    output_line(out, "    return count;");
+    output_line(out, "}");
+    output_line(out, "static size_t measure_element(struct compaction *c, struct %%prefix_ref ref, struct %%prefix_ref next)");
+    output_line(out, "{");
+    output_line(out, "    struct compact_element e;");
+    output_line(out, "    describe_element(ref, &e);");
+    output_line(out, "    size_t index = c->number_of_offsets;");
+    output_line(out, "    size_t count = count_offsets(&e, next);");
+    output_line(out, "    if (index + count > c->offsets_capacity) {");
+    output_line(out, "        size_t capacity = (index + count) * 2 + 64;");
+    output_line(out, "        size_t *offsets = reallocate_memory(c->offsets, c->offsets_capacity * sizeof(size_t),");
+    output_line(out, "         capacity * sizeof(size_t), &c->tree->allocator);");
+    output_line(out, "        if (!offsets)");
+    output_line(out, "            abort();");
+    output_line(out, "        c->offsets = offsets;");
+    output_line(out, "        c->offsets_capacity = capacity;");
+    output_line(out, "    }");
+    output_line(out, "    c->number_of_offsets += count;");
+    output_line(out, "    // The size of everything after the header: the slots' lists or the record.");
+    output_line(out, "    size_t lists[%%max-slots];");
+    output_line(out, "    size_t body = 0;");
+    output_line(out, "    for (size_t i = 0; i < e.number_of_slots; ++i) {");
+    output_line(out, "        lists[i] = measure_list(c, e.slots[i]);");
+    output_line(out, "        body += lists[i];");
+    output_line(out, "    }");
+    output_line(out, "    // Every header field except the offsets to later elements.");
+    if (relative) {
+        output_line(out, "    size_t fields = next.empty ? 0 : tree_field_size(next._start - e.end);");
+        output_line(out, "    if (e.is_token)");
+        output_line(out, "        body = token_record_size(c, &e);");
+        output_line(out, "    else");
+        output_line(out, "        fields += tree_field_size(e.end - e.start);");
+        output_line(out, "    if (e.type)");
+        output_line(out, "        fields += tree_field_size(e.type);");
+        output_line(out, "    for (size_t i = 0; i < e.number_of_slots; ++i) {");
+        output_line(out, "        if (e.slots[i].empty)");
+        output_line(out, "            fields += tree_field_size(0);");
+        output_line(out, "        else");
+        output_line(out, "            fields += tree_field_size(e.slots[i]._start - e.start);");
+        output_line(out, "    }");
+    } else if (fixed_width) {
+        output_line(out, "    size_t fields = 0;");
+        output_line(out, "    if (e.is_token) {");
+        output_line(out, "        fields += c->offset_width;");
+        output_line(out, "        body = token_record_size(c, &e);");
+        output_line(out, "    } else");
+        output_line(out, "        fields += tree_field_size(e.start) + tree_field_size(e.end - e.start);");
+        output_line(out, "    if (e.type)");
+        output_line(out, "        fields += tree_field_size(e.type);");
+        output_line(out, "    for (size_t i = 0; i < e.number_of_slots; ++i)");
+        output_line(out, "        fields += e.slots[i].empty ? tree_field_size(0) : c->offset_width;");
+    } else {
+        output_line(out, "    size_t fields = 0;");
+        output_line(out, "    if (e.is_token)");
+        output_line(out, "        body = token_record_size(c, &e);");
+        output_line(out, "    else");
+        output_line(out, "        fields += tree_field_size(e.start) + tree_field_size(e.end - e.start);");
+        output_line(out, "    if (e.type)");
+        output_line(out, "        fields += tree_field_size(e.type);");
+        output_line(out, "    for (size_t i = 0; i < e.number_of_slots; ++i) {");
+        output_line(out, "        if (e.slots[i].empty)");
+        output_line(out, "            fields += tree_field_size(0);");
+        output_line(out, "    }");
+    }
+    output_line(out, "    // The offsets depend on the size of the header, which depends on the size of");
+    output_line(out, "    // the offsets.  Start small and grow the header until they fit.");
+    output_line(out, "    size_t header = fields;");
+    output_line(out, "    while (true) {");
+    output_line(out, "        size_t size = fields + tree_field_size(next.empty ? 0 : header + body);");
+    if (!fixed_width) {
+        output_line(out, "        if (e.is_token)");
+        output_line(out, "            size += tree_field_size(header);");
+        output_line(out, "        size_t list_offset = header;");
+        output_line(out, "        for (size_t i = 0; i < e.number_of_slots; ++i) {");
+        output_line(out, "            if (!e.slots[i].empty)");
+        output_line(out, "                size += tree_field_size(list_offset);");
+        output_line(out, "            list_offset += lists[i];");
+        output_line(out, "        }");
+    }
+    output_line(out, "        if (size == header)");
     output_line(out, "            break;");
+    output_line(out, "        header = size;");
     output_line(out, "    }");
-    output_line(out, "    if (j >= %%bucket-limit)");
-    output_line(out, "        abort();");
-    output_line(out, "    return decode_entry(entry);");
+    output_line(out, "    if (!next.empty)");
+    output_line(out, "        c->offsets[index++] = header + body;");
+    output_line(out, "    if (e.is_token)");
+    output_line(out, "        c->offsets[index++] = header;");
+    output_line(out, "    size_t list_offset = header;");
+    output_line(out, "    for (size_t i = 0; i < e.number_of_slots; ++i) {");
+    output_line(out, "        if (!e.slots[i].empty)");
+    output_line(out, "            c->offsets[index++] = list_offset;");
+    output_line(out, "        list_offset += lists[i];");
+    output_line(out, "    }");
+    output_line(out, "    return header + body;");
     output_line(out, "}");
-    output_line(out, "static void apply_actions(struct construct_state *state, uint32_t index, size_t start, size_t end) {");
-    output_line(out, "    size_t offset = end;");
-    output_line(out, "    uint32_t i;");
-    output_line(out, "    for (i = index; actions[i]; ++i) {");
-    set_literal_substitution(out, "is-end-action", STRINGIFY(CONSTRUCT_IS_END_ACTION(actions[i])));
-    output_line(out, "        if (%%is-end-action)");
-    output_line(out, "            offset = start;");
-    output_line(out, "        construct_action_apply(state, actions[i], offset);");
+    output_line(out, "static size_t measure_list(struct compaction *c, struct %%prefix_ref ref)");
+    output_line(out, "{");
+    output_line(out, "    size_t size = 0;");
+    output_line(out, "    while (!ref.empty) {");
+    output_line(out, "        struct %%prefix_ref next = %%prefix_next(ref);");
+    output_line(out, "        size += measure_element(c, ref, next);");
+    output_line(out, "        ref = next;");
     output_line(out, "    }");
+    output_line(out, "    return size;");
     output_line(out, "}");
-    output_line(out, "static size_t build_parse_tree(struct owl_default_tokenizer *tokenizer, struct owl_token_run *run, struct %%prefix_tree *tree) {");
-    output_line(out, "    struct construct_state construct_state = { .info = tree };");
-    output_line(out, "    %%state-type *state_stack = 0;");
-    output_line(out, "    uint32_t stack_depth = 0;");
-    output_line(out, "    size_t stack_capacity = 0;");
-    output_line(out, "    size_t whitespace = tokenizer->whitespace;");
-    output_line(out, "    size_t offset = tokenizer->offset - whitespace;");
-    if (gen->combined->root_rule_is_expression)
-        output_line(out, "    construct_begin(&construct_state, offset, CONSTRUCT_EXPRESSION_ROOT);");
+    output_line(out, "static void write_list(struct compaction *c, struct %%prefix_ref ref);");
+    output_line(out, "static void write_element(struct compaction *c, struct %%prefix_ref ref, struct %%prefix_ref next)");
+    output_line(out, "{");
+    output_line(out, "    struct %%prefix_tree *tree = c->tree;");
+    output_line(out, "    struct compact_element e;");
+    output_line(out, "    describe_element(ref, &e);");
+    output_line(out, "    size_t index = c->next_offset;");
+    output_line(out, "    c->next_offset += count_offsets(&e, next);");
+    output_line(out, "    size_t offset = tree->next_offset;");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "    if (tree->rule_index || tree->location_index)");
+    output_line(out, "        index_match(tree, ref._type, e.type, offset, e.start, e.end);");
+    output_line(out, "#endif");
+    output_line(out, "    size_t size = next.empty ? 0 : c->offsets[index++];");
+    output_line(out, "    write_tree(tree, size);");
+    if (relative) {
+        output_line(out, "    if (!next.empty)");
+        output_line(out, "        write_tree(tree, next._start - e.end);");
+    }
+    output_line(out, "    if (e.is_token) {");
+    output_line(out, "        size_t header = c->offsets[index];");
+    if (fixed_width)
+        output_line(out, "        write_tree(tree, offset + header);");
     else
-        output_line(out, "    construct_begin(&construct_state, offset, CONSTRUCT_NORMAL_ROOT);");
-    set_unsigned_number_substitution(out, "final-nfa-state",
-     nfa_states[gen->combined->final_nfa_state]);
-    output_line(out, "    %%state-type nfa_state = %%final-nfa-state;");
-    output_line(out, "    while (run) {");
-    output_line(out, "        uint16_t length_offset = run->lengths_size - 1;");
-    output_line(out, "        uint16_t n = run->number_of_tokens;");
-    output_line(out, "        uint16_t i;");
-    output_line(out, "        for (i = n - 1; i < n; i--) {");
-    output_line(out, "            size_t end = offset;");
-    output_line(out, "            size_t len = 0;");
-    output_line(out, "            struct action_table_entry entry = action_table_lookup(nfa_state, run->states[i], run->tokens[i]);");
-    if (gen->combined->number_of_tokens > 0) {
-        // avoid "warning: comparison of unsigned expression < 0 is always false"
-        set_unsigned_number_substitution(out, "number-of-tokens",
-         gen->combined->number_of_tokens);
-        output_line(out, "            if (run->tokens[i] < %%number-of-tokens)");
-    } else
-        output_line(out, "            if (true)");
-    output_line(out, "                len = decode_token_length(run, &length_offset, &offset);");
-    output_line(out, "            else {");
-    output_line(out, "                if (stack_depth >= stack_capacity) {");
-    output_line(out, "                    size_t new_capacity = (stack_capacity + 2) * 3 / 2;");
-    output_line(out, "                    if (new_capacity <= stack_capacity)");
-    output_line(out, "                        abort();");
-    output_line(out, "                    %%state-type *new_stack = realloc(state_stack, new_capacity * sizeof(%%state-type));");
-    output_line(out, "                    if (!new_stack)");
-    output_line(out, "                        abort();");
-    output_line(out, "                    state_stack = new_stack;");
-    output_line(out, "                    stack_capacity = new_capacity;");
-    output_line(out, "                }");
-    output_line(out, "                state_stack[stack_depth++] = entry.push_nfa_state;");
-    output_line(out, "            }");
-    output_line(out, "            apply_actions(&construct_state, entry.actions, end, end + whitespace);");
-    set_unsigned_number_substitution(out, "bracket-start-state",
-     gen->deterministic->bracket_automaton.start_state +
-     gen->deterministic->automaton.number_of_states);
-    output_line(out, "            if (run->states[i] == %%bracket-start-state) {");
-    output_line(out, "                if (stack_depth == 0)");
-    output_line(out, "                    abort();");
-    output_line(out, "                nfa_state = state_stack[--stack_depth];");
-    output_line(out, "            } else");
-    output_line(out, "                nfa_state = entry.nfa_state;");
-    output_line(out, "            whitespace = end - offset - len;");
+        output_line(out, "        write_tree(tree, header);");
+    output_line(out, "        write_tree(tree, 0);");
+    if (relative)
+        output_line(out, "        write_tree(tree, 0);");
+    else
+        output_line(out, "        write_tree(tree, e.start);");
+    output_line(out, "        write_tree(tree, e.end - e.start);");
+    output_line(out, "        if (e.has_value)");
+    output_line(out, "            %%write-tree-wide(tree, e.value);");
+    output_line(out, "        if (e.is_string && e.string) {");
+    output_line(out, "            // The contents go right after the record.");
+    output_line(out, "            size_t record_size = tree->next_offset - offset - header;");
+    output_line(out, "            record_size += c->offset_width + tree_field_size(e.string_length);");
+    output_line(out, "            write_tree_padded(tree, offset + header + record_size, c->offset_width);");
+    output_line(out, "            write_tree(tree, e.string_length);");
+    output_line(out, "            memcpy(allocate_string_contents(e.string_length, tree), e.string, e.string_length);");
+    output_line(out, "        } else if (e.is_string)");
+    output_line(out, "            write_tree(tree, 0);");
+    output_line(out, "        return;");
+    output_line(out, "    }");
+    if (!relative)
+        output_line(out, "    write_tree(tree, e.start);");
+    output_line(out, "    write_tree(tree, e.end - e.start);");
+    output_line(out, "    if (e.type)");
+    output_line(out, "        write_tree(tree, e.type);");
+    output_line(out, "    for (size_t i = 0; i < e.number_of_slots; ++i) {");
+    output_line(out, "        if (e.slots[i].empty) {");
+    output_line(out, "            write_tree(tree, 0);");
+    output_line(out, "            continue;");
     output_line(out, "        }");
-    output_line(out, "        struct owl_token_run *old = run;");
-    output_line(out, "        run = run->prev;");
-    output_line(out, "        free(old);");
+    if (fixed_width)
+        output_line(out, "        write_tree(tree, offset + c->offsets[index++]);");
+    else
+        output_line(out, "        write_tree(tree, c->offsets[index++]);");
+    if (relative)
+        output_line(out, "        write_tree(tree, e.slots[i]._start - e.start);");
     output_line(out, "    }");
-    output_line(out, "    struct action_table_entry entry = action_table_lookup(nfa_state, UINT32_MAX, UINT32_MAX);");
-    output_line(out, "    apply_actions(&construct_state, entry.actions, offset, offset + whitespace);");
-    output_line(out, "    free(state_stack);");
-    output_line(out, "    free_token_runs(&run);");
-    output_line(out, "    return construct_finish(&construct_state, offset);");
+    output_line(out, "    for (size_t i = 0; i < e.number_of_slots; ++i)");
+    output_line(out, "        write_list(c, e.slots[i]);");
     output_line(out, "}");
-    free(bucket_sizes);
-    free(buckets);
-    free(table_buckets);
-    free(nfa_states);
+    output_line(out, "static void write_list(struct compaction *c, struct %%prefix_ref ref)");
+    output_line(out, "{");
+    output_line(out, "    while (!ref.empty) {");
+    output_line(out, "        struct %%prefix_ref next = %%prefix_next(ref);");
+    output_line(out, "        write_element(c, ref, next);");
+    output_line(out, "        ref = next;");
+    output_line(out, "    }");
+    output_line(out, "}");
+    output_line(out, "void %%prefix_tree_compact(struct %%prefix_tree *tree) {");
+    output_line(out, "    if (tree->error != ERROR_NONE || tree->root_offset == 0)");
+    output_line(out, "        return;");
+    output_line(out, "    // The old tree is read through a copy while the new one is written.");
+    output_line(out, "    struct %%prefix_tree old = *tree;");
+    output_line(out, "    struct %%prefix_ref root = %%prefix_tree_root_ref(&old);");
+    output_line(out, "    struct compaction c = {");
+    output_line(out, "        .tree = tree,");
+    output_line(out, "        .offset_width = tree_field_size(old.next_offset),");
+    output_line(out, "    };");
+    output_line(out, "    size_t size = measure_list(&c, root);");
+    output_line(out, "    while (tree_field_size(%%first-tree-offset + size) > c.offset_width) {");
+    output_line(out, "        c.offset_width++;");
+    output_line(out, "        c.number_of_offsets = 0;");
+    output_line(out, "        size = measure_list(&c, root);");
+    output_line(out, "    }");
+    output_line(out, "    // Leave room after the last element for read_tree's bounds check.");
+    output_line(out, "    size_t parse_tree_size = %%first-tree-offset + size + RESERVATION_AMOUNT + 1;");
+    output_line(out, "    uint8_t *parse_tree = allocate_memory(parse_tree_size, &tree->allocator);");
+    output_line(out, "    if (parse_tree) {");
+    output_line(out, "        tree->parse_tree = parse_tree;");
+    output_line(out, "        tree->parse_tree_size = parse_tree_size;");
+    output_line(out, "        tree->next_offset = %%first-tree-offset;");
+    output_line(out, "        tree->root_offset = %%first-tree-offset;");
+    output_line(out, "        tree->compacted = true;");
+    output_line(out, "#ifdef OWL_INDEX");
+    output_line(out, "        clear_indexes(tree);");
+    output_line(out, "        write_list(&c, root);");
+    output_line(out, "        if (tree->rule_index || tree->location_index)");
+    output_line(out, "            finish_indexes(tree);");
+    output_line(out, "#else");
+    output_line(out, "        write_list(&c, root);");
+    output_line(out, "#endif");
+    output_line(out, "        free_memory(old.parse_tree, old.parse_tree_size, &tree->allocator);");
+    output_line(out, "    }");
+    output_line(out, "    free_memory(c.offsets, c.offsets_capacity * sizeof(size_t), &tree->allocator);");
+    output_line(out, "}");
+}
+
+static void generate_number_reader(struct generator_output *out)
+{
+    output_line(out, "#if defined(__SIZEOF_INT128__)");
+    output_line(out, "#define OWL_MULTIPLY_HIGH(a, b) ((uint64_t)(__extension__ ((unsigned __int128)(a) * (b) >> 64)))");
+    output_line(out, "#else");
+    output_line(out, "#define OWL_MULTIPLY_HIGH multiply_high");
+    output_line(out, "#endif");
+    output_line(out, "#if defined(__clang__) || defined(__GNUC__)");
+    output_line(out, "#define OWL_LEADING_ZEROS(x) __builtin_clzll(x)");
+    output_line(out, "#else");
+    output_line(out, "#define OWL_LEADING_ZEROS leading_zeros");
+    output_line(out, "#endif");
+    output_line(out, "static const uint64_t powers_of_five[] = {");
+    size_t n = sizeof(powers_of_five) / sizeof(powers_of_five[0]);
+    for (size_t i = 0; i < n; i += 2) {
+        char line[64];
+        snprintf(line, sizeof(line), "    0x%016llx, 0x%016llx,",
+         (unsigned long long)powers_of_five[i],
+         (unsigned long long)powers_of_five[i + 1]);
+        output_line(out, line);
+    }
+    output_line(out, "};");
+    output_formatted_source(out, number_reader_source);
+}
+
+static bool has_single_byte_whitespace(struct grammar *grammar)
+{
+    if (grammar->number_of_whitespace_tokens == 0)
+        return false;
+    for (uint32_t i = 0; i < grammar->number_of_whitespace_tokens; ++i) {
+        if (grammar->whitespace_tokens[i].length != 1)
+            return false;
+    }
+    return true;
 }
 
 static void output_indentation(struct generator_output *out, size_t indentation)
@@ -4,6 +4,27 @@
 #include "5-determinize.h"
 #include <stdlib.h>
 
+enum generator_backend {
+    // Each state of the deterministic automaton gets its own function with a
+    // switch over the tokens it accepts.
+    GENERATOR_BACKEND_FUNCTIONS,
+    // A single loop looks up each transition in a table indexed by state and
+    // token class.
+    GENERATOR_BACKEND_TABLE,
+};
+
+enum generator_tree_layout {
+    // Each field of the parse tree is a variable-length integer, so fields are
+    // read one after another.
+    GENERATOR_TREE_LAYOUT_PACKED,
+    // Each field is a 32-bit word at a fixed position within its node, so any
+    // field can be read directly.
+    GENERATOR_TREE_LAYOUT_FIXED,
+    // Like the packed layout, but positions and offsets are stored relative to
+    // the parent or previous sibling, so most fields fit in a single byte.
+    GENERATOR_TREE_LAYOUT_RELATIVE,
+};
+
 struct generator {
     void (*output)(const char *, size_t);
 
@@ -15,6 +36,20 @@ struct generator {
     // If non-null, all symbols beginning with owl_ or parsed_ will begin with
     // prefix_ instead.
     const char *prefix;
+
+    // If true, keywords which look like identifiers are matched with a perfect
+    // hash of the scanned identifier instead of with the keyword trie.
+    bool hash_keywords;
+
+    // How the generated parser runs the deterministic automaton.
+    enum generator_backend backend;
+
+    // How nodes are laid out in the generated parse tree.
+    enum generator_tree_layout tree_layout;
+
+    // If true, the generated parser can build the root rule's tree on several
+    // threads, splitting the input where the root rule is between matches.
+    bool split_root;
 };
 
 void generate(struct generator *);
@@ -8,6 +8,7 @@
 #define READ_WHITESPACE read_whitespace
 #define READ_KEYWORD_TOKEN read_keyword_token
 #define READ_CUSTOM_TOKEN read_custom_token
+#define READ_NUMBER read_number
 
 #define CUSTOM_TOKEN_DATA(identifier) void *identifier = 0
 
@@ -45,11 +46,13 @@
  if ((((struct tokenizer_info *)tokenizer->info)->identifier_symbol \
  != SYMBOL_EPSILON) && (cond)) __VA_ARGS__
 
-static size_t read_whitespace(const char *text, void *info);
+static size_t read_whitespace(const char *text, size_t length, void *info);
 static size_t read_keyword_token(uint32_t *token, bool *end_token,
- const char *text, void *info);
+ const char *text, size_t length, void *info);
 static bool read_custom_token(uint32_t *token, size_t *token_length,
- const char *text, bool *whitespace, void **data, void *info);
+ const char *text, size_t length, bool *whitespace, void **data, void *info);
+static double read_number(const char *text, size_t length,
+ size_t *number_length, void *allocator);
 static void write_identifier_token(size_t offset, size_t length, void *info);
 static void write_integer_token(size_t offset, size_t length, uint64_t integer,
  void *info);
@@ -107,6 +110,7 @@ static void left_right_operand_slots_lookup(uint32_t rule, uint32_t *left,
  uint32_t *right, uint32_t *operand, struct interpret_context *context);
 
 #include "x-tokenize.h"
+#include "x-read-number.h"
 #include "x-construct-parse-tree.h"
 
 struct saved_state {
@@ -280,6 +284,7 @@ static void output_ambiguity_path(struct interpreter *interpreter,
          offset);
     }
     struct interpret_node *root = construct_finish(&context.construct_state, 0);
+    construct_free_pools(&context.construct_state);
 
     initialize_document(&context, root, number_of_token_labels,
      PRINT_ROOT_NODE);
@@ -618,6 +623,7 @@ void interpret(struct interpreter *interpreter, const char *text, FILE *output)
     };
     struct owl_default_tokenizer tokenizer = {
         .text = text,
+        .length = strlen(text),
         .info = &info,
     };
     struct interpret_context context = {
@@ -634,7 +640,8 @@ void interpret(struct interpreter *interpreter, const char *text, FILE *output)
     context.stack[0].automaton = &deterministic->automaton;
     while (owl_default_tokenizer_advance(&tokenizer, &token_run))
         fill_run_states(&context, token_run);
-    if (text[tokenizer.offset] != '\0') {
+    free_token_runs(&tokenizer.free_runs, 0);
+    if (tokenizer.offset < tokenizer.length) {
         estimate_next_token_range(&tokenizer, &error.ranges[0].start,
          &error.ranges[0].end);
         exit_with_errorf("the text '%.*s' doesn't match any token",
@@ -856,8 +863,10 @@ static struct interpret_node *build_parse_tree(struct interpret_context *ctx,
     state_array_destroy(&ctx->nfa_stack);
     follow_transition_reversed(ctx, &nfa_state, UINT32_MAX, UINT32_MAX,
      offset, offset + whitespace);
-    return construct_finish(&ctx->construct_state,
+    struct interpret_node *root = construct_finish(&ctx->construct_state,
      SIZE_MAX - ctx->next_action_offset + 1);
+    construct_free_pools(&ctx->construct_state);
+    return root;
 }
 
 static symbol_id token_symbol(struct combined_grammar *combined,
@@ -975,21 +984,21 @@ static void destroy_parse_tree(struct interpret_node *tree)
     }
 }
 
-static size_t read_whitespace(const char *text, void *info)
+static size_t read_whitespace(const char *text, size_t length, void *info)
 {
     struct grammar *grammar = ((struct tokenizer_info *)info)->context->grammar;
     size_t max_len = 0;
     for (uint32_t i = 0; i < grammar->number_of_whitespace_tokens; ++i) {
         struct token token = grammar->whitespace_tokens[i];
-        if (token.length > max_len && !strncmp((const char *)text, token.string,
-         token.length))
+        if (token.length > max_len && token.length <= length &&
+         !strncmp((const char *)text, token.string, token.length))
             max_len = token.length;
     }
     return max_len;
 }
 
 static size_t read_keyword_token(uint32_t *token, bool *end_token,
- const char *text, void *info)
+ const char *text, size_t length, void *info)
 {
     struct grammar *grammar = ((struct tokenizer_info *)info)->context->grammar;
     struct combined_grammar *combined =
@@ -999,8 +1008,8 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token,
     bool end = false;
     for (uint32_t i = 0; i < combined->number_of_keyword_tokens; ++i) {
         struct token token = combined->tokens[i];
-        if (token.length > max_len && !strncmp((const char *)text, token.string,
-         token.length)) {
+        if (token.length > max_len && token.length <= length &&
+         !strncmp((const char *)text, token.string, token.length)) {
             max_len = token.length;
             symbol = i;
             end = token.type == TOKEN_END;
@@ -1008,8 +1017,8 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token,
     }
     for (uint32_t i = 0; i < grammar->number_of_comment_tokens; ++i) {
         struct token token = grammar->comment_tokens[i];
-        if (token.length > max_len && !strncmp((const char *)text, token.string,
-         token.length)) {
+        if (token.length > max_len && token.length <= length &&
+         !strncmp((const char *)text, token.string, token.length)) {
             max_len = token.length;
             symbol = COMMENT_TOKEN;
             end = false;
@@ -1021,7 +1030,7 @@ static size_t read_keyword_token(uint32_t *token, bool *end_token,
 }
 
 static bool read_custom_token(uint32_t *token, size_t *token_length,
- const char *text, bool *whitespace, void **data, void *info)
+ const char *text, size_t length, bool *whitespace, void **data, void *info)
 {
     struct interpret_context *ctx = ((struct tokenizer_info *)info)->context;
     struct combined_grammar *combined = ctx->combined;
@@ -1034,7 +1043,7 @@ static bool read_custom_token(uint32_t *token, size_t *token_length,
         if (r->number_of_token_exemplars > 0) {
             for (uint32_t j = 0; j < r->number_of_token_exemplars; ++j) {
                 struct token e = r->token_exemplars[j];
-                if (e.length > *token_length &&
+                if (e.length > *token_length && e.length <= length &&
                  !strncmp(text, e.string, e.length)) {
                     *token_length = e.length;
                     *token = combined->tokens[i].symbol;
@@ -1042,6 +1051,7 @@ static bool read_custom_token(uint32_t *token, size_t *token_length,
                 }
             }
         } else if (r->name_length > *token_length &&
+         r->name_length <= length &&
          !strncmp(text, r->name, r->name_length)) {
             *token_length = r->name_length;
             *token = combined->tokens[i].symbol;
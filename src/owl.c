@@ -15,6 +15,8 @@ static struct terminal_info get_terminal_info(int fileno);
 static FILE *fopen_or_error(const char *filename, const char *mode);
 static char *read_string(FILE *file);
 static void write_to_output(const char *string, size_t len);
+static enum generator_backend backend_from_name(const char *name);
+static enum generator_tree_layout tree_layout_from_name(const char *name);
 
 static const char *version_string = "owl.v4";
 static const char *compatible_versions[] = {
@@ -41,12 +43,18 @@ int main(int argc, char *argv[])
     char *input_string = 0;
     bool compile = false;
     bool test_format = false;
+    bool hash_keywords = false;
+    enum generator_backend backend = GENERATOR_BACKEND_FUNCTIONS;
+    enum generator_tree_layout tree_layout = GENERATOR_TREE_LAYOUT_PACKED;
+    bool split_root = false;
     enum {
         NO_PARAMETER,
         INPUT_FILE_PARAMETER,
         OUTPUT_FILE_PARAMETER,
         GRAMMAR_TEXT_PARAMETER,
         PREFIX_PARAMETER,
+        BACKEND_PARAMETER,
+        TREE_LAYOUT_PARAMETER,
     } parameter_state = NO_PARAMETER;
     for (int i = 1; i < argc; ++i) {
         const char *short_name = "";
@@ -89,6 +97,21 @@ int main(int argc, char *argv[])
             else if (!strcmp(short_name, "c") ||
              !strcmp(long_name, "compile"))
                 compile = true;
+            else if (!strcmp(short_name, "K") ||
+             !strcmp(long_name, "hash-keywords"))
+                hash_keywords = true;
+            else if (!strcmp(long_name, "backend"))
+                parameter_state = BACKEND_PARAMETER;
+            else if (!strncmp(long_name, "backend=", strlen("backend=")))
+                backend = backend_from_name(long_name + strlen("backend="));
+            else if (!strcmp(long_name, "tree-layout"))
+                parameter_state = TREE_LAYOUT_PARAMETER;
+            else if (!strncmp(long_name, "tree-layout=", strlen("tree-layout="))) {
+                tree_layout = tree_layout_from_name(long_name +
+                 strlen("tree-layout="));
+            }
+            else if (!strcmp(long_name, "split-root"))
+                split_root = true;
             else if (!strcmp(short_name, "C") || !strcmp(long_name, "color"))
                 force_terminal_colors = true;
             else if (long_name[0] || short_name[0]) {
@@ -148,6 +171,26 @@ int main(int argc, char *argv[])
             prefix_string = argv[i];
             parameter_state = NO_PARAMETER;
             break;
+        case BACKEND_PARAMETER:
+            if (short_name[0] || long_name[0]) {
+                errorf("missing backend");
+                print_error();
+                needs_help = true;
+                break;
+            }
+            backend = backend_from_name(argv[i]);
+            parameter_state = NO_PARAMETER;
+            break;
+        case TREE_LAYOUT_PARAMETER:
+            if (short_name[0] || long_name[0]) {
+                errorf("missing tree layout");
+                print_error();
+                needs_help = true;
+                break;
+            }
+            tree_layout = tree_layout_from_name(argv[i]);
+            parameter_state = NO_PARAMETER;
+            break;
         }
         }
         if (needs_help)
@@ -174,6 +217,16 @@ int main(int argc, char *argv[])
         print_error();
         needs_help = true;
         break;
+    case BACKEND_PARAMETER:
+        errorf("missing backend");
+        print_error();
+        needs_help = true;
+        break;
+    case TREE_LAYOUT_PARAMETER:
+        errorf("missing tree layout");
+        print_error();
+        needs_help = true;
+        break;
     case NO_PARAMETER:
         break;
     }
@@ -189,6 +242,10 @@ int main(int argc, char *argv[])
         fprintf(stderr, " -c          --compile          output a C header file instead of parsing input\n");
         fprintf(stderr, " -g grammar  --grammar grammar  specify the grammar text on the command line\n");
         fprintf(stderr, " -p prefix   --prefix prefix    output prefix_ instead of owl_ and parsed_\n");
+        fprintf(stderr, " -K          --hash-keywords    match identifier-like keywords with a perfect hash\n");
+        fprintf(stderr, "             --backend name     generate 'functions' (default) or a 'table' automaton\n");
+        fprintf(stderr, "             --tree-layout name lay out the tree 'packed' (default), 'fixed', or 'relative'\n");
+        fprintf(stderr, "             --split-root       build the root rule's tree on several threads\n");
         fprintf(stderr, " -T          --test-format      use test format with combined input and grammar\n");
         fprintf(stderr, " -C          --color            force 256-color parse tree output\n");
         fprintf(stderr, " -V          --version          print version info and exit\n");
@@ -349,6 +406,10 @@ int main(int argc, char *argv[])
             .deterministic = &deterministic,
             .version = version,
             .prefix = prefix_string,
+            .hash_keywords = hash_keywords,
+            .backend = backend,
+            .tree_layout = tree_layout,
+            .split_root = split_root,
         };
         generate(&generator);
 #ifndef NOT_UNIX
@@ -437,6 +498,28 @@ static FILE *fopen_or_error(const char *filename, const char *mode)
     exit(-1);
 }
 
+static enum generator_backend backend_from_name(const char *name)
+{
+    if (!strcmp(name, "functions"))
+        return GENERATOR_BACKEND_FUNCTIONS;
+    if (!strcmp(name, "table"))
+        return GENERATOR_BACKEND_TABLE;
+    exit_with_errorf("unknown backend '%s' (expected 'functions' or 'table')",
+     name);
+}
+
+static enum generator_tree_layout tree_layout_from_name(const char *name)
+{
+    if (!strcmp(name, "packed"))
+        return GENERATOR_TREE_LAYOUT_PACKED;
+    if (!strcmp(name, "fixed"))
+        return GENERATOR_TREE_LAYOUT_FIXED;
+    if (!strcmp(name, "relative"))
+        return GENERATOR_TREE_LAYOUT_RELATIVE;
+    exit_with_errorf("unknown tree layout '%s' (expected 'packed', 'fixed', or "
+     "'relative')", name);
+}
+
 static char *read_string(FILE *file)
 {
     char *string = 0;
@@ -21,6 +21,9 @@ void begin_test_compilation(struct test_compilation *t)
     t->args[i++] = "-Wno-unused-function"; // Modern compilers all understand DCE and functions/variables
     t->args[i++] = "-Wno-unused-variable"; // that go unused for some grammars may be necessary for others
     t->args[i++] = "-Wno-unused-but-set-variable";
+    bool threads = getenv("OWL_TEST_THREADS") != 0;
+    if (threads)
+        t->args[i++] = "-pthread";
     t->args[i++] = "-x";
     t->args[i++] = "c";
     t->args[i++] = "-";
@@ -30,15 +33,298 @@ void begin_test_compilation(struct test_compilation *t)
     t->program = t->args[0];
     spawn_child(t);
     fprintf(t->file, "#define OWL_PARSER_IMPLEMENTATION\n");
+    // Turn on every optional part of the parser so it all gets tested.
+    fprintf(t->file, "#define OWL_PARSER_API\n");
+    fprintf(t->file, "#define OWL_BATCH\n");
+    fprintf(t->file, "#define OWL_COMPACT\n");
+    fprintf(t->file, "#define OWL_INDEX\n");
+    fprintf(t->file, "#define OWL_BUILDER\n");
+    // Tokenize after every piece of input to exercise tokens which are split
+    // between pieces.
+    fprintf(t->file, "#define FEED_BATCH_SIZE 1\n");
+    // With OWL_TEST_THREADS set, split even the smallest inputs between
+    // threads so tests exercise the threaded code.
+    if (threads) {
+        fprintf(t->file, "#define OWL_THREADS\n");
+        fprintf(t->file, "#define OWL_THREAD_MIN_RUNS 1\n");
+        fprintf(t->file, "#define OWL_THREAD_MIN_BYTES 1\n");
+    }
 }
 
 void finish_test_compilation(struct test_compilation *t, char *input_string)
 {
-    fprintf(t->file, "int main() {\n");
-    fprintf(t->file, "    struct owl_tree *tree;\n");
-    fprintf(t->file, "    tree = owl_tree_create_from_file(stdin);\n");
+    fprintf(t->file, "#include <unistd.h>\n");
+    // Trees are compared by printing them to temporary files.
+    fprintf(t->file, "static FILE *print_to_file(struct owl_tree *tree) {\n");
+    fprintf(t->file, "    FILE *file = tmpfile();\n");
+    fprintf(t->file, "    int out = dup(STDOUT_FILENO);\n");
+    fprintf(t->file, "    fflush(stdout);\n");
+    fprintf(t->file, "    dup2(fileno(file), STDOUT_FILENO);\n");
     fprintf(t->file, "    owl_tree_print(tree);\n");
+    fprintf(t->file, "    fflush(stdout);\n");
+    fprintf(t->file, "    dup2(out, STDOUT_FILENO);\n");
+    fprintf(t->file, "    close(out);\n");
+    fprintf(t->file, "    rewind(file);\n");
+    fprintf(t->file, "    return file;\n");
+    fprintf(t->file, "}\n");
+    fprintf(t->file, "static bool same_output(FILE *a, FILE *b) {\n");
+    fprintf(t->file, "    int c, d;\n");
+    fprintf(t->file, "    while ((c = getc(a)) == (d = getc(b)) && c != EOF)\n");
+    fprintf(t->file, "        ;\n");
+    fprintf(t->file, "    rewind(a);\n");
+    fprintf(t->file, "    rewind(b);\n");
+    fprintf(t->file, "    return c == d;\n");
+    fprintf(t->file, "}\n");
+    fprintf(t->file, "static bool same_error(struct owl_tree *a, struct owl_tree *b) {\n");
+    fprintf(t->file, "    struct source_range a_range = { 0 };\n");
+    fprintf(t->file, "    struct source_range b_range = { 0 };\n");
+    fprintf(t->file, "    enum owl_error error = owl_tree_get_error(a, &a_range);\n");
+    fprintf(t->file, "    return owl_tree_get_error(b, &b_range) == error && (error == ERROR_NONE || (a_range.start == b_range.start && a_range.end == b_range.end));\n");
+    fprintf(t->file, "}\n");
+    fprintf(t->file, "// Checks that `other` matches `tree`, which printed as `printed` (or had an\n");
+    fprintf(t->file, "// error), then destroys `other`.\n");
+    fprintf(t->file, "static void compare_trees(struct owl_tree *tree, FILE *printed, struct owl_tree *other, const char *name) {\n");
+    fprintf(t->file, "    bool same = same_error(tree, other);\n");
+    fprintf(t->file, "    if (same && printed) {\n");
+    fprintf(t->file, "        FILE *other_printed = print_to_file(other);\n");
+    fprintf(t->file, "        same = same_output(printed, other_printed);\n");
+    fprintf(t->file, "        fclose(other_printed);\n");
+    fprintf(t->file, "    }\n");
+    fprintf(t->file, "    if (!same)\n");
+    fprintf(t->file, "        fprintf(stderr, \"%%s gave a different result\\n\", name);\n");
+    fprintf(t->file, "    owl_tree_destroy(other);\n");
+    fprintf(t->file, "}\n");
+    fprintf(t->file, "// Every match in the tree, for checking the indexes against.\n");
+    fprintf(t->file, "struct walked_match {\n");
+    fprintf(t->file, "    struct owl_ref ref;\n");
+    fprintf(t->file, "    size_t start;\n");
+    fprintf(t->file, "    size_t end;\n");
+    fprintf(t->file, "    uint32_t type;\n");
+    fprintf(t->file, "    // The match's place in a preorder walk of the tree.\n");
+    fprintf(t->file, "    size_t order;\n");
+    fprintf(t->file, "};\n");
+    fprintf(t->file, "struct walk {\n");
+    fprintf(t->file, "    struct walked_match *matches;\n");
+    fprintf(t->file, "    size_t count;\n");
+    fprintf(t->file, "    size_t capacity;\n");
+    fprintf(t->file, "    uint32_t max_rule;\n");
+    fprintf(t->file, "    uint32_t max_type;\n");
+    fprintf(t->file, "};\n");
+    fprintf(t->file, "static void walk_list(struct walk *w, struct owl_ref ref) {\n");
+    fprintf(t->file, "    for (; !ref.empty; ref = owl_next(ref)) {\n");
+    fprintf(t->file, "        struct compact_element e;\n");
+    fprintf(t->file, "        describe_element(ref, &e);\n");
+    fprintf(t->file, "        if (w->count == w->capacity) {\n");
+    fprintf(t->file, "            w->capacity = w->capacity ? 2 * w->capacity : 64;\n");
+    fprintf(t->file, "            w->matches = realloc(w->matches, w->capacity * sizeof(struct walked_match));\n");
+    fprintf(t->file, "            if (!w->matches)\n");
+    fprintf(t->file, "                abort();\n");
+    fprintf(t->file, "        }\n");
+    fprintf(t->file, "        w->matches[w->count] = (struct walked_match){ ref, e.start, e.end, e.type, w->count };\n");
+    fprintf(t->file, "        w->count++;\n");
+    fprintf(t->file, "        if (ref._type > w->max_rule)\n");
+    fprintf(t->file, "            w->max_rule = ref._type;\n");
+    fprintf(t->file, "        if (e.type > w->max_type)\n");
+    fprintf(t->file, "            w->max_type = e.type;\n");
+    fprintf(t->file, "        for (size_t i = 0; i < e.number_of_slots; ++i)\n");
+    fprintf(t->file, "            walk_list(w, e.slots[i]);\n");
+    fprintf(t->file, "    }\n");
+    fprintf(t->file, "}\n");
+    // A rule's fields are walked one after another, so a preorder walk isn't
+    // in source order; sorting it by start location puts it in the same order
+    // as the indexes.  Matches which start at the same place are nested, and
+    // preorder puts the outer one first.
+    fprintf(t->file, "static int compare_walked_matches(const void *a, const void *b) {\n");
+    fprintf(t->file, "    const struct walked_match *m = a;\n");
+    fprintf(t->file, "    const struct walked_match *n = b;\n");
+    fprintf(t->file, "    if (m->start != n->start)\n");
+    fprintf(t->file, "        return m->start < n->start ? -1 : 1;\n");
+    fprintf(t->file, "    return m->order < n->order ? -1 : m->order > n->order;\n");
+    fprintf(t->file, "}\n");
+    fprintf(t->file, "// Checks that the refs are the matches in the walk which start in the range.\n");
+    fprintf(t->file, "static void check_range(struct owl_tree *tree, struct walk *w, size_t start, size_t end, const char *when) {\n");
+    fprintf(t->file, "    size_t first = 0;\n");
+    fprintf(t->file, "    size_t last = w->count;\n");
+    fprintf(t->file, "    while (first < last) {\n");
+    fprintf(t->file, "        size_t middle = first + (last - first) / 2;\n");
+    fprintf(t->file, "        if (w->matches[middle].start < start)\n");
+    fprintf(t->file, "            first = middle + 1;\n");
+    fprintf(t->file, "        else\n");
+    fprintf(t->file, "            last = middle;\n");
+    fprintf(t->file, "    }\n");
+    fprintf(t->file, "    size_t count;\n");
+    fprintf(t->file, "    const struct owl_ref *refs = owl_tree_nodes_in_range(tree, start, end, &count);\n");
+    fprintf(t->file, "    bool same = first + count <= w->count && (first + count == w->count || w->matches[first + count].start >= end);\n");
+    fprintf(t->file, "    for (size_t i = 0; i < count && same; ++i)\n");
+    fprintf(t->file, "        same = owl_refs_equal(refs[i], w->matches[first + i].ref) && w->matches[first + i].start < end;\n");
+    fprintf(t->file, "    if (!same)\n");
+    fprintf(t->file, "        fprintf(stderr, \"owl_tree_nodes_in_range(%%zu, %%zu) disagrees with the tree %%s\\n\", start, end, when);\n");
+    fprintf(t->file, "}\n");
+    fprintf(t->file, "// Checks the rule and location indexes against a walk of the tree.\n");
+    fprintf(t->file, "static void check_indexes(struct owl_tree *tree, size_t input_length, const char *when) {\n");
+    fprintf(t->file, "    struct walk w = { 0 };\n");
+    fprintf(t->file, "    walk_list(&w, owl_tree_root_ref(tree));\n");
+    fprintf(t->file, "    qsort(w.matches, w.count, sizeof(struct walked_match), compare_walked_matches);\n");
+    fprintf(t->file, "    // The nth match of a rule in the walk should be the nth match in its list.\n");
+    fprintf(t->file, "    size_t rules = w.max_rule + 1;\n");
+    fprintf(t->file, "    size_t types = w.max_type + 1;\n");
+    fprintf(t->file, "    size_t *seen = calloc(rules * types, sizeof(size_t));\n");
+    fprintf(t->file, "    if (!seen)\n");
+    fprintf(t->file, "        abort();\n");
+    fprintf(t->file, "    for (size_t i = 0; i < w.count; ++i) {\n");
+    fprintf(t->file, "        struct walked_match *m = &w.matches[i];\n");
+    fprintf(t->file, "        uint32_t rule = m->ref._type;\n");
+    fprintf(t->file, "        size_t count;\n");
+    fprintf(t->file, "        const struct owl_ref *refs = owl_tree_nodes_of_rule(tree, rule, &count);\n");
+    fprintf(t->file, "        size_t n = seen[rule * types]++;\n");
+    fprintf(t->file, "        if (n >= count || !owl_refs_equal(refs[n], m->ref) || owl_ref_rule(refs[n]) != rule)\n");
+    fprintf(t->file, "            fprintf(stderr, \"owl_tree_nodes_of_rule(%%u) disagrees with the tree %%s\\n\", (unsigned)rule, when);\n");
+    fprintf(t->file, "        if (m->type) {\n");
+    fprintf(t->file, "            // owl_tree_nodes_of_option() only exists for grammars with named\n");
+    fprintf(t->file, "            // options, so read the list it would return directly.\n");
+    fprintf(t->file, "            struct match_list *list = &tree->rule_index->lists[option_list(rule, m->type)];\n");
+    fprintf(t->file, "            refs = list->matches;\n");
+    fprintf(t->file, "            count = list->count;\n");
+    fprintf(t->file, "            n = seen[rule * types + m->type]++;\n");
+    fprintf(t->file, "            if (n >= count || !owl_refs_equal(refs[n], m->ref))\n");
+    fprintf(t->file, "                fprintf(stderr, \"owl_tree_nodes_of_option(%%u, %%u) disagrees with the tree %%s\\n\", (unsigned)rule, (unsigned)m->type, when);\n");
+    fprintf(t->file, "        }\n");
+    fprintf(t->file, "        check_range(tree, &w, m->start, m->end, when);\n");
+    fprintf(t->file, "    }\n");
+    fprintf(t->file, "    for (uint32_t rule = 0; rule < rules; ++rule) {\n");
+    fprintf(t->file, "        for (uint32_t type = 0; type < types; ++type) {\n");
+    fprintf(t->file, "            size_t count;\n");
+    fprintf(t->file, "            if (type == 0)\n");
+    fprintf(t->file, "                owl_tree_nodes_of_rule(tree, rule, &count);\n");
+    fprintf(t->file, "            else if (seen[rule * types + type])\n");
+    fprintf(t->file, "                count = tree->rule_index->lists[option_list(rule, type)].count;\n");
+    fprintf(t->file, "            else\n");
+    fprintf(t->file, "                continue;\n");
+    fprintf(t->file, "            if (count != seen[rule * types + type])\n");
+    fprintf(t->file, "                fprintf(stderr, \"the index of rule %%u, option %%u has the wrong number of matches %%s\\n\", (unsigned)rule, (unsigned)type, when);\n");
+    fprintf(t->file, "        }\n");
+    fprintf(t->file, "    }\n");
+    fprintf(t->file, "    free(seen);\n");
+    fprintf(t->file, "    // Matches later in the walk which contain a location are inside the\n");
+    fprintf(t->file, "    // earlier ones, so the last one to contain it is the innermost.\n");
+    fprintf(t->file, "    size_t *innermost = malloc((input_length + 1) * sizeof(size_t));\n");
+    fprintf(t->file, "    if (!innermost)\n");
+    fprintf(t->file, "        abort();\n");
+    fprintf(t->file, "    for (size_t i = 0; i <= input_length; ++i)\n");
+    fprintf(t->file, "        innermost[i] = SIZE_MAX;\n");
+    fprintf(t->file, "    for (size_t i = 0; i < w.count; ++i) {\n");
+    fprintf(t->file, "        for (size_t j = w.matches[i].start; j < w.matches[i].end && j <= input_length; ++j)\n");
+    fprintf(t->file, "            innermost[j] = i;\n");
+    fprintf(t->file, "    }\n");
+    fprintf(t->file, "    for (size_t i = 0; i <= input_length; ++i) {\n");
+    fprintf(t->file, "        struct owl_ref ref = owl_tree_node_at(tree, i);\n");
+    fprintf(t->file, "        if (innermost[i] == SIZE_MAX ? !ref.empty : ref.empty || !owl_refs_equal(ref, w.matches[innermost[i]].ref))\n");
+    fprintf(t->file, "            fprintf(stderr, \"owl_tree_node_at(%%zu) disagrees with the tree %%s\\n\", i, when);\n");
+    fprintf(t->file, "        check_range(tree, &w, i, i + 1, when);\n");
+    fprintf(t->file, "    }\n");
+    fprintf(t->file, "    check_range(tree, &w, 0, input_length + 1, when);\n");
+    fprintf(t->file, "    free(innermost);\n");
+    fprintf(t->file, "    free(w.matches);\n");
+    fprintf(t->file, "}\n");
+    fprintf(t->file, "int main() {\n");
+    // Indexing every tree a parser parses is tested here; the tree from the
+    // whole string below tests building, sorting, and compacting indexes.
+    fprintf(t->file, "    struct owl_parser *parser = owl_parser_create_with_options((struct owl_tree_options){ .index_rules = true, .index_locations = true });\n");
+    fprintf(t->file, "    char chunk[3];\n");
+    fprintf(t->file, "    size_t length;\n");
+    fprintf(t->file, "    size_t capacity = 4096;\n");
+    fprintf(t->file, "    char *input = malloc(capacity);\n");
+    fprintf(t->file, "    size_t input_length = 0;\n");
+    fprintf(t->file, "    bool feeding = true;\n");
+    fprintf(t->file, "    while ((length = fread(chunk, 1, sizeof(chunk), stdin)) > 0) {\n");
+    fprintf(t->file, "        if (input_length + length >= capacity) {\n");
+    fprintf(t->file, "            capacity *= 2;\n");
+    fprintf(t->file, "            input = realloc(input, capacity);\n");
+    fprintf(t->file, "        }\n");
+    fprintf(t->file, "        if (!input) {\n");
+    fprintf(t->file, "            fprintf(stderr, \"couldn't allocate memory for the input\\n\");\n");
+    fprintf(t->file, "            return 1;\n");
+    fprintf(t->file, "        }\n");
+    fprintf(t->file, "        memcpy(input + input_length, chunk, length);\n");
+    fprintf(t->file, "        input_length += length;\n");
+    fprintf(t->file, "        if (feeding)\n");
+    fprintf(t->file, "            feeding = owl_parser_feed(parser, chunk, length);\n");
+    fprintf(t->file, "    }\n");
+    fprintf(t->file, "    input[input_length] = '\\0';\n");
+    fprintf(t->file, "    struct owl_tree *streamed = owl_parser_finish(parser);\n");
+    fprintf(t->file, "    struct owl_tree *tree = owl_tree_create_with_options((struct owl_tree_options){ .string = input, .length = input_length, .has_length = true, .index_rules = true, .index_locations = true });\n");
+    fprintf(t->file, "    FILE *printed = 0;\n");
+    fprintf(t->file, "    if (owl_tree_get_error(tree, 0) == ERROR_NONE)\n");
+    fprintf(t->file, "        printed = print_to_file(tree);\n");
+    // A streaming parser can't see past the input that's arrived so far, so
+    // on invalid input it may report an earlier error than parsing the whole
+    // string does.  Valid input should give the same tree either way.
+    fprintf(t->file, "    if (printed)\n");
+    fprintf(t->file, "        compare_trees(tree, printed, streamed, \"owl_parser_finish\");\n");
+    fprintf(t->file, "    else\n");
+    fprintf(t->file, "        owl_tree_destroy(streamed);\n");
+    // Parsing the whole input from a string or a file should give the same
+    // tree as parsing it with its length.
+    fprintf(t->file, "    compare_trees(tree, printed, owl_tree_create_from_string(input), \"owl_tree_create_from_string\");\n");
+    fprintf(t->file, "    FILE *input_file = tmpfile();\n");
+    fprintf(t->file, "    fwrite(input, 1, input_length, input_file);\n");
+    fprintf(t->file, "    rewind(input_file);\n");
+    fprintf(t->file, "    compare_trees(tree, printed, owl_tree_create_from_file(input_file), \"owl_tree_create_from_file\");\n");
+    fprintf(t->file, "    fclose(input_file);\n");
+    // Parsing on several threads, or tokenizing on a second thread, should
+    // give the same tree as parsing on one.
+    fprintf(t->file, "#ifdef OWL_THREADS\n");
+    fprintf(t->file, "    unsigned thread_counts[] = { 2, 4, 16 };\n");
+    fprintf(t->file, "    for (int i = 0; i < 3; ++i)\n");
+    fprintf(t->file, "        compare_trees(tree, printed, owl_tree_create_with_options((struct owl_tree_options){ .string = input, .length = input_length, .has_length = true, .threads = thread_counts[i] }), \"owl_tree_create_with_options with several threads\");\n");
+    fprintf(t->file, "    compare_trees(tree, printed, owl_tree_create_with_options((struct owl_tree_options){ .string = input, .length = input_length, .has_length = true, .pipeline = true }), \"owl_tree_create_with_options with a pipeline\");\n");
+    fprintf(t->file, "#endif\n");
+    // Validating the input should report the same error as parsing it.
+    fprintf(t->file, "    struct source_range range = { 0 };\n");
+    fprintf(t->file, "    struct source_range validate_range = { 0 };\n");
+    fprintf(t->file, "    enum owl_error error = owl_tree_get_error(tree, &range);\n");
+    fprintf(t->file, "    if (owl_validate(input, input_length, &validate_range) != error || (error != ERROR_NONE && (range.start != validate_range.start || range.end != validate_range.end)))\n");
+    fprintf(t->file, "        fprintf(stderr, \"owl_validate disagrees with owl_tree_create_with_options\\n\");\n");
+    fprintf(t->file, "#ifdef OWL_THREADS\n");
+    fprintf(t->file, "    for (int i = 0; i < 3; ++i) {\n");
+    fprintf(t->file, "        if (owl_validate_with_options((struct owl_tree_options){ .string = input, .length = input_length, .has_length = true, .threads = thread_counts[i] }, &validate_range) != error || (error != ERROR_NONE && (range.start != validate_range.start || range.end != validate_range.end)))\n");
+    fprintf(t->file, "            fprintf(stderr, \"owl_validate_with_options with %%u threads disagrees with owl_tree_create_with_options\\n\", thread_counts[i]);\n");
+    fprintf(t->file, "    }\n");
+    fprintf(t->file, "#endif\n");
+    // Each string in a batch should get the same tree as it would on its own.
+    // The batch includes an empty string and a prefix of the input.
+    fprintf(t->file, "    const char *batch[] = { input, input, \"\", input };\n");
+    fprintf(t->file, "    size_t batch_lengths[] = { input_length, input_length / 2, 0, input_length };\n");
+    fprintf(t->file, "    struct owl_tree *batch_trees[4];\n");
+    fprintf(t->file, "    owl_parse_batch(batch, batch_lengths, 4, batch_trees, 3);\n");
+    fprintf(t->file, "    for (int i = 0; i < 4; ++i) {\n");
+    fprintf(t->file, "        struct owl_tree *alone = owl_tree_create_with_options((struct owl_tree_options){ .string = batch[i], .length = batch_lengths[i], .has_length = true });\n");
+    fprintf(t->file, "        FILE *alone_printed = 0;\n");
+    fprintf(t->file, "        if (owl_tree_get_error(alone, 0) == ERROR_NONE)\n");
+    fprintf(t->file, "            alone_printed = print_to_file(alone);\n");
+    fprintf(t->file, "        compare_trees(alone, alone_printed, batch_trees[i], \"owl_parse_batch\");\n");
+    fprintf(t->file, "        if (alone_printed)\n");
+    fprintf(t->file, "            fclose(alone_printed);\n");
+    fprintf(t->file, "        owl_tree_destroy(alone);\n");
+    fprintf(t->file, "    }\n");
+    // Compacting the tree shouldn't change how it prints, and the indexes
+    // should match a walk of the tree both before and after.
+    fprintf(t->file, "    if (printed) {\n");
+    fprintf(t->file, "        check_indexes(tree, input_length, \"before compacting\");\n");
+    fprintf(t->file, "        owl_tree_compact(tree);\n");
+    fprintf(t->file, "        check_indexes(tree, input_length, \"after compacting\");\n");
+    fprintf(t->file, "        FILE *compacted = print_to_file(tree);\n");
+    fprintf(t->file, "        if (!same_output(printed, compacted))\n");
+    fprintf(t->file, "            fprintf(stderr, \"owl_tree_compact changed the tree\\n\");\n");
+    fprintf(t->file, "        fclose(compacted);\n");
+    fprintf(t->file, "        int c;\n");
+    fprintf(t->file, "        while ((c = getc(printed)) != EOF)\n");
+    fprintf(t->file, "            putchar(c);\n");
+    fprintf(t->file, "        fclose(printed);\n");
+    fprintf(t->file, "    } else\n");
+    fprintf(t->file, "        owl_tree_print(tree);\n");
     fprintf(t->file, "    owl_tree_destroy(tree);\n");
+    fprintf(t->file, "    free(input);\n");
     fprintf(t->file, "    return 0;\n");
     fprintf(t->file, "}\n");
     fclose(t->file);
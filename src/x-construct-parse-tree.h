@@ -25,6 +25,19 @@
 #define FINISH_TOKEN(rule, next_sibling, info) 0
 #endif
 
+#ifndef ALLOCATE_MEMORY
+#define ALLOCATE_MEMORY(size, allocator) malloc(size)
+#endif
+
+#ifndef REALLOCATE_MEMORY
+#define REALLOCATE_MEMORY(pointer, old_size, new_size, allocator) \
+ realloc(pointer, new_size)
+#endif
+
+#ifndef FREE_MEMORY
+#define FREE_MEMORY(pointer, size, allocator) free(pointer)
+#endif
+
 #ifndef RULE_T
 #error Please define the RULE_T type.
 #endif
@@ -69,6 +82,9 @@ struct construct_node {
 
     size_t number_of_slots;
     FINISHED_NODE_T *slots;
+    // The number of slots allocated, which can be more than number_of_slots
+    // when the node has been reused.
+    size_t slots_capacity;
 
     RULE_T rule;
 
@@ -114,6 +130,9 @@ struct construct_state {
     struct construct_expression *expression_freelist;
 
     void *info;
+
+    // The `allocator` pointer is passed to the *_MEMORY macros.
+    void *allocator;
 };
 
 static struct construct_node *construct_node_alloc(struct construct_state *s,
@@ -125,21 +144,33 @@ static struct construct_node *construct_node_alloc(struct construct_state *s,
         node = s->node_freelist;
         s->node_freelist = node->next;
         FINISHED_NODE_T *slots = node->slots;
-        if (number_of_slots > node->number_of_slots) {
-            slots = realloc(slots, number_of_slots * sizeof(FINISHED_NODE_T));
+        size_t slots_capacity = node->slots_capacity;
+        if (number_of_slots > slots_capacity) {
+            slots = REALLOCATE_MEMORY(slots,
+             slots_capacity * sizeof(FINISHED_NODE_T),
+             number_of_slots * sizeof(FINISHED_NODE_T), s->allocator);
             if (!slots)
                 abort();
+            slots_capacity = number_of_slots;
         }
         memset(node, 0, sizeof(struct construct_node));
-        memset(slots, 0, number_of_slots * sizeof(FINISHED_NODE_T));
+        if (number_of_slots > 0)
+            memset(slots, 0, number_of_slots * sizeof(FINISHED_NODE_T));
         node->slots = slots;
+        node->slots_capacity = slots_capacity;
     } else {
-        node = calloc(1, sizeof(struct construct_node));
+        node = ALLOCATE_MEMORY(sizeof(struct construct_node), s->allocator);
         if (!node)
             abort();
-        node->slots = calloc(number_of_slots, sizeof(FINISHED_NODE_T));
-        if (number_of_slots > 0 && !node->slots)
-            abort();
+        memset(node, 0, sizeof(struct construct_node));
+        if (number_of_slots > 0) {
+            node->slots = ALLOCATE_MEMORY(number_of_slots *
+             sizeof(FINISHED_NODE_T), s->allocator);
+            if (!node->slots)
+                abort();
+            memset(node->slots, 0, number_of_slots * sizeof(FINISHED_NODE_T));
+        }
+        node->slots_capacity = number_of_slots;
     }
     node->rule = rule;
     node->number_of_slots = number_of_slots;
@@ -155,9 +186,11 @@ static struct construct_expression *construct_expression_alloc(struct
         s->expression_freelist = expr->parent;
         memset(expr, 0, sizeof(struct construct_expression));
     } else {
-        expr = calloc(1, sizeof(struct construct_expression));
+        expr = ALLOCATE_MEMORY(sizeof(struct construct_expression),
+         s->allocator);
         if (!expr)
             abort();
+        memset(expr, 0, sizeof(struct construct_expression));
     }
     LEFT_RIGHT_OPERAND_SLOTS_LOOKUP(rule, expr->left_slot_index,
      expr->right_slot_index, expr->operand_slot_index, s->info);
@@ -316,19 +349,24 @@ static FINISHED_NODE_T construct_finish(struct construct_state *s,
         finished = FINISH_NODE_STRUCT(node, 0, s->info);
         construct_node_free(s, node);
     }
-    // Clean up memory.
+    return finished;
+}
+
+// Frees the nodes and expressions kept for reuse.
+static void construct_free_pools(struct construct_state *s)
+{
     while (s->node_freelist) {
         struct construct_node *node = s->node_freelist;
         s->node_freelist = node->next;
-        free(node->slots);
-        free(node);
+        FREE_MEMORY(node->slots, node->slots_capacity * sizeof(FINISHED_NODE_T),
+         s->allocator);
+        FREE_MEMORY(node, sizeof(struct construct_node), s->allocator);
     }
     while (s->expression_freelist) {
         struct construct_expression *expr = s->expression_freelist;
         s->expression_freelist = expr->parent;
-        free(expr);
+        FREE_MEMORY(expr, sizeof(struct construct_expression), s->allocator);
     }
-    return finished;
 }
 
 static void construct_action_apply(struct construct_state *s, uint16_t action,
@@ -30,6 +30,11 @@
 #define READ_CUSTOM_TOKEN(...) (0)
 #endif
 
+#ifndef READ_NUMBER
+#define READ_NUMBER(text, length, number_length, allocator) \
+ (*(number_length) = 0, 0.0)
+#endif
+
 #ifndef NUMBER_TOKEN_DATA
 #define NUMBER_TOKEN_DATA(name) double name = 0
 #endif
@@ -71,10 +76,22 @@
 #define WRITE_CUSTOM_TOKEN(...)
 #endif
 
+#ifndef IF_IDENTIFIER_KEYWORDS
+#define IF_IDENTIFIER_KEYWORDS(...)
+#endif
+
 #ifndef ALLOCATE_STRING
 #define ALLOCATE_STRING(n, info) malloc(n)
 #endif
 
+#ifndef ALLOCATE_MEMORY
+#define ALLOCATE_MEMORY(size, allocator) malloc(size)
+#endif
+
+#ifndef FREE_MEMORY
+#define FREE_MEMORY(pointer, size, allocator) free(pointer)
+#endif
+
 #ifndef ESCAPE_CHAR
 #define ESCAPE_CHAR(c, info) (c)
 #endif
@@ -83,6 +100,25 @@
 #define ALLOW_DASHES_IN_IDENTIFIERS(...) false
 #endif
 
+// The SKIP_* macros return the offset of the first character at or after
+// `offset` (and before `end`) which doesn't continue the current run of
+// identifier characters, digits, string contents, or comment text.  The
+// compiler replaces these with vectorized scanners; the byte-at-a-time loops
+// below pick up wherever they leave off, so the defaults can simply return
+// `offset` unchanged.
+#ifndef SKIP_IDENTIFIER_CHARS
+#define SKIP_IDENTIFIER_CHARS(text, offset, end, info) (offset)
+#endif
+#ifndef SKIP_DIGITS
+#define SKIP_DIGITS(text, offset, end, hexadecimal) (offset)
+#endif
+#ifndef SKIP_STRING_CHARS
+#define SKIP_STRING_CHARS(text, offset, end, quote) (offset)
+#endif
+#ifndef SKIP_LINE
+#define SKIP_LINE(text, offset, end) (offset)
+#endif
+
 // Single-character string escapes.
 #define ESCAPE_CHAR_SINGLE(c, info) \
  ((c) == 'b' ? '\b' : \
@@ -120,7 +156,10 @@ struct owl_token_run {
 };
 
 struct owl_default_tokenizer {
+    // The text doesn't need to be zero-terminated; it ends at `length`.  Zero
+    // bytes within the text don't match any token.
     const char *text;
+    size_t length;
     size_t offset;
 
     size_t whitespace;
@@ -131,6 +170,25 @@ struct owl_default_tokenizer {
 
     // The `info` pointer is passed to READ_KEYWORD_TOKEN.
     void *info;
+
+    // When `more_input` is set, more text will follow `length`.  Tokens which
+    // start within `lookahead` bytes of the end, or whose scan runs into the
+    // end, might continue in text that hasn't arrived yet.  The tokenizer
+    // stops before them and sets `deferred`.
+    bool more_input;
+    bool deferred;
+    size_t lookahead;
+
+    // If `stop` is nonzero, tokens may only start before it.  Unlike `length`,
+    // it doesn't cut short a token which starts before it.
+    size_t stop;
+
+    // Runs which are no longer in use, linked through `prev`.  The tokenizer
+    // takes new runs from here before allocating them.
+    struct owl_token_run *free_runs;
+
+    // The `allocator` pointer is passed to ALLOCATE_MEMORY and FREE_MEMORY.
+    void *allocator;
 };
 
 static bool char_is_whitespace(char c)
@@ -178,6 +236,35 @@ static bool char_ends_identifier(char c)
     return c != '-';
 }
 
+// Reads eight bytes as a little-endian integer (the compiler turns this into a
+// single load on little-endian machines).
+static inline uint64_t read_eight_bytes(const char *text)
+{
+    uint8_t b[8];
+    memcpy(b, text, 8);
+    return (uint64_t)b[0] | (uint64_t)b[1] << 8 | (uint64_t)b[2] << 16 |
+     (uint64_t)b[3] << 24 | (uint64_t)b[4] << 32 | (uint64_t)b[5] << 40 |
+     (uint64_t)b[6] << 48 | (uint64_t)b[7] << 56;
+}
+
+// Checks all eight bytes from read_eight_bytes for digits at once.
+static inline bool eight_bytes_are_digits(uint64_t chunk)
+{
+    return !(((chunk + 0x4646464646464646) | (chunk - 0x3030303030303030)) &
+     0x8080808080808080);
+}
+
+// Converts eight digits from read_eight_bytes to their value with three
+// multiplications instead of eight.
+static inline uint32_t eight_digits_value(uint64_t chunk)
+{
+    chunk -= 0x3030303030303030;
+    chunk = chunk * 10 + (chunk >> 8);
+    chunk = ((chunk & 0x000000ff000000ff) * 0x000f424000000064 +
+     ((chunk >> 16) & 0x000000ff000000ff) * 0x0000271000000001) >> 32;
+    return (uint32_t)chunk;
+}
+
 static bool encode_length(struct owl_token_run *run, uint16_t *lengths_size,
  size_t length)
 {
@@ -232,20 +319,42 @@ static bool OWL_DONT_INLINE
 owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
  struct owl_token_run **previous_run)
 {
-    struct owl_token_run *run = malloc(sizeof(struct owl_token_run));
-    if (!run)
-        return false;
+    struct owl_token_run *run = tokenizer->free_runs;
+    if (run)
+        tokenizer->free_runs = run->prev;
+    else {
+        run = ALLOCATE_MEMORY(sizeof(struct owl_token_run),
+         tokenizer->allocator);
+        if (!run)
+            return false;
+    }
     uint16_t number_of_tokens = 0;
     uint16_t lengths_size = 0;
     const char *text = tokenizer->text;
     size_t whitespace = tokenizer->whitespace;
+    size_t length = tokenizer->length;
     size_t offset = tokenizer->offset;
+    // Tokens may only start before `token_limit`.  If more input is on its
+    // way, any scan which reaches `limit` must be deferred as well.
+    size_t limit = SIZE_MAX;
+    size_t token_limit = length;
+    if (tokenizer->more_input) {
+        limit = length;
+        token_limit = length > tokenizer->lookahead ?
+         length - tokenizer->lookahead : 0;
+    }
+    size_t token_stop = token_limit;
+    if (tokenizer->stop && tokenizer->stop < token_stop)
+        token_stop = tokenizer->stop;
+    bool deferred = false;
     while (number_of_tokens < TOKEN_RUN_LENGTH) {
-        char c = text[offset];
-        if (c == '\0')
+        if (offset >= token_stop) {
+            deferred = tokenizer->more_input && offset >= token_limit;
             break;
+        }
+        char c = text[offset];
         size_t whitespace_length = READ_WHITESPACE(text + offset,
-         tokenizer->info);
+         length - offset, tokenizer->info);
         if (whitespace_length > 0) {
             whitespace += whitespace_length;
             offset += whitespace_length;
@@ -262,14 +371,14 @@ owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
         bool custom_whitespace = false;
         bool has_escapes = false;
         size_t token_length = READ_KEYWORD_TOKEN(&token, &end_token,
-         text + offset, tokenizer->info);
+         text + offset, length - offset, tokenizer->info);
         if (token_length > 0) {
             is_token = true;
             if (token == COMMENT_TOKEN)
                 comment = true;
         }
         if (READ_CUSTOM_TOKEN(&token, &token_length, text + offset,
-         &custom_whitespace, &custom_data, tokenizer->info)) {
+         length - offset, &custom_whitespace, &custom_data, tokenizer->info)) {
             is_token = true;
             custom_token = true;
             end_token = false;
@@ -279,13 +388,23 @@ owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
             // Integer.
             size_t integer_offset = offset;
             uint64_t base = 10;
-            if (c == '0' && (text[offset + 1] == 'x' || text[offset + 1] == 'X') && (char_is_numeric(text[offset + 2]) || char_is_hexadecimal_alpha(text[integer_offset + 2]))) {
+            if (c == '0' && offset + 2 < length && (text[offset + 1] == 'x' || text[offset + 1] == 'X') && (char_is_numeric(text[offset + 2]) || char_is_hexadecimal_alpha(text[integer_offset + 2]))) {
                 integer_offset = offset + 2;
                 base = 16;
             }
             integer = 0;
             bool overflow = false;
-            while (char_is_numeric(text[integer_offset]) || (base == 16 && char_is_hexadecimal_alpha(text[integer_offset]))) {
+            while (base == 10 && integer_offset + 8 <= length &&
+             integer <= (UINT64_MAX - 99999999) / 100000000) {
+                uint64_t chunk = read_eight_bytes(text + integer_offset);
+                if (!eight_bytes_are_digits(chunk))
+                    break;
+                integer = integer * 100000000 + eight_digits_value(chunk);
+                integer_offset += 8;
+            }
+            size_t digits_end = SKIP_DIGITS(text, integer_offset, length,
+             base == 16);
+            while (integer_offset < digits_end || (integer_offset < length && (char_is_numeric(text[integer_offset]) || (base == 16 && char_is_hexadecimal_alpha(text[integer_offset]))))) {
                 uint64_t last = integer;
                 integer *= base;
                 uint64_t ch = text[integer_offset];
@@ -301,6 +420,8 @@ owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
                 }
                 integer_offset++;
             }
+            if (integer_offset >= limit)
+                deferred = true;
             if (!overflow && integer_offset - offset > token_length) {
                 token_length = integer_offset - offset;
                 is_token = true;
@@ -311,13 +432,18 @@ owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
             }
         })
         IF_NUMBER_TOKEN(char_is_numeric(c) ||
-         (c == '.' && char_is_numeric(text[offset + 1])), {
+         (c == '.' && offset + 1 < length &&
+         char_is_numeric(text[offset + 1])), {
             // Number.
-            const char *start = (const char *)text + offset;
-            char *rest = 0;
-            number = strtod(start, &rest);
-            if (rest > start && rest - start > token_length) {
-                token_length = rest - start;
+            size_t number_length = 0;
+            number = READ_NUMBER(text + offset, length - offset,
+             &number_length, tokenizer->allocator);
+            // At most three more characters (as in "1e+5") can extend a
+            // number once READ_NUMBER has stopped.
+            if (offset + number_length + 3 > limit)
+                deferred = true;
+            if (number_length > token_length) {
+                token_length = number_length;
                 is_token = true;
                 end_token = false;
                 comment = false;
@@ -326,8 +452,9 @@ owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
             }
         }) else IF_STRING_TOKEN(c == '\'' || c == '"', {
             // String.
-            size_t string_offset = offset + 1;
-            while (text[string_offset] != '\0') {
+            size_t string_offset = SKIP_STRING_CHARS(text, offset + 1, length,
+             c);
+            while (string_offset < length && text[string_offset] != '\0') {
                 if (text[string_offset] == c) {
                     token_length = string_offset + 1 - offset;
                     is_token = true;
@@ -340,17 +467,24 @@ owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
                 if (text[string_offset] == '\\') {
                     has_escapes = true;
                     string_offset++;
-                    if (text[string_offset] == '\0')
+                    if (string_offset >= length || text[string_offset] == '\0')
                         break;
                 }
-                string_offset++;
+                string_offset = SKIP_STRING_CHARS(text, string_offset + 1,
+                 length, c);
             }
+            if (string_offset >= limit)
+                deferred = true;
         }) else IF_IDENTIFIER_TOKEN(char_starts_identifier(c), {
             // Identifier.
-            size_t identifier_offset = offset + 1;
-            while (char_continues_identifier(text[identifier_offset],
+            size_t identifier_offset = SKIP_IDENTIFIER_CHARS(text, offset + 1,
+             length, tokenizer->info);
+            while (identifier_offset < length &&
+             char_continues_identifier(text[identifier_offset],
              tokenizer->info))
                 identifier_offset++;
+            if (identifier_offset >= limit)
+                deferred = true;
             while (!char_ends_identifier(text[identifier_offset - 1]))
                 identifier_offset--;
             if (identifier_offset - offset > token_length) {
@@ -360,22 +494,40 @@ owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
                 comment = false;
                 custom_whitespace = false;
                 token = IDENTIFIER_TOKEN;
+                // Keywords that look like identifiers may be left out of
+                // READ_KEYWORD_TOKEN and matched here instead.
+                IF_IDENTIFIER_KEYWORDS(!custom_token, {
+                    read_identifier_keyword(&token, &end_token, text + offset,
+                     token_length);
+                })
             }
         })
+        if (custom_token && offset + token_length >= token_limit)
+            deferred = true;
+        if (deferred)
+            break;
         if (custom_whitespace) {
             whitespace += token_length;
             offset += token_length;
             continue;
         } else if (comment) {
-            while (text[offset] != '\0' && text[offset] != '\n') {
-                whitespace++;
-                offset++;
+            size_t line_end = SKIP_LINE(text, offset, length);
+            while (line_end < length && text[line_end] != '\0' &&
+             text[line_end] != '\n')
+                line_end++;
+            if (line_end >= limit) {
+                deferred = true;
+                break;
             }
+            whitespace += line_end - offset;
+            offset = line_end;
             continue;
         } else if (!is_token || token == COMMENT_TOKEN) {
             tokenizer->offset = offset;
             tokenizer->whitespace = whitespace;
-            free(run);
+            tokenizer->deferred = false;
+            run->prev = tokenizer->free_runs;
+            tokenizer->free_runs = run;
             return false;
         }
         if (end_token && number_of_tokens + 1 >= TOKEN_RUN_LENGTH)
@@ -429,10 +581,12 @@ owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
             number_of_tokens++;
         }
     }
+    tokenizer->deferred = deferred;
     if (number_of_tokens == 0) {
         tokenizer->offset = offset;
         tokenizer->whitespace = whitespace;
-        free(run);
+        run->prev = tokenizer->free_runs;
+        tokenizer->free_runs = run;
         return false;
     }
     tokenizer->offset = offset;
@@ -444,6 +598,15 @@ owl_default_tokenizer_advance(struct owl_default_tokenizer *tokenizer,
     return true;
 }
 
+static void free_token_runs(struct owl_token_run **run, void *allocator)
+{
+    while (*run) {
+        struct owl_token_run *prev = (*run)->prev;
+        FREE_MEMORY(*run, sizeof(struct owl_token_run), allocator);
+        *run = prev;
+    }
+}
+
 // Here, 'run' must be the most recent run produced by the tokenizer.
 static void find_token_range(struct owl_default_tokenizer *tokenizer,
  struct owl_token_run *run, uint16_t index, size_t *start, size_t *end)
@@ -468,8 +631,9 @@ static void estimate_next_token_range(struct owl_default_tokenizer
 {
     *start = tokenizer->offset;
     size_t i = tokenizer->offset + 1;
-    while (tokenizer->text[i] != '\0' && !char_is_whitespace(tokenizer->text[i])
-     && !char_continues_identifier(tokenizer->text[i], tokenizer->info))
+    while (i < tokenizer->length && tokenizer->text[i] != '\0' &&
+     !char_is_whitespace(tokenizer->text[i]) &&
+     !char_continues_identifier(tokenizer->text[i], tokenizer->info))
         i++;
     *end = i;
 }